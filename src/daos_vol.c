@@ -32,15 +32,15 @@
     } while (0)
 
 /* Macro to adjust the next OIDX and max. OIDX pointers after
- * allocating more OIDXs from DAOS.
+ * allocating nalloc more OIDXs from DAOS.
  */
-#define H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx_ptr, max_oidx_ptr)                                        \
+#define H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx_ptr, max_oidx_ptr, nalloc)                                \
     do {                                                                                                     \
         /* Set max oidx */                                                                                   \
-        (*max_oidx_ptr) = (*next_oidx_ptr) + H5_DAOS_OIDX_NALLOC - 1;                                        \
+        (*max_oidx_ptr) = (*next_oidx_ptr) + (nalloc)-1;                                                     \
                                                                                                              \
         /* Skip over reserved indices for the next oidx */                                                   \
-        assert(H5_DAOS_OIDX_NALLOC > H5_DAOS_OIDX_FIRST_USER);                                               \
+        assert((nalloc) > H5_DAOS_OIDX_FIRST_USER);                                                          \
         if ((*next_oidx_ptr) < H5_DAOS_OIDX_FIRST_USER)                                                      \
             (*next_oidx_ptr) = H5_DAOS_OIDX_FIRST_USER;                                                      \
     } while (0)
@@ -106,6 +106,7 @@ static int    H5_daos_oidx_bcast_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_oidx_bcast_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_oidx_generate_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_oidx_generate_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_oidx_generate_wait_task(tse_task_t *task);
 static int    H5_daos_oid_encode_task(tse_task_t *task);
 static int    H5_daos_list_key_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_list_key_finish(tse_task_t *task);
@@ -189,7 +190,7 @@ static const H5VL_class_t H5_daos_g = {
         H5_daos_dataset_write,    /* Connector Dataset write */
         H5_daos_dataset_get,      /* Connector Dataset get */
         H5_daos_dataset_specific, /* Connector Dataset specific */
-        NULL,                     /* Connector Dataset optional */
+        H5_daos_dataset_optional, /* Connector Dataset optional */
         H5_daos_dataset_close     /* Connector Dataset close */
     },
     {
@@ -296,6 +297,19 @@ hbool_t H5_daos_bypass_duns_g = FALSE;
 /* Target chunk size for automatic chunking */
 uint64_t H5_daos_chunk_target_size_g = H5_DAOS_CHUNK_TARGET_SIZE_DEF;
 
+/* Number of chunks per task batch for raw data I/O */
+uint64_t H5_daos_chunk_task_batch_size_g = H5_DAOS_CHUNK_TASK_BATCH_SIZE_DEF;
+
+/* Target slab size and number of slabs in flight when copying dataset data */
+uint64_t H5_daos_copy_slab_size_g = H5_DAOS_COPY_SLAB_SIZE_DEF;
+uint64_t H5_daos_copy_nslabs_g    = H5_DAOS_COPY_NSLABS_DEF;
+
+/* Number of objects copied at once when copying a group hierarchy */
+uint64_t H5_daos_copy_nobjs_g = H5_DAOS_COPY_NOBJS_DEF;
+
+/* Size of the buffer collecting sequences for the VL heap */
+uint64_t H5_daos_vl_heap_buf_size_g = H5_DAOS_VL_HEAP_BUF_SIZE_DEF;
+
 /* Global scheduler - used for tasks that are not tied to any open file */
 tse_sched_t H5_daos_glob_sched_g;
 
@@ -322,24 +336,27 @@ struct H5_daos_req_t *H5_daos_collective_req_tail = NULL;
 int H5_daos_api_count = 0;
 
 /* Constant Keys */
-const char H5_daos_int_md_key_g[]          = "/Internal Metadata";
-const char H5_daos_root_grp_oid_key_g[]    = "Root Group OID";
-const char H5_daos_rc_key_g[]              = "Ref Count";
-const char H5_daos_cpl_key_g[]             = "Creation Property List";
-const char H5_daos_link_key_g[]            = "Link";
-const char H5_daos_link_corder_key_g[]     = "/Link Creation Order";
-const char H5_daos_nlinks_key_g[]          = "Num Links";
-const char H5_daos_max_link_corder_key_g[] = "Max Link Creation Order";
-const char H5_daos_type_key_g[]            = "Datatype";
-const char H5_daos_space_key_g[]           = "Dataspace";
-const char H5_daos_attr_key_g[]            = "/Attribute";
-const char H5_daos_nattr_key_g[]           = "Num Attributes";
-const char H5_daos_max_attr_corder_key_g[] = "Max Attribute Creation Order";
-const char H5_daos_ktype_g[]               = "Key Datatype";
-const char H5_daos_vtype_g[]               = "Value Datatype";
-const char H5_daos_map_key_g[]             = "Map Record";
-const char H5_daos_blob_key_g[]            = "Blob";
-const char H5_daos_fillval_key_g[]         = "Fill Value";
+const char H5_daos_int_md_key_g[]              = "/Internal Metadata";
+const char H5_daos_root_grp_oid_key_g[]        = "Root Group OID";
+const char H5_daos_rc_key_g[]                  = "Ref Count";
+const char H5_daos_cpl_key_g[]                 = "Creation Property List";
+const char H5_daos_link_key_g[]                = "Link";
+const char H5_daos_link_corder_key_g[]         = "/Link Creation Order";
+const char H5_daos_nlinks_key_g[]              = "Num Links";
+const char H5_daos_max_link_corder_key_g[]     = "Max Link Creation Order";
+const char H5_daos_link_corder_version_key_g[] = "Link Creation Order Index Version";
+const char H5_daos_type_key_g[]                = "Datatype";
+const char H5_daos_space_key_g[]               = "Dataspace";
+const char H5_daos_attr_key_g[]                = "/Attribute";
+const char H5_daos_nattr_key_g[]               = "Num Attributes";
+const char H5_daos_max_attr_corder_key_g[]     = "Max Attribute Creation Order";
+const char H5_daos_ktype_g[]                   = "Key Datatype";
+const char H5_daos_vtype_g[]                   = "Value Datatype";
+const char H5_daos_map_key_g[]                 = "Map Record";
+const char H5_daos_blob_key_g[]                = "Blob";
+const char H5_daos_fillval_key_g[]             = "Fill Value";
+const char H5_daos_compact_key_g[]             = "Compact Raw Data";
+const char H5_daos_filtered_chunks_key_g[]     = "Filtered Chunks";
 
 const daos_size_t H5_daos_int_md_key_size_g       = (daos_size_t)(sizeof(H5_daos_int_md_key_g) - 1);
 const daos_size_t H5_daos_root_grp_oid_key_size_g = (daos_size_t)(sizeof(H5_daos_root_grp_oid_key_g) - 1);
@@ -350,6 +367,8 @@ const daos_size_t H5_daos_link_corder_key_size_g  = (daos_size_t)(sizeof(H5_daos
 const daos_size_t H5_daos_nlinks_key_size_g       = (daos_size_t)(sizeof(H5_daos_nlinks_key_g) - 1);
 const daos_size_t H5_daos_max_link_corder_key_size_g =
     (daos_size_t)(sizeof(H5_daos_max_link_corder_key_g) - 1);
+const daos_size_t H5_daos_link_corder_version_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_link_corder_version_key_g) - 1);
 const daos_size_t H5_daos_type_key_size_g  = (daos_size_t)(sizeof(H5_daos_type_key_g) - 1);
 const daos_size_t H5_daos_space_key_size_g = (daos_size_t)(sizeof(H5_daos_space_key_g) - 1);
 const daos_size_t H5_daos_attr_key_size_g  = (daos_size_t)(sizeof(H5_daos_attr_key_g) - 1);
@@ -361,6 +380,19 @@ const daos_size_t H5_daos_vtype_size_g       = (daos_size_t)(sizeof(H5_daos_vtyp
 const daos_size_t H5_daos_map_key_size_g     = (daos_size_t)(sizeof(H5_daos_map_key_g) - 1);
 const daos_size_t H5_daos_blob_key_size_g    = (daos_size_t)(sizeof(H5_daos_blob_key_g) - 1);
 const daos_size_t H5_daos_fillval_key_size_g = (daos_size_t)(sizeof(H5_daos_fillval_key_g) - 1);
+const daos_size_t H5_daos_compact_key_size_g = (daos_size_t)(sizeof(H5_daos_compact_key_g) - 1);
+const daos_size_t H5_daos_filtered_chunks_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_filtered_chunks_key_g) - 1);
+
+/* Dataset chunk index keys.  Chunk entries are akeys holding the encoded
+ * chunk coordinates, a multiple of 8 bytes long, so they can't collide with
+ * the marker that shows the index is complete. */
+const char H5_daos_chunk_index_key_g[]       = "/Chunk Index";
+const char H5_daos_chunk_index_valid_key_g[] = "Chunk Index Valid";
+
+const daos_size_t H5_daos_chunk_index_key_size_g = (daos_size_t)(sizeof(H5_daos_chunk_index_key_g) - 1);
+const daos_size_t H5_daos_chunk_index_valid_key_size_g =
+    (daos_size_t)(sizeof(H5_daos_chunk_index_valid_key_g) - 1);
 
 /*-------------------------------------------------------------------------
  * Function:    H5Pset_fapl_daos
@@ -914,6 +946,425 @@ done:
     D_FUNC_LEAVE_API;
 } /* end H5daos_get_all_ind_metadata_ops() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_tconv_nthreads
+ *
+ * Purpose:     Modifies the file access property list to request a pool
+ *              of nthreads worker threads for converting chunks read
+ *              from datasets to the memory datatype.  The pool is shared
+ *              by all open files and is grown to the largest size
+ *              requested when a file is opened or created.  0 (the
+ *              default) requests no threads.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_tconv_nthreads(hid_t fapl_id, unsigned nthreads)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (fapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property already exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for type conversion threads property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, &nthreads) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set type conversion threads property");
+    } /* end if */
+    else if (H5Pinsert2(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, sizeof(unsigned), &nthreads, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_tconv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_tconv_nthreads
+ *
+ * Purpose:     Retrieves the number of type conversion worker threads
+ *              requested on the file access property list, as set by
+ *              H5daos_set_tconv_nthreads().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_tconv_nthreads(hid_t fapl_id, unsigned *nthreads)
+{
+    htri_t is_fapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (!nthreads)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nthreads is NULL");
+
+    if ((is_fapl = H5Pisa_class(fapl_id, H5P_FILE_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_fapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a file access property list");
+
+    /* Check if the property exists on the property list */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for type conversion threads property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, nthreads) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get type conversion threads property");
+    } /* end if */
+    else
+        *nthreads = 0;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_tconv_nthreads() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_chunk_cache
+ *
+ * Purpose:     Modifies the dataset access property list to request a
+ *              write-back cache of up to nbytes bytes of raw chunk data
+ *              for each dataset opened with it.  0 (the default)
+ *              disables the cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_chunk_cache(hid_t dapl_id, size_t nbytes)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (dapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property already exists on the property list */
+    if ((prop_exists = H5Pexist(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk cache size property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, &nbytes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk cache size property");
+    } /* end if */
+    else if (H5Pinsert2(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, sizeof(size_t), &nbytes, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_chunk_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_chunk_cache
+ *
+ * Purpose:     Retrieves the chunk cache size requested on the dataset
+ *              access property list, as set by H5daos_set_chunk_cache().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_chunk_cache(hid_t dapl_id, size_t *nbytes)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (!nbytes)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nbytes is NULL");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property exists on the property list */
+    if ((prop_exists = H5Pexist(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk cache size property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, nbytes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache size property");
+    } /* end if */
+    else
+        *nbytes = 0;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_chunk_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_chunk_readahead
+ *
+ * Purpose:     Modifies the dataset access property list to request that
+ *              the next nchunks chunks be prefetched when a dataset
+ *              opened with it is read sequentially.  0 (the default)
+ *              disables readahead.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_chunk_readahead(hid_t dapl_id, unsigned nchunks)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (dapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property already exists on the property list */
+    if ((prop_exists = H5Pexist(dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk readahead property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME, &nchunks) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set chunk readahead property");
+    } /* end if */
+    else if (H5Pinsert2(dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME, sizeof(unsigned), &nchunks, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_chunk_readahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_chunk_readahead
+ *
+ * Purpose:     Retrieves the number of chunks to read ahead requested on
+ *              the dataset access property list, as set by
+ *              H5daos_set_chunk_readahead().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_chunk_readahead(hid_t dapl_id, unsigned *nchunks)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (!nchunks)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nchunks is NULL");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property exists on the property list */
+    if ((prop_exists = H5Pexist(dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for chunk readahead property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME, nchunks) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk readahead property");
+    } /* end if */
+    else
+        *nchunks = 0;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_chunk_readahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_set_write_combine
+ *
+ * Purpose:     Modifies the dataset access property list to request that
+ *              writes to datasets opened with it be combined in the
+ *              chunk cache until nbytes bytes are buffered.  0 (the
+ *              default) sets no limit besides the chunk cache size.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_set_write_combine(hid_t dapl_id, size_t nbytes)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (dapl_id == H5P_DEFAULT)
+        D_GOTO_ERROR(H5E_PLIST, H5E_BADVALUE, FAIL, "can't set values in default property list");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property already exists on the property list */
+    if ((prop_exists = H5Pexist(dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for write combining size property");
+
+    /* Set the property, or insert it if it does not exist */
+    if (prop_exists) {
+        if (H5Pset(dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME, &nbytes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set write combining size property");
+    } /* end if */
+    else if (H5Pinsert2(dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME, sizeof(size_t), &nbytes, NULL, NULL,
+                        NULL, NULL, NULL, NULL) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTINSERT, FAIL, "can't insert property into list");
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_set_write_combine() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_get_write_combine
+ *
+ * Purpose:     Retrieves the write combining size requested on the
+ *              dataset access property list, as set by
+ *              H5daos_set_write_combine().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_get_write_combine(hid_t dapl_id, size_t *nbytes)
+{
+    htri_t is_dapl;
+    htri_t prop_exists;
+    herr_t ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (!nbytes)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "nbytes is NULL");
+
+    if ((is_dapl = H5Pisa_class(dapl_id, H5P_DATASET_ACCESS)) < 0)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "couldn't determine property list class");
+    if (!is_dapl)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "not a dataset access property list");
+
+    /* Check if the property exists on the property list */
+    if ((prop_exists = H5Pexist(dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for write combining size property");
+
+    if (prop_exists) {
+        /* Get the property */
+        if (H5Pget(dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME, nbytes) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get write combining size property");
+    } /* end if */
+    else
+        *nbytes = 0;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5daos_get_write_combine() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5daos_link_create_hard_multi
+ *
+ * Purpose:     Creates count hard links in the group loc_id (or the root
+ *              group if loc_id is a file), named names[i] and pointing to
+ *              the objects obj_ids[i], as one operation.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5daos_link_create_hard_multi(hid_t loc_id, size_t count, const char *const names[], const hid_t obj_ids[])
+{
+    H5_daos_item_t  *item;
+    H5_daos_group_t *grp;
+    H5_daos_obj_t  **objs = NULL;
+    size_t           i;
+    herr_t           ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (count > 0 && !names)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link names array is NULL");
+    if (count > 0 && !obj_ids)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "target object ID array is NULL");
+
+    /* Get the group to create the links in */
+    if (NULL == (item = (H5_daos_item_t *)H5VLobject(loc_id)))
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (H5I_FILE == item->type)
+        grp = ((H5_daos_file_t *)item)->root_grp;
+    else if (H5I_GROUP == item->type)
+        grp = (H5_daos_group_t *)item;
+    else
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "location is not a file or group");
+
+    /* Get the target objects */
+    if (count > 0 && NULL == (objs = (H5_daos_obj_t **)DV_malloc(count * sizeof(H5_daos_obj_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate target object array");
+    for (i = 0; i < count; i++) {
+        if (NULL == (objs[i] = (H5_daos_obj_t *)H5VLobject(obj_ids[i])))
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+        if (H5I_GROUP != objs[i]->item.type && H5I_DATASET != objs[i]->item.type &&
+            H5I_DATATYPE != objs[i]->item.type && H5I_MAP != objs[i]->item.type)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "link target is not a group, dataset, datatype or map");
+    } /* end for */
+
+    /* Create the links */
+    if (H5_daos_link_create_hard_multi(grp, count, names, objs) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create links");
+
+done:
+    objs = DV_free(objs);
+
+    D_FUNC_LEAVE_API;
+} /* end H5daos_link_create_hard_multi() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_str_prop_delete
  *
@@ -1147,7 +1598,13 @@ H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
 #ifdef DV_HAVE_SNAP_OPEN_ID
     H5_daos_snap_id_t snap_id_default;
 #endif
-    char  *auto_chunk_str = NULL;
+    char  *auto_chunk_str       = NULL;
+    char  *batch_size_str       = NULL;
+    char  *tconv_nthreads_str   = NULL;
+    char  *copy_slab_size_str   = NULL;
+    char  *copy_nslabs_str      = NULL;
+    char  *copy_nobjs_str       = NULL;
+    char  *vl_heap_buf_size_str = NULL;
     int    ret;
     herr_t ret_value = SUCCEED; /* Return value */
 
@@ -1204,6 +1661,79 @@ H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
         H5_daos_chunk_target_size_g = (uint64_t)chunk_target_size_ll;
     } /* end if */
 
+    /* Determine chunk I/O batch size */
+    if (NULL != (batch_size_str = getenv("HDF5_DAOS_CHUNK_TASK_BATCH_SIZE"))) {
+        long long batch_size_ll;
+
+        errno = 0;
+        if ((batch_size_ll = strtoll(batch_size_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse chunk I/O batch size from environment or invalid value "
+                         "(HDF5_DAOS_CHUNK_TASK_BATCH_SIZE)");
+        H5_daos_chunk_task_batch_size_g = (uint64_t)batch_size_ll;
+    } /* end if */
+
+    /* Determine slab size and number of slabs in flight for copying dataset
+     * data */
+    if (NULL != (copy_slab_size_str = getenv("HDF5_DAOS_COPY_SLAB_SIZE"))) {
+        long long copy_slab_size_ll;
+
+        errno = 0;
+        if ((copy_slab_size_ll = strtoll(copy_slab_size_str, NULL, 10)) <= 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse dataset copy slab size from environment or invalid value "
+                         "(HDF5_DAOS_COPY_SLAB_SIZE)");
+        H5_daos_copy_slab_size_g = (uint64_t)copy_slab_size_ll;
+    } /* end if */
+    if (NULL != (copy_nslabs_str = getenv("HDF5_DAOS_COPY_NSLABS"))) {
+        long long copy_nslabs_ll;
+
+        errno = 0;
+        if ((copy_nslabs_ll = strtoll(copy_nslabs_str, NULL, 10)) <= 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse number of dataset copy slabs from environment or invalid value "
+                         "(HDF5_DAOS_COPY_NSLABS)");
+        H5_daos_copy_nslabs_g = (uint64_t)copy_nslabs_ll;
+    } /* end if */
+
+    /* Determine number of objects copied at once when copying a group
+     * hierarchy */
+    if (NULL != (copy_nobjs_str = getenv("HDF5_DAOS_COPY_NOBJS"))) {
+        long long copy_nobjs_ll;
+
+        errno = 0;
+        if ((copy_nobjs_ll = strtoll(copy_nobjs_str, NULL, 10)) <= 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse number of objects copied at once from environment or invalid value "
+                         "(HDF5_DAOS_COPY_NOBJS)");
+        H5_daos_copy_nobjs_g = (uint64_t)copy_nobjs_ll;
+    } /* end if */
+
+    /* Determine size of the buffer collecting sequences for the VL heap */
+    if (NULL != (vl_heap_buf_size_str = getenv("HDF5_DAOS_VL_HEAP_BUF_SIZE"))) {
+        long long vl_heap_buf_size_ll;
+
+        errno = 0;
+        if ((vl_heap_buf_size_ll = strtoll(vl_heap_buf_size_str, NULL, 10)) <= 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse VL heap buffer size from environment or invalid value "
+                         "(HDF5_DAOS_VL_HEAP_BUF_SIZE)");
+        H5_daos_vl_heap_buf_size_g = (uint64_t)vl_heap_buf_size_ll;
+    } /* end if */
+
+    /* Determine number of type conversion worker threads and start them */
+    if (NULL != (tconv_nthreads_str = getenv("HDF5_DAOS_TCONV_NTHREADS"))) {
+        long long tconv_nthreads_ll;
+
+        errno = 0;
+        if ((tconv_nthreads_ll = strtoll(tconv_nthreads_str, NULL, 10)) < 0 || errno)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                         "failed to parse number of type conversion threads from environment or invalid value "
+                         "(HDF5_DAOS_TCONV_NTHREADS)");
+        if (H5_daos_tconv_pool_init((size_t)tconv_nthreads_ll) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't start type conversion worker pool");
+    } /* end if */
+
     /* Initialize global scheduler */
     if (0 != (ret = tse_sched_init(&H5_daos_glob_sched_g, NULL, NULL)))
         D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create global task scheduler: %s",
@@ -1223,6 +1753,10 @@ H5_daos_init(hid_t H5VL_DAOS_UNUSED vipl_id)
 done:
     if (ret_value < 0) {
         H5_daos_term();
+
+        /* The worker pool may have been started before the connector was
+         * marked as initialized */
+        H5_daos_tconv_pool_term();
     } /* end if */
 
     D_FUNC_LEAVE;
@@ -1264,6 +1798,9 @@ H5_daos_term(void)
         D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler");
     tse_sched_fini(&H5_daos_glob_sched_g);
 
+    /* Stop type conversion worker pool */
+    H5_daos_tconv_pool_term();
+
     /* Terminate DAOS */
     if (daos_fini() < 0)
         D_GOTO_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "DAOS failed to terminate");
@@ -2203,6 +2740,12 @@ done:
  *              additional object indices for the given container before
  *              generating the object index that is returned.
  *
+ *              Independent allocations are coalesced: if another
+ *              independent allocation is already in progress when this
+ *              process runs out of object indices, the index is instead
+ *              taken from that allocation once it completes, so
+ *              concurrent object creations share one DAOS call.
+ *
  * Return:      Success:    0
  *              Failure:    -1
  *
@@ -2226,9 +2769,50 @@ H5_daos_oidx_generate(uint64_t *oidx, H5_daos_file_t *file, hbool_t collective,
 
     /* Allocate more object indices for this process if necessary */
     if ((*max_oidx == 0) || (*next_oidx > *max_oidx)) {
-        /* Check if this process should allocate object IDs or just wait for the
+        /* Check if this process should allocate object IDs, wait for an
+         * independent allocation already in progress, or just wait for the
          * result from the leader process */
-        if (!collective || (file->my_rank == 0)) {
+        if (!collective && file->oidx_alloc_task) {
+            tse_task_t *dep_tasks[2];
+
+            /* Set private data for OIDX wait task */
+            if (NULL == (generate_udata =
+                             (H5_daos_oidx_generate_ud_t *)DV_malloc(sizeof(H5_daos_oidx_generate_ud_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate user data struct for OIDX wait task");
+            generate_udata->generic_ud.req       = req;
+            generate_udata->generic_ud.task_name = "OIDX wait";
+            generate_udata->file                 = file;
+            generate_udata->collective           = FALSE;
+            generate_udata->oidx_out             = oidx;
+            generate_udata->next_oidx            = next_oidx;
+            generate_udata->max_oidx             = max_oidx;
+            generate_udata->nalloc               = 0;
+
+            /* Create task to take the OIDX from the allocation in progress */
+            dep_tasks[0] = file->oidx_alloc_task;
+            dep_tasks[1] = *dep_task;
+            if (H5_daos_create_task(H5_daos_oidx_generate_wait_task, *dep_task ? 2 : 1, dep_tasks, NULL, NULL,
+                                    generate_udata, &generate_task) < 0)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to wait for OIDX generation");
+
+            /* Schedule OIDX wait task (or save it to be scheduled later) and
+             * give it a reference to req and the file */
+            if (*first_task) {
+                if (0 != (ret = tse_task_schedule(generate_task, false)))
+                    D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL,
+                                 "can't schedule task to wait for OIDX generation: %s",
+                                 H5_daos_err_to_string(ret));
+            }
+            else
+                *first_task = generate_task;
+            req->rc++;
+            file->item.rc++;
+            generate_udata = NULL;
+
+            *dep_task = generate_task;
+        } /* end if */
+        else if (!collective || (file->my_rank == 0)) {
             /* Set private data for OIDX generation task */
             if (NULL == (generate_udata =
                              (H5_daos_oidx_generate_ud_t *)DV_malloc(sizeof(H5_daos_oidx_generate_ud_t))))
@@ -2241,6 +2825,7 @@ H5_daos_oidx_generate(uint64_t *oidx, H5_daos_file_t *file, hbool_t collective,
             generate_udata->oidx_out             = oidx;
             generate_udata->next_oidx            = next_oidx;
             generate_udata->max_oidx             = max_oidx;
+            generate_udata->nalloc               = H5_DAOS_OIDX_NALLOC;
 
             /* Create task to allocate oidxs */
             if (H5_daos_create_daos_task(DAOS_OPC_CONT_ALLOC_OIDS, *dep_task ? 1 : 0,
@@ -2264,6 +2849,10 @@ H5_daos_oidx_generate(uint64_t *oidx, H5_daos_file_t *file, hbool_t collective,
              * task's completion callback */
             generate_udata = NULL;
 
+            /* Let later independent generations wait for this allocation */
+            if (!collective)
+                file->oidx_alloc_task = generate_task;
+
             *dep_task = generate_task;
         } /* end if */
 
@@ -2330,8 +2919,18 @@ H5_daos_oidx_generate_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     if (NULL == (alloc_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTGET, -H5_DAOS_DAOS_GET_ERROR,
                      "can't get arguments for OIDX generation task");
-    alloc_args->coh      = udata->generic_ud.req->file->coh;
-    alloc_args->num_oids = H5_DAOS_OIDX_NALLOC;
+    alloc_args->coh = udata->generic_ud.req->file->coh;
+
+    /* For independent allocations, allocate enough indices for the objects
+     * callers have announced they are about to create.  Collective
+     * allocations must use the same count on all ranks. */
+    if (!udata->collective) {
+        udata->nalloc = MAX(udata->file->oidx_nalloc_hint, H5_DAOS_OIDX_NALLOC);
+        udata->nalloc = MIN(udata->nalloc, H5_DAOS_OIDX_NALLOC_MAX);
+
+        udata->file->oidx_nalloc_hint = 0;
+    } /* end if */
+    alloc_args->num_oids = udata->nalloc;
     alloc_args->oid      = udata->next_oidx;
 
 done:
@@ -2375,6 +2974,10 @@ H5_daos_oidx_generate_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
     assert(udata->file);
 
+    /* This allocation is no longer in progress */
+    if (udata->file->oidx_alloc_task == task)
+        udata->file->oidx_alloc_task = NULL;
+
     /* Handle errors in OIDX generation task.  Only record error in udata->req_status if
      * it does not already contain an error (it could contain an error if
      * another task this task is not dependent on also failed). */
@@ -2394,7 +2997,7 @@ H5_daos_oidx_generate_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
          */
         if (!udata->collective || (udata->generic_ud.req->file->num_procs == 1)) {
             /* Adjust the max and next OIDX values for the file on this process */
-            H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx);
+            H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx, udata->nalloc);
 
             /* Allocate oidx from local allocation */
             H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, next_oidx, max_oidx);
@@ -2430,6 +3033,107 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_oidx_generate_comp_cb() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_oidx_generate_wait_task
+ *
+ * Purpose:     Asynchronous task for generating an object index after
+ *              waiting for an independent OIDX allocation that was
+ *              already in progress.  Takes the index from that
+ *              allocation, or generates it again if other waiters used
+ *              all of the allocated indices.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_oidx_generate_wait_task(tse_task_t *task)
+{
+    H5_daos_oidx_generate_ud_t *udata;
+    tse_task_t                 *first_task = NULL;
+    tse_task_t                 *dep_task   = NULL;
+    hbool_t                     complete   = TRUE;
+    int                         ret;
+    int                         ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for OIDX wait task");
+
+    assert(udata->file);
+    assert(!udata->collective);
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->generic_ud.req, H5E_VOL);
+
+    /* Allocate oidx from local allocation if possible, otherwise generate it
+     * again and complete this task once that is done */
+    if ((*udata->max_oidx != 0) && (*udata->next_oidx <= *udata->max_oidx))
+        H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, udata->next_oidx, udata->max_oidx);
+    else {
+        if (H5_daos_oidx_generate(udata->oidx_out, udata->file, FALSE, udata->generic_ud.req, &first_task,
+                                  &dep_task) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't generate object index");
+
+        if (dep_task) {
+            tse_task_t *comp_task;
+
+            /* Create metatask to complete this task after the generation */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &comp_task) < 0)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for OIDX wait");
+
+            /* Schedule metatask */
+            assert(first_task);
+            if (0 != (ret = tse_task_schedule(comp_task, false)))
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule metatask for OIDX wait: %s",
+                             H5_daos_err_to_string(ret));
+            complete = FALSE;
+        } /* end if */
+    }     /* end else */
+
+done:
+    /* Schedule first task */
+    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+        D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't schedule initial task for OIDX generation: %s",
+                     H5_daos_err_to_string(ret));
+
+    if (udata) {
+        /* Release our reference on the file */
+        if (H5_daos_file_close_helper(udata->file) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->generic_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->generic_ud.req->status      = ret_value;
+            udata->generic_ud.req->failed_task = udata->generic_ud.task_name;
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->generic_ud.req) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free private data */
+        DV_free(udata);
+    } /* end if */
+
+    /* Complete this task unless the metatask will */
+    if (complete) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_oidx_generate_wait_task() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_oidx_bcast
  *
@@ -2611,7 +3315,7 @@ H5_daos_oidx_bcast_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         }
 
         /* Adjust the max and next OIDX values for the file on this process */
-        H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx);
+        H5_DAOS_ADJUST_MAX_AND_NEXT_OIDX(next_oidx, max_oidx, H5_DAOS_OIDX_NALLOC);
 
         /* Allocate oidx from local allocation */
         H5_DAOS_ALLOCATE_NEXT_OIDX(udata->oidx_out, next_oidx, max_oidx);
@@ -4830,6 +5534,10 @@ H5_daos_progress(H5_daos_req_t *req, uint64_t timeout)
             } /* end if */
         }     /* end if */
 
+        /* Complete tasks for finished type conversion jobs */
+        if (H5_daos_tconv_pool_progress() < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress type conversion worker pool");
+
         /* Progress DAOS */
         if ((0 != (ret = daos_progress(&H5_daos_glob_sched_g,
                                        timeout_rem > (1000000 * H5_DAOS_ASYNC_POLL_INTERVAL)
@@ -4962,6 +5670,10 @@ H5_daos_task_wait(tse_task_t **first_task, tse_task_t **dep_task)
                 } /* end if */
             }     /* end if */
 
+            /* Complete tasks for finished type conversion jobs */
+            if (H5_daos_tconv_pool_progress() < 0)
+                D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress type conversion worker pool");
+
             /* Progress DAOS */
             if ((0 != (ret = daos_progress(&H5_daos_glob_sched_g, H5_DAOS_ASYNC_POLL_INTERVAL, &is_empty))) &&
                 (ret != -DER_TIMEDOUT))
@@ -168,6 +168,142 @@ H5VL_DAOS_PUBLIC herr_t H5daos_set_all_ind_metadata_ops(hid_t accpl_id, hbool_t
  */
 H5VL_DAOS_PUBLIC herr_t H5daos_get_all_ind_metadata_ops(hid_t accpl_id, hbool_t *is_independent);
 
+/**
+ * Modifies the given file access property list to request a pool of
+ * worker threads that convert chunks read from datasets to the memory
+ * datatype while later chunks are still being fetched. The pool is
+ * shared by all open files. Only conversions the connector implements
+ * natively are run on the pool. The default is 0 (no pool), unless
+ * overridden by the HDF5_DAOS_TCONV_NTHREADS environment variable.
+ *
+ * \param fapl_id  [IN]   File access property list
+ * \param nthreads [IN]   Number of type conversion worker threads
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_tconv_nthreads(hid_t fapl_id, unsigned nthreads);
+
+/**
+ * Retrieves the number of type conversion worker threads requested on
+ * the given file access property list.
+ *
+ * \param fapl_id  [IN]   File access property list
+ * \param nthreads [OUT]  Number of type conversion worker threads
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_tconv_nthreads(hid_t fapl_id, unsigned *nthreads);
+
+/**
+ * Modifies the given dataset access property list to request a cache of
+ * up to nbytes bytes of raw chunk data for datasets opened or created
+ * with it. Reads and writes of whole elements without type conversion
+ * on chunked datasets without filters are served from the cache, and
+ * modified chunks are written back when evicted, when the dataset is
+ * flushed and when it is closed. The cache is private to the process,
+ * so it should only be used when no other process accesses the same
+ * chunks while the dataset is open. The default is 0 (no cache).
+ *
+ * \param dapl_id [IN]   Dataset access property list
+ * \param nbytes  [IN]   Maximum size of the chunk cache in bytes
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_chunk_cache(hid_t dapl_id, size_t nbytes);
+
+/**
+ * Retrieves the chunk cache size requested on the given dataset access
+ * property list.
+ *
+ * \param dapl_id [IN]   Dataset access property list
+ * \param nbytes  [OUT]  Maximum size of the chunk cache in bytes
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_chunk_cache(hid_t dapl_id, size_t *nbytes);
+
+/**
+ * Modifies the given dataset access property list to request readahead of
+ * up to nchunks chunks for datasets opened or created with it. When a
+ * read through the chunk cache starts at or just after the last chunk
+ * read before, fetches of the following chunks are started in the
+ * background so later sequential reads find them in the cache. If the
+ * chunk cache is smaller than the readahead window it is enlarged, and if
+ * no chunk cache was requested one is created. The default is 0 (no
+ * readahead).
+ *
+ * \param dapl_id [IN]   Dataset access property list
+ * \param nchunks [IN]   Number of chunks to read ahead
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_chunk_readahead(hid_t dapl_id, unsigned nchunks);
+
+/**
+ * Retrieves the number of chunks to read ahead requested on the given
+ * dataset access property list.
+ *
+ * \param dapl_id [IN]   Dataset access property list
+ * \param nchunks [OUT]  Number of chunks to read ahead
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_chunk_readahead(hid_t dapl_id, unsigned *nchunks);
+
+/**
+ * Modifies the given dataset access property list to request that writes
+ * to datasets opened or created with it be combined in the chunk cache.
+ * Writes of a single run of elements within a chunk are buffered without
+ * fetching the rest of the chunk, and adjacent or overlapping writes to
+ * the chunk extend the buffered run. All buffered data is written, with
+ * one update per chunk, once nbytes bytes are buffered, as well as when a
+ * chunk is evicted, when the dataset is flushed and when it is closed. If
+ * no chunk cache was requested, one that holds nbytes bytes (and at least
+ * one chunk) is created. The default is 0 (no limit on buffered data
+ * besides the chunk cache size).
+ *
+ * \param dapl_id [IN]   Dataset access property list
+ * \param nbytes  [IN]   Amount of buffered data that triggers writing
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_set_write_combine(hid_t dapl_id, size_t nbytes);
+
+/**
+ * Retrieves the write combining size requested on the given dataset access
+ * property list.
+ *
+ * \param dapl_id [IN]   Dataset access property list
+ * \param nbytes  [OUT]  Amount of buffered data that triggers writing
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_get_write_combine(hid_t dapl_id, size_t *nbytes);
+
+/**
+ * Creates count hard links in the group loc_id, or in the root group if loc_id
+ * is a file. Link i is named names[i], which must be a single path component,
+ * and points to the group, dataset, committed datatype or map obj_ids[i], which
+ * must be in the same file. This is equivalent to calling H5Lcreate_hard() for
+ * each link, but the link writes are issued together, and if the group tracks
+ * link creation order its creation order info is read and written once for all
+ * links. The links are not created atomically: if a link cannot be created, for
+ * example because it already exists, the call fails, but the other links are
+ * still created, with the group's link count, creation order index and the
+ * targets' reference counts updated for them. Unless independent
+ * metadata writes were requested on the file access property list, this must
+ * be called collectively with the same arguments on all processes.
+ *
+ * \param loc_id  [IN]   Group or file to create the links in
+ * \param count   [IN]   Number of links to create
+ * \param names   [IN]   Link names
+ * \param obj_ids [IN]   Objects the links point to
+ *
+ * \return Non-negative on success/Negative on failure
+ */
+H5VL_DAOS_PUBLIC herr_t H5daos_link_create_hard_multi(hid_t loc_id, size_t count, const char *const names[],
+                                                      const hid_t obj_ids[]);
+
 #ifdef DSINC
 H5VL_DAOS_PUBLIC herr_t H5daos_snap_create(hid_t loc_id, H5_daos_snap_id_t *snap_id);
 #endif
@@ -124,6 +124,7 @@ typedef struct H5_daos_attr_iterate_ud_t {
             daos_key_desc_t       kds[H5_DAOS_ITER_LEN];
             daos_anchor_t         anchor;
             uint32_t              akey_nr;
+            uint64_t              name_filter_gen; /* 0 until names are added to the name filter */
         } name_order_data;
 
         struct {
@@ -870,6 +871,10 @@ H5_daos_attribute_create_helper(H5_daos_item_t *item, const H5VL_loc_params_t *l
         *dep_task = update_task;
 
         create_ud = NULL;
+
+        /* Keep the name filter from being trusted until the attribute is
+         * written */
+        H5_daos_name_filter_create(req);
     } /* end if */
 
     /* Finish setting up attribute struct */
@@ -993,6 +998,10 @@ H5_daos_attribute_create_helper_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED
     assert(udata->attr->parent);
     assert(udata->attr->parent->item.file);
 
+    /* Add the attribute's name to the object's name filter, if it has one */
+    H5_daos_name_filter_add(udata->attr->parent->item.file, &udata->attr->parent->oid,
+                            H5_DAOS_NAME_FILTER_ATTR, 0, udata->attr->name, strlen(udata->attr->name));
+
     /* Set update task arguments */
     if (NULL == (update_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -5774,6 +5783,17 @@ H5_daos_attr_exists_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     assert(udata->bcast_ud.obj);
     assert(udata->bcast_ud.req->file);
 
+    /* Skip the fetch if the object's name filter shows the attribute does
+     * not exist.  The iod sizes are left at 0, so the completion callback
+     * reports the attribute as missing.  Skip the "T-" prefix of the
+     * datatype akey to get the attribute's name. */
+    if (H5_daos_name_filter_absent(udata->bcast_ud.obj, H5_DAOS_NAME_FILTER_ATTR,
+                                   (const char *)udata->akeys[0].iov_buf + 2,
+                                   (size_t)udata->akeys[0].iov_len - 2)) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
+    } /* end if */
+
     /* Set update task arguments */
     if (NULL == (rw_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -6335,6 +6355,14 @@ H5_daos_attribute_iterate_by_name_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSE
             uint32_t i;
             char    *p;
 
+            /* Start filling the object's name filter with the first batch of
+             * attribute names */
+            if (!udata->u.name_order_data.name_filter_gen &&
+                H5_daos_name_filter_begin(udata->attr_container_obj->item.file,
+                                          &udata->attr_container_obj->oid, H5_DAOS_NAME_FILTER_ATTR,
+                                          &udata->u.name_order_data.name_filter_gen) < 0)
+                D_GOTO_ERROR(H5E_ATTR, H5E_CANTINIT, -H5_DAOS_ALLOC_ERROR, "can't start name filter");
+
             /* Loop over returned akeys */
             p = udata->u.name_order_data.md_rw_cb_ud.sg_iov[0].iov_buf;
             for (i = 0; (i < udata->u.name_order_data.akey_nr); i++) {
@@ -6346,6 +6374,12 @@ H5_daos_attribute_iterate_by_name_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSE
                 if (p[0] == 'S') {
                     char tmp_char;
 
+                    /* Add the attribute's name to the name filter */
+                    H5_daos_name_filter_add(udata->attr_container_obj->item.file,
+                                            &udata->attr_container_obj->oid, H5_DAOS_NAME_FILTER_ATTR,
+                                            udata->u.name_order_data.name_filter_gen, &p[2],
+                                            udata->u.name_order_data.kds[i].kd_key_len - 2);
+
                     /* Add null terminator temporarily */
                     tmp_char = p[udata->u.name_order_data.kds[i].kd_key_len];
                     p[udata->u.name_order_data.kds[i].kd_key_len] = '\0';
@@ -6373,6 +6407,11 @@ H5_daos_attribute_iterate_by_name_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSE
                              "can't create dependencies for attribute iteration metatask: %s",
                              H5_daos_err_to_string(ret));
 
+            /* All of the object's attribute names are now in the name filter */
+            if (daos_anchor_is_eof(&udata->u.name_order_data.anchor))
+                H5_daos_name_filter_end(udata->attr_container_obj->item.file, &udata->attr_container_obj->oid,
+                                        H5_DAOS_NAME_FILTER_ATTR, udata->u.name_order_data.name_filter_gen);
+
             /* If there are more akeys, create a task to repeat the akey list operation */
             if (!daos_anchor_is_eof(&udata->u.name_order_data.anchor)) {
                 /* Re-register callback functions for re-initialized akey list task */
@@ -14,7 +14,83 @@
 #include "util/daos_vol_err.h" /* DAOS connector error handling           */
 #include "util/daos_vol_mem.h" /* DAOS connector memory management        */
 
-static int H5_daos_blob_io_comp_cb(tse_task_t *task, void *args);
+/****************/
+/* Local Macros */
+/****************/
+
+/* Segment indices must stay below this value so that byte 6 of a heap blob
+ * ID is always zero */
+#define H5_DAOS_VL_HEAP_SEG_LIMIT ((uint64_t)1 << 48)
+
+/* Checks whether a blob ID refers to a sequence in the VL heap.  Other blob
+ * IDs are UUIDs, which always have a nonzero version number in the upper 4
+ * bits of byte 6.  Heap blob IDs encode the segment index (below
+ * H5_DAOS_VL_HEAP_SEG_LIMIT) in little-endian order in bytes 0-7, followed by
+ * the offset of the sequence in the segment, so byte 6 is always zero. */
+#define H5_DAOS_BLOB_IS_HEAP_ID(blob_id) ((((const uint8_t *)(blob_id))[6] & 0xf0) == 0)
+
+/* Maximum number of fetches in flight when prefetching sequences */
+#define H5_DAOS_BLOB_PREFETCH_WINDOW 64
+
+/* Maximum number of bytes of sequences gathered by one prefetch */
+#define H5_DAOS_BLOB_PREFETCH_MAX_SIZE ((size_t)(64 * 1024 * 1024))
+
+/* Initial number of entries allocated for a prefetch */
+#define H5_DAOS_BLOB_PREFETCH_NENTS_INIT 256
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/* Task user data for writing the VL heap buffer to a segment */
+typedef struct H5_daos_blob_heap_write_ud_t {
+    H5_daos_file_t *file;
+    uint8_t        *buf;
+    uint8_t         dkey_buf[H5_DAOS_BLOB_ID_SIZE];
+    daos_key_t      dkey;
+    daos_iod_t      iod;
+    daos_recx_t     recx;
+    daos_sg_list_t  sgl;
+    daos_iov_t      sg_iov;
+} H5_daos_blob_heap_write_ud_t;
+
+/* Task user data for flushing the VL heap */
+typedef struct H5_daos_blob_heap_flush_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_file_t *file;
+    tse_task_t     *end_task;
+} H5_daos_blob_heap_flush_ud_t;
+
+/* A variable-length field in an element of a datatype */
+typedef struct H5_daos_blob_vl_field_t {
+    size_t off;
+    size_t base_size;
+} H5_daos_blob_vl_field_t;
+
+/* A fetch of one blob, or of several sequences in one heap segment, for a
+ * prefetch */
+typedef struct H5_daos_blob_prefetch_io_t {
+    uint8_t        dkey_buf[H5_DAOS_BLOB_ID_SIZE];
+    daos_key_t     dkey;
+    daos_iod_t     iod;
+    daos_sg_list_t sgl;
+    int            result;
+} H5_daos_blob_prefetch_io_t;
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static int    H5_daos_blob_io_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_blob_heap_write_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_blob_heap_write(H5_daos_file_t *file);
+static herr_t H5_daos_blob_heap_put(H5_daos_file_t *file, const void *buf, size_t size, void *blob_id);
+static herr_t H5_daos_blob_heap_get(H5_daos_file_t *file, const void *blob_id, void *buf, size_t size);
+static int    H5_daos_blob_heap_flush_task(tse_task_t *task);
+static int    H5_daos_blob_heap_flush_end_task(tse_task_t *task);
+static int    H5_daos_blob_id_cmp(const void *_id1, const void *_id2);
+static herr_t H5_daos_blob_find_vl_fields(hid_t type_id, size_t off, H5_daos_blob_vl_field_t **fields,
+                                          size_t *nfields, size_t *fields_nalloc);
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_blob_io_comp_cb
@@ -53,6 +129,1078 @@ done:
     D_FUNC_LEAVE;
 }
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_write_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update for
+ *              writing the VL heap buffer to a segment.  Records the
+ *              result in the file's VL heap so it is reported by later
+ *              blob and flush operations, since the write is not part of
+ *              any request.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_blob_heap_write_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_blob_heap_write_ud_t *udata     = NULL;
+    int                           ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for VL heap write task");
+
+    /* Record the first failed write */
+    if (task->dt_result != 0 && udata->file->vl_heap.status == 0)
+        udata->file->vl_heap.status = task->dt_result;
+
+    /* Clear the file's write task if this is the most recent write */
+    if (udata->file->vl_heap.write_task == task)
+        udata->file->vl_heap.write_task = NULL;
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (udata) {
+        /* Release our reference on the file */
+        if (H5_daos_file_close_helper(udata->file) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+
+        /* Free buffer and udata */
+        DV_free(udata->buf);
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_write_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_write
+ *
+ * Purpose:     Starts an asynchronous write of the sequences in the VL
+ *              heap buffer to the current segment.  The write task takes
+ *              ownership of the buffer.  Writes are chained so the most
+ *              recent write, saved in the file's VL heap, completes last.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_blob_heap_write(H5_daos_file_t *file)
+{
+    H5_daos_vl_heap_t            *heap  = &file->vl_heap;
+    H5_daos_blob_heap_write_ud_t *udata = NULL;
+    daos_obj_rw_t                *update_args;
+    tse_task_t                   *write_task = NULL;
+    uint8_t                      *p;
+    int                           ret;
+    herr_t                        ret_value = SUCCEED;
+
+    assert(file);
+
+    /* Nothing to do if the buffer is empty */
+    if (heap->buf_nbytes == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    assert(heap->buf);
+    assert(heap->seg != 0);
+
+    /* Allocate task udata struct */
+    if (NULL == (udata = (H5_daos_blob_heap_write_ud_t *)DV_calloc(sizeof(H5_daos_blob_heap_write_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for VL heap write");
+    udata->file = file;
+
+    /* Set up dkey.  The segment's dkey is the blob ID of offset 0 in the
+     * segment. */
+    p = udata->dkey_buf;
+    UINT64ENCODE(p, heap->seg);
+    daos_iov_set(&udata->dkey, udata->dkey_buf, (daos_size_t)H5_DAOS_BLOB_ID_SIZE);
+
+    /* Set up iod */
+    daos_const_iov_set((d_const_iov_t *)&udata->iod.iod_name, H5_daos_blob_key_g, H5_daos_blob_key_size_g);
+    udata->recx.rx_idx   = heap->seg_off;
+    udata->recx.rx_nr    = (uint64_t)heap->buf_nbytes;
+    udata->iod.iod_nr    = 1u;
+    udata->iod.iod_recxs = &udata->recx;
+    udata->iod.iod_size  = 1;
+    udata->iod.iod_type  = DAOS_IOD_ARRAY;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->sg_iov, heap->buf, (daos_size_t)heap->buf_nbytes);
+    udata->sgl.sg_nr     = 1;
+    udata->sgl.sg_nr_out = 0;
+    udata->sgl.sg_iovs   = &udata->sg_iov;
+
+    /* Create task for segment write, depending on the previous write */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, heap->write_task ? 1 : 0,
+                                 heap->write_task ? &heap->write_task : NULL, NULL,
+                                 H5_daos_blob_heap_write_comp_cb, udata, &write_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to write VL heap segment");
+
+    /* The write task's completion callback now frees udata and releases a
+     * reference to the file */
+    file->item.rc++;
+
+    /* Set update task arguments */
+    if (NULL == (update_args = daos_task_get_args(write_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get arguments for VL heap write task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = file->glob_md_oh;
+    update_args->th   = DAOS_TX_NONE;
+    update_args->dkey = &udata->dkey;
+    update_args->nr   = 1u;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
+
+    /* Hand the buffer over to the write task */
+    udata->buf       = heap->buf;
+    heap->buf        = NULL;
+    heap->seg_off   += (uint64_t)heap->buf_nbytes;
+    heap->buf_nbytes = 0;
+    heap->write_task = write_task;
+
+    /* Schedule write task */
+    if (0 != (ret = tse_task_schedule(write_task, false)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to write VL heap segment: %s",
+                     H5_daos_err_to_string(ret));
+
+done:
+    if (ret_value < 0) {
+        if (write_task)
+            tse_task_complete(write_task, -H5_DAOS_SETUP_ERROR);
+        else if (udata)
+            udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_put
+ *
+ * Purpose:     Adds a sequence to the VL heap buffer and encodes its heap
+ *              blob ID.  The buffer is written out once the next sequence
+ *              does not fit in it.  A new segment is started once the
+ *              next sequence does not fit in the current segment.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_blob_heap_put(H5_daos_file_t *file, const void *buf, size_t size, void *blob_id)
+{
+    H5_daos_vl_heap_t *heap = &file->vl_heap;
+    uint8_t           *p;
+    int                ret;
+    herr_t             ret_value = SUCCEED;
+
+    assert(file);
+    assert(buf);
+    assert(size > 0);
+    assert((uint64_t)size <= H5_daos_vl_heap_buf_size_g);
+    assert((uint64_t)size <= H5_DAOS_VL_HEAP_SEG_SIZE);
+
+    /* Check for a failed segment write */
+    if (heap->status != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "VL heap segment write failed: %s",
+                     H5_daos_err_to_string(heap->status));
+
+    if (heap->seg == 0 ||
+        heap->seg_off + (uint64_t)heap->buf_nbytes + (uint64_t)size > H5_DAOS_VL_HEAP_SEG_SIZE) {
+        /* Write out the rest of the current segment */
+        if (H5_daos_blob_heap_write(file) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't write VL heap segment");
+
+        /* Allocate more segment indices if necessary.  These come from the
+         * container's object ID allocator so they are unique across
+         * processes. */
+        if (heap->max_seg == 0 || heap->next_seg > heap->max_seg) {
+            if (0 != (ret = daos_cont_alloc_oids(file->coh, (daos_size_t)H5_DAOS_VL_HEAP_NSEGS,
+                                                 &heap->next_seg, NULL /*event*/)))
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "can't allocate VL heap segment indices: %s",
+                             H5_daos_err_to_string(ret));
+            heap->max_seg = heap->next_seg + H5_DAOS_VL_HEAP_NSEGS - 1;
+
+            /* Segment index 0 would encode the NULL blob ID */
+            if (heap->next_seg == 0)
+                heap->next_seg = 1;
+            if (heap->max_seg >= H5_DAOS_VL_HEAP_SEG_LIMIT)
+                D_GOTO_ERROR(H5E_VOL, H5E_CANTALLOC, FAIL, "VL heap segment indices exhausted");
+        } /* end if */
+
+        /* Start a new segment */
+        heap->seg     = heap->next_seg++;
+        heap->seg_off = 0;
+    } /* end if */
+    else if ((uint64_t)heap->buf_nbytes + (uint64_t)size > H5_daos_vl_heap_buf_size_g)
+        /* Write out the buffer to make room for the sequence */
+        if (H5_daos_blob_heap_write(file) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't write VL heap segment");
+
+    /* Allocate the buffer if necessary */
+    if (!heap->buf)
+        if (NULL == (heap->buf = (uint8_t *)DV_malloc((size_t)H5_daos_vl_heap_buf_size_g)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate VL heap buffer");
+
+    /* Encode blob ID */
+    p = (uint8_t *)blob_id;
+    UINT64ENCODE(p, heap->seg);
+    UINT64ENCODE(p, heap->seg_off + (uint64_t)heap->buf_nbytes);
+
+    /* Add sequence to the buffer */
+    (void)memcpy(heap->buf + heap->buf_nbytes, buf, size);
+    heap->buf_nbytes += size;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_put() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_get
+ *
+ * Purpose:     Reads a sequence from the VL heap.  Sequences still in the
+ *              VL heap buffer are copied from the buffer, others are read
+ *              from their segment once the segment writes in flight have
+ *              completed.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_blob_heap_get(H5_daos_file_t *file, const void *blob_id, void *buf, size_t size)
+{
+    H5_daos_vl_heap_t *heap = &file->vl_heap;
+    const uint8_t     *p;
+    uint64_t           seg;
+    uint64_t           off;
+    daos_obj_rw_t     *fetch_args;
+    tse_task_t        *fetch_task = NULL;
+    tse_task_t        *first_task = NULL;
+    tse_task_t        *dep_task   = NULL;
+    uint8_t            dkey_buf[H5_DAOS_BLOB_ID_SIZE];
+    daos_key_t         dkey;
+    daos_iod_t         iod;
+    daos_recx_t        recx;
+    daos_sg_list_t     sgl;
+    daos_iov_t         sg_iov;
+    uint8_t           *dkey_p;
+    int                task_result = 0;
+    herr_t             ret_value   = SUCCEED;
+
+    assert(file);
+    assert(blob_id);
+    assert(buf);
+    assert(size > 0);
+
+    /* Check for a failed segment write */
+    if (heap->status != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "VL heap segment write failed: %s",
+                     H5_daos_err_to_string(heap->status));
+
+    /* Decode blob ID */
+    p = (const uint8_t *)blob_id;
+    UINT64DECODE(p, seg);
+    UINT64DECODE(p, off);
+
+    /* Copy the sequence from the buffer if it has not been written yet */
+    if (seg == heap->seg && off >= heap->seg_off) {
+        assert(heap->buf);
+        assert(off + (uint64_t)size <= heap->seg_off + (uint64_t)heap->buf_nbytes);
+        (void)memcpy(buf, heap->buf + (off - heap->seg_off), size);
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Set up dkey */
+    (void)memset(dkey_buf, 0, sizeof(dkey_buf));
+    dkey_p = dkey_buf;
+    UINT64ENCODE(dkey_p, seg);
+    daos_iov_set(&dkey, dkey_buf, (daos_size_t)H5_DAOS_BLOB_ID_SIZE);
+
+    /* Set up iod */
+    memset(&iod, 0, sizeof(iod));
+    daos_const_iov_set((d_const_iov_t *)&iod.iod_name, H5_daos_blob_key_g, H5_daos_blob_key_size_g);
+    recx.rx_idx   = off;
+    recx.rx_nr    = (uint64_t)size;
+    iod.iod_nr    = 1u;
+    iod.iod_recxs = &recx;
+    iod.iod_size  = 1;
+    iod.iod_type  = DAOS_IOD_ARRAY;
+
+    /* Set up sgl */
+    daos_iov_set(&sg_iov, buf, (daos_size_t)size);
+    sgl.sg_nr     = 1;
+    sgl.sg_nr_out = 0;
+    sgl.sg_iovs   = &sg_iov;
+
+    /* Create task for segment read, depending on the most recent segment
+     * write so the sequence is on storage */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, heap->write_task ? 1 : 0,
+                                 heap->write_task ? &heap->write_task : NULL, NULL, H5_daos_blob_io_comp_cb,
+                                 &task_result, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to read VL heap segment");
+
+    /* Set fetch task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(fetch_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get arguments for VL heap read task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh   = file->glob_md_oh;
+    fetch_args->th   = DAOS_TX_NONE;
+    fetch_args->dkey = &dkey;
+    fetch_args->nr   = 1u;
+    fetch_args->iods = &iod;
+    fetch_args->sgls = &sgl;
+
+    first_task = fetch_task;
+    dep_task   = fetch_task;
+
+done:
+    if (first_task) {
+        assert(dep_task);
+        if (H5_daos_task_wait(&(first_task), &(dep_task)) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (0 != task_result)
+            D_DONE_ERROR(H5E_VOL, H5E_READERROR, FAIL, "VL heap read failed: %s",
+                         H5_daos_err_to_string(task_result));
+        if (heap->status != 0)
+            D_DONE_ERROR(H5E_VOL, H5E_READERROR, FAIL, "VL heap segment write failed: %s",
+                         H5_daos_err_to_string(heap->status));
+    } /* end if */
+    else if (fetch_task) {
+        assert(ret_value < 0);
+        tse_task_complete(fetch_task, -H5_DAOS_SETUP_ERROR);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_flush_task
+ *
+ * Purpose:     Asynchronous task for H5_daos_blob_heap_flush.  Writes out
+ *              the VL heap buffer and makes the end task wait for the
+ *              segment writes in flight.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_blob_heap_flush_task(tse_task_t *task)
+{
+    H5_daos_blob_heap_flush_ud_t *udata = NULL;
+    int                           ret;
+    int                           ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for VL heap flush task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_FILE);
+
+    /* Write out the buffer */
+    if (H5_daos_blob_heap_write(udata->file) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, -H5_DAOS_SETUP_ERROR, "can't write VL heap segment");
+
+    /* Make the end task wait for the most recent write, and therefore all
+     * writes */
+    if (udata->file->vl_heap.write_task &&
+        0 != (ret = tse_task_register_deps(udata->end_task, 1, &udata->file->vl_heap.write_task)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, ret, "can't create dependencies for VL heap flush end task: %s",
+                     H5_daos_err_to_string(ret));
+
+done:
+    if (udata) {
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "VL heap flush";
+        } /* end if */
+    }     /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_flush_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_flush_end_task
+ *
+ * Purpose:     Asynchronous task to finish H5_daos_blob_heap_flush once
+ *              all segment writes have completed.  Checks for failed
+ *              writes and frees the flush udata.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_blob_heap_flush_end_task(tse_task_t *task)
+{
+    H5_daos_blob_heap_flush_ud_t *udata     = NULL;
+    int                           ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for VL heap flush end task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    /* Check for a failed segment write */
+    if (udata->file->vl_heap.status != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, udata->file->vl_heap.status, "VL heap segment write failed: %s",
+                     H5_daos_err_to_string(udata->file->vl_heap.status));
+
+done:
+    if (udata) {
+        /* Release our reference on the file */
+        if (H5_daos_file_close_helper(udata->file) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "VL heap flush end";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free udata */
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_flush_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_heap_flush
+ *
+ * Purpose:     Creates tasks to write out the sequences buffered in the
+ *              file's VL heap and wait until all segment writes have
+ *              completed.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_blob_heap_flush(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t **first_task,
+                        tse_task_t **dep_task)
+{
+    H5_daos_blob_heap_flush_ud_t *flush_udata = NULL;
+    tse_task_t                   *flush_task  = NULL;
+    tse_task_t                   *end_task    = NULL;
+    int                           ret;
+    herr_t                        ret_value = SUCCEED;
+
+    assert(file);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate task udata struct */
+    if (NULL ==
+        (flush_udata = (H5_daos_blob_heap_flush_ud_t *)DV_calloc(sizeof(H5_daos_blob_heap_flush_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for VL heap flush");
+    flush_udata->req  = req;
+    flush_udata->file = file;
+
+    /* Create task to write out the buffer */
+    if (H5_daos_create_task(H5_daos_blob_heap_flush_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, flush_udata, &flush_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to flush VL heap");
+
+    /* Create task to finish the flush */
+    if (H5_daos_create_task(H5_daos_blob_heap_flush_end_task, 1, &flush_task, NULL, NULL, flush_udata,
+                            &end_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to finish VL heap flush");
+    flush_udata->end_task = end_task;
+
+    /* The end task now owns flush_udata and references to req and file */
+    req->rc++;
+    file->item.rc++;
+    flush_udata = NULL;
+
+    /* Schedule flush task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(flush_task, false)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to flush VL heap: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = flush_task;
+    *dep_task = flush_task;
+
+    /* Schedule end task */
+    if (0 != (ret = tse_task_schedule(end_task, false)))
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to finish VL heap flush: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = end_task;
+
+done:
+    if (flush_udata) {
+        assert(ret_value < 0);
+        if (flush_task)
+            tse_task_complete(flush_task, -H5_DAOS_SETUP_ERROR);
+        flush_udata = DV_free(flush_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_heap_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_id_cmp
+ *
+ * Purpose:     Compares two blob IDs.  Heap blob IDs sort before other
+ *              blob IDs and are ordered by segment and then by offset, so
+ *              the sequences in each segment are adjacent and in order.
+ *              Other blob IDs are ordered bytewise.  Also used on
+ *              prefetch entries, which start with their blob ID.
+ *
+ * Return:      Negative, zero or positive, like memcmp
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_blob_id_cmp(const void *_id1, const void *_id2)
+{
+    const uint8_t *id1 = (const uint8_t *)_id1;
+    const uint8_t *id2 = (const uint8_t *)_id2;
+    hbool_t        is_heap1;
+    hbool_t        is_heap2;
+    uint64_t       val1;
+    uint64_t       val2;
+    int            i;
+
+    is_heap1 = H5_DAOS_BLOB_IS_HEAP_ID(id1);
+    is_heap2 = H5_DAOS_BLOB_IS_HEAP_ID(id2);
+
+    /* Sort heap blob IDs first */
+    if (is_heap1 != is_heap2)
+        return is_heap1 ? -1 : 1;
+
+    /* Sort other blob IDs bytewise */
+    if (!is_heap1)
+        return memcmp(id1, id2, H5_DAOS_BLOB_ID_SIZE);
+
+    /* Sort heap blob IDs by segment, then by offset */
+    for (i = 0; i < 2; i++) {
+        UINT64DECODE(id1, val1);
+        UINT64DECODE(id2, val2);
+        if (val1 != val2)
+            return val1 < val2 ? -1 : 1;
+    } /* end for */
+
+    return 0;
+} /* end H5_daos_blob_id_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_find_vl_fields
+ *
+ * Purpose:     Recursively finds the variable-length sequences and
+ *              strings in an element of the file datatype type_id, which
+ *              starts at offset off in the element being searched.  Each
+ *              one is appended to *fields with its offset and the size of
+ *              its base type.  Sequences nested in other sequences are
+ *              not included.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_blob_find_vl_fields(hid_t type_id, size_t off, H5_daos_blob_vl_field_t **fields, size_t *nfields,
+                            size_t *fields_nalloc)
+{
+    hid_t       super_type_id = H5I_INVALID_HID;
+    hid_t       memb_type_id  = H5I_INVALID_HID;
+    H5T_class_t tclass;
+    size_t      base_size = 0;
+    htri_t      is_vl_str;
+    herr_t      ret_value = SUCCEED;
+
+    assert(fields);
+    assert(nfields);
+    assert(fields_nalloc);
+
+    /* Get datatype class */
+    if (H5T_NO_CLASS == (tclass = H5Tget_class(type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get type class");
+
+    switch (tclass) {
+        case H5T_STRING:
+            /* Variable-length strings are sequences of characters */
+            if ((is_vl_str = H5Tis_variable_str(type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't check for variable length string");
+            if (is_vl_str)
+                base_size = 1;
+
+            break;
+
+        case H5T_VLEN:
+            /* Get base type size */
+            if ((super_type_id = H5Tget_super(type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get vlen base type");
+            if (0 == (base_size = H5Tget_size(super_type_id)))
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get vlen base type size");
+
+            break;
+
+        case H5T_COMPOUND: {
+            int      nmemb;
+            unsigned i;
+
+            /* Get number of compound members */
+            if ((nmemb = H5Tget_nmembers(type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get number of compound members");
+
+            /* Recursively search each member */
+            for (i = 0; i < (unsigned)nmemb; i++) {
+                if ((memb_type_id = H5Tget_member_type(type_id, i)) < 0)
+                    D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get compound member type");
+                if (H5_daos_blob_find_vl_fields(memb_type_id, off + H5Tget_member_offset(type_id, i), fields,
+                                                nfields, fields_nalloc) < 0)
+                    D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't search compound member type");
+                if (H5Tclose(memb_type_id) < 0)
+                    D_GOTO_ERROR(H5E_DATATYPE, H5E_CLOSEERROR, FAIL, "can't close member type");
+                memb_type_id = H5I_INVALID_HID;
+            } /* end for */
+
+            break;
+        } /* end block */
+
+        case H5T_ARRAY: {
+            hsize_t dims[H5S_MAX_RANK];
+            hsize_t nelem = 1;
+            hsize_t i;
+            size_t  super_size;
+            int     ndims;
+            int     j;
+
+            /* Get parent type and its size */
+            if ((super_type_id = H5Tget_super(type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get array parent type");
+            if (0 == (super_size = H5Tget_size(super_type_id)))
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get array parent type size");
+
+            /* Get number of array elements */
+            if ((ndims = H5Tget_array_ndims(type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get array rank");
+            if (H5Tget_array_dims2(type_id, dims) < 0)
+                D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get array dimensions");
+            for (j = 0; j < ndims; j++)
+                nelem *= dims[j];
+
+            /* Recursively search each array element */
+            for (i = 0; i < nelem; i++)
+                if (H5_daos_blob_find_vl_fields(super_type_id, off + (size_t)i * super_size, fields, nfields,
+                                                fields_nalloc) < 0)
+                    D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't search array parent type");
+
+            break;
+        } /* end block */
+
+        case H5T_INTEGER:
+        case H5T_FLOAT:
+        case H5T_TIME:
+        case H5T_BITFIELD:
+        case H5T_OPAQUE:
+        case H5T_ENUM:
+        case H5T_REFERENCE:
+            /* No variable-length data */
+            break;
+
+        case H5T_NO_CLASS:
+        case H5T_NCLASSES:
+        default:
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_BADVALUE, FAIL, "invalid type class");
+    } /* end switch */
+
+    /* Add the field if it is variable-length */
+    if (base_size > 0) {
+        if (*nfields == *fields_nalloc) {
+            void  *tmp_realloc;
+            size_t new_nalloc = *fields_nalloc ? 2 * *fields_nalloc : 8;
+
+            if (NULL == (tmp_realloc = DV_realloc(*fields, new_nalloc * sizeof(H5_daos_blob_vl_field_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate variable-length fields");
+            *fields        = (H5_daos_blob_vl_field_t *)tmp_realloc;
+            *fields_nalloc = new_nalloc;
+        } /* end if */
+
+        (*fields)[*nfields].off       = off;
+        (*fields)[*nfields].base_size = base_size;
+        (*nfields)++;
+    } /* end if */
+
+done:
+    if (super_type_id >= 0)
+        if (H5Idec_ref(super_type_id) < 0)
+            D_DONE_ERROR(H5E_DATATYPE, H5E_CANTDEC, FAIL, "failed to close parent type");
+    if (memb_type_id >= 0)
+        if (H5Idec_ref(memb_type_id) < 0)
+            D_DONE_ERROR(H5E_DATATYPE, H5E_CANTDEC, FAIL, "failed to close member type");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_find_vl_fields() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_prefetch
+ *
+ * Purpose:     Fetches the sequences referenced by num_elem elements of
+ *              the file datatype type_id in buf ahead of the type
+ *              conversion that reads them, so the blob get callbacks
+ *              invoked by the conversion copy them from memory instead of
+ *              fetching them one at a time.  The blob IDs are gathered
+ *              and sorted, then all sequences in each heap segment are
+ *              fetched with a single multi-extent fetch and all other
+ *              sequences with one fetch each, with at most
+ *              H5_DAOS_BLOB_PREFETCH_WINDOW fetches in flight.  Stops
+ *              gathering once H5_DAOS_BLOB_PREFETCH_MAX_SIZE bytes have
+ *              been gathered; the remaining sequences are fetched by the
+ *              blob get callback.
+ *
+ *              On success, the file uses prefetch until it is passed to
+ *              H5_daos_blob_prefetch_release, which must be called after
+ *              the conversion.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_blob_prefetch(H5_daos_file_t *file, hid_t type_id, const void *buf, size_t num_elem,
+                      H5_daos_blob_prefetch_t *prefetch)
+{
+    H5_daos_vl_heap_t          *heap          = &file->vl_heap;
+    H5_daos_blob_vl_field_t    *fields        = NULL;
+    H5_daos_blob_prefetch_io_t *ios           = NULL;
+    daos_recx_t                *recxs         = NULL;
+    daos_iov_t                 *sg_iovs       = NULL;
+    tse_task_t                **io_tasks      = NULL;
+    tse_task_t                 *first_task    = NULL;
+    tse_task_t                 *dep_task      = NULL;
+    size_t                      nfields       = 0;
+    size_t                      fields_nalloc = 0;
+    size_t                      ents_nalloc   = 0;
+    size_t                      buf_size      = 0;
+    size_t                      type_size;
+    size_t                      nios = 0;
+    size_t                      i, j;
+    int                         ret;
+    herr_t                      ret_value = SUCCEED;
+
+    assert(file);
+    assert(buf || num_elem == 0);
+    assert(prefetch);
+
+    memset(prefetch, 0, sizeof(*prefetch));
+
+    /* Find the variable-length fields in each element */
+    if (H5_daos_blob_find_vl_fields(type_id, 0, &fields, &nfields, &fields_nalloc) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTINIT, FAIL, "can't find variable-length fields in datatype");
+    if (nfields == 0)
+        D_GOTO_DONE(SUCCEED);
+    if (0 == (type_size = H5Tget_size(type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype size");
+
+    /* Check for a failed segment write */
+    if (heap->status != 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "VL heap segment write failed: %s",
+                     H5_daos_err_to_string(heap->status));
+
+    /* Gather the blob IDs and sizes of the sequences.  Each field holds the
+     * sequence length followed by the blob ID. */
+    for (i = 0; i < num_elem && buf_size < H5_DAOS_BLOB_PREFETCH_MAX_SIZE; i++)
+        for (j = 0; j < nfields; j++) {
+            const uint8_t *p = (const uint8_t *)buf + (i * type_size) + fields[j].off;
+            uint32_t       seq_len;
+
+            UINT32DECODE(p, seq_len);
+            if (seq_len == 0)
+                continue;
+
+            /* Skip NULL blob IDs and sequences still in the VL heap buffer,
+             * which are copied from the buffer */
+            if (H5_DAOS_BLOB_IS_HEAP_ID(p)) {
+                const uint8_t *id_p = p;
+                uint64_t       seg;
+                uint64_t       off;
+
+                UINT64DECODE(id_p, seg);
+                UINT64DECODE(id_p, off);
+                if (seg == 0 || (seg == heap->seg && off >= heap->seg_off))
+                    continue;
+            } /* end if */
+
+            /* Make room for the entry */
+            if (prefetch->nents == ents_nalloc) {
+                void  *tmp_realloc;
+                size_t new_nalloc = ents_nalloc ? 2 * ents_nalloc : H5_DAOS_BLOB_PREFETCH_NENTS_INIT;
+
+                if (NULL == (tmp_realloc = DV_realloc(prefetch->ents,
+                                                      new_nalloc * sizeof(H5_daos_blob_prefetch_ent_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate prefetch entries");
+                prefetch->ents = (H5_daos_blob_prefetch_ent_t *)tmp_realloc;
+                ents_nalloc    = new_nalloc;
+            } /* end if */
+
+            /* Add the entry */
+            (void)memcpy(prefetch->ents[prefetch->nents].blob_id, p, H5_DAOS_BLOB_ID_SIZE);
+            prefetch->ents[prefetch->nents].size = (size_t)seq_len * fields[j].base_size;
+            buf_size += prefetch->ents[prefetch->nents].size;
+            prefetch->nents++;
+        } /* end for */
+
+    /* Nothing to fetch */
+    if (prefetch->nents == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Sort the entries and remove duplicates */
+    qsort(prefetch->ents, prefetch->nents, sizeof(H5_daos_blob_prefetch_ent_t), H5_daos_blob_id_cmp);
+    for (i = 1, j = 0; i < prefetch->nents; i++)
+        if (H5_daos_blob_id_cmp(&prefetch->ents[i], &prefetch->ents[j]) != 0)
+            prefetch->ents[++j] = prefetch->ents[i];
+    prefetch->nents = j + 1;
+
+    /* Assign each entry its place in the buffer and allocate the buffer */
+    buf_size = 0;
+    for (i = 0; i < prefetch->nents; i++) {
+        prefetch->ents[i].off = buf_size;
+        buf_size += prefetch->ents[i].size;
+    } /* end for */
+    if (NULL == (prefetch->buf = (uint8_t *)DV_malloc(buf_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetch buffer");
+
+    /* Allocate fetch arrays.  There is at most one fetch per entry. */
+    if (NULL == (ios = (H5_daos_blob_prefetch_io_t *)DV_calloc(prefetch->nents *
+                                                                sizeof(H5_daos_blob_prefetch_io_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetch fetch array");
+    if (NULL == (recxs = (daos_recx_t *)DV_malloc(prefetch->nents * sizeof(daos_recx_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetch recx array");
+    if (NULL == (sg_iovs = (daos_iov_t *)DV_malloc(prefetch->nents * sizeof(daos_iov_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetch sgl iov array");
+    if (NULL == (io_tasks = (tse_task_t **)DV_malloc(prefetch->nents * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate prefetch task array");
+
+    /* Set up and create the fetches */
+    for (i = 0; i < prefetch->nents; i = j) {
+        H5_daos_blob_prefetch_io_t *io = &ios[nios];
+        daos_obj_rw_t              *fetch_args;
+        tse_task_t                 *deps[2];
+        unsigned                    ndeps = 0;
+        const uint8_t              *p     = prefetch->ents[i].blob_id;
+        hbool_t                     is_heap;
+
+        if ((is_heap = H5_DAOS_BLOB_IS_HEAP_ID(p))) {
+            uint64_t first_seg;
+            uint64_t seg;
+            uint8_t *dkey_p = io->dkey_buf;
+
+            /* The segment's dkey is the blob ID of offset 0 in the segment */
+            UINT64DECODE(p, first_seg);
+            UINT64ENCODE(dkey_p, first_seg);
+
+            /* Add a recx for each sequence in the segment */
+            for (j = i; j < prefetch->nents; j++) {
+                p = prefetch->ents[j].blob_id;
+                if (!H5_DAOS_BLOB_IS_HEAP_ID(p))
+                    break;
+                UINT64DECODE(p, seg);
+                if (seg != first_seg)
+                    break;
+                UINT64DECODE(p, recxs[j].rx_idx);
+                recxs[j].rx_nr = (uint64_t)prefetch->ents[j].size;
+                daos_iov_set(&sg_iovs[j], prefetch->buf + prefetch->ents[j].off,
+                             (daos_size_t)prefetch->ents[j].size);
+            } /* end for */
+
+            /* Set up iod */
+            io->iod.iod_nr    = (unsigned)(j - i);
+            io->iod.iod_recxs = &recxs[i];
+            io->iod.iod_size  = 1;
+            io->iod.iod_type  = DAOS_IOD_ARRAY;
+        } /* end if */
+        else {
+            /* The blob's dkey is its blob ID */
+            (void)memcpy(io->dkey_buf, p, H5_DAOS_BLOB_ID_SIZE);
+            j = i + 1;
+            daos_iov_set(&sg_iovs[i], prefetch->buf + prefetch->ents[i].off,
+                         (daos_size_t)prefetch->ents[i].size);
+
+            /* Set up iod */
+            io->iod.iod_nr   = 1u;
+            io->iod.iod_size = (uint64_t)prefetch->ents[i].size;
+            io->iod.iod_type = DAOS_IOD_SINGLE;
+        } /* end else */
+
+        /* Set up dkey, akey and sgl */
+        daos_iov_set(&io->dkey, io->dkey_buf, (daos_size_t)H5_DAOS_BLOB_ID_SIZE);
+        daos_const_iov_set((d_const_iov_t *)&io->iod.iod_name, H5_daos_blob_key_g, H5_daos_blob_key_size_g);
+        io->sgl.sg_nr     = (uint32_t)(j - i);
+        io->sgl.sg_nr_out = 0;
+        io->sgl.sg_iovs   = &sg_iovs[i];
+
+        /* Only H5_DAOS_BLOB_PREFETCH_WINDOW fetches may be in flight, so
+         * each fetch waits for the one that many fetches before it.  Heap
+         * fetches also wait for the most recent segment write. */
+        if (nios >= H5_DAOS_BLOB_PREFETCH_WINDOW)
+            deps[ndeps++] = io_tasks[nios - H5_DAOS_BLOB_PREFETCH_WINDOW];
+        if (is_heap && heap->write_task)
+            deps[ndeps++] = heap->write_task;
+
+        /* Create task for fetch */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, ndeps, ndeps ? deps : NULL, NULL,
+                                     H5_daos_blob_io_comp_cb, &io->result, &io_tasks[nios]) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to prefetch blobs");
+        nios++;
+
+        /* Set fetch task arguments */
+        if (NULL == (fetch_args = daos_task_get_args(io_tasks[nios - 1])))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't get arguments for blob prefetch task");
+        memset(fetch_args, 0, sizeof(*fetch_args));
+        fetch_args->oh   = file->glob_md_oh;
+        fetch_args->th   = DAOS_TX_NONE;
+        fetch_args->dkey = &io->dkey;
+        fetch_args->nr   = 1u;
+        fetch_args->iods = &io->iod;
+        fetch_args->sgls = &io->sgl;
+    } /* end for */
+
+    /* Create task that completes once all fetches have completed */
+    if (H5_daos_create_task(H5_daos_metatask_autocomplete, (unsigned)nios, io_tasks, NULL, NULL, NULL,
+                            &dep_task) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create task to finish blob prefetch");
+    if (0 != (ret = tse_task_schedule(dep_task, false))) {
+        tse_task_complete(dep_task, -H5_DAOS_SETUP_ERROR);
+        dep_task = NULL;
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to finish blob prefetch: %s",
+                     H5_daos_err_to_string(ret));
+    } /* end if */
+
+    /* Schedule the fetches.  The first one is scheduled when waiting. */
+    first_task = io_tasks[0];
+    for (i = 1; i < nios; i++)
+        if (0 != (ret = tse_task_schedule(io_tasks[i], false))) {
+            tse_task_complete(io_tasks[i], -H5_DAOS_SETUP_ERROR);
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't schedule task to prefetch blobs: %s",
+                         H5_daos_err_to_string(ret));
+        } /* end if */
+
+done:
+    if (dep_task) {
+        /* Wait for the fetches */
+        assert(first_task);
+        if (H5_daos_task_wait(&first_task, &dep_task) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failed fetches and segment writes */
+        for (i = 0; i < nios; i++)
+            if (0 != ios[i].result) {
+                D_DONE_ERROR(H5E_VOL, H5E_READERROR, FAIL, "blob prefetch failed: %s",
+                             H5_daos_err_to_string(ios[i].result));
+                break;
+            } /* end if */
+        if (heap->status != 0)
+            D_DONE_ERROR(H5E_VOL, H5E_READERROR, FAIL, "VL heap segment write failed: %s",
+                         H5_daos_err_to_string(heap->status));
+    } /* end if */
+    else
+        /* Complete the fetches that were never scheduled */
+        for (i = 0; i < nios; i++)
+            tse_task_complete(io_tasks[i], -H5_DAOS_SETUP_ERROR);
+
+    if (ret_value >= 0) {
+        /* Make the file use the prefetched sequences */
+        if (prefetch->nents > 0) {
+            prefetch->prev      = file->blob_prefetch;
+            file->blob_prefetch = prefetch;
+        } /* end if */
+    }     /* end if */
+    else {
+        prefetch->ents  = DV_free(prefetch->ents);
+        prefetch->buf   = DV_free(prefetch->buf);
+        prefetch->nents = 0;
+    } /* end else */
+
+    fields   = DV_free(fields);
+    ios      = DV_free(ios);
+    recxs    = DV_free(recxs);
+    sg_iovs  = DV_free(sg_iovs);
+    io_tasks = DV_free(io_tasks);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_prefetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_blob_prefetch_release
+ *
+ * Purpose:     Stops the file from using prefetch and frees it.
+ *
+ * Return:      SUCCEED / FAIL
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_blob_prefetch_release(H5_daos_file_t *file, H5_daos_blob_prefetch_t *prefetch)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(prefetch);
+
+    /* Restore the prefetch this one replaced */
+    if (prefetch->nents > 0) {
+        if (file->blob_prefetch != prefetch)
+            D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "blob prefetches released out of order");
+        file->blob_prefetch = prefetch->prev;
+    } /* end if */
+
+done:
+    prefetch->ents  = DV_free(prefetch->ents);
+    prefetch->buf   = DV_free(prefetch->buf);
+    prefetch->nents = 0;
+    prefetch->prev  = NULL;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_blob_prefetch_release() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_blob_put
  *
@@ -92,6 +1240,14 @@ H5_daos_blob_put(void *_file, const void *buf, size_t size, void *blob_id, void
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
+    /* Pack sequences that fit in the VL heap buffer into the VL heap */
+    if (size > 0 && (uint64_t)size <= H5_daos_vl_heap_buf_size_g &&
+        (uint64_t)size <= H5_DAOS_VL_HEAP_SEG_SIZE) {
+        if (H5_daos_blob_heap_put(file, buf, size, blob_id) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_WRITEERROR, FAIL, "can't add sequence to VL heap");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
     /* Generate blob ID as a UUID */
     uuid_generate(blob_uuid);
 
@@ -191,6 +1347,25 @@ H5_daos_blob_get(void *_file, const void *blob_id, void *buf, size_t size, void
 
     H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
+    /* Copy prefetched sequences */
+    if (size > 0 && file->blob_prefetch) {
+        const H5_daos_blob_prefetch_ent_t *ent;
+
+        if (NULL != (ent = bsearch(blob_id, file->blob_prefetch->ents, file->blob_prefetch->nents,
+                                   sizeof(H5_daos_blob_prefetch_ent_t), H5_daos_blob_id_cmp)) &&
+            ent->size == size) {
+            (void)memcpy(buf, file->blob_prefetch->buf + ent->off, size);
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+    }     /* end if */
+
+    /* Read sequences stored in the VL heap from the heap */
+    if (size > 0 && H5_DAOS_BLOB_IS_HEAP_ID(blob_id)) {
+        if (H5_daos_blob_heap_get(file, blob_id, buf, size) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_READERROR, FAIL, "can't read sequence from VL heap");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
     /* Only read if size > 0 */
     if (size > 0) {
         /* Set up dkey */
@@ -304,6 +1479,12 @@ H5_daos_blob_specific(void *_file, void *blob_id, H5VL_blob_specific_args_t *spe
         case H5VL_BLOB_DELETE: {
             daos_key_t dkey;
 
+            /* Sequences in the VL heap share their segment with other
+             * sequences and their size is not known here, so their space is
+             * not reclaimed */
+            if (H5_DAOS_BLOB_IS_HEAP_ID(blob_id))
+                break;
+
             /* Set up dkey */
             daos_iov_set(&dkey, blob_id, H5_DAOS_BLOB_ID_SIZE);
 
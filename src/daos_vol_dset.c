@@ -20,12 +20,18 @@
 
 #define H5_DAOS_DINFO_BCAST_BUF_SIZE                                                                         \
     (H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_DCPL_BUF_SIZE + H5_DAOS_FILL_VAL_BUF_SIZE +    \
-     6 * H5_DAOS_ENCODED_UINT64_T_SIZE)
+     H5_DAOS_COMPACT_BUF_SIZE + 8 * H5_DAOS_ENCODED_UINT64_T_SIZE)
+
+/* Maximum size of the raw data of a compact dataset, the same as the largest
+ * object header message in native HDF5 files */
+#define H5_DAOS_COMPACT_MAX_SIZE ((size_t)65520)
 
 /* Definitions for chunking code */
 #define H5_DAOS_DEFAULT_NUM_SEL_CHUNKS 64
 #define H5O_LAYOUT_NDIMS               (H5S_MAX_RANK + 1)
 #define CHUNK_DKEY_BUF_SIZE            (1 + (sizeof(uint64_t) * H5S_MAX_RANK))
+/* Maximum number of chunks punched or trimmed at once when a dataset shrinks */
+#define H5_DAOS_CHUNK_PRUNE_WINDOW 64
 
 /* Definitions for automatic chunking */
 /* Maximum size for contiguous datasets (target size * sqrt(2)) */
@@ -81,22 +87,343 @@ typedef struct H5_daos_chunk_io_ud_t {
     daos_iov_t      sg_iov;
     daos_iov_t     *sg_iovs;
 
+    /* Whether to skip the fetch if the dataset's chunk index shows the chunk
+     * was never written */
+    hbool_t skip_unallocated;
+
+    /* Batch this chunk belongs to, if any */
+    struct H5_daos_chunk_task_batch_ud_t *batch;
+
     /* Fields used for datatype conversion */
     struct {
-        hssize_t              num_elem;
-        hid_t                 mem_type_id;
-        hid_t                 mem_space_id;
-        void                 *buf;
-        H5_daos_io_type_t     io_type;
-        H5_daos_tconv_reuse_t reuse;
-        hbool_t               fill_bkg;
-        size_t                mem_type_size;
-        size_t                file_type_size;
-        void                 *tconv_buf;
-        void                 *bkg_buf;
+        hssize_t               num_elem;
+        hid_t                  mem_type_id;
+        hid_t                  mem_space_id;
+        void                  *buf;
+        H5_daos_io_type_t      io_type;
+        H5_daos_tconv_reuse_t  reuse;
+        hbool_t                fill_bkg;
+        size_t                 mem_type_size;
+        size_t                 file_type_size;
+        void                  *tconv_buf;
+        void                  *bkg_buf;
+        H5_daos_tconv_native_t native;
+        H5_daos_tconv_job_t    job;
     } tconv;
+
+    /* Fields used for chunks stored through the filter pipeline.  In this
+     * case the iod and sgl above describe the selection within the chunk
+     * and the memory (or type conversion) buffer, and the DAOS I/O is
+     * performed on the whole filtered chunk using the iod and sgl below. */
+    struct {
+        hbool_t           tconv;
+        hbool_t           full_chunk;
+        H5_daos_io_type_t io_type;
+        size_t            chunk_size;
+        void             *buf;
+        size_t            buf_size;
+        size_t            nbytes;
+        uint8_t           header_buf[H5_DAOS_FILTER_HEADER_SIZE];
+        daos_iod_t        iod;
+        daos_sg_list_t    sgl;
+        daos_iov_t        sg_iovs[2];
+    } filter;
+
+    /* Fields used for I/O performed by the chunk cache: the entry being
+     * fetched, or the write-back record, buffer to free and operation
+     * waiting on a write-back */
+    struct {
+        struct H5_daos_chunk_cache_ent_t *ent;
+        struct H5_daos_chunk_cache_op_t  *op;
+        struct H5_daos_chunk_cache_wb_t  *wb;
+        void                             *buf;
+    } cache;
 } H5_daos_chunk_io_ud_t;
 
+/* Task user data for raw data I/O on a batch of chunks.  The I/O tasks for
+ * all chunks in the batch share a single allocation, a single reference to
+ * req and the dataset, and a single metatask that completes once all of the
+ * chunk I/O has finished.  Each chunk is still its own DAOS fetch or update;
+ * only the task setup and tracking is batched. */
+typedef struct H5_daos_chunk_task_batch_ud_t {
+    H5_daos_req_t         *req;
+    H5_daos_dset_t        *dset;
+    tse_task_t            *io_metatask;
+    size_t                 nchunks;
+    size_t                 nio_left;
+    H5_daos_chunk_io_ud_t *chunk_io_uds;
+} H5_daos_chunk_task_batch_ud_t;
+
+
+/* An entry in a dataset's chunk cache.  buf holds the whole chunk in the
+ * file datatype.  While the chunk is being fetched, operations on it are
+ * queued on the entry and applied, in order, once the fetch completes.
+ * dirty holds the ndirty extents written through the cache since the last
+ * write-back, sorted and with no two overlapping or adjacent, so only
+ * elements actually written are written back.  A partial entry was never
+ * fetched; only its dirty extents are valid. */
+typedef struct H5_daos_chunk_cache_ent_t {
+    uint64_t                          chunk_coords[H5S_MAX_RANK];
+    uint8_t                          *buf;
+    hbool_t                           fetching;
+    hbool_t                           partial;
+    daos_recx_t                      *dirty;
+    size_t                            ndirty;
+    size_t                            dirty_nalloc;
+    struct H5_daos_chunk_cache_op_t  *waiters_head;
+    struct H5_daos_chunk_cache_op_t  *waiters_tail;
+    struct H5_daos_chunk_cache_ent_t *prev;
+    struct H5_daos_chunk_cache_ent_t *next;
+} H5_daos_chunk_cache_ent_t;
+
+/* An in-flight write-back of a cached chunk.  Later fetches and write-backs
+ * of the same chunk depend on it so they see its data. */
+typedef struct H5_daos_chunk_cache_wb_t {
+    uint64_t                         chunk_coords[H5S_MAX_RANK];
+    tse_task_t                      *task;
+    struct H5_daos_chunk_cache_wb_t *prev;
+    struct H5_daos_chunk_cache_wb_t *next;
+} H5_daos_chunk_cache_wb_t;
+
+/* Task user data for an operation on a dataset's chunk cache: either I/O on
+ * the selection in one chunk (described by the recxs and sg_iovs in sel), a
+ * prefetch of one chunk, or a flush of all dirty chunks.  The task completes once nwait drops to 0,
+ * i.e. once the operation itself and any fetch or write-backs it waits on
+ * are done. */
+typedef struct H5_daos_chunk_cache_op_t {
+    H5_daos_req_t                   *req;
+    H5_daos_dset_t                  *dset;
+    tse_task_t                      *task;
+    H5_daos_io_type_t                io_type;
+    hbool_t                          flush;
+    hbool_t                          evict;
+    hbool_t                          prefetch;
+    unsigned                         nwait;
+    int                              status;
+    uint64_t                         chunk_coords[H5S_MAX_RANK];
+    H5_daos_chunk_io_ud_t            sel;
+    struct H5_daos_chunk_cache_op_t *next;
+} H5_daos_chunk_cache_op_t;
+
+/* A dataset's index of allocated chunks.  The table holds the coordinates
+ * of every chunk known to have been written, as arrays of H5S_MAX_RANK
+ * coordinates with unused dimensions set to 0.  If complete is TRUE every
+ * allocated chunk is in the table, so chunks missing from it can be treated
+ * as unallocated without reading them.  When the file is only open on one
+ * process the index is shared by all open handles of the dataset in this
+ * process, including those opened through other file handles for the same
+ * container, through a process-wide table keyed by container and object
+ * ID, so chunks written through any of them are in the index.  sorted
+ * caches the entries in row-major order for lookups by index, and is freed
+ * whenever the table changes. */
+typedef struct H5_daos_chunk_index_key_t {
+    const char   *cont;
+    daos_obj_id_t oid;
+} H5_daos_chunk_index_key_t;
+
+typedef struct H5_daos_chunk_index_t {
+    H5_daos_chunk_index_key_t key;
+    char                      cont[DAOS_PROP_LABEL_MAX_LEN + 1];
+    unsigned                  rc;
+    hbool_t                   shared;
+    hbool_t                   complete;
+    dv_hash_table_t          *table;
+    uint64_t                 *sorted;
+} H5_daos_chunk_index_t;
+
+/* Task user data for adding entries to (or punching entries from) a
+ * dataset's chunk index in the file.  Each entry is an akey holding the
+ * encoded chunk coordinates, with a single byte value. */
+typedef struct H5_daos_chunk_index_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_dset_t *dset;
+    hbool_t         punch;
+    hbool_t         valid;
+    daos_key_t      dkey;
+    unsigned        nr;
+    daos_iod_t     *iods;
+    daos_sg_list_t *sgls;
+    daos_key_t     *akeys;
+    uint8_t        *akey_buf;
+    daos_iov_t      sg_iov;
+    uint8_t         val;
+} H5_daos_chunk_index_ud_t;
+
+/* Task user data for loading a dataset's chunk index from the file */
+typedef struct H5_daos_chunk_index_load_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_dset_t *dset;
+    tse_task_t     *load_task;
+    int             ndims;
+    hbool_t         valid;
+    daos_key_t      dkey;
+    daos_anchor_t   anchor;
+    uint32_t        nr;
+    daos_key_desc_t kds[H5_DAOS_ITER_LEN];
+    daos_iov_t      sg_iov;
+    daos_sg_list_t  sgl;
+} H5_daos_chunk_index_load_ud_t;
+
+/* Task user data for direct I/O on a single chunk.  The chunk's record is
+ * read or written as is.  sgl is empty while only the size of the record is
+ * being fetched.  The data is shared by the tasks for the operation, and
+ * freed once ntasks drops to 0. */
+typedef struct H5_daos_chunk_direct_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_dset_t *dset;
+    unsigned        ntasks;
+    daos_key_t      dkey;
+    uint8_t         dkey_buf[CHUNK_DKEY_BUF_SIZE];
+    uint8_t         akey_buf;
+    daos_iod_t      iod;
+    daos_recx_t     recx;
+    daos_sg_list_t  sgl;
+    daos_iov_t      sg_iovs[2];
+    uint8_t         header_buf[H5_DAOS_FILTER_HEADER_SIZE];
+    size_t          chunk_size;
+    void           *buf;
+    uint32_t       *filters;
+    hsize_t        *storage_size;
+} H5_daos_chunk_direct_ud_t;
+
+/* What to do to a chunk when a dataset shrinks */
+typedef enum {
+    H5_DAOS_CHUNK_PRUNE_NONE,  /* Chunk is within the new extent */
+    H5_DAOS_CHUNK_PRUNE_PUNCH, /* Chunk is entirely outside the new extent */
+    H5_DAOS_CHUNK_PRUNE_TRIM   /* Chunk straddles the new extent */
+} H5_daos_chunk_prune_act_t;
+
+/* Task user data for removing the data beyond a dataset's new extent.
+ * coords holds the coordinates of the chunks to punch or trim, H5S_MAX_RANK
+ * per chunk, which are processed in order starting at next. */
+typedef struct H5_daos_chunk_prune_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_dset_t *dset;
+    tse_task_t     *prune_task;
+    int             ndims;
+    hsize_t         size[H5S_MAX_RANK];
+    hsize_t         old_size[H5S_MAX_RANK];
+    hbool_t         from_index;
+    uint64_t       *coords;
+    size_t          ncoords;
+    size_t          coords_nalloc;
+    size_t          next;
+    unsigned        ninflight;
+    void           *fill_buf;
+    daos_anchor_t   anchor;
+    uint32_t        nr;
+    daos_key_desc_t kds[H5_DAOS_ITER_LEN];
+    daos_iov_t      sg_iov;
+    daos_sg_list_t  sgl;
+} H5_daos_chunk_prune_ud_t;
+
+/* Task user data for punching a single chunk, or the elements of a chunk
+ * beyond the new extent, when a dataset shrinks */
+typedef struct H5_daos_chunk_prune_op_t {
+    H5_daos_chunk_prune_ud_t *prune_ud;
+    hbool_t                   punch;
+    daos_key_t                dkey;
+    uint8_t                   dkey_buf[CHUNK_DKEY_BUF_SIZE];
+    uint8_t                   akey_buf;
+    daos_iod_t                iod;
+} H5_daos_chunk_prune_op_t;
+
+/* Task user data for I/O on a compact dataset's cached raw data */
+typedef struct H5_daos_compact_io_ud_t {
+    H5_daos_req_t    *req;
+    H5_daos_dset_t   *dset;
+    H5_daos_io_type_t io_type;
+    hbool_t           need_tconv;
+    hid_t             mem_type_id;
+    hid_t             mem_space_id;
+    hid_t             file_space_id;
+    union {
+        void       *rbuf;
+        const void *wbuf;
+    } buf;
+    H5_daos_md_rw_cb_ud_t *update_ud;
+} H5_daos_compact_io_ud_t;
+
+/* The selection in a single chunk sent by this process to the chunk's owner
+ * in collective buffering I/O */
+typedef struct H5_daos_coll_frag_t {
+    uint64_t     chunk_coords[H5S_MAX_RANK];
+    int          owner;
+    size_t       nelem;
+    daos_recx_t  recx;
+    daos_recx_t *recxs;
+    size_t       nrecxs;
+    daos_iov_t   iov;
+    daos_iov_t  *iovs;
+    size_t       niovs;
+    hid_t        mem_space_id;
+} H5_daos_coll_frag_t;
+
+/* A chunk selection received by the chunk's owner in collective buffering
+ * I/O, pointing into the receive buffer */
+typedef struct H5_daos_coll_piece_t {
+    int            src;
+    size_t         seq;
+    uint64_t       chunk_idx;
+    size_t         chunk;
+    const uint8_t *coords_p;
+    const uint8_t *recxs_p;
+    size_t         nrecxs;
+    size_t         nelem;
+    const uint8_t *data;
+} H5_daos_coll_piece_t;
+
+/* Buffers for a single all-to-all exchange in collective buffering I/O */
+typedef struct H5_daos_coll_xchg_t {
+    struct H5_daos_coll_ud_t *coll_ud;
+    int                      *send_counts;
+    int                      *send_displs;
+    int                      *recv_counts;
+    int                      *recv_displs;
+    uint8_t                  *send_buf;
+    uint8_t                  *recv_buf;
+} H5_daos_coll_xchg_t;
+
+/* Task user data for the update or fetch of a single chunk by its owner in
+ * collective buffering I/O */
+typedef struct H5_daos_coll_chunk_t {
+    struct H5_daos_coll_ud_t *coll_ud;
+    uint64_t                  chunk_coords[H5S_MAX_RANK];
+    uint8_t                   dkey_buf[CHUNK_DKEY_BUF_SIZE];
+    daos_key_t                dkey;
+    uint8_t                   akey_buf;
+    daos_iod_t                iod;
+    daos_sg_list_t            sgl;
+    daos_recx_t              *recxs;
+    daos_iov_t               *sg_iovs;
+    uint8_t                  *buf;
+} H5_daos_coll_chunk_t;
+
+/* Task user data for collective buffering I/O */
+typedef struct H5_daos_coll_ud_t {
+    H5_daos_req_t        *req;
+    H5_daos_dset_t       *dset;
+    H5_daos_io_type_t     io_type;
+    int                   ndims;
+    int                   nprocs;
+    hbool_t               need_tconv;
+    hid_t                 mem_type_id;
+    void                 *rbuf;
+    uint64_t              grid_dims[H5S_MAX_RANK];
+    int                  *counts;
+    H5_daos_coll_xchg_t   xchg;
+    H5_daos_coll_xchg_t   resp_xchg;
+    H5_daos_coll_frag_t  *frags;
+    size_t                nfrags;
+    H5_daos_coll_piece_t *pieces;
+    size_t                npieces;
+    hbool_t               parsed;
+    H5_daos_coll_chunk_t *chunks;
+    size_t                nchunks;
+    int                   status_in;
+    int                   status_out;
+} H5_daos_coll_ud_t;
+
 /* Task user data struct for I/O operations (API level) */
 typedef struct H5_daos_io_task_ud_t {
     H5_daos_req_t    *req;
@@ -110,14 +437,30 @@ typedef struct H5_daos_io_task_ud_t {
         const void *wbuf;
     } buf;
     tse_task_t *end_task;
+    hbool_t     coll;
 } H5_daos_io_task_ud_t;
 
-/* Task user data struct for get operations */
+/* Task user data for fetching the stored size of a filtered chunk's record
+ * for H5Dget_storage_size */
+typedef struct H5_daos_chunk_size_ud_t {
+    struct H5_daos_dset_get_ud_t *get_ud;
+    daos_key_t                    dkey;
+    uint8_t                       dkey_buf[CHUNK_DKEY_BUF_SIZE];
+    uint8_t                       akey_buf;
+    daos_iod_t                    iod;
+} H5_daos_chunk_size_ud_t;
+
+/* Task user data struct for get operations.  For the storage size of a
+ * filtered dataset, get_task waits on the nfetch_left fetches of the sizes
+ * of its chunks, described by size_uds. */
 typedef struct H5_daos_dset_get_ud_t {
-    H5_daos_req_t     *req;
-    H5_daos_dset_t    *dset;
-    H5VL_dataset_get_t get_type;
-    hsize_t           *hsize_out;
+    H5_daos_req_t           *req;
+    H5_daos_dset_t          *dset;
+    H5VL_dataset_get_t       get_type;
+    hsize_t                 *hsize_out;
+    tse_task_t              *get_task;
+    size_t                   nfetch_left;
+    H5_daos_chunk_size_ud_t *size_uds;
 } H5_daos_dset_get_ud_t;
 
 /* Task user data struct for set extent operations */
@@ -126,6 +469,27 @@ typedef struct H5_daos_dset_set_extent_ud_t {
     hid_t                 new_space_id;
 } H5_daos_dset_set_extent_ud_t;
 
+/* Task user data for opening a dataset through the file's open object
+ * table */
+typedef struct H5_daos_dset_open_share_ud_t {
+    H5_daos_req_t  *req;
+    H5_daos_dset_t *dset;
+} H5_daos_dset_open_share_ud_t;
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Handles of chunked datasets in files open on a single process that have
+ * done I/O, and of compact datasets in such files whose raw data is cached,
+ * linked through their peer_next fields, so the chunk caches and compact
+ * data of handles of the same dataset can be kept coherent */
+static H5_daos_dset_t *H5_daos_dset_peers_g = NULL;
+
+/* Chunk indices shared by the open handles of datasets, keyed by container
+ * and object ID */
+static dv_hash_table_t *H5_daos_chunk_index_table_g = NULL;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -136,35 +500,120 @@ static herr_t H5_daos_bcast_fill_val(H5_daos_dset_t *dset, H5_daos_req_t *req, s
                                      tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_dset_open_end(H5_daos_dset_t *dset, uint8_t *p, uint64_t type_buf_len,
                                     uint64_t space_buf_len, uint64_t dcpl_buf_len, uint64_t fill_val_len,
-                                    hid_t dxpl_id);
+                                    uint64_t compact_len, hbool_t filtered_chunks, hid_t dxpl_id);
 static int    H5_daos_dset_open_bcast_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_dset_open_recv_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_dset_fill_io_cache(H5_daos_dset_t *dset, hid_t file_space_id, hid_t mem_space_id);
 static int    H5_daos_dinfo_read_comp_cb(tse_task_t *task, void *args);
-static herr_t H5_daos_sel_to_recx_iov(hid_t sel_iter_id, size_t type_size, void *buf, daos_recx_t **recxs,
-                                      daos_iov_t **sg_iovs, size_t *list_nused);
+static herr_t H5_daos_dset_open_fetch(H5_daos_dset_t *dset, H5_daos_mpi_ibcast_ud_flex_t *bcast_udata,
+                                      size_t dinfo_buf_size, H5_daos_req_t *req, tse_task_t **first_task,
+                                      tse_task_t **dep_task);
+static herr_t H5_daos_dset_open_copy(H5_daos_dset_t *dset, const H5_daos_dset_t *src);
+static int    H5_daos_dset_open_share_task(tse_task_t *task);
+static herr_t H5_daos_dset_open_share(H5_daos_dset_t *dset, H5_daos_req_t *req, tse_task_t **first_task,
+                                      tse_task_t **dep_task);
+static htri_t H5_daos_sel_cache_key(hid_t space_id, hsize_t *key, size_t *key_len);
+static herr_t H5_daos_sel_to_recx_iov(H5_daos_dset_t *dset, hid_t space_id, hid_t sel_iter_id,
+                                      size_t type_size, void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs,
+                                      size_t *list_nused);
 static herr_t H5_daos_scatter_cb(const void **src_buf, size_t *src_buf_bytes_used, void *_udata);
+static void   H5_daos_fill_pattern(void *buf, size_t buf_size, const void *pattern, size_t pattern_size);
+static herr_t H5_daos_dset_compact_init(H5_daos_dset_t *dset);
+static herr_t H5_daos_dset_compact_attach(H5_daos_dset_t *dset);
+static herr_t H5_daos_dset_compact_publish(H5_daos_dset_t *dset);
+static int    H5_daos_compact_io_task(tse_task_t *task);
+static herr_t H5_daos_dataset_io_compact(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id,
+                                         hid_t file_space_id, hbool_t need_tconv, H5_daos_io_type_t io_type,
+                                         const void *buf, H5_daos_req_t *req, tse_task_t **first_task,
+                                         tse_task_t **dep_task);
+static htri_t H5_daos_dset_coll_io_requested(H5_daos_dset_t *dset, hid_t dxpl_id);
+static int    H5_daos_coll_recx_cmp(const void *_recx1, const void *_recx2);
+static int    H5_daos_coll_piece_cmp(const void *_piece1, const void *_piece2);
+static herr_t H5_daos_coll_set_counts(const size_t *sizes, int nprocs, int *counts, int *displs,
+                                      size_t *total);
+static int    H5_daos_coll_alltoall_task(tse_task_t *task);
+static int    H5_daos_coll_alltoallv_task(tse_task_t *task);
+static herr_t H5_daos_coll_parse(H5_daos_coll_ud_t *coll_ud);
+static int    H5_daos_coll_chunk_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_coll_chunk_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_coll_chunk_task(tse_task_t *task);
+static int    H5_daos_coll_resp_task(tse_task_t *task);
+static int    H5_daos_coll_unpack_task(tse_task_t *task);
+static int    H5_daos_coll_status_task(tse_task_t *task);
+static herr_t H5_daos_coll_free(H5_daos_coll_ud_t *coll_ud);
+static int    H5_daos_coll_end_task(tse_task_t *task);
+static herr_t H5_daos_dataset_coll_io(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id,
+                                      hid_t file_space_id, htri_t need_tconv, H5_daos_io_type_t io_type,
+                                      void *buf, tse_task_t *_end_task, H5_daos_req_t *req,
+                                      tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_chunk_io_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_chunk_io_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_chunk_io_setup_types_equal(H5_daos_select_chunk_info_t *chunk_info,
+                                                 H5_daos_dset_t *dset, uint64_t dset_ndims,
+                                                 H5_daos_io_type_t io_type, void *buf,
+                                                 H5_daos_chunk_io_ud_t *chunk_io_ud);
 static herr_t H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
                                              uint64_t dset_ndims, hid_t mem_type_id,
                                              H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
                                              tse_task_t **first_task, tse_task_t **dep_task);
+static int    H5_daos_chunk_task_batch_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_dataset_io_types_equal_task_batch(H5_daos_select_chunk_info_t *chunk_info,
+                                                        size_t nchunks, H5_daos_dset_t *dset,
+                                                        uint64_t dset_ndims, H5_daos_io_type_t io_type,
+                                                        void *buf, H5_daos_req_t *req,
+                                                        tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_chunk_io_tconv_fetch_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_chunk_io_tconv_pool_task(tse_task_t *task);
 static int    H5_daos_chunk_fill_bkg_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_chunk_fill_bkg_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_chunk_io_setup_types_unequal(H5_daos_select_chunk_info_t *chunk_info,
+                                                   H5_daos_dset_t *dset, uint64_t dset_ndims,
+                                                   hid_t mem_type_id, H5_daos_io_type_t io_type, void *buf,
+                                                   H5_daos_chunk_io_ud_t *chunk_io_ud);
 static herr_t H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
                                                uint64_t dset_ndims, hid_t mem_type_id,
                                                H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
                                                tse_task_t **first_task, tse_task_t **dep_task);
+static void   H5_daos_chunk_filter_copy(uint8_t *chunk_buf, size_t type_size, const daos_recx_t *recxs,
+                                        unsigned nrecxs, const daos_iov_t *iovs, uint32_t niovs,
+                                        H5_daos_io_type_t io_type);
+static int    H5_daos_chunk_filter_decode(H5_daos_chunk_io_ud_t *udata, hbool_t *chunk_exists);
+static int    H5_daos_chunk_filter_fetch_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_chunk_filter_fetch_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_chunk_filter_update_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_chunk_filter_io_comp_cb(tse_task_t *task, void *args);
+static herr_t H5_daos_dataset_io_filtered(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                          uint64_t dset_ndims, hid_t mem_type_id, hbool_t need_tconv,
+                                          H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
+                                          tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t H5_daos_dataset_io_filtered_types_equal(H5_daos_select_chunk_info_t *chunk_info,
+                                                      H5_daos_dset_t *dset, uint64_t dset_ndims,
+                                                      hid_t mem_type_id, H5_daos_io_type_t io_type,
+                                                      void *buf, H5_daos_req_t *req, tse_task_t **first_task,
+                                                      tse_task_t **dep_task);
+static herr_t H5_daos_dataset_io_filtered_types_unequal(H5_daos_select_chunk_info_t *chunk_info,
+                                                        H5_daos_dset_t *dset, uint64_t dset_ndims,
+                                                        hid_t mem_type_id, H5_daos_io_type_t io_type,
+                                                        void *buf, H5_daos_req_t *req,
+                                                        tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_dset_io_int_task(tse_task_t *task);
 static int    H5_daos_dset_io_int_end_task(tse_task_t *task);
+#if H5VL_VERSION >= 3
+static herr_t H5_daos_dataset_io_multi(size_t count, void *_dset[], hid_t mem_type_id[], hid_t mem_space_id[],
+                                       hid_t file_space_id[], hid_t dxpl_id, void *rbuf[],
+                                       const void *wbuf[], void **req);
+#endif
 #if H5VL_VERSION >= 2
 static herr_t H5_daos_dataset_get_realize(void *future_object, hid_t *actual_object_id);
 static herr_t H5_daos_dataset_get_discard(void *future_object);
 #endif
 static int    H5_daos_dataset_get_task(tse_task_t *task);
+static int    H5_daos_dataset_get_finish(H5_daos_dset_get_ud_t *udata, int ret);
+static herr_t H5_daos_dataset_get_filtered_size(H5_daos_dset_get_ud_t *udata);
+static int    H5_daos_chunk_size_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_chunk_size_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_dataset_refresh_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_dset_set_extent_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_dataset_set_extent(H5_daos_dset_t *dset, const hsize_t *size, hbool_t collective,
@@ -174,6 +623,100 @@ static hid_t  H5_daos_point_and_block(hid_t point_space, hsize_t rank, hsize_t *
 static herr_t H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache, hid_t file_space_id,
                                               hid_t mem_space_id, H5_daos_select_chunk_info_t **chunk_info,
                                               size_t *chunk_info_len, size_t *nchunks_selected);
+static htri_t H5_daos_get_regular_sel(hid_t space_id, int ndims, hsize_t *start, hsize_t *stride,
+                                      hsize_t *count, hsize_t *block);
+static hsize_t H5_daos_regular_sel_1d(const H5_daos_regular_sel_t *sel, int dim, hsize_t lo, hsize_t hi,
+                                      hsize_t *int_start, hsize_t *int_len, size_t *nint);
+static htri_t  H5_daos_get_selected_chunk_info_regular(H5_daos_dset_t *dset, hid_t file_space_id,
+                                                       hid_t mem_space_id, size_t *nchunks_selected);
+static herr_t  H5_daos_regular_sel_to_recx_iov(const H5_daos_regular_sel_t *sel, const uint64_t *chunk_coords,
+                                               const hsize_t *chunk_dims, size_t type_size, void *buf,
+                                               daos_recx_t **recxs, daos_iov_t **sg_iovs, size_t *list_nused);
+static uint64_t H5_daos_chunk_cache_hash(dv_hash_table_key_t key);
+static int      H5_daos_chunk_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2);
+static void     H5_daos_dset_peers_add(H5_daos_dset_t *dset);
+static void     H5_daos_dset_peers_remove(H5_daos_dset_t *dset);
+static hbool_t  H5_daos_dset_is_peer(const H5_daos_dset_t *dset, const H5_daos_dset_t *other);
+static herr_t   H5_daos_chunk_cache_init(H5_daos_dset_t *dset);
+static herr_t   H5_daos_chunk_cache_sync(H5_daos_dset_t *dset, hbool_t bypass, hbool_t *use_cache,
+                                         H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static void     H5_daos_chunk_cache_free(H5_daos_dset_t *dset);
+static hbool_t  H5_daos_chunk_cache_is_dirty(H5_daos_dset_t *dset);
+static herr_t   H5_daos_chunk_cache_start_io(H5_daos_dset_t *dset, const uint64_t *chunk_coords,
+                                             daos_opc_t daos_op, uint8_t *buf, const daos_recx_t *recxs,
+                                             size_t nrecxs, hbool_t packed, H5_daos_chunk_cache_ent_t *ent,
+                                             void *free_buf, H5_daos_chunk_cache_op_t *op);
+static herr_t   H5_daos_chunk_cache_write_back(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent,
+                                               hbool_t evict, H5_daos_chunk_cache_op_t *op);
+static herr_t   H5_daos_chunk_cache_remove(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent);
+static herr_t   H5_daos_chunk_cache_insert(H5_daos_dset_t *dset, H5_daos_chunk_cache_op_t *op,
+                                           H5_daos_chunk_cache_ent_t **ent);
+static herr_t   H5_daos_chunk_cache_fetch(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent,
+                                          H5_daos_chunk_cache_op_t *op);
+static herr_t   H5_daos_chunk_cache_mark_dirty(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent,
+                                               uint64_t idx, uint64_t nelem);
+static herr_t   H5_daos_chunk_cache_apply(H5_daos_chunk_cache_op_t *op, H5_daos_chunk_cache_ent_t *ent);
+static int      H5_daos_chunk_cache_op_release(H5_daos_chunk_cache_op_t *op, int ret);
+static void     H5_daos_chunk_cache_fetch_done(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent,
+                                               int result);
+static int      H5_daos_chunk_cache_op_task(tse_task_t *task);
+static herr_t   H5_daos_chunk_cache_io(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                       uint64_t dset_ndims, H5_daos_io_type_t io_type, void *buf,
+                                       H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t   H5_daos_chunk_cache_flush(H5_daos_dset_t *dset, hbool_t evict, H5_daos_req_t *req,
+                                          tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t   H5_daos_chunk_cache_readahead(H5_daos_dset_t *dset, H5_daos_select_chunk_info_t *chunk_info,
+                                              size_t nchunks_sel, tse_task_t *dep_task);
+static uint64_t H5_daos_chunk_index_table_hash(dv_hash_table_key_t key);
+static int      H5_daos_chunk_index_table_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2);
+static void     H5_daos_chunk_index_key_free(dv_hash_table_key_t key);
+static herr_t   H5_daos_chunk_index_new(H5_daos_dset_t *dset, hbool_t complete);
+static herr_t   H5_daos_chunk_index_share(H5_daos_dset_t *dset);
+static void     H5_daos_chunk_index_release(H5_daos_dset_t *dset);
+static htri_t   H5_daos_chunk_index_insert(H5_daos_chunk_index_t *idx, const uint64_t *chunk_coords,
+                                           int ndims);
+static hbool_t  H5_daos_chunk_index_absent(H5_daos_dset_t *dset, const daos_key_t *dkey);
+static herr_t   H5_daos_chunk_index_add(H5_daos_dset_t *dset, H5_daos_select_chunk_info_t *chunk_info,
+                                        size_t nchunks, int ndims, uint8_t **akey_buf, unsigned *nnew);
+static herr_t   H5_daos_chunk_index_shrink(H5_daos_dset_t *dset, const hsize_t *size, int ndims,
+                                           uint8_t **akey_buf, unsigned *nremoved);
+static int      H5_daos_chunk_index_cmp(const void *_coords1, const void *_coords2);
+static herr_t   H5_daos_chunk_index_sort(H5_daos_chunk_index_t *idx);
+static herr_t   H5_daos_chunk_index_write(H5_daos_dset_t *dset, uint8_t *akey_buf, unsigned nkeys, int ndims,
+                                          hbool_t valid, hbool_t punch, H5_daos_req_t *req,
+                                          tse_task_t **first_task, tse_task_t **dep_task);
+static int      H5_daos_chunk_index_write_prep_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_index_write_comp_cb(tse_task_t *task, void *args);
+static herr_t   H5_daos_chunk_index_load(H5_daos_dset_t *dset, H5_daos_req_t *req, tse_task_t **first_task,
+                                         tse_task_t **dep_task);
+static int      H5_daos_chunk_index_load_task(tse_task_t *task);
+static int      H5_daos_chunk_index_list_prep_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_index_list_comp_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_index_load_finish(H5_daos_chunk_index_load_ud_t *load_ud, int ret);
+static herr_t   H5_daos_dataset_get_storage_size(H5_daos_dset_t *dset, hsize_t *storage_size);
+static int      H5_daos_chunk_direct_prep_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_direct_comp_cb(tse_task_t *task, void *args);
+static herr_t   H5_daos_dataset_chunk_direct(H5_daos_dset_t *dset, int op_type,
+                                             H5VL_native_dataset_optional_args_t *args);
+static herr_t   H5_daos_chunk_prune_add(H5_daos_chunk_prune_ud_t *prune_ud, const uint64_t *coords);
+static herr_t   H5_daos_chunk_prune(H5_daos_dset_t *dset, const hsize_t *size, const hsize_t *old_size,
+                                    int ndims, H5_daos_req_t *req, tse_task_t **first_task,
+                                    tse_task_t **dep_task);
+static int      H5_daos_chunk_prune_task(tse_task_t *task);
+static int      H5_daos_chunk_prune_list_prep_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_prune_list_comp_cb(tse_task_t *task, void *args);
+static herr_t   H5_daos_chunk_prune_trim_recxs(const H5_daos_chunk_prune_ud_t *prune_ud,
+                                               const uint64_t *coords, daos_recx_t **recxs,
+                                               unsigned *nrecxs, uint64_t *nelem);
+static herr_t   H5_daos_chunk_prune_start(H5_daos_chunk_prune_ud_t *prune_ud, const uint64_t *coords);
+static int      H5_daos_chunk_prune_issue(H5_daos_chunk_prune_ud_t *prune_ud);
+static int      H5_daos_chunk_prune_op_prep_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_prune_op_comp_cb(tse_task_t *task, void *args);
+static int      H5_daos_chunk_prune_done_task(tse_task_t *task);
+static int      H5_daos_chunk_prune_finish(H5_daos_chunk_prune_ud_t *prune_ud, int ret);
+
+static H5_daos_chunk_prune_act_t H5_daos_chunk_prune_action(const H5_daos_chunk_prune_ud_t *prune_ud,
+                                                            const uint64_t                 *coords);
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_dset_fill_dcpl_cache
@@ -202,10 +745,14 @@ H5_daos_dset_fill_dcpl_cache(H5_daos_dset_t *dset)
     else if ((dset->dcpl_cache.layout = H5Pget_layout(dset->dcpl_id)) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get layout property");
 
-    /* Retrieve chunk dimensions */
-    if (dset->dcpl_cache.layout == H5D_CHUNKED)
+    /* Retrieve chunk dimensions and filter pipeline */
+    if (dset->dcpl_cache.layout == H5D_CHUNKED) {
         if (H5Pget_chunk(dset->dcpl_id, H5S_MAX_RANK, dset->dcpl_cache.chunk_dims) < 0)
             D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get chunk dimensions");
+        if (H5_daos_filter_get_pipeline(dset->dcpl_id, &dset->dcpl_cache.nfilters,
+                                        &dset->dcpl_cache.filters) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get filter pipeline");
+    } /* end if */
 
     /* Retrieve fill status */
     if (dset->dcpl_id == H5P_DATASET_CREATE_DEFAULT)
@@ -588,7 +1135,7 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
     H5_daos_md_rw_cb_ud_flex_t *update_cb_ud = NULL;
     H5_daos_dset_t             *dset         = NULL;
     tse_task_t                 *dataset_metatask;
-    tse_task_t                 *finalize_deps[3];
+    tse_task_t                 *finalize_deps[4];
     hbool_t                     default_dcpl   = (dcpl_id == H5P_DATASET_CREATE_DEFAULT);
     htri_t                      is_vl_ref      = FALSE;
     hid_t                       tmp_dcpl_id    = H5I_INVALID_HID;
@@ -646,6 +1193,10 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
     if (H5_daos_dset_fill_dcpl_cache(dset) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "failed to fill DCPL cache");
 
+    /* Make sure all mandatory filters can be applied */
+    if (!H5_daos_filter_pipeline_avail(dset->dcpl_cache.nfilters, dset->dcpl_cache.filters))
+        D_GOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, NULL, "filter pipeline contains an unsupported filter");
+
     /* If the layout is contiguous try to automatically change to chunked */
     if (dset->dcpl_cache.layout == H5D_CONTIGUOUS && H5_daos_chunk_target_size_g > 0) {
         int      ndims;
@@ -730,6 +1281,25 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
         } /* end if */
     }     /* end if */
 
+    /* Create the chunk index.  A new dataset has no allocated chunks, but
+     * the index can only be trusted if no other process can write to it. */
+    if (dset->dcpl_cache.layout == H5D_CHUNKED && H5_daos_chunk_index_new(dset, file->num_procs == 1) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't create chunk index");
+
+    /* Compact datasets keep their raw data inline with the dataset's
+     * metadata */
+    if (dset->dcpl_cache.layout == H5D_COMPACT) {
+        hssize_t npoints;
+
+        if ((npoints = H5Sget_simple_extent_npoints(space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, NULL, "can't get number of elements in dataspace");
+        dset->compact.size = (size_t)npoints * dset->file_type_size;
+        if (dset->compact.size > H5_DAOS_COMPACT_MAX_SIZE)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL,
+                         "compact dataset size is bigger than header message maximum size");
+        dset->compact.stored = dset->compact.size > 0;
+    } /* end if */
+
     /* Generate dataset oid */
     if (H5_daos_oid_generate(&dset->obj.oid, FALSE, 0, H5I_DATASET,
                              (default_dcpl ? H5P_DEFAULT : dset->dcpl_id), H5_DAOS_OBJ_CLASS_NAME, file,
@@ -794,8 +1364,9 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
         /* Create dataset */
         /* Allocate argument struct */
         if (NULL ==
-            (update_cb_ud = (H5_daos_md_rw_cb_ud_flex_t *)DV_calloc(
-                 sizeof(H5_daos_md_rw_cb_ud_flex_t) + type_size + space_size + dcpl_size + fill_val_size)))
+            (update_cb_ud = (H5_daos_md_rw_cb_ud_flex_t *)DV_calloc(sizeof(H5_daos_md_rw_cb_ud_flex_t) +
+                                                                    type_size + space_size + dcpl_size +
+                                                                    fill_val_size + dset->compact.size + 1)))
             D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL,
                          "can't allocate buffer for update callback arguments");
 
@@ -928,6 +1499,67 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
             } /* end if */
         }     /* end if */
 
+        /* Write the initial raw data of a compact dataset */
+        if (dset->compact.stored) {
+            void *compact_buf = update_cb_ud->flex_buf + type_size + space_size +
+                                (default_dcpl ? 0 : dcpl_size) + fill_val_size;
+
+            if (H5_daos_dset_compact_init(dset) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't initialize compact data");
+            (void)memcpy(compact_buf, dset->compact.buf, dset->compact.size);
+
+            /* Set up iod */
+            daos_const_iov_set(
+                (d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_name,
+                H5_daos_compact_key_g, H5_daos_compact_key_size_g);
+            update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_nr   = 1u;
+            update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_size =
+                (uint64_t)dset->compact.size;
+            update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_type = DAOS_IOD_SINGLE;
+
+            /* Set up sgl */
+            daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[update_cb_ud->md_rw_cb_ud.nr], compact_buf,
+                         (daos_size_t)dset->compact.size);
+            update_cb_ud->md_rw_cb_ud.sgl[update_cb_ud->md_rw_cb_ud.nr].sg_nr     = 1;
+            update_cb_ud->md_rw_cb_ud.sgl[update_cb_ud->md_rw_cb_ud.nr].sg_nr_out = 0;
+            update_cb_ud->md_rw_cb_ud.sgl[update_cb_ud->md_rw_cb_ud.nr].sg_iovs =
+                &update_cb_ud->md_rw_cb_ud.sg_iov[update_cb_ud->md_rw_cb_ud.nr];
+            update_cb_ud->md_rw_cb_ud.free_sg_iov[update_cb_ud->md_rw_cb_ud.nr] = FALSE;
+
+            /* Adjust nr */
+            update_cb_ud->md_rw_cb_ud.nr++;
+        } /* end if */
+
+        /* Mark the chunks as stored through the filter pipeline, so they are
+         * not mistaken for the unfiltered chunks of datasets created by
+         * earlier versions of the connector */
+        if (dset->dcpl_cache.nfilters > 0) {
+            uint8_t *marker_buf = update_cb_ud->flex_buf + type_size + space_size +
+                                  (default_dcpl ? 0 : dcpl_size) + fill_val_size + dset->compact.size;
+
+            *marker_buf = 1;
+
+            /* Set up iod */
+            daos_const_iov_set(
+                (d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_name,
+                H5_daos_filtered_chunks_key_g, H5_daos_filtered_chunks_key_size_g);
+            update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_nr   = 1u;
+            update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_size = (uint64_t)1;
+            update_cb_ud->md_rw_cb_ud.iod[update_cb_ud->md_rw_cb_ud.nr].iod_type = DAOS_IOD_SINGLE;
+
+            /* Set up sgl */
+            daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[update_cb_ud->md_rw_cb_ud.nr], marker_buf,
+                         (daos_size_t)1);
+            update_cb_ud->md_rw_cb_ud.sgl[update_cb_ud->md_rw_cb_ud.nr].sg_nr     = 1;
+            update_cb_ud->md_rw_cb_ud.sgl[update_cb_ud->md_rw_cb_ud.nr].sg_nr_out = 0;
+            update_cb_ud->md_rw_cb_ud.sgl[update_cb_ud->md_rw_cb_ud.nr].sg_iovs =
+                &update_cb_ud->md_rw_cb_ud.sg_iov[update_cb_ud->md_rw_cb_ud.nr];
+            update_cb_ud->md_rw_cb_ud.free_sg_iov[update_cb_ud->md_rw_cb_ud.nr] = FALSE;
+
+            /* Adjust nr */
+            update_cb_ud->md_rw_cb_ud.nr++;
+        } /* end if */
+
         /* Set task name */
         update_cb_ud->md_rw_cb_ud.task_name = "dataset metadata write";
 
@@ -951,6 +1583,16 @@ H5_daos_dataset_create_helper(H5_daos_file_t *file, hid_t type_id, hid_t space_i
         finalize_deps[finalize_ndeps] = update_task;
         finalize_ndeps++;
 
+        /* Mark the chunk index in the file as complete, so it can be trusted
+         * when the dataset is reopened */
+        if (dset->dcpl_cache.layout == H5D_CHUNKED) {
+            finalize_deps[finalize_ndeps] = *dep_task;
+            if (H5_daos_chunk_index_write(dset, NULL, 0, 0, TRUE, FALSE, req, first_task,
+                                          &finalize_deps[finalize_ndeps]) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't write chunk index");
+            finalize_ndeps++;
+        } /* end if */
+
         /* Create link to dataset */
         if (parent_grp) {
             H5_daos_link_val_t link_val;
@@ -1072,7 +1714,8 @@ done:
  * Function:    H5_daos_dset_open_end
  *
  * Purpose:     Decode serialized dataset info from a buffer and fill
- *              caches.
+ *              caches.  filtered_chunks is whether the dataset's chunks
+ *              are stored through its filter pipeline.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -1084,11 +1727,13 @@ done:
  */
 static int
 H5_daos_dset_open_end(H5_daos_dset_t *dset, uint8_t *p, uint64_t type_buf_len, uint64_t space_buf_len,
-                      uint64_t dcpl_buf_len, uint64_t fill_val_len, hid_t dxpl_id)
+                      uint64_t dcpl_buf_len, uint64_t fill_val_len, uint64_t compact_len,
+                      hbool_t filtered_chunks, hid_t dxpl_id)
 {
-    void *tconv_buf = NULL;
-    void *bkg_buf   = NULL;
-    int   ret_value = 0;
+    uint8_t *compact_p;
+    void    *tconv_buf = NULL;
+    void    *bkg_buf   = NULL;
+    int      ret_value = 0;
 
     assert(dset);
     assert(p);
@@ -1106,6 +1751,9 @@ H5_daos_dset_open_end(H5_daos_dset_t *dset, uint8_t *p, uint64_t type_buf_len, u
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, -H5_DAOS_H5_DECODE_ERROR, "can't change selection");
     p += space_buf_len;
 
+    /* Compact raw data, if any, follows the fill value */
+    compact_p = p + dcpl_buf_len + fill_val_len;
+
     /* Check if the dataset's DCPL is the default DCPL.
      * Otherwise, decode the dataset's DCPL.
      */
@@ -1126,6 +1774,13 @@ H5_daos_dset_open_end(H5_daos_dset_t *dset, uint8_t *p, uint64_t type_buf_len, u
     if (H5_daos_dset_fill_dcpl_cache(dset) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to fill DCPL cache");
 
+    /* Datasets created by earlier versions of the connector store their
+     * chunks unfiltered, even if the DCPL has a filter pipeline */
+    if (!filtered_chunks && dset->dcpl_cache.nfilters > 0) {
+        dset->dcpl_cache.filters  = DV_free(dset->dcpl_cache.filters);
+        dset->dcpl_cache.nfilters = 0;
+    } /* end if */
+
     /* Check for fill value */
     if (fill_val_len > 0) {
         htri_t is_vl_ref;
@@ -1189,6 +1844,31 @@ H5_daos_dset_open_end(H5_daos_dset_t *dset, uint8_t *p, uint64_t type_buf_len, u
             D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
                          "fill value defined on property list but not found in metadata");
 
+    /* Cache the raw data of a compact dataset.  Compact datasets created by
+     * earlier versions of the connector have no inline raw data, and are
+     * stored like contiguous datasets. */
+    if (dset->dcpl_cache.layout == H5D_COMPACT && compact_len > 0) {
+        hssize_t npoints;
+
+        if ((npoints = H5Sget_simple_extent_npoints(dset->space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
+                         "can't get number of elements in dataspace");
+        if (compact_len != (uint64_t)npoints * (uint64_t)dset->file_type_size)
+            D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                         "size of stored compact data does not match size of dataset");
+        if (NULL == (dset->compact.buf = DV_malloc(compact_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate buffer for compact data");
+        (void)memcpy(dset->compact.buf, compact_p, compact_len);
+        dset->compact.size   = compact_len;
+        dset->compact.stored = TRUE;
+
+        /* Other handles of the dataset may hold newer data */
+        if (H5_daos_dset_compact_attach(dset) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't share compact data with other dataset handles");
+    } /* end if */
+
     /* Fill OCPL cache */
     if (H5_daos_fill_ocpl_cache(&dset->obj, dset->dcpl_id) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_CPL_CACHE_ERROR, "failed to fill OCPL cache");
@@ -1366,6 +2046,8 @@ H5_daos_dset_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         uint64_t space_buf_len = 0;
         uint64_t dcpl_buf_len  = 0;
         uint64_t fill_val_len  = 0;
+        uint64_t compact_len   = 0;
+        uint64_t filtered      = 0;
         size_t   dinfo_len;
         uint8_t *p = udata->bcast_udata.buffer;
 
@@ -1383,6 +2065,8 @@ H5_daos_dset_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         UINT64DECODE(p, space_buf_len)
         UINT64DECODE(p, dcpl_buf_len)
         UINT64DECODE(p, fill_val_len)
+        UINT64DECODE(p, compact_len)
+        UINT64DECODE(p, filtered)
 
         /* Check for type_buf_len set to 0 - indicates failure */
         if (type_buf_len == 0)
@@ -1391,7 +2075,7 @@ H5_daos_dset_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
         /* Calculate data length */
         dinfo_len = (size_t)type_buf_len + (size_t)space_buf_len + (size_t)dcpl_buf_len +
-                    (size_t)fill_val_len + 6 * sizeof(uint64_t);
+                    (size_t)fill_val_len + (size_t)compact_len + 8 * sizeof(uint64_t);
 
         /* Reissue bcast if necessary */
         if (dinfo_len > (size_t)udata->bcast_udata.count) {
@@ -1432,8 +2116,8 @@ H5_daos_dset_open_recv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
             /* Finish building dataset object */
             if (0 != (ret = H5_daos_dset_open_end((H5_daos_dset_t *)udata->bcast_udata.obj, p, type_buf_len,
-                                                  space_buf_len, dcpl_buf_len, fill_val_len,
-                                                  udata->bcast_udata.req->dxpl_id)))
+                                                  space_buf_len, dcpl_buf_len, fill_val_len, compact_len,
+                                                  filtered != 0, udata->bcast_udata.req->dxpl_id)))
                 D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't finish opening dataset");
         } /* end else */
     }     /* end else */
@@ -1516,7 +2200,8 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     if (task->dt_result == -DER_REC2BIG) {
         tse_task_t *fetch_task;
         size_t      daos_info_len = udata->md_rw_cb_ud.iod[0].iod_size + udata->md_rw_cb_ud.iod[1].iod_size +
-                               udata->md_rw_cb_ud.iod[2].iod_size + udata->md_rw_cb_ud.iod[3].iod_size;
+                               udata->md_rw_cb_ud.iod[2].iod_size + udata->md_rw_cb_ud.iod[3].iod_size +
+                               udata->md_rw_cb_ud.iod[4].iod_size;
 
         assert(udata->md_rw_cb_ud.req->file);
         assert(udata->md_rw_cb_ud.obj);
@@ -1526,7 +2211,8 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         if (udata->md_rw_cb_ud.sg_iov[0].iov_buf_len != H5_DAOS_TYPE_BUF_SIZE ||
             udata->md_rw_cb_ud.sg_iov[1].iov_buf_len != H5_DAOS_SPACE_BUF_SIZE ||
             udata->md_rw_cb_ud.sg_iov[2].iov_buf_len != H5_DAOS_DCPL_BUF_SIZE ||
-            udata->md_rw_cb_ud.sg_iov[3].iov_buf_len != H5_DAOS_FILL_VAL_BUF_SIZE)
+            udata->md_rw_cb_ud.sg_iov[3].iov_buf_len != H5_DAOS_FILL_VAL_BUF_SIZE ||
+            udata->md_rw_cb_ud.sg_iov[4].iov_buf_len != H5_DAOS_COMPACT_BUF_SIZE)
             D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
                          "buffer length does not match expected value");
 
@@ -1535,24 +2221,24 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
             /* Reallocate dataset info buffer if necessary */
             if (daos_info_len > H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_DCPL_BUF_SIZE +
-                                    H5_DAOS_FILL_VAL_BUF_SIZE) {
+                                    H5_DAOS_FILL_VAL_BUF_SIZE + H5_DAOS_COMPACT_BUF_SIZE) {
                 if (NULL == (udata->bcast_udata->bcast_udata.buffer =
-                                 DV_malloc(daos_info_len + 6 * H5_DAOS_ENCODED_UINT64_T_SIZE)))
+                                 DV_malloc(daos_info_len + 8 * H5_DAOS_ENCODED_UINT64_T_SIZE)))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
                                  "can't allocate buffer for serialized dataset info");
                 udata->bcast_udata->bcast_udata.buffer_len =
-                    (int)(daos_info_len + 6 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+                    (int)(daos_info_len + 8 * H5_DAOS_ENCODED_UINT64_T_SIZE);
             } /* end if */
 
             /* Set starting point for fetch sg_iovs */
-            p = (uint8_t *)udata->bcast_udata->bcast_udata.buffer + 6 * H5_DAOS_ENCODED_UINT64_T_SIZE;
+            p = (uint8_t *)udata->bcast_udata->bcast_udata.buffer + 8 * H5_DAOS_ENCODED_UINT64_T_SIZE;
         } /* end if */
         else {
             assert(udata->md_rw_cb_ud.sg_iov[0].iov_buf == udata->flex_buf);
 
             /* Reallocate dataset info buffer if necessary */
             if (daos_info_len > H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_DCPL_BUF_SIZE +
-                                    H5_DAOS_FILL_VAL_BUF_SIZE) {
+                                    H5_DAOS_FILL_VAL_BUF_SIZE + H5_DAOS_COMPACT_BUF_SIZE) {
                 if (NULL == (udata->md_rw_cb_ud.sg_iov[0].iov_buf = DV_malloc(daos_info_len)))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
                                  "can't allocate buffer for serialized dataset info");
@@ -1563,6 +2249,11 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             p = (uint8_t *)udata->md_rw_cb_ud.sg_iov[0].iov_buf;
         } /* end else */
 
+        /* The filtered chunks marker can't be too big.  Record whether it
+         * exists and don't fetch it again. */
+        udata->marker_found   = udata->md_rw_cb_ud.iod[5].iod_size > 0;
+        udata->md_rw_cb_ud.nr = 5u;
+
         /* Set up sgl */
         daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], p, udata->md_rw_cb_ud.iod[0].iod_size);
         udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
@@ -1572,13 +2263,24 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         p += udata->md_rw_cb_ud.iod[1].iod_size;
         daos_iov_set(&udata->md_rw_cb_ud.sg_iov[2], p, udata->md_rw_cb_ud.iod[2].iod_size);
         udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
-        if (udata->md_rw_cb_ud.iod[3].iod_size > 0) {
-            p += udata->md_rw_cb_ud.iod[2].iod_size;
+        p += udata->md_rw_cb_ud.iod[2].iod_size;
+
+        /* Drop the compact raw data if there is none, then the fill value if
+         * there is none and it is now the last akey.  A missing fill value
+         * followed by compact raw data is fetched into an empty buffer. */
+        if (udata->md_rw_cb_ud.nr == 5 && udata->md_rw_cb_ud.iod[4].iod_size == 0)
+            udata->md_rw_cb_ud.nr--;
+        if (udata->md_rw_cb_ud.iod[3].iod_size > 0 || udata->md_rw_cb_ud.nr == 5) {
             daos_iov_set(&udata->md_rw_cb_ud.sg_iov[3], p, udata->md_rw_cb_ud.iod[3].iod_size);
             udata->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
+            p += udata->md_rw_cb_ud.iod[3].iod_size;
         } /* end if */
         else
             udata->md_rw_cb_ud.nr--;
+        if (udata->md_rw_cb_ud.nr == 5) {
+            daos_iov_set(&udata->md_rw_cb_ud.sg_iov[4], p, udata->md_rw_cb_ud.iod[4].iod_size);
+            udata->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
+        } /* end if */
 
         /* Create task for reissued dataset metadata read */
         if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
@@ -1611,6 +2313,9 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                                          ? (uint64_t)((char *)udata->md_rw_cb_ud.sg_iov[3].iov_buf -
                                                      (char *)udata->md_rw_cb_ud.sg_iov[2].iov_buf)
                                          : udata->md_rw_cb_ud.iod[2].iod_size;
+            uint64_t compact_len   = udata->md_rw_cb_ud.nr >= 5 ? udata->md_rw_cb_ud.iod[4].iod_size : 0;
+            hbool_t  filtered      = udata->md_rw_cb_ud.nr == 6 ? udata->md_rw_cb_ud.iod[5].iod_size > 0
+                                                                : udata->marker_found;
 
             assert(udata->md_rw_cb_ud.req->file);
             assert(udata->md_rw_cb_ud.obj);
@@ -1622,6 +2327,17 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 D_GOTO_ERROR(H5E_DATASET, H5E_NOTFOUND, -H5_DAOS_DAOS_GET_ERROR,
                              "internal metadata not found");
 
+            /* Move the compact raw data, if any, to right after the fill
+             * value, where H5_daos_dset_open_end() and the other processes
+             * expect it */
+            if (compact_len > 0) {
+                uint8_t *compact_p = (uint8_t *)udata->md_rw_cb_ud.sg_iov[3].iov_buf +
+                                     udata->md_rw_cb_ud.iod[3].iod_size;
+
+                if (compact_p != (uint8_t *)udata->md_rw_cb_ud.sg_iov[4].iov_buf)
+                    (void)memmove(compact_p, udata->md_rw_cb_ud.sg_iov[4].iov_buf, (size_t)compact_len);
+            } /* end if */
+
             if (udata->bcast_udata) {
                 /* Encode oid */
                 p = udata->bcast_udata->bcast_udata.buffer;
@@ -1633,6 +2349,8 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 UINT64ENCODE(p, space_buf_len)
                 UINT64ENCODE(p, dcpl_buf_len)
                 UINT64ENCODE(p, udata->md_rw_cb_ud.iod[3].iod_size)
+                UINT64ENCODE(p, compact_len)
+                UINT64ENCODE(p, (uint64_t)filtered)
                 assert(p == udata->md_rw_cb_ud.sg_iov[0].iov_buf);
             } /* end if */
 
@@ -1640,8 +2358,12 @@ H5_daos_dinfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             if (0 != (ret = H5_daos_dset_open_end(
                           (H5_daos_dset_t *)udata->md_rw_cb_ud.obj, udata->md_rw_cb_ud.sg_iov[0].iov_buf,
                           type_buf_len, space_buf_len, dcpl_buf_len,
-                          (uint64_t)udata->md_rw_cb_ud.iod[3].iod_size, udata->md_rw_cb_ud.req->dxpl_id)))
+                          (uint64_t)udata->md_rw_cb_ud.iod[3].iod_size, compact_len, filtered,
+                          udata->md_rw_cb_ud.req->dxpl_id)))
                 D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't finish opening dataset");
+
+            /* Let later opens of the dataset copy its metadata */
+            H5_daos_obj_set_shared_md(udata->md_rw_cb_ud.obj, FALSE);
         } /* end else */
     }     /* end else */
 
@@ -1933,11 +2655,9 @@ H5_daos_dataset_open_helper(H5_daos_file_t *file, hid_t dapl_id, hbool_t collect
                             tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_mpi_ibcast_ud_flex_t *bcast_udata    = NULL;
-    H5_daos_omd_fetch_ud_t       *fetch_udata    = NULL;
     H5_daos_dset_t               *dset           = NULL;
     size_t                        dinfo_buf_size = 0;
-    int                           ret;
-    H5_daos_dset_t               *ret_value = NULL;
+    H5_daos_dset_t               *ret_value      = NULL;
 
     assert(file);
     assert(req);
@@ -1985,138 +2705,27 @@ H5_daos_dataset_open_helper(H5_daos_file_t *file, hid_t dapl_id, hbool_t collect
     } /* end if */
     else
         dinfo_buf_size = H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_DCPL_BUF_SIZE +
-                         H5_DAOS_FILL_VAL_BUF_SIZE;
+                         H5_DAOS_FILL_VAL_BUF_SIZE + H5_DAOS_COMPACT_BUF_SIZE;
 
     /* Check if we're actually opening the dataset or just receiving the dataset
      * info from the leader */
     if (!collective || (file->my_rank == 0)) {
-        tse_task_t *fetch_task = NULL;
-        uint8_t    *p;
-
-        /* Open dataset object */
-        if (H5_daos_obj_open(file, req, &dset->obj.oid,
-                             (file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO), &dset->obj.obj_oh,
-                             "dataset object open", first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, NULL, "can't open dataset object");
-
-        /* Allocate argument struct for fetch task */
-        if (NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(sizeof(H5_daos_omd_fetch_ud_t) +
-                                                                       (bcast_udata ? 0 : dinfo_buf_size))))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL,
-                         "can't allocate buffer for fetch callback arguments");
-
-        /* Set up operation to read datatype, dataspace, and DCPL sizes from
-         * dataset */
-        /* Set up ud struct */
-        fetch_udata->md_rw_cb_ud.req = req;
-        fetch_udata->md_rw_cb_ud.obj = &dset->obj;
-        fetch_udata->bcast_udata     = bcast_udata;
-
-        /* Set up dkey.  Point to global name buffer, do not free. */
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
-                           H5_daos_int_md_key_size_g);
-        fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
-
-        /* Set up iod.  Point akey to global name buffer, do not free. */
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_type_key_g,
-                           H5_daos_type_key_size_g);
-        fetch_udata->md_rw_cb_ud.iod[0].iod_nr    = 1u;
-        fetch_udata->md_rw_cb_ud.iod[0].iod_size  = DAOS_REC_ANY;
-        fetch_udata->md_rw_cb_ud.iod[0].iod_type  = DAOS_IOD_SINGLE;
-        fetch_udata->md_rw_cb_ud.iod[0].iod_flags = DAOS_COND_AKEY_FETCH;
-
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[1].iod_name, H5_daos_space_key_g,
-                           H5_daos_space_key_size_g);
-        fetch_udata->md_rw_cb_ud.iod[1].iod_nr    = 1u;
-        fetch_udata->md_rw_cb_ud.iod[1].iod_size  = DAOS_REC_ANY;
-        fetch_udata->md_rw_cb_ud.iod[1].iod_type  = DAOS_IOD_SINGLE;
-        fetch_udata->md_rw_cb_ud.iod[1].iod_flags = DAOS_COND_AKEY_FETCH;
-
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[2].iod_name, H5_daos_cpl_key_g,
-                           H5_daos_cpl_key_size_g);
-        fetch_udata->md_rw_cb_ud.iod[2].iod_nr    = 1u;
-        fetch_udata->md_rw_cb_ud.iod[2].iod_size  = DAOS_REC_ANY;
-        fetch_udata->md_rw_cb_ud.iod[2].iod_type  = DAOS_IOD_SINGLE;
-        fetch_udata->md_rw_cb_ud.iod[2].iod_flags = DAOS_COND_AKEY_FETCH;
-
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[3].iod_name, H5_daos_fillval_key_g,
-                           H5_daos_fillval_key_size_g);
-        fetch_udata->md_rw_cb_ud.iod[3].iod_nr    = 1u;
-        fetch_udata->md_rw_cb_ud.iod[3].iod_size  = DAOS_REC_ANY;
-        fetch_udata->md_rw_cb_ud.iod[3].iod_type  = DAOS_IOD_SINGLE;
-        fetch_udata->md_rw_cb_ud.iod[3].iod_flags = 0;
-
-        fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
-
-        /* Set up buffer */
-        if (bcast_udata)
-            p = bcast_udata->flex_buf + (6 * H5_DAOS_ENCODED_UINT64_T_SIZE);
-        else
-            p = fetch_udata->flex_buf;
-
-        /* Set up sgl */
-        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], p, (daos_size_t)H5_DAOS_TYPE_BUF_SIZE);
-        fetch_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
-        fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-        fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
-        fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = FALSE;
-        p += H5_DAOS_TYPE_BUF_SIZE;
-        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[1], p, (daos_size_t)H5_DAOS_SPACE_BUF_SIZE);
-        fetch_udata->md_rw_cb_ud.sgl[1].sg_nr     = 1;
-        fetch_udata->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
-        fetch_udata->md_rw_cb_ud.sgl[1].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[1];
-        fetch_udata->md_rw_cb_ud.free_sg_iov[1]   = FALSE;
-        p += H5_DAOS_SPACE_BUF_SIZE;
-        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[2], p, (daos_size_t)H5_DAOS_DCPL_BUF_SIZE);
-        fetch_udata->md_rw_cb_ud.sgl[2].sg_nr     = 1;
-        fetch_udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
-        fetch_udata->md_rw_cb_ud.sgl[2].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[2];
-        fetch_udata->md_rw_cb_ud.free_sg_iov[2]   = FALSE;
-        p += H5_DAOS_DCPL_BUF_SIZE;
-        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[3], p, (daos_size_t)H5_DAOS_FILL_VAL_BUF_SIZE);
-        fetch_udata->md_rw_cb_ud.sgl[3].sg_nr     = 1;
-        fetch_udata->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
-        fetch_udata->md_rw_cb_ud.sgl[3].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[3];
-        fetch_udata->md_rw_cb_ud.free_sg_iov[3]   = FALSE;
-
-        /* Set conditional per-akey fetch for dataset metadata read operation */
-        fetch_udata->md_rw_cb_ud.flags = DAOS_COND_PER_AKEY;
-
-        /* Set nr */
-        fetch_udata->md_rw_cb_ud.nr = 4u;
-
-        /* Set task name */
-        fetch_udata->md_rw_cb_ud.task_name = "dataset metadata read";
-
-        /* Create meta task for dataset metadata read.  This empty task will be
-         * completed when the read is finished by H5_daos_dinfo_read_comp_cb.
-         * We can't use fetch_task since it may not be completed by the first
-         * fetch. */
-        if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &fetch_udata->fetch_metatask) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't create meta task for dataset metadata read");
-
-        /* Create task for dataset metadata read */
-        assert(*dep_task);
-        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_md_rw_prep_cb,
-                                     H5_daos_dinfo_read_comp_cb, fetch_udata, &fetch_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't create task to read dataset metadata");
-
-        /* Schedule meta task */
-        if (0 != (ret = tse_task_schedule(fetch_udata->fetch_metatask, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL,
-                         "can't schedule meta task for dataset metadata read: %s",
-                         H5_daos_err_to_string(ret));
-
-        /* Schedule dataset metadata read task (or save it to be scheduled
-         * later) and give it a reference to req and the dataset */
-        assert(*first_task);
-        if (0 != (ret = tse_task_schedule(fetch_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't schedule task to read dataset metadata: %s",
-                         H5_daos_err_to_string(ret));
-        *dep_task = fetch_udata->fetch_metatask;
-        req->rc++;
-        dset->obj.item.rc++;
-        fetch_udata = NULL;
+        /* If no other process can have the file open, share the dataset's
+         * metadata and DAOS object handle with its other open handles.
+         * Otherwise the dataspace could have been changed by another
+         * process. */
+        if (file->num_procs == 1) {
+            if (H5_daos_dset_open_share(dset, req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, NULL, "can't open dataset");
+        } /* end if */
+        else if (H5_daos_dset_open_fetch(dset, bcast_udata, dinfo_buf_size, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, NULL, "can't open dataset");
+
+        /* Load the chunk index once the layout is known.  Only done if no
+         * other process can have the file open, since their changes to the
+         * index would not be seen. */
+        if (file->num_procs == 1 && H5_daos_chunk_index_load(dset, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, NULL, "can't load chunk index");
     } /* end if */
     else
         assert(bcast_udata);
@@ -2142,193 +2751,274 @@ done:
         /* Close dataset */
         if (dset && H5_daos_dataset_close_real(dset) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, NULL, "can't close dataset");
-
-        /* Free memory */
-        fetch_udata = DV_free(fetch_udata);
     } /* end if */
 
     /* Make sure we cleaned up */
-    assert(!fetch_udata);
     assert(!bcast_udata);
 
     D_FUNC_LEAVE;
 } /* end H5_daos_dataset_open_helper() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_sel_to_recx_iov
- *
- * Purpose:     Given a dataspace with a selection and the datatype
- *              (element) size, build a list of DAOS records (recxs)
- *              and/or scatter/gather list I/O vectors (sg_iovs). *recxs
- *              and *sg_iovs should, if requested, point to a (probably
- *              statically allocated) single element.  Does not release
- *              buffers on error.
+ * Function:    H5_daos_dset_open_fetch
  *
- * Return:      Success:        0
- *              Failure:        -1
+ * Purpose:     Opens a dataset's DAOS object and reads its metadata.  The
+ *              metadata is placed in bcast_udata's buffer if it is
+ *              given, so it can be broadcast to the other processes.
  *
- * Programmer:  Neil Fortner
- *              December, 2016
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_sel_to_recx_iov(hid_t sel_iter_id, size_t type_size, void *buf, daos_recx_t **recxs,
-                        daos_iov_t **sg_iovs, size_t *list_nused)
-{
-    size_t  nseq;
-    size_t  nelem;
-    hsize_t off[H5_DAOS_SEQ_LIST_LEN];
-    size_t  len[H5_DAOS_SEQ_LIST_LEN];
-    size_t  buf_len = 1;
-    void   *vp_ret;
-    size_t  szi;
-    herr_t  ret_value = SUCCEED;
+H5_daos_dset_open_fetch(H5_daos_dset_t *dset, H5_daos_mpi_ibcast_ud_flex_t *bcast_udata,
+                        size_t dinfo_buf_size, H5_daos_req_t *req, tse_task_t **first_task,
+                        tse_task_t **dep_task)
+{
+    H5_daos_file_t         *file        = dset->obj.item.file;
+    H5_daos_omd_fetch_ud_t *fetch_udata = NULL;
+    tse_task_t             *fetch_task  = NULL;
+    uint8_t                *p;
+    int                     ret;
+    herr_t                  ret_value = SUCCEED;
 
-    assert(recxs || sg_iovs);
-    assert(!recxs || *recxs);
-    assert(!sg_iovs || *sg_iovs);
-    assert(list_nused);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Initialize list_nused */
-    *list_nused = 0;
+    /* Open dataset object */
+    if (H5_daos_obj_open(file, req, &dset->obj.oid, (file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO),
+                         &dset->obj.obj_oh, "dataset object open", first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "can't open dataset object");
 
-    /* Generate sequences from the file space until finished */
-    do {
-        /* Get the sequences of bytes */
-        if (H5Ssel_iter_get_seq_list(sel_iter_id, (size_t)H5_DAOS_SEQ_LIST_LEN, (size_t)-1, &nseq, &nelem,
-                                     off, len) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed");
+    /* Allocate argument struct for fetch task */
+    if (NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(sizeof(H5_daos_omd_fetch_ud_t) +
+                                                                   (bcast_udata ? 0 : dinfo_buf_size))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for fetch callback arguments");
 
-        /* Make room for sequences in recxs */
-        if ((buf_len == 1) && (nseq > 1)) {
-            if (recxs)
-                if (NULL == (*recxs = (daos_recx_t *)DV_malloc(H5_DAOS_SEQ_LIST_LEN * sizeof(daos_recx_t))))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for records");
-            if (sg_iovs)
-                if (NULL == (*sg_iovs = (daos_iov_t *)DV_malloc(H5_DAOS_SEQ_LIST_LEN * sizeof(daos_iov_t))))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for sgl iovs");
-            buf_len = H5_DAOS_SEQ_LIST_LEN;
-        } /* end if */
-        else if (*list_nused + nseq > buf_len) {
-            if (recxs) {
-                if (NULL == (vp_ret = DV_realloc(*recxs, 2 * buf_len * sizeof(daos_recx_t))))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate memory for records");
-                *recxs = (daos_recx_t *)vp_ret;
-            } /* end if */
-            if (sg_iovs) {
-                if (NULL == (vp_ret = DV_realloc(*sg_iovs, 2 * buf_len * sizeof(daos_iov_t))))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate memory for sgls");
-                *sg_iovs = (daos_iov_t *)vp_ret;
-            } /* end if */
-            buf_len *= 2;
-        } /* end if */
-        assert(*list_nused + nseq <= buf_len);
+    /* Set up operation to read datatype, dataspace, and DCPL sizes from
+     * dataset */
+    /* Set up ud struct */
+    fetch_udata->md_rw_cb_ud.req = req;
+    fetch_udata->md_rw_cb_ud.obj = &dset->obj;
+    fetch_udata->bcast_udata     = bcast_udata;
 
-        /* Copy offsets/lengths to recxs and sg_iovs */
-        for (szi = 0; szi < nseq; szi++) {
-            if (recxs) {
-                (*recxs)[szi + *list_nused].rx_idx = (uint64_t)off[szi];
-                (*recxs)[szi + *list_nused].rx_nr  = (uint64_t)len[szi];
-            } /* end if */
-            if (sg_iovs)
-                daos_iov_set(&(*sg_iovs)[szi + *list_nused], (uint8_t *)buf + (off[szi] * type_size),
-                             (daos_size_t)len[szi] * (daos_size_t)type_size);
-        } /* end for */
-        *list_nused += nseq;
-    } while (nseq == H5_DAOS_SEQ_LIST_LEN);
+    /* Set up dkey.  Point to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                       H5_daos_int_md_key_size_g);
+    fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
 
-done:
-    D_FUNC_LEAVE;
-} /* end H5_daos_sel_to_recx_iov() */
+    /* Set up iod.  Point akey to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_type_key_g,
+                       H5_daos_type_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[0].iod_nr    = 1u;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_size  = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_type  = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_flags = DAOS_COND_AKEY_FETCH;
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_scatter_cb
- *
- * Purpose:     Callback function for H5Dscatter.  Simply passes the
- *              entire buffer described by udata to H5Dscatter.
- *
- * Return:      SUCCEED (never fails)
- *
- * Programmer:  Neil Fortner
- *              March, 2017
- *
- *-------------------------------------------------------------------------
- */
-static herr_t
-H5_daos_scatter_cb(const void **src_buf, size_t *src_buf_bytes_used, void *_udata)
-{
-    H5_daos_scatter_cb_ud_t *udata     = (H5_daos_scatter_cb_ud_t *)_udata;
-    herr_t                   ret_value = SUCCEED;
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[1].iod_name, H5_daos_space_key_g,
+                       H5_daos_space_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[1].iod_nr    = 1u;
+    fetch_udata->md_rw_cb_ud.iod[1].iod_size  = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[1].iod_type  = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.iod[1].iod_flags = DAOS_COND_AKEY_FETCH;
+
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[2].iod_name, H5_daos_cpl_key_g,
+                       H5_daos_cpl_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[2].iod_nr    = 1u;
+    fetch_udata->md_rw_cb_ud.iod[2].iod_size  = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[2].iod_type  = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.iod[2].iod_flags = DAOS_COND_AKEY_FETCH;
+
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[3].iod_name, H5_daos_fillval_key_g,
+                       H5_daos_fillval_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[3].iod_nr    = 1u;
+    fetch_udata->md_rw_cb_ud.iod[3].iod_size  = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[3].iod_type  = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.iod[3].iod_flags = 0;
+
+    /* Fetch the raw data of a compact dataset in the same operation, so
+     * reading it later needs no I/O */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[4].iod_name, H5_daos_compact_key_g,
+                       H5_daos_compact_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[4].iod_nr    = 1u;
+    fetch_udata->md_rw_cb_ud.iod[4].iod_size  = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[4].iod_type  = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.iod[4].iod_flags = 0;
+
+    /* Check whether the dataset's chunks are stored filtered */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[5].iod_name,
+                       H5_daos_filtered_chunks_key_g, H5_daos_filtered_chunks_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[5].iod_nr    = 1u;
+    fetch_udata->md_rw_cb_ud.iod[5].iod_size  = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[5].iod_type  = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.iod[5].iod_flags = 0;
 
-    /* Set src_buf and src_buf_bytes_used to use the entire buffer */
-    *src_buf            = udata->buf;
-    *src_buf_bytes_used = udata->len;
+    fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Set up buffer */
+    if (bcast_udata)
+        p = bcast_udata->flex_buf + (8 * H5_DAOS_ENCODED_UINT64_T_SIZE);
+    else
+        p = fetch_udata->flex_buf;
+
+    /* Set up sgl */
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], p, (daos_size_t)H5_DAOS_TYPE_BUF_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = FALSE;
+    p += H5_DAOS_TYPE_BUF_SIZE;
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[1], p, (daos_size_t)H5_DAOS_SPACE_BUF_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[1].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[1].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[1];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[1]   = FALSE;
+    p += H5_DAOS_SPACE_BUF_SIZE;
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[2], p, (daos_size_t)H5_DAOS_DCPL_BUF_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[2].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[2].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[2].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[2];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[2]   = FALSE;
+    p += H5_DAOS_DCPL_BUF_SIZE;
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[3], p, (daos_size_t)H5_DAOS_FILL_VAL_BUF_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[3].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[3].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[3].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[3];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[3]   = FALSE;
+    p += H5_DAOS_FILL_VAL_BUF_SIZE;
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[4], p, (daos_size_t)H5_DAOS_COMPACT_BUF_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[4].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[4].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[4].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[4];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[4]   = FALSE;
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[5], &fetch_udata->marker_buf,
+                 (daos_size_t)sizeof(fetch_udata->marker_buf));
+    fetch_udata->md_rw_cb_ud.sgl[5].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[5].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[5].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[5];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[5]   = FALSE;
+
+    /* Set conditional per-akey fetch for dataset metadata read operation */
+    fetch_udata->md_rw_cb_ud.flags = DAOS_COND_PER_AKEY;
+
+    /* Set nr */
+    fetch_udata->md_rw_cb_ud.nr = 6u;
+
+    /* Set task name */
+    fetch_udata->md_rw_cb_ud.task_name = "dataset metadata read";
+
+    /* Create meta task for dataset metadata read.  This empty task will be
+     * completed when the read is finished by H5_daos_dinfo_read_comp_cb.
+     * We can't use fetch_task since it may not be completed by the first
+     * fetch. */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &fetch_udata->fetch_metatask) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create meta task for dataset metadata read");
+
+    /* Create task for dataset metadata read */
+    assert(*dep_task);
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_md_rw_prep_cb,
+                                 H5_daos_dinfo_read_comp_cb, fetch_udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read dataset metadata");
+
+    /* Schedule meta task */
+    if (0 != (ret = tse_task_schedule(fetch_udata->fetch_metatask, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                     "can't schedule meta task for dataset metadata read: %s", H5_daos_err_to_string(ret));
+
+    /* Schedule dataset metadata read task (or save it to be scheduled
+     * later) and give it a reference to req and the dataset */
+    assert(*first_task);
+    if (0 != (ret = tse_task_schedule(fetch_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to read dataset metadata: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = fetch_udata->fetch_metatask;
+    req->rc++;
+    dset->obj.item.rc++;
+    fetch_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (fetch_udata) {
+        assert(ret_value < 0);
+        fetch_udata = DV_free(fetch_udata);
+    } /* end if */
 
-    /* DSINC - This function used to always return SUCCEED without needing an
-     * herr_t. Might need an additional FUNC_LEAVE macro to do this, or modify
-     * the current one to take in the ret_value.
-     */
     D_FUNC_LEAVE;
-} /* end H5_daos_scatter_cb() */
+} /* end H5_daos_dset_open_fetch() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_prep_cb
+ * Function:    H5_daos_dset_open_copy
  *
- * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O.  Currently checks for
- *              errors from previous tasks then sets arguments for daos
- *              task.
+ * Purpose:     Sets up a dataset being opened from another open handle
+ *              of the same dataset, instead of opening its DAOS object
+ *              and reading its metadata.  The datatypes and DCPL are
+ *              shared, since they can't change, and the dataspace is
+ *              copied.
  *
- * Return:      Success:        0
- *              Failure:        Error code
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_chunk_io_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_dset_open_copy(H5_daos_dset_t *dset, const H5_daos_dset_t *src)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    daos_obj_rw_t         *update_args;
-    int                    ret_value = 0;
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for chunk I/O task");
-
-    assert(udata->req);
-
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+    herr_t ret_value = SUCCEED;
 
-    assert(udata->dset);
-    assert(udata->req->file);
+    assert(dset);
+    assert(dset->obj.shared);
+    assert(!daos_handle_is_inval(dset->obj.shared->obj_oh));
+    assert(src);
+
+    if (H5Iinc_ref(src->type_id) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment datatype reference count");
+    dset->type_id = src->type_id;
+    if (H5Iinc_ref(src->file_type_id) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment file datatype reference count");
+    dset->file_type_id   = src->file_type_id;
+    dset->file_type_size = src->file_type_size;
+    if (src->dcpl_id != H5P_DATASET_CREATE_DEFAULT && H5Iinc_ref(src->dcpl_id) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINC, FAIL, "can't increment DCPL reference count");
+    dset->dcpl_id = src->dcpl_id;
+
+    /* Copy dataspace and select all */
+    if ((dset->space_id = H5Scopy(src->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataspace");
+    if (H5Sselect_all(dset->space_id) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTDELETE, FAIL, "can't change selection");
+
+    /* Copy caches and fill value */
+    dset->dcpl_cache         = src->dcpl_cache;
+    dset->dcpl_cache.filters = NULL;
+    if (src->dcpl_cache.filters) {
+        if (NULL == (dset->dcpl_cache.filters = (H5_daos_filter_info_t *)DV_malloc(
+                         src->dcpl_cache.nfilters * sizeof(H5_daos_filter_info_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter info");
+        (void)memcpy(dset->dcpl_cache.filters, src->dcpl_cache.filters,
+                     src->dcpl_cache.nfilters * sizeof(H5_daos_filter_info_t));
+    } /* end if */
+    if (src->fill_val) {
+        if (NULL == (dset->fill_val = DV_malloc(src->file_type_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for fill value");
+        (void)memcpy(dset->fill_val, src->fill_val, src->file_type_size);
+    } /* end if */
+    dset->obj.ocpl_cache = src->obj.ocpl_cache;
 
-    /* Set I/O task arguments */
-    if (NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh   = udata->dset->obj.obj_oh;
-    update_args->th   = udata->req->th;
-    update_args->dkey = &udata->dkey;
-    update_args->nr   = 1;
-    update_args->iods = &udata->iod;
-    update_args->sgls = &udata->sgl;
+    /* Use the shared DAOS object handle */
+    dset->obj.obj_oh = dset->obj.shared->obj_oh;
 
 done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
-
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_prep_cb() */
+} /* end H5_daos_dset_open_copy() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_comp_cb
+ * Function:    H5_daos_dset_open_share_task
  *
- * Purpose:     Complete callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O.  Currently checks for a
- *              failed task then frees private data.
+ * Purpose:     Asynchronous task to add a dataset being opened to the
+ *              file's open object table once its OID is known.  If
+ *              another handle of the dataset has its metadata, the
+ *              dataset is set up from that handle, otherwise the
+ *              dataset's object is opened and its metadata read.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2336,252 +3026,626 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_chunk_io_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_dset_open_share_task(tse_task_t *task)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    int                    ret_value = 0;
-
-    assert(H5_daos_task_list_g);
+    H5_daos_dset_open_share_ud_t *udata      = NULL;
+    H5_daos_obj_t                *src        = NULL;
+    tse_task_t                   *first_task = NULL;
+    tse_task_t                   *dep_task   = NULL;
+    tse_task_t                   *metatask   = NULL;
+    int                           ret;
+    int                           ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for chunk I/O task");
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for dataset open share task");
 
-    assert(udata->req);
-    assert(udata->dset);
-    assert(udata->req->file);
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_DATASET);
 
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = "raw data I/O";
+    /* Add the dataset to the open object table */
+    if (H5_daos_obj_share(&udata->dset->obj) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't add dataset to open object table");
+
+    /* Copy the metadata of another handle if possible.  Compact datasets
+     * are always read, since their raw data must be received along with
+     * the metadata, although the data of other handles replaces it if it
+     * is newer. */
+    src = udata->dset->obj.shared->md_obj;
+    if (src && ((H5_daos_dset_t *)src)->dcpl_cache.layout != H5D_COMPACT) {
+        if (H5_daos_dset_open_copy(udata->dset, (H5_daos_dset_t *)src) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't copy metadata from open dataset");
     } /* end if */
+    else if (H5_daos_dset_open_fetch(udata->dset, NULL,
+                                     H5_DAOS_TYPE_BUF_SIZE + H5_DAOS_SPACE_BUF_SIZE + H5_DAOS_DCPL_BUF_SIZE +
+                                         H5_DAOS_FILL_VAL_BUF_SIZE + H5_DAOS_COMPACT_BUF_SIZE,
+                                     udata->req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, -H5_DAOS_SETUP_ERROR, "can't open dataset object");
 
 done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
+    /* Clean up */
     if (udata) {
+        /* Create metatask to complete this task after dep_task if necessary */
+        if (dep_task) {
+            /* Create metatask */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for dataset open share");
+            else {
+                /* Schedule metatask */
+                assert(first_task);
+                if (0 != (ret = tse_task_schedule(metatask, false)))
+                    D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, ret,
+                                 "can't schedule metatask for dataset open share: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end else */
+        }     /* end if */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, ret,
+                         "can't schedule initial task for dataset open share: %s",
+                         H5_daos_err_to_string(ret));
+
         /* Close dataset */
         if (H5_daos_dataset_close_real(udata->dset) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
+        udata->dset = NULL;
 
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
          * H5_daos_req_free_int, which updates req->status if it sees an error */
         if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
             udata->req->status      = ret_value;
-            udata->req->failed_task = "raw data I/O completion callback";
+            udata->req->failed_task = "dataset open share task";
         } /* end if */
 
         /* Release our reference to req */
         if (H5_daos_req_free_int(udata->req) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-        /* Free private data */
-        if (udata->recxs != &udata->recx)
-            DV_free(udata->recxs);
-        if (udata->sg_iovs != &udata->sg_iov)
-            DV_free(udata->sg_iovs);
-        DV_free(udata);
+        /* Free udata */
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_comp_cb() */
+} /* end H5_daos_dset_open_share_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_io_types_equal
- *
- * Purpose:     Internal helper routine to perform I/O on a dataset
- *              composed of a non-variable-length datatype where the
- *              datatype specified for the memory buffer matches the
- *              dataset's datatype. In this case, datatype conversion is
- *              not necessary.
+ * Function:    H5_daos_dset_open_share
  *
- * Return:      Success:        0
- *              Failure:        -1, dataset I/O not performed.
+ * Purpose:     Creates a task to open a dataset through the file's open
+ *              object table once its OID is known.  See
+ *              H5_daos_dset_open_share_task().
  *
- * Programmer:  Neil Fortner
- *              November, 2016
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
-                               uint64_t dset_ndims, hid_t H5VL_DAOS_UNUSED mem_type_id,
-                               H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
-                               tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_dset_open_share(H5_daos_dset_t *dset, H5_daos_req_t *req, tse_task_t **first_task,
+                        tse_task_t **dep_task)
 {
-    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
-    daos_opc_t             daos_op;
-    size_t                 tot_nseq;
-    size_t                 file_type_size;
-    tse_task_t            *io_task;
-    uint64_t               i;
-    uint8_t               *p;
-    int                    ret;
-    herr_t                 ret_value = SUCCEED;
+    H5_daos_dset_open_share_ud_t *udata = NULL;
+    tse_task_t                   *share_task;
+    int                           ret;
+    herr_t                        ret_value = SUCCEED;
 
-    assert(chunk_info);
     assert(dset);
     assert(req);
     assert(first_task);
     assert(dep_task);
 
-    /* Allocate argument struct */
-    if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
-    chunk_io_ud->recxs   = &chunk_io_ud->recx;
-    chunk_io_ud->sg_iovs = &chunk_io_ud->sg_iov;
+    /* Set up user data */
+    if (NULL == (udata = (H5_daos_dset_open_share_ud_t *)DV_malloc(sizeof(H5_daos_dset_open_share_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for dataset open");
+    udata->req  = req;
+    udata->dset = dset;
 
-    /* Point to dset */
-    chunk_io_ud->dset = dset;
+    /* Create task */
+    if (H5_daos_create_task(H5_daos_dset_open_share_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, udata, &share_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to open dataset");
 
-    /* Point to req */
-    chunk_io_ud->req = req;
+    /* Schedule task (or save it to be scheduled later) and give it a
+     * reference to req and the dataset */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(share_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to open dataset: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = share_task;
+    *dep_task = share_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    udata = NULL;
 
-    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
-     * collisions with other d-keys in this object.
-     */
-    p    = chunk_io_ud->dkey_buf;
-    *p++ = (uint8_t)'\0';
-    for (i = 0; i < dset_ndims; i++)
-        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
+done:
+    /* Cleanup on failure */
+    if (udata) {
+        assert(ret_value < 0);
+        udata = DV_free(udata);
+    } /* end if */
 
-    /* Set up dkey */
-    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
-                 (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_open_share() */
 
-    file_type_size = dset->file_type_size;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_sel_cache_key
+ *
+ * Purpose:     Builds the fingerprint used to look up a selection in a
+ *              dataset's selection translation cache.  Only "all" and
+ *              regular hyperslab selections are fingerprinted; the key
+ *              covers the extent, the hyperslab parameters and the low
+ *              corner of the selection bounds (which picks up any
+ *              selection offset).  key must have room for
+ *              2 + 6 * H5S_MAX_RANK elements.
+ *
+ * Return:      Success:        TRUE if the selection can be cached,
+ *                              FALSE otherwise
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_sel_cache_key(hid_t space_id, hsize_t *key, size_t *key_len)
+{
+    H5S_sel_type sel_type;
+    hsize_t      end[H5S_MAX_RANK];
+    htri_t       is_regular;
+    int          ndims;
+    htri_t       ret_value = TRUE;
+
+    assert(key);
+    assert(key_len);
+
+    if (H5S_SEL_ERROR == (sel_type = H5Sget_select_type(space_id)))
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection type");
+    if ((sel_type != H5S_SEL_ALL) && (sel_type != H5S_SEL_HYPERSLABS))
+        D_GOTO_DONE(FALSE);
+
+    if ((ndims = H5Sget_simple_extent_ndims(space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    if (ndims == 0)
+        D_GOTO_DONE(FALSE);
+
+    key[0]   = (hsize_t)sel_type;
+    key[1]   = (hsize_t)ndims;
+    *key_len = 2;
+    if (H5Sget_simple_extent_dims(space_id, &key[*key_len], NULL) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+    *key_len += (size_t)ndims;
+
+    if (sel_type == H5S_SEL_HYPERSLABS) {
+        if ((is_regular = H5Sis_regular_hyperslab(space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check if hyperslab selection is regular");
+        if (!is_regular)
+            D_GOTO_DONE(FALSE);
+
+        if (H5Sget_regular_hyperslab(space_id, &key[*key_len], &key[*key_len + (size_t)ndims],
+                                     &key[*key_len + 2 * (size_t)ndims],
+                                     &key[*key_len + 3 * (size_t)ndims]) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get regular hyperslab selection");
+        *key_len += 4 * (size_t)ndims;
+
+        if (H5Sget_select_bounds(space_id, &key[*key_len], end) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+        *key_len += (size_t)ndims;
+    } /* end if */
 
-    /* Set up iod */
-    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
-    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
-    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
-                 (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
-    chunk_io_ud->iod.iod_size = (daos_size_t)file_type_size;
-    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_sel_cache_key() */
 
-    /* Check if the memory space and file space IDs are the same; use file space in this case */
-    if (chunk_info->mspace_id == chunk_info->fspace_id) {
-        /* Reset file selection iterator for current file dataspace */
-        if (H5Ssel_iter_reset(dset->io_cache.file_sel_iter_id, chunk_info->fspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_sel_to_recx_iov
+ *
+ * Purpose:     Given a dataspace with a selection and the datatype
+ *              (element) size, build a list of DAOS records (recxs)
+ *              and/or scatter/gather list I/O vectors (sg_iovs). *recxs
+ *              and *sg_iovs should, if requested, point to a (probably
+ *              statically allocated) single element.  Does not release
+ *              buffers on error.
+ *
+ *              If dset is not NULL, the sequence list for space_id is
+ *              looked up in (and added to) the dataset's selection
+ *              translation cache, so repeated I/O with the same
+ *              selection only has to rebase the cached sequences onto
+ *              buf.  sel_iter_id is only reset and walked on a cache
+ *              miss.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              December, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_sel_to_recx_iov(H5_daos_dset_t *dset, hid_t space_id, hid_t sel_iter_id, size_t type_size,
+                        void *buf, daos_recx_t **recxs, daos_iov_t **sg_iovs, size_t *list_nused)
+{
+    H5_daos_sel_cache_ent_t *ent = NULL;
+    size_t                   nseq;
+    size_t                   nelem;
+    hsize_t                  off[H5_DAOS_SEQ_LIST_LEN];
+    size_t                   len[H5_DAOS_SEQ_LIST_LEN];
+    hsize_t                  key[2 + 6 * H5S_MAX_RANK];
+    size_t                   key_len   = 0;
+    uint64_t                 hash      = 0;
+    htri_t                   cacheable = FALSE;
+    size_t                   buf_len   = 1;
+    void                    *vp_ret;
+    size_t                   szi;
+    herr_t                   ret_value = SUCCEED;
 
-        /* Calculate both recxs and sg_iovs at the same time from file space */
-        if (H5_daos_sel_to_recx_iov(dset->io_cache.file_sel_iter_id, file_type_size, buf, &chunk_io_ud->recxs,
-                                    &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-        chunk_io_ud->iod.iod_nr    = (unsigned)tot_nseq;
-        chunk_io_ud->sgl.sg_nr     = (uint32_t)tot_nseq;
-        chunk_io_ud->sgl.sg_nr_out = 0;
-    } /* end if */
-    else {
-        /* Reset file selection iterator for current file dataspace */
-        if (H5Ssel_iter_reset(dset->io_cache.file_sel_iter_id, chunk_info->fspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
-        /* Reset memory selection iterator for current memory dataspace */
-        if (H5Ssel_iter_reset(dset->io_cache.mem_sel_iter_id, chunk_info->mspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL,
-                         "can't reset memory dataspace selection iterator");
+    assert(recxs || sg_iovs);
+    assert(!recxs || *recxs);
+    assert(!sg_iovs || *sg_iovs);
+    assert(list_nused);
 
-        /* Calculate recxs from file space */
-        if (H5_daos_sel_to_recx_iov(dset->io_cache.file_sel_iter_id, file_type_size, buf, &chunk_io_ud->recxs,
-                                    NULL, &tot_nseq) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
+    /* Initialize list_nused */
+    *list_nused = 0;
 
-        /* Calculate sg_iovs from mem space */
-        if (H5_daos_sel_to_recx_iov(dset->io_cache.mem_sel_iter_id, file_type_size, buf, NULL,
-                                    &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-        chunk_io_ud->sgl.sg_nr     = (uint32_t)tot_nseq;
-        chunk_io_ud->sgl.sg_nr_out = 0;
-    } /* end else */
+    /* Look up the selection in the dataset's translation cache */
+    if (dset) {
+        if ((cacheable = H5_daos_sel_cache_key(space_id, key, &key_len)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't compute selection fingerprint");
+
+        if (cacheable) {
+            /* FNV-1a hash of the key, used to quickly reject entries */
+            hash = UINT64_C(14695981039346656037);
+            for (szi = 0; szi < key_len; szi++)
+                hash = (hash ^ (uint64_t)key[szi]) * UINT64_C(1099511628211);
+
+            for (szi = 0; szi < H5_DAOS_SEL_CACHE_NENTRIES; szi++)
+                if (dset->io_cache.sel_cache[szi].key && dset->io_cache.sel_cache[szi].hash == hash &&
+                    dset->io_cache.sel_cache[szi].key_len == key_len &&
+                    !memcmp(dset->io_cache.sel_cache[szi].key, key, key_len * sizeof(hsize_t))) {
+                    ent = &dset->io_cache.sel_cache[szi];
+                    break;
+                } /* end if */
+        }         /* end if */
+    }             /* end if */
 
-    /* Point iod and sgl to lists generated above */
-    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
-    chunk_io_ud->sgl.sg_iovs   = chunk_io_ud->sg_iovs;
+    if (ent) {
+        /* Cache hit - make room for the sequences and rebase them onto buf */
+        ent->last_use = ++dset->io_cache.sel_cache_clock;
+
+        if (ent->nseq > 1) {
+            if (recxs)
+                if (NULL == (*recxs = (daos_recx_t *)DV_malloc(ent->nseq * sizeof(daos_recx_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for records");
+            if (sg_iovs)
+                if (NULL == (*sg_iovs = (daos_iov_t *)DV_malloc(ent->nseq * sizeof(daos_iov_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for sgl iovs");
+        } /* end if */
+
+        if (recxs && ent->nseq > 0)
+            (void)memcpy(*recxs, ent->seqs, ent->nseq * sizeof(daos_recx_t));
+        if (sg_iovs)
+            for (szi = 0; szi < ent->nseq; szi++)
+                daos_iov_set(&(*sg_iovs)[szi], (uint8_t *)buf + (ent->seqs[szi].rx_idx * type_size),
+                             (daos_size_t)ent->seqs[szi].rx_nr * (daos_size_t)type_size);
+        *list_nused = ent->nseq;
 
-    /* No selection in the file */
-    if (chunk_io_ud->iod.iod_nr == 0) {
-        *dep_task = NULL;
         D_GOTO_DONE(SUCCEED);
     } /* end if */
 
-    if (io_type == IO_READ) {
-        /* Handle fill values */
-        size_t j;
+    /* Reset selection iterator for the dataspace */
+    if (H5Ssel_iter_reset(sel_iter_id, space_id) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset dataspace selection iterator");
 
-        if (dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
-            /* Just set all locations pointed to by sg_iovs to zero */
-            for (j = 0; j < tot_nseq; j++)
-                (void)memset(chunk_io_ud->sg_iovs[j].iov_buf, 0, chunk_io_ud->sg_iovs[j].iov_len);
+    /* Generate sequences from the file space until finished */
+    do {
+        /* Get the sequences of bytes */
+        if (H5Ssel_iter_get_seq_list(sel_iter_id, (size_t)H5_DAOS_SEQ_LIST_LEN, (size_t)-1, &nseq, &nelem,
+                                     off, len) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed");
+
+        /* Make room for sequences in recxs */
+        if ((buf_len == 1) && (nseq > 1)) {
+            if (recxs)
+                if (NULL == (*recxs = (daos_recx_t *)DV_malloc(H5_DAOS_SEQ_LIST_LEN * sizeof(daos_recx_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for records");
+            if (sg_iovs)
+                if (NULL == (*sg_iovs = (daos_iov_t *)DV_malloc(H5_DAOS_SEQ_LIST_LEN * sizeof(daos_iov_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for sgl iovs");
+            buf_len = H5_DAOS_SEQ_LIST_LEN;
         } /* end if */
-        else if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
-            /* Copy fill value to all locations pointed to by sg_iovs */
-            size_t iov_buf_written;
+        else if (*list_nused + nseq > buf_len) {
+            if (recxs) {
+                if (NULL == (vp_ret = DV_realloc(*recxs, 2 * buf_len * sizeof(daos_recx_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate memory for records");
+                *recxs = (daos_recx_t *)vp_ret;
+            } /* end if */
+            if (sg_iovs) {
+                if (NULL == (vp_ret = DV_realloc(*sg_iovs, 2 * buf_len * sizeof(daos_iov_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate memory for sgls");
+                *sg_iovs = (daos_iov_t *)vp_ret;
+            } /* end if */
+            buf_len *= 2;
+        } /* end if */
+        assert(*list_nused + nseq <= buf_len);
 
-            assert(dset->fill_val);
+        /* Copy offsets/lengths to recxs and sg_iovs */
+        for (szi = 0; szi < nseq; szi++) {
+            if (recxs) {
+                (*recxs)[szi + *list_nused].rx_idx = (uint64_t)off[szi];
+                (*recxs)[szi + *list_nused].rx_nr  = (uint64_t)len[szi];
+            } /* end if */
+            if (sg_iovs)
+                daos_iov_set(&(*sg_iovs)[szi + *list_nused], (uint8_t *)buf + (off[szi] * type_size),
+                             (daos_size_t)len[szi] * (daos_size_t)type_size);
+        } /* end for */
+        *list_nused += nseq;
+    } while (nseq == H5_DAOS_SEQ_LIST_LEN);
+
+    /* Add the sequence list to the cache, evicting the least recently used
+     * entry.  Failure to cache is not an error. */
+    if (cacheable) {
+        daos_recx_t *seqs    = NULL;
+        hsize_t     *key_cpy = NULL;
+
+        if (NULL == (seqs = (daos_recx_t *)DV_malloc((*list_nused ? *list_nused : 1) * sizeof(daos_recx_t))))
+            D_GOTO_DONE(SUCCEED);
+        if (NULL == (key_cpy = (hsize_t *)DV_malloc(key_len * sizeof(hsize_t)))) {
+            DV_free(seqs);
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+        (void)memcpy(key_cpy, key, key_len * sizeof(hsize_t));
 
-            for (j = 0; j < tot_nseq; j++) {
-                for (iov_buf_written = 0; iov_buf_written < chunk_io_ud->sg_iovs[j].iov_len;
-                     iov_buf_written += file_type_size)
-                    (void)memcpy((uint8_t *)chunk_io_ud->sg_iovs[j].iov_buf + iov_buf_written, dset->fill_val,
-                                 file_type_size);
-                assert(iov_buf_written == chunk_io_ud->sg_iovs[j].iov_len);
+        if (recxs) {
+            if (*list_nused > 0)
+                (void)memcpy(seqs, *recxs, *list_nused * sizeof(daos_recx_t));
+        } /* end if */
+        else
+            for (szi = 0; szi < *list_nused; szi++) {
+                seqs[szi].rx_idx =
+                    (uint64_t)(((uint8_t *)(*sg_iovs)[szi].iov_buf - (uint8_t *)buf) / type_size);
+                seqs[szi].rx_nr = (uint64_t)((*sg_iovs)[szi].iov_len / type_size);
             } /* end for */
-        }     /* end if */
 
-        /* Create task to read data from dataset */
-        daos_op = DAOS_OPC_OBJ_FETCH;
-    }    /* end (io_type == IO_READ) */
-    else /* (io_type == IO_WRITE) */
-        /* Create task to write data to dataset */
-        daos_op = DAOS_OPC_OBJ_UPDATE;
+        ent = &dset->io_cache.sel_cache[0];
+        for (szi = 1; szi < H5_DAOS_SEL_CACHE_NENTRIES; szi++)
+            if (dset->io_cache.sel_cache[szi].last_use < ent->last_use)
+                ent = &dset->io_cache.sel_cache[szi];
+        DV_free(ent->key);
+        DV_free(ent->seqs);
+
+        ent->hash     = hash;
+        ent->key      = key_cpy;
+        ent->key_len  = key_len;
+        ent->seqs     = seqs;
+        ent->nseq     = *list_nused;
+        ent->last_use = ++dset->io_cache.sel_cache_clock;
+    } /* end if */
 
-    if (H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_chunk_io_prep_cb, H5_daos_chunk_io_comp_cb, chunk_io_ud,
-                                 &io_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
-                     (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_sel_to_recx_iov() */
 
-    /* Schedule IO task (or save it to be scheduled later) */
-    if (*first_task) {
-        assert(*dep_task);
-        if (0 != (ret = tse_task_schedule(io_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_scatter_cb
+ *
+ * Purpose:     Callback function for H5Dscatter.  Simply passes the
+ *              entire buffer described by udata to H5Dscatter.
+ *
+ * Return:      SUCCEED (never fails)
+ *
+ * Programmer:  Neil Fortner
+ *              March, 2017
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_scatter_cb(const void **src_buf, size_t *src_buf_bytes_used, void *_udata)
+{
+    H5_daos_scatter_cb_ud_t *udata     = (H5_daos_scatter_cb_ud_t *)_udata;
+    herr_t                   ret_value = SUCCEED;
+
+    /* Set src_buf and src_buf_bytes_used to use the entire buffer */
+    *src_buf            = udata->buf;
+    *src_buf_bytes_used = udata->len;
+
+    /* DSINC - This function used to always return SUCCEED without needing an
+     * herr_t. Might need an additional FUNC_LEAVE macro to do this, or modify
+     * the current one to take in the ret_value.
+     */
+    D_FUNC_LEAVE;
+} /* end H5_daos_scatter_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_fill_pattern
+ *
+ * Purpose:     Fills buf_size bytes of buf with copies of the
+ *              pattern_size byte pattern (usually a fill value).
+ *              buf_size must be a multiple of pattern_size.  A pattern
+ *              made of a single repeated byte is filled with memset().
+ *              Otherwise the pattern is copied once and the filled part
+ *              of the buffer is copied onto the rest, doubling each time,
+ *              so the fill takes a logarithmic number of memcpy() calls
+ *              that are long enough to use the C library's vectorized
+ *              copies, instead of one call per element.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_fill_pattern(void *buf, size_t buf_size, const void *pattern, size_t pattern_size)
+{
+    uint8_t       *p   = (uint8_t *)buf;
+    const uint8_t *pat = (const uint8_t *)pattern;
+    size_t         filled;
+    size_t         i;
+
+    assert(buf || buf_size == 0);
+    assert(pattern);
+    assert(pattern_size > 0);
+    assert(buf_size % pattern_size == 0);
+
+    if (buf_size == 0)
+        return;
+
+    /* Check for a single repeated byte */
+    for (i = 1; i < pattern_size; i++)
+        if (pat[i] != pat[0])
+            break;
+    if (i == pattern_size) {
+        (void)memset(p, pat[0], buf_size);
+        return;
+    } /* end if */
+
+    /* Copy the pattern once, then double the filled region until the buffer
+     * is full */
+    (void)memcpy(p, pat, pattern_size);
+    for (filled = pattern_size; filled < buf_size; filled *= 2)
+        (void)memcpy(p + filled, p, MIN(filled, buf_size - filled));
+} /* end H5_daos_fill_pattern() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_compact_init
+ *
+ * Purpose:     Allocates the cached raw data of a compact dataset and
+ *              fills it with the fill value, or with zeros if there is
+ *              none.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_compact_init(H5_daos_dset_t *dset)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+    assert(dset->compact.stored);
+    assert(!dset->compact.buf);
+
+    if (NULL == (dset->compact.buf = DV_malloc(dset->compact.size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for compact dataset data");
+
+    if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+        assert(dset->fill_val);
+        H5_daos_fill_pattern(dset->compact.buf, dset->compact.size, dset->fill_val, dset->file_type_size);
     } /* end if */
     else
-        *first_task = io_task;
-    *dep_task = io_task;
+        (void)memset(dset->compact.buf, 0, dset->compact.size);
 
-    /* Task will be scheduled, give it a reference to req */
-    chunk_io_ud->req->rc++;
-    chunk_io_ud->dset->obj.item.rc++;
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_compact_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_compact_attach
+ *
+ * Purpose:     Makes the cached raw data of a compact dataset coherent
+ *              with the other handles of the dataset open in this
+ *              process, through the same or other file handles, if the
+ *              file is only open on this process.  Adds the dataset to
+ *              the list of such handles and replaces its cached data with
+ *              that of another handle, which holds the latest writes even
+ *              if they have not reached the dataset's metadata yet.
+ *              Called when the dataset's data is received on open and
+ *              before its first I/O.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_compact_attach(H5_daos_dset_t *dset)
+{
+    H5_daos_dset_t *other;
+    herr_t          ret_value = SUCCEED;
+
+    assert(dset);
+    assert(dset->compact.stored);
+
+    if (dset->obj.item.file->num_procs > 1 || dset->peer_listed)
+        D_GOTO_DONE(SUCCEED);
+
+    H5_daos_dset_peers_add(dset);
+
+    for (other = H5_daos_dset_peers_g; other; other = other->peer_next)
+        if (H5_daos_dset_is_peer(dset, other) && other->compact.buf) {
+            assert(other->compact.size == dset->compact.size);
+            if (!dset->compact.buf && NULL == (dset->compact.buf = DV_malloc(dset->compact.size)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate buffer for compact dataset data");
+            (void)memcpy(dset->compact.buf, other->compact.buf, dset->compact.size);
+            break;
+        } /* end if */
 
 done:
-    /* Cleanup on failure */
-    if (ret_value < 0 && chunk_io_ud) {
-        if (chunk_io_ud->recxs != &chunk_io_ud->recx)
-            DV_free(chunk_io_ud->recxs);
-        if (chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
-            DV_free(chunk_io_ud->sg_iovs);
-        chunk_io_ud = DV_free(chunk_io_ud);
-    } /* end if */
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_compact_attach() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_compact_publish
+ *
+ * Purpose:     Copies the cached raw data of a compact dataset, just
+ *              updated by a write, to the other handles of the dataset
+ *              open in this process, so their reads see the write.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_compact_publish(H5_daos_dset_t *dset)
+{
+    H5_daos_dset_t *other;
+    herr_t          ret_value = SUCCEED;
+
+    assert(dset);
+    assert(dset->compact.buf);
+
+    if (!dset->peer_listed)
+        D_GOTO_DONE(SUCCEED);
 
+    for (other = H5_daos_dset_peers_g; other; other = other->peer_next)
+        if (H5_daos_dset_is_peer(dset, other)) {
+            assert(other->compact.size == dset->compact.size);
+            if (!other->compact.buf && NULL == (other->compact.buf = DV_malloc(dset->compact.size)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate buffer for compact dataset data");
+            (void)memcpy(other->compact.buf, dset->compact.buf, dset->compact.size);
+        } /* end if */
+
+done:
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_io_types_equal() */
+} /* end H5_daos_dset_compact_publish() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_tconv_prep_cb
+ * Function:    H5_daos_chunk_io_prep_cb
  *
  * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O with type conversion.
+ *              daos_obj_fetch for raw data I/O.  Currently checks for
+ *              errors from previous tasks then sets arguments for daos
+ *              task.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2589,7 +3653,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_chunk_io_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
     H5_daos_chunk_io_ud_t *udata;
     daos_obj_rw_t         *update_args;
@@ -2601,32 +3665,19 @@ H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                      "can't get private data for chunk I/O task");
 
     assert(udata->req);
-    assert(udata->dset);
-    assert(udata->req->file);
 
     /* Handle errors */
     H5_DAOS_PREP_REQ(udata->req, H5E_IO);
 
-    /* If writing, gather the write buffer data to the type conversion buffer */
-    if (udata->tconv.io_type == IO_WRITE) {
-        /* Gather data to conversion buffer */
-        if (H5Dgather(udata->tconv.mem_space_id, udata->tconv.buf, udata->tconv.mem_type_id,
-                      (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size, udata->tconv.tconv_buf,
-                      NULL, NULL) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
-                         "can't gather data to conversion buffer");
+    assert(udata->dset);
+    assert(udata->req->file);
 
-        /* Perform type conversion */
-        if (H5Tconvert(udata->tconv.mem_type_id, udata->dset->file_type_id, (size_t)udata->tconv.num_elem,
-                       udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
-                         "can't perform type conversion");
+    /* Skip reading chunks that were never written */
+    if (udata->skip_unallocated && H5_daos_chunk_index_absent(udata->dset, &udata->dkey)) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
     } /* end if */
 
-    /* Set sg_iov to point to tconv_buf */
-    daos_iov_set(&udata->sg_iov, udata->tconv.tconv_buf,
-                 (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
-
     /* Set I/O task arguments */
     if (NULL == (update_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
@@ -2643,13 +3694,14 @@ done:
         tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_tconv_prep_cb() */
+} /* end H5_daos_chunk_io_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_io_tconv_comp_cb
+ * Function:    H5_daos_chunk_io_comp_cb
  *
  * Purpose:     Complete callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for raw data I/O with type conversion.
+ *              daos_obj_fetch for raw data I/O.  Currently checks for a
+ *              failed task then frees private data.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -2657,7 +3709,7 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_chunk_io_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
     H5_daos_chunk_io_ud_t *udata;
     int                    ret_value = 0;
@@ -2670,8 +3722,8 @@ H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                      "can't get private data for chunk I/O task");
 
     assert(udata->req);
-    assert(udata->req->file);
     assert(udata->dset);
+    assert(udata->req->file);
 
     /* Handle errors in update task.  Only record error in udata->req_status if
      * it does not already contain an error (it could contain an error if
@@ -2681,26 +3733,19 @@ H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
         udata->req->failed_task = "raw data I/O";
     } /* end if */
 
-    /* If reading we must perform type conversion on the read data */
-    if (udata->tconv.io_type == IO_READ) {
-        /* Perform type conversion */
-        if (H5Tconvert(udata->dset->file_type_id, udata->tconv.mem_type_id, (size_t)udata->tconv.num_elem,
-                       udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
-                         "can't perform type conversion");
+    /* If the data was read directly into the memory buffer but needs
+     * conversion with a native routine, convert it in place */
+    if (udata->tconv.native.func && task->dt_result == 0) {
+        uint32_t i;
 
-        /* Scatter data to memory buffer if necessary */
-        if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV) {
-            H5_daos_scatter_cb_ud_t scatter_cb_ud;
+        assert(udata->tconv.io_type == IO_READ);
+        assert(udata->tconv.native.src_size == udata->tconv.native.dst_size);
 
-            scatter_cb_ud.buf = udata->tconv.tconv_buf;
-            scatter_cb_ud.len = (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size;
-            if (H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->tconv.mem_type_id,
-                           udata->tconv.mem_space_id, udata->tconv.buf) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
-                             "can't scatter data to read buffer");
-        } /* end if */
-    }     /* end if */
+        for (i = 0; i < udata->sgl.sg_nr; i++)
+            udata->tconv.native.func(&udata->tconv.native, udata->sg_iovs[i].iov_buf,
+                                     udata->sg_iovs[i].iov_buf,
+                                     (size_t)udata->sg_iovs[i].iov_len / udata->tconv.native.src_size);
+    } /* end if */
 
 done:
     /* Return task to task list */
@@ -2708,17 +3753,25 @@ done:
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
     if (udata) {
+        /* Finish chunk cache I/O */
+        if (udata->cache.ent)
+            H5_daos_chunk_cache_fetch_done(udata->dset, udata->cache.ent, task->dt_result);
+        if (udata->cache.wb) {
+            if (udata->cache.wb->prev)
+                udata->cache.wb->prev->next = udata->cache.wb->next;
+            else
+                udata->dset->chunk_cache.wb_head = udata->cache.wb->next;
+            if (udata->cache.wb->next)
+                udata->cache.wb->next->prev = udata->cache.wb->prev;
+            DV_free(udata->cache.wb);
+            DV_free(udata->cache.buf);
+            (void)H5_daos_chunk_cache_op_release(udata->cache.op, task->dt_result);
+        } /* end if */
+
         /* Close dataset */
         if (H5_daos_dataset_close_real(udata->dset) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
-        /* Close space and type IDs */
-        if (H5Sclose(udata->tconv.mem_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
-                         "can't close memory dataspace");
-        if (H5Tclose(udata->tconv.mem_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
-
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
          * H5_daos_req_free_int, which updates req->status if it sees an error */
@@ -2734,127 +3787,151 @@ done:
         /* Free private data */
         if (udata->recxs != &udata->recx)
             DV_free(udata->recxs);
-        if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
-            DV_free(udata->tconv.tconv_buf);
-        if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
-            DV_free(udata->tconv.bkg_buf);
+        if (udata->sg_iovs != &udata->sg_iov)
+            DV_free(udata->sg_iovs);
         DV_free(udata);
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_io_tconv_comp_cb() */
+} /* end H5_daos_chunk_io_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_fill_bkg_prep_cb
- *
- * Purpose:     Prepare callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for filling background buffer for type
- *              conversion.
+ * Function:    H5_daos_chunk_io_setup_types_equal
+ *
+ * Purpose:     Sets up the dkey, iod and sgl in chunk_io_ud for I/O on a
+ *              single chunk where the memory datatype matches the
+ *              dataset's datatype, and writes fill values to the buffer
+ *              for reads.  chunk_io_ud->recxs and chunk_io_ud->sg_iovs
+ *              must point to (probably statically allocated) single
+ *              elements.  If there is no selection in the chunk,
+ *              chunk_io_ud->iod.iod_nr is set to 0.  Does not release
+ *              buffers on error.
  *
  * Return:      Success:        0
- *              Failure:        Error code
+ *              Failure:        -1
  *
  *-------------------------------------------------------------------------
  */
-static int
-H5_daos_chunk_fill_bkg_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static herr_t
+H5_daos_chunk_io_setup_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                   uint64_t dset_ndims, H5_daos_io_type_t io_type, void *buf,
+                                   H5_daos_chunk_io_ud_t *chunk_io_ud)
 {
-    H5_daos_chunk_io_ud_t *udata;
-    daos_obj_rw_t         *update_args;
-    int                    ret_value = 0;
+    size_t   tot_nseq;
+    size_t   file_type_size;
+    uint64_t i;
+    uint8_t *p;
+    herr_t   ret_value = SUCCEED;
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for chunk I/O task");
+    assert(chunk_info);
+    assert(dset);
+    assert(chunk_io_ud);
+    assert(chunk_io_ud->recxs);
+    assert(chunk_io_ud->sg_iovs);
 
-    assert(udata->req);
-    assert(udata->dset);
-    assert(udata->req->file);
+    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
+     * collisions with other d-keys in this object.
+     */
+    p    = chunk_io_ud->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for (i = 0; i < dset_ndims; i++)
+        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+    /* Set up dkey */
+    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+                 (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
 
-    /* Set sg_iov to point to background buffer */
-    daos_iov_set(&udata->sg_iov, udata->tconv.bkg_buf,
-                 (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+    file_type_size = dset->file_type_size;
 
-    /* Set I/O task arguments */
-    if (NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh   = udata->dset->obj.obj_oh;
-    update_args->th   = udata->req->th;
-    update_args->dkey = &udata->dkey;
-    update_args->nr   = 1;
-    update_args->iods = &udata->iod;
-    update_args->sgls = &udata->sgl;
+    /* Set up iod */
+    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
+    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+                 (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->iod.iod_size = (daos_size_t)file_type_size;
+    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
 
-done:
-    if (ret_value < 0)
-        tse_task_complete(task, ret_value);
+    /* Check if the chunk's selection is described by the dataset's regular
+     * selection; if so compute recxs and sg_iovs directly from it.
+     * Otherwise check if the memory space and file space IDs are the same;
+     * use file space in this case */
+    if (chunk_info->sel_regular) {
+        if (H5_daos_regular_sel_to_recx_iov(&dset->io_cache.regular_sel, chunk_info->chunk_coords,
+                                            dset->dcpl_cache.chunk_dims, file_type_size, buf,
+                                            &chunk_io_ud->recxs, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->iod.iod_nr    = (unsigned)tot_nseq;
+        chunk_io_ud->sgl.sg_nr     = (uint32_t)tot_nseq;
+        chunk_io_ud->sgl.sg_nr_out = 0;
+    } /* end if */
+    else if (chunk_info->mspace_id == chunk_info->fspace_id) {
+        /* Calculate both recxs and sg_iovs at the same time from file space */
+        if (H5_daos_sel_to_recx_iov(dset, chunk_info->fspace_id, dset->io_cache.file_sel_iter_id,
+                                    file_type_size, buf, &chunk_io_ud->recxs, &chunk_io_ud->sg_iovs,
+                                    &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->iod.iod_nr    = (unsigned)tot_nseq;
+        chunk_io_ud->sgl.sg_nr     = (uint32_t)tot_nseq;
+        chunk_io_ud->sgl.sg_nr_out = 0;
+    } /* end if */
+    else {
+        /* Calculate recxs from file space */
+        if (H5_daos_sel_to_recx_iov(dset, chunk_info->fspace_id, dset->io_cache.file_sel_iter_id,
+                                    file_type_size, buf, &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->iod.iod_nr = (unsigned)tot_nseq;
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_chunk_fill_bkg_prep_cb() */
+        /* Calculate sg_iovs from mem space */
+        if (H5_daos_sel_to_recx_iov(dset, chunk_info->mspace_id, dset->io_cache.mem_sel_iter_id,
+                                    file_type_size, buf, NULL, &chunk_io_ud->sg_iovs, &tot_nseq) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+        chunk_io_ud->sgl.sg_nr     = (uint32_t)tot_nseq;
+        chunk_io_ud->sgl.sg_nr_out = 0;
+    } /* end else */
 
-/*-------------------------------------------------------------------------
- * Function:    H5_daos_chunk_fill_bkg_comp_cb
- *
- * Purpose:     Complete callback for asynchronous daos_obj_update or
- *              daos_obj_fetch for filling background buffer for type
- *              conversion.  Does not free data, will be freed by
- *              H5_daos_chunk_io_tconv_comp_cb().
- *
- * Return:      Success:        0
- *              Failure:        Error code
- *
- *-------------------------------------------------------------------------
- */
-static int
-H5_daos_chunk_fill_bkg_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
-{
-    H5_daos_chunk_io_ud_t *udata;
-    int                    ret_value = 0;
+    /* Point iod and sgl to lists generated above */
+    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
+    chunk_io_ud->sgl.sg_iovs   = chunk_io_ud->sg_iovs;
 
-    assert(H5_daos_task_list_g);
+    /* No selection in the file */
+    if (chunk_io_ud->iod.iod_nr == 0)
+        D_GOTO_DONE(SUCCEED);
 
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for chunk I/O task");
+    if (io_type == IO_READ) {
+        /* Handle fill values */
+        size_t j;
 
-    assert(udata);
-    assert(udata->req);
-    assert(udata->req->file);
+        /* The buffer now holds the fill value, so the fetch can be skipped if
+         * the chunk was never written */
+        chunk_io_ud->skip_unallocated = TRUE;
 
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = task->dt_result;
-        udata->req->failed_task = "background buffer fill (daos_obj_fetch) for raw data write";
-    } /* end if */
+        if (dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
+            /* Just set all locations pointed to by sg_iovs to zero */
+            for (j = 0; j < tot_nseq; j++)
+                (void)memset(chunk_io_ud->sg_iovs[j].iov_buf, 0, chunk_io_ud->sg_iovs[j].iov_len);
+        } /* end if */
+        else if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+            /* Copy fill value to all locations pointed to by sg_iovs */
+            assert(dset->fill_val);
 
-    /* Reset iod_size, if the dataset was not allocated then it could
-     * have been overwritten by daos_obj_fetch */
-    udata->iod.iod_size = udata->tconv.file_type_size;
+            for (j = 0; j < tot_nseq; j++)
+                H5_daos_fill_pattern(chunk_io_ud->sg_iovs[j].iov_buf, chunk_io_ud->sg_iovs[j].iov_len,
+                                     dset->fill_val, file_type_size);
+        }     /* end if */
+    }         /* end (io_type == IO_READ) */
 
 done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
     D_FUNC_LEAVE;
-} /* end H5_daos_chunk_fill_bkg_comp_cb() */
+} /* end H5_daos_chunk_io_setup_types_equal() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_io_types_unequal
+ * Function:    H5_daos_dataset_io_types_equal
  *
  * Purpose:     Internal helper routine to perform I/O on a dataset
  *              composed of a non-variable-length datatype where the
- *              datatype specified for the memory buffer doesn't match the
- *              dataset's datatype. In this case, datatype conversion must
- *              be performed.
+ *              datatype specified for the memory buffer matches the
+ *              dataset's datatype. In this case, datatype conversion is
+ *              not necessary.
  *
  * Return:      Success:        0
  *              Failure:        -1, dataset I/O not performed.
@@ -2865,18 +3942,14 @@ done:
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
-                                 uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type, void *buf,
-                                 H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_dataset_io_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                               uint64_t dset_ndims, hid_t H5VL_DAOS_UNUSED mem_type_id,
+                               H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
+                               tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
     daos_opc_t             daos_op;
-    hbool_t                contig = FALSE;
-    size_t                 tot_nseq;
-    tse_task_t            *io_task       = NULL;
-    tse_task_t            *fill_bkg_task = NULL;
-    uint64_t               i;
-    uint8_t               *p;
+    tse_task_t            *io_task;
     int                    ret;
     herr_t                 ret_value = SUCCEED;
 
@@ -2889,18 +3962,8 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
     /* Allocate argument struct */
     if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
-
-    /* Setup type conversion-related fields */
-    chunk_io_ud->tconv.num_elem     = chunk_info->num_elem_sel_file;
-    chunk_io_ud->tconv.mem_space_id = H5I_INVALID_HID;
-    if ((chunk_io_ud->tconv.mem_type_id = H5Tcopy(mem_type_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
-    if ((chunk_io_ud->tconv.mem_space_id = H5Scopy(chunk_info->mspace_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
-    chunk_io_ud->tconv.buf     = buf;
-    chunk_io_ud->tconv.io_type = io_type;
-    chunk_io_ud->recxs         = &chunk_io_ud->recx;
-    assert(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_NONE);
+    chunk_io_ud->recxs   = &chunk_io_ud->recx;
+    chunk_io_ud->sg_iovs = &chunk_io_ud->sg_iov;
 
     /* Point to dset */
     chunk_io_ud->dset = dset;
@@ -2908,2096 +3971,10472 @@ H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_dao
     /* Point to req */
     chunk_io_ud->req = req;
 
-    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
-     * collisions with other d-keys in this object.
-     */
-    p    = chunk_io_ud->dkey_buf;
-    *p++ = (uint8_t)'\0';
-    for (i = 0; i < dset_ndims; i++)
-        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
+    /* Set up dkey, iod and sgl, and handle fill values */
+    if (H5_daos_chunk_io_setup_types_equal(chunk_info, dset, dset_ndims, io_type, buf, chunk_io_ud) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
 
-    /* Set up dkey */
-    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
-                 (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
+    /* No selection in the file */
+    if (chunk_io_ud->iod.iod_nr == 0) {
+        *dep_task = NULL;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
 
-    if (io_type == IO_READ) {
-        size_t  nseq_tmp;
-        size_t  nelem_tmp;
-        hsize_t sel_off;
-        size_t  sel_len;
+    if (io_type == IO_READ)
+        /* Create task to read data from dataset */
+        daos_op = DAOS_OPC_OBJ_FETCH;
+    else /* (io_type == IO_WRITE) */
+        /* Create task to write data to dataset */
+        daos_op = DAOS_OPC_OBJ_UPDATE;
 
-        /* Reset memory selection iterator for current memory dataspace */
-        if (H5Ssel_iter_reset(dset->io_cache.mem_sel_iter_id, chunk_info->mspace_id) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
+    if (H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_chunk_io_prep_cb, H5_daos_chunk_io_comp_cb, chunk_io_ud,
+                                 &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
+                     (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
 
-        /* Get the sequence list - only check the first sequence because we only
-         * care if it is contiguous and if so where the contiguous selection
-         * begins */
-        if (H5Ssel_iter_get_seq_list(dset->io_cache.mem_sel_iter_id, (size_t)1, (size_t)-1, &nseq_tmp,
-                                     &nelem_tmp, &sel_off, &sel_len) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed");
-        contig = (sel_len == (size_t)chunk_info->num_elem_sel_file);
+    /* Schedule IO task (or save it to be scheduled later) */
+    if (*first_task) {
+        assert(*dep_task);
+        if (0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+    } /* end if */
+    else
+        *first_task = io_task;
+    *dep_task = io_task;
 
-        /* Initialize type conversion */
-        if (H5_daos_tconv_init(dset->file_type_id, &chunk_io_ud->tconv.file_type_size, mem_type_id,
-                               &chunk_io_ud->tconv.mem_type_size, (size_t)chunk_info->num_elem_sel_file,
-                               dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL, FALSE,
-                               &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf,
-                               contig ? &chunk_io_ud->tconv.reuse : NULL, &chunk_io_ud->tconv.fill_bkg) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+    /* Task will be scheduled, give it a reference to req */
+    chunk_io_ud->req->rc++;
+    chunk_io_ud->dset->obj.item.rc++;
 
-        /* Reuse buffer as appropriate */
-        if (contig) {
-            sel_off *= (hsize_t)chunk_io_ud->tconv.mem_type_size;
-            if (chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
-                chunk_io_ud->tconv.tconv_buf = (char *)buf + (size_t)sel_off;
-            else if (chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_BKG)
-                chunk_io_ud->tconv.bkg_buf = (char *)buf + (size_t)sel_off;
-        } /* end if */
-    }     /* end (io_type == IO_READ) */
-    else
-        /* Initialize type conversion */
-        if (H5_daos_tconv_init(mem_type_id, &chunk_io_ud->tconv.mem_type_size, dset->file_type_id,
-                               &chunk_io_ud->tconv.file_type_size, (size_t)chunk_info->num_elem_sel_file,
-                               FALSE, TRUE, &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf, NULL,
-                               &chunk_io_ud->tconv.fill_bkg) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
-
-    /* Set up iod */
-    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
-    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
-    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
-                 (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
-    chunk_io_ud->iod.iod_size = (daos_size_t)chunk_io_ud->tconv.file_type_size;
-    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && chunk_io_ud) {
+        if (chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if (chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
+            DV_free(chunk_io_ud->sg_iovs);
+        chunk_io_ud = DV_free(chunk_io_ud);
+    } /* end if */
 
-    /* Build recxs and sg_iovs */
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_types_equal() */
 
-    /* Reset file selection iterator for current file dataspace */
-    if (H5Ssel_iter_reset(dset->io_cache.file_sel_iter_id, chunk_info->fspace_id) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_task_batch_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O on a chunk that is part of
+ *              a batch.  Checks for a failed task, then, if this is the
+ *              last I/O task in the batch, completes the batch metatask
+ *              and frees the batch's private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_task_batch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t         *udata;
+    H5_daos_chunk_task_batch_ud_t *batch_ud = NULL;
+    size_t                         i;
+    int                            ret_value = 0;
 
-    /* Calculate recxs from file space */
-    if (H5_daos_sel_to_recx_iov(dset->io_cache.file_sel_iter_id, chunk_io_ud->tconv.file_type_size, buf,
-                                &chunk_io_ud->recxs, NULL, &tot_nseq) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
-    chunk_io_ud->iod.iod_nr    = (unsigned)tot_nseq;
-    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
+    assert(H5_daos_task_list_g);
 
-    /* No selection in the file */
-    if (chunk_io_ud->iod.iod_nr == 0)
-        D_GOTO_DONE(SUCCEED);
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    /* Set up constant sgl info */
-    chunk_io_ud->sgl.sg_nr     = 1;
-    chunk_io_ud->sgl.sg_nr_out = 0;
-    chunk_io_ud->sgl.sg_iovs   = &chunk_io_ud->sg_iov;
+    batch_ud = udata->batch;
+    assert(batch_ud);
+    assert(batch_ud->req);
+    assert(batch_ud->dset);
+    assert(batch_ud->nio_left > 0);
 
-    if (io_type == IO_READ) {
-        /* Gather data to background buffer if necessary */
-        if (chunk_io_ud->tconv.fill_bkg && (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG))
-            if (H5Dgather(chunk_info->mspace_id, buf, mem_type_id,
-                          (size_t)chunk_info->num_elem_sel_file * chunk_io_ud->tconv.mem_type_size,
-                          chunk_io_ud->tconv.bkg_buf, NULL, NULL) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't gather data to background buffer");
+    /* Handle errors in I/O task.  Only record error in req->status if it
+     * does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && batch_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        batch_ud->req->status      = task->dt_result;
+        batch_ud->req->failed_task = "raw data I/O";
+    } /* end if */
 
-        /* Handle fill values */
-        if (dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
-            /* H5_daos_tconv_init() will have cleared the tconv buf, but not if
-             * we're reusing buf as tconv_buf */
-            if (chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
-                (void)memset(chunk_io_ud->tconv.tconv_buf, 0,
-                             (daos_size_t)chunk_info->num_elem_sel_file *
-                                 (daos_size_t)chunk_io_ud->tconv.file_type_size);
-        } /* end if */
-        else if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
-            hssize_t j;
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-            assert(dset->fill_val);
+    /* Clean up if this is the last I/O task in the batch */
+    if (batch_ud && --batch_ud->nio_left == 0) {
+        /* Close dataset */
+        if (H5_daos_dataset_close_real(batch_ud->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
-            /* Copy the fill value to every element in tconv_buf */
-            for (j = 0; j < chunk_info->num_elem_sel_file; j++)
-                (void)memcpy((uint8_t *)chunk_io_ud->tconv.tconv_buf +
-                                 ((size_t)j * chunk_io_ud->tconv.file_type_size),
-                             dset->fill_val, chunk_io_ud->tconv.file_type_size);
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && batch_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            batch_ud->req->status      = ret_value;
+            batch_ud->req->failed_task = "raw data I/O completion callback";
         } /* end if */
 
-        /* Create task to read data from dataset */
-        daos_op = DAOS_OPC_OBJ_FETCH;
-    } /* end (io_type == IO_READ) */
-    else {
-        /* Check if we need to fill background buffer */
-        if (chunk_io_ud->tconv.fill_bkg) {
-            assert(chunk_io_ud->tconv.bkg_buf);
-
-            /* Create task to read data from dataset */
-            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                         H5_daos_chunk_fill_bkg_prep_cb, H5_daos_chunk_fill_bkg_comp_cb,
-                                         chunk_io_ud, &fill_bkg_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                             "can't create task to read data to background buffer");
-
-            /* Save bkg fill task to be scheduled later */
-            if (*first_task) {
-                if (0 != (ret = tse_task_schedule(fill_bkg_task, false)))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                                 "can't schedule background buffer fill task");
-            } /* end if */
-            else
-                *first_task = fill_bkg_task;
-            *dep_task = fill_bkg_task;
-        } /* end if */
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(batch_ud->req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-        /* Create task to write data to dataset */
-        daos_op = DAOS_OPC_OBJ_UPDATE;
-    } /* end (io_type == IO_WRITE) */
+        /* Return batch metatask to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, batch_ud->io_metatask) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
 
-    if (H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_chunk_io_tconv_prep_cb, H5_daos_chunk_io_tconv_comp_cb, chunk_io_ud,
-                                 &io_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
-                     (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
+        /* Complete batch metatask */
+        tse_task_complete(batch_ud->io_metatask, ret_value);
 
-    /* Schedule IO task (or save it to be scheduled later) */
-    if (*first_task) {
-        assert(*dep_task);
-        if (0 != (ret = tse_task_schedule(io_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+        /* Free private data */
+        for (i = 0; i < batch_ud->nchunks; i++) {
+            if (batch_ud->chunk_io_uds[i].recxs != &batch_ud->chunk_io_uds[i].recx)
+                DV_free(batch_ud->chunk_io_uds[i].recxs);
+            if (batch_ud->chunk_io_uds[i].sg_iovs != &batch_ud->chunk_io_uds[i].sg_iov)
+                DV_free(batch_ud->chunk_io_uds[i].sg_iovs);
+        } /* end for */
+        DV_free(batch_ud->chunk_io_uds);
+        DV_free(batch_ud);
     } /* end if */
-    else
-        *first_task = io_task;
-    *dep_task = io_task;
-
-    /* Task will be scheduled, give it a reference to req and the dataset */
-    chunk_io_ud->req->rc++;
-    chunk_io_ud->dset->obj.item.rc++;
-
-done:
-    /* Cleanup on failure */
-    if (ret_value < 0 && chunk_io_ud && !fill_bkg_task) {
-        if (chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
-        if (chunk_io_ud->tconv.mem_space_id >= 0 && H5Sclose(chunk_io_ud->tconv.mem_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
-        if (chunk_io_ud->recxs != &chunk_io_ud->recx)
-            DV_free(chunk_io_ud->recxs);
-        if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
-            chunk_io_ud->tconv.tconv_buf = DV_free(chunk_io_ud->tconv.tconv_buf);
-        if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
-            chunk_io_ud->tconv.bkg_buf = DV_free(chunk_io_ud->tconv.bkg_buf);
-        chunk_io_ud = DV_free(chunk_io_ud);
+    else if (ret_value < -H5_DAOS_SHORT_CIRCUIT && batch_ud &&
+             batch_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        /* Handle errors in this function */
+        batch_ud->req->status      = ret_value;
+        batch_ud->req->failed_task = "raw data I/O completion callback";
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_io_types_unequal() */
+} /* end H5_daos_chunk_task_batch_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dset_fill_io_cache
+ * Function:    H5_daos_dataset_io_types_equal_task_batch
  *
- * Purpose:     Fills the "io_cache" field of the dataset struct. This
- *              field is used to cache various things for dataset I/O
- *              including dataspace selection iterators and selected chunk
- *              info buffers.
+ * Purpose:     Version of H5_daos_dataset_io_types_equal() that
+ *              batches the task overhead for nchunks chunks.  Uses a
+ *              single allocation for all of the chunks' I/O arguments and
+ *              a single reference to req and the dataset.  The I/O tasks
+ *              for all chunks are created and scheduled together, and
+ *              *dep_task is set to a metatask that completes once all of
+ *              them have completed, so the caller only needs to track one
+ *              task per batch.
  *
- * Return:      Non-negative on success/Negative on failure
+ *              This does not reduce the number of DAOS operations or
+ *              round trips.  Each chunk is stored under its own dkey and
+ *              the DAOS object API takes one dkey per update or fetch, so
+ *              each chunk is still its own DAOS operation.
+ *
+ *              *first_task must already be set, since the I/O tasks are
+ *              scheduled immediately.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_dset_fill_io_cache(H5_daos_dset_t *dset, hid_t file_space_id, hid_t mem_space_id)
+H5_daos_dataset_io_types_equal_task_batch(H5_daos_select_chunk_info_t *chunk_info, size_t nchunks,
+                                          H5_daos_dset_t *dset, uint64_t dset_ndims,
+                                          H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
+                                          tse_task_t **first_task, tse_task_t **dep_task)
 {
-    herr_t ret_value = SUCCEED;
+    H5_daos_chunk_task_batch_ud_t *batch_ud = NULL;
+    daos_opc_t                     daos_op  = (io_type == IO_READ) ? DAOS_OPC_OBJ_FETCH : DAOS_OPC_OBJ_UPDATE;
+    tse_task_t                    *io_task;
+    size_t                         i;
+    int                            ret;
+    herr_t                         ret_value = SUCCEED;
 
+    assert(chunk_info);
+    assert(nchunks > 0);
     assert(dset);
-    assert(!dset->io_cache.filled);
-    assert(dset->io_cache.file_sel_iter_id <= 0);
-    assert(dset->io_cache.mem_sel_iter_id <= 0);
-    assert((dset->dcpl_cache.layout != H5D_LAYOUT_ERROR) && (dset->dcpl_cache.layout != H5D_NLAYOUTS));
+    assert(req);
+    assert(first_task);
+    assert(*first_task);
+    assert(dep_task);
+    assert(*dep_task);
 
-    /* Setup and cache selection iterators for dataset. We use 1 for the element
-     * size here so that the sequence list offsets and lengths are returned in
-     * terms of numbers of elements, not bytes. This way the returned values
-     * better match the values DAOS expects to receive, which are also in terms
-     * of numbers of elements. */
-    if ((dset->io_cache.file_sel_iter_id =
-             H5Ssel_iter_create(file_space_id, 1, H5S_SEL_ITER_SHARE_WITH_DATASPACE)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to create file dataspace selection iterator");
-    if ((dset->io_cache.mem_sel_iter_id =
-             H5Ssel_iter_create(mem_space_id, 1, H5S_SEL_ITER_SHARE_WITH_DATASPACE)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL,
-                     "unable to create memory dataspace selection iterator");
+    /* Allocate batch struct */
+    if (NULL ==
+        (batch_ud = (H5_daos_chunk_task_batch_ud_t *)DV_calloc(sizeof(H5_daos_chunk_task_batch_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for batch I/O arguments");
+    batch_ud->req     = req;
+    batch_ud->dset    = dset;
+    batch_ud->nchunks = nchunks;
+
+    /* Allocate argument structs for all chunks in the batch */
+    if (NULL == (batch_ud->chunk_io_uds =
+                     (H5_daos_chunk_io_ud_t *)DV_calloc(nchunks * sizeof(H5_daos_chunk_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    for (i = 0; i < nchunks; i++) {
+        batch_ud->chunk_io_uds[i].recxs   = &batch_ud->chunk_io_uds[i].recx;
+        batch_ud->chunk_io_uds[i].sg_iovs = &batch_ud->chunk_io_uds[i].sg_iov;
+        batch_ud->chunk_io_uds[i].dset    = dset;
+        batch_ud->chunk_io_uds[i].req     = req;
+        batch_ud->chunk_io_uds[i].batch   = batch_ud;
+    } /* end for */
 
-    /* Setup selected chunk info buffer */
-    switch (dset->dcpl_cache.layout) {
-        case H5D_COMPACT:
-        case H5D_CONTIGUOUS:
-            dset->io_cache.chunk_info        = &dset->io_cache.single_chunk_info;
-            dset->io_cache.chunk_info_nalloc = 1;
-            break;
+    /* Set up dkeys, iods and sgls for all chunks, and handle fill values */
+    for (i = 0; i < nchunks; i++)
+        if (H5_daos_chunk_io_setup_types_equal(&chunk_info[i], dset, dset_ndims, io_type, buf,
+                                               &batch_ud->chunk_io_uds[i]) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
+
+    /* Create metatask for the batch.  This empty task will be completed by
+     * H5_daos_chunk_task_batch_comp_cb when the last I/O task in the batch
+     * completes. */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &batch_ud->io_metatask) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create metatask for batch I/O");
+
+    /* Schedule metatask */
+    if (0 != (ret = tse_task_schedule(batch_ud->io_metatask, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule metatask for batch I/O: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Create and schedule I/O tasks for all chunks with a selection */
+    for (i = 0; i < nchunks; i++) {
+        if (batch_ud->chunk_io_uds[i].iod.iod_nr == 0)
+            continue;
+
+        if (H5_daos_create_daos_task(daos_op, 1, dep_task, H5_daos_chunk_io_prep_cb,
+                                     H5_daos_chunk_task_batch_comp_cb, &batch_ud->chunk_io_uds[i],
+                                     &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
+                         (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
 
-        case H5D_CHUNKED:
-            dset->io_cache.chunk_info        = NULL;
-            dset->io_cache.chunk_info_nalloc = 0;
-            break;
+        if (0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task: %s",
+                         H5_daos_err_to_string(ret));
+        batch_ud->nio_left++;
+    } /* end for */
 
-        case H5D_LAYOUT_ERROR:
-        case H5D_NLAYOUTS:
-        case H5D_VIRTUAL:
-        default:
-            D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset has invalid storage layout type");
-    } /* end switch */
+done:
+    if (batch_ud) {
+        if (batch_ud->nio_left > 0) {
+            /* Tasks will be run, give the batch a reference to req and the
+             * dataset.  The last task to complete will free batch_ud. */
+            req->rc++;
+            dset->obj.item.rc++;
+            *dep_task = batch_ud->io_metatask;
+        } /* end if */
+        else {
+            /* No I/O tasks were scheduled, complete the metatask (if any) and
+             * clean up here */
+            if (batch_ud->io_metatask) {
+                if (H5_daos_task_list_put(H5_daos_task_list_g, batch_ud->io_metatask) < 0)
+                    D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+                tse_task_complete(batch_ud->io_metatask, ret_value < 0 ? -H5_DAOS_SETUP_ERROR : 0);
+                *dep_task = batch_ud->io_metatask;
+            } /* end if */
 
-    dset->io_cache.filled = TRUE;
+            if (batch_ud->chunk_io_uds) {
+                for (i = 0; i < nchunks; i++) {
+                    if (batch_ud->chunk_io_uds[i].recxs != &batch_ud->chunk_io_uds[i].recx)
+                        DV_free(batch_ud->chunk_io_uds[i].recxs);
+                    if (batch_ud->chunk_io_uds[i].sg_iovs != &batch_ud->chunk_io_uds[i].sg_iov)
+                        DV_free(batch_ud->chunk_io_uds[i].sg_iovs);
+                } /* end for */
+                DV_free(batch_ud->chunk_io_uds);
+            } /* end if */
+            batch_ud = DV_free(batch_ud);
+        } /* end else */
+    }     /* end if */
 
-done:
     D_FUNC_LEAVE;
-} /* end H5_daos_dset_fill_io_cache() */
+} /* end H5_daos_dataset_io_types_equal_task_batch() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dset_io_int_task
+ * Function:    H5_daos_chunk_io_tconv_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O with type conversion.
  *
- * Purpose:     Asynchronous version of H5Dread()/H5Dwrite().
- *`
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              October, 2020
- *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_dset_io_int_task(tse_task_t *task)
+H5_daos_chunk_io_tconv_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_io_task_ud_t *udata      = NULL;
-    tse_task_t           *first_task = NULL;
-    tse_task_t           *dep_task   = NULL;
-    htri_t                need_tconv;
-    int                   ret;
-    int                   ret_value = 0;
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t         *update_args;
+    int                    ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for dataset I/O task");
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    assert(udata->end_task);
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
 
-    /* Handle errors in previous tasks */
-    H5_DAOS_PREP_REQ(udata->req, H5E_DATASET);
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
 
-    /* Check if datatype conversion is needed */
-    if ((need_tconv = H5_daos_need_tconv(udata->dset->file_type_id, udata->mem_type_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, -H5_DAOS_H5_GET_ERROR,
-                     "can't check if type conversion is needed");
+    /* If writing, gather the write buffer data to the type conversion buffer */
+    if (udata->tconv.io_type == IO_WRITE) {
+        /* Gather data to conversion buffer */
+        if (H5Dgather(udata->tconv.mem_space_id, udata->tconv.buf, udata->tconv.mem_type_id,
+                      (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size, udata->tconv.tconv_buf,
+                      NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                         "can't gather data to conversion buffer");
 
-    /* Call actual I/O routine */
-    switch (udata->io_type) {
-        case IO_READ:
-            if (H5_daos_dataset_read_int(udata->dset, udata->mem_type_id, udata->mem_space_id,
-                                         udata->file_space_id, need_tconv, udata->buf.rbuf, udata->end_task,
-                                         udata->req, &first_task, &dep_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_GET_ERROR,
-                             "failed to read data from dataset");
-            break;
+        /* Perform type conversion, using the connector-native routine if
+         * there is one */
+        if (udata->tconv.native.func)
+            udata->tconv.native.func(&udata->tconv.native, udata->tconv.tconv_buf, udata->tconv.tconv_buf,
+                                     (size_t)udata->tconv.num_elem);
+        else if (H5Tconvert(udata->tconv.mem_type_id, udata->dset->file_type_id,
+                            (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf,
+                            udata->req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                         "can't perform type conversion");
+    } /* end if */
 
-        case IO_WRITE:
-            if (H5_daos_dataset_write_int(udata->dset, udata->mem_type_id, udata->mem_space_id,
-                                          udata->file_space_id, need_tconv, udata->buf.wbuf, udata->end_task,
-                                          udata->req, &first_task, &dep_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_COPY_ERROR,
-                             "failed to write data to dataset");
-            break;
-    } /* end switch */
+    /* Set sg_iov to point to tconv_buf */
+    daos_iov_set(&udata->sg_iov, udata->tconv.tconv_buf,
+                 (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+
+    /* Set I/O task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->dset->obj.obj_oh;
+    update_args->th   = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr   = 1;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_tconv_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_tconv_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for raw data I/O with type conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_io_tconv_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    int                    ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->req->file);
+    assert(udata->dset);
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "raw data I/O";
+    } /* end if */
+
+    /* If reading we must perform type conversion on the read data */
+    if (udata->tconv.io_type == IO_READ) {
+        if (udata->tconv.job.conv) {
+            /* The type conversion worker pool has already converted the data,
+             * unless the fetch failed */
+            if (task->dt_result != 0)
+                D_GOTO_DONE(0);
+        } /* end if */
+        else if (udata->tconv.native.func)
+            /* Use the connector-native conversion routine */
+            udata->tconv.native.func(&udata->tconv.native, udata->tconv.tconv_buf, udata->tconv.tconv_buf,
+                                     (size_t)udata->tconv.num_elem);
+        else {
+            H5_daos_blob_prefetch_t prefetch;
+            herr_t                  conv_ret;
+
+            /* Fetch the sequences of any variable-length data in a batch */
+            if (H5_daos_blob_prefetch(udata->req->file, udata->dset->file_type_id, udata->tconv.tconv_buf,
+                                      (size_t)udata->tconv.num_elem, &prefetch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't prefetch variable-length data");
+
+            /* Perform type conversion */
+            conv_ret = H5Tconvert(udata->dset->file_type_id, udata->tconv.mem_type_id,
+                                  (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf,
+                                  udata->req->dxpl_id);
+
+            /* Release the prefetched sequences */
+            if (H5_daos_blob_prefetch_release(udata->req->file, &prefetch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTFREE, -H5_DAOS_FREE_ERROR,
+                             "can't release prefetched variable-length data");
+            if (conv_ret < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't perform type conversion");
+        } /* end else */
+
+        /* Scatter data to memory buffer if necessary */
+        if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV) {
+            H5_daos_scatter_cb_ud_t scatter_cb_ud;
+
+            scatter_cb_ud.buf = udata->tconv.tconv_buf;
+            scatter_cb_ud.len = (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size;
+            if (H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->tconv.mem_type_id,
+                           udata->tconv.mem_space_id, udata->tconv.buf) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                             "can't scatter data to read buffer");
+        } /* end if */
+    }     /* end if */
 
 done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
     if (udata) {
-        /* Schedule first task */
-        if (first_task && (0 != (ret = tse_task_schedule(first_task, false))))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule final task for dataset I/O: %s",
-                         H5_daos_err_to_string(ret));
+        /* Close dataset */
+        if (H5_daos_dataset_close_real(udata->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Close space and type IDs */
+        if (H5Sclose(udata->tconv.mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                         "can't close memory dataspace");
+        if (H5Tclose(udata->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
 
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
          * H5_daos_req_free_int, which updates req->status if it sees an error */
         if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
             udata->req->status      = ret_value;
-            udata->req->failed_task = "dataset I/O task";
+            udata->req->failed_task = "raw data I/O completion callback";
         } /* end if */
-    }     /* end if */
-    else {
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
-        assert(!first_task);
-    } /* end else */
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
+        /* Free private data */
+        if (udata->recxs != &udata->recx)
+            DV_free(udata->recxs);
+        if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+            DV_free(udata->tconv.tconv_buf);
+        if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
+            DV_free(udata->tconv.bkg_buf);
+        DV_free(udata);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dset_io_int_task() */
+} /* end H5_daos_chunk_io_tconv_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dset_io_int_end_task
+ * Function:    H5_daos_chunk_io_tconv_fetch_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch for raw
+ *              data reads where type conversion is performed by the type
+ *              conversion worker pool.  Does not free data, will be freed
+ *              by H5_daos_chunk_io_tconv_comp_cb().
  *
- * Purpose:     Finalizes an asynchronous I/O task.
- *`
  * Return:      Success:        0
  *              Failure:        Error code
  *
- * Programmer:  Neil Fortner
- *              October, 2020
- *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_dset_io_int_end_task(tse_task_t *task)
+H5_daos_chunk_io_tconv_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_io_task_ud_t *udata     = NULL;
-    int                   ret_value = 0;
+    H5_daos_chunk_io_ud_t *udata;
+    int                    ret_value = 0;
+
+    assert(H5_daos_task_list_g);
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for dataset I/O task");
-
-    assert(task == udata->end_task);
-
-    /* Handle errors in previous tasks */
-    H5_DAOS_PREP_REQ_DONE(udata->req);
-
-    /* Free IDs */
-    if (H5Tclose(udata->mem_type_id) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
-    if (udata->mem_space_id != H5S_ALL && H5Sclose(udata->mem_space_id) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory dataspace");
-    if (udata->file_space_id != H5S_ALL && H5Sclose(udata->file_space_id) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file dataspace");
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    /* Close dataset */
-    if (H5_daos_dataset_close_real(udata->dset) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
-                     "can't close dataset used for I/O");
+    assert(udata->req);
 
-    /* Handle errors in this function */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->req->status      = ret_value;
-        udata->req->failed_task = "dataset I/O end task";
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "raw data I/O";
     } /* end if */
 
-    /* Release our reference to req */
-    if (H5_daos_req_free_int(udata->req) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-    /* Free udata */
-    udata = DV_free(udata);
-
 done:
     /* Return task to task list */
     if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
-
     D_FUNC_LEAVE;
-} /* end H5_daos_dset_io_int_end_task() */
+} /* end H5_daos_chunk_io_tconv_fetch_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_read_int
+ * Function:    H5_daos_chunk_io_tconv_pool_task
  *
- * Purpose:     Internal version of H5_daos_dataset_read().
- *`
- * Return:      Success:        0
- *              Failure:        -1, dataset not read.
+ * Purpose:     Asynchronous task that hands the type conversion of a
+ *              chunk just fetched from DAOS to the type conversion worker
+ *              pool, so later chunk fetches can proceed while it runs.
+ *              This task is completed by the progress functions once the
+ *              pool has finished the conversion.
  *
- * Programmer:  Neil Fortner
- *              July. 2020
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_read_int(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
-                         htri_t need_tconv, void *buf, tse_task_t *_end_task, H5_daos_req_t *req,
-                         tse_task_t **first_task, tse_task_t **dep_task)
+static int
+H5_daos_chunk_io_tconv_pool_task(tse_task_t *task)
 {
-    H5_daos_select_chunk_info_t *chunk_info = NULL; /* Array of info for each chunk selected in the file */
-    H5_daos_chunk_io_func        single_chunk_read_func;
-    uint64_t                     i;
-    size_t                       nchunks_sel;
-    hid_t                        real_file_space_id;
-    hid_t                        real_mem_space_id;
-    int                          ndims;
-    hssize_t                     num_elem_file = -1, num_elem_mem;
-    tse_task_t                  *io_task       = NULL;
-    tse_task_t                  *end_task      = _end_task;
-    int                          ret;
-    herr_t                       ret_value = SUCCEED;
+    H5_daos_chunk_io_ud_t *udata;
+    int                    ret_value = 0;
 
-    assert(dset);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for type conversion task");
 
-    /* Get dataspace extent */
-    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    assert(udata->req);
+    assert(udata->tconv.job.conv);
 
-    /* Get "real" space ids */
-    if (file_space_id == H5S_ALL)
-        real_file_space_id = dset->space_id;
-    else
-        real_file_space_id = file_space_id;
-    if (mem_space_id == H5S_ALL)
-        real_mem_space_id = real_file_space_id;
-    else
-        real_mem_space_id = mem_space_id;
-
-    /* Get number of elements in selections */
-    if ((num_elem_file = H5Sget_select_npoints(real_file_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in file selection");
-    if ((num_elem_mem = H5Sget_select_npoints(real_mem_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in memory selection");
-
-    /* Various sanity and special case checks */
-    if (num_elem_file != num_elem_mem)
-        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
-                     "number of elements selected in file and memory dataspaces is different");
-    if (num_elem_file && !buf)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "read buffer is NULL but selection has >0 elements");
-    if (num_elem_file == 0)
-        D_GOTO_DONE(SUCCEED);
-
-    /* Fill dataset I/O cache if it hasn't already been filled */
-    if (!dset->io_cache.filled && H5_daos_dset_fill_io_cache(dset, real_file_space_id, real_mem_space_id) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize dataset I/O cache");
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
 
-    /* Check for the dataset having a chunked storage layout. If it does not,
-     * simply set up the dataset as a single "chunk".
-     */
-    switch (dset->dcpl_cache.layout) {
-        case H5D_COMPACT:
-        case H5D_CONTIGUOUS:
-            chunk_info  = dset->io_cache.chunk_info;
-            nchunks_sel = 1;
+    /* Queue the conversion in place in the type conversion buffer */
+    udata->tconv.job.src   = udata->tconv.tconv_buf;
+    udata->tconv.job.dst   = udata->tconv.tconv_buf;
+    udata->tconv.job.nelem = (size_t)udata->tconv.num_elem;
+    udata->tconv.job.task  = task;
+    if (H5_daos_tconv_pool_submit(&udata->tconv.job) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                     "can't submit type conversion job");
 
-            /* Set up "single-chunk dataset", with the "chunk" starting at coordinate 0 */
-            chunk_info->fspace_id         = real_file_space_id;
-            chunk_info->mspace_id         = real_mem_space_id;
-            chunk_info->num_elem_sel_file = num_elem_file;
-            memset(chunk_info->chunk_coords, 0, sizeof(chunk_info->chunk_coords));
+    /* This task will be completed by the progress function once the worker
+     * pool has performed the conversion */
 
-            break;
+done:
+    if (ret_value < 0) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
 
-        case H5D_CHUNKED:
-            /* Get the coordinates of the currently selected chunks in the file, setting up memory and file
-             * dataspaces for them */
-            if (H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
-                                                &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc,
-                                                &nchunks_sel) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
-            chunk_info = dset->io_cache.chunk_info;
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end if */
 
-            break;
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_tconv_pool_task() */
 
-        case H5D_LAYOUT_ERROR:
-        case H5D_NLAYOUTS:
-        case H5D_VIRTUAL:
-        default:
-            D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
-                         "invalid, unknown or unsupported dataset storage layout type");
-    } /* end switch */
-    assert(nchunks_sel > 0);
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_fill_bkg_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for filling background buffer for type
+ *              conversion.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_fill_bkg_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t         *update_args;
+    int                    ret_value = 0;
 
-    /* Setup the appropriate function for reading the selected chunks */
-    if (need_tconv)
-        /* Type conversion necessary */
-        single_chunk_read_func = H5_daos_dataset_io_types_unequal;
-    else
-        /* No type conversion necessary */
-        single_chunk_read_func = H5_daos_dataset_io_types_equal;
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    /* Set up coordination metatasks if there is more than one chunk selected */
-    if (nchunks_sel > 1) {
-        /* Set up empty first task for coordination if there isn't one already */
-        if (!*first_task) {
-            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, first_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create first metatask for dataset read");
-            *dep_task = *first_task;
-        } /* end if */
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->req->file);
 
-        /* Set up empty end task for coordination if not already provided */
-        if (!end_task) {
-            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &end_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create last metatask for dataset read");
-        }
-    } /* end if */
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
 
-    /* Perform I/O on each chunk selected */
-    for (i = 0; i < nchunks_sel; i++) {
-        io_task = *dep_task;
-        if (single_chunk_read_func(&chunk_info[i], dset, (uint64_t)ndims, mem_type_id, IO_READ, buf, req,
-                                   first_task, &io_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
+    /* Set sg_iov to point to background buffer */
+    daos_iov_set(&udata->sg_iov, udata->tconv.bkg_buf,
+                 (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
 
-        /* Set up dependency on io_task for end task */
-        assert(io_task);
-        if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O task: %s",
-                         H5_daos_err_to_string(ret));
-    } /* end for */
+    /* Set I/O task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->dset->obj.obj_oh;
+    update_args->th   = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr   = 1;
+    update_args->iods = &udata->iod;
+    update_args->sgls = &udata->sgl;
 
 done:
-    /* Schedule end_task if appropriate and update *dep_task */
-    if (end_task) {
-        if (0 != (ret = tse_task_schedule(end_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for IO operation: %s",
-                         H5_daos_err_to_string(ret));
-        *dep_task = end_task;
-    } /* end if */
-    else
-        *dep_task = io_task;
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_read_int() */
+} /* end H5_daos_chunk_fill_bkg_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_read
+ * Function:    H5_daos_chunk_fill_bkg_comp_cb
  *
- * Purpose:     Reads raw data from a dataset into a buffer.
- *`
- * Return:      Success:        0
- *              Failure:        -1, dataset not read.
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_fetch for filling background buffer for type
+ *              conversion.  Does not free data, will be freed by
+ *              H5_daos_chunk_io_tconv_comp_cb().
  *
- * Programmer:  Neil Fortner
- *              November, 2016
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-#if H5VL_VERSION >= 3
-herr_t
-H5_daos_dataset_read(size_t count, void *_dset[], hid_t mem_type_id[], hid_t mem_space_id[],
-                     hid_t file_space_id[], hid_t dxpl_id, void *buf[], void **req)
-#else
-herr_t
-H5_daos_dataset_read(void *_dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
-                     void *buf, void **req)
-#endif
+static int
+H5_daos_chunk_fill_bkg_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_dset_t       *dset       = NULL;
-    H5_daos_io_task_ud_t *task_ud    = NULL;
-    tse_task_t           *io_task    = NULL;
-    tse_task_t           *first_task = NULL;
-    tse_task_t           *dep_task   = NULL;
-    H5_daos_req_t        *int_req    = NULL;
-    htri_t                need_tconv = FALSE;
-    hid_t                 req_dxpl_id;
-    hid_t                 local_mem_type_id   = H5I_INVALID_HID;
-    hid_t                 local_mem_space_id  = H5I_INVALID_HID;
-    hid_t                 local_file_space_id = H5I_INVALID_HID;
-    void                 *local_buf           = NULL;
-    int                   ret;
-    herr_t                ret_value = SUCCEED;
-
-    H5_daos_inc_api_cnt();
-
-    /* Set convenience variables to handle VOL structure versioning */
-#if H5VL_VERSION >= 3
-    dset                = (H5_daos_dset_t *)_dset[0];
-    local_mem_type_id   = mem_type_id[0];
-    local_mem_space_id  = mem_space_id[0];
-    local_file_space_id = file_space_id[0];
-    local_buf           = buf[0];
-#else
-    dset                = (H5_daos_dset_t *)_dset;
-    local_mem_type_id   = mem_type_id;
-    local_mem_space_id  = mem_space_id;
-    local_file_space_id = file_space_id;
-    local_buf           = buf;
-#endif
+    H5_daos_chunk_io_ud_t *udata;
+    int                    ret_value = 0;
 
-    if (!dset)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
-    if (H5I_DATASET != dset->obj.item.type)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+    assert(H5_daos_task_list_g);
 
-#if H5VL_VERSION >= 3
-    if (count != 1)
-        D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "multi-dataset I/O is currently unsupported");
-#endif
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+    assert(udata);
+    assert(udata->req);
+    assert(udata->req->file);
 
-    /* If the dataset's datatype is complete, check if type conversion is needed
-     */
-    if (dset->obj.item.open_req->status == 0 || dset->obj.item.created) {
-        /* Check if datatype conversion is needed */
-        if ((need_tconv = H5_daos_need_tconv(dset->file_type_id, local_mem_type_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
-        req_dxpl_id = need_tconv ? dxpl_id : H5P_DATASET_XFER_DEFAULT;
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "background buffer fill (daos_obj_fetch) for raw data write";
     } /* end if */
-    else
-        req_dxpl_id = dxpl_id;
 
-    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-    if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset read", dset->obj.item.open_req,
-                                              NULL, NULL, req_dxpl_id)))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    /* Reset iod_size, if the dataset was not allocated then it could
+     * have been overwritten by daos_obj_fetch */
+    udata->iod.iod_size = udata->tconv.file_type_size;
 
-    /* Check if we can call the internal routine directly -  the dataset open
-     * must be complete and there must not be an in-flight set_extent. */
-    if ((dset->obj.item.open_req->status == 0) && (dset->cur_set_extent_space_id == H5I_INVALID_HID)) {
-        /* Call internal routine */
-        if (H5_daos_dataset_read_int(dset, local_mem_type_id, local_mem_space_id, local_file_space_id,
-                                     need_tconv, local_buf, NULL, int_req, &first_task, &dep_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from dataset");
-    } /* end if */
-    else {
-        /* Allocate argument struct */
-        if (NULL == (task_ud = (H5_daos_io_task_ud_t *)DV_calloc(sizeof(H5_daos_io_task_ud_t))))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for I/O task udata struct");
-        task_ud->req           = int_req;
-        task_ud->io_type       = IO_READ;
-        task_ud->dset          = dset;
-        task_ud->mem_type_id   = H5I_INVALID_HID;
-        task_ud->mem_space_id  = H5I_INVALID_HID;
-        task_ud->file_space_id = H5I_INVALID_HID;
-        task_ud->buf.rbuf      = local_buf;
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-        /* Copy dataspaces and datatype */
-        if ((task_ud->mem_type_id = H5Tcopy(local_mem_type_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory type ID");
-        if (local_mem_space_id == H5S_ALL)
-            task_ud->mem_space_id = H5S_ALL;
-        else if ((task_ud->mem_space_id = H5Scopy(local_mem_space_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory space ID");
-        if (local_file_space_id == H5S_ALL)
-            task_ud->file_space_id = H5S_ALL;
-        else if ((task_ud->file_space_id = H5Scopy(local_file_space_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file space ID");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_fill_bkg_comp_cb() */
 
-        /* Create end task for reading data */
-        if (H5_daos_create_task(H5_daos_dset_io_int_end_task, 0, NULL, NULL, NULL, task_ud,
-                                &task_ud->end_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                         "can't create task to finish performing I/O operation");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_io_setup_types_unequal
+ *
+ * Purpose:     Sets up the dkey, iod and type conversion fields in
+ *              chunk_io_ud for I/O on a single chunk where the memory
+ *              datatype does not match the dataset's datatype, gathers
+ *              the background buffer and writes fill values to the type
+ *              conversion buffer for reads.  chunk_io_ud->recxs must
+ *              point to a (probably statically allocated) single
+ *              element.  If there is no selection in the chunk,
+ *              chunk_io_ud->iod.iod_nr is set to 0.  Does not release
+ *              buffers or IDs on error.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_io_setup_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                     uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+                                     void *buf, H5_daos_chunk_io_ud_t *chunk_io_ud)
+{
+    hbool_t  contig = FALSE;
+    size_t   tot_nseq;
+    uint64_t i;
+    uint8_t *p;
+    herr_t   ret_value = SUCCEED;
 
-        /* Create task to read data */
-        if (H5_daos_create_task(H5_daos_dset_io_int_task, 0, NULL, NULL, NULL, task_ud, &io_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform I/O operation");
+    assert(chunk_info);
+    assert(dset);
+    assert(chunk_io_ud);
+    assert(chunk_io_ud->recxs);
 
-        /* Save task to be scheduled later and give it a reference to req and
-         * dset */
-        assert(!first_task);
-        first_task = io_task;
-        dep_task   = task_ud->end_task;
-        dset->obj.item.rc++;
-        int_req->rc++;
-        task_ud = NULL;
-    } /* end else */
+    /* Setup type conversion-related fields */
+    chunk_io_ud->tconv.num_elem = chunk_info->num_elem_sel_file;
+    if ((chunk_io_ud->tconv.mem_type_id = H5Tcopy(mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+    if ((chunk_io_ud->tconv.mem_space_id = H5Scopy(chunk_info->mspace_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
+    chunk_io_ud->tconv.buf     = buf;
+    chunk_io_ud->tconv.io_type = io_type;
+    assert(chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_NONE);
 
-done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
+    /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid accidental
+     * collisions with other d-keys in this object.
+     */
+    p    = chunk_io_ud->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for (i = 0; i < dset_ndims; i++)
+        UINT64ENCODE(p, chunk_info->chunk_coords[i]);
 
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
+    /* Set up dkey */
+    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+                 (daos_size_t)(1 + ((size_t)dset_ndims * sizeof(chunk_info->chunk_coords[0]))));
 
-        /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_READ,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+    if (io_type == IO_READ) {
+        size_t  nseq_tmp;
+        size_t  nelem_tmp;
+        hsize_t sel_off;
+        size_t  sel_len;
 
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
+        /* Reset memory selection iterator for current memory dataspace */
+        if (H5Ssel_iter_reset(dset->io_cache.mem_sel_iter_id, chunk_info->mspace_id) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTRESET, FAIL, "can't reset file dataspace selection iterator");
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        /* Get the sequence list - only check the first sequence because we only
+         * care if it is contiguous and if so where the contiguous selection
+         * begins */
+        if (H5Ssel_iter_get_seq_list(dset->io_cache.mem_sel_iter_id, (size_t)1, (size_t)-1, &nseq_tmp,
+                                     &nelem_tmp, &sel_off, &sel_len) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "sequence length generation failed");
+        contig = (sel_len == (size_t)chunk_info->num_elem_sel_file);
+
+        /* Initialize type conversion */
+        if (H5_daos_tconv_init(dset->file_type_id, &chunk_io_ud->tconv.file_type_size, mem_type_id,
+                               &chunk_io_ud->tconv.mem_type_size, (size_t)chunk_info->num_elem_sel_file,
+                               dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL, FALSE,
+                               &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf,
+                               contig ? &chunk_io_ud->tconv.reuse : NULL, &chunk_io_ud->tconv.fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+        /* Reuse buffer as appropriate */
+        if (contig) {
+            sel_off *= (hsize_t)chunk_io_ud->tconv.mem_type_size;
+            if (chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
+                chunk_io_ud->tconv.tconv_buf = (char *)buf + (size_t)sel_off;
+            else if (chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_BKG)
+                chunk_io_ud->tconv.bkg_buf = (char *)buf + (size_t)sel_off;
         } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    }     /* end (io_type == IO_READ) */
+    else
+        /* Initialize type conversion */
+        if (H5_daos_tconv_init(mem_type_id, &chunk_io_ud->tconv.mem_type_size, dset->file_type_id,
+                               &chunk_io_ud->tconv.file_type_size, (size_t)chunk_info->num_elem_sel_file,
+                               FALSE, TRUE, &chunk_io_ud->tconv.tconv_buf, &chunk_io_ud->tconv.bkg_buf, NULL,
+                               &chunk_io_ud->tconv.fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
 
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "dataset read failed in task \"%s\": %s",
-                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
+    /* Set up iod */
+    memset(&chunk_io_ud->iod, 0, sizeof(chunk_io_ud->iod));
+    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+                 (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->iod.iod_size = (daos_size_t)chunk_io_ud->tconv.file_type_size;
+    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
 
-            /* Release our reference to the internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
-    }     /* end if */
+    /* Build recxs and sg_iovs */
 
-    /* Cleanup on error */
-    if (task_ud) {
-        assert(ret_value < 0);
-        if (task_ud->mem_type_id >= 0 && H5Tclose(task_ud->mem_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
-        if (task_ud->mem_space_id >= 0 && task_ud->mem_space_id != H5S_ALL &&
-            H5Sclose(task_ud->mem_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
-        if (task_ud->file_space_id >= 0 && task_ud->file_space_id != H5S_ALL &&
-            H5Sclose(task_ud->file_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
-        task_ud = DV_free(task_ud);
-    } /* end if */
+    /* Calculate recxs from file space */
+    if (H5_daos_sel_to_recx_iov(dset, chunk_info->fspace_id, dset->io_cache.file_sel_iter_id,
+                                chunk_io_ud->tconv.file_type_size, buf, &chunk_io_ud->recxs, NULL,
+                                &tot_nseq) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+    chunk_io_ud->iod.iod_nr    = (unsigned)tot_nseq;
+    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
 
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_read() */
+    /* No selection in the file */
+    if (chunk_io_ud->iod.iod_nr == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Set up constant sgl info */
+    chunk_io_ud->sgl.sg_nr     = 1;
+    chunk_io_ud->sgl.sg_nr_out = 0;
+    chunk_io_ud->sgl.sg_iovs   = &chunk_io_ud->sg_iov;
+
+    if (io_type == IO_READ) {
+        /* Gather data to background buffer if necessary */
+        if (chunk_io_ud->tconv.fill_bkg && (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG))
+            if (H5Dgather(chunk_info->mspace_id, buf, mem_type_id,
+                          (size_t)chunk_info->num_elem_sel_file * chunk_io_ud->tconv.mem_type_size,
+                          chunk_io_ud->tconv.bkg_buf, NULL, NULL) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't gather data to background buffer");
+
+        /* Handle fill values */
+        if (dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL) {
+            /* H5_daos_tconv_init() will have cleared the tconv buf, but not if
+             * we're reusing buf as tconv_buf */
+            if (chunk_io_ud->tconv.reuse == H5_DAOS_TCONV_REUSE_TCONV)
+                (void)memset(chunk_io_ud->tconv.tconv_buf, 0,
+                             (daos_size_t)chunk_info->num_elem_sel_file *
+                                 (daos_size_t)chunk_io_ud->tconv.file_type_size);
+        } /* end if */
+        else if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+            assert(dset->fill_val);
+
+            /* Copy the fill value to every element in tconv_buf */
+            H5_daos_fill_pattern(chunk_io_ud->tconv.tconv_buf,
+                                 (size_t)chunk_info->num_elem_sel_file * chunk_io_ud->tconv.file_type_size,
+                                 dset->fill_val, chunk_io_ud->tconv.file_type_size);
+        } /* end if */
+    }     /* end (io_type == IO_READ) */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_io_setup_types_unequal() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_write_int
+ * Function:    H5_daos_dataset_io_types_unequal
  *
- * Purpose:     Internal version of H5_daos_dataset_write().
+ * Purpose:     Internal helper routine to perform I/O on a dataset
+ *              composed of a non-variable-length datatype where the
+ *              datatype specified for the memory buffer doesn't match the
+ *              dataset's datatype. In this case, datatype conversion must
+ *              be performed.
  *
  * Return:      Success:        0
- *              Failure:        -1, dataset not written.
+ *              Failure:        -1, dataset I/O not performed.
  *
  * Programmer:  Neil Fortner
- *              July, 2020
+ *              November, 2016
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_write_int(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
-                          htri_t need_tconv, const void *buf, tse_task_t *_end_task, H5_daos_req_t *req,
-                          tse_task_t **first_task, tse_task_t **dep_task)
+static herr_t
+H5_daos_dataset_io_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                 uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type, void *buf,
+                                 H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
-    H5_daos_select_chunk_info_t *chunk_info = NULL; /* Array of info for each chunk selected in the file */
-    H5_daos_chunk_io_func        single_chunk_write_func;
-    uint64_t                     i;
-    size_t                       nchunks_sel;
-    hid_t                        real_file_space_id;
-    hid_t                        real_mem_space_id;
-    int                          ndims;
-    hssize_t                     num_elem_file = -1, num_elem_mem;
-    tse_task_t                  *io_task       = NULL;
-    tse_task_t                  *end_task      = _end_task;
-    int                          ret;
-    herr_t                       ret_value = SUCCEED;
+    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
+    daos_opc_t             daos_op;
+    tse_task_cb_t          prep_cb;
+    tse_task_cb_t          comp_cb;
+    tse_task_t            *io_task       = NULL;
+    tse_task_t            *fill_bkg_task = NULL;
+    tse_task_t            *tconv_task    = NULL;
+    int                    ret;
+    herr_t                 ret_value = SUCCEED;
 
+    assert(chunk_info);
     assert(dset);
     assert(req);
     assert(first_task);
     assert(dep_task);
-    assert(dset->obj.item.file->flags & H5F_ACC_RDWR);
 
-    /* Get dataspace extent */
-    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    /* Allocate argument struct */
+    if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    chunk_io_ud->tconv.mem_type_id  = H5I_INVALID_HID;
+    chunk_io_ud->tconv.mem_space_id = H5I_INVALID_HID;
+    chunk_io_ud->recxs              = &chunk_io_ud->recx;
 
-    /* Get "real" space ids */
-    if (file_space_id == H5S_ALL)
-        real_file_space_id = dset->space_id;
-    else
-        real_file_space_id = file_space_id;
-    if (mem_space_id == H5S_ALL)
-        real_mem_space_id = real_file_space_id;
-    else
-        real_mem_space_id = mem_space_id;
+    /* Point to dset */
+    chunk_io_ud->dset = dset;
 
-    /* Get number of elements in selections */
-    if ((num_elem_file = H5Sget_select_npoints(real_file_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in file selection");
-    if ((num_elem_mem = H5Sget_select_npoints(real_mem_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in memory selection");
+    /* Point to req */
+    chunk_io_ud->req = req;
 
-    /* Various sanity and special case checks */
-    if (num_elem_file != num_elem_mem)
-        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
-                     "number of elements selected in file and memory dataspaces is different");
-    if (num_elem_file && !buf)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write buffer is NULL but selection has >0 elements");
-    if (num_elem_file == 0)
-        D_GOTO_DONE(SUCCEED);
+    /* Check for a connector-native conversion routine */
+    if (H5_daos_tconv_get_native(io_type == IO_READ ? dset->file_type_id : mem_type_id,
+                                 io_type == IO_READ ? mem_type_id : dset->file_type_id, req->dxpl_id,
+                                 &chunk_io_ud->tconv.native) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't look up native type conversion routine");
+
+    if (io_type == IO_READ && chunk_io_ud->tconv.native.func &&
+        chunk_io_ud->tconv.native.src_size == chunk_io_ud->tconv.native.dst_size) {
+        /* The element sizes match, so read directly into the memory buffer
+         * as if no conversion were needed, then convert the data in place
+         * there in H5_daos_chunk_io_comp_cb().  No type conversion buffer is
+         * needed. */
+        chunk_io_ud->sg_iovs       = &chunk_io_ud->sg_iov;
+        chunk_io_ud->tconv.io_type = IO_READ;
+        if (H5_daos_chunk_io_setup_types_equal(chunk_info, dset, dset_ndims, io_type, buf, chunk_io_ud) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
+        prep_cb = H5_daos_chunk_io_prep_cb;
+        comp_cb = H5_daos_chunk_io_comp_cb;
+    } /* end if */
+    else {
+        /* Set up dkey, iod and type conversion, and handle fill values */
+        if (H5_daos_chunk_io_setup_types_unequal(chunk_info, dset, dset_ndims, mem_type_id, io_type, buf,
+                                                 chunk_io_ud) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
+        prep_cb = H5_daos_chunk_io_tconv_prep_cb;
+        comp_cb = H5_daos_chunk_io_tconv_comp_cb;
+
+        /* Hand reads with a native conversion routine to the type conversion
+         * worker pool if there is one */
+        if (io_type == IO_READ && chunk_io_ud->tconv.native.func && H5_daos_tconv_nthreads_g > 0) {
+            chunk_io_ud->tconv.job.conv = &chunk_io_ud->tconv.native;
+            comp_cb                     = H5_daos_chunk_io_tconv_fetch_comp_cb;
+        } /* end if */
+    }     /* end else */
 
-    /* Fill dataset I/O cache if it hasn't already been filled */
-    if (!dset->io_cache.filled && H5_daos_dset_fill_io_cache(dset, real_file_space_id, real_mem_space_id) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize dataset I/O cache");
+    /* No selection in the file */
+    if (chunk_io_ud->iod.iod_nr == 0)
+        D_GOTO_DONE(SUCCEED);
 
-    /* Check for the dataset having a chunked storage layout. If it does not,
-     * simply set up the dataset as a single "chunk".
-     */
-    switch (dset->dcpl_cache.layout) {
-        case H5D_COMPACT:
-        case H5D_CONTIGUOUS:
-            chunk_info  = dset->io_cache.chunk_info;
-            nchunks_sel = 1;
+    if (io_type == IO_READ)
+        /* Create task to read data from dataset */
+        daos_op = DAOS_OPC_OBJ_FETCH;
+    else {
+        /* Check if we need to fill background buffer */
+        if (chunk_io_ud->tconv.fill_bkg) {
+            assert(chunk_io_ud->tconv.bkg_buf);
 
-            /* Set up "single-chunk dataset", with the "chunk" starting at coordinate 0 */
-            chunk_info->fspace_id         = real_file_space_id;
-            chunk_info->mspace_id         = real_mem_space_id;
-            chunk_info->num_elem_sel_file = num_elem_file;
-            memset(chunk_info->chunk_coords, 0, sizeof(chunk_info->chunk_coords));
+            /* Create task to read data from dataset */
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                         H5_daos_chunk_fill_bkg_prep_cb, H5_daos_chunk_fill_bkg_comp_cb,
+                                         chunk_io_ud, &fill_bkg_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create task to read data to background buffer");
 
-            break;
+            /* Save bkg fill task to be scheduled later */
+            if (*first_task) {
+                if (0 != (ret = tse_task_schedule(fill_bkg_task, false)))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                                 "can't schedule background buffer fill task");
+            } /* end if */
+            else
+                *first_task = fill_bkg_task;
+            *dep_task = fill_bkg_task;
+        } /* end if */
 
-        case H5D_CHUNKED:
-            /* Get the coordinates of the currently selected chunks in the file, setting up memory and file
-             * dataspaces for them */
-            if (H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
-                                                &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc,
-                                                &nchunks_sel) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
-            chunk_info = dset->io_cache.chunk_info;
+        /* Create task to write data to dataset */
+        daos_op = DAOS_OPC_OBJ_UPDATE;
+    } /* end (io_type == IO_WRITE) */
 
-            break;
+    if (H5_daos_create_daos_task(daos_op, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, prep_cb, comp_cb,
+                                 chunk_io_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s data",
+                     (daos_op == DAOS_OPC_OBJ_FETCH) ? "read" : "write");
 
-        case H5D_LAYOUT_ERROR:
-        case H5D_NLAYOUTS:
-        case H5D_VIRTUAL:
-        default:
-            D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
-                         "invalid, unknown or unsupported dataset storage layout type");
-    } /* end switch */
-    assert(nchunks_sel > 0);
+    /* Create task to convert the data on the type conversion worker pool, if
+     * appropriate.  This task takes over finishing the chunk from the I/O
+     * task. */
+    if (chunk_io_ud->tconv.job.conv)
+        if (H5_daos_create_task(H5_daos_chunk_io_tconv_pool_task, 1, &io_task, NULL,
+                                H5_daos_chunk_io_tconv_comp_cb, chunk_io_ud, &tconv_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create type conversion task");
 
-    /* Setup the appropriate function for writing the selected chunks */
-    if (need_tconv)
-        /* Type conversion necessary */
-        single_chunk_write_func = H5_daos_dataset_io_types_unequal;
+    /* Schedule IO task (or save it to be scheduled later) */
+    if (*first_task) {
+        assert(*dep_task);
+        if (0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule dataset I/O task");
+    } /* end if */
     else
-        /* No type conversion necessary */
-        single_chunk_write_func = H5_daos_dataset_io_types_equal;
-
-    /* Set up coordination metatasks if there is more than one chunk selected */
-    if (nchunks_sel > 1) {
-        /* Set up empty first task for coordination if there isn't one already */
-        if (!*first_task) {
-            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, first_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                             "can't create first metatask for dataset write");
-            *dep_task = *first_task;
-        } /* end if */
+        *first_task = io_task;
+    *dep_task = io_task;
 
-        /* Set up empty end task for coordination if not already provided */
-        if (!end_task) {
-            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &end_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create last metatask for dataset write");
-        }
+    /* Schedule type conversion task */
+    if (tconv_task) {
+        if (0 != (ret = tse_task_schedule(tconv_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule type conversion task");
+        *dep_task = tconv_task;
     } /* end if */
 
-    /* Perform I/O on each chunk selected */
-    for (i = 0; i < nchunks_sel; i++) {
-        union {
-            const void *const_buf;
-            void       *buf;
-        } safe_buf = {.const_buf = buf};
-
-        io_task = *dep_task;
-        if (single_chunk_write_func(&chunk_info[i], dset, (uint64_t)ndims, mem_type_id, IO_WRITE,
-                                    safe_buf.buf, req, first_task, &io_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
-
-        /* Set up dependency on io_task for end task */
-        assert(io_task);
-        if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O task: %s",
-                         H5_daos_err_to_string(ret));
-    } /* end for */
+    /* Task will be scheduled, give it a reference to req and the dataset */
+    chunk_io_ud->req->rc++;
+    chunk_io_ud->dset->obj.item.rc++;
 
 done:
-    /* Schedule end_task if appropriate and update *dep_task */
-    if (end_task) {
-        if (0 != (ret = tse_task_schedule(end_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for IO operation: %s",
-                         H5_daos_err_to_string(ret));
-        *dep_task = end_task;
+    /* Cleanup on failure */
+    if (ret_value < 0 && chunk_io_ud && !fill_bkg_task) {
+        if (chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if (chunk_io_ud->tconv.mem_space_id >= 0 && H5Sclose(chunk_io_ud->tconv.mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        if (chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if (chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
+            DV_free(chunk_io_ud->sg_iovs);
+        if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+            chunk_io_ud->tconv.tconv_buf = DV_free(chunk_io_ud->tconv.tconv_buf);
+        if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
+            chunk_io_ud->tconv.bkg_buf = DV_free(chunk_io_ud->tconv.bkg_buf);
+        chunk_io_ud = DV_free(chunk_io_ud);
     } /* end if */
-    else
-        *dep_task = io_task;
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_write_int() */
+} /* end H5_daos_dataset_io_types_unequal() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_write
- *
- * Purpose:     Writes raw data from a buffer into a dataset.
+ * Function:    H5_daos_chunk_filter_copy
  *
- * Return:      Success:        0
- *              Failure:        -1, dataset not written.
+ * Purpose:     Copies data between an unfiltered chunk buffer and the
+ *              memory (or type conversion) buffer regions described by
+ *              iovs, for the elements in the chunk described by recxs.
+ *              If io_type is IO_READ, copies from the chunk to memory,
+ *              otherwise copies from memory to the chunk.
  *
- * Programmer:  Neil Fortner
- *              November, 2016
+ * Return:      void
  *
  *-------------------------------------------------------------------------
  */
-#if H5VL_VERSION >= 3
-herr_t
-H5_daos_dataset_write(size_t count, void *_dset[], hid_t mem_type_id[], hid_t mem_space_id[],
-                      hid_t file_space_id[], hid_t dxpl_id, const void *buf[], void **req)
-#else
-herr_t
-H5_daos_dataset_write(void *_dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
-                      const void *buf, void **req)
-#endif
+static void
+H5_daos_chunk_filter_copy(uint8_t *chunk_buf, size_t type_size, const daos_recx_t *recxs, unsigned nrecxs,
+                          const daos_iov_t *iovs, uint32_t niovs, H5_daos_io_type_t io_type)
 {
-    H5_daos_dset_t       *dset       = NULL;
-    H5_daos_io_task_ud_t *task_ud    = NULL;
-    tse_task_t           *io_task    = NULL;
-    tse_task_t           *first_task = NULL;
-    tse_task_t           *dep_task   = NULL;
-    H5_daos_req_t        *int_req    = NULL;
-    htri_t                need_tconv = FALSE;
-    hid_t                 req_dxpl_id;
-    hid_t                 local_mem_type_id   = H5I_INVALID_HID;
-    hid_t                 local_mem_space_id  = H5I_INVALID_HID;
-    hid_t                 local_file_space_id = H5I_INVALID_HID;
-    const void           *local_buf           = NULL;
-    int                   ret;
-    herr_t                ret_value = SUCCEED;
+    unsigned recx_idx = 0;
+    uint32_t iov_idx  = 0;
+    size_t   recx_off = 0;
+    size_t   iov_off  = 0;
+    size_t   recx_len;
+    size_t   iov_len;
+    size_t   len;
+    uint8_t *chunk_p;
+    uint8_t *mem_p;
+
+    assert(chunk_buf);
+    assert(recxs);
+    assert(iovs);
+
+    /* Walk the recx and iov lists in parallel, copying the overlapping
+     * pieces */
+    while (recx_idx < nrecxs && iov_idx < niovs) {
+        recx_len = ((size_t)recxs[recx_idx].rx_nr * type_size) - recx_off;
+        iov_len  = (size_t)iovs[iov_idx].iov_len - iov_off;
+        len      = MIN(recx_len, iov_len);
+
+        chunk_p = chunk_buf + ((size_t)recxs[recx_idx].rx_idx * type_size) + recx_off;
+        mem_p   = (uint8_t *)iovs[iov_idx].iov_buf + iov_off;
+        if (io_type == IO_READ)
+            (void)memcpy(mem_p, chunk_p, len);
+        else
+            (void)memcpy(chunk_p, mem_p, len);
 
-    H5_daos_inc_api_cnt();
+        /* Advance to the next recx and/or iov */
+        if (len == recx_len) {
+            recx_idx++;
+            recx_off = 0;
+        } /* end if */
+        else
+            recx_off += len;
+        if (len == iov_len) {
+            iov_idx++;
+            iov_off = 0;
+        } /* end if */
+        else
+            iov_off += len;
+    } /* end while */
+} /* end H5_daos_chunk_filter_copy() */
 
-    /* Set convenience variables to handle VOL structure versioning */
-#if H5VL_VERSION >= 3
-    dset                = (H5_daos_dset_t *)_dset[0];
-    local_mem_type_id   = mem_type_id[0];
-    local_mem_space_id  = mem_space_id[0];
-    local_file_space_id = file_space_id[0];
-    local_buf           = buf[0];
-#else
-    dset                = (H5_daos_dset_t *)_dset;
-    local_mem_type_id   = mem_type_id;
-    local_mem_space_id  = mem_space_id;
-    local_file_space_id = file_space_id;
-    local_buf           = buf;
-#endif
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_filter_decode
+ *
+ * Purpose:     Decodes a filtered chunk that was just fetched from DAOS
+ *              into udata->filter.buf, stripping the header and passing
+ *              the data through the filter pipeline in reverse.  If the
+ *              chunk does not exist yet, sets *chunk_exists to FALSE and,
+ *              when writing, initializes the chunk buffer with the fill
+ *              value (or zeros).
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_filter_decode(H5_daos_chunk_io_ud_t *udata, hbool_t *chunk_exists)
+{
+    H5_daos_dset_t *dset;
+    uint64_t        filter_mask;
+    uint8_t        *p;
+    int             ret_value = 0;
 
-    if (!dset)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
-    if (H5I_DATASET != dset->obj.item.type)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+    assert(udata);
+    assert(udata->dset);
+    assert(chunk_exists);
 
-#if H5VL_VERSION >= 3
-    if (count != 1)
-        D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "multi-dataset I/O is currently unsupported");
-#endif
+    dset = udata->dset;
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+    /* Check if the chunk has been written */
+    if (udata->filter.iod.iod_size == 0) {
+        *chunk_exists = FALSE;
 
-    /* Check for write access */
-    if (!(dset->obj.item.file->flags & H5F_ACC_RDWR))
-        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+        /* If writing, initialize the chunk with the fill value, or zeros if
+         * there is no fill value, since the entire chunk will be written */
+        if (udata->filter.io_type == IO_WRITE) {
+            assert(udata->filter.buf_size >= udata->filter.chunk_size);
 
-    /* If the dataset's datatype is complete, check if type conversion is needed
-     */
-    if (dset->obj.item.open_req->status == 0 || dset->obj.item.created) {
-        /* Check if datatype conversion is needed */
-        if ((need_tconv = H5_daos_need_tconv(dset->file_type_id, local_mem_type_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
-        req_dxpl_id = need_tconv ? dxpl_id : H5P_DATASET_XFER_DEFAULT;
-    } /* end if */
-    else
-        req_dxpl_id = dxpl_id;
+            if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+                assert(dset->fill_val);
 
-    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-    if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset write", dset->obj.item.open_req,
-                                              NULL, NULL, req_dxpl_id)))
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+                H5_daos_fill_pattern(udata->filter.buf, udata->filter.chunk_size, dset->fill_val,
+                                     dset->file_type_size);
+            } /* end if */
+            else
+                (void)memset(udata->filter.buf, 0, udata->filter.chunk_size);
+            udata->filter.nbytes = udata->filter.chunk_size;
+        } /* end if */
 
-    /* Check if we can call the internal routine directly - the dataset open
-     * must be complete and there must not be an in-flight set_extent. */
-    if ((dset->obj.item.open_req->status == 0) && (dset->cur_set_extent_space_id == H5I_INVALID_HID)) {
-        /* Call internal routine */
-        if (H5_daos_dataset_write_int(dset, local_mem_type_id, local_mem_space_id, local_file_space_id,
-                                      need_tconv, local_buf, NULL, int_req, &first_task, &dep_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+        D_GOTO_DONE(0);
     } /* end if */
-    else {
-        /* Allocate argument struct */
-        if (NULL == (task_ud = (H5_daos_io_task_ud_t *)DV_calloc(sizeof(H5_daos_io_task_ud_t))))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for I/O task udata struct");
-        task_ud->req           = int_req;
-        task_ud->io_type       = IO_WRITE;
-        task_ud->dset          = dset;
-        task_ud->mem_type_id   = H5I_INVALID_HID;
-        task_ud->mem_space_id  = H5I_INVALID_HID;
-        task_ud->file_space_id = H5I_INVALID_HID;
-        task_ud->buf.wbuf      = local_buf;
 
-        /* Copy dataspaces and datatype */
-        if ((task_ud->mem_type_id = H5Tcopy(local_mem_type_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory type ID");
-        if (local_mem_space_id == H5S_ALL)
-            task_ud->mem_space_id = H5S_ALL;
-        else if ((task_ud->mem_space_id = H5Scopy(local_mem_space_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory space ID");
-        if (local_file_space_id == H5S_ALL)
-            task_ud->file_space_id = H5S_ALL;
-        else if ((task_ud->file_space_id = H5Scopy(local_file_space_id)) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file space ID");
-
-        /* Create end task for writing data */
-        if (H5_daos_create_task(H5_daos_dset_io_int_end_task, 0, NULL, NULL, NULL, task_ud,
-                                &task_ud->end_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                         "can't create task to finish performing I/O operation");
-
-        /* Create task to write data */
-        if (H5_daos_create_task(H5_daos_dset_io_int_task, 0, NULL, NULL, NULL, task_ud, &io_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform I/O operation");
-
-        /* Save task to be scheduled later and give it a reference to req and
-         * dset */
-        assert(!first_task);
-        first_task = io_task;
-        dep_task   = task_ud->end_task;
-        dset->obj.item.rc++;
-        int_req->rc++;
-        task_ud = NULL;
-    } /* end else */
+    *chunk_exists = TRUE;
+
+    /* Decode header */
+    if (udata->filter.iod.iod_size < H5_DAOS_FILTER_HEADER_SIZE)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "filtered chunk is too small");
+    p = udata->filter.header_buf;
+    UINT64DECODE(p, filter_mask);
+
+    /* Pass data through the filter pipeline in reverse */
+    udata->filter.nbytes = (size_t)udata->filter.iod.iod_size - H5_DAOS_FILTER_HEADER_SIZE;
+    if (H5_daos_filter_apply(dset->dcpl_cache.nfilters, dset->dcpl_cache.filters, dset->file_type_size, TRUE,
+                             &filter_mask, &udata->filter.buf, &udata->filter.buf_size,
+                             &udata->filter.nbytes) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, -H5_DAOS_H5_FILTER_ERROR,
+                     "can't pass chunk through filter pipeline");
+    if (udata->filter.nbytes != udata->filter.chunk_size)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                     "size of unfiltered chunk does not match chunk size");
 
 done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
-
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
-
-        /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_WRITE,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
-
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
-
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "dataset write failed in task \"%s\": %s",
-                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
-
-            /* Close internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
-    }     /* end if */
-
-    /* Cleanup on error */
-    if (task_ud) {
-        assert(ret_value < 0);
-        if (task_ud->mem_type_id >= 0 && H5Tclose(task_ud->mem_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
-        if (task_ud->mem_space_id >= 0 && task_ud->mem_space_id != H5S_ALL &&
-            H5Sclose(task_ud->mem_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
-        if (task_ud->file_space_id >= 0 && task_ud->file_space_id != H5S_ALL &&
-            H5Sclose(task_ud->file_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
-        task_ud = DV_free(task_ud);
-    } /* end if */
-
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_write() */
-
-#if H5VL_VERSION >= 2
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_filter_decode() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_get_realize
+ * Function:    H5_daos_chunk_filter_fetch_prep_cb
  *
- * Purpose:     Future ID "realize" callback for H5_daos_dataset_get
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch of a
+ *              filtered chunk.  Currently checks for errors from previous
+ *              tasks then sets arguments for daos task.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              December, 2020
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_dataset_get_realize(void *future_object, hid_t *actual_object_id)
+static int
+H5_daos_chunk_filter_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_dset_get_ud_t *udata     = (H5_daos_dset_get_ud_t *)future_object;
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t         *fetch_args;
     int                    ret_value = 0;
 
-    H5_daos_inc_api_cnt();
-
-    /* Handle errors in previous tasks.  Short circuit is still a failure here.
-     */
-    if (udata->req->status <= -H5_DAOS_SHORT_CIRCUIT) {
-        D_GOTO_DONE(FAIL);
-    } /* end if */
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    /* Wait for the dataset to open if necessary */
-    if (udata->dset->obj.item.open_req->status != 0) {
-        if (H5_daos_progress(udata->dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        if (udata->dset->obj.item.open_req->status != 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "dataset open failed");
-    } /* end if */
+    assert(udata->req);
 
-    switch (udata->get_type) {
-        case H5VL_DATASET_GET_DCPL: {
-            /* Retrieve the dataset's creation property list */
-            if ((*actual_object_id = H5Pcopy(udata->dset->dcpl_id)) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset creation property list");
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
 
-            /* Set dataset's object class on dcpl */
-            if (H5_daos_set_oclass_from_oid(*actual_object_id, udata->dset->obj.oid) < 0)
-                D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
+    assert(udata->dset);
+    assert(udata->req->file);
 
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_SPACE: {
-            /* Retrieve the dataset's dataspace */
-            if ((*actual_object_id = H5Scopy(udata->dset->space_id)) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace ID of dataset");
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_TYPE: {
-            /* Retrieve the dataset's datatype */
-            if ((*actual_object_id = H5Tcopy(udata->dset->type_id)) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get datatype ID of dataset");
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_STORAGE_SIZE:
-        case H5VL_DATASET_GET_DAPL:
-        case H5VL_DATASET_GET_SPACE_STATUS:
-            /* Should have been handled in top level function or get task */
-        default:
-            assert(0 && "can't realize this type of information from dataset");
-    } /* end switch */
+    /* Set I/O task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh   = udata->dset->obj.obj_oh;
+    fetch_args->th   = udata->req->th;
+    fetch_args->dkey = &udata->dkey;
+    fetch_args->nr   = 1;
+    fetch_args->iods = &udata->filter.iod;
+    fetch_args->sgls = &udata->filter.sgl;
 
 done:
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_get_realize() */
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_filter_fetch_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_get_discard
+ * Function:    H5_daos_chunk_filter_fetch_comp_cb
  *
- * Purpose:     Future ID "discard" callback for H5_daos_dataset_get
+ * Purpose:     Complete callback for asynchronous daos_obj_fetch of a
+ *              filtered chunk that is about to be partially overwritten.
+ *              Decodes the chunk so the update task can merge the new
+ *              data into it.  Does not free data, will be freed by
+ *              H5_daos_chunk_filter_io_comp_cb().
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              December, 2020
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_dataset_get_discard(void *future_object)
+static int
+H5_daos_chunk_filter_fetch_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_dset_get_ud_t *udata     = (H5_daos_dset_get_ud_t *)future_object;
+    H5_daos_chunk_io_ud_t *udata;
+    hbool_t                chunk_exists;
+    int                    ret;
     int                    ret_value = 0;
 
-    H5_daos_inc_api_cnt();
+    assert(H5_daos_task_list_g);
 
-    if (udata) {
-        /* Close dataset */
-        if (H5_daos_dataset_close_real(udata->dset) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataset used for I/O");
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->filter.io_type == IO_WRITE);
 
-        /* Free udata */
-        udata = DV_free(udata);
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "filtered chunk fetch for raw data write";
     } /* end if */
+    else if (task->dt_result == 0)
+        /* Decode the chunk */
+        if (0 != (ret = H5_daos_chunk_filter_decode(udata, &chunk_exists)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, ret, "can't decode filtered chunk");
 
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_get_discard() */
-#endif /* H5VL_VERSION >= 2 */
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "filtered chunk fetch completion callback";
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_filter_fetch_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_get_task
+ * Function:    H5_daos_chunk_filter_update_prep_cb
  *
- * Purpose:     Asynchronous task for H5_daos_dataset_get
+ * Purpose:     Prepare callback for asynchronous daos_obj_update of a
+ *              filtered chunk.  Merges the data being written into the
+ *              unfiltered chunk (performing type conversion first if
+ *              necessary), passes the chunk through the filter pipeline,
+ *              then sets arguments for daos task.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              November, 2020
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_dataset_get_task(tse_task_t *task)
+H5_daos_chunk_filter_update_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_dset_get_ud_t *udata      = NULL;
-    hssize_t               nelements  = 0;
-    size_t                 dtype_size = 0;
-    int                    ret_value  = 0;
+    H5_daos_chunk_io_ud_t *udata;
+    daos_obj_rw_t         *update_args;
+    uint64_t               filter_mask = 0;
+    uint8_t               *p;
+    int                    ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for dataset I/O task");
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
 
-    /* Handle errors in previous tasks */
-    H5_DAOS_PREP_REQ(udata->req, H5E_DATASET);
+    assert(udata->req);
 
-    /* Verify dataset was successfully opened */
-    if (udata->dset->obj.item.open_req->status != 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_PREREQ_ERROR, "dataset open is incomplete");
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
 
-    assert(udata->get_type == H5VL_DATASET_GET_STORAGE_SIZE);
-    assert(udata->hsize_out);
+    assert(udata->dset);
+    assert(udata->req->file);
+    assert(udata->filter.io_type == IO_WRITE);
+    assert(udata->filter.nbytes == udata->filter.chunk_size);
 
-    *udata->hsize_out = 0;
+    if (udata->filter.tconv) {
+        daos_iov_t bkg_iov;
 
-    if (H5I_INVALID_HID == udata->dset->space_id || H5I_INVALID_HID == udata->dset->type_id)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, -H5_DAOS_BAD_VALUE,
-                     "can't get dataset's dataspace or datatype");
+        /* Gather data to conversion buffer */
+        if (H5Dgather(udata->tconv.mem_space_id, udata->tconv.buf, udata->tconv.mem_type_id,
+                      (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size, udata->tconv.tconv_buf,
+                      NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                         "can't gather data to conversion buffer");
 
-    /* Return the in-memory size of the data */
-    if ((nelements = H5Sget_simple_extent_npoints(udata->dset->space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
-                     "can't get number of elements in dataset's dataspace");
-    if (0 == (dtype_size = H5Tget_size(udata->dset->type_id)))
-        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get dataset's type size");
-    *udata->hsize_out = (hsize_t)nelements * dtype_size;
+        /* Fill background buffer from the chunk if necessary */
+        if (udata->tconv.fill_bkg) {
+            assert(udata->tconv.bkg_buf);
+            daos_iov_set(&bkg_iov, udata->tconv.bkg_buf,
+                         (daos_size_t)udata->tconv.num_elem * (daos_size_t)udata->tconv.file_type_size);
+            H5_daos_chunk_filter_copy((uint8_t *)udata->filter.buf, udata->tconv.file_type_size,
+                                      udata->recxs, udata->iod.iod_nr, &bkg_iov, 1, IO_READ);
+        } /* end if */
 
-done:
-    if (udata) {
-        /* Close dataset */
+        /* Perform type conversion */
+        if (H5Tconvert(udata->tconv.mem_type_id, udata->dset->file_type_id, (size_t)udata->tconv.num_elem,
+                       udata->tconv.tconv_buf, udata->tconv.bkg_buf, udata->req->dxpl_id) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                         "can't perform type conversion");
+    } /* end if */
+
+    /* Merge data into chunk */
+    H5_daos_chunk_filter_copy((uint8_t *)udata->filter.buf, udata->dset->file_type_size, udata->recxs,
+                              udata->iod.iod_nr, udata->sgl.sg_iovs, udata->sgl.sg_nr, IO_WRITE);
+
+    /* Pass chunk through the filter pipeline */
+    if (H5_daos_filter_apply(udata->dset->dcpl_cache.nfilters, udata->dset->dcpl_cache.filters,
+                             udata->dset->file_type_size, FALSE, &filter_mask, &udata->filter.buf,
+                             &udata->filter.buf_size, &udata->filter.nbytes) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, -H5_DAOS_H5_FILTER_ERROR,
+                     "can't pass chunk through filter pipeline");
+
+    /* Encode header */
+    p = udata->filter.header_buf;
+    UINT64ENCODE(p, filter_mask);
+
+    /* Set up iod and sgl for the filtered chunk */
+    udata->filter.iod.iod_size = (daos_size_t)(H5_DAOS_FILTER_HEADER_SIZE + udata->filter.nbytes);
+    daos_iov_set(&udata->filter.sg_iovs[1], udata->filter.buf, (daos_size_t)udata->filter.nbytes);
+    udata->filter.sgl.sg_nr_out = 0;
+
+    /* Set I/O task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->dset->obj.obj_oh;
+    update_args->th   = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr   = 1;
+    update_args->iods = &udata->filter.iod;
+    update_args->sgls = &udata->filter.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_filter_update_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_filter_io_comp_cb
+ *
+ * Purpose:     Complete callback for the last asynchronous DAOS operation
+ *              for raw data I/O on a filtered chunk: daos_obj_fetch when
+ *              reading or daos_obj_update when writing.  When reading,
+ *              decodes the chunk and copies the selected elements to the
+ *              read buffer (performing type conversion if necessary).
+ *              Then frees private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_filter_io_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_io_ud_t *udata;
+    hbool_t                chunk_exists;
+    int                    ret;
+    int                    ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
+
+    assert(udata->req);
+    assert(udata->req->file);
+    assert(udata->dset);
+
+    /* Handle errors in I/O task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "raw data I/O";
+    } /* end if */
+    else if (task->dt_result == 0 && udata->filter.io_type == IO_READ) {
+        /* Decode the chunk */
+        if (0 != (ret = H5_daos_chunk_filter_decode(udata, &chunk_exists)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTFILTER, ret, "can't decode filtered chunk");
+
+        /* Copy selected elements out of the chunk.  If the chunk does not
+         * exist the fill values are already in place. */
+        if (chunk_exists)
+            H5_daos_chunk_filter_copy((uint8_t *)udata->filter.buf, udata->dset->file_type_size,
+                                      udata->recxs, udata->iod.iod_nr, udata->sgl.sg_iovs, udata->sgl.sg_nr,
+                                      IO_READ);
+
+        if (udata->filter.tconv) {
+            H5_daos_blob_prefetch_t prefetch;
+            herr_t                  conv_ret;
+
+            /* Fetch the sequences of any variable-length data in a batch */
+            if (H5_daos_blob_prefetch(udata->req->file, udata->dset->file_type_id, udata->tconv.tconv_buf,
+                                      (size_t)udata->tconv.num_elem, &prefetch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't prefetch variable-length data");
+
+            /* Perform type conversion */
+            conv_ret = H5Tconvert(udata->dset->file_type_id, udata->tconv.mem_type_id,
+                                  (size_t)udata->tconv.num_elem, udata->tconv.tconv_buf, udata->tconv.bkg_buf,
+                                  udata->req->dxpl_id);
+
+            /* Release the prefetched sequences */
+            if (H5_daos_blob_prefetch_release(udata->req->file, &prefetch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTFREE, -H5_DAOS_FREE_ERROR,
+                             "can't release prefetched variable-length data");
+            if (conv_ret < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't perform type conversion");
+
+            /* Scatter data to memory buffer if necessary */
+            if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV) {
+                H5_daos_scatter_cb_ud_t scatter_cb_ud;
+
+                scatter_cb_ud.buf = udata->tconv.tconv_buf;
+                scatter_cb_ud.len = (size_t)udata->tconv.num_elem * udata->tconv.mem_type_size;
+                if (H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->tconv.mem_type_id,
+                               udata->tconv.mem_space_id, udata->tconv.buf) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                                 "can't scatter data to read buffer");
+            } /* end if */
+        }     /* end if */
+    }         /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (udata) {
+        /* Close dataset */
         if (H5_daos_dataset_close_real(udata->dset) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
-                         "can't close dataset used for I/O");
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+        /* Close space and type IDs */
+        if (udata->filter.tconv) {
+            if (H5Sclose(udata->tconv.mem_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't close memory dataspace");
+            if (H5Tclose(udata->tconv.mem_type_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't close memory datatype");
+        } /* end if */
 
         /* Handle errors in this function */
         /* Do not place any code that can issue errors after this block, except for
          * H5_daos_req_free_int, which updates req->status if it sees an error */
         if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
             udata->req->status      = ret_value;
-            udata->req->failed_task = "dataset get task";
+            udata->req->failed_task = "raw data I/O completion callback";
         } /* end if */
 
         /* Release our reference to req */
         if (H5_daos_req_free_int(udata->req) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-        /* Free udata */
-        udata = DV_free(udata);
+        /* Free private data */
+        if (udata->recxs != &udata->recx)
+            DV_free(udata->recxs);
+        if (udata->sg_iovs != &udata->sg_iov)
+            DV_free(udata->sg_iovs);
+        if (udata->filter.tconv) {
+            if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+                DV_free(udata->tconv.tconv_buf);
+            if (udata->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
+                DV_free(udata->tconv.bkg_buf);
+        } /* end if */
+        DV_free(udata->filter.buf);
+        DV_free(udata);
     } /* end if */
-    else
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
-
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_get_task() */
+} /* end H5_daos_chunk_filter_io_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_get
- *
- * Purpose:     Gets certain information about a dataset
+ * Function:    H5_daos_dataset_io_filtered
+ *
+ * Purpose:     Internal helper routine to perform I/O on a single chunk
+ *              of a dataset with a filter pipeline.  Each chunk is
+ *              stored as a single value record containing a header (the
+ *              mask of filters that were skipped) followed by the
+ *              filtered chunk data.  Reads fetch and decode the whole
+ *              chunk then copy out the selected elements.  Writes that
+ *              do not cover the whole chunk fetch and decode the
+ *              existing chunk first, then merge in the new data, pass the
+ *              chunk through the filter pipeline and update the record.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              February, 2017
+ *              Failure:        -1, dataset I/O not performed.
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_get(void *_dset, H5VL_dataset_get_args_t *get_args, hid_t H5VL_DAOS_UNUSED dxpl_id,
-                    void H5VL_DAOS_UNUSED **req)
+static herr_t
+H5_daos_dataset_io_filtered(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                            uint64_t dset_ndims, hid_t mem_type_id, hbool_t need_tconv,
+                            H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req,
+                            tse_task_t **first_task, tse_task_t **dep_task)
 {
-    H5_daos_dset_t        *dset       = (H5_daos_dset_t *)_dset;
-    H5_daos_dset_get_ud_t *get_udata  = NULL;
-    tse_task_t            *first_task = NULL;
-    tse_task_t            *dep_task   = NULL;
-    H5_daos_req_t         *int_req    = NULL;
+    H5_daos_chunk_io_ud_t *chunk_io_ud = NULL;
+    tse_task_t            *fetch_task  = NULL;
+    tse_task_t            *update_task = NULL;
+    hsize_t                chunk_nelem = 1;
+    uint64_t               i;
     int                    ret;
-    herr_t                 ret_value = SUCCEED; /* Return value */
-
-    H5_daos_inc_api_cnt();
+    herr_t                 ret_value = SUCCEED;
 
-    if (!_dset)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
-    if (!get_args)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    assert(chunk_info);
+    assert(dset);
+    assert(dset->dcpl_cache.layout == H5D_CHUNKED);
+    assert(dset->dcpl_cache.nfilters > 0);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+    /* Allocate argument struct */
+    if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    chunk_io_ud->tconv.mem_type_id  = H5I_INVALID_HID;
+    chunk_io_ud->tconv.mem_space_id = H5I_INVALID_HID;
+    chunk_io_ud->recxs              = &chunk_io_ud->recx;
+    chunk_io_ud->sg_iovs            = &chunk_io_ud->sg_iov;
+    chunk_io_ud->filter.tconv       = need_tconv;
+    chunk_io_ud->filter.io_type     = io_type;
 
-    switch (get_args->op_type) {
-        case H5VL_DATASET_GET_DCPL: {
-            hid_t *plist_id = &get_args->args.get_dcpl.dcpl_id;
+    /* Point to dset */
+    chunk_io_ud->dset = dset;
 
-            if (!plist_id)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+    /* Point to req */
+    chunk_io_ud->req = req;
 
-            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-            if (NULL ==
-                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset create property list",
-                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    /* Set up dkey, selection within the chunk and memory buffer (or type
+     * conversion buffer), and handle fill values */
+    if (need_tconv) {
+        if (H5_daos_chunk_io_setup_types_unequal(chunk_info, dset, dset_ndims, mem_type_id, io_type, buf,
+                                                 chunk_io_ud) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
+        daos_iov_set(&chunk_io_ud->sg_iov, chunk_io_ud->tconv.tconv_buf,
+                     (daos_size_t)chunk_io_ud->tconv.num_elem * (daos_size_t)chunk_io_ud->tconv.file_type_size);
+    } /* end if */
+    else if (H5_daos_chunk_io_setup_types_equal(chunk_info, dset, dset_ndims, io_type, buf, chunk_io_ud) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
 
-            /* Allocate future ID and set up async task if necessary */
-            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
-#if H5VL_VERSION >= 2
-                /* Allocate udata struct */
-                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                 "can't allocate space for dataset get udata struct");
+    /* No selection in the file */
+    if (chunk_io_ud->iod.iod_nr == 0)
+        D_GOTO_DONE(SUCCEED);
 
-                /* Register future ID for dcpl */
-                if ((*plist_id = H5Iregister_future(H5I_GENPROP_LST, get_udata, H5_daos_dataset_get_realize,
-                                                    H5_daos_dataset_get_discard)) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register future ID");
-            } /* end if */
-            else
-#else
-                /* No future ID support, wait for the dataset to open */
-                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (dset->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "attribute open failed");
-            } /* end if */
-#endif
-            {
-                /* Retrieve the dataset's creation property list */
-                if ((*plist_id = H5Pcopy(dset->dcpl_id)) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset creation property list");
+    /* Calculate size of the unfiltered chunk */
+    for (i = 0; i < dset_ndims; i++)
+        chunk_nelem *= dset->dcpl_cache.chunk_dims[i];
+    chunk_io_ud->filter.chunk_size = (size_t)chunk_nelem * dset->file_type_size;
+
+    /* Check if a write covers the whole chunk, in which case the existing
+     * chunk does not need to be read first */
+    chunk_io_ud->filter.full_chunk = io_type == IO_WRITE &&
+                                     (hsize_t)chunk_info->num_elem_sel_file == chunk_nelem &&
+                                     !chunk_io_ud->tconv.fill_bkg;
+
+    /* Allocate chunk buffer.  If the chunk will be fetched, make it large
+     * enough to hold the largest possible filtered chunk. */
+    chunk_io_ud->filter.buf_size =
+        chunk_io_ud->filter.full_chunk
+            ? chunk_io_ud->filter.chunk_size
+            : H5_daos_filter_max_size(dset->dcpl_cache.nfilters, dset->dcpl_cache.filters,
+                                      chunk_io_ud->filter.chunk_size);
+    if (NULL == (chunk_io_ud->filter.buf = DV_malloc(chunk_io_ud->filter.buf_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk buffer");
+    if (chunk_io_ud->filter.full_chunk)
+        chunk_io_ud->filter.nbytes = chunk_io_ud->filter.chunk_size;
+
+    /* Set up iod and sgl for the filtered chunk.  The chunk is stored as a
+     * single value record. */
+    daos_iov_set(&chunk_io_ud->filter.iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+                 (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->filter.iod.iod_nr   = 1u;
+    chunk_io_ud->filter.iod.iod_size = DAOS_REC_ANY;
+    chunk_io_ud->filter.iod.iod_type = DAOS_IOD_SINGLE;
+    daos_iov_set(&chunk_io_ud->filter.sg_iovs[0], chunk_io_ud->filter.header_buf,
+                 (daos_size_t)H5_DAOS_FILTER_HEADER_SIZE);
+    daos_iov_set(&chunk_io_ud->filter.sg_iovs[1], chunk_io_ud->filter.buf,
+                 (daos_size_t)chunk_io_ud->filter.buf_size);
+    chunk_io_ud->filter.sgl.sg_nr     = 2;
+    chunk_io_ud->filter.sgl.sg_nr_out = 0;
+    chunk_io_ud->filter.sgl.sg_iovs   = chunk_io_ud->filter.sg_iovs;
+
+    /* Create task to read the chunk, unless this is a write covering the
+     * whole chunk */
+    if (!chunk_io_ud->filter.full_chunk) {
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                     H5_daos_chunk_filter_fetch_prep_cb,
+                                     io_type == IO_READ ? H5_daos_chunk_filter_io_comp_cb
+                                                        : H5_daos_chunk_filter_fetch_comp_cb,
+                                     chunk_io_ud, &fetch_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read chunk");
+
+        /* Schedule fetch task (or save it to be scheduled later) */
+        if (*first_task) {
+            if (0 != (ret = tse_task_schedule(fetch_task, false)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule chunk fetch task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = fetch_task;
+        *dep_task = fetch_task;
+    } /* end if */
 
-                /* Set dataset's object class on dcpl */
-                if (H5_daos_set_oclass_from_oid(*plist_id, dset->obj.oid) < 0)
-                    D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
-            } /* end else/block */
+    if (io_type == IO_WRITE) {
+        /* Create task to write the chunk */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                     H5_daos_chunk_filter_update_prep_cb, H5_daos_chunk_filter_io_comp_cb,
+                                     chunk_io_ud, &update_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to write chunk");
 
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_DAPL: {
-            hid_t *plist_id = &get_args->args.get_dapl.dapl_id;
+        /* Schedule update task (or save it to be scheduled later) */
+        if (*first_task) {
+            if (0 != (ret = tse_task_schedule(update_task, false)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule chunk update task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            *first_task = update_task;
+        *dep_task = update_task;
+    } /* end if */
 
-            if (!plist_id)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+    /* Tasks will be scheduled, give them a reference to req and the dataset */
+    chunk_io_ud->req->rc++;
+    chunk_io_ud->dset->obj.item.rc++;
 
-            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-            if (NULL ==
-                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset access property list",
-                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+done:
+    /* Cleanup on failure or if there is nothing to do */
+    if (chunk_io_ud && !fetch_task && (ret_value < 0 || chunk_io_ud->iod.iod_nr == 0)) {
+        if (chunk_io_ud->tconv.mem_type_id >= 0 && H5Tclose(chunk_io_ud->tconv.mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if (chunk_io_ud->tconv.mem_space_id >= 0 && H5Sclose(chunk_io_ud->tconv.mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        if (chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if (chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
+            DV_free(chunk_io_ud->sg_iovs);
+        if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_TCONV)
+            DV_free(chunk_io_ud->tconv.tconv_buf);
+        if (chunk_io_ud->tconv.reuse != H5_DAOS_TCONV_REUSE_BKG)
+            DV_free(chunk_io_ud->tconv.bkg_buf);
+        DV_free(chunk_io_ud->filter.buf);
+        chunk_io_ud = DV_free(chunk_io_ud);
+    } /* end if */
 
-            /* Retrieve the dataset's access property list */
-            if ((*plist_id = H5Pcopy(dset->dapl_id)) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset access property list");
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_filtered() */
 
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_SPACE: {
-            hid_t *ret_id = &get_args->args.get_space.space_id;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_filtered_types_equal
+ *
+ * Purpose:     Performs I/O on a single chunk of a dataset with a filter
+ *              pipeline where the memory datatype matches the dataset's
+ *              datatype.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_filtered_types_equal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                        uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+                                        void *buf, H5_daos_req_t *req, tse_task_t **first_task,
+                                        tse_task_t **dep_task)
+{
+    return H5_daos_dataset_io_filtered(chunk_info, dset, dset_ndims, mem_type_id, FALSE, io_type, buf, req,
+                                       first_task, dep_task);
+} /* end H5_daos_dataset_io_filtered_types_equal() */
 
-            if (!ret_id)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_filtered_types_unequal
+ *
+ * Purpose:     Performs I/O on a single chunk of a dataset with a filter
+ *              pipeline where the memory datatype does not match the
+ *              dataset's datatype.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_filtered_types_unequal(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset,
+                                          uint64_t dset_ndims, hid_t mem_type_id, H5_daos_io_type_t io_type,
+                                          void *buf, H5_daos_req_t *req, tse_task_t **first_task,
+                                          tse_task_t **dep_task)
+{
+    return H5_daos_dataset_io_filtered(chunk_info, dset, dset_ndims, mem_type_id, TRUE, io_type, buf, req,
+                                       first_task, dep_task);
+} /* end H5_daos_dataset_io_filtered_types_unequal() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_fill_io_cache
+ *
+ * Purpose:     Fills the "io_cache" field of the dataset struct. This
+ *              field is used to cache various things for dataset I/O
+ *              including dataspace selection iterators and selected chunk
+ *              info buffers.  Also sets up the chunk cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_fill_io_cache(H5_daos_dset_t *dset, hid_t file_space_id, hid_t mem_space_id)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+    assert(!dset->io_cache.filled);
+    assert(dset->io_cache.file_sel_iter_id <= 0);
+    assert(dset->io_cache.mem_sel_iter_id <= 0);
+    assert((dset->dcpl_cache.layout != H5D_LAYOUT_ERROR) && (dset->dcpl_cache.layout != H5D_NLAYOUTS));
+
+    /* Setup and cache selection iterators for dataset. We use 1 for the element
+     * size here so that the sequence list offsets and lengths are returned in
+     * terms of numbers of elements, not bytes. This way the returned values
+     * better match the values DAOS expects to receive, which are also in terms
+     * of numbers of elements. */
+    if ((dset->io_cache.file_sel_iter_id =
+             H5Ssel_iter_create(file_space_id, 1, H5S_SEL_ITER_SHARE_WITH_DATASPACE)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "unable to create file dataspace selection iterator");
+    if ((dset->io_cache.mem_sel_iter_id =
+             H5Ssel_iter_create(mem_space_id, 1, H5S_SEL_ITER_SHARE_WITH_DATASPACE)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL,
+                     "unable to create memory dataspace selection iterator");
+
+    /* Setup selected chunk info buffer */
+    switch (dset->dcpl_cache.layout) {
+        case H5D_COMPACT:
+        case H5D_CONTIGUOUS:
+            dset->io_cache.chunk_info        = &dset->io_cache.single_chunk_info;
+            dset->io_cache.chunk_info_nalloc = 1;
+            break;
+
+        case H5D_CHUNKED:
+            dset->io_cache.chunk_info        = NULL;
+            dset->io_cache.chunk_info_nalloc = 0;
+            break;
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        case H5D_VIRTUAL:
+        default:
+            D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset has invalid storage layout type");
+    } /* end switch */
+
+    /* Set up chunk cache, if requested */
+    if (H5_daos_chunk_cache_init(dset) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize chunk cache");
+
+    dset->io_cache.filled = TRUE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_fill_io_cache() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_io_int_task
+ *
+ * Purpose:     Asynchronous version of H5Dread()/H5Dwrite().
+ *`
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_dset_io_int_task(tse_task_t *task)
+{
+    H5_daos_io_task_ud_t *udata      = NULL;
+    tse_task_t           *first_task = NULL;
+    tse_task_t           *dep_task   = NULL;
+    htri_t                need_tconv;
+    int                   ret;
+    int                   ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for dataset I/O task");
+
+    assert(udata->end_task);
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_DATASET);
+
+    /* Make sure the dataset open succeeded.  This is normally checked as a
+     * prerequisite of the request, but multi-dataset I/O can depend on the
+     * open of several datasets. */
+    if (udata->dset->obj.item.open_req->status != 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_PREREQ_ERROR, "dataset open failed");
+
+    /* Check if datatype conversion is needed */
+    if ((need_tconv = H5_daos_need_tconv(udata->dset->file_type_id, udata->mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, -H5_DAOS_H5_GET_ERROR,
+                     "can't check if type conversion is needed");
+
+    /* Collective I/O is set up together for reads and writes */
+    if (udata->coll) {
+        if (H5_daos_dataset_coll_io(udata->dset, udata->mem_type_id, udata->mem_space_id,
+                                    udata->file_space_id, need_tconv, udata->io_type, udata->buf.rbuf,
+                                    udata->end_task, udata->req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_GET_ERROR,
+                         "failed to perform collective dataset I/O");
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Call actual I/O routine */
+    switch (udata->io_type) {
+        case IO_READ:
+            if (H5_daos_dataset_read_int(udata->dset, udata->mem_type_id, udata->mem_space_id,
+                                         udata->file_space_id, need_tconv, udata->buf.rbuf, udata->end_task,
+                                         udata->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_GET_ERROR,
+                             "failed to read data from dataset");
+            break;
+
+        case IO_WRITE:
+            if (H5_daos_dataset_write_int(udata->dset, udata->mem_type_id, udata->mem_space_id,
+                                          udata->file_space_id, need_tconv, udata->buf.wbuf, udata->end_task,
+                                          udata->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_COPY_ERROR,
+                             "failed to write data to dataset");
+            break;
+    } /* end switch */
+
+done:
+    if (udata) {
+        /* Schedule first task */
+        if (first_task && (0 != (ret = tse_task_schedule(first_task, false))))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule final task for dataset I/O: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "dataset I/O task";
+        } /* end if */
+    }     /* end if */
+    else {
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        assert(!first_task);
+    } /* end else */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_io_int_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_io_int_end_task
+ *
+ * Purpose:     Finalizes an asynchronous I/O task.
+ *`
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_dset_io_int_end_task(tse_task_t *task)
+{
+    H5_daos_io_task_ud_t *udata     = NULL;
+    int                   ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for dataset I/O task");
+
+    assert(task == udata->end_task);
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_DONE(udata->req);
+
+    /* Free IDs */
+    if (H5Tclose(udata->mem_type_id) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+    if (udata->mem_space_id != H5S_ALL && H5Sclose(udata->mem_space_id) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory dataspace");
+    if (udata->file_space_id != H5S_ALL && H5Sclose(udata->file_space_id) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file dataspace");
+
+    /* Close dataset */
+    if (H5_daos_dataset_close_real(udata->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                     "can't close dataset used for I/O");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "dataset I/O end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free udata */
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_io_int_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_compact_io_task
+ *
+ * Purpose:     Asynchronous task that performs I/O on the cached raw data
+ *              of a compact dataset.  Reads copy the selected elements
+ *              out of the cache, converting them if necessary.  Writes
+ *              convert and copy the selected elements into the cache,
+ *              then hand a copy of the whole cache to the task that
+ *              writes it to the dataset's metadata.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_compact_io_task(tse_task_t *task)
+{
+    H5_daos_compact_io_ud_t *udata;
+    H5_daos_scatter_cb_ud_t  scatter_cb_ud;
+    hssize_t                 num_elem;
+    size_t                   file_type_size;
+    size_t                   mem_type_size;
+    void                    *tconv_buf = NULL;
+    void                    *bkg_buf   = NULL;
+    hbool_t                  fill_bkg  = FALSE;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for compact dataset I/O task");
+
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->dset->compact.stored);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    /* Take the cached data of the other handles of the dataset, then
+     * initialize the cached data if it was not received when the dataset
+     * was created */
+    if (H5_daos_dset_compact_attach(udata->dset) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't share compact data with other dataset handles");
+    if (!udata->dset->compact.buf && H5_daos_dset_compact_init(udata->dset) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't initialize compact data");
+
+    if ((num_elem = H5Sget_select_npoints(udata->file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
+                     "can't get number of points in file selection");
+
+    /* Set up type conversion, or a buffer to stage the elements in */
+    if (udata->need_tconv) {
+        if (udata->io_type == IO_READ) {
+            if (H5_daos_tconv_init(udata->dset->file_type_id, &file_type_size, udata->mem_type_id,
+                                   &mem_type_size, (size_t)num_elem, FALSE, FALSE, &tconv_buf, &bkg_buf,
+                                   NULL, &fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't initialize type conversion");
+        } /* end if */
+        else if (H5_daos_tconv_init(udata->mem_type_id, &mem_type_size, udata->dset->file_type_id,
+                                    &file_type_size, (size_t)num_elem, FALSE, TRUE, &tconv_buf, &bkg_buf,
+                                    NULL, &fill_bkg) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_TCONV_ERROR,
+                         "can't initialize type conversion");
+    } /* end if */
+    else {
+        file_type_size = udata->dset->file_type_size;
+        mem_type_size  = file_type_size;
+        if (NULL == (tconv_buf = DV_malloc((size_t)num_elem * file_type_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate buffer for compact dataset I/O");
+    } /* end else */
+
+    if (udata->io_type == IO_READ) {
+        /* Gather the selected elements from the cache */
+        if (H5Dgather(udata->file_space_id, udata->dset->compact.buf, udata->dset->file_type_id,
+                      (size_t)num_elem * file_type_size, tconv_buf, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                         "can't gather data from compact dataset");
+
+        if (udata->need_tconv) {
+            H5_daos_blob_prefetch_t prefetch;
+            herr_t                  conv_ret;
+
+            /* Gather data to background buffer if necessary */
+            if (fill_bkg && H5Dgather(udata->mem_space_id, udata->buf.rbuf, udata->mem_type_id,
+                                      (size_t)num_elem * mem_type_size, bkg_buf, NULL, NULL) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                             "can't gather data to background buffer");
+
+            /* Fetch the sequences of any variable-length data in a batch */
+            if (H5_daos_blob_prefetch(udata->req->file, udata->dset->file_type_id, tconv_buf,
+                                      (size_t)num_elem, &prefetch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't prefetch variable-length data");
+
+            /* Perform type conversion */
+            conv_ret = H5Tconvert(udata->dset->file_type_id, udata->mem_type_id, (size_t)num_elem, tconv_buf,
+                                  bkg_buf, udata->req->dxpl_id);
+
+            /* Release the prefetched sequences */
+            if (H5_daos_blob_prefetch_release(udata->req->file, &prefetch) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTFREE, -H5_DAOS_FREE_ERROR,
+                             "can't release prefetched variable-length data");
+            if (conv_ret < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't perform type conversion");
+        } /* end if */
+
+        /* Scatter data to memory buffer */
+        scatter_cb_ud.buf = tconv_buf;
+        scatter_cb_ud.len = (size_t)num_elem * mem_type_size;
+        if (H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->mem_type_id, udata->mem_space_id,
+                       udata->buf.rbuf) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                         "can't scatter data to read buffer");
+    } /* end if */
+    else {
+
+        /* Gather the selected elements from the write buffer */
+        if (H5Dgather(udata->mem_space_id, udata->buf.wbuf, udata->mem_type_id,
+                      (size_t)num_elem * mem_type_size, tconv_buf, NULL, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                         "can't gather data from write buffer");
+
+        if (udata->need_tconv) {
+            /* Gather data to background buffer if necessary */
+            if (fill_bkg && H5Dgather(udata->file_space_id, udata->dset->compact.buf,
+                                      udata->dset->file_type_id, (size_t)num_elem * file_type_size, bkg_buf,
+                                      NULL, NULL) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                             "can't gather data to background buffer");
+
+            /* Perform type conversion */
+            if (H5Tconvert(udata->mem_type_id, udata->dset->file_type_id, (size_t)num_elem, tconv_buf,
+                           bkg_buf, udata->req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't perform type conversion");
+        } /* end if */
+
+        /* Scatter data to the cache */
+        scatter_cb_ud.buf = tconv_buf;
+        scatter_cb_ud.len = (size_t)num_elem * file_type_size;
+        if (H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->dset->file_type_id, udata->file_space_id,
+                       udata->dset->compact.buf) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                         "can't scatter data to compact dataset");
+        if (H5_daos_dset_compact_publish(udata->dset) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't share compact data with other dataset handles");
+
+        /* Copy the cache for the update task, since later writes may change
+         * the cache before the update completes */
+        if (udata->update_ud) {
+            void *update_buf;
+
+            if (NULL == (update_buf = DV_malloc(udata->dset->compact.size)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                             "can't allocate buffer for compact dataset data");
+            (void)memcpy(update_buf, udata->dset->compact.buf, udata->dset->compact.size);
+            daos_iov_set(&udata->update_ud->sg_iov[0], update_buf, (daos_size_t)udata->dset->compact.size);
+        } /* end if */
+    } /* end else */
+
+done:
+    if (udata) {
+        /* Close dataset */
+        if (H5_daos_dataset_close_real(udata->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
+
+        /* Close space and type IDs */
+        if (H5Sclose(udata->file_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close file dataspace");
+        if (H5Sclose(udata->mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                         "can't close memory dataspace");
+        if (H5Tclose(udata->mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close memory datatype");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "compact dataset raw data I/O";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        DV_free(udata);
+    } /* end if */
+
+    DV_free(tconv_buf);
+    DV_free(bkg_buf);
+
+    /* Return task to task list and complete it */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_compact_io_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_compact
+ *
+ * Purpose:     Internal helper routine to perform I/O on a compact
+ *              dataset whose raw data is stored with its metadata.  The
+ *              raw data is cached on the dataset when it is opened, so
+ *              reads only copy from memory.  Writes update the cache and
+ *              then write all of the raw data back to the dataset's
+ *              metadata.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_compact(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                           hbool_t need_tconv, H5_daos_io_type_t io_type, const void *buf, H5_daos_req_t *req,
+                           tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_compact_io_ud_t *io_ud       = NULL;
+    H5_daos_compact_io_ud_t *task_ud     = NULL;
+    H5_daos_md_rw_cb_ud_t   *update_ud   = NULL;
+    tse_task_t              *io_task     = NULL;
+    tse_task_t              *update_task = NULL;
+    int                      ret;
+    herr_t                   ret_value = SUCCEED;
+
+    assert(dset);
+    assert(dset->compact.stored);
+    assert(buf);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct */
+    if (NULL == (io_ud = (H5_daos_compact_io_ud_t *)DV_calloc(sizeof(H5_daos_compact_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O task arguments");
+    io_ud->req           = req;
+    io_ud->dset          = dset;
+    io_ud->io_type       = io_type;
+    io_ud->need_tconv    = need_tconv;
+    io_ud->mem_type_id   = H5I_INVALID_HID;
+    io_ud->mem_space_id  = H5I_INVALID_HID;
+    io_ud->file_space_id = H5I_INVALID_HID;
+    io_ud->buf.wbuf      = buf;
+
+    /* Copy the selections and memory type, since the task may run after
+     * the caller has closed them */
+    if ((io_ud->mem_type_id = H5Tcopy(mem_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+    if ((io_ud->mem_space_id = H5Scopy(mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
+    if ((io_ud->file_space_id = H5Scopy(file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file dataspace");
+
+    /* Set up operation to write the raw data to the dataset's metadata.  The
+     * buffer is supplied by the I/O task. */
+    if (io_type == IO_WRITE) {
+        if (NULL == (update_ud = (H5_daos_md_rw_cb_ud_t *)DV_calloc(sizeof(H5_daos_md_rw_cb_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                         "can't allocate buffer for update task arguments");
+        update_ud->req = req;
+        update_ud->obj = &dset->obj;
+
+        /* Set up dkey */
+        daos_const_iov_set((d_const_iov_t *)&update_ud->dkey, H5_daos_int_md_key_g,
+                           H5_daos_int_md_key_size_g);
+        update_ud->free_dkey = FALSE;
+
+        /* Set up iod */
+        daos_const_iov_set((d_const_iov_t *)&update_ud->iod[0].iod_name, H5_daos_compact_key_g,
+                           H5_daos_compact_key_size_g);
+        update_ud->iod[0].iod_nr   = 1u;
+        update_ud->iod[0].iod_size = (uint64_t)dset->compact.size;
+        update_ud->iod[0].iod_type = DAOS_IOD_SINGLE;
+
+        update_ud->free_akeys = FALSE;
+
+        /* Set up sgl */
+        update_ud->sgl[0].sg_nr     = 1;
+        update_ud->sgl[0].sg_nr_out = 0;
+        update_ud->sgl[0].sg_iovs   = &update_ud->sg_iov[0];
+        update_ud->free_sg_iov[0]   = TRUE;
+
+        update_ud->nr = 1u;
+
+        /* Set task name */
+        update_ud->task_name = "compact dataset raw data write";
+    } /* end if */
+
+    /* Create task for I/O on the cached data */
+    if (H5_daos_create_task(H5_daos_compact_io_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
+                            NULL, io_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for compact dataset I/O");
+
+    /* Schedule I/O task (or save it to be scheduled later) and give it a
+     * reference to req and the dataset */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule compact dataset I/O task: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = io_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    task_ud   = io_ud;
+    io_ud     = NULL;
+    *dep_task = io_task;
+
+    /* Create task to write the raw data */
+    if (update_ud) {
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, dep_task, H5_daos_md_rw_prep_cb,
+                                     H5_daos_md_update_comp_cb, update_ud, &update_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create task to write compact dataset raw data");
+
+        /* The I/O task supplies the buffer for the update task */
+        task_ud->update_ud = update_ud;
+        update_ud          = NULL;
+
+        /* Schedule update task and give it a reference to req and the
+         * dataset */
+        if (0 != (ret = tse_task_schedule(update_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't schedule task to write compact dataset raw data: %s",
+                         H5_daos_err_to_string(ret));
+        req->rc++;
+        dset->obj.item.rc++;
+        *dep_task = update_task;
+    } /* end if */
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        if (io_ud) {
+            if (io_ud->mem_type_id >= 0 && H5Tclose(io_ud->mem_type_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+            if (io_ud->mem_space_id >= 0 && H5Sclose(io_ud->mem_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+            if (io_ud->file_space_id >= 0 && H5Sclose(io_ud->file_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
+            io_ud = DV_free(io_ud);
+        } /* end if */
+        update_ud = DV_free(update_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_compact() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_read_int
+ *
+ * Purpose:     Internal version of H5_daos_dataset_read().
+ *`
+ * Return:      Success:        0
+ *              Failure:        -1, dataset not read.
+ *
+ * Programmer:  Neil Fortner
+ *              July. 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_read_int(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                         htri_t need_tconv, void *buf, tse_task_t *_end_task, H5_daos_req_t *req,
+                         tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_select_chunk_info_t *chunk_info = NULL; /* Array of info for each chunk selected in the file */
+    H5_daos_chunk_io_func        single_chunk_read_func;
+    uint64_t                     i;
+    size_t                       nchunks_sel;
+    hid_t                        real_file_space_id;
+    hid_t                        real_mem_space_id;
+    int                          ndims;
+    hssize_t                     num_elem_file   = -1, num_elem_mem;
+    tse_task_t                  *io_task         = NULL;
+    tse_task_t                  *end_task        = _end_task;
+    hbool_t                      use_chunk_cache = FALSE;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Get dataspace extent */
+    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of dimensions");
+
+    /* Get "real" space ids */
+    if (file_space_id == H5S_ALL)
+        real_file_space_id = dset->space_id;
+    else
+        real_file_space_id = file_space_id;
+    if (mem_space_id == H5S_ALL)
+        real_mem_space_id = real_file_space_id;
+    else
+        real_mem_space_id = mem_space_id;
+
+    /* Get number of elements in selections */
+    if ((num_elem_file = H5Sget_select_npoints(real_file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in file selection");
+    if ((num_elem_mem = H5Sget_select_npoints(real_mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in memory selection");
+
+    /* Various sanity and special case checks */
+    if (num_elem_file != num_elem_mem)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                     "number of elements selected in file and memory dataspaces is different");
+    if (num_elem_file && !buf)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "read buffer is NULL but selection has >0 elements");
+    if (num_elem_file == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Compact datasets stored with their metadata are read from memory */
+    if (dset->compact.stored) {
+        io_task = *dep_task;
+        if (H5_daos_dataset_io_compact(dset, mem_type_id, real_mem_space_id, real_file_space_id,
+                                       (hbool_t)need_tconv, IO_READ, buf, req, first_task, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
+
+        /* Set up dependency on io_task for end task */
+        if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create dependency on compact dataset I/O task: %s",
+                         H5_daos_err_to_string(ret));
+
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Fill dataset I/O cache if it hasn't already been filled */
+    if (!dset->io_cache.filled && H5_daos_dset_fill_io_cache(dset, real_file_space_id, real_mem_space_id) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize dataset I/O cache");
+
+    /* Check for the dataset having a chunked storage layout. If it does not,
+     * simply set up the dataset as a single "chunk".
+     */
+    switch (dset->dcpl_cache.layout) {
+        case H5D_COMPACT:
+        case H5D_CONTIGUOUS:
+            chunk_info  = dset->io_cache.chunk_info;
+            nchunks_sel = 1;
+
+            /* Set up "single-chunk dataset", with the "chunk" starting at coordinate 0 */
+            chunk_info->fspace_id         = real_file_space_id;
+            chunk_info->mspace_id         = real_mem_space_id;
+            chunk_info->num_elem_sel_file = num_elem_file;
+            memset(chunk_info->chunk_coords, 0, sizeof(chunk_info->chunk_coords));
+
+            break;
+
+        case H5D_CHUNKED: {
+            htri_t sel_regular = FALSE;
+
+            /* If no type conversion or filtering is needed and the selections
+             * are regular, compute the selected chunks arithmetically without
+             * creating per-chunk dataspaces */
+            if (!need_tconv && dset->dcpl_cache.nfilters == 0)
+                if ((sel_regular = H5_daos_get_selected_chunk_info_regular(
+                         dset, real_file_space_id, real_mem_space_id, &nchunks_sel)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+
+            /* Otherwise get the coordinates of the currently selected chunks in the file, setting up
+             * memory and file dataspaces for them */
+            if (!sel_regular)
+                if (H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
+                                                    &dset->io_cache.chunk_info,
+                                                    &dset->io_cache.chunk_info_nalloc, &nchunks_sel) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+            chunk_info = dset->io_cache.chunk_info;
+
+            break;
+        } /* case H5D_CHUNKED */
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        case H5D_VIRTUAL:
+        default:
+            D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
+                         "invalid, unknown or unsupported dataset storage layout type");
+    } /* end switch */
+    assert(nchunks_sel > 0);
+
+    /* Setup the appropriate function for reading the selected chunks */
+    if (dset->dcpl_cache.nfilters > 0)
+        /* Chunks must pass through the filter pipeline */
+        single_chunk_read_func =
+            need_tconv ? H5_daos_dataset_io_filtered_types_unequal : H5_daos_dataset_io_filtered_types_equal;
+    else if (need_tconv)
+        /* Type conversion necessary */
+        single_chunk_read_func = H5_daos_dataset_io_types_unequal;
+    else
+        /* No type conversion necessary */
+        single_chunk_read_func = H5_daos_dataset_io_types_equal;
+
+    /* I/O that bypasses the chunk cache must not conflict with cached chunks,
+     * including those cached by other handles of the dataset, so write back
+     * and drop them first */
+    if (dset->dcpl_cache.layout == H5D_CHUNKED &&
+        H5_daos_chunk_cache_sync(dset, (hbool_t)need_tconv, &use_chunk_cache, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't synchronize chunk caches");
+
+    /* Set up coordination metatasks if there is more than one chunk selected */
+    if (nchunks_sel > 1) {
+        /* Set up empty first task for coordination if there isn't one already */
+        if (!*first_task) {
+            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, first_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create first metatask for dataset read");
+            *dep_task = *first_task;
+        } /* end if */
+
+        /* Set up empty end task for coordination if not already provided */
+        if (!end_task) {
+            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &end_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create last metatask for dataset read");
+        }
+    } /* end if */
+
+    /* Perform I/O on each chunk selected.  If the dataset's chunk cache
+     * can be used, go through the cache.
+     * Otherwise, if there is more than one chunk and no type conversion
+     * or filtering is needed, perform the I/O in batches of chunks to cut
+     * down on per-chunk overhead. */
+    if (use_chunk_cache) {
+        for (i = 0; i < nchunks_sel; i++) {
+            io_task = *dep_task;
+            if (H5_daos_chunk_cache_io(&chunk_info[i], dset, (uint64_t)ndims, IO_READ, buf, req,
+                                       first_task, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
+
+            /* Set up dependency on io_task for end task */
+            assert(io_task);
+            if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create dependency on chunk cache I/O task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end for */
+    } /* end if */
+    else if (!need_tconv && dset->dcpl_cache.nfilters == 0 && nchunks_sel > 1 &&
+             H5_daos_chunk_task_batch_size_g > 1) {
+        size_t batch_nchunks;
+
+        for (i = 0; i < nchunks_sel; i += batch_nchunks) {
+            batch_nchunks = (size_t)MIN(H5_daos_chunk_task_batch_size_g, nchunks_sel - i);
+
+            io_task = *dep_task;
+            if (H5_daos_dataset_io_types_equal_task_batch(&chunk_info[i], batch_nchunks, dset,
+                                                          (uint64_t)ndims, IO_READ, buf, req, first_task,
+                                                          &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
+
+            /* Set up dependency on io_task for end task */
+            assert(io_task);
+            if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create dependency on chunk batch I/O task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end for */
+    }     /* end if */
+    else
+        for (i = 0; i < nchunks_sel; i++) {
+            io_task = *dep_task;
+            if (single_chunk_read_func(&chunk_info[i], dset, (uint64_t)ndims, mem_type_id, IO_READ, buf, req,
+                                       first_task, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "dataset read failed");
+
+            /* Set up dependency on io_task for end task */
+            assert(io_task);
+            if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create dependency on chunk I/O task: %s", H5_daos_err_to_string(ret));
+        } /* end for */
+
+done:
+    /* Schedule end_task if appropriate and update *dep_task */
+    if (end_task) {
+        if (0 != (ret = tse_task_schedule(end_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for IO operation: %s",
+                         H5_daos_err_to_string(ret));
+        *dep_task = end_task;
+    } /* end if */
+    else
+        *dep_task = io_task;
+
+    /* Start reading ahead if this read continues a sequential scan */
+    if (ret_value >= 0 && use_chunk_cache && dset->chunk_cache.ra_nchunks > 0)
+        if (H5_daos_chunk_cache_readahead(dset, chunk_info, nchunks_sel, *dep_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't start chunk readahead");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_read_int() */
+
+#if H5VL_VERSION >= 3
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_io_multi
+ *
+ * Purpose:     Reads from (if rbuf is not NULL) or writes to (otherwise)
+ *              multiple datasets as a single operation.  The I/O for all
+ *              datasets is set up in one task graph between shared first
+ *              and end metatasks, so the chunk I/O for all datasets
+ *              proceeds concurrently and the operation completes when all
+ *              of it is done.  I/O on datasets that are not yet fully
+ *              open is set up once they are, as for single dataset I/O.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_io_multi(size_t count, void *_dset[], hid_t mem_type_id[], hid_t mem_space_id[],
+                         hid_t file_space_id[], hid_t dxpl_id, void *rbuf[], const void *wbuf[], void **req)
+{
+    H5_daos_dset_t         *dset;
+    H5_daos_io_task_ud_t   *task_ud    = NULL;
+    tse_task_t             *io_task    = NULL;
+    tse_task_t             *first_task = NULL;
+    tse_task_t             *dep_task   = NULL;
+    tse_task_t             *end_task   = NULL;
+    tse_task_t             *dset_dep_task;
+    H5_daos_req_t          *int_req   = NULL;
+    H5_daos_io_type_t       io_type   = rbuf ? IO_READ : IO_WRITE;
+    H5_daos_op_pool_scope_t op_scope  = H5_DAOS_OP_SCOPE_FILE;
+    hbool_t                 copy_dxpl = FALSE;
+    htri_t                  need_tconv;
+    size_t                  i;
+    int                     ret;
+    herr_t                  ret_value = SUCCEED;
+
+    assert(count > 1);
+    assert(!rbuf != !wbuf);
+
+    /* Check arguments, and check if the DXPL is needed for type conversion */
+    for (i = 0; i < count; i++) {
+        dset = (H5_daos_dset_t *)_dset[i];
+
+        if (!dset)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
+        if (H5I_DATASET != dset->obj.item.type)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+        if (io_type == IO_WRITE && !(dset->obj.item.file->flags & H5F_ACC_RDWR))
+            D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+        /* Use the global scope if the datasets are in different files */
+        if (dset->obj.item.file != ((H5_daos_dset_t *)_dset[0])->obj.item.file)
+            op_scope = H5_DAOS_OP_SCOPE_GLOB;
+
+        if (!copy_dxpl) {
+            if (dset->obj.item.open_req->status == 0 || dset->obj.item.created) {
+                if ((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id[i])) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL,
+                                 "can't check if type conversion is needed");
+                copy_dxpl = (hbool_t)need_tconv;
+            } /* end if */
+            else
+                copy_dxpl = TRUE;
+        } /* end if */
+    }     /* end for */
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+    if (NULL == (int_req = H5_daos_req_create(((H5_daos_dset_t *)_dset[0])->obj.item.file,
+                                              io_type == IO_READ ? "dataset read" : "dataset write", NULL,
+                                              NULL, NULL, copy_dxpl ? dxpl_id : H5P_DATASET_XFER_DEFAULT)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Set up shared first and end metatasks for coordination */
+    if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &first_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create first metatask for multi-dataset I/O");
+    if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &end_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create last metatask for multi-dataset I/O");
+
+    for (i = 0; i < count; i++) {
+        dset          = (H5_daos_dset_t *)_dset[i];
+        dset_dep_task = first_task;
+
+        /* Check if we can call the internal routine directly -  the dataset
+         * open must be complete and there must not be an in-flight
+         * set_extent. */
+        if ((dset->obj.item.open_req->status == 0) && (dset->cur_set_extent_space_id == H5I_INVALID_HID)) {
+            /* Check if datatype conversion is needed */
+            if ((need_tconv = H5_daos_need_tconv(dset->file_type_id, mem_type_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+
+            /* Call internal routine */
+            if (io_type == IO_READ) {
+                if (H5_daos_dataset_read_int(dset, mem_type_id[i], mem_space_id[i], file_space_id[i],
+                                             need_tconv, rbuf[i], NULL, int_req, &first_task,
+                                             &dset_dep_task) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from dataset");
+            } /* end if */
+            else if (H5_daos_dataset_write_int(dset, mem_type_id[i], mem_space_id[i], file_space_id[i],
+                                               need_tconv, wbuf[i], NULL, int_req, &first_task,
+                                               &dset_dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+        } /* end if */
+        else {
+            tse_task_t *io_deps[2];
+            unsigned    nio_deps = 0;
+
+            /* Allocate argument struct */
+            if (NULL == (task_ud = (H5_daos_io_task_ud_t *)DV_calloc(sizeof(H5_daos_io_task_ud_t))))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                             "can't allocate space for I/O task udata struct");
+            task_ud->req           = int_req;
+            task_ud->io_type       = io_type;
+            task_ud->dset          = dset;
+            task_ud->mem_type_id   = H5I_INVALID_HID;
+            task_ud->mem_space_id  = H5I_INVALID_HID;
+            task_ud->file_space_id = H5I_INVALID_HID;
+            if (io_type == IO_READ)
+                task_ud->buf.rbuf = rbuf[i];
+            else
+                task_ud->buf.wbuf = wbuf[i];
+
+            /* Copy dataspaces and datatype */
+            if ((task_ud->mem_type_id = H5Tcopy(mem_type_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory type ID");
+            if (mem_space_id[i] == H5S_ALL)
+                task_ud->mem_space_id = H5S_ALL;
+            else if ((task_ud->mem_space_id = H5Scopy(mem_space_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory space ID");
+            if (file_space_id[i] == H5S_ALL)
+                task_ud->file_space_id = H5S_ALL;
+            else if ((task_ud->file_space_id = H5Scopy(file_space_id[i])) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file space ID");
+
+            /* Create end task for I/O on this dataset */
+            if (H5_daos_create_task(H5_daos_dset_io_int_end_task, 0, NULL, NULL, NULL, task_ud,
+                                    &task_ud->end_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create task to finish performing I/O operation");
+
+            /* Create task to perform I/O on this dataset once it is open */
+            io_deps[nio_deps++] = first_task;
+            if (dset->obj.item.open_req->status == -H5_DAOS_INCOMPLETE ||
+                dset->obj.item.open_req->status == -H5_DAOS_SHORT_CIRCUIT)
+                io_deps[nio_deps++] = dset->obj.item.open_req->finalize_task;
+            if (H5_daos_create_task(H5_daos_dset_io_int_task, nio_deps, io_deps, NULL, NULL, task_ud,
+                                    &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform I/O operation");
+
+            /* Schedule task and give it a reference to req and dset */
+            if (0 != (ret = tse_task_schedule(io_task, false)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't schedule task to perform I/O operation: %s", H5_daos_err_to_string(ret));
+            dset_dep_task = task_ud->end_task;
+            dset->obj.item.rc++;
+            int_req->rc++;
+            task_ud = NULL;
+        } /* end else */
+
+        /* Set up dependency on this dataset's I/O for end task */
+        if (dset_dep_task && 0 != (ret = tse_task_register_deps(end_task, 1, &dset_dep_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on dataset I/O: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end for */
+
+done:
+    /* Schedule end task */
+    if (end_task) {
+        if (0 != (ret = tse_task_schedule(end_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for multi-dataset I/O: %s",
+                         H5_daos_err_to_string(ret));
+        dep_task = end_task;
+    } /* end if */
+    else
+        dep_task = first_task;
+
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the request queue of the (first) file */
+        if (H5_daos_req_enqueue(int_req, first_task, &((H5_daos_dset_t *)_dset[0])->obj.item,
+                                io_type == IO_READ ? H5_DAOS_OP_TYPE_READ : H5_DAOS_OP_TYPE_WRITE, op_scope,
+                                FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "multi-dataset %s failed in task \"%s\": %s",
+                             io_type == IO_READ ? "read" : "write", int_req->failed_task,
+                             H5_daos_err_to_string(int_req->status));
+
+            /* Release our reference to the internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    /* Cleanup on error */
+    if (task_ud) {
+        assert(ret_value < 0);
+        if (task_ud->mem_type_id >= 0 && H5Tclose(task_ud->mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if (task_ud->mem_space_id >= 0 && task_ud->mem_space_id != H5S_ALL &&
+            H5Sclose(task_ud->mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        if (task_ud->file_space_id >= 0 && task_ud->file_space_id != H5S_ALL &&
+            H5Sclose(task_ud->file_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
+        task_ud = DV_free(task_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_io_multi() */
+#endif
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_read
+ *
+ * Purpose:     Reads raw data from a dataset into a buffer.
+ *`
+ * Return:      Success:        0
+ *              Failure:        -1, dataset not read.
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+#if H5VL_VERSION >= 3
+herr_t
+H5_daos_dataset_read(size_t count, void *_dset[], hid_t mem_type_id[], hid_t mem_space_id[],
+                     hid_t file_space_id[], hid_t dxpl_id, void *buf[], void **req)
+#else
+herr_t
+H5_daos_dataset_read(void *_dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
+                     void *buf, void **req)
+#endif
+{
+    H5_daos_dset_t       *dset       = NULL;
+    H5_daos_io_task_ud_t *task_ud    = NULL;
+    tse_task_t           *io_task    = NULL;
+    tse_task_t           *first_task = NULL;
+    tse_task_t           *dep_task   = NULL;
+    H5_daos_req_t        *int_req    = NULL;
+    htri_t                need_tconv = FALSE;
+    htri_t                coll_io    = FALSE;
+    hid_t                 req_dxpl_id;
+    hid_t                 local_mem_type_id   = H5I_INVALID_HID;
+    hid_t                 local_mem_space_id  = H5I_INVALID_HID;
+    hid_t                 local_file_space_id = H5I_INVALID_HID;
+    void                 *local_buf           = NULL;
+    int                   ret;
+    herr_t                ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    /* Set convenience variables to handle VOL structure versioning */
+#if H5VL_VERSION >= 3
+    dset                = (H5_daos_dset_t *)_dset[0];
+    local_mem_type_id   = mem_type_id[0];
+    local_mem_space_id  = mem_space_id[0];
+    local_file_space_id = file_space_id[0];
+    local_buf           = buf[0];
+#else
+    dset                = (H5_daos_dset_t *)_dset;
+    local_mem_type_id   = mem_type_id;
+    local_mem_space_id  = mem_space_id;
+    local_file_space_id = file_space_id;
+    local_buf           = buf;
+#endif
+
+    if (!dset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
+    if (H5I_DATASET != dset->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+
+#if H5VL_VERSION >= 3
+    /* Handle multi-dataset I/O separately */
+    if (count > 1) {
+        if (H5_daos_dataset_io_multi(count, _dset, mem_type_id, mem_space_id, file_space_id, dxpl_id, buf,
+                                     NULL, req) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from datasets");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+#endif
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Check if collective buffering was requested */
+    if ((coll_io = H5_daos_dset_coll_io_requested(dset, dxpl_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if collective I/O was requested");
+
+    /* If the dataset's datatype is complete, check if type conversion is needed
+     */
+    if (dset->obj.item.open_req->status == 0 || dset->obj.item.created) {
+        /* Check if datatype conversion is needed */
+        if ((need_tconv = H5_daos_need_tconv(dset->file_type_id, local_mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+        req_dxpl_id = need_tconv ? dxpl_id : H5P_DATASET_XFER_DEFAULT;
+    } /* end if */
+    else
+        req_dxpl_id = dxpl_id;
+
+    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+    if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset read", dset->obj.item.open_req,
+                                              NULL, NULL, req_dxpl_id)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Check if we can call the internal routine directly -  the dataset open
+     * must be complete and there must not be an in-flight set_extent. */
+    if ((dset->obj.item.open_req->status == 0) && (dset->cur_set_extent_space_id == H5I_INVALID_HID)) {
+        /* Call internal routine */
+        if (coll_io) {
+            if (H5_daos_dataset_coll_io(dset, local_mem_type_id, local_mem_space_id, local_file_space_id,
+                                        need_tconv, IO_READ, local_buf, NULL, int_req, &first_task,
+                                        &dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from dataset");
+        } /* end if */
+        else if (H5_daos_dataset_read_int(dset, local_mem_type_id, local_mem_space_id, local_file_space_id,
+                                          need_tconv, local_buf, NULL, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from dataset");
+    } /* end if */
+    else {
+        /* Allocate argument struct */
+        if (NULL == (task_ud = (H5_daos_io_task_ud_t *)DV_calloc(sizeof(H5_daos_io_task_ud_t))))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for I/O task udata struct");
+        task_ud->req           = int_req;
+        task_ud->io_type       = IO_READ;
+        task_ud->dset          = dset;
+        task_ud->mem_type_id   = H5I_INVALID_HID;
+        task_ud->mem_space_id  = H5I_INVALID_HID;
+        task_ud->file_space_id = H5I_INVALID_HID;
+        task_ud->buf.rbuf      = local_buf;
+        task_ud->coll          = (hbool_t)coll_io;
+
+        /* Copy dataspaces and datatype */
+        if ((task_ud->mem_type_id = H5Tcopy(local_mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory type ID");
+        if (local_mem_space_id == H5S_ALL)
+            task_ud->mem_space_id = H5S_ALL;
+        else if ((task_ud->mem_space_id = H5Scopy(local_mem_space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory space ID");
+        if (local_file_space_id == H5S_ALL)
+            task_ud->file_space_id = H5S_ALL;
+        else if ((task_ud->file_space_id = H5Scopy(local_file_space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file space ID");
+
+        /* Create end task for reading data */
+        if (H5_daos_create_task(H5_daos_dset_io_int_end_task, 0, NULL, NULL, NULL, task_ud,
+                                &task_ud->end_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create task to finish performing I/O operation");
+
+        /* Create task to read data */
+        if (H5_daos_create_task(H5_daos_dset_io_int_task, 0, NULL, NULL, NULL, task_ud, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform I/O operation");
+
+        /* Save task to be scheduled later and give it a reference to req and
+         * dset */
+        assert(!first_task);
+        first_task = io_task;
+        dep_task   = task_ud->end_task;
+        dset->obj.item.rc++;
+        int_req->rc++;
+        task_ud = NULL;
+    } /* end else */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the object's request queue.  This will add the
+         * dependency on the dataset open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, (hbool_t)coll_io, !req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "dataset read failed in task \"%s\": %s",
+                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+            /* Release our reference to the internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    /* Cleanup on error */
+    if (task_ud) {
+        assert(ret_value < 0);
+        if (task_ud->mem_type_id >= 0 && H5Tclose(task_ud->mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if (task_ud->mem_space_id >= 0 && task_ud->mem_space_id != H5S_ALL &&
+            H5Sclose(task_ud->mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        if (task_ud->file_space_id >= 0 && task_ud->file_space_id != H5S_ALL &&
+            H5Sclose(task_ud->file_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
+        task_ud = DV_free(task_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_read() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_write_int
+ *
+ * Purpose:     Internal version of H5_daos_dataset_write().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset not written.
+ *
+ * Programmer:  Neil Fortner
+ *              July, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_write_int(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                          htri_t need_tconv, const void *buf, tse_task_t *_end_task, H5_daos_req_t *req,
+                          tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_select_chunk_info_t *chunk_info = NULL; /* Array of info for each chunk selected in the file */
+    H5_daos_chunk_io_func        single_chunk_write_func;
+    uint64_t                     i;
+    size_t                       nchunks_sel;
+    uint8_t                     *index_akey_buf  = NULL;
+    unsigned                     nnew_chunks     = 0;
+    hbool_t                      use_chunk_cache = FALSE;
+    hid_t                        real_file_space_id;
+    hid_t                        real_mem_space_id;
+    int                          ndims;
+    hssize_t                     num_elem_file = -1, num_elem_mem;
+    tse_task_t                  *io_task       = NULL;
+    tse_task_t                  *end_task      = _end_task;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+    assert(dset->obj.item.file->flags & H5F_ACC_RDWR);
+
+    /* Get dataspace extent */
+    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of dimensions");
+
+    /* Get "real" space ids */
+    if (file_space_id == H5S_ALL)
+        real_file_space_id = dset->space_id;
+    else
+        real_file_space_id = file_space_id;
+    if (mem_space_id == H5S_ALL)
+        real_mem_space_id = real_file_space_id;
+    else
+        real_mem_space_id = mem_space_id;
+
+    /* Get number of elements in selections */
+    if ((num_elem_file = H5Sget_select_npoints(real_file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in file selection");
+    if ((num_elem_mem = H5Sget_select_npoints(real_mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in memory selection");
+
+    /* Various sanity and special case checks */
+    if (num_elem_file != num_elem_mem)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                     "number of elements selected in file and memory dataspaces is different");
+    if (num_elem_file && !buf)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "write buffer is NULL but selection has >0 elements");
+    if (num_elem_file == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Compact datasets stored with their metadata are written through the
+     * copy of their raw data in memory */
+    if (dset->compact.stored) {
+        io_task = *dep_task;
+        if (H5_daos_dataset_io_compact(dset, mem_type_id, real_mem_space_id, real_file_space_id,
+                                       (hbool_t)need_tconv, IO_WRITE, buf, req, first_task, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
+
+        /* Set up dependency on io_task for end task */
+        if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create dependency on compact dataset I/O task: %s",
+                         H5_daos_err_to_string(ret));
+
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Fill dataset I/O cache if it hasn't already been filled */
+    if (!dset->io_cache.filled && H5_daos_dset_fill_io_cache(dset, real_file_space_id, real_mem_space_id) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize dataset I/O cache");
+
+    /* Check for the dataset having a chunked storage layout. If it does not,
+     * simply set up the dataset as a single "chunk".
+     */
+    switch (dset->dcpl_cache.layout) {
+        case H5D_COMPACT:
+        case H5D_CONTIGUOUS:
+            chunk_info  = dset->io_cache.chunk_info;
+            nchunks_sel = 1;
+
+            /* Set up "single-chunk dataset", with the "chunk" starting at coordinate 0 */
+            chunk_info->fspace_id         = real_file_space_id;
+            chunk_info->mspace_id         = real_mem_space_id;
+            chunk_info->num_elem_sel_file = num_elem_file;
+            memset(chunk_info->chunk_coords, 0, sizeof(chunk_info->chunk_coords));
+
+            break;
+
+        case H5D_CHUNKED: {
+            htri_t sel_regular = FALSE;
+
+            /* If no type conversion or filtering is needed and the selections
+             * are regular, compute the selected chunks arithmetically without
+             * creating per-chunk dataspaces */
+            if (!need_tconv && dset->dcpl_cache.nfilters == 0)
+                if ((sel_regular = H5_daos_get_selected_chunk_info_regular(
+                         dset, real_file_space_id, real_mem_space_id, &nchunks_sel)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+
+            /* Otherwise get the coordinates of the currently selected chunks in the file, setting up
+             * memory and file dataspaces for them */
+            if (!sel_regular)
+                if (H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
+                                                    &dset->io_cache.chunk_info,
+                                                    &dset->io_cache.chunk_info_nalloc, &nchunks_sel) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+            chunk_info = dset->io_cache.chunk_info;
+
+            break;
+        } /* case H5D_CHUNKED */
+
+        case H5D_LAYOUT_ERROR:
+        case H5D_NLAYOUTS:
+        case H5D_VIRTUAL:
+        default:
+            D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL,
+                         "invalid, unknown or unsupported dataset storage layout type");
+    } /* end switch */
+    assert(nchunks_sel > 0);
+
+    /* Setup the appropriate function for writing the selected chunks */
+    if (dset->dcpl_cache.nfilters > 0)
+        /* Chunks must pass through the filter pipeline */
+        single_chunk_write_func =
+            need_tconv ? H5_daos_dataset_io_filtered_types_unequal : H5_daos_dataset_io_filtered_types_equal;
+    else if (need_tconv)
+        /* Type conversion necessary */
+        single_chunk_write_func = H5_daos_dataset_io_types_unequal;
+    else
+        /* No type conversion necessary */
+        single_chunk_write_func = H5_daos_dataset_io_types_equal;
+
+    /* I/O that bypasses the chunk cache must not conflict with cached chunks,
+     * including those cached by other handles of the dataset, so write back
+     * and drop them first */
+    if (dset->dcpl_cache.layout == H5D_CHUNKED &&
+        H5_daos_chunk_cache_sync(dset, (hbool_t)need_tconv, &use_chunk_cache, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't synchronize chunk caches");
+
+    /* Add the selected chunks to the chunk index */
+    if (dset->dcpl_cache.layout == H5D_CHUNKED &&
+        H5_daos_chunk_index_add(dset, chunk_info, nchunks_sel, ndims, &index_akey_buf, &nnew_chunks) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunks to chunk index");
+
+    /* Set up coordination metatasks if there is more than one chunk selected,
+     * or if the chunk index must be updated alongside the I/O */
+    if (nchunks_sel > 1 || nnew_chunks > 0) {
+        /* Set up empty first task for coordination if there isn't one already */
+        if (!*first_task) {
+            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, first_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create first metatask for dataset write");
+            *dep_task = *first_task;
+        } /* end if */
+
+        /* Set up empty end task for coordination if not already provided */
+        if (!end_task) {
+            if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &end_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create last metatask for dataset write");
+        }
+    } /* end if */
+
+    /* Record the newly allocated chunks in the file's chunk index */
+    if (nnew_chunks > 0) {
+        /* H5_daos_chunk_index_write() takes ownership of the akey buffer */
+        io_task   = *dep_task;
+        ret_value = H5_daos_chunk_index_write(dset, index_akey_buf, nnew_chunks, ndims, FALSE, FALSE, req,
+                                              first_task, &io_task);
+
+        index_akey_buf = NULL;
+        if (ret_value < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunk index");
+
+        /* Set up dependency on io_task for end task */
+        assert(end_task);
+        if (0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk index task: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+
+    /* Perform I/O on each chunk selected.  If the dataset's chunk cache
+     * can be used, go through the cache.
+     * Otherwise, if there is more than one chunk and no type conversion
+     * or filtering is needed, perform the I/O in batches of chunks to cut
+     * down on per-chunk overhead. */
+    if (use_chunk_cache)
+        for (i = 0; i < nchunks_sel; i++) {
+            union {
+                const void *const_buf;
+                void       *buf;
+            } safe_buf = {.const_buf = buf};
+
+            io_task = *dep_task;
+            if (H5_daos_chunk_cache_io(&chunk_info[i], dset, (uint64_t)ndims, IO_WRITE, safe_buf.buf,
+                                       req, first_task, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
+
+            /* Set up dependency on io_task for end task */
+            assert(io_task);
+            if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create dependency on chunk cache I/O task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end for */
+    else if (!need_tconv && dset->dcpl_cache.nfilters == 0 && nchunks_sel > 1 &&
+             H5_daos_chunk_task_batch_size_g > 1) {
+        size_t batch_nchunks;
+        union {
+            const void *const_buf;
+            void       *buf;
+        } safe_buf = {.const_buf = buf};
+
+        for (i = 0; i < nchunks_sel; i += batch_nchunks) {
+            batch_nchunks = (size_t)MIN(H5_daos_chunk_task_batch_size_g, nchunks_sel - i);
+
+            io_task = *dep_task;
+            if (H5_daos_dataset_io_types_equal_task_batch(&chunk_info[i], batch_nchunks, dset,
+                                                          (uint64_t)ndims, IO_WRITE, safe_buf.buf, req,
+                                                          first_task, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
+
+            /* Set up dependency on io_task for end task */
+            assert(io_task);
+            if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create dependency on chunk batch I/O task: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end for */
+    }     /* end if */
+    else
+        for (i = 0; i < nchunks_sel; i++) {
+            union {
+                const void *const_buf;
+                void       *buf;
+            } safe_buf = {.const_buf = buf};
+
+            io_task = *dep_task;
+            if (single_chunk_write_func(&chunk_info[i], dset, (uint64_t)ndims, mem_type_id, IO_WRITE,
+                                        safe_buf.buf, req, first_task, &io_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "dataset write failed");
+
+            /* Set up dependency on io_task for end task */
+            assert(io_task);
+            if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't create dependency on chunk I/O task: %s", H5_daos_err_to_string(ret));
+        } /* end for */
+
+done:
+    DV_free(index_akey_buf);
+
+    /* Schedule end_task if appropriate and update *dep_task */
+    if (end_task) {
+        if (0 != (ret = tse_task_schedule(end_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for IO operation: %s",
+                         H5_daos_err_to_string(ret));
+        *dep_task = end_task;
+    } /* end if */
+    else
+        *dep_task = io_task;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_write_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_coll_io_requested
+ *
+ * Purpose:     Checks if I/O with the specified DXPL should use
+ *              collective buffering, i.e. the file is open on more than
+ *              one process and the DXPL requests collective transfer
+ *              with collective (not individual) low level I/O.
+ *
+ * Return:      Success:        TRUE or FALSE
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_dset_coll_io_requested(H5_daos_dset_t *dset, hid_t dxpl_id)
+{
+    H5FD_mpio_xfer_t           xfer_mode;
+    H5FD_mpio_collective_opt_t coll_opt;
+    htri_t                     ret_value = FALSE;
+
+    assert(dset);
+
+    if (dset->obj.item.file->num_procs <= 1)
+        D_GOTO_DONE(FALSE);
+
+    if (H5Pget_dxpl_mpio(dxpl_id, &xfer_mode) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI-I/O transfer mode");
+    if (xfer_mode != H5FD_MPIO_COLLECTIVE)
+        D_GOTO_DONE(FALSE);
+    if (H5Pget_dxpl_mpio_collective_opt(dxpl_id, &coll_opt) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get MPI-I/O collective optimization");
+    ret_value = coll_opt == H5FD_MPIO_COLLECTIVE_IO;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_coll_io_requested() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_chunk_idx
+ *
+ * Purpose:     Computes the index of a chunk in the dataset's chunk grid,
+ *              in row-major order, from its starting coordinates.
+ *
+ * Return:      The chunk index
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_coll_chunk_idx(H5_daos_coll_ud_t *coll_ud, const uint64_t *chunk_coords)
+{
+    uint64_t idx = 0;
+    int      i;
+
+    for (i = 0; i < coll_ud->ndims; i++)
+        idx = (idx * coll_ud->grid_dims[i]) + (chunk_coords[i] / coll_ud->dset->dcpl_cache.chunk_dims[i]);
+
+    return idx;
+} /* end H5_daos_coll_chunk_idx() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_recx_cmp
+ *
+ * Purpose:     qsort() callback to sort DAOS records by offset.
+ *
+ * Return:      Negative, zero or positive
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_recx_cmp(const void *_recx1, const void *_recx2)
+{
+    const daos_recx_t *recx1 = (const daos_recx_t *)_recx1;
+    const daos_recx_t *recx2 = (const daos_recx_t *)_recx2;
+
+    if (recx1->rx_idx < recx2->rx_idx)
+        return -1;
+    if (recx1->rx_idx > recx2->rx_idx)
+        return 1;
+    return 0;
+} /* end H5_daos_coll_recx_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_piece_cmp
+ *
+ * Purpose:     qsort() callback to sort pointers to received pieces by
+ *              chunk, keeping pieces of the same chunk in the order they
+ *              were received.
+ *
+ * Return:      Negative, zero or positive
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_piece_cmp(const void *_piece1, const void *_piece2)
+{
+    const H5_daos_coll_piece_t *piece1 = *(H5_daos_coll_piece_t *const *)_piece1;
+    const H5_daos_coll_piece_t *piece2 = *(H5_daos_coll_piece_t *const *)_piece2;
+
+    if (piece1->chunk_idx != piece2->chunk_idx)
+        return piece1->chunk_idx < piece2->chunk_idx ? -1 : 1;
+    if (piece1->seq != piece2->seq)
+        return piece1->seq < piece2->seq ? -1 : 1;
+    return 0;
+} /* end H5_daos_coll_piece_cmp() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_set_counts
+ *
+ * Purpose:     Converts the per-process byte counts in sizes to MPI
+ *              counts and computes the matching displacements.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_coll_set_counts(const size_t *sizes, int nprocs, int *counts, int *displs, size_t *total)
+{
+    size_t tot       = 0;
+    int    i;
+    herr_t ret_value = SUCCEED;
+
+    for (i = 0; i < nprocs; i++) {
+        if (sizes[i] > (size_t)INT_MAX || tot + sizes[i] > (size_t)INT_MAX)
+            D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "collective buffering exchange is too large");
+        counts[i] = (int)sizes[i];
+        displs[i] = (int)tot;
+        tot += sizes[i];
+    } /* end for */
+
+    *total = tot;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_set_counts() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_alltoall_task
+ *
+ * Purpose:     Asynchronous task that exchanges the number of bytes each
+ *              process will send to each other process in a collective
+ *              buffering exchange, using MPI_Ialltoall.  The exchange is
+ *              performed even if the request has failed, with nothing to
+ *              send, so the other processes do not wait forever.  This
+ *              task is completed by the progress functions once the MPI
+ *              request is finished.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_alltoall_task(tse_task_t *task)
+{
+    H5_daos_coll_xchg_t *xchg;
+    int                  ret_value = 0;
+
+    assert(!H5_daos_mpi_task_g);
+
+    /* Get private data */
+    if (NULL == (xchg = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for MPI all-to-all task");
+
+    assert(xchg->coll_ud);
+    assert(xchg->coll_ud->req);
+
+    /* Send nothing if the request has failed, and expect nothing back for
+     * reads */
+    if (xchg->coll_ud->req->status < -H5_DAOS_INCOMPLETE) {
+        (void)memset(xchg->send_counts, 0, (size_t)xchg->coll_ud->nprocs * sizeof(int));
+        (void)memset(xchg->coll_ud->resp_xchg.recv_counts, 0, (size_t)xchg->coll_ud->nprocs * sizeof(int));
+    } /* end if */
+
+    /* Make call to MPI_Ialltoall */
+    if (MPI_SUCCESS != MPI_Ialltoall(xchg->send_counts, 1, MPI_INT, xchg->recv_counts, 1, MPI_INT,
+                                     xchg->coll_ud->req->file->comm, &H5_daos_mpi_req_g))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ialltoall failed");
+
+    /* Register this task as the current in-flight MPI task */
+    H5_daos_mpi_task_g = task;
+
+    /* This task will be completed by the progress function once that function
+     * detects that the MPI request is finished */
+
+done:
+    if (ret_value < 0) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_alltoall_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_alltoallv_task
+ *
+ * Purpose:     Asynchronous task that performs a collective buffering
+ *              exchange using MPI_Ialltoallv, once the number of bytes to
+ *              receive from each process is known.  Allocates the receive
+ *              buffer.  Like H5_daos_coll_alltoall_task(), the exchange is
+ *              performed even if the request has failed.  This task is
+ *              completed by the progress functions once the MPI request
+ *              is finished.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_alltoallv_task(tse_task_t *task)
+{
+    H5_daos_coll_xchg_t *xchg;
+    size_t              *sizes = NULL;
+    size_t               recv_size;
+    int                  i;
+    int                  ret_value = 0;
+
+    assert(!H5_daos_mpi_task_g);
+
+    /* Get private data */
+    if (NULL == (xchg = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for MPI all-to-all task");
+
+    assert(xchg->coll_ud);
+    assert(xchg->coll_ud->req);
+    assert(!xchg->recv_buf);
+
+    /* Compute receive displacements and allocate receive buffer */
+    if (NULL == (sizes = (size_t *)DV_malloc((size_t)xchg->coll_ud->nprocs * sizeof(size_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate receive sizes");
+    for (i = 0; i < xchg->coll_ud->nprocs; i++)
+        sizes[i] = (size_t)xchg->recv_counts[i];
+    if (H5_daos_coll_set_counts(sizes, xchg->coll_ud->nprocs, xchg->recv_counts, xchg->recv_displs,
+                                &recv_size) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_MPI_ERROR, "can't compute receive displacements");
+    if (recv_size > 0 && NULL == (xchg->recv_buf = (uint8_t *)DV_malloc(recv_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate receive buffer");
+
+    /* Make call to MPI_Ialltoallv */
+    if (MPI_SUCCESS != MPI_Ialltoallv(xchg->send_buf, xchg->send_counts, xchg->send_displs, MPI_BYTE,
+                                      xchg->recv_buf, xchg->recv_counts, xchg->recv_displs, MPI_BYTE,
+                                      xchg->coll_ud->req->file->comm, &H5_daos_mpi_req_g))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Ialltoallv failed");
+
+    /* Register this task as the current in-flight MPI task */
+    H5_daos_mpi_task_g = task;
+
+    /* This task will be completed by the progress function once that function
+     * detects that the MPI request is finished */
+
+done:
+    DV_free(sizes);
+
+    if (ret_value < 0) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_alltoallv_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_parse
+ *
+ * Purpose:     Parses the chunk pieces received by this process in a
+ *              collective buffering exchange.  Each piece holds the
+ *              coordinates of the chunk, the number of records, the
+ *              records (offset and length, in elements, within the chunk)
+ *              and, for writes, the data for the records.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_coll_parse(H5_daos_coll_ud_t *coll_ud)
+{
+    H5_daos_coll_piece_t *tmp_pieces;
+    const uint8_t        *p;
+    const uint8_t        *end;
+    const uint8_t        *recx_p;
+    size_t                nalloc = 0;
+    size_t                hdr_size;
+    uint64_t              nrecxs;
+    uint64_t              rx_nr;
+    uint64_t              j;
+    int                   i;
+    herr_t                ret_value = SUCCEED;
+
+    assert(coll_ud);
+    assert(!coll_ud->parsed);
+
+    coll_ud->parsed = TRUE;
+    hdr_size        = ((size_t)coll_ud->ndims + 1) * sizeof(uint64_t);
+
+    for (i = 0; i < coll_ud->nprocs; i++) {
+        p   = coll_ud->xchg.recv_buf + coll_ud->xchg.recv_displs[i];
+        end = p + coll_ud->xchg.recv_counts[i];
+
+        while (p < end) {
+            H5_daos_coll_piece_t *piece;
+
+            /* Make room for the piece */
+            if (coll_ud->npieces == nalloc) {
+                nalloc = nalloc ? 2 * nalloc : 64;
+                if (NULL == (tmp_pieces = (H5_daos_coll_piece_t *)DV_realloc(
+                                 coll_ud->pieces, nalloc * sizeof(H5_daos_coll_piece_t))))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk piece list");
+                coll_ud->pieces = tmp_pieces;
+            } /* end if */
+            piece = &coll_ud->pieces[coll_ud->npieces];
+
+            /* Decode header */
+            if ((size_t)(end - p) < hdr_size)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, FAIL, "truncated chunk piece header");
+            piece->src      = i;
+            piece->seq      = coll_ud->npieces;
+            piece->chunk    = SIZE_MAX;
+            piece->coords_p = p;
+            p += (size_t)coll_ud->ndims * sizeof(uint64_t);
+            UINT64DECODE(p, nrecxs);
+            if (nrecxs > (uint64_t)(end - p) / (2 * sizeof(uint64_t)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, FAIL, "truncated chunk piece records");
+            piece->nrecxs  = (size_t)nrecxs;
+            piece->recxs_p = p;
+            p += (size_t)nrecxs * 2 * sizeof(uint64_t);
+
+            /* Count elements */
+            piece->nelem = 0;
+            recx_p       = piece->recxs_p;
+            for (j = 0; j < nrecxs; j++) {
+                recx_p += sizeof(uint64_t);
+                UINT64DECODE(recx_p, rx_nr);
+                piece->nelem += (size_t)rx_nr;
+            } /* end for */
+
+            /* Point to data */
+            if (coll_ud->io_type == IO_WRITE) {
+                if (piece->nelem > (size_t)(end - p) / coll_ud->dset->file_type_size)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, FAIL, "truncated chunk piece data");
+                piece->data = p;
+                p += piece->nelem * coll_ud->dset->file_type_size;
+            } /* end if */
+            else
+                piece->data = NULL;
+
+            piece->chunk_idx = 0;
+            coll_ud->npieces++;
+        } /* end while */
+    }     /* end for */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_parse() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_chunk_prep_cb
+ *
+ * Purpose:     Prepare callback for daos_obj_update or daos_obj_fetch
+ *              of a chunk by its owner in collective buffering I/O.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_chunk_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_coll_chunk_t *udata;
+    daos_obj_rw_t        *rw_args;
+    int                   ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
+
+    assert(udata->coll_ud);
+    assert(udata->coll_ud->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->coll_ud->req, H5E_IO);
+
+    /* Skip reading chunks that were never written */
+    if (udata->coll_ud->io_type == IO_READ &&
+        H5_daos_chunk_index_absent(udata->coll_ud->dset, &udata->dkey)) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
+    } /* end if */
+
+    /* Set I/O task arguments */
+    if (NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get arguments for chunk I/O task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh   = udata->coll_ud->dset->obj.obj_oh;
+    rw_args->th   = udata->coll_ud->req->th;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr   = 1;
+    rw_args->iods = &udata->iod;
+    rw_args->sgls = &udata->sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_chunk_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_chunk_comp_cb
+ *
+ * Purpose:     Complete callback for daos_obj_update or daos_obj_fetch of
+ *              a chunk by its owner in collective buffering I/O.  Checks
+ *              for a failed task.  The chunk is freed with the rest of
+ *              the collective buffering user data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_chunk_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_coll_chunk_t *udata;
+    int                   ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk I/O task");
+
+    /* Handle errors in I/O task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->coll_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->coll_ud->req->status      = task->dt_result;
+        udata->coll_ud->req->failed_task = "collective buffering raw data I/O";
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_chunk_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_chunk_task
+ *
+ * Purpose:     Asynchronous task that groups the chunk pieces received by
+ *              this process in a collective buffering exchange by chunk
+ *              and performs a single update (for writes) or fetch (for
+ *              reads) for each chunk.  The records of all pieces of a
+ *              chunk are merged, so overlapping and adjacent records
+ *              become one.  For writes, where pieces overlap the piece
+ *              from the higher ranked process is written.  This task is
+ *              completed once all chunks have been updated or fetched.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_chunk_task(tse_task_t *task)
+{
+    H5_daos_coll_ud_t     *udata;
+    H5_daos_coll_piece_t **sorted      = NULL;
+    tse_task_t           **chunk_tasks = NULL;
+    tse_task_t            *comp_task   = NULL;
+    uint64_t               chunk_coords[H5S_MAX_RANK];
+    hsize_t                chunk_nelem = 1;
+    hbool_t                complete    = TRUE;
+    size_t                 file_type_size;
+    size_t                 nrecxs;
+    size_t                 i, j, k;
+    int                    ret;
+    int                    ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for collective buffering chunk task");
+
+    assert(udata->req);
+    assert(udata->dset);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    file_type_size = udata->dset->file_type_size;
+    for (i = 0; i < (size_t)udata->ndims; i++)
+        chunk_nelem *= udata->dset->dcpl_cache.chunk_dims[i];
+
+    /* Parse the pieces and sort them by chunk */
+    if (H5_daos_coll_parse(udata) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, -H5_DAOS_H5_DECODE_ERROR, "can't parse chunk pieces");
+    if (udata->npieces == 0)
+        D_GOTO_DONE(0);
+    if (NULL ==
+        (sorted = (H5_daos_coll_piece_t **)DV_malloc(udata->npieces * sizeof(H5_daos_coll_piece_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate sorted piece list");
+    for (i = 0; i < udata->npieces; i++) {
+        const uint8_t *p = udata->pieces[i].coords_p;
+
+        for (j = 0; j < (size_t)udata->ndims; j++)
+            UINT64DECODE(p, chunk_coords[j]);
+        udata->pieces[i].chunk_idx = H5_daos_coll_chunk_idx(udata, chunk_coords);
+        sorted[i]                  = &udata->pieces[i];
+    } /* end for */
+    qsort(sorted, udata->npieces, sizeof(H5_daos_coll_piece_t *), H5_daos_coll_piece_cmp);
+
+    /* Allocate chunks */
+    udata->nchunks = 1;
+    for (i = 1; i < udata->npieces; i++)
+        if (sorted[i]->chunk_idx != sorted[i - 1]->chunk_idx)
+            udata->nchunks++;
+    if (NULL ==
+        (udata->chunks = (H5_daos_coll_chunk_t *)DV_calloc(udata->nchunks * sizeof(H5_daos_coll_chunk_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk list");
+    if (NULL == (chunk_tasks = (tse_task_t **)DV_calloc(udata->nchunks * sizeof(tse_task_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk task list");
+
+    /* Set up I/O for each chunk */
+    for (i = 0, j = 0; i < udata->nchunks; i++) {
+        H5_daos_coll_chunk_t *chunk = &udata->chunks[i];
+        const uint8_t        *p;
+        uint8_t              *dkey_p;
+        size_t                first = j;
+
+        chunk->coll_ud = udata;
+
+        /* Find the pieces of this chunk and count their records */
+        nrecxs = 0;
+        do {
+            sorted[j]->chunk = i;
+            nrecxs += sorted[j]->nrecxs;
+            j++;
+        } while (j < udata->npieces && sorted[j]->chunk_idx == sorted[first]->chunk_idx);
+
+        /* Encode dkey (chunk coordinates).  Prefix with '\0' to avoid
+         * accidental collisions with other d-keys in this object. */
+        p         = sorted[first]->coords_p;
+        dkey_p    = chunk->dkey_buf;
+        *dkey_p++ = (uint8_t)'\0';
+        for (k = 0; k < (size_t)udata->ndims; k++) {
+            UINT64DECODE(p, chunk->chunk_coords[k]);
+            UINT64ENCODE(dkey_p, chunk->chunk_coords[k]);
+        } /* end for */
+        daos_iov_set(&chunk->dkey, chunk->dkey_buf,
+                     (daos_size_t)(1 + ((size_t)udata->ndims * sizeof(chunk->chunk_coords[0]))));
+
+        /* Allocate the chunk buffer and the records */
+        if (NULL == (chunk->buf = (uint8_t *)DV_malloc((size_t)chunk_nelem * file_type_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk buffer");
+        if (NULL == (chunk->recxs = (daos_recx_t *)DV_malloc(nrecxs * sizeof(daos_recx_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk records");
+
+        /* Collect the records, copying written data into the chunk buffer
+         * in the order the pieces were received */
+        nrecxs = 0;
+        for (k = first; k < j; k++) {
+            const uint8_t *recx_p = sorted[k]->recxs_p;
+            const uint8_t *data   = sorted[k]->data;
+            size_t         l;
+
+            for (l = 0; l < sorted[k]->nrecxs; l++) {
+                UINT64DECODE(recx_p, chunk->recxs[nrecxs].rx_idx);
+                UINT64DECODE(recx_p, chunk->recxs[nrecxs].rx_nr);
+                if (chunk->recxs[nrecxs].rx_nr > (uint64_t)chunk_nelem ||
+                    chunk->recxs[nrecxs].rx_idx > (uint64_t)chunk_nelem - chunk->recxs[nrecxs].rx_nr)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                                 "chunk piece record lies outside chunk");
+                if (data) {
+                    (void)memcpy(chunk->buf + chunk->recxs[nrecxs].rx_idx * file_type_size, data,
+                                 (size_t)chunk->recxs[nrecxs].rx_nr * file_type_size);
+                    data += (size_t)chunk->recxs[nrecxs].rx_nr * file_type_size;
+                } /* end if */
+                nrecxs++;
+            } /* end for */
+        }     /* end for */
+
+        /* Merge overlapping and adjacent records */
+        qsort(chunk->recxs, nrecxs, sizeof(daos_recx_t), H5_daos_coll_recx_cmp);
+        for (k = 1, chunk->iod.iod_nr = 1; k < nrecxs; k++) {
+            daos_recx_t *last = &chunk->recxs[chunk->iod.iod_nr - 1];
+
+            if (chunk->recxs[k].rx_idx <= last->rx_idx + last->rx_nr) {
+                if (chunk->recxs[k].rx_idx + chunk->recxs[k].rx_nr > last->rx_idx + last->rx_nr)
+                    last->rx_nr = chunk->recxs[k].rx_idx + chunk->recxs[k].rx_nr - last->rx_idx;
+            } /* end if */
+            else
+                chunk->recxs[chunk->iod.iod_nr++] = chunk->recxs[k];
+        } /* end for */
+
+        /* Set up sg_iovs to point into the chunk buffer, writing fill values
+         * to the buffer for reads */
+        if (NULL == (chunk->sg_iovs = (daos_iov_t *)DV_malloc(chunk->iod.iod_nr * sizeof(daos_iov_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate chunk sgl iovs");
+        for (k = 0; k < chunk->iod.iod_nr; k++) {
+            daos_iov_set(&chunk->sg_iovs[k], chunk->buf + chunk->recxs[k].rx_idx * file_type_size,
+                         (daos_size_t)chunk->recxs[k].rx_nr * (daos_size_t)file_type_size);
+            if (udata->io_type == IO_READ) {
+                if (udata->dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL)
+                    (void)memset(chunk->sg_iovs[k].iov_buf, 0, chunk->sg_iovs[k].iov_len);
+                else if (udata->dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+                    assert(udata->dset->fill_val);
+                    H5_daos_fill_pattern(chunk->sg_iovs[k].iov_buf, chunk->sg_iovs[k].iov_len,
+                                         udata->dset->fill_val, file_type_size);
+                } /* end if */
+            }     /* end if */
+        }         /* end for */
+
+        /* Set up iod and sgl */
+        chunk->akey_buf = H5_DAOS_CHUNK_KEY;
+        daos_iov_set(&chunk->iod.iod_name, (void *)&chunk->akey_buf, (daos_size_t)(sizeof(chunk->akey_buf)));
+        chunk->iod.iod_size  = (daos_size_t)file_type_size;
+        chunk->iod.iod_type  = DAOS_IOD_ARRAY;
+        chunk->iod.iod_recxs = chunk->recxs;
+        chunk->sgl.sg_nr     = (uint32_t)chunk->iod.iod_nr;
+        chunk->sgl.sg_nr_out = 0;
+        chunk->sgl.sg_iovs   = chunk->sg_iovs;
+
+        /* Create task for chunk I/O */
+        if (H5_daos_create_daos_task(udata->io_type == IO_READ ? DAOS_OPC_OBJ_FETCH : DAOS_OPC_OBJ_UPDATE, 0,
+                                     NULL, H5_daos_coll_chunk_prep_cb, H5_daos_coll_chunk_comp_cb, chunk,
+                                     &chunk_tasks[i]) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task for chunk I/O");
+    } /* end for */
+
+    /* Create metatask to complete this task after the chunk I/O */
+    if (H5_daos_create_task(H5_daos_metatask_autocomp_other, (unsigned)udata->nchunks, chunk_tasks, NULL,
+                            NULL, task, &comp_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create metatask for collective buffering chunk I/O");
+
+    /* Schedule chunk I/O tasks and metatask */
+    for (i = 0; i < udata->nchunks; i++)
+        if (0 != (ret = tse_task_schedule(chunk_tasks[i], false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task for chunk I/O: %s",
+                         H5_daos_err_to_string(ret));
+    if (0 != (ret = tse_task_schedule(comp_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret,
+                     "can't schedule metatask for collective buffering chunk I/O: %s",
+                     H5_daos_err_to_string(ret));
+    complete = FALSE;
+
+done:
+    DV_free(sorted);
+    DV_free(chunk_tasks);
+
+    /* Handle errors in this function */
+    if (udata && ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "collective buffering chunk task";
+    } /* end if */
+
+    if (complete) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_chunk_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_resp_task
+ *
+ * Purpose:     Asynchronous task that packs the data requested from this
+ *              process in a collective buffering read, in the order it
+ *              was requested, for the exchange back to the requesting
+ *              processes.  The data is packed even if the request has
+ *              failed (with zeros in place of data that was not read),
+ *              since the other processes expect it.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_resp_task(tse_task_t *task)
+{
+    H5_daos_coll_ud_t *udata;
+    size_t            *sizes = NULL;
+    size_t             send_size;
+    size_t             file_type_size;
+    size_t             i;
+    int                ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for collective buffering response task");
+
+    assert(udata->req);
+    assert(udata->io_type == IO_READ);
+
+    file_type_size = udata->dset->file_type_size;
+
+    /* Parse the requests if the chunk task did not */
+    if (!udata->parsed && H5_daos_coll_parse(udata) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTDECODE, -H5_DAOS_H5_DECODE_ERROR, "can't parse chunk pieces");
+
+    /* Compute the size of the response to each process */
+    if (NULL == (sizes = (size_t *)DV_calloc((size_t)udata->nprocs * sizeof(size_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate response sizes");
+    for (i = 0; i < udata->npieces; i++)
+        sizes[udata->pieces[i].src] += udata->pieces[i].nelem * file_type_size;
+    if (H5_daos_coll_set_counts(sizes, udata->nprocs, udata->resp_xchg.send_counts,
+                                udata->resp_xchg.send_displs, &send_size) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "can't compute response sizes");
+    if (send_size > 0 && NULL == (udata->resp_xchg.send_buf = (uint8_t *)DV_calloc(send_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate response buffer");
+
+    /* Pack the data from the chunk buffers */
+    for (i = 0; i < (size_t)udata->nprocs; i++)
+        sizes[i] = (size_t)udata->resp_xchg.send_displs[i];
+    for (i = 0; i < udata->npieces; i++) {
+        H5_daos_coll_piece_t *piece  = &udata->pieces[i];
+        uint8_t              *p      = udata->resp_xchg.send_buf + sizes[piece->src];
+        const uint8_t        *recx_p = piece->recxs_p;
+        uint64_t              rx_idx;
+        uint64_t              rx_nr;
+        size_t                j;
+
+        if (udata->chunks && piece->chunk < udata->nchunks && udata->chunks[piece->chunk].buf)
+            for (j = 0; j < piece->nrecxs; j++) {
+                UINT64DECODE(recx_p, rx_idx);
+                UINT64DECODE(recx_p, rx_nr);
+                (void)memcpy(p, udata->chunks[piece->chunk].buf + rx_idx * file_type_size,
+                             (size_t)rx_nr * file_type_size);
+                p += (size_t)rx_nr * file_type_size;
+            } /* end for */
+        sizes[piece->src] += piece->nelem * file_type_size;
+    } /* end for */
+
+done:
+    DV_free(sizes);
+
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "collective buffering response task";
+        } /* end if */
+    }     /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_resp_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_unpack_task
+ *
+ * Purpose:     Asynchronous task that copies the data received by this
+ *              process at the end of a collective buffering read into
+ *              the read buffer, converting it to the memory type if
+ *              necessary.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_unpack_task(tse_task_t *task)
+{
+    H5_daos_coll_ud_t *udata;
+    size_t            *offs      = NULL;
+    void              *tconv_buf = NULL;
+    void              *bkg_buf   = NULL;
+    size_t             file_type_size;
+    size_t             mem_type_size;
+    size_t             i, j;
+    int                ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for collective buffering unpack task");
+
+    assert(udata->req);
+    assert(udata->io_type == IO_READ);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
+
+    /* Initialize the position in the data received from each process */
+    if (NULL == (offs = (size_t *)DV_malloc((size_t)udata->nprocs * sizeof(size_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate offset list");
+    for (i = 0; i < (size_t)udata->nprocs; i++)
+        offs[i] = (size_t)udata->resp_xchg.recv_displs[i];
+
+    for (i = 0; i < udata->nfrags; i++) {
+        H5_daos_coll_frag_t *frag = &udata->frags[i];
+        const uint8_t       *p    = udata->resp_xchg.recv_buf + offs[frag->owner];
+
+        offs[frag->owner] += frag->nelem * udata->dset->file_type_size;
+
+        if (udata->need_tconv) {
+            H5_daos_scatter_cb_ud_t scatter_cb_ud;
+            hbool_t                 fill_bkg = FALSE;
+
+            /* Initialize type conversion */
+            if (H5_daos_tconv_init(udata->dset->file_type_id, &file_type_size, udata->mem_type_id,
+                                   &mem_type_size, frag->nelem, FALSE, FALSE, &tconv_buf, &bkg_buf, NULL,
+                                   &fill_bkg) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't initialize type conversion");
+            (void)memcpy(tconv_buf, p, frag->nelem * file_type_size);
+
+            /* Gather data to background buffer if necessary */
+            if (fill_bkg && H5Dgather(frag->mem_space_id, udata->rbuf, udata->mem_type_id,
+                                      frag->nelem * mem_type_size, bkg_buf, NULL, NULL) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                             "can't gather data to background buffer");
+
+            /* Perform type conversion */
+            if (H5Tconvert(udata->dset->file_type_id, udata->mem_type_id, frag->nelem, tconv_buf, bkg_buf,
+                           udata->req->dxpl_id) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, -H5_DAOS_H5_TCONV_ERROR,
+                             "can't perform type conversion");
+
+            /* Scatter data to memory buffer */
+            scatter_cb_ud.buf = tconv_buf;
+            scatter_cb_ud.len = frag->nelem * mem_type_size;
+            if (H5Dscatter(H5_daos_scatter_cb, &scatter_cb_ud, udata->mem_type_id, frag->mem_space_id,
+                           udata->rbuf) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_H5_SCATGATH_ERROR,
+                             "can't scatter data to read buffer");
+
+            tconv_buf = DV_free(tconv_buf);
+            bkg_buf   = DV_free(bkg_buf);
+        } /* end if */
+        else
+            /* Copy data to the memory buffer sequences */
+            for (j = 0; j < frag->niovs; j++) {
+                (void)memcpy(frag->iovs[j].iov_buf, p, frag->iovs[j].iov_len);
+                p += frag->iovs[j].iov_len;
+            } /* end for */
+    }         /* end for */
+
+done:
+    DV_free(offs);
+    DV_free(tconv_buf);
+    DV_free(bkg_buf);
+
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "collective buffering unpack task";
+        } /* end if */
+    }     /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_unpack_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_status_task
+ *
+ * Purpose:     Asynchronous task that combines the status of collective
+ *              buffering I/O on all processes using MPI_Iallreduce, since
+ *              a failure to read or write a chunk is otherwise only seen
+ *              by the process that owns it.  This task is completed by
+ *              the progress functions once the MPI request is finished.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_status_task(tse_task_t *task)
+{
+    H5_daos_coll_ud_t *udata;
+    int                ret_value = 0;
+
+    assert(!H5_daos_mpi_task_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for collective buffering status task");
+
+    assert(udata->req);
+
+    /* Make call to MPI_Iallreduce */
+    udata->status_in = udata->req->status < -H5_DAOS_INCOMPLETE ? 1 : 0;
+    if (MPI_SUCCESS != MPI_Iallreduce(&udata->status_in, &udata->status_out, 1, MPI_INT, MPI_MAX,
+                                      udata->req->file->comm, &H5_daos_mpi_req_g))
+        D_GOTO_ERROR(H5E_VOL, H5E_MPI, -H5_DAOS_MPI_ERROR, "MPI_Iallreduce failed");
+
+    /* Register this task as the current in-flight MPI task */
+    H5_daos_mpi_task_g = task;
+
+    /* This task will be completed by the progress function once that function
+     * detects that the MPI request is finished */
+
+done:
+    if (ret_value < 0) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_status_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_free
+ *
+ * Purpose:     Frees collective buffering user data.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_coll_free(H5_daos_coll_ud_t *coll_ud)
+{
+    size_t i;
+    herr_t ret_value = SUCCEED;
+
+    assert(coll_ud);
+
+    if (coll_ud->frags)
+        for (i = 0; i < coll_ud->nfrags; i++) {
+            if (coll_ud->frags[i].recxs != &coll_ud->frags[i].recx)
+                DV_free(coll_ud->frags[i].recxs);
+            if (coll_ud->frags[i].iovs != &coll_ud->frags[i].iov)
+                DV_free(coll_ud->frags[i].iovs);
+            if (coll_ud->frags[i].mem_space_id >= 0 && H5Sclose(coll_ud->frags[i].mem_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        } /* end for */
+    if (coll_ud->chunks)
+        for (i = 0; i < coll_ud->nchunks; i++) {
+            DV_free(coll_ud->chunks[i].buf);
+            DV_free(coll_ud->chunks[i].recxs);
+            DV_free(coll_ud->chunks[i].sg_iovs);
+        } /* end for */
+    if (coll_ud->mem_type_id >= 0 && H5Tclose(coll_ud->mem_type_id) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+    DV_free(coll_ud->frags);
+    DV_free(coll_ud->chunks);
+    DV_free(coll_ud->pieces);
+    DV_free(coll_ud->counts);
+    DV_free(coll_ud->xchg.send_buf);
+    DV_free(coll_ud->xchg.recv_buf);
+    DV_free(coll_ud->resp_xchg.send_buf);
+    DV_free(coll_ud->resp_xchg.recv_buf);
+    DV_free(coll_ud);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_coll_end_task
+ *
+ * Purpose:     Asynchronous task that finishes collective buffering I/O,
+ *              failing the request if the I/O failed on another process,
+ *              and frees the collective buffering user data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_coll_end_task(tse_task_t *task)
+{
+    H5_daos_coll_ud_t *udata;
+    int                ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for collective buffering end task");
+
+    assert(udata->req);
+    assert(udata->dset);
+
+    /* Check for failure on another process */
+    if (udata->status_out && udata->req->status >= -H5_DAOS_INCOMPLETE)
+        D_DONE_ERROR(H5E_DATASET, H5E_MPI, -H5_DAOS_REMOTE_ERROR,
+                     "collective buffering I/O failed on another process");
+
+    /* Close dataset */
+    if (H5_daos_dataset_close_real(udata->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "collective buffering I/O";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_IO, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free user data */
+    if (H5_daos_coll_free(udata) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CANTFREE, -H5_DAOS_FREE_ERROR,
+                     "can't free collective buffering user data");
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_coll_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_coll_io
+ *
+ * Purpose:     Performs collective I/O on a chunked dataset using two
+ *              phase collective buffering.  Each chunk is owned by a
+ *              single process, chosen by the chunk's index in the chunk
+ *              grid.  For writes, each process sends the elements it
+ *              selected in each chunk to the chunk's owner, which writes
+ *              all of them with a single update per chunk.  For reads,
+ *              each process sends the records it selected in each chunk
+ *              to the chunk's owner, which reads all of them with a
+ *              single fetch per chunk and sends the data back.  Must be
+ *              called on all processes in the same order.  Datasets that
+ *              are not chunked, have a filter pipeline or have a
+ *              variable-length or reference datatype are accessed
+ *              independently.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset I/O not performed.
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_coll_io(H5_daos_dset_t *dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id,
+                        htri_t need_tconv, H5_daos_io_type_t io_type, void *buf, tse_task_t *_end_task,
+                        H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_coll_ud_t           *coll_ud        = NULL;
+    H5_daos_select_chunk_info_t *chunk_info     = NULL;
+    tse_task_t                  *tasks[8]       = {NULL};
+    tse_task_t                  *index_task     = NULL;
+    tse_task_t                  *io_task        = NULL;
+    tse_task_t                  *end_task       = _end_task;
+    uint8_t                     *index_akey_buf = NULL;
+    unsigned                     nnew_chunks    = 0;
+    size_t                      *send_sizes     = NULL;
+    size_t                      *resp_sizes     = NULL;
+    void                        *tconv_buf      = NULL;
+    void                        *bkg_buf        = NULL;
+    hbool_t                      fill_bkg       = FALSE;
+    hid_t                        real_file_space_id;
+    hid_t                        real_mem_space_id;
+    hsize_t                      dims[H5S_MAX_RANK];
+    hssize_t                     num_elem_file, num_elem_mem;
+    size_t                       nchunks_sel = 0;
+    size_t                       file_type_size;
+    size_t                       mem_type_size = 0;
+    size_t                       max_nelem     = 0;
+    size_t                       total;
+    size_t                       ntasks = 0;
+    size_t                       i;
+    htri_t                       is_vl_ref;
+    int                          ndims;
+    int                          nprocs;
+    int                          r;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+    assert(dset->obj.item.file->num_procs > 1);
+
+    /* Only chunked datasets without filters or variable-length data use
+     * collective buffering.  This is the same on all processes. */
+    if ((is_vl_ref = H5_daos_detect_vl_vlstr_ref(dset->file_type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check for vl or reference type");
+    if (dset->dcpl_cache.layout != H5D_CHUNKED || dset->dcpl_cache.nfilters > 0 || is_vl_ref) {
+        /* The independent I/O routines take care of the end task */
+        end_task = NULL;
+        if (io_type == IO_READ) {
+            if (H5_daos_dataset_read_int(dset, mem_type_id, mem_space_id, file_space_id, need_tconv, buf,
+                                         _end_task, req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "failed to read data from dataset");
+        } /* end if */
+        else if (H5_daos_dataset_write_int(dset, mem_type_id, mem_space_id, file_space_id, need_tconv, buf,
+                                           _end_task, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    nprocs         = dset->obj.item.file->num_procs;
+    file_type_size = dset->file_type_size;
+
+    /* Get dataspace extent */
+    if ((ndims = H5Sget_simple_extent_dims(dset->space_id, dims, NULL)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+
+    /* Get "real" space ids */
+    if (file_space_id == H5S_ALL)
+        real_file_space_id = dset->space_id;
+    else
+        real_file_space_id = file_space_id;
+    if (mem_space_id == H5S_ALL)
+        real_mem_space_id = real_file_space_id;
+    else
+        real_mem_space_id = mem_space_id;
+
+    /* Get number of elements in selections */
+    if ((num_elem_file = H5Sget_select_npoints(real_file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in file selection");
+    if ((num_elem_mem = H5Sget_select_npoints(real_mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get number of points in memory selection");
+
+    /* Various sanity checks */
+    if (num_elem_file != num_elem_mem)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL,
+                     "number of elements selected in file and memory dataspaces is different");
+    if (num_elem_file && !buf)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "I/O buffer is NULL but selection has >0 elements");
+
+    /* I/O that bypasses the chunk cache must not conflict with cached chunks,
+     * so write back and drop them first */
+    if (dset->chunk_cache.table)
+        if (H5_daos_chunk_cache_flush(dset, TRUE, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+
+    /* Allocate collective buffering user data */
+    if (NULL == (coll_ud = (H5_daos_coll_ud_t *)DV_calloc(sizeof(H5_daos_coll_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate collective buffering user data");
+    coll_ud->req         = req;
+    coll_ud->dset        = dset;
+    coll_ud->io_type     = io_type;
+    coll_ud->ndims       = ndims;
+    coll_ud->nprocs      = nprocs;
+    coll_ud->need_tconv  = (hbool_t)need_tconv;
+    coll_ud->mem_type_id = H5I_INVALID_HID;
+    coll_ud->rbuf        = buf;
+    for (r = 0; r < ndims; r++)
+        coll_ud->grid_dims[r] = (uint64_t)((dims[r] + dset->dcpl_cache.chunk_dims[r] - 1) /
+                                           dset->dcpl_cache.chunk_dims[r]);
+    if (NULL == (coll_ud->counts = (int *)DV_calloc(8 * (size_t)nprocs * sizeof(int))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate MPI counts");
+    coll_ud->xchg.coll_ud          = coll_ud;
+    coll_ud->xchg.send_counts      = coll_ud->counts;
+    coll_ud->xchg.send_displs      = coll_ud->counts + nprocs;
+    coll_ud->xchg.recv_counts      = coll_ud->counts + (2 * nprocs);
+    coll_ud->xchg.recv_displs      = coll_ud->counts + (3 * nprocs);
+    coll_ud->resp_xchg.coll_ud     = coll_ud;
+    coll_ud->resp_xchg.send_counts = coll_ud->counts + (4 * nprocs);
+    coll_ud->resp_xchg.send_displs = coll_ud->counts + (5 * nprocs);
+    coll_ud->resp_xchg.recv_counts = coll_ud->counts + (6 * nprocs);
+    coll_ud->resp_xchg.recv_displs = coll_ud->counts + (7 * nprocs);
+    if (NULL == (send_sizes = (size_t *)DV_calloc(2 * (size_t)nprocs * sizeof(size_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate exchange sizes");
+    resp_sizes = send_sizes + nprocs;
+
+    if (num_elem_file > 0) {
+        /* Fill dataset I/O cache if it hasn't already been filled */
+        if (!dset->io_cache.filled &&
+            H5_daos_dset_fill_io_cache(dset, real_file_space_id, real_mem_space_id) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize dataset I/O cache");
+
+        /* Get the coordinates of the currently selected chunks in the file,
+         * setting up memory and file dataspaces for them */
+        if (H5_daos_get_selected_chunk_info(&dset->dcpl_cache, real_file_space_id, real_mem_space_id,
+                                            &dset->io_cache.chunk_info, &dset->io_cache.chunk_info_nalloc,
+                                            &nchunks_sel) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get selected chunk info");
+        chunk_info = dset->io_cache.chunk_info;
+
+        /* Set up type conversion */
+        if (need_tconv) {
+            if (io_type == IO_READ) {
+                if ((coll_ud->mem_type_id = H5Tcopy(mem_type_id)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory datatype");
+            } /* end if */
+            else {
+                for (i = 0; i < nchunks_sel; i++)
+                    max_nelem = MAX(max_nelem, (size_t)chunk_info[i].num_elem_sel_file);
+                if (H5_daos_tconv_init(mem_type_id, &mem_type_size, dset->file_type_id, &file_type_size,
+                                       max_nelem, FALSE, TRUE, &tconv_buf, &bkg_buf, NULL, &fill_bkg) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't initialize type conversion");
+
+                /* Conversions that need the existing data as background are
+                 * written independently by this process, which still takes
+                 * part in the exchange */
+                if (fill_bkg) {
+                    io_task = *dep_task;
+                    if (H5_daos_dataset_write_int(dset, mem_type_id, mem_space_id, file_space_id, need_tconv,
+                                                  buf, NULL, req, first_task, &io_task) < 0)
+                        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+                    if (io_task)
+                        *dep_task = io_task;
+                    io_task     = NULL;
+                    nchunks_sel = 0;
+                } /* end if */
+            }     /* end else */
+        }         /* end if */
+
+        /* Build the piece of each selected chunk to send to its owner */
+        if (nchunks_sel > 0 && NULL == (coll_ud->frags = (H5_daos_coll_frag_t *)DV_calloc(
+                                            nchunks_sel * sizeof(H5_daos_coll_frag_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk piece list");
+        for (i = 0; i < nchunks_sel; i++) {
+            coll_ud->frags[i].recxs        = &coll_ud->frags[i].recx;
+            coll_ud->frags[i].iovs         = &coll_ud->frags[i].iov;
+            coll_ud->frags[i].mem_space_id = H5I_INVALID_HID;
+        } /* end for */
+        coll_ud->nfrags = nchunks_sel;
+        for (i = 0; i < nchunks_sel; i++) {
+            H5_daos_coll_frag_t *frag = &coll_ud->frags[i];
+
+            (void)memcpy(frag->chunk_coords, chunk_info[i].chunk_coords, (size_t)ndims * sizeof(uint64_t));
+            frag->owner = (int)(H5_daos_coll_chunk_idx(coll_ud, frag->chunk_coords) % (uint64_t)nprocs);
+            frag->nelem = (size_t)chunk_info[i].num_elem_sel_file;
+
+            /* Calculate recxs from file space */
+            if (H5_daos_sel_to_recx_iov(dset, chunk_info[i].fspace_id, dset->io_cache.file_sel_iter_id,
+                                        file_type_size, buf, &frag->recxs, NULL, &frag->nrecxs) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't generate sequence lists for DAOS I/O");
+            send_sizes[frag->owner] += ((size_t)ndims + 1) * sizeof(uint64_t) +
+                                       frag->nrecxs * 2 * sizeof(uint64_t) +
+                                       (io_type == IO_WRITE ? frag->nelem * file_type_size : 0);
+
+            /* For reads, record where the data goes in memory */
+            if (io_type == IO_READ) {
+                resp_sizes[frag->owner] += frag->nelem * file_type_size;
+                if (need_tconv) {
+                    if ((frag->mem_space_id = H5Scopy(chunk_info[i].mspace_id)) < 0)
+                        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory dataspace");
+                } /* end if */
+                else if (H5_daos_sel_to_recx_iov(dset, chunk_info[i].mspace_id,
+                                                 dset->io_cache.mem_sel_iter_id, file_type_size, buf, NULL,
+                                                 &frag->iovs, &frag->niovs) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                                 "can't generate sequence lists for DAOS I/O");
+            } /* end if */
+        }     /* end for */
+    }         /* end if */
+
+    /* Set up the send buffer */
+    if (H5_daos_coll_set_counts(send_sizes, nprocs, coll_ud->xchg.send_counts, coll_ud->xchg.send_displs,
+                                &total) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "can't compute exchange sizes");
+    if (total > 0 && NULL == (coll_ud->xchg.send_buf = (uint8_t *)DV_malloc(total)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate send buffer");
+    for (r = 0; r < nprocs; r++)
+        send_sizes[r] = (size_t)coll_ud->xchg.send_displs[r];
+    for (i = 0; i < coll_ud->nfrags; i++) {
+        H5_daos_coll_frag_t *frag = &coll_ud->frags[i];
+        uint8_t             *p    = coll_ud->xchg.send_buf + send_sizes[frag->owner];
+        size_t               j;
+
+        /* Encode chunk coordinates and records */
+        for (r = 0; r < ndims; r++)
+            UINT64ENCODE(p, frag->chunk_coords[r]);
+        UINT64ENCODE(p, (uint64_t)frag->nrecxs);
+        for (j = 0; j < frag->nrecxs; j++) {
+            UINT64ENCODE(p, frag->recxs[j].rx_idx);
+            UINT64ENCODE(p, frag->recxs[j].rx_nr);
+        } /* end for */
+
+        /* Gather the data for writes, converting it to the file type if
+         * necessary */
+        if (io_type == IO_WRITE) {
+            if (need_tconv) {
+                if (H5Dgather(chunk_info[i].mspace_id, buf, mem_type_id, frag->nelem * mem_type_size,
+                              tconv_buf, NULL, NULL) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't gather data to conversion buffer");
+                if (H5Tconvert(mem_type_id, dset->file_type_id, frag->nelem, tconv_buf, bkg_buf,
+                               req->dxpl_id) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTCONVERT, FAIL, "can't perform type conversion");
+                (void)memcpy(p, tconv_buf, frag->nelem * file_type_size);
+            } /* end if */
+            else if (H5Dgather(chunk_info[i].mspace_id, buf, mem_type_id, frag->nelem * file_type_size, p,
+                               NULL, NULL) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't gather data to send buffer");
+            p += frag->nelem * file_type_size;
+        } /* end if */
+
+        send_sizes[frag->owner] = (size_t)(p - coll_ud->xchg.send_buf);
+    } /* end for */
+
+    /* Set up the response sizes for reads */
+    if (io_type == IO_READ && H5_daos_coll_set_counts(resp_sizes, nprocs, coll_ud->resp_xchg.recv_counts,
+                                                      coll_ud->resp_xchg.recv_displs, &total) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "can't compute response sizes");
+
+    /* Record the newly allocated chunks in the file's chunk index */
+    if (io_type == IO_WRITE && coll_ud->nfrags > 0) {
+        if (H5_daos_chunk_index_add(dset, chunk_info, coll_ud->nfrags, ndims, &index_akey_buf, &nnew_chunks) <
+            0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunks to chunk index");
+        if (nnew_chunks > 0) {
+            /* H5_daos_chunk_index_write() takes ownership of the akey buffer */
+            index_task = *dep_task;
+            ret_value  = H5_daos_chunk_index_write(dset, index_akey_buf, nnew_chunks, ndims, FALSE, FALSE,
+                                                   req, first_task, &index_task);
+            index_akey_buf = NULL;
+            if (ret_value < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunk index");
+        } /* end if */
+    }     /* end if */
+
+    /* Create tasks for the exchange, the chunk I/O, the exchange back for
+     * reads, the status check and cleanup */
+    if (H5_daos_create_task(H5_daos_coll_alltoall_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
+                            NULL, &coll_ud->xchg, &tasks[ntasks]) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for MPI all-to-all");
+    ntasks++;
+    if (H5_daos_create_task(H5_daos_coll_alltoallv_task, 1, &tasks[ntasks - 1], NULL, NULL, &coll_ud->xchg,
+                            &tasks[ntasks]) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for MPI all-to-all");
+    ntasks++;
+    if (H5_daos_create_task(H5_daos_coll_chunk_task, 1, &tasks[ntasks - 1], NULL, NULL, coll_ud,
+                            &tasks[ntasks]) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for collective buffering chunk I/O");
+    ntasks++;
+    if (io_type == IO_READ) {
+        if (H5_daos_create_task(H5_daos_coll_resp_task, 1, &tasks[ntasks - 1], NULL, NULL, coll_ud,
+                                &tasks[ntasks]) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create task for collective buffering response");
+        ntasks++;
+        if (H5_daos_create_task(H5_daos_coll_alltoallv_task, 1, &tasks[ntasks - 1], NULL, NULL,
+                                &coll_ud->resp_xchg, &tasks[ntasks]) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for MPI all-to-all");
+        ntasks++;
+        if (H5_daos_create_task(H5_daos_coll_unpack_task, 1, &tasks[ntasks - 1], NULL, NULL, coll_ud,
+                                &tasks[ntasks]) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create task for collective buffering unpack");
+        ntasks++;
+    } /* end if */
+    if (H5_daos_create_task(H5_daos_coll_status_task, 1, &tasks[ntasks - 1], NULL, NULL, coll_ud,
+                            &tasks[ntasks]) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for collective buffering status");
+    ntasks++;
+    tasks[ntasks] = index_task;
+    if (H5_daos_create_task(H5_daos_coll_end_task, index_task ? 2 : 1, &tasks[ntasks - 1], NULL, NULL,
+                            coll_ud, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finish collective buffering I/O");
+
+    /* Schedule tasks (saving the first to be scheduled later if there is no
+     * first task yet) and give them a reference to req and the dataset */
+    for (i = 0; i < ntasks; i++) {
+        if (i == 0 && !*first_task)
+            *first_task = tasks[0];
+        else if (0 != (ret = tse_task_schedule(tasks[i], false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule collective buffering task: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end for */
+    if (0 != (ret = tse_task_schedule(io_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule collective buffering task: %s",
+                     H5_daos_err_to_string(ret));
+    req->rc++;
+    dset->obj.item.rc++;
+    coll_ud = NULL;
+
+    /* Set up dependency on io_task for end task */
+    if (end_task && 0 != (ret = tse_task_register_deps(end_task, 1, &io_task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                     "can't create dependency on collective buffering I/O task: %s",
+                     H5_daos_err_to_string(ret));
+
+done:
+    DV_free(index_akey_buf);
+    DV_free(send_sizes);
+    DV_free(tconv_buf);
+    DV_free(bkg_buf);
+
+    /* Cleanup on failure */
+    if (coll_ud && H5_daos_coll_free(coll_ud) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CANTFREE, FAIL, "can't free collective buffering user data");
+
+    /* Schedule end_task if appropriate and update *dep_task */
+    if (end_task) {
+        if (0 != (ret = tse_task_schedule(end_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for IO operation: %s",
+                         H5_daos_err_to_string(ret));
+        *dep_task = end_task;
+    } /* end if */
+    else if (io_task)
+        *dep_task = io_task;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_coll_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_write
+ *
+ * Purpose:     Writes raw data from a buffer into a dataset.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1, dataset not written.
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+#if H5VL_VERSION >= 3
+herr_t
+H5_daos_dataset_write(size_t count, void *_dset[], hid_t mem_type_id[], hid_t mem_space_id[],
+                      hid_t file_space_id[], hid_t dxpl_id, const void *buf[], void **req)
+#else
+herr_t
+H5_daos_dataset_write(void *_dset, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id, hid_t dxpl_id,
+                      const void *buf, void **req)
+#endif
+{
+    H5_daos_dset_t       *dset       = NULL;
+    H5_daos_io_task_ud_t *task_ud    = NULL;
+    tse_task_t           *io_task    = NULL;
+    tse_task_t           *first_task = NULL;
+    tse_task_t           *dep_task   = NULL;
+    H5_daos_req_t        *int_req    = NULL;
+    htri_t                need_tconv = FALSE;
+    htri_t                coll_io    = FALSE;
+    hid_t                 req_dxpl_id;
+    hid_t                 local_mem_type_id   = H5I_INVALID_HID;
+    hid_t                 local_mem_space_id  = H5I_INVALID_HID;
+    hid_t                 local_file_space_id = H5I_INVALID_HID;
+    const void           *local_buf           = NULL;
+    int                   ret;
+    herr_t                ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    /* Set convenience variables to handle VOL structure versioning */
+#if H5VL_VERSION >= 3
+    dset                = (H5_daos_dset_t *)_dset[0];
+    local_mem_type_id   = mem_type_id[0];
+    local_mem_space_id  = mem_space_id[0];
+    local_file_space_id = file_space_id[0];
+    local_buf           = buf[0];
+#else
+    dset                = (H5_daos_dset_t *)_dset;
+    local_mem_type_id   = mem_type_id;
+    local_mem_space_id  = mem_space_id;
+    local_file_space_id = file_space_id;
+    local_buf           = buf;
+#endif
+
+    if (!dset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
+    if (H5I_DATASET != dset->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+
+#if H5VL_VERSION >= 3
+    /* Handle multi-dataset I/O separately */
+    if (count > 1) {
+        if (H5_daos_dataset_io_multi(count, _dset, mem_type_id, mem_space_id, file_space_id, dxpl_id, NULL,
+                                     buf, req) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to datasets");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+#endif
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Check for write access */
+    if (!(dset->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Check if collective buffering was requested */
+    if ((coll_io = H5_daos_dset_coll_io_requested(dset, dxpl_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't check if collective I/O was requested");
+
+    /* If the dataset's datatype is complete, check if type conversion is needed
+     */
+    if (dset->obj.item.open_req->status == 0 || dset->obj.item.created) {
+        /* Check if datatype conversion is needed */
+        if ((need_tconv = H5_daos_need_tconv(dset->file_type_id, local_mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOMPARE, FAIL, "can't check if type conversion is needed");
+        req_dxpl_id = need_tconv ? dxpl_id : H5P_DATASET_XFER_DEFAULT;
+    } /* end if */
+    else
+        req_dxpl_id = dxpl_id;
+
+    /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+    if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset write", dset->obj.item.open_req,
+                                              NULL, NULL, req_dxpl_id)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    /* Check if we can call the internal routine directly - the dataset open
+     * must be complete and there must not be an in-flight set_extent. */
+    if ((dset->obj.item.open_req->status == 0) && (dset->cur_set_extent_space_id == H5I_INVALID_HID)) {
+        /* Call internal routine.  Collective I/O does not modify the buffer
+         * when writing. */
+        if (coll_io) {
+            union {
+                const void *const_buf;
+                void       *buf;
+            } wbuf;
+
+            wbuf.const_buf = local_buf;
+            if (H5_daos_dataset_coll_io(dset, local_mem_type_id, local_mem_space_id, local_file_space_id,
+                                        need_tconv, IO_WRITE, wbuf.buf, NULL, int_req, &first_task,
+                                        &dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+        } /* end if */
+        else if (H5_daos_dataset_write_int(dset, local_mem_type_id, local_mem_space_id, local_file_space_id,
+                                           need_tconv, local_buf, NULL, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "failed to write data to dataset");
+    } /* end if */
+    else {
+        /* Allocate argument struct */
+        if (NULL == (task_ud = (H5_daos_io_task_ud_t *)DV_calloc(sizeof(H5_daos_io_task_ud_t))))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't allocate space for I/O task udata struct");
+        task_ud->req           = int_req;
+        task_ud->io_type       = IO_WRITE;
+        task_ud->dset          = dset;
+        task_ud->mem_type_id   = H5I_INVALID_HID;
+        task_ud->mem_space_id  = H5I_INVALID_HID;
+        task_ud->file_space_id = H5I_INVALID_HID;
+        task_ud->buf.wbuf      = local_buf;
+        task_ud->coll          = (hbool_t)coll_io;
+
+        /* Copy dataspaces and datatype */
+        if ((task_ud->mem_type_id = H5Tcopy(local_mem_type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory type ID");
+        if (local_mem_space_id == H5S_ALL)
+            task_ud->mem_space_id = H5S_ALL;
+        else if ((task_ud->mem_space_id = H5Scopy(local_mem_space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy memory space ID");
+        if (local_file_space_id == H5S_ALL)
+            task_ud->file_space_id = H5S_ALL;
+        else if ((task_ud->file_space_id = H5Scopy(local_file_space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy file space ID");
+
+        /* Create end task for writing data */
+        if (H5_daos_create_task(H5_daos_dset_io_int_end_task, 0, NULL, NULL, NULL, task_ud,
+                                &task_ud->end_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't create task to finish performing I/O operation");
+
+        /* Create task to write data */
+        if (H5_daos_create_task(H5_daos_dset_io_int_task, 0, NULL, NULL, NULL, task_ud, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform I/O operation");
+
+        /* Save task to be scheduled later and give it a reference to req and
+         * dset */
+        assert(!first_task);
+        first_task = io_task;
+        dep_task   = task_ud->end_task;
+        dset->obj.item.rc++;
+        int_req->rc++;
+        task_ud = NULL;
+    } /* end else */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the object's request queue.  This will add the
+         * dependency on the dataset open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_WRITE,
+                                H5_DAOS_OP_SCOPE_OBJ, (hbool_t)coll_io, !req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "dataset write failed in task \"%s\": %s",
+                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    /* Cleanup on error */
+    if (task_ud) {
+        assert(ret_value < 0);
+        if (task_ud->mem_type_id >= 0 && H5Tclose(task_ud->mem_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory datatype");
+        if (task_ud->mem_space_id >= 0 && task_ud->mem_space_id != H5S_ALL &&
+            H5Sclose(task_ud->mem_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close memory dataspace");
+        if (task_ud->file_space_id >= 0 && task_ud->file_space_id != H5S_ALL &&
+            H5Sclose(task_ud->file_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close file dataspace");
+        task_ud = DV_free(task_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_write() */
+
+#if H5VL_VERSION >= 2
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_get_realize
+ *
+ * Purpose:     Future ID "realize" callback for H5_daos_dataset_get
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              December, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_get_realize(void *future_object, hid_t *actual_object_id)
+{
+    H5_daos_dset_get_ud_t *udata     = (H5_daos_dset_get_ud_t *)future_object;
+    int                    ret_value = 0;
+
+    H5_daos_inc_api_cnt();
+
+    /* Handle errors in previous tasks.  Short circuit is still a failure here.
+     */
+    if (udata->req->status <= -H5_DAOS_SHORT_CIRCUIT) {
+        D_GOTO_DONE(FAIL);
+    } /* end if */
+
+    /* Wait for the dataset to open if necessary */
+    if (udata->dset->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(udata->dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (udata->dset->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "dataset open failed");
+    } /* end if */
+
+    switch (udata->get_type) {
+        case H5VL_DATASET_GET_DCPL: {
+            /* Retrieve the dataset's creation property list */
+            if ((*actual_object_id = H5Pcopy(udata->dset->dcpl_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset creation property list");
+
+            /* Set dataset's object class on dcpl */
+            if (H5_daos_set_oclass_from_oid(*actual_object_id, udata->dset->obj.oid) < 0)
+                D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
+
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_SPACE: {
+            /* Retrieve the dataset's dataspace */
+            if ((*actual_object_id = H5Scopy(udata->dset->space_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace ID of dataset");
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_TYPE: {
+            /* Retrieve the dataset's datatype */
+            if ((*actual_object_id = H5Tcopy(udata->dset->type_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get datatype ID of dataset");
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_STORAGE_SIZE:
+        case H5VL_DATASET_GET_DAPL:
+        case H5VL_DATASET_GET_SPACE_STATUS:
+            /* Should have been handled in top level function or get task */
+        default:
+            assert(0 && "can't realize this type of information from dataset");
+    } /* end switch */
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_get_realize() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_get_discard
+ *
+ * Purpose:     Future ID "discard" callback for H5_daos_dataset_get
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              December, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_get_discard(void *future_object)
+{
+    H5_daos_dset_get_ud_t *udata     = (H5_daos_dset_get_ud_t *)future_object;
+    int                    ret_value = 0;
+
+    H5_daos_inc_api_cnt();
+
+    if (udata) {
+        /* Close dataset */
+        if (H5_daos_dataset_close_real(udata->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataset used for I/O");
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+
+        /* Free udata */
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_get_discard() */
+#endif /* H5VL_VERSION >= 2 */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_get_task
+ *
+ * Purpose:     Asynchronous task for H5_daos_dataset_get.  For a filtered
+ *              dataset with a complete chunk index, starts fetching the
+ *              stored size of each allocated chunk, and the task
+ *              completes once the fetches complete.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_dataset_get_task(tse_task_t *task)
+{
+    H5_daos_dset_get_ud_t *udata     = NULL;
+    int                    ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for dataset I/O task");
+
+    udata->get_task = task;
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_DATASET);
+
+    /* Verify dataset was successfully opened */
+    if (udata->dset->obj.item.open_req->status != 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_PREREQ_ERROR, "dataset open is incomplete");
+
+    assert(udata->get_type == H5VL_DATASET_GET_STORAGE_SIZE);
+    assert(udata->hsize_out);
+
+    if (H5_daos_dataset_get_storage_size(udata->dset, udata->hsize_out) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get dataset's storage size");
+
+    /* Filtered chunks take up however much space they compressed to, so
+     * fetch the size of each allocated chunk's record */
+    if (udata->dset->dcpl_cache.layout == H5D_CHUNKED && udata->dset->dcpl_cache.nfilters > 0 &&
+        udata->dset->chunk_index && udata->dset->chunk_index->complete && *udata->hsize_out > 0)
+        if (H5_daos_dataset_get_filtered_size(udata) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, -H5_DAOS_SETUP_ERROR,
+                         "can't fetch sizes of filtered chunks");
+
+done:
+    if (udata) {
+        /* Finish now unless the task is waiting on chunk size fetches */
+        if (udata->nfetch_left == 0)
+            ret_value = H5_daos_dataset_get_finish(udata, ret_value);
+    } /* end if */
+    else {
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end else */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_get_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_get_finish
+ *
+ * Purpose:     Finishes a dataset get task with result ret: releases the
+ *              dataset and request, frees the task's private data and
+ *              completes the task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_dataset_get_finish(H5_daos_dset_get_ud_t *udata, int ret)
+{
+    tse_task_t *task;
+    int         ret_value = ret;
+
+    assert(udata);
+    assert(udata->get_task);
+    assert(udata->nfetch_left == 0);
+
+    task = udata->get_task;
+
+    /* Close dataset */
+    if (H5_daos_dataset_close_real(udata->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                     "can't close dataset used for I/O");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "dataset get task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free udata */
+    DV_free(udata->size_uds);
+    DV_free(udata);
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_get_finish() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_get_filtered_size
+ *
+ * Purpose:     Starts fetching the size of the stored record of each
+ *              chunk in a filtered dataset's chunk index, which is the
+ *              filtered (compressed) size of the chunk plus its filter
+ *              header.  *udata->hsize_out is reset to 0 and the fetches
+ *              add up the chunks' filtered sizes in it.  The get task
+ *              completes once the last fetch completes.  If creating a
+ *              fetch fails after others were started, the error is
+ *              recorded in the request and the started fetches are left
+ *              to finish.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_get_filtered_size(H5_daos_dset_get_ud_t *udata)
+{
+    H5_daos_chunk_index_t   *idx;
+    H5_daos_chunk_size_ud_t *size_ud;
+    tse_task_t              *fetch_task;
+    const uint64_t          *coords;
+    size_t                   nchunks;
+    size_t                   i;
+    uint8_t                 *p;
+    int                      ndims;
+    int                      j;
+    int                      ret;
+    herr_t                   ret_value = SUCCEED;
+
+    assert(udata);
+    assert(udata->dset->chunk_index);
+
+    idx     = udata->dset->chunk_index;
+    nchunks = (size_t)dv_hash_table_num_entries(idx->table);
+    assert(nchunks > 0);
+
+    if ((ndims = H5Sget_simple_extent_ndims(udata->dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    if (H5_daos_chunk_index_sort(idx) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTSORT, FAIL, "can't sort chunk index");
+    if (NULL == (udata->size_uds =
+                     (H5_daos_chunk_size_ud_t *)DV_calloc(nchunks * sizeof(H5_daos_chunk_size_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk size fetch arguments");
+
+    *udata->hsize_out = 0;
+
+    for (i = 0; i < nchunks; i++) {
+        size_ud         = &udata->size_uds[i];
+        size_ud->get_ud = udata;
+        coords          = &idx->sorted[i * H5S_MAX_RANK];
+
+        /* Encode dkey (chunk coordinates) */
+        p    = size_ud->dkey_buf;
+        *p++ = (uint8_t)'\0';
+        for (j = 0; j < ndims; j++)
+            UINT64ENCODE(p, coords[j]);
+        daos_iov_set(&size_ud->dkey, size_ud->dkey_buf,
+                     (daos_size_t)(1 + ((size_t)ndims * sizeof(coords[0]))));
+
+        /* Set up iod to fetch only the size of the record */
+        size_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+        daos_iov_set(&size_ud->iod.iod_name, (void *)&size_ud->akey_buf,
+                     (daos_size_t)(sizeof(size_ud->akey_buf)));
+        size_ud->iod.iod_nr   = 1u;
+        size_ud->iod.iod_size = DAOS_REC_ANY;
+        size_ud->iod.iod_type = DAOS_IOD_SINGLE;
+
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_chunk_size_prep_cb,
+                                     H5_daos_chunk_size_comp_cb, size_ud, &fetch_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to fetch chunk size");
+
+        /* Schedule the fetch.  The get task holds the references to req and
+         * the dataset for all of the fetches. */
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to fetch chunk size: %s",
+                         H5_daos_err_to_string(ret));
+        udata->nfetch_left++;
+    } /* end for */
+
+done:
+    /* Let the fetches that were started finish, they complete the get task */
+    if (ret_value < 0 && udata->nfetch_left > 0) {
+        if (udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = -H5_DAOS_SETUP_ERROR;
+            udata->req->failed_task = "chunk size fetch setup";
+        } /* end if */
+        ret_value = SUCCEED;
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_get_filtered_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_size_prep_cb
+ *
+ * Purpose:     Prepare callback for the asynchronous daos_obj_fetch of
+ *              the size of a filtered chunk's record.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_size_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_size_ud_t *udata;
+    daos_obj_rw_t           *rw_args;
+    int                      ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk size fetch task");
+
+    assert(udata->get_ud);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->get_ud->req, H5E_IO);
+
+    /* Set fetch task arguments */
+    if (NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for chunk size fetch task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh   = udata->get_ud->dset->obj.obj_oh;
+    rw_args->th   = udata->get_ud->req->th;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr   = 1;
+    rw_args->iods = &udata->iod;
+    rw_args->sgls = NULL;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_size_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_size_comp_cb
+ *
+ * Purpose:     Complete callback for the asynchronous daos_obj_fetch of
+ *              the size of a filtered chunk's record.  Adds the chunk's
+ *              filtered size to the dataset's storage size and, once the
+ *              last fetch completes, finishes the get task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_size_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_size_ud_t *udata;
+    H5_daos_dset_get_ud_t   *get_ud    = NULL;
+    int                      ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk size fetch task");
+
+    get_ud = udata->get_ud;
+    assert(get_ud);
+    assert(get_ud->nfetch_left > 0);
+
+    /* Handle errors in fetch task.  Only record error in req->status if it
+     * does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && get_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        get_ud->req->status      = task->dt_result;
+        get_ud->req->failed_task = "chunk size fetch";
+    } /* end if */
+    else if (task->dt_result == 0 && udata->iod.iod_size > 0) {
+        /* Add the size of the filtered data, without the filter header */
+        if (udata->iod.iod_size < H5_DAOS_FILTER_HEADER_SIZE)
+            D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "filtered chunk is too small");
+        *get_ud->hsize_out += (hsize_t)udata->iod.iod_size - H5_DAOS_FILTER_HEADER_SIZE;
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (get_ud) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && get_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            get_ud->req->status      = ret_value;
+            get_ud->req->failed_task = "chunk size fetch completion callback";
+        } /* end if */
+
+        /* Finish the get task once the last fetch is done */
+        if (--get_ud->nfetch_left == 0)
+            (void)H5_daos_dataset_get_finish(get_ud, 0);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_size_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_get
+ *
+ * Purpose:     Gets certain information about a dataset
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              February, 2017
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_get(void *_dset, H5VL_dataset_get_args_t *get_args, hid_t H5VL_DAOS_UNUSED dxpl_id,
+                    void H5VL_DAOS_UNUSED **req)
+{
+    H5_daos_dset_t        *dset       = (H5_daos_dset_t *)_dset;
+    H5_daos_dset_get_ud_t *get_udata  = NULL;
+    tse_task_t            *first_task = NULL;
+    tse_task_t            *dep_task   = NULL;
+    H5_daos_req_t         *int_req    = NULL;
+    int                    ret;
+    herr_t                 ret_value = SUCCEED; /* Return value */
+
+    H5_daos_inc_api_cnt();
+
+    if (!_dset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (!get_args)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    switch (get_args->op_type) {
+        case H5VL_DATASET_GET_DCPL: {
+            hid_t *plist_id = &get_args->args.get_dcpl.dcpl_id;
+
+            if (!plist_id)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+
+            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+            if (NULL ==
+                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset create property list",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Allocate future ID and set up async task if necessary */
+            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
+#if H5VL_VERSION >= 2
+                /* Allocate udata struct */
+                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                 "can't allocate space for dataset get udata struct");
+
+                /* Register future ID for dcpl */
+                if ((*plist_id = H5Iregister_future(H5I_GENPROP_LST, get_udata, H5_daos_dataset_get_realize,
+                                                    H5_daos_dataset_get_discard)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register future ID");
+            } /* end if */
+            else
+#else
+                /* No future ID support, wait for the dataset to open */
+                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (dset->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "attribute open failed");
+            } /* end if */
+#endif
+            {
+                /* Retrieve the dataset's creation property list */
+                if ((*plist_id = H5Pcopy(dset->dcpl_id)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset creation property list");
+
+                /* Set dataset's object class on dcpl */
+                if (H5_daos_set_oclass_from_oid(*plist_id, dset->obj.oid) < 0)
+                    D_GOTO_ERROR(H5E_PLIST, H5E_CANTSET, FAIL, "can't set object class property");
+            } /* end else/block */
+
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_DAPL: {
+            hid_t *plist_id = &get_args->args.get_dapl.dapl_id;
+
+            if (!plist_id)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+
+            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+            if (NULL ==
+                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset access property list",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Retrieve the dataset's access property list */
+            if ((*plist_id = H5Pcopy(dset->dapl_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset access property list");
+
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_SPACE: {
+            hid_t *ret_id = &get_args->args.get_space.space_id;
+
+            if (!ret_id)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+
+            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+            if (NULL ==
+                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset dataspace",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Allocate future ID and set up async task if necessary */
+            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
+#if H5VL_VERSION >= 2
+                /* Allocate udata struct */
+                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                 "can't allocate space for dataset get udata struct");
+
+                /* Register future ID for dataspace */
+                if ((*ret_id = H5Iregister_future(H5I_DATASPACE, get_udata, H5_daos_dataset_get_realize,
+                                                  H5_daos_dataset_get_discard)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register future ID");
+            } /* end if */
+            else
+#else
+                /* No future ID support, wait for the dataset to open */
+                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (dset->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "attribute open failed");
+            } /* end if */
+#endif
+            {
+                /* Retrieve the dataset's dataspace.  Use
+                 * cur_set_extent_space_id if present, otherwise just use
+                 * space_id. */
+                if (dset->cur_set_extent_space_id >= 0) {
+                    if ((*ret_id = H5Scopy(dset->cur_set_extent_space_id)) < 0)
+                        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace ID of dataset");
+                } /* end if */
+                else if ((*ret_id = H5Scopy(dset->space_id)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace ID of dataset");
+            } /* end else/block */
+
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_SPACE_STATUS: {
+            H5D_space_status_t *allocation = get_args->args.get_space_status.status;
+
+            if (!allocation)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+
+            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+            if (NULL ==
+                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset dataspace status",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Retrieve the dataset's space status */
+            *allocation = H5D_SPACE_STATUS_ALLOCATED;
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_TYPE: {
+            hid_t *ret_id = &get_args->args.get_type.type_id;
+
+            if (!ret_id)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+
+            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+            if (NULL ==
+                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset datatype",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Allocate future ID and set up async task if necessary */
+            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
+#if H5VL_VERSION >= 2
+                /* Allocate udata struct */
+                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                 "can't allocate space for dataset get udata struct");
+
+                /* Register future ID for datatype */
+                if ((*ret_id = H5Iregister_future(H5I_DATATYPE, get_udata, H5_daos_dataset_get_realize,
+                                                  H5_daos_dataset_get_discard)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register future ID");
+            } /* end if */
+            else
+#else
+                /* No future ID support, wait for the dataset to open */
+                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (dset->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "attribute open failed");
+            } /* end if */
+#endif
+            {
+                /* Retrieve the dataset's datatype */
+                if ((*ret_id = H5Tcopy(dset->type_id)) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get datatype ID of dataset");
+            } /* end else/block */
+
+            break;
+        } /* end block */
+        case H5VL_DATASET_GET_STORAGE_SIZE: {
+            hsize_t *storage_size = get_args->args.get_storage_size.storage_size;
+
+            if (!storage_size)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
 
             /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
             if (NULL ==
-                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset dataspace",
-                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset storage size",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            /* Set up async task if necessary.  The stored size of a filtered
+             * dataset is fetched from its chunks. */
+            if ((!dset->obj.item.created && dset->obj.item.open_req->status != 0) ||
+                (dset->dcpl_cache.layout == H5D_CHUNKED && dset->dcpl_cache.nfilters > 0)) {
+                /* Allocate udata struct */
+                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                 "can't allocate space for dataset get udata struct");
+
+                /* Set output value pointer in udata */
+                get_udata->hsize_out = storage_size;
+            } /* end if */
+            else if (H5_daos_dataset_get_storage_size(dset, storage_size) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset's storage size");
+
+            break;
+        }
+        default:
+            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "can't get this type of information from dataset");
+    } /* end switch */
+
+    /* Start async operation if we allocated task_udata */
+    if (get_udata) {
+        tse_task_t *get_task;
+
+        assert(int_req);
+
+        /* Finish filling in task_udata */
+        get_udata->req      = int_req;
+        get_udata->dset     = dset;
+        get_udata->get_type = get_args->op_type;
+
+        /* Create task to get dataset info.  USe empty task for everything but
+         * storage size, for the other get types the realize callback will
+         * do the actual retrieval. */
+        if (H5_daos_create_task(get_args->op_type == H5VL_DATASET_GET_STORAGE_SIZE
+                                    ? H5_daos_dataset_get_task
+                                    : H5_daos_metatask_autocomplete,
+                                0, NULL, NULL, NULL, get_udata, &get_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform get operation");
+
+        /* Save task to be scheduled later and give it a reference to req and
+         * dset */
+        assert(!first_task);
+        first_task = get_task;
+        dep_task   = get_task;
+        dset->obj.item.rc++;
+        int_req->rc++;
+        get_udata = NULL;
+    } /* end if */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the object's request queue.  This will add the
+         * dependency on the dataset open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL,
+                             "dataset get operation failed in task \"%s\": %s", int_req->failed_task,
+                             H5_daos_err_to_string(int_req->status));
+
+            /* Release our reference to the internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    /* Cleanup on error */
+    assert(!get_udata || ret_value < 0);
+    get_udata = DV_free(get_udata);
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_get() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_specific
+ *
+ * Purpose:     Performs a dataset "specific" operation
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Jordan Henderson
+ *              January, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_specific(void *_item, H5VL_dataset_specific_args_t *specific_args, hid_t dxpl_id,
+                         void H5VL_DAOS_UNUSED **req)
+{
+    H5_daos_dset_t *dset       = (H5_daos_dset_t *)_item;
+    H5_daos_req_t  *int_req    = NULL;
+    tse_task_t     *first_task = NULL;
+    tse_task_t     *dep_task   = NULL;
+    hbool_t         collective_md_read;
+    hbool_t         collective_md_write;
+    hbool_t         must_coll_req = FALSE;
+    hid_t           dapl_id       = H5P_DATASET_ACCESS_DEFAULT;
+    int             ret;
+    herr_t          ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (!_item)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (!specific_args)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    if (H5I_DATASET != dset->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Determine metadata I/O mode setting (collective vs. independent)
+     * for metadata reads and writes according to file-wide setting on FAPL.
+     */
+    H5_DAOS_GET_METADATA_IO_MODES(dset->obj.item.file, dapl_id, H5P_DATASET_ACCESS_DEFAULT,
+                                  collective_md_read, collective_md_write, H5E_DATASET, FAIL);
+
+    switch (specific_args->op_type) {
+        case H5VL_DATASET_SET_EXTENT: {
+            const hsize_t *size = specific_args->args.set_extent.size;
+
+            if (!size)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "size parameter is NULL");
+
+            /* Wait for the dataset to open if necessary */
+            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
+                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+                if (dset->obj.item.open_req->status != 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "dataset open failed");
+            } /* end if */
+
+            if (H5D_CHUNKED != dset->dcpl_cache.layout)
+                D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dataset storage layout is not chunked");
+
+            /* Start H5 operation */
+            if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "set dataset extent",
+                                                      dset->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+#ifdef H5_DAOS_USE_TRANSACTIONS
+            /* Start transaction */
+            if (0 != (ret = daos_tx_open(dset->obj.item.file->coh, &int_req->th, 0, NULL /*event*/)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start transaction");
+            int_req->th_open = TRUE;
+#endif /* H5_DAOS_USE_TRANSACTIONS */
+
+            /* Call main routine */
+            must_coll_req = collective_md_write;
+            if (H5_daos_dataset_set_extent(dset, size, collective_md_write, int_req, &first_task, &dep_task) <
+                0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "failed to set dataset extent");
+
+            break;
+        } /* end block */
+
+        case H5VL_DATASET_FLUSH: {
+            /* Start H5 operation */
+            if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset flush",
+                                                      dset->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+            if (H5_daos_dataset_flush(dset, int_req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush dataset");
+
+            break;
+        } /* end block */
+
+        case H5VL_DATASET_REFRESH: {
+            /* Start H5 operation */
+            if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset refresh",
+                                                      dset->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+#ifdef H5_DAOS_USE_TRANSACTIONS
+            /* Start transaction */
+            if (0 !=
+                (ret = daos_tx_open(dset->obj.item.file->coh, &int_req->th, DAOS_TF_RDONLY, NULL /*event*/)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start transaction");
+            int_req->th_open = TRUE;
+#endif /* H5_DAOS_USE_TRANSACTIONS */
+
+            /* Call main routine */
+            if (H5_daos_dataset_refresh(dset, dxpl_id, int_req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "failed to refresh dataset");
+
+            break;
+        } /* end block */
+
+        default:
+            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported dataset specific operation");
+    } /* end switch */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the object's request queue.  This will add the
+         * dependency on the dataset open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item,
+                                specific_args->op_type == H5VL_DATASET_SET_EXTENT ||
+                                        specific_args->op_type == H5VL_DATASET_FLUSH
+                                    ? H5_DAOS_OP_TYPE_WRITE_ORDERED
+                                    : H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, must_coll_req, !req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL,
+                             "dataset specific operation failed in task \"%s\": %s", int_req->failed_task,
+                             H5_daos_err_to_string(int_req->status));
+
+            /* Close internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* else */
+    }     /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_specific() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_close_real
+ *
+ * Purpose:     Internal version of H5_daos_dataset_close().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              October, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_close_real(H5_daos_dset_t *dset)
+{
+    size_t i;
+    int    ret;
+    herr_t ret_value = SUCCEED;
+
+    if (!dset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
+    if (H5I_DATASET != dset->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+
+    if (--dset->obj.item.rc == 0) {
+        /* Free dataset data structures */
+        if (dset->obj.item.cur_op_pool)
+            H5_daos_op_pool_free(dset->obj.item.cur_op_pool);
+        if (H5_daos_obj_unshare(&dset->obj) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't release shared dataset state");
+        if (dset->obj.item.open_req)
+            if (H5_daos_req_free_int(dset->obj.item.open_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        if (!daos_handle_is_inval(dset->obj.obj_oh))
+            if (0 != (ret = daos_obj_close(dset->obj.obj_oh, NULL /*event*/)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset DAOS object: %s",
+                             H5_daos_err_to_string(ret));
+        if (dset->type_id != H5I_INVALID_HID && H5Idec_ref(dset->type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dataset's datatype");
+        if (dset->file_type_id != H5I_INVALID_HID && H5Idec_ref(dset->file_type_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dataset's file datatype");
+        if (dset->space_id != H5I_INVALID_HID && H5Idec_ref(dset->space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dataset's dataspace");
+        if (dset->dcpl_id != H5I_INVALID_HID && dset->dcpl_id != H5P_DATASET_CREATE_DEFAULT)
+            if (H5Idec_ref(dset->dcpl_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dcpl");
+        if (dset->dapl_id != H5I_INVALID_HID && dset->dapl_id != H5P_DATASET_ACCESS_DEFAULT)
+            if (H5Idec_ref(dset->dapl_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dapl");
+        if (dset->fill_val)
+            dset->fill_val = DV_free(dset->fill_val);
+        H5_daos_dset_peers_remove(dset);
+        if (dset->compact.buf)
+            dset->compact.buf = DV_free(dset->compact.buf);
+        if (dset->dcpl_cache.filters)
+            dset->dcpl_cache.filters = DV_free(dset->dcpl_cache.filters);
+        /* Clear dataset I/O cache */
+        if ((dset->io_cache.file_sel_iter_id > 0) && (H5Ssel_iter_close(dset->io_cache.file_sel_iter_id) < 0))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to close selection iterator");
+        if ((dset->io_cache.mem_sel_iter_id > 0) && (H5Ssel_iter_close(dset->io_cache.mem_sel_iter_id) < 0))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to close selection iterator");
+        for (i = 0; i < H5_DAOS_SEL_CACHE_NENTRIES; i++) {
+            DV_free(dset->io_cache.sel_cache[i].key);
+            DV_free(dset->io_cache.sel_cache[i].seqs);
+        } /* end for */
+        if (dset->io_cache.chunk_info && (dset->io_cache.chunk_info != &dset->io_cache.single_chunk_info)) {
+            H5_daos_select_chunk_info_t *chunk_info;
+
+            for (i = 0; i < dset->io_cache.chunk_info_nalloc; i++) {
+                chunk_info = &dset->io_cache.chunk_info[i];
+                if ((chunk_info->fspace_id >= 0) && (H5Sclose(chunk_info->fspace_id) < 0))
+                    D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk file dataspace");
+                if ((chunk_info->mspace_id >= 0) && (H5Sclose(chunk_info->mspace_id) < 0))
+                    D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk memory dataspace");
+            }
+
+            DV_free(dset->io_cache.chunk_info);
+        }
+        H5_daos_chunk_cache_free(dset);
+        H5_daos_chunk_index_release(dset);
+        dset = H5FL_FREE(H5_daos_dset_t, dset);
+    } /* end if */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_close_real() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_close
+ *
+ * Purpose:     Closes a DAOS HDF5 dataset.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2016
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_close(void *_dset, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
+{
+    H5_daos_dset_t              *dset       = (H5_daos_dset_t *)_dset;
+    H5_daos_obj_close_task_ud_t *task_ud    = NULL;
+    tse_task_t                  *first_task = NULL;
+    tse_task_t                  *dep_task   = NULL;
+    H5_daos_req_t               *int_req    = NULL;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    H5_daos_inc_api_cnt();
+
+    if (!_dset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /* Check if the dataset's request queue is NULL, if so we can close it
+     * immediately.  Also close if the pool is empty and has no start task (and
+     * hence does not depend on anything), unless the chunk cache must be
+     * written back first.  Also close if it is marked to close nonblocking. */
+    if (((dset->obj.item.open_req->status == 0 || dset->obj.item.open_req->status < -H5_DAOS_CANCELED) &&
+         (!dset->obj.item.cur_op_pool || (dset->obj.item.cur_op_pool->type == H5_DAOS_OP_TYPE_EMPTY &&
+                                          !dset->obj.item.cur_op_pool->start_task)) &&
+         !H5_daos_chunk_cache_is_dirty(dset)) ||
+        dset->obj.item.nonblocking_close) {
+        if (H5_daos_dataset_close_real(dset) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataset");
+    } /* end if */
+    else {
+        tse_task_t *close_task = NULL;
+
+        /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
+        if (NULL ==
+            (int_req = H5_daos_req_create(dset->obj.item.file, "dataset close", dset->obj.item.open_req, NULL,
+                                          NULL, H5P_DATASET_XFER_DEFAULT)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+        /* Allocate argument struct */
+        if (NULL == (task_ud = (H5_daos_obj_close_task_ud_t *)DV_calloc(sizeof(H5_daos_obj_close_task_ud_t))))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                         "can't allocate space for close task udata struct");
+        task_ud->req  = int_req;
+        task_ud->item = &dset->obj.item;
+
+        /* Write back the chunk cache before closing, if it may be in use */
+        if ((!dset->io_cache.filled || dset->chunk_cache.table) &&
+            H5_daos_chunk_cache_flush(dset, FALSE, int_req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't flush chunk cache");
+
+        /* Create task to close dataset */
+        if (H5_daos_create_task(H5_daos_object_close_task, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                                NULL, NULL, task_ud, &close_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to close dataset");
+
+        /* Schedule close task (or save it to be scheduled later) and give it
+         * a reference to req */
+        if (first_task) {
+            if (0 != (ret = tse_task_schedule(close_task, false)))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to close dataset: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = close_task;
+        dep_task = close_task;
+        /* No need to take a reference to dset here since the purpose is to
+         * release the API's reference */
+        int_req->rc++;
+        task_ud = NULL;
+    } /* end else */
+
+done:
+    if (int_req) {
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the object's request queue.  This will add the
+         * dependency on the dataset open if necessary. */
+        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_CLOSE,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+        dset = NULL;
+
+        /* Check for external async */
+        if (req) {
+            /* Return int_req as req */
+            *req = int_req;
+
+            /* Kick task engine */
+            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        } /* end if */
+        else {
+            /* Block until operation completes */
+            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+            /* Check for failure */
+            if (int_req->status < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "dataset close failed in task \"%s\": %s",
+                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+            /* Release our reference to the internal request */
+            if (H5_daos_req_free_int(int_req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+        } /* end else */
+    }     /* end if */
+
+    /* Cleanup on error */
+    if (task_ud) {
+        assert(ret_value < 0);
+        task_ud = DV_free(task_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_close() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_flush
+ *
+ * Purpose:     Flushes a DAOS dataset.  Creates a task that writes back
+ *              the dataset's chunk cache and acts as a barrier so all
+ *              async ops created before the flush execute before all
+ *              async ops created after the flush.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Jordan Henderson
+ *              July, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_flush(H5_daos_dset_t *dset, H5_daos_req_t *req, tse_task_t **first_task,
+                      tse_task_t **dep_task)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(dset);
+    assert(!*first_task);
+
+    /* Create task to write back the chunk cache.  This is also necessary
+     * because we can't enqueue a request that has no tasks */
+    if (H5_daos_chunk_cache_flush(dset, FALSE, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to flush dataset");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_refresh_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous metadata fetch for
+ *              dataset refresh operations.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_dataset_refresh_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_omd_fetch_ud_t *udata;
+    uint8_t                *p;
+    int                     ret;
+    int                     ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for dataset dataspace read task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->fetch_metatask);
+
+    /* Check for buffer not large enough */
+    if (task->dt_result == -DER_REC2BIG) {
+        tse_task_t *fetch_task;
+        size_t      daos_info_len = udata->md_rw_cb_ud.iod[0].iod_size;
+
+        assert(udata->md_rw_cb_ud.req->file);
+        assert(udata->md_rw_cb_ud.obj);
+        assert(udata->md_rw_cb_ud.obj->item.type == H5I_DATASET);
+
+        /* Verify iod size makes sense */
+        if (udata->md_rw_cb_ud.sg_iov[0].iov_buf_len != H5_DAOS_SPACE_BUF_SIZE)
+            D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                         "buffer length does not match expected value");
+
+        if (udata->bcast_udata) {
+            /* Reallocate dataspace buffer if necessary */
+            if (daos_info_len > H5_DAOS_SPACE_BUF_SIZE) {
+                udata->bcast_udata->bcast_udata.buffer = DV_free(udata->bcast_udata->bcast_udata.buffer);
+                if (NULL == (udata->bcast_udata->bcast_udata.buffer =
+                                 DV_malloc(daos_info_len + H5_DAOS_ENCODED_UINT64_T_SIZE)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                 "can't allocate buffer for serialized dataspace info");
+                udata->bcast_udata->bcast_udata.buffer_len =
+                    (int)daos_info_len + H5_DAOS_ENCODED_UINT64_T_SIZE;
+            } /* end if */
+
+            /* Set starting point for fetch sg_iovs */
+            p = (uint8_t *)udata->bcast_udata->bcast_udata.buffer + H5_DAOS_ENCODED_UINT64_T_SIZE;
+        } /* end if */
+        else {
+            /* Reallocate dataset info buffer if necessary */
+            if (daos_info_len > H5_DAOS_SPACE_BUF_SIZE) {
+                udata->md_rw_cb_ud.sg_iov[0].iov_buf = DV_free(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+                if (NULL == (udata->md_rw_cb_ud.sg_iov[0].iov_buf = DV_malloc(daos_info_len)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                 "can't allocate buffer for serialized dataspace info");
+            } /* end if */
+
+            /* Set starting point for fetch sg_iovs */
+            p = (uint8_t *)udata->md_rw_cb_ud.sg_iov[0].iov_buf;
+        } /* end else */
+
+        /* Set up sgl */
+        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], p, udata->md_rw_cb_ud.iod[0].iod_size);
+        udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+
+        /* Create task for reissued dataset dataspace read */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
+                                     H5_daos_dataset_refresh_comp_cb, udata, &fetch_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task to read dataset dataspace");
+
+        /* Schedule reissued dataset dataspace read task */
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task to read dataset dataspace: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Relinquish control of the object fetch udata to the task's completion callback */
+        udata = NULL;
+    } /* end if */
+    else {
+        /* Handle errors in fetch task.  Only record error in udata->req_status
+         * if it does not already contain an error (it could contain an error if
+         * another task this task is not dependent on also failed). */
+        if (task->dt_result < -H5_DAOS_PRE_ERROR &&
+            udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = task->dt_result;
+            udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+        } /* end if */
+        else if (task->dt_result == 0) {
+            H5_daos_dset_t *dset = (H5_daos_dset_t *)udata->md_rw_cb_ud.obj;
+            hid_t           decoded_space;
+
+            assert(udata->md_rw_cb_ud.req->file);
+            assert(udata->md_rw_cb_ud.obj);
+            assert(udata->md_rw_cb_ud.obj->item.type == H5I_DATASET);
+
+            if (udata->bcast_udata) {
+                /* Encode serialized dataspace length */
+                p = udata->bcast_udata->bcast_udata.buffer;
+                UINT64ENCODE(p, udata->md_rw_cb_ud.iod[0].iod_size)
+                assert(p == udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+            } /* end if */
+
+            /* Decode dataspace */
+            if ((decoded_space = H5Sdecode(udata->md_rw_cb_ud.sg_iov[0].iov_buf)) < 0)
+                D_GOTO_ERROR(H5E_ARGS, H5E_CANTDECODE, -H5_DAOS_H5_DECODE_ERROR,
+                             "can't deserialize dataspace");
+
+            /* Close dataset's current dataspace ID */
+            if (dset->space_id >= 0 && H5Sclose(dset->space_id) < 0) {
+                H5Sclose(decoded_space);
+                D_GOTO_ERROR(H5E_DATASPACE, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't close dataset's old dataspace");
+            }
+
+            dset->space_id = decoded_space;
+
+            /* Later opens of the dataset should copy the new dataspace */
+            H5_daos_obj_set_shared_md(&dset->obj, TRUE);
+        } /* end else */
+    }     /* end else */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Clean up if this is the last fetch task */
+    if (udata) {
+        /* Close dataset */
+        if (udata->md_rw_cb_ud.obj &&
+            H5_daos_dataset_close_real((H5_daos_dset_t *)udata->md_rw_cb_ud.obj) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
+
+        if (udata->bcast_udata) {
+            /* Clear broadcast buffer if there was an error */
+            if (udata->md_rw_cb_ud.req->status < -H5_DAOS_INCOMPLETE)
+                (void)memset(udata->bcast_udata->bcast_udata.buffer, 0,
+                             (size_t)udata->bcast_udata->bcast_udata.count);
+        } /* end if */
+        else
+            /* No broadcast, free buffer */
+            DV_free(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, udata->fetch_metatask) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Complete fetch metatask */
+        tse_task_complete(udata->fetch_metatask, ret_value);
+
+        assert(!udata->md_rw_cb_ud.free_dkey);
+        assert(!udata->md_rw_cb_ud.free_akeys);
+
+        /* Free udata */
+        DV_free(udata);
+    } /* end if */
+
+    return ret_value;
+} /* end H5_daos_dataset_refresh_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_refresh
+ *
+ * Purpose:     Refreshes a DAOS dataset (reads the dataspace)
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              July, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_refresh(H5_daos_dset_t *dset, hid_t H5VL_DAOS_UNUSED dxpl_id, H5_daos_req_t *req,
+                        tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_omd_fetch_ud_t *fetch_udata    = NULL;
+    tse_task_t             *fetch_task     = NULL;
+    uint8_t                *space_buf      = NULL;
+    size_t                  space_buf_size = 0;
+    int                     ret;
+    herr_t                  ret_value = SUCCEED;
+
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Set initial size for dataspace buffer */
+    space_buf_size = H5_DAOS_SPACE_BUF_SIZE;
+
+    /* Allocate argument struct for fetch task */
+    if (NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(sizeof(H5_daos_omd_fetch_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for fetch callback arguments");
+
+    /* Set up operation to read dataspace size from dataset */
+
+    /* Setup UD struct */
+    fetch_udata->md_rw_cb_ud.obj = &dset->obj;
+    fetch_udata->md_rw_cb_ud.req = req;
+    fetch_udata->bcast_udata     = NULL;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                       H5_daos_int_md_key_size_g);
+    fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Set up iod */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_space_key_g,
+                       H5_daos_space_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+
+    fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
+
+    /* Allocate initial dataspace buffer */
+    if (NULL == (space_buf = DV_malloc(space_buf_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for serialized dataspace info");
+
+    /* Set up sgl */
+    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], space_buf, H5_DAOS_SPACE_BUF_SIZE);
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = TRUE;
+
+    fetch_udata->md_rw_cb_ud.nr = 1u;
+
+    fetch_udata->md_rw_cb_ud.task_name = "dataset refresh (read dataspace)";
+
+    /* Create meta task for dataspace read. This empty task will be
+     * completed when the read is finished by H5_daos_dataset_refresh_comp_cb.
+     * We can't use fetch_task since it may not be completed by the first
+     * fetch. */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &fetch_udata->fetch_metatask) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create meta task for dataset dataspace read");
+
+    /* Create task for dataset dataspace read */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_md_rw_prep_cb, H5_daos_dataset_refresh_comp_cb, fetch_udata,
+                                 &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read dataset dataspace");
+
+    /* Schedule meta task */
+    if (0 != (ret = tse_task_schedule(fetch_udata->fetch_metatask, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                     "can't schedule meta task for dataset dataspace read: %s", H5_daos_err_to_string(ret));
+
+    /* Schedule object fetch task (or save it to be scheduled later) and give it
+     * a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                         "can't schedule task to fetch dataset dataspace: %s", H5_daos_err_to_string(ret));
+    }
+    else
+        *first_task = fetch_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    *dep_task = fetch_udata->fetch_metatask;
+
+    /* Relinquish control of the object fetch udata and dataspace buffer to the
+     * task's completion callback */
+    fetch_udata = NULL;
+    space_buf   = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        space_buf   = DV_free(space_buf);
+        fetch_udata = DV_free(fetch_udata);
+    }
+
+    assert(!space_buf);
+    assert(!fetch_udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_refresh() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_set_extent_comp_cb
+ *
+ * Purpose:     Completion callback for H5Dset_extent.  Like
+ *              H5_daos_md_update_comp_cb but also updates the dataset
+ *              dataspace.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              November, 2020
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dset_set_extent_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_dset_set_extent_ud_t *udata;
+    unsigned                      i;
+    int                           ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for metadata I/O task");
+
+    /* Clear cached new space ID on dataset */
+    if (((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->cur_set_extent_space_id == udata->new_space_id)
+        ((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->cur_set_extent_space_id = H5I_INVALID_HID;
+
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+
+        /* Chunks were already removed from the chunk index for the new
+         * extent, so it can no longer be trusted */
+        if (((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->chunk_index)
+            ((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->chunk_index->complete = FALSE;
+    } /* end if */
+    else if (task->dt_result == 0) {
+        /* Close old space ID */
+        if (H5Sclose(((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataspace");
+
+        /* Set new dataspace in dataset struct */
+        ((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->space_id = udata->new_space_id;
+        udata->new_space_id                                  = H5I_INVALID_HID;
+
+        /* Later opens of the dataset should copy the new dataspace */
+        H5_daos_obj_set_shared_md(udata->md_rw_cb_ud.obj, TRUE);
+    } /* end if */
+
+    /* Close object */
+    if (udata->md_rw_cb_ud.obj && H5_daos_object_close(&udata->md_rw_cb_ud.obj->item) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+
+    /* Close new dataspace on error */
+    if (udata->new_space_id >= 0) {
+        assert(ret_value < 0 || task->dt_result < -H5_DAOS_PRE_ERROR);
+        if (H5Sclose(udata->new_space_id) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataspace");
+    } /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = ret_value;
+        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    if (udata->md_rw_cb_ud.free_dkey)
+        DV_free(udata->md_rw_cb_ud.dkey.iov_buf);
+    if (udata->md_rw_cb_ud.free_akeys)
+        for (i = 0; i < udata->md_rw_cb_ud.nr; i++)
+            DV_free(udata->md_rw_cb_ud.iod[i].iod_name.iov_buf);
+    for (i = 0; i < udata->md_rw_cb_ud.nr; i++)
+        if (udata->md_rw_cb_ud.free_sg_iov[i])
+            DV_free(udata->md_rw_cb_ud.sg_iov[i].iov_buf);
+    DV_free(udata);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dset_set_extent_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_set_extent
+ *
+ * Purpose:     Changes the extent of a dataset
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ * Programmer:  Neil Fortner
+ *              July, 2019
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_set_extent(H5_daos_dset_t *dset, const hsize_t *size, hbool_t collective, H5_daos_req_t *req,
+                           tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_dset_set_extent_ud_t *update_cb_ud = NULL;
+    tse_task_t                   *update_task  = NULL;
+    hsize_t                       maxdims[H5S_MAX_RANK];
+    hsize_t                       old_dims[H5S_MAX_RANK];
+    hbool_t                       shrink = FALSE;
+    int                           ndims;
+    void                         *space_buf = NULL;
+    int                           i;
+    int                           ret;
+    herr_t                        ret_value = SUCCEED;
+
+    assert(dset);
+    assert(size);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Check for write access */
+    if (!(dset->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Get dataspace rank */
+    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get current dataspace rank");
+
+    /* Get dataspace max dims */
+    if (H5Sget_simple_extent_dims(dset->space_id, NULL, maxdims) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get current dataspace maximum dimensions");
+
+    /* Make sure max dims aren't exceeded */
+    for (i = 0; i < ndims; i++)
+        if ((maxdims[i] != H5S_UNLIMITED) && (size[i] > maxdims[i]))
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL,
+                         "requested dataset dimensions exceed maximum dimensions");
+
+    /* Get the dimensions before this change, including any set_extent still
+     * in progress */
+    if (H5Sget_simple_extent_dims(dset->cur_set_extent_space_id >= 0 ? dset->cur_set_extent_space_id
+                                                                      : dset->space_id,
+                                  old_dims, NULL) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get current dataspace dimensions");
+
+    /* Allocate task udata */
+    if (NULL ==
+        (update_cb_ud = (H5_daos_dset_set_extent_ud_t *)DV_calloc(sizeof(H5_daos_dset_set_extent_ud_t))))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                     "can't allocate space for dataset set extent udata struct");
+    update_cb_ud->md_rw_cb_ud.req       = req;
+    update_cb_ud->md_rw_cb_ud.obj       = &dset->obj;
+    update_cb_ud->md_rw_cb_ud.task_name = "dataset set extent";
+
+    /* Copy dataset dataspace */
+    if ((update_cb_ud->new_space_id = H5Scopy(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataspace");
+
+    /* Set extent on new dataspace */
+    if (H5Sset_extent_simple(update_cb_ud->new_space_id, ndims, size, maxdims) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set dataspace dimensions");
+
+    /* Cache new space id on dataset struct - to be used by H5Dget_space to
+     * avoid needing to wait until this set_extent completes */
+    dset->cur_set_extent_space_id = update_cb_ud->new_space_id;
+
+    /* Write new dataspace to dataset in file if this process should */
+    if (!collective || (dset->obj.item.file->my_rank == 0)) {
+        size_t space_size = 0;
+
+        /* Encode dataspace */
+        if (H5Sencode2(update_cb_ud->new_space_id, NULL, &space_size, dset->obj.item.file->fapl_id) < 0)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't determine serialized length of dataspace");
+        if (NULL == (space_buf = DV_malloc(space_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for serialized dataspace");
+        if (H5Sencode2(update_cb_ud->new_space_id, space_buf, &space_size, dset->obj.item.file->fapl_id) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "can't serialize dataspace");
+
+        /* Set up operation to write dataspace to dataset */
+
+        /* Set up dkey */
+        daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                           H5_daos_int_md_key_size_g);
+        update_cb_ud->md_rw_cb_ud.free_dkey = FALSE;
+
+        /* Set up iod */
+        daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[0].iod_name, H5_daos_space_key_g,
+                           H5_daos_space_key_size_g);
+        update_cb_ud->md_rw_cb_ud.iod[0].iod_nr   = 1u;
+        update_cb_ud->md_rw_cb_ud.iod[0].iod_size = (uint64_t)space_size;
+        update_cb_ud->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+
+        update_cb_ud->md_rw_cb_ud.free_akeys = FALSE;
+
+        /* Set up sgl */
+        daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[0], space_buf, (daos_size_t)space_size);
+        update_cb_ud->md_rw_cb_ud.sgl[0].sg_nr     = 1;
+        update_cb_ud->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+        update_cb_ud->md_rw_cb_ud.sgl[0].sg_iovs   = &update_cb_ud->md_rw_cb_ud.sg_iov[0];
+        update_cb_ud->md_rw_cb_ud.free_sg_iov[0]   = TRUE;
+
+        update_cb_ud->md_rw_cb_ud.nr = 1u;
+
+        /* Create task to write updated dataspace to dataset */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                     H5_daos_md_rw_prep_cb, H5_daos_dset_set_extent_comp_cb, update_cb_ud,
+                                     &update_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to update object");
+    } /* end if */
+    else {
+        /* Don't need to write dataspace to file, but still need to create a
+         * task to update dset->space_id at the right time */
+        /* Create empty task (comp_cb will update dset->space_id) */
+        if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, H5_daos_dset_set_extent_comp_cb,
+                                update_cb_ud, &update_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform get operation");
+    } /* end else */
+
+    assert(update_task);
+
+    /* Schedule object update task (or save it to be scheduled later) and give it
+     * a reference to req */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(update_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to update object: %s",
+                         H5_daos_err_to_string(ret));
+    }
+    else
+        *first_task = update_task;
+    req->rc++;
+    dset->obj.item.rc++;
+
+    /* Relinquish control of the object update udata and dataspace buffer to the
+     * task's completion callback */
+    update_cb_ud = NULL;
+    space_buf    = NULL;
+
+    *dep_task = update_task;
+
+    /* If the dataset shrinks, remove the data outside the new extent */
+    for (i = 0; i < ndims; i++)
+        if (size[i] < old_dims[i])
+            shrink = TRUE;
+    if (shrink && dset->dcpl_cache.layout == H5D_CHUNKED) {
+        /* Cached chunks must not be written back after they are pruned, so
+         * write back and drop them first */
+        if (dset->chunk_cache.table)
+            if (H5_daos_chunk_cache_flush(dset, TRUE, req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+
+        /* Punch or trim the chunks if this process should.  This must be set
+         * up before the chunk index is shrunk below. */
+        if (!collective || (dset->obj.item.file->my_rank == 0))
+            if (H5_daos_chunk_prune(dset, size, old_dims, ndims, req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "can't remove chunks outside new extent");
+    } /* end if */
+
+    /* Remove chunks outside the new extent from the chunk index.  Each
+     * process punches the entries it knows about, which is harmless if
+     * another process punches them too. */
+    if (dset->chunk_index) {
+        uint8_t *index_akey_buf = NULL;
+        unsigned nremoved       = 0;
+
+        if (H5_daos_chunk_index_shrink(dset, size, ndims, &index_akey_buf, &nremoved) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "can't remove chunks from chunk index");
+        if (nremoved > 0 && H5_daos_chunk_index_write(dset, index_akey_buf, nremoved, ndims, FALSE, TRUE, req,
+                                                      first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't punch chunks from chunk index");
+    } /* end if */
+
+done:
+    if (collective && (dset->obj.item.file->num_procs > 1))
+        if (H5_daos_collective_error_check(&dset->obj, req, first_task, dep_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform collective error check");
+
+    /* Cleanup on failure */
+    if (ret_value < 0) {
+        space_buf = DV_free(space_buf);
+
+        if (update_cb_ud) {
+            if (H5Sclose(update_cb_ud->new_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataspace");
+            update_cb_ud = DV_free(update_cb_ud);
+        } /* end if */
+    }     /* end if */
+
+    assert(!space_buf);
+    assert(!update_cb_ud);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_set_extent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_point_and_block
+ *
+ * Purpose:     Intersects the point selection in point_space with the
+ *              block specified with start and block, and returns a
+ *              dataspace with the intersecting points selected.
+ *
+ * Return:      Success: Dataspace with the intersecting points selected
+ *              Failure: H5I_INVALID_HID
+ *
+ *-------------------------------------------------------------------------
+ */
+static hid_t
+H5_daos_point_and_block(hid_t point_space, hsize_t rank, hsize_t *dims, hsize_t *start, hsize_t *block)
+{
+    hsize_t       points_in[H5_DAOS_POINT_BUF_LEN];
+    hsize_t       points_out[H5_DAOS_POINT_BUF_LEN];
+    const hsize_t npoints_buf = H5_DAOS_POINT_BUF_LEN / rank;
+    hssize_t      npoints_in_left;
+    hsize_t       npoints_in_done = 0;
+    hsize_t       npoints_in_this_iter;
+    hsize_t       npoints_out = 0;
+    hsize_t       npoints_out_this_iter;
+    hid_t         space_out = H5I_INVALID_HID;
+    hsize_t       i, j;
+    hid_t         ret_value = H5I_INVALID_HID;
+
+    /* Get number of points */
+    if ((npoints_in_left = H5Sget_select_elem_npoints(point_space)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, H5I_INVALID_HID, "can't get number of points in selection");
+
+    /* Create output space */
+    if ((space_out = H5Screate_simple((int)rank, dims, NULL)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, H5I_INVALID_HID, "can't create output space");
+
+    /* Loop until we've processed all points */
+    while (npoints_in_left > 0) {
+        /* Calculate number of points to fetch */
+        npoints_in_this_iter =
+            npoints_in_left > (hssize_t)npoints_buf ? npoints_buf : (hsize_t)npoints_in_left;
+
+        /* Fetch points */
+        if (H5Sget_select_elem_pointlist(point_space, npoints_in_done, npoints_in_this_iter, points_in) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, H5I_INVALID_HID, "can't get points from selection");
+
+        /* Add intersecting points to points_out */
+        npoints_out_this_iter = 0;
+        for (i = 0; i < npoints_in_this_iter; i++) {
+            for (j = 0; (j < rank) && (points_in[(i * rank) + j] >= start[j]) &&
+                        (points_in[(i * rank) + j] < start[j] + block[j]);
+                 j++)
+                ;
+            if (j == rank) {
+                memcpy(&points_out[npoints_out_this_iter * rank], &points_in[i * rank],
+                       rank * sizeof(points_in[0]));
+                npoints_out_this_iter++;
+            } /* end if */
+        }     /* end for */
+
+        /* Select elements in points_out */
+        if (npoints_out_this_iter &&
+            H5Sselect_elements(space_out, npoints_out ? H5S_SELECT_APPEND : H5S_SELECT_SET,
+                               (size_t)npoints_out_this_iter, points_out) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, H5I_INVALID_HID, "can't select points");
+
+        /* Advance points */
+        assert(npoints_in_left >= (hssize_t)npoints_in_this_iter);
+        npoints_in_left -= (hssize_t)npoints_in_this_iter;
+        npoints_in_done += npoints_in_this_iter;
+        npoints_out += npoints_out_this_iter;
+    } /* end while */
+
+    /* Set return value */
+    ret_value = space_out;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0)
+        if (space_out >= 0 && H5Sclose(space_out) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, H5I_INVALID_HID, "can't close dataspace");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_point_and_block() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_selected_chunk_info
+ *
+ * Purpose:     Calculates the starting coordinates for the chunks selected
+ *              in the file space given by file_space_id and sets up
+ *              individual memory and file spaces for each chunk. Selected
+ *              chunk's coordinates and dataspaces are returned through the
+ *              `chunk_info` struct pointer.
+ *
+ *              In order to support caching of all of the file and memory
+ *              dataspaces that get created for selected chunks, valid
+ *              `chunk_info`/`chunk_info_len` pointers that have been
+ *              allocated/set by this routine may be passed in. In this
+ *              case, the existing dataspaces will be re-used for dataspace
+ *              operations rather than creating new ones. Note that this
+ *              assumes that the `chunk_info`/`chunk_info_len` pointers
+ *              passed in always come from the same dataset object with the
+ *              same chunk dimensionality.
+ *
+ *              NOTE: In several places in this routine, an adjustment is
+ *                    calculated in order to move the selection within a
+ *                    chunk around by using H5Sselect_adjust. Since this
+ *                    API routine accepts an array of signed values, this
+ *                    adjustment is calculated by converting unsigned
+ *                    coordinates to signed coordinates without a check
+ *                    for overflow. In the future, it would be nice if
+ *                    HDF5 could support subtracting and adding of
+ *                    offsets to selections with routines that accept
+ *                    arrays of unsigned offsets so this can be done
+ *                    safely.
+ *
+ *              XXX: Note that performance could be increased by
+ *                   calculating all of the chunks in the entire dataset
+ *                   and then caching them in the dataset object for
+ *                   re-use in subsequent reads/writes
+ *
+ * Return:      Success: 0
+ *              Failure: -1
+ *
+ * Programmer:  Neil Fortner
+ *              May, 2018
+ *              Based on H5VL_daosm_get_selected_chunk_info by Jordan
+ *              Henderson, May, 2017
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache, hid_t file_space_id, hid_t mem_space_id,
+                                H5_daos_select_chunk_info_t **chunk_info, size_t *chunk_info_len,
+                                size_t *nchunks_selected)
+{
+    H5_daos_select_chunk_info_t *_chunk_info = NULL;
+    H5S_sel_type                 file_space_type;
+    hssize_t                     num_sel_points;
+    hssize_t                     chunk_file_space_adjust[H5O_LAYOUT_NDIMS];
+    hsize_t                      file_space_dims[H5S_MAX_RANK], mem_space_dims[H5S_MAX_RANK];
+    hsize_t                     *chunk_dims;
+    hsize_t                      curr_chunk_dims[H5S_MAX_RANK] = {0};
+    hsize_t                      file_sel_start[H5S_MAX_RANK], file_sel_end[H5S_MAX_RANK];
+    hsize_t                      mem_sel_start[H5S_MAX_RANK], mem_sel_end[H5S_MAX_RANK];
+    hsize_t                      start_coords[H5O_LAYOUT_NDIMS], end_coords[H5O_LAYOUT_NDIMS];
+    hsize_t                      selection_start_coords[H5O_LAYOUT_NDIMS] = {0};
+    hbool_t                      is_partial_edge_chunk                    = FALSE;
+    hbool_t                      file_mem_space_same                      = (file_space_id == mem_space_id);
+    htri_t                       space_same_shape                         = FALSE;
+    size_t                       chunk_info_nalloc                        = 0;
+    ssize_t                      i                                        = -1, j;
+    hid_t                        entire_chunk_sel_space_id                = H5I_INVALID_HID;
+    int                          fspace_ndims, mspace_ndims;
+    int                          increment_dim;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(dcpl_cache);
+    assert(chunk_info);
+    assert(nchunks_selected);
+
+    if ((num_sel_points = H5Sget_select_npoints(file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                     "can't get number of points selected in file dataspace");
+    if (num_sel_points == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate selected chunk info buffer or use already-allocated buffer */
+    if (!*chunk_info) {
+        if (NULL == (_chunk_info = (H5_daos_select_chunk_info_t *)DV_calloc(H5_DAOS_DEFAULT_NUM_SEL_CHUNKS *
+                                                                            sizeof(*_chunk_info))))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                         "can't allocate space for selected chunk info buffer");
+        chunk_info_nalloc = H5_DAOS_DEFAULT_NUM_SEL_CHUNKS;
+
+        /* Ensure that every chunk info structure's dataspaces are initialized */
+        for (i = 0; i < (ssize_t)chunk_info_nalloc; i++)
+            _chunk_info[i].fspace_id = _chunk_info[i].mspace_id = H5I_INVALID_HID;
+    } /* end if */
+    else {
+        assert(chunk_info_len && (*chunk_info_len > 0));
+        _chunk_info       = *chunk_info;
+        chunk_info_nalloc = *chunk_info_len;
+    } /* end else */
+
+    /* Get dataspace ranks */
+    if ((fspace_ndims = H5Sget_simple_extent_ndims(file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file space dimensionality");
+    if (file_mem_space_same)
+        mspace_ndims = fspace_ndims;
+    else if ((mspace_ndims = H5Sget_simple_extent_ndims(mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory space dimensionality");
+
+    /* Get dataspace dimensionality */
+    if (H5Sget_simple_extent_dims(file_space_id, file_space_dims, NULL) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file dataspace dimensions");
+    if (file_mem_space_same)
+        memcpy(mem_space_dims, file_space_dims, (size_t)fspace_ndims * sizeof(hsize_t));
+    else if (H5Sget_simple_extent_dims(mem_space_id, mem_space_dims, NULL) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory dataspace dimensions");
+
+    /* Get the bounding box for the current selection in the file and memory spaces */
+    if (H5Sget_select_bounds(file_space_id, file_sel_start, file_sel_end) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get bounding box for file selection");
+    if (file_mem_space_same) {
+        memcpy(mem_sel_start, file_sel_start, (size_t)fspace_ndims * sizeof(hsize_t));
+        memcpy(mem_sel_end, file_sel_end, (size_t)fspace_ndims * sizeof(hsize_t));
+    } /* end if */
+    else if (H5Sget_select_bounds(mem_space_id, mem_sel_start, mem_sel_end) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get bounding box for memory selection");
+
+    /* Set convenience pointer to chunk dimensions */
+    chunk_dims = dcpl_cache->chunk_dims;
+
+    /* Initialize the curr_chunk_dims array */
+    memcpy(curr_chunk_dims, chunk_dims, (size_t)fspace_ndims * sizeof(hsize_t));
+
+    /* Calculate the coordinates for the initial chunk */
+    for (i = 0; i < (ssize_t)fspace_ndims; i++) {
+        start_coords[i] = selection_start_coords[i] = (file_sel_start[i] / chunk_dims[i]) * chunk_dims[i];
+        end_coords[i]                               = (start_coords[i] + chunk_dims[i]) - 1;
+    } /* end for */
+
+    /* Check if the spaces are the same "shape".  For now, reject spaces that
+     * have different ranks, until there's a public interface to
+     * H5S_select_construct_projection().  See the note in H5D__read().  With
+     * the use of H5Sselect_project_intersection() the performance penalty
+     * should be much less than with the native library anyways. */
+    if (fspace_ndims == mspace_ndims) {
+        if (file_mem_space_same)
+            space_same_shape = TRUE;
+        else if (FAIL == (space_same_shape = H5Sselect_shape_same(file_space_id, mem_space_id)))
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                         "can't determine if file and memory dataspaces are the same shape");
+    } /* end if */
+
+    if (space_same_shape) {
+        /* Calculate the adjustment for the memory selection from the file selection */
+        for (i = 0; i < (ssize_t)fspace_ndims; i++) {
+            /* H5_CHECK_OVERFLOW(file_sel_start[i], hsize_t, hssize_t); */
+            /* H5_CHECK_OVERFLOW(mem_sel_start[i], hsize_t, hssize_t); */
+            chunk_file_space_adjust[i] = (hssize_t)file_sel_start[i] - (hssize_t)mem_sel_start[i];
+        } /* end for */
+    }     /* end if */
+    else {
+        /* Create temporary dataspace to hold selection of entire chunk */
+        if ((entire_chunk_sel_space_id = H5Screate_simple(fspace_ndims, file_space_dims, NULL)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't create entire chunk selection dataspace");
+    } /* end else */
+
+    /* Get file selection type */
+    if ((file_space_type = H5Sget_select_type(file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection type");
+
+    /* Iterate through each "chunk" in the dataset */
+    for (i = -1;;) {
+        htri_t intersect = FALSE;
+
+        /* Check for intersection of file selection and "chunk". If there is
+         * an intersection, set up a valid memory and file space for the chunk. */
+        if (file_space_type == H5S_SEL_ALL)
+            intersect = TRUE;
+        else if ((intersect = H5Sselect_intersect_block(file_space_id, start_coords, end_coords)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                         "cannot determine chunk's intersection with the file dataspace");
+        if (TRUE == intersect) {
+            hssize_t chunk_space_adjust[H5O_LAYOUT_NDIMS];
+
+            /* Advance index and re-allocate selected chunk info buffer if necessary */
+            if (++i == (ssize_t)chunk_info_nalloc) {
+                void *tmp_realloc;
+
+                if (NULL ==
+                    (tmp_realloc = DV_realloc(_chunk_info, 2 * chunk_info_nalloc * sizeof(*_chunk_info))))
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                                 "can't reallocate space for selected chunk info buffer");
+                _chunk_info = (H5_daos_select_chunk_info_t *)tmp_realloc;
+
+                /* Ensure newly-allocated chunk info structures are initialized */
+                memset(&_chunk_info[chunk_info_nalloc], 0, chunk_info_nalloc * sizeof(*_chunk_info));
+                for (j = (ssize_t)chunk_info_nalloc; j < (ssize_t)chunk_info_nalloc * 2; j++)
+                    _chunk_info[j].fspace_id = _chunk_info[j].mspace_id = H5I_INVALID_HID;
+
+                chunk_info_nalloc *= 2;
+            } /* end while */
+
+            assert(i < (ssize_t)chunk_info_nalloc);
+
+            /*
+             * Set up the file Dataspace for this chunk.
+             */
+
+            /* If this is a partial edge chunk, setup the partial edge chunk dimensions.
+             * These will be used to adjust the selection within the edge chunk so that
+             * it falls within the dataset's dataspace boundaries. Also setup a selection
+             * adjustment that can be used to move the selection within the chunk back to
+             * the correct offset within the chunk, if necessary (for point and hyperslab
+             * selections).
+             */
+            for (j = 0; j < (ssize_t)fspace_ndims; j++) {
+                if (start_coords[j] + chunk_dims[j] > file_space_dims[j]) {
+                    curr_chunk_dims[j]    = file_space_dims[j] - start_coords[j];
+                    is_partial_edge_chunk = TRUE;
+                } /* end if */
+                chunk_space_adjust[j] = (hssize_t)start_coords[j];
+            } /* end for */
+
+            switch (file_space_type) {
+                case H5S_SEL_POINTS:
+                    /* Close file space if cached */
+                    if (_chunk_info[i].fspace_id >= 0) {
+                        if (H5Sclose(_chunk_info[i].fspace_id) < 0)
+                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
+                                         "can't close chunk file dataspace");
+                        _chunk_info[i].fspace_id = H5I_INVALID_HID;
+                    } /* end if */
+
+                    /* Intersect points with block using connector routine */
+                    if ((_chunk_info[i].fspace_id =
+                             H5_daos_point_and_block(file_space_id, (hsize_t)fspace_ndims, chunk_dims,
+                                                     start_coords, curr_chunk_dims)) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't intersect point selection");
+
+                    /* Move selection back to have correct offset in chunk */
+                    if (H5Sselect_adjust(_chunk_info[i].fspace_id, chunk_space_adjust) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection");
+
+                    break;
+
+                case H5S_SEL_HYPERSLABS: {
+                    /* Create chunk file dataspace if one isn't cached */
+                    if (_chunk_info[i].fspace_id < 0)
+                        if ((_chunk_info[i].fspace_id = H5Screate_simple(fspace_ndims, chunk_dims, NULL)) < 0)
+                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                         "can't create temporary chunk selection");
+
+                    /* Select all elements within this chunk's file dataspace as
+                     * a hyperslab (accounting for partial edge chunks) */
+                    if (H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET, start_coords, NULL,
+                                            curr_chunk_dims, NULL) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                     "can't set selection in chunk file dataspace");
+
+                    /* Refine chunk file dataspace selection with only elements
+                     * that are also selected in whole file dataspace */
+                    if (H5Smodify_select(_chunk_info[i].fspace_id, H5S_SELECT_AND, file_space_id) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                     "can't refine chunk file dataspace selection");
+
+                    /* Move selection back to have correct offset in chunk */
+                    if (H5Sselect_adjust(_chunk_info[i].fspace_id, chunk_space_adjust) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection");
+
+                    break;
+                } /* case H5S_SEL_HYPERSLABS */
+
+                case H5S_SEL_ALL: {
+                    hsize_t zero_offset_start[H5S_MAX_RANK] = {0};
+
+                    if (_chunk_info[i].fspace_id < 0) {
+                        /* Create chunk dataspace with full chunk dimensions */
+                        if ((_chunk_info[i].fspace_id = H5Screate_simple(fspace_ndims, chunk_dims, NULL)) < 0)
+                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                         "can't create temporary chunk selection");
+
+                        /* Trim selection down to partial edge chunk size if necessary */
+                        if (is_partial_edge_chunk &&
+                            H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET, zero_offset_start,
+                                                NULL, curr_chunk_dims, NULL) < 0)
+                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                         "can't select partial edge chunk from temporary selection");
+                    } /* end if */
+                    else {
+                        /* Reset selection for cached chunk file dataspace to current chunk dimensions */
+                        if (H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET, zero_offset_start,
+                                                NULL, curr_chunk_dims, NULL) < 0)
+                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                         "can't set chunk file dataspace selection");
+                    } /* end else */
+
+                    break;
+                } /* case H5S_SEL_ALL */
+
+                case H5S_SEL_NONE:
+                case H5S_SEL_ERROR:
+                case H5S_SEL_N:
+                default:
+                    D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "invalid dataspace selection type");
+            } /* end switch */
+
+            /* Copy the chunk's coordinates to the selected chunk info buffer */
+            memcpy(_chunk_info[i].chunk_coords, start_coords, (size_t)fspace_ndims * sizeof(hsize_t));
+            _chunk_info[i].sel_regular = FALSE;
+
+            /*
+             * Now set up the memory Dataspace for this chunk.
+             */
+            if (space_same_shape) {
+                if (_chunk_info[i].mspace_id < 0) {
+                    /* Create new memory dataspace */
+                    if ((_chunk_info[i].mspace_id = H5Screate_simple(mspace_ndims, mem_space_dims, NULL)) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL,
+                                     "can't create chunk memory dataspace");
+                } /* end if */
+                else {
+                    htri_t extents_equal;
+
+                    /* Check if the cached chunk's memory dataspace extent is the same
+                     * as the current memory dataspace's extent; resize the cached
+                     * memory dataspace if not.
+                     */
+                    if ((extents_equal = H5Sextent_equal(_chunk_info[i].mspace_id, mem_space_id)) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
+                                     "can't check if memory dataspaces have the same extent");
+
+                    if (!extents_equal && H5Sset_extent_simple(_chunk_info[i].mspace_id, mspace_ndims,
+                                                               mem_space_dims, NULL) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                     "can't adjust chunk memory dataspace dimensions");
+                } /* end else */
+
+                if (H5S_SEL_ALL == file_space_type) {
+                    /* Set selection to same shape as chunk's file dataspace selection */
+                    if (H5Sselect_hyperslab(_chunk_info[i].mspace_id, H5S_SELECT_SET, start_coords, NULL,
+                                            curr_chunk_dims, NULL) < 0)
+                        D_GOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL,
+                                     "can't create chunk memory selection");
+                } /* end if */
+                else {
+                    /* Copy the chunk's file space selection to its memory space selection */
+                    if (H5Sselect_copy(_chunk_info[i].mspace_id, _chunk_info[i].fspace_id) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL,
+                                     "unable to copy selection from temporary chunk's file dataspace to its "
+                                     "memory dataspace");
+
+                    /* Compute the adjustment for the chunk */
+                    for (j = 0; j < (ssize_t)fspace_ndims; j++) {
+                        /* H5_CHECK_OVERFLOW(_chunk_info[i].chunk_coords[j], hsize_t, hssize_t); */
+                        chunk_space_adjust[j] =
+                            chunk_file_space_adjust[j] - (hssize_t)_chunk_info[i].chunk_coords[j];
+                    } /* end for */
+
+                    /* Adjust the selection */
+                    if (H5Sselect_adjust(_chunk_info[i].mspace_id, chunk_space_adjust) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
+                                     "can't adjust temporary chunk's memory space selection");
+                } /* end else */
+            }     /* end if */
+            else {
+                /* Select this chunk in the temporary chunk selection dataspace.
+                 * Shouldn't matter if it goes beyond the extent since we're not
+                 * doing I/O with this space */
+                if (H5Sselect_hyperslab(entire_chunk_sel_space_id, H5S_SELECT_SET, start_coords, NULL,
+                                        chunk_dims, NULL) < 0)
+                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select entire chunk");
+
+                /* Close memory space if cached */
+                if (_chunk_info[i].mspace_id >= 0) {
+                    if (H5Sclose(_chunk_info[i].mspace_id) < 0)
+                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
+                                     "can't close chunk memory dataspace");
+                    _chunk_info[i].mspace_id = H5I_INVALID_HID;
+                } /* end if */
+
+                /* Calculate memory selection for this chunk by projecting
+                 * intersection of full file selection and file chunk to full
+                 * memory selection */
+                if ((_chunk_info[i].mspace_id = H5Sselect_project_intersection(
+                         file_space_id, mem_space_id, entire_chunk_sel_space_id)) < 0)
+                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't project intersection");
+            } /* end else */
+
+            /* Determine if there are more chunks to process */
+            if ((_chunk_info[i].num_elem_sel_file = H5Sget_select_npoints(_chunk_info[i].fspace_id)) < 0)
+                D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
+                             "can't get number of points selected in chunk file space");
+
+            /* Make sure we didn't process too many points */
+            if (_chunk_info[i].num_elem_sel_file > num_sel_points)
+                D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                             "processed more elements than present in selection");
+
+            /* Keep track of the number of elements processed */
+            num_sel_points -= _chunk_info[i].num_elem_sel_file;
+
+            /* Break out if we're done */
+            if (num_sel_points == 0)
+                break;
+
+            /* Clean up after partial edge chunk */
+            if (is_partial_edge_chunk) {
+                memcpy(curr_chunk_dims, chunk_dims, (size_t)fspace_ndims * sizeof(hsize_t));
+                is_partial_edge_chunk = FALSE;
+            } /* end if */
+        }     /* end if */
+
+        /* Set current increment dimension */
+        increment_dim = fspace_ndims - 1;
+
+        /* Increment chunk location in fastest changing dimension */
+        start_coords[increment_dim] += chunk_dims[increment_dim];
+        end_coords[increment_dim] += chunk_dims[increment_dim];
+
+        /* Bring chunk location back into bounds, if necessary */
+        if (start_coords[increment_dim] > file_sel_end[increment_dim]) {
+            do {
+                /* Reset current dimension's location to 0 */
+                start_coords[increment_dim] = selection_start_coords[increment_dim];
+                end_coords[increment_dim]   = (start_coords[increment_dim] + chunk_dims[increment_dim]) - 1;
+
+                /* Decrement current dimension */
+                if (increment_dim == 0)
+                    D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
+                                 "did not find enough elements to process or error traversing chunks");
+                increment_dim--;
+
+                /* Increment chunk location in current dimension */
+                start_coords[increment_dim] += chunk_dims[increment_dim];
+                end_coords[increment_dim] = (start_coords[increment_dim] + chunk_dims[increment_dim]) - 1;
+            } while (start_coords[increment_dim] > file_sel_end[increment_dim]);
+        } /* end if */
+    }     /* end for */
+
+done:
+    if (ret_value < 0 && _chunk_info) {
+        for (j = 0; j <= i; j++) {
+            if ((_chunk_info[j].fspace_id >= 0) && (H5Sclose(_chunk_info[j].fspace_id) < 0))
+                D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
+                             "failed to close chunk file dataspace ID");
+            if ((_chunk_info[j].mspace_id >= 0) && (H5Sclose(_chunk_info[j].mspace_id) < 0))
+                D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
+                             "failed to close chunk memory dataspace ID");
+        }
+
+        DV_free(_chunk_info);
+        if (*chunk_info)
+            *chunk_info = NULL;
+        if (chunk_info_len)
+            *chunk_info_len = 0;
+    }
+    else {
+        *chunk_info = _chunk_info;
+        if (chunk_info_len)
+            *chunk_info_len = chunk_info_nalloc;
+
+        assert(i + 1 >= 0);
+        *nchunks_selected = (size_t)(i + 1);
+    }
+
+    if ((entire_chunk_sel_space_id >= 0) && (H5Sclose(entire_chunk_sel_space_id) < 0))
+        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
+                     "failed to close temporary entire chunk dataspace");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_selected_chunk_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_regular_sel
+ *
+ * Purpose:     Retrieves the parameters of an "all" or regular hyperslab
+ *              selection in space_id, normalized so that dimensions whose
+ *              blocks are contiguous are expressed as a single block.
+ *              Selections with a selection offset are rejected.
+ *
+ * Return:      Success:        TRUE if the selection is regular, FALSE
+ *                              otherwise
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_get_regular_sel(hid_t space_id, int ndims, hsize_t *start, hsize_t *stride, hsize_t *count,
+                        hsize_t *block)
+{
+    H5S_sel_type sel_type;
+    hsize_t      sel_start[H5S_MAX_RANK], sel_end[H5S_MAX_RANK];
+    htri_t       is_regular;
+    int          i;
+    htri_t       ret_value = TRUE;
+
+    if (H5S_SEL_ERROR == (sel_type = H5Sget_select_type(space_id)))
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection type");
+
+    if (sel_type == H5S_SEL_ALL) {
+        if (H5Sget_simple_extent_dims(space_id, block, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+        for (i = 0; i < ndims; i++) {
+            start[i]  = 0;
+            stride[i] = 1;
+            count[i]  = 1;
+        } /* end for */
+    }     /* end if */
+    else if (sel_type == H5S_SEL_HYPERSLABS) {
+        if ((is_regular = H5Sis_regular_hyperslab(space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't check if hyperslab selection is regular");
+        if (!is_regular)
+            D_GOTO_DONE(FALSE);
+        if (H5Sget_regular_hyperslab(space_id, start, stride, count, block) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get regular hyperslab selection");
+
+        /* The bounds include the selection offset, the hyperslab start does
+         * not */
+        if (H5Sget_select_bounds(space_id, sel_start, sel_end) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get selection bounds");
+        for (i = 0; i < ndims; i++)
+            if (sel_start[i] != start[i])
+                D_GOTO_DONE(FALSE);
+
+        /* Normalize contiguous blocks to a single block */
+        for (i = 0; i < ndims; i++)
+            if (count[i] == 1 || stride[i] == block[i]) {
+                block[i] *= count[i];
+                count[i]  = 1;
+                stride[i] = 1;
+            } /* end if */
+    }     /* end if */
+    else
+        D_GOTO_DONE(FALSE);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_regular_sel() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_regular_sel_1d
+ *
+ * Purpose:     Intersects dimension dim of a regular selection with the
+ *              range [lo, hi).  If int_start and int_len are not NULL,
+ *              the intersecting intervals are returned through them and
+ *              their number through *nint; they must have room for
+ *              MIN(count, (hi - lo) / stride + 2) intervals.
+ *
+ * Return:      Number of selected elements in the range (cannot fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static hsize_t
+H5_daos_regular_sel_1d(const H5_daos_regular_sel_t *sel, int dim, hsize_t lo, hsize_t hi, hsize_t *int_start,
+                       hsize_t *int_len, size_t *nint)
+{
+    hsize_t start  = sel->start[dim];
+    hsize_t stride = sel->stride[dim];
+    hsize_t count  = sel->count[dim];
+    hsize_t block  = sel->block[dim];
+    hsize_t kmin, kmax, k;
+    hsize_t ret_value = 0;
+
+    assert(!int_start == !int_len);
+    assert(!int_start || nint);
+
+    if (nint)
+        *nint = 0;
+
+    /* Find the range of blocks that may intersect [lo, hi) */
+    if (hi <= start)
+        return 0;
+    kmin = (lo >= start + block) ? (lo - start - block) / stride + 1 : 0;
+    kmax = MIN(count - 1, (hi - 1 - start) / stride);
+
+    for (k = kmin; k <= kmax && k >= kmin; k++) {
+        hsize_t blk_lo = start + k * stride;
+        hsize_t int_lo = MAX(blk_lo, lo);
+        hsize_t int_hi = MIN(blk_lo + block, hi);
+
+        if (int_hi <= int_lo)
+            continue;
+
+        if (int_start) {
+            int_start[*nint] = int_lo;
+            int_len[*nint]   = int_hi - int_lo;
+            (*nint)++;
+        } /* end if */
+        ret_value += int_hi - int_lo;
+    } /* end for */
+
+    return ret_value;
+} /* end H5_daos_regular_sel_1d() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_get_selected_chunk_info_regular
+ *
+ * Purpose:     Fast path for H5_daos_get_selected_chunk_info for regular
+ *              hyperslab (or "all") file selections with a memory
+ *              selection of the same shape.  The selected chunks and the
+ *              number of elements selected in each are computed
+ *              arithmetically from the hyperslab parameters, which are
+ *              saved in dset->io_cache.regular_sel so the recxs and
+ *              sg_iovs for each chunk can later be generated by
+ *              H5_daos_regular_sel_to_recx_iov.  No per-chunk dataspaces
+ *              are created.  Chunk info is returned through
+ *              dset->io_cache.chunk_info.
+ *
+ * Return:      Success:        TRUE if the fast path was used, FALSE if
+ *                              the selections are not eligible
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_get_selected_chunk_info_regular(H5_daos_dset_t *dset, hid_t file_space_id, hid_t mem_space_id,
+                                        size_t *nchunks_selected)
+{
+    H5_daos_regular_sel_t       *sel        = &dset->io_cache.regular_sel;
+    H5_daos_select_chunk_info_t *chunk_info = dset->io_cache.chunk_info;
+    size_t                       chunk_info_nalloc = dset->io_cache.chunk_info_nalloc;
+    hsize_t                     *chunk_dims        = dset->dcpl_cache.chunk_dims;
+    hsize_t                      mem_stride[H5S_MAX_RANK], mem_count[H5S_MAX_RANK], mem_block[H5S_MAX_RANK];
+    hsize_t                     *dim_chunk_idx = NULL;
+    hsize_t                     *dim_nelem     = NULL;
+    size_t                       dim_off[H5S_MAX_RANK + 1];
+    size_t                       dim_cur[H5S_MAX_RANK];
+    size_t                       nchunks = 0;
+    hsize_t                      first_chunk, last_chunk, c;
+    htri_t                       is_regular;
+    int                          ndims, mem_ndims;
+    int                          i;
+    size_t                       j;
+    htri_t                       ret_value = TRUE;
+
+    assert(dset);
+    assert(nchunks_selected);
+
+    /* Check ranks */
+    if ((ndims = H5Sget_simple_extent_ndims(file_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file space dimensionality");
+    if ((mem_ndims = H5Sget_simple_extent_ndims(mem_space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory space dimensionality");
+    if (ndims == 0 || ndims != mem_ndims)
+        D_GOTO_DONE(FALSE);
+
+    /* Get the file selection */
+    if ((is_regular = H5_daos_get_regular_sel(file_space_id, ndims, sel->start, sel->stride, sel->count,
+                                              sel->block)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection");
+    if (!is_regular)
+        D_GOTO_DONE(FALSE);
+
+    /* Get the memory selection and make sure it has the same shape as the
+     * file selection */
+    if ((is_regular = H5_daos_get_regular_sel(mem_space_id, ndims, sel->mem_start, mem_stride, mem_count,
+                                              mem_block)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory selection");
+    if (!is_regular)
+        D_GOTO_DONE(FALSE);
+    for (i = 0; i < ndims; i++)
+        if (mem_stride[i] != sel->stride[i] || mem_count[i] != sel->count[i] ||
+            mem_block[i] != sel->block[i])
+            D_GOTO_DONE(FALSE);
+    if (H5Sget_simple_extent_dims(mem_space_id, sel->mem_dims, NULL) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory dataspace dimensions");
+    sel->ndims = ndims;
+
+    /* Count the chunks spanned by the selection in each dimension */
+    dim_off[0] = 0;
+    for (i = 0; i < ndims; i++) {
+        first_chunk = sel->start[i] / chunk_dims[i];
+        last_chunk =
+            (sel->start[i] + (sel->count[i] - 1) * sel->stride[i] + sel->block[i] - 1) / chunk_dims[i];
+        dim_off[i + 1] = dim_off[i] + (size_t)(last_chunk - first_chunk + 1);
+    } /* end for */
+
+    if (NULL == (dim_chunk_idx = (hsize_t *)DV_malloc(2 * dim_off[ndims] * sizeof(hsize_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate per-dimension chunk lists");
+    dim_nelem = dim_chunk_idx + dim_off[ndims];
+
+    /* Build the list of chunks in each dimension that intersect the
+     * selection, along with the number of elements selected in each */
+    for (i = 0; i < ndims; i++) {
+        size_t n = dim_off[i];
+
+        first_chunk = sel->start[i] / chunk_dims[i];
+        last_chunk  = first_chunk + (hsize_t)(dim_off[i + 1] - dim_off[i]) - 1;
+        for (c = first_chunk; c <= last_chunk; c++) {
+            hsize_t nelem = H5_daos_regular_sel_1d(sel, i, c * chunk_dims[i], (c + 1) * chunk_dims[i], NULL,
+                                                   NULL, NULL);
+
+            if (nelem) {
+                dim_chunk_idx[n] = c;
+                dim_nelem[n]     = nelem;
+                n++;
+            } /* end if */
+        }     /* end for */
+        assert(n > dim_off[i]);
+
+        /* Mark the end of this dimension's list with a zero element count */
+        if (n < dim_off[i + 1])
+            dim_nelem[n] = 0;
+        dim_cur[i] = dim_off[i];
+    } /* end for */
+
+    /* Iterate over all combinations of intersecting chunks, fastest changing
+     * dimension last */
+    do {
+        /* Advance index and re-allocate selected chunk info buffer if necessary */
+        if (nchunks == chunk_info_nalloc) {
+            size_t new_nalloc = chunk_info_nalloc ? 2 * chunk_info_nalloc : H5_DAOS_DEFAULT_NUM_SEL_CHUNKS;
+            void  *tmp_realloc;
+
+            if (NULL == (tmp_realloc = DV_realloc(chunk_info, new_nalloc * sizeof(*chunk_info))))
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
+                             "can't reallocate space for selected chunk info buffer");
+            chunk_info = (H5_daos_select_chunk_info_t *)tmp_realloc;
+
+            /* Ensure newly-allocated chunk info structures are initialized */
+            memset(&chunk_info[chunk_info_nalloc], 0, (new_nalloc - chunk_info_nalloc) * sizeof(*chunk_info));
+            for (j = chunk_info_nalloc; j < new_nalloc; j++)
+                chunk_info[j].fspace_id = chunk_info[j].mspace_id = H5I_INVALID_HID;
+
+            chunk_info_nalloc = new_nalloc;
+            dset->io_cache.chunk_info        = chunk_info;
+            dset->io_cache.chunk_info_nalloc = chunk_info_nalloc;
+        } /* end if */
+
+        /* Fill in chunk info */
+        chunk_info[nchunks].num_elem_sel_file = 1;
+        for (i = 0; i < ndims; i++) {
+            chunk_info[nchunks].chunk_coords[i] = (uint64_t)(dim_chunk_idx[dim_cur[i]] * chunk_dims[i]);
+            chunk_info[nchunks].num_elem_sel_file *= (hssize_t)dim_nelem[dim_cur[i]];
+        } /* end for */
+        chunk_info[nchunks].sel_regular = TRUE;
+        nchunks++;
+
+        /* Advance to the next chunk */
+        for (i = ndims - 1; i >= 0; i--) {
+            dim_cur[i]++;
+            if (dim_cur[i] < dim_off[i + 1] && dim_nelem[dim_cur[i]] != 0)
+                break;
+            dim_cur[i] = dim_off[i];
+        } /* end for */
+    } while (i >= 0);
+
+    *nchunks_selected = nchunks;
+
+done:
+    DV_free(dim_chunk_idx);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_get_selected_chunk_info_regular() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_regular_sel_to_recx_iov
+ *
+ * Purpose:     Builds the recxs and sg_iovs for the chunk starting at
+ *              chunk_coords from a regular selection set up by
+ *              H5_daos_get_selected_chunk_info_regular.  The file and
+ *              memory sequences are generated together and adjacent
+ *              sequences that are contiguous in both the chunk and the
+ *              memory buffer are merged.  *recxs and *sg_iovs should
+ *              point to (probably statically allocated) single elements.
+ *              Does not release buffers on error.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_regular_sel_to_recx_iov(const H5_daos_regular_sel_t *sel, const uint64_t *chunk_coords,
+                                const hsize_t *chunk_dims, size_t type_size, void *buf, daos_recx_t **recxs,
+                                daos_iov_t **sg_iovs, size_t *list_nused)
+{
+    hsize_t *int_buf = NULL;
+    hsize_t *int_start[H5S_MAX_RANK];
+    hsize_t *int_len[H5S_MAX_RANK];
+    size_t   nint[H5S_MAX_RANK];
+    size_t   cur_int[H5S_MAX_RANK];
+    hsize_t  cur_off[H5S_MAX_RANK];
+    hsize_t  file_dim_stride[H5S_MAX_RANK];
+    hsize_t  mem_dim_stride[H5S_MAX_RANK];
+    hsize_t  nelem[H5S_MAX_RANK];
+    hsize_t  chunk_end;
+    hsize_t  mem_end  = 0;
+    size_t   int_nalloc[H5S_MAX_RANK];
+    size_t   tot_nalloc = 0;
+    size_t   max_nseq   = 1;
+    int      ndims      = sel->ndims;
+    int      last       = ndims - 1;
+    int      i;
+    size_t   j;
+    herr_t   ret_value = SUCCEED;
+
+    assert(sel);
+    assert(ndims > 0);
+    assert(recxs && *recxs);
+    assert(sg_iovs && *sg_iovs);
+    assert(list_nused);
+
+    *list_nused = 0;
+
+    /* Allocate space for the selected intervals in each dimension */
+    for (i = 0; i < ndims; i++) {
+        int_nalloc[i] = (size_t)MIN(sel->count[i], chunk_dims[i] / sel->stride[i] + 2);
+        tot_nalloc += int_nalloc[i];
+    } /* end for */
+    if (NULL == (int_buf = (hsize_t *)DV_malloc(2 * tot_nalloc * sizeof(hsize_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate selected interval lists");
+
+    /* Intersect the selection with the chunk in each dimension */
+    tot_nalloc = 0;
+    for (i = 0; i < ndims; i++) {
+        int_start[i] = int_buf + 2 * tot_nalloc;
+        int_len[i]   = int_start[i] + int_nalloc[i];
+        tot_nalloc += int_nalloc[i];
+
+        chunk_end = (hsize_t)chunk_coords[i] + chunk_dims[i];
+        nelem[i]  = H5_daos_regular_sel_1d(sel, i, (hsize_t)chunk_coords[i], chunk_end, int_start[i],
+                                           int_len[i], &nint[i]);
+        assert(nint[i] <= int_nalloc[i]);
+        if (nint[i] == 0)
+            D_GOTO_DONE(SUCCEED);
+
+        cur_int[i] = 0;
+        cur_off[i] = 0;
+    } /* end for */
+
+    /* Compute linear strides of each dimension in the chunk and in memory */
+    file_dim_stride[last] = 1;
+    mem_dim_stride[last]  = 1;
+    for (i = last - 1; i >= 0; i--) {
+        file_dim_stride[i] = file_dim_stride[i + 1] * chunk_dims[i + 1];
+        mem_dim_stride[i]  = mem_dim_stride[i + 1] * sel->mem_dims[i + 1];
+    } /* end for */
+
+    /* Make room for the (unmerged) sequences: one per interval in the
+     * fastest changing dimension for each selected row */
+    for (i = 0; i < last; i++)
+        max_nseq *= (size_t)nelem[i];
+    max_nseq *= nint[last];
+    if (max_nseq > 1) {
+        if (NULL == (*recxs = (daos_recx_t *)DV_malloc(max_nseq * sizeof(daos_recx_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for records");
+        if (NULL == (*sg_iovs = (daos_iov_t *)DV_malloc(max_nseq * sizeof(daos_iov_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate memory for sgl iovs");
+    } /* end if */
+
+    /* Iterate over selected rows */
+    do {
+        hsize_t file_base = 0;
+        hsize_t mem_base  = 0;
+        hsize_t coord;
+
+        for (i = 0; i < last; i++) {
+            coord = int_start[i][cur_int[i]] + cur_off[i];
+            file_base += (coord - (hsize_t)chunk_coords[i]) * file_dim_stride[i];
+            mem_base += (coord - sel->start[i] + sel->mem_start[i]) * mem_dim_stride[i];
+        } /* end for */
+
+        /* Add a sequence for each interval in the fastest changing dimension */
+        for (j = 0; j < nint[last]; j++) {
+            hsize_t file_idx = file_base + (int_start[last][j] - (hsize_t)chunk_coords[last]);
+            hsize_t mem_off  = mem_base + (int_start[last][j] - sel->start[last] + sel->mem_start[last]);
+            hsize_t len      = int_len[last][j];
+
+            if (*list_nused > 0 &&
+                (*recxs)[*list_nused - 1].rx_idx + (*recxs)[*list_nused - 1].rx_nr == (uint64_t)file_idx &&
+                mem_end == mem_off) {
+                /* Contiguous with the previous sequence in both the chunk and
+                 * memory, merge them */
+                (*recxs)[*list_nused - 1].rx_nr += (uint64_t)len;
+                (*sg_iovs)[*list_nused - 1].iov_len += (daos_size_t)len * (daos_size_t)type_size;
+                (*sg_iovs)[*list_nused - 1].iov_buf_len = (*sg_iovs)[*list_nused - 1].iov_len;
+            } /* end if */
+            else {
+                assert(*list_nused < max_nseq);
+                (*recxs)[*list_nused].rx_idx = (uint64_t)file_idx;
+                (*recxs)[*list_nused].rx_nr  = (uint64_t)len;
+                daos_iov_set(&(*sg_iovs)[*list_nused], (uint8_t *)buf + (mem_off * type_size),
+                             (daos_size_t)len * (daos_size_t)type_size);
+                (*list_nused)++;
+            } /* end else */
+            mem_end = mem_off + len;
+        } /* end for */
+
+        /* Advance to the next row */
+        for (i = last - 1; i >= 0; i--) {
+            if (++cur_off[i] < int_len[i][cur_int[i]])
+                break;
+            cur_off[i] = 0;
+            if (++cur_int[i] < nint[i])
+                break;
+            cur_int[i] = 0;
+        } /* end for */
+    } while (i >= 0);
+
+done:
+    DV_free(int_buf);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_regular_sel_to_recx_iov() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_hash
+ *
+ * Purpose:     Hash function for a dataset's chunk cache table.  The key
+ *              is an array of H5S_MAX_RANK chunk coordinates, with unused
+ *              dimensions set to 0.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_chunk_cache_hash(dv_hash_table_key_t key)
+{
+    const uint64_t *coords = (const uint64_t *)key;
+    uint64_t        hash   = UINT64_C(14695981039346656037);
+    int             i;
+
+    for (i = 0; i < H5S_MAX_RANK; i++)
+        hash = (hash ^ coords[i]) * UINT64_C(1099511628211);
+
+    return hash;
+} /* end H5_daos_chunk_cache_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_equal
+ *
+ * Purpose:     Key comparison function for a dataset's chunk cache table.
+ *
+ * Return:      Non-zero if the keys are equal, zero otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2)
+{
+    return !memcmp(key1, key2, H5S_MAX_RANK * sizeof(uint64_t));
+} /* end H5_daos_chunk_cache_equal() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_peers_add
+ *
+ * Purpose:     Adds a dataset handle to the list of handles that are
+ *              kept coherent with the other handles of the same dataset
+ *              in this process.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_dset_peers_add(H5_daos_dset_t *dset)
+{
+    assert(dset);
+
+    if (dset->peer_listed)
+        return;
+
+    dset->peer_next      = H5_daos_dset_peers_g;
+    H5_daos_dset_peers_g = dset;
+    dset->peer_listed    = TRUE;
+} /* end H5_daos_dset_peers_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_peers_remove
+ *
+ * Purpose:     Removes a closing dataset handle from the list of handles
+ *              that are kept coherent with each other.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_dset_peers_remove(H5_daos_dset_t *dset)
+{
+    H5_daos_dset_t **prev;
+
+    assert(dset);
+
+    if (!dset->peer_listed)
+        return;
+
+    for (prev = &H5_daos_dset_peers_g; *prev != dset; prev = &(*prev)->peer_next)
+        assert(*prev);
+    *prev             = dset->peer_next;
+    dset->peer_next   = NULL;
+    dset->peer_listed = FALSE;
+} /* end H5_daos_dset_peers_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dset_is_peer
+ *
+ * Purpose:     Checks whether another dataset handle may refer to the
+ *              same dataset as dset, either through the same file handle
+ *              or through another file handle for the same container.  A
+ *              file whose container is not known yet matches every other
+ *              file.
+ *
+ * Return:      TRUE if the handles may share the dataset, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_dset_is_peer(const H5_daos_dset_t *dset, const H5_daos_dset_t *other)
+{
+    const H5_daos_file_t *file       = dset->obj.item.file;
+    const H5_daos_file_t *other_file = other->obj.item.file;
+
+    if (other == dset || other->obj.oid.lo != dset->obj.oid.lo || other->obj.oid.hi != dset->obj.oid.hi)
+        return FALSE;
+
+    return other_file == file || !file->cont[0] || !other_file->cont[0] ||
+           !strcmp(file->cont, other_file->cont);
+} /* end H5_daos_dset_is_peer() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_init
+ *
+ * Purpose:     Sets up a dataset's chunk cache according to the size
+ *              requested with H5daos_set_chunk_cache() on its DAPL.  The
+ *              cache holds chunks in the file datatype, so it is only
+ *              used for chunked datasets without filters, and only if
+ *              unwritten elements are filled in (otherwise reads would
+ *              overwrite them in the user's buffer).  It is also only
+ *              used if the file is open on a single process, since other
+ *              processes' writes would not be seen in cached chunks.
+ *              Other handles of the dataset in this process are handled
+ *              by H5_daos_chunk_cache_sync().  If the cache can't hold a
+ *              single chunk it is left disabled.  If readahead is
+ *              requested the cache is made large enough to hold the
+ *              readahead window and the chunk being read.  If only
+ *              write combining is requested the cache is sized for the
+ *              write combining limit.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_init(H5_daos_dset_t *dset)
+{
+    htri_t   prop_exists;
+    size_t   nbytes_max = 0;
+    size_t   wc_nbytes  = 0;
+    unsigned ra_nchunks = 0;
+    int      ndims;
+    int      i;
+    herr_t   ret_value = SUCCEED;
+
+    assert(dset);
+    assert(!dset->chunk_cache.table);
+
+    if (dset->dcpl_cache.layout != H5D_CHUNKED || dset->obj.item.file->num_procs > 1)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Every chunked dataset handle that does I/O must be visible to the
+     * other handles of the dataset, even if it has no cache itself, so
+     * their caches are not used while it may access the same chunks */
+    H5_daos_dset_peers_add(dset);
+
+    if (dset->dcpl_cache.nfilters > 0 || dset->dcpl_cache.fill_method == H5_DAOS_NO_FILL)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Get the requested cache size */
+    if ((prop_exists = H5Pexist(dset->dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for chunk cache size property");
+    if (prop_exists && H5Pget(dset->dapl_id, H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME, &nbytes_max) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk cache size property");
+
+    /* Get the requested readahead */
+    if ((prop_exists = H5Pexist(dset->dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for chunk readahead property");
+    if (prop_exists && H5Pget(dset->dapl_id, H5_DAOS_CHUNK_READAHEAD_PROP_NAME, &ra_nchunks) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get chunk readahead property");
+
+    /* Get the requested write combining limit */
+    if ((prop_exists = H5Pexist(dset->dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't check for write combining size property");
+    if (prop_exists && H5Pget(dset->dapl_id, H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME, &wc_nbytes) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get write combining size property");
+
+    if (nbytes_max == 0 && ra_nchunks == 0 && wc_nbytes == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Calculate chunk size */
+    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    dset->chunk_cache.ndims       = ndims;
+    dset->chunk_cache.chunk_nelem = 1;
+    for (i = 0; i < ndims; i++)
+        dset->chunk_cache.chunk_nelem *= (uint64_t)dset->dcpl_cache.chunk_dims[i];
+    dset->chunk_cache.chunk_size = (size_t)dset->chunk_cache.chunk_nelem * dset->file_type_size;
+
+    /* Size the cache for write combining if no size was requested */
+    if (nbytes_max == 0)
+        nbytes_max = MAX(wc_nbytes, dset->chunk_cache.chunk_size);
+
+    /* Make room for the readahead window */
+    if (ra_nchunks > 0 && nbytes_max < ((size_t)ra_nchunks + 1) * dset->chunk_cache.chunk_size)
+        nbytes_max = ((size_t)ra_nchunks + 1) * dset->chunk_cache.chunk_size;
+
+    if (nbytes_max < dset->chunk_cache.chunk_size)
+        D_GOTO_DONE(SUCCEED);
+
+    if (NULL ==
+        (dset->chunk_cache.table = dv_hash_table_new(H5_daos_chunk_cache_hash, H5_daos_chunk_cache_equal)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk cache table");
+    dset->chunk_cache.nbytes_max = nbytes_max;
+    dset->chunk_cache.ra_nchunks = ra_nchunks;
+    dset->chunk_cache.wc_nbytes  = wc_nbytes;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_free
+ *
+ * Purpose:     Frees a dataset's chunk cache.  Any dirty chunks should
+ *              have been written back already.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_cache_free(H5_daos_dset_t *dset)
+{
+    H5_daos_chunk_cache_ent_t *ent;
+    H5_daos_chunk_cache_ent_t *next;
+
+    assert(dset);
+    assert(!dset->chunk_cache.wb_head);
+
+    for (ent = dset->chunk_cache.lru_head; ent; ent = next) {
+        next = ent->next;
+        assert(!ent->waiters_head);
+        DV_free(ent->buf);
+        DV_free(ent->dirty);
+        DV_free(ent);
+    } /* end for */
+    dset->chunk_cache.lru_head = dset->chunk_cache.lru_tail = NULL;
+    dset->chunk_cache.nbytes                                = 0;
+
+    if (dset->chunk_cache.table) {
+        dv_hash_table_free(dset->chunk_cache.table);
+        dset->chunk_cache.table = NULL;
+    } /* end if */
+} /* end H5_daos_chunk_cache_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_is_dirty
+ *
+ * Purpose:     Checks if a dataset's chunk cache holds any chunks that
+ *              have not been written back.
+ *
+ * Return:      TRUE if dirty, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_chunk_cache_is_dirty(H5_daos_dset_t *dset)
+{
+    H5_daos_chunk_cache_ent_t *ent;
+
+    for (ent = dset->chunk_cache.lru_head; ent; ent = ent->next)
+        if (ent->ndirty > 0 || ent->fetching)
+            return TRUE;
+
+    return FALSE;
+} /* end H5_daos_chunk_cache_is_dirty() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_start_io
+ *
+ * Purpose:     Creates and schedules a task to fetch the nrecxs extents
+ *              in recxs of a chunk into buf (if ent is not NULL, which
+ *              must be the entry being fetched), or to write them from
+ *              buf (otherwise).  If packed is TRUE the extents' data is
+ *              contiguous in buf, otherwise buf is a whole chunk and each
+ *              extent's data is at its offset in the chunk.  The I/O
+ *              depends on the last in-flight write-back of the same
+ *              chunk, if any.  For
+ *              write-backs, op waits on the I/O, and free_buf is freed
+ *              and a write-back record is kept until it completes.
+ *              free_buf is not freed on failure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_start_io(H5_daos_dset_t *dset, const uint64_t *chunk_coords, daos_opc_t daos_op,
+                             uint8_t *buf, const daos_recx_t *recxs, size_t nrecxs, hbool_t packed,
+                             H5_daos_chunk_cache_ent_t *ent, void *free_buf, H5_daos_chunk_cache_op_t *op)
+{
+    H5_daos_chunk_io_ud_t    *chunk_io_ud = NULL;
+    H5_daos_chunk_cache_wb_t *wb          = NULL;
+    H5_daos_chunk_cache_wb_t *prev_wb;
+    tse_task_t               *io_task;
+    daos_size_t               nbytes = 0;
+    uint8_t                  *p;
+    size_t                    j;
+    int                       i;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(dset);
+    assert(chunk_coords);
+    assert(buf);
+    assert(recxs);
+    assert(nrecxs > 0);
+    assert(op);
+    assert(!ent == (daos_op == DAOS_OPC_OBJ_UPDATE));
+
+    /* Allocate argument struct */
+    if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for I/O callback arguments");
+    chunk_io_ud->recxs   = &chunk_io_ud->recx;
+    chunk_io_ud->sg_iovs = &chunk_io_ud->sg_iov;
+    chunk_io_ud->dset    = dset;
+    chunk_io_ud->req     = op->req;
+
+    /* Encode dkey (chunk coordinates) */
+    p    = chunk_io_ud->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for (i = 0; i < dset->chunk_cache.ndims; i++)
+        UINT64ENCODE(p, chunk_coords[i]);
+    daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+                 (daos_size_t)(1 + ((size_t)dset->chunk_cache.ndims * sizeof(chunk_coords[0]))));
+
+    /* Set up iod and sgl */
+    chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&chunk_io_ud->iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+                 (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+    chunk_io_ud->iod.iod_size = (daos_size_t)dset->file_type_size;
+    chunk_io_ud->iod.iod_type = DAOS_IOD_ARRAY;
+    if (nrecxs > 1) {
+        if (NULL == (chunk_io_ud->recxs = (daos_recx_t *)DV_malloc(nrecxs * sizeof(daos_recx_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                         "can't allocate record extent array for cached chunk I/O");
+        if (!packed &&
+            NULL == (chunk_io_ud->sg_iovs = (daos_iov_t *)DV_malloc(nrecxs * sizeof(daos_iov_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                         "can't allocate I/O vector array for cached chunk I/O");
+    } /* end if */
+    (void)memcpy(chunk_io_ud->recxs, recxs, nrecxs * sizeof(daos_recx_t));
+    chunk_io_ud->iod.iod_nr    = (uint32_t)nrecxs;
+    chunk_io_ud->iod.iod_recxs = chunk_io_ud->recxs;
+    if (packed) {
+        for (j = 0; j < nrecxs; j++)
+            nbytes += recxs[j].rx_nr * (daos_size_t)dset->file_type_size;
+        daos_iov_set(&chunk_io_ud->sg_iovs[0], buf, nbytes);
+        chunk_io_ud->sgl.sg_nr = 1;
+    } /* end if */
+    else {
+        for (j = 0; j < nrecxs; j++)
+            daos_iov_set(&chunk_io_ud->sg_iovs[j], buf + ((size_t)recxs[j].rx_idx * dset->file_type_size),
+                         recxs[j].rx_nr * (daos_size_t)dset->file_type_size);
+        chunk_io_ud->sgl.sg_nr = (uint32_t)nrecxs;
+    } /* end else */
+    chunk_io_ud->sgl.sg_nr_out = 0;
+    chunk_io_ud->sgl.sg_iovs   = chunk_io_ud->sg_iovs;
+
+    /* Fetches into the cache start from the fill value */
+    chunk_io_ud->skip_unallocated = (ent != NULL);
+
+    /* Find the last in-flight write-back of this chunk */
+    for (prev_wb = dset->chunk_cache.wb_head; prev_wb; prev_wb = prev_wb->next)
+        if (!memcmp(prev_wb->chunk_coords, chunk_coords, H5S_MAX_RANK * sizeof(uint64_t)))
+            break;
+
+    if (H5_daos_create_daos_task(daos_op, prev_wb ? 1 : 0, prev_wb ? &prev_wb->task : NULL,
+                                 H5_daos_chunk_io_prep_cb, H5_daos_chunk_io_comp_cb, chunk_io_ud,
+                                 &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to %s cached chunk",
+                     ent ? "fetch" : "write back");
+
+    if (ent)
+        chunk_io_ud->cache.ent = ent;
+    else {
+        /* Keep a record of the write-back until it completes */
+        if (NULL == (wb = (H5_daos_chunk_cache_wb_t *)DV_calloc(sizeof(H5_daos_chunk_cache_wb_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk write-back record");
+        memcpy(wb->chunk_coords, chunk_coords, H5S_MAX_RANK * sizeof(uint64_t));
+        wb->task = io_task;
+        wb->next = dset->chunk_cache.wb_head;
+        if (wb->next)
+            wb->next->prev = wb;
+        dset->chunk_cache.wb_head = wb;
+
+        chunk_io_ud->cache.wb  = wb;
+        chunk_io_ud->cache.buf = free_buf;
+        chunk_io_ud->cache.op  = op;
+        op->nwait++;
+    } /* end else */
+
+    /* Schedule I/O task and give it a reference to req and dset */
+    if (0 != (ret = tse_task_schedule(io_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule chunk cache I/O task: %s",
+                     H5_daos_err_to_string(ret));
+    chunk_io_ud->req->rc++;
+    chunk_io_ud->dset->obj.item.rc++;
+    chunk_io_ud = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (ret_value < 0 && chunk_io_ud) {
+        if (wb) {
+            if (wb->next)
+                wb->next->prev = NULL;
+            dset->chunk_cache.wb_head = wb->next;
+            DV_free(wb);
+            op->nwait--;
+        } /* end if */
+        if (chunk_io_ud->recxs != &chunk_io_ud->recx)
+            DV_free(chunk_io_ud->recxs);
+        if (chunk_io_ud->sg_iovs != &chunk_io_ud->sg_iov)
+            DV_free(chunk_io_ud->sg_iovs);
+        DV_free(chunk_io_ud);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_start_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_write_back
+ *
+ * Purpose:     Writes back the dirty extents of a cached chunk, if any,
+ *              in a single update, and marks it clean.  Elements outside
+ *              the dirty extents are never written, so writes made to
+ *              them through other handles are not overwritten.  If evict
+ *              is TRUE the write is done straight from the entry's
+ *              buffer, which is handed over to the write-back; otherwise
+ *              the dirty extents are copied first so the entry can keep
+ *              being used.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_write_back(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent, hbool_t evict,
+                               H5_daos_chunk_cache_op_t *op)
+{
+    uint8_t *wb_buf = NULL;
+    uint8_t *p;
+    size_t   nbytes    = 0;
+    size_t   type_size = dset->file_type_size;
+    size_t   i;
+    herr_t   ret_value = SUCCEED;
+
+    assert(ent);
+    assert(!ent->fetching);
+
+    if (ent->ndirty == 0)
+        D_GOTO_DONE(SUCCEED);
+    for (i = 0; i < ent->ndirty; i++)
+        nbytes += (size_t)ent->dirty[i].rx_nr * type_size;
+
+    if (evict) {
+        wb_buf   = ent->buf;
+        ent->buf = NULL;
+    } /* end if */
+    else {
+        if (NULL == (wb_buf = (uint8_t *)DV_malloc(nbytes)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk write-back buffer");
+        for (i = 0, p = wb_buf; i < ent->ndirty; i++) {
+            (void)memcpy(p, ent->buf + ((size_t)ent->dirty[i].rx_idx * type_size),
+                         (size_t)ent->dirty[i].rx_nr * type_size);
+            p += (size_t)ent->dirty[i].rx_nr * type_size;
+        } /* end for */
+    } /* end else */
+
+    if (H5_daos_chunk_cache_start_io(dset, ent->chunk_coords, DAOS_OPC_OBJ_UPDATE, wb_buf, ent->dirty,
+                                     ent->ndirty, !evict, NULL, wb_buf, op) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write back cached chunk");
+    wb_buf = NULL;
+
+    dset->chunk_cache.ndirty_bytes -= nbytes;
+    ent->ndirty = 0;
+
+done:
+    /* Cleanup on failure */
+    if (wb_buf) {
+        if (evict)
+            ent->buf = wb_buf;
+        else
+            DV_free(wb_buf);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_write_back() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_remove
+ *
+ * Purpose:     Removes an entry from a dataset's chunk cache and frees
+ *              it.  The entry must not be dirty or being fetched.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_remove(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(ent);
+    assert(!ent->waiters_head);
+
+    if (!dv_hash_table_remove(dset->chunk_cache.table, ent->chunk_coords))
+        D_DONE_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "can't remove chunk from chunk cache table");
+
+    /* Unlink from LRU list */
+    if (ent->prev)
+        ent->prev->next = ent->next;
+    else
+        dset->chunk_cache.lru_head = ent->next;
+    if (ent->next)
+        ent->next->prev = ent->prev;
+    else
+        dset->chunk_cache.lru_tail = ent->prev;
+    dset->chunk_cache.nbytes -= dset->chunk_cache.chunk_size;
+
+    DV_free(ent->buf);
+    DV_free(ent->dirty);
+    DV_free(ent);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_remove() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_mark_dirty
+ *
+ * Purpose:     Adds the nelem elements starting at element idx of a
+ *              cached chunk to its dirty extents, merging them with any
+ *              extents they overlap or adjoin.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_mark_dirty(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent, uint64_t idx,
+                               uint64_t nelem)
+{
+    daos_recx_t *tmp_realloc;
+    uint64_t     lo = idx;
+    uint64_t     hi = idx + nelem;
+    size_t       first_ext;
+    size_t       last_ext;
+    size_t       mid;
+    herr_t       ret_value = SUCCEED;
+
+    assert(dset);
+    assert(ent);
+    assert(nelem > 0);
+
+    /* Find the first extent that ends at or after lo */
+    first_ext = 0;
+    last_ext  = ent->ndirty;
+    while (first_ext < last_ext) {
+        mid = first_ext + ((last_ext - first_ext) / 2);
+        if (ent->dirty[mid].rx_idx + ent->dirty[mid].rx_nr < lo)
+            first_ext = mid + 1;
+        else
+            last_ext = mid;
+    } /* end while */
+
+    /* Absorb all extents that start at or before hi */
+    for (last_ext = first_ext; last_ext < ent->ndirty && ent->dirty[last_ext].rx_idx <= hi; last_ext++) {
+        lo = MIN(lo, ent->dirty[last_ext].rx_idx);
+        hi = MAX(hi, ent->dirty[last_ext].rx_idx + ent->dirty[last_ext].rx_nr);
+        dset->chunk_cache.ndirty_bytes -= (size_t)ent->dirty[last_ext].rx_nr * dset->file_type_size;
+    } /* end for */
+
+    if (last_ext == first_ext) {
+        /* No extent absorbed, insert a new one */
+        if (ent->ndirty == ent->dirty_nalloc) {
+            size_t new_nalloc = ent->dirty_nalloc ? 2 * ent->dirty_nalloc : 4;
+
+            if (NULL ==
+                (tmp_realloc = (daos_recx_t *)DV_realloc(ent->dirty, new_nalloc * sizeof(daos_recx_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate dirty extent array");
+            ent->dirty        = tmp_realloc;
+            ent->dirty_nalloc = new_nalloc;
+        } /* end if */
+        (void)memmove(&ent->dirty[first_ext + 1], &ent->dirty[first_ext],
+                      (ent->ndirty - first_ext) * sizeof(daos_recx_t));
+        ent->ndirty++;
+    } /* end if */
+    else if (last_ext > first_ext + 1) {
+        /* Several extents absorbed, keep the first one */
+        (void)memmove(&ent->dirty[first_ext + 1], &ent->dirty[last_ext],
+                      (ent->ndirty - last_ext) * sizeof(daos_recx_t));
+        ent->ndirty -= last_ext - first_ext - 1;
+    } /* end if */
+
+    ent->dirty[first_ext].rx_idx = lo;
+    ent->dirty[first_ext].rx_nr  = hi - lo;
+    dset->chunk_cache.ndirty_bytes += (size_t)(hi - lo) * dset->file_type_size;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_mark_dirty() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_apply
+ *
+ * Purpose:     Copies the selection for a chunk cache I/O operation
+ *              between the cached chunk and the memory buffer, adding the
+ *              written extents to the dirty extents for writes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_apply(H5_daos_chunk_cache_op_t *op, H5_daos_chunk_cache_ent_t *ent)
+{
+    H5_daos_dset_t *dset;
+    unsigned        i;
+    herr_t          ret_value = SUCCEED;
+
+    assert(op);
+    assert(ent);
+    assert(!ent->fetching);
+
+    dset = op->dset;
+
+    H5_daos_chunk_filter_copy(ent->buf, dset->file_type_size, op->sel.recxs, op->sel.iod.iod_nr,
+                              op->sel.sg_iovs, op->sel.sgl.sg_nr, op->io_type);
+
+    if (op->io_type == IO_WRITE) {
+        for (i = 0; i < op->sel.iod.iod_nr; i++)
+            if (H5_daos_chunk_cache_mark_dirty(dset, ent, op->sel.recxs[i].rx_idx,
+                                               op->sel.recxs[i].rx_nr) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't mark cached chunk dirty");
+
+        /* A partial chunk that has been written entirely is complete */
+        if (ent->partial && ent->ndirty == 1 && ent->dirty[0].rx_idx == 0 &&
+            ent->dirty[0].rx_nr == dset->chunk_cache.chunk_nelem)
+            ent->partial = FALSE;
+    } /* end if */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_apply() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_op_release
+ *
+ * Purpose:     Releases one of the things a chunk cache operation is
+ *              waiting on, recording ret as the operation's result if it
+ *              is an error.  When nothing is left the operation's task is
+ *              completed and the operation is freed.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_op_release(H5_daos_chunk_cache_op_t *op, int ret)
+{
+    tse_task_t *task;
+    int         ret_value = 0;
+
+    assert(op);
+    assert(op->nwait > 0);
+
+    if (ret < 0 && op->status == 0)
+        op->status = ret;
+    if (--op->nwait > 0)
+        D_GOTO_DONE(0);
+
+    task      = op->task;
+    ret_value = op->status;
+
+    /* Close dataset */
+    if (H5_daos_dataset_close_real(op->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
+
+    /* Handle errors */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && op->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        op->req->status      = ret_value;
+        op->req->failed_task = op->flush ? "chunk cache flush" : "chunk cache I/O";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(op->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    if (op->sel.recxs != &op->sel.recx)
+        DV_free(op->sel.recxs);
+    if (op->sel.sg_iovs != &op->sel.sg_iov)
+        DV_free(op->sel.sg_iovs);
+    DV_free(op);
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete the operation's task */
+    tse_task_complete(task, ret_value);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_op_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_fetch_done
+ *
+ * Purpose:     Called when the fetch of a cached chunk completes with
+ *              result.  Applies the operations queued on the entry, in
+ *              order, and releases them.  If the fetch failed, the
+ *              queued operations fail and the entry is removed.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_cache_fetch_done(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent, int result)
+{
+    H5_daos_chunk_cache_op_t *op;
+    int                       op_ret;
+
+    assert(ent);
+    assert(ent->fetching);
+
+    ent->fetching = FALSE;
+
+    while (NULL != (op = ent->waiters_head)) {
+        ent->waiters_head = op->next;
+        op->next          = NULL;
+
+        op_ret = result;
+        if (result == 0 && op->req->status >= -H5_DAOS_INCOMPLETE &&
+            H5_daos_chunk_cache_apply(op, ent) < 0)
+            op_ret = -H5_DAOS_SETUP_ERROR;
+        (void)H5_daos_chunk_cache_op_release(op, op_ret);
+    } /* end while */
+    ent->waiters_tail = NULL;
+
+    if (result != 0)
+        (void)H5_daos_chunk_cache_remove(dset, ent);
+} /* end H5_daos_chunk_cache_fetch_done() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_insert
+ *
+ * Purpose:     Adds an entry for the chunk op operates on to the front of
+ *              the dataset's chunk cache, first evicting least recently
+ *              used chunks (writing them back if dirty) until there is
+ *              room for it.  Chunks being fetched can't be evicted, so
+ *              the cache may briefly grow past its limit.  The new
+ *              entry's buffer is not initialized.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_insert(H5_daos_dset_t *dset, H5_daos_chunk_cache_op_t *op,
+                           H5_daos_chunk_cache_ent_t **ent)
+{
+    H5_daos_chunk_cache_ent_t *evict_ent;
+    H5_daos_chunk_cache_ent_t *next_ent;
+    H5_daos_chunk_cache_ent_t *new_ent   = NULL;
+    herr_t                     ret_value = SUCCEED;
+
+    assert(dset);
+    assert(op);
+    assert(ent);
+
+    /* Make room for the chunk */
+    for (evict_ent = dset->chunk_cache.lru_tail;
+         evict_ent &&
+         (dset->chunk_cache.nbytes + dset->chunk_cache.chunk_size > dset->chunk_cache.nbytes_max);
+         evict_ent = next_ent) {
+        next_ent = evict_ent->prev;
+        if (evict_ent->fetching)
+            continue;
+        if (H5_daos_chunk_cache_write_back(dset, evict_ent, TRUE, op) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write back cached chunk");
+        if (H5_daos_chunk_cache_remove(dset, evict_ent) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "can't evict cached chunk");
+    } /* end for */
+
+    /* Allocate the new entry */
+    if (NULL == (new_ent = (H5_daos_chunk_cache_ent_t *)DV_calloc(sizeof(H5_daos_chunk_cache_ent_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk cache entry");
+    memcpy(new_ent->chunk_coords, op->chunk_coords, sizeof(new_ent->chunk_coords));
+    if (NULL == (new_ent->buf = (uint8_t *)DV_malloc(dset->chunk_cache.chunk_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk cache buffer");
+
+    /* Add it to the table and the front of the LRU list */
+    if (!dv_hash_table_insert(dset->chunk_cache.table, new_ent->chunk_coords, new_ent))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't insert chunk into chunk cache table");
+    new_ent->next = dset->chunk_cache.lru_head;
+    if (new_ent->next)
+        new_ent->next->prev = new_ent;
+    else
+        dset->chunk_cache.lru_tail = new_ent;
+    dset->chunk_cache.lru_head = new_ent;
+    dset->chunk_cache.nbytes += dset->chunk_cache.chunk_size;
+
+    *ent    = new_ent;
+    new_ent = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (new_ent) {
+        DV_free(new_ent->buf);
+        DV_free(new_ent);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_fetch
+ *
+ * Purpose:     Initializes a cached chunk with the fill value and starts
+ *              fetching it.  The entry must not be dirty.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_fetch(H5_daos_dset_t *dset, H5_daos_chunk_cache_ent_t *ent, H5_daos_chunk_cache_op_t *op)
+{
+    daos_recx_t recx;
+    herr_t      ret_value = SUCCEED;
+
+    assert(dset);
+    assert(ent);
+    assert(!ent->fetching);
+    assert(ent->ndirty == 0);
+
+    if (dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL)
+        (void)memset(ent->buf, 0, dset->chunk_cache.chunk_size);
+    else {
+        assert(dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL);
+        assert(dset->fill_val);
+        H5_daos_fill_pattern(ent->buf, dset->chunk_cache.chunk_size, dset->fill_val, dset->file_type_size);
+    } /* end else */
+
+    recx.rx_idx = 0;
+    recx.rx_nr  = dset->chunk_cache.chunk_nelem;
+    if (H5_daos_chunk_cache_start_io(dset, ent->chunk_coords, DAOS_OPC_OBJ_FETCH, ent->buf, &recx, 1, TRUE,
+                                     ent, NULL, op) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't fetch chunk");
+    ent->fetching = TRUE;
+    ent->partial  = FALSE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_fetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_op_task
+ *
+ * Purpose:     Asynchronous task to perform a chunk cache operation.  For
+ *              I/O on a chunk, applies the operation to the cached chunk
+ *              if it is present.  Otherwise it evicts the least recently
+ *              used chunks (writing them back if dirty) to make room,
+ *              starts fetching the chunk and queues the operation on the
+ *              new entry, except that a write is buffered in a partial
+ *              entry without fetching the chunk.  Later writes to a
+ *              partial chunk add to its dirty extents, which stay
+ *              separate unless they overlap or adjoin, so no unwritten
+ *              elements are ever written back.  Operations other than
+ *              writes fetch a partial chunk after writing back its dirty
+ *              extents.  Once the buffered data reaches the write
+ *              combining limit, all dirty chunks are written back.  A
+ *              prefetch only starts fetching the chunk if it is not
+ *              cached.  For a flush, writes back all dirty chunks and
+ *              optionally evicts all chunks.  The task completes once any
+ *              fetch and write-backs the operation waits on are done.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_cache_op_task(tse_task_t *task)
+{
+    H5_daos_chunk_cache_op_t  *op = NULL;
+    H5_daos_chunk_cache_ent_t *ent;
+    H5_daos_chunk_cache_ent_t *next_ent;
+    H5_daos_dset_t            *dset;
+    hbool_t                    queued    = FALSE;
+    int                        ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (op = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk cache task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(op->req, H5E_DATASET);
+
+    dset = op->dset;
+
+    /* Nothing to do if the cache was never set up */
+    if (!dset->chunk_cache.table)
+        D_GOTO_DONE(0);
+
+    if (op->flush) {
+        /* Write back all dirty chunks, evicting them if requested */
+        for (ent = dset->chunk_cache.lru_head; ent; ent = next_ent) {
+            next_ent = ent->next;
+            if (ent->fetching)
+                continue;
+            if (H5_daos_chunk_cache_write_back(dset, ent, op->evict, op) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, -H5_DAOS_SETUP_ERROR,
+                             "can't write back cached chunk");
+            if (op->evict && H5_daos_chunk_cache_remove(dset, ent) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, -H5_DAOS_SETUP_ERROR,
+                             "can't evict cached chunk");
+        } /* end for */
+    }     /* end if */
+    else {
+        if (DV_HASH_TABLE_NULL == (ent = dv_hash_table_lookup(dset->chunk_cache.table, op->chunk_coords))) {
+            if (H5_daos_chunk_cache_insert(dset, op, &ent) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, -H5_DAOS_SETUP_ERROR,
+                             "can't add chunk to chunk cache");
+
+            /* A write does not need the rest of the chunk, so just buffer
+             * it.  Otherwise fetch the chunk. */
+            if (op->io_type == IO_WRITE)
+                ent->partial = TRUE;
+            else if (H5_daos_chunk_cache_fetch(dset, ent, op) < 0) {
+                (void)H5_daos_chunk_cache_remove(dset, ent);
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_SETUP_ERROR, "can't fetch chunk");
+            } /* end if */
+        }     /* end if */
+        else {
+            /* Nothing to prefetch if the chunk is already cached */
+            if (op->prefetch && !ent->partial)
+                D_GOTO_DONE(0);
+
+            /* Move to the front of the LRU list */
+            if (ent != dset->chunk_cache.lru_head) {
+                ent->prev->next = ent->next;
+                if (ent->next)
+                    ent->next->prev = ent->prev;
+                else
+                    dset->chunk_cache.lru_tail = ent->prev;
+                ent->prev                        = NULL;
+                ent->next                        = dset->chunk_cache.lru_head;
+                dset->chunk_cache.lru_head->prev = ent;
+                dset->chunk_cache.lru_head       = ent;
+            } /* end if */
+
+            /* Only writes can be applied to a partially written chunk.
+             * Otherwise write back the buffered extents and fetch the whole
+             * chunk. */
+            if (ent->partial && (op->prefetch || op->io_type != IO_WRITE)) {
+                if (H5_daos_chunk_cache_write_back(dset, ent, FALSE, op) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, -H5_DAOS_SETUP_ERROR,
+                                 "can't write back cached chunk");
+                if (H5_daos_chunk_cache_fetch(dset, ent, op) < 0) {
+                    (void)H5_daos_chunk_cache_remove(dset, ent);
+                    D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_SETUP_ERROR, "can't fetch chunk");
+                } /* end if */
+            }     /* end if */
+        }         /* end else */
+
+        /* A prefetch is done once the fetch has been started */
+        if (op->prefetch)
+            D_GOTO_DONE(0);
+
+        if (ent->fetching) {
+            /* Wait for the fetch to complete */
+            if (ent->waiters_tail)
+                ent->waiters_tail->next = op;
+            else
+                ent->waiters_head = op;
+            ent->waiters_tail = op;
+            queued            = TRUE;
+        } /* end if */
+        else {
+            if (H5_daos_chunk_cache_apply(op, ent) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't apply I/O to cached chunk");
+
+            /* Write back all dirty chunks once enough data is buffered */
+            if (dset->chunk_cache.wc_nbytes > 0 &&
+                dset->chunk_cache.ndirty_bytes >= dset->chunk_cache.wc_nbytes)
+                for (ent = dset->chunk_cache.lru_head; ent; ent = ent->next)
+                    if (!ent->fetching && H5_daos_chunk_cache_write_back(dset, ent, FALSE, op) < 0)
+                        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, -H5_DAOS_SETUP_ERROR,
+                                     "can't write back cached chunk");
+        } /* end else */
+    }     /* end else */
+
+done:
+    if (op) {
+        /* Release the operation unless it was queued on a chunk being
+         * fetched, in which case it is released when the fetch completes */
+        if (!queued)
+            (void)H5_daos_chunk_cache_op_release(op, ret_value);
+    } /* end if */
+    else {
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
 
-            /* Allocate future ID and set up async task if necessary */
-            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
-#if H5VL_VERSION >= 2
-                /* Allocate udata struct */
-                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                 "can't allocate space for dataset get udata struct");
+        /* Complete this task */
+        tse_task_complete(task, ret_value);
+    } /* end else */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_op_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_io
+ *
+ * Purpose:     Sets up I/O on the selection in a single chunk through the
+ *              dataset's chunk cache.  The memory datatype must match the
+ *              dataset's datatype.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_io(H5_daos_select_chunk_info_t *chunk_info, H5_daos_dset_t *dset, uint64_t dset_ndims,
+                       H5_daos_io_type_t io_type, void *buf, H5_daos_req_t *req, tse_task_t **first_task,
+                       tse_task_t **dep_task)
+{
+    H5_daos_chunk_cache_op_t *op = NULL;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(chunk_info);
+    assert(dset);
+    assert(dset->chunk_cache.table);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct */
+    if (NULL == (op = (H5_daos_chunk_cache_op_t *)DV_calloc(sizeof(H5_daos_chunk_cache_op_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk cache operation");
+    op->sel.recxs   = &op->sel.recx;
+    op->sel.sg_iovs = &op->sel.sg_iov;
+    op->req         = req;
+    op->dset        = dset;
+    op->io_type     = io_type;
+    op->nwait       = 1;
+    memcpy(op->chunk_coords, chunk_info->chunk_coords, (size_t)dset_ndims * sizeof(uint64_t));
+
+    /* Build the selection in the chunk and in memory.  Fill values are
+     * handled on the whole cached chunk, so always set up as for a write. */
+    if (H5_daos_chunk_io_setup_types_equal(chunk_info, dset, dset_ndims, IO_WRITE, buf, &op->sel) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't set up chunk I/O");
+
+    /* No selection in the file */
+    if (op->sel.iod.iod_nr == 0) {
+        *dep_task = NULL;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    if (H5_daos_create_task(H5_daos_chunk_cache_op_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, op, &op->task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for chunk cache I/O");
+
+    /* Schedule task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(op->task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule chunk cache I/O task: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = op->task;
+    *dep_task = op->task;
+
+    /* Task will be scheduled, give it a reference to req and dset */
+    req->rc++;
+    dset->obj.item.rc++;
+    op = NULL;
+
+done:
+    /* Cleanup */
+    if (op) {
+        if (op->sel.recxs != &op->sel.recx)
+            DV_free(op->sel.recxs);
+        if (op->sel.sg_iovs != &op->sel.sg_iov)
+            DV_free(op->sel.sg_iovs);
+        DV_free(op);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_io() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_sync
+ *
+ * Purpose:     Called before I/O on a chunked dataset, to keep it
+ *              coherent with the other handles of the dataset open in
+ *              this process, which do not share a chunk cache.  Sets up
+ *              tasks that write back and drop the chunks cached by the
+ *              other handles, so the I/O sees their data.  The handle's
+ *              own cache may only be used while no other handle of the
+ *              dataset has done I/O, and not if bypass is TRUE.  If it
+ *              can't be used its chunks are written back and dropped as
+ *              well.  *use_cache is set to whether the I/O should go
+ *              through the handle's cache.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_sync(H5_daos_dset_t *dset, hbool_t bypass, hbool_t *use_cache, H5_daos_req_t *req,
+                         tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_dset_t *other;
+    hbool_t         shared    = FALSE;
+    herr_t          ret_value = SUCCEED;
+
+    assert(dset);
+    assert(use_cache);
+
+    *use_cache = FALSE;
+
+    /* Write back and drop the chunks cached by other handles */
+    if (dset->peer_listed)
+        for (other = H5_daos_dset_peers_g; other; other = other->peer_next)
+            if (H5_daos_dset_is_peer(dset, other)) {
+                shared = TRUE;
+                if (other->chunk_cache.table &&
+                    H5_daos_chunk_cache_flush(other, TRUE, req, first_task, dep_task) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL,
+                                 "can't flush chunk cache of other dataset handle");
+            } /* end if */
+
+    if (dset->chunk_cache.table) {
+        if (!bypass && !shared)
+            *use_cache = TRUE;
+        else if (H5_daos_chunk_cache_flush(dset, TRUE, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+    } /* end if */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_sync() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_flush
+ *
+ * Purpose:     Sets up a task that writes back all dirty chunks in the
+ *              dataset's chunk cache once the tasks before it are done,
+ *              and completes once the write-backs complete.  If evict is
+ *              TRUE, all chunks are dropped from the cache as well.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_flush(H5_daos_dset_t *dset, hbool_t evict, H5_daos_req_t *req, tse_task_t **first_task,
+                          tse_task_t **dep_task)
+{
+    H5_daos_chunk_cache_op_t *op = NULL;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(dset);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct */
+    if (NULL == (op = (H5_daos_chunk_cache_op_t *)DV_calloc(sizeof(H5_daos_chunk_cache_op_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk cache operation");
+    op->sel.recxs   = &op->sel.recx;
+    op->sel.sg_iovs = &op->sel.sg_iov;
+    op->req         = req;
+    op->dset        = dset;
+    op->flush       = TRUE;
+    op->evict       = evict;
+    op->nwait       = 1;
+
+    if (H5_daos_create_task(H5_daos_chunk_cache_op_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, op, &op->task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to flush chunk cache");
+
+    /* Schedule task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(op->task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to flush chunk cache: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = op->task;
+    *dep_task = op->task;
+
+    /* Task will be scheduled, give it a reference to req and dset */
+    req->rc++;
+    dset->obj.item.rc++;
+    op = NULL;
+
+done:
+    /* Cleanup */
+    if (op)
+        DV_free(op);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_flush() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_cache_readahead
+ *
+ * Purpose:     Called after setting up a read through the dataset's chunk
+ *              cache.  If the read starts at or just after the last chunk
+ *              (in row-major chunk order) of the previous read, starts
+ *              prefetching the chunks following the read that have not
+ *              been prefetched already, up to the dataset's readahead
+ *              window.  The prefetches run after dep_task, and use a
+ *              request of their own so they neither delay the read nor
+ *              report errors to it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_cache_readahead(H5_daos_dset_t *dset, H5_daos_select_chunk_info_t *chunk_info,
+                              size_t nchunks_sel, tse_task_t *dep_task)
+{
+    H5_daos_chunk_cache_op_t *op     = NULL;
+    H5_daos_req_t            *ra_req = NULL;
+    hsize_t                   dims[H5S_MAX_RANK];
+    uint64_t                  grid_dims[H5S_MAX_RANK];
+    uint64_t                  nchunks_tot = 1;
+    uint64_t                  lo          = UINT64_MAX;
+    uint64_t                  hi          = 0;
+    uint64_t                  start;
+    uint64_t                  end;
+    uint64_t                  idx;
+    uint64_t                  rem;
+    hbool_t                   sequential;
+    size_t                    i;
+    int                       ndims = dset->chunk_cache.ndims;
+    int                       j;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(dset);
+    assert(dset->chunk_cache.table);
+    assert(dset->chunk_cache.ra_nchunks > 0);
+    assert(chunk_info);
+
+    /* Get the dimensions of the chunk grid */
+    if (H5Sget_simple_extent_dims(dset->space_id, dims, NULL) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+    for (j = 0; j < ndims; j++) {
+        grid_dims[j] = (uint64_t)((dims[j] + dset->dcpl_cache.chunk_dims[j] - 1) /
+                                  dset->dcpl_cache.chunk_dims[j]);
+        nchunks_tot *= grid_dims[j];
+    } /* end for */
+
+    /* Find the range of chunks read */
+    for (i = 0; i < nchunks_sel; i++) {
+        idx = 0;
+        for (j = 0; j < ndims; j++)
+            idx = (idx * grid_dims[j]) + (chunk_info[i].chunk_coords[j] / dset->dcpl_cache.chunk_dims[j]);
+        if (idx < lo)
+            lo = idx;
+        if (idx > hi)
+            hi = idx;
+    } /* end for */
+
+    /* Check for sequential access and remember where this read ended */
+    sequential = dset->chunk_cache.ra_valid &&
+                 (lo == dset->chunk_cache.ra_last || lo == dset->chunk_cache.ra_last + 1);
+    dset->chunk_cache.ra_valid = TRUE;
+    dset->chunk_cache.ra_last  = hi;
+    if (!sequential) {
+        dset->chunk_cache.ra_issued = 0;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Determine the chunks to prefetch */
+    start = MAX(hi + 1, dset->chunk_cache.ra_issued);
+    end   = MIN(hi + 1 + dset->chunk_cache.ra_nchunks, nchunks_tot);
+    if (start >= end)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Create request for the prefetches */
+    if (NULL == (ra_req = H5_daos_req_create(dset->obj.item.file, "dataset readahead", NULL, NULL, NULL,
+                                             H5I_INVALID_HID)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+    for (idx = start; idx < end; idx++) {
+        /* Allocate argument struct */
+        if (NULL == (op = (H5_daos_chunk_cache_op_t *)DV_calloc(sizeof(H5_daos_chunk_cache_op_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk cache operation");
+        op->sel.recxs   = &op->sel.recx;
+        op->sel.sg_iovs = &op->sel.sg_iov;
+        op->req         = ra_req;
+        op->dset        = dset;
+        op->io_type     = IO_READ;
+        op->prefetch    = TRUE;
+        op->nwait       = 1;
+
+        /* Calculate chunk coordinates */
+        rem = idx;
+        for (j = ndims - 1; j >= 0; j--) {
+            op->chunk_coords[j] = (rem % grid_dims[j]) * (uint64_t)dset->dcpl_cache.chunk_dims[j];
+            rem /= grid_dims[j];
+        } /* end for */
+
+        if (H5_daos_create_task(H5_daos_chunk_cache_op_task, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                                NULL, NULL, op, &op->task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to prefetch chunk");
+
+        /* Schedule task and give it a reference to req and dset */
+        if (0 != (ret = tse_task_schedule(op->task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to prefetch chunk: %s",
+                         H5_daos_err_to_string(ret));
+        ra_req->rc++;
+        dset->obj.item.rc++;
+        op = NULL;
+
+        dset->chunk_cache.ra_issued = idx + 1;
+    } /* end for */
+
+done:
+    /* Cleanup */
+    if (op)
+        DV_free(op);
+    if (ra_req && H5_daos_req_free_int(ra_req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_cache_readahead() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_table_hash
+ *
+ * Purpose:     Hash function for the process-wide chunk index table.  The
+ *              key is a dataset's container and object ID, but only the
+ *              object ID is hashed.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_chunk_index_table_hash(dv_hash_table_key_t key)
+{
+    const H5_daos_chunk_index_key_t *idx_key = (const H5_daos_chunk_index_key_t *)key;
+
+    return (idx_key->oid.lo * UINT64_C(1099511628211)) ^ idx_key->oid.hi;
+} /* end H5_daos_chunk_index_table_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_table_equal
+ *
+ * Purpose:     Key comparison function for the process-wide chunk index
+ *              table.
+ *
+ * Return:      Non-zero if the keys are equal, zero otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_index_table_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2)
+{
+    const H5_daos_chunk_index_key_t *idx_key1 = (const H5_daos_chunk_index_key_t *)key1;
+    const H5_daos_chunk_index_key_t *idx_key2 = (const H5_daos_chunk_index_key_t *)key2;
+
+    return idx_key1->oid.lo == idx_key2->oid.lo && idx_key1->oid.hi == idx_key2->oid.hi &&
+           !strcmp(idx_key1->cont, idx_key2->cont);
+} /* end H5_daos_chunk_index_table_equal() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_key_free
+ *
+ * Purpose:     Frees a key (and value) in a dataset's chunk index table.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_index_key_free(dv_hash_table_key_t key)
+{
+    DV_free(key);
+} /* end H5_daos_chunk_index_key_free() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_new
+ *
+ * Purpose:     Creates an empty chunk index for a dataset.  The index is
+ *              private to the dataset handle until it is shared with
+ *              H5_daos_chunk_index_share().  complete should only be TRUE
+ *              if the dataset is known to have no allocated chunks and
+ *              the file is only open on this process.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_new(H5_daos_dset_t *dset, hbool_t complete)
+{
+    H5_daos_chunk_index_t *idx       = NULL;
+    herr_t                 ret_value = SUCCEED;
+
+    assert(dset);
+    assert(!dset->chunk_index);
+
+    if (NULL == (idx = (H5_daos_chunk_index_t *)DV_calloc(sizeof(H5_daos_chunk_index_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index");
+    if (NULL == (idx->table = dv_hash_table_new(H5_daos_chunk_cache_hash, H5_daos_chunk_cache_equal)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index table");
+
+    /* Keys and values are the same DV_malloc()ed coordinate arrays, so only
+     * free the keys */
+    dv_hash_table_register_free_functions(idx->table, H5_daos_chunk_index_key_free, NULL);
+
+    idx->rc           = 1;
+    idx->complete     = complete;
+    dset->chunk_index = idx;
+    idx               = NULL;
+
+done:
+    if (idx)
+        DV_free(idx);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_new() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_share
+ *
+ * Purpose:     Shares a dataset's chunk index with the other open handles
+ *              of the dataset in this process, through the same or other
+ *              file handles.  If the dataset has no index yet it attaches
+ *              to the index of another handle, or creates a new,
+ *              incomplete index if there is none.  The dataset's object
+ *              ID and container must be known, and the file must only be
+ *              open on this process, since changes made on other
+ *              processes are not seen.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_share(H5_daos_dset_t *dset)
+{
+    H5_daos_file_t           *file;
+    H5_daos_chunk_index_t    *idx;
+    H5_daos_chunk_index_key_t key;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(dset);
+    file = dset->obj.item.file;
+    assert(file->num_procs == 1);
+    assert(file->cont[0]);
+
+    if (dset->chunk_index && dset->chunk_index->shared)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Create the chunk index table if necessary */
+    if (!H5_daos_chunk_index_table_g &&
+        NULL == (H5_daos_chunk_index_table_g =
+                     dv_hash_table_new(H5_daos_chunk_index_table_hash, H5_daos_chunk_index_table_equal)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate process-wide chunk index table");
+
+    /* Check for an index shared by another handle.  A dataset that already
+     * has an index was just created, so there should not be one, but if
+     * there is the dataset keeps its own index. */
+    key.cont = file->cont;
+    key.oid  = dset->obj.oid;
+    if (DV_HASH_TABLE_NULL != (idx = dv_hash_table_lookup(H5_daos_chunk_index_table_g, &key))) {
+        if (dset->chunk_index)
+            D_GOTO_DONE(SUCCEED);
+        idx->rc++;
+        dset->chunk_index = idx;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Create a new index if necessary and add it to the file's table */
+    if (!dset->chunk_index && H5_daos_chunk_index_new(dset, FALSE) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index");
+    idx = dset->chunk_index;
+    strcpy(idx->cont, file->cont);
+    idx->key.cont = idx->cont;
+    idx->key.oid  = dset->obj.oid;
+    if (!dv_hash_table_insert(H5_daos_chunk_index_table_g, &idx->key, idx))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk index to chunk index table");
+    idx->shared = TRUE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_share() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_release
+ *
+ * Purpose:     Releases a dataset handle's reference to its chunk index,
+ *              freeing the index if it was the last one.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_chunk_index_release(H5_daos_dset_t *dset)
+{
+    H5_daos_chunk_index_t *idx;
+
+    assert(dset);
+
+    if (NULL == (idx = dset->chunk_index))
+        return;
+    dset->chunk_index = NULL;
+
+    if (--idx->rc == 0) {
+        if (idx->shared) {
+            (void)dv_hash_table_remove(H5_daos_chunk_index_table_g, &idx->key);
+
+            /* Free the table along with the last shared index */
+            if (dv_hash_table_num_entries(H5_daos_chunk_index_table_g) == 0) {
+                dv_hash_table_free(H5_daos_chunk_index_table_g);
+                H5_daos_chunk_index_table_g = NULL;
+            } /* end if */
+        }     /* end if */
+        dv_hash_table_free(idx->table);
+        DV_free(idx->sorted);
+        DV_free(idx);
+    } /* end if */
+} /* end H5_daos_chunk_index_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_insert
+ *
+ * Purpose:     Adds the chunk with the specified coordinates to a chunk
+ *              index, if it is not there already.
+ *
+ * Return:      Success:        TRUE if the chunk was added, FALSE if it
+ *                              was already in the index
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_chunk_index_insert(H5_daos_chunk_index_t *idx, const uint64_t *chunk_coords, int ndims)
+{
+    uint64_t  key[H5S_MAX_RANK];
+    uint64_t *new_key   = NULL;
+    htri_t    ret_value = TRUE;
+
+    assert(idx);
+    assert(chunk_coords);
+    assert(ndims > 0 && ndims <= H5S_MAX_RANK);
+
+    memset(key, 0, sizeof(key));
+    memcpy(key, chunk_coords, (size_t)ndims * sizeof(uint64_t));
+    if (DV_HASH_TABLE_NULL != dv_hash_table_lookup(idx->table, key))
+        D_GOTO_DONE(FALSE);
+
+    if (NULL == (new_key = (uint64_t *)DV_malloc(sizeof(key))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index entry");
+    memcpy(new_key, key, sizeof(key));
+    if (!dv_hash_table_insert(idx->table, new_key, new_key))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk to chunk index");
+    new_key     = NULL;
+    idx->sorted = DV_free(idx->sorted);
+
+done:
+    if (new_key)
+        DV_free(new_key);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_absent
+ *
+ * Purpose:     Checks if a dataset's chunk index shows that the chunk
+ *              with the specified dkey was never written.
+ *
+ * Return:      TRUE if the chunk is known to be unallocated, FALSE
+ *              otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_chunk_index_absent(H5_daos_dset_t *dset, const daos_key_t *dkey)
+{
+    uint64_t       key[H5S_MAX_RANK];
+    const uint8_t *p;
+    size_t         ndims;
+    size_t         i;
+
+    assert(dset);
+    assert(dkey);
+
+    if (!dset->chunk_index || !dset->chunk_index->complete)
+        return FALSE;
+
+    /* Decode the chunk coordinates after the leading '\0' */
+    memset(key, 0, sizeof(key));
+    ndims = (size_t)(dkey->iov_len - 1) / sizeof(uint64_t);
+    assert(ndims <= H5S_MAX_RANK);
+    p = (const uint8_t *)dkey->iov_buf + 1;
+    for (i = 0; i < ndims; i++)
+        UINT64DECODE(p, key[i]);
+
+    return DV_HASH_TABLE_NULL == dv_hash_table_lookup(dset->chunk_index->table, key);
+} /* end H5_daos_chunk_index_absent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_add
+ *
+ * Purpose:     Adds the selected chunks to a dataset's chunk index,
+ *              creating the index if necessary.  The akeys for the chunks
+ *              that were not in the index already are encoded in
+ *              *akey_buf, which must be passed to
+ *              H5_daos_chunk_index_write() if *nnew is not 0, to record
+ *              them in the file.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_add(H5_daos_dset_t *dset, H5_daos_select_chunk_info_t *chunk_info, size_t nchunks,
+                        int ndims, uint8_t **akey_buf, unsigned *nnew)
+{
+    uint8_t *buf = NULL;
+    uint8_t *p;
+    htri_t   inserted;
+    size_t   i;
+    int      j;
+    herr_t   ret_value = SUCCEED;
 
-                /* Register future ID for dataspace */
-                if ((*ret_id = H5Iregister_future(H5I_DATASPACE, get_udata, H5_daos_dataset_get_realize,
-                                                  H5_daos_dataset_get_discard)) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register future ID");
-            } /* end if */
-            else
-#else
-                /* No future ID support, wait for the dataset to open */
-                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (dset->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "attribute open failed");
-            } /* end if */
-#endif
-            {
-                /* Retrieve the dataset's dataspace.  Use
-                 * cur_set_extent_space_id if present, otherwise just use
-                 * space_id. */
-                if (dset->cur_set_extent_space_id >= 0) {
-                    if ((*ret_id = H5Scopy(dset->cur_set_extent_space_id)) < 0)
-                        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace ID of dataset");
-                } /* end if */
-                else if ((*ret_id = H5Scopy(dset->space_id)) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataspace ID of dataset");
-            } /* end else/block */
+    assert(dset);
+    assert(chunk_info);
+    assert(akey_buf);
+    assert(nnew);
+
+    *akey_buf = NULL;
+    *nnew     = 0;
+
+    if (!dset->chunk_index && H5_daos_chunk_index_new(dset, FALSE) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create chunk index");
+
+    for (i = 0; i < nchunks; i++) {
+        if ((inserted = H5_daos_chunk_index_insert(dset->chunk_index, chunk_info[i].chunk_coords, ndims)) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk to chunk index");
+        if (!inserted)
+            continue;
+
+        /* Allocate the akey buffer for the remaining chunks on the first new
+         * chunk */
+        if (!buf) {
+            if (NULL == (buf = (uint8_t *)DV_malloc((nchunks - i) * (size_t)ndims * sizeof(uint64_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                             "can't allocate buffer for chunk index akeys");
+            p = buf;
+        } /* end if */
 
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_SPACE_STATUS: {
-            H5D_space_status_t *allocation = get_args->args.get_space_status.status;
+        for (j = 0; j < ndims; j++)
+            UINT64ENCODE(p, chunk_info[i].chunk_coords[j]);
+        (*nnew)++;
+    } /* end for */
 
-            if (!allocation)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+    *akey_buf = buf;
+    buf       = NULL;
 
-            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-            if (NULL ==
-                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset dataspace status",
-                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+done:
+    DV_free(buf);
 
-            /* Retrieve the dataset's space status */
-            *allocation = H5D_SPACE_STATUS_ALLOCATED;
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_TYPE: {
-            hid_t *ret_id = &get_args->args.get_type.type_id;
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_add() */
 
-            if (!ret_id)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_shrink
+ *
+ * Purpose:     Removes the chunks that lie entirely outside the new
+ *              extent size from a dataset's chunk index.  The akeys for
+ *              the removed chunks are encoded in *akey_buf, which must be
+ *              passed to H5_daos_chunk_index_write() (or freed) if
+ *              *nremoved is not 0.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_shrink(H5_daos_dset_t *dset, const hsize_t *size, int ndims, uint8_t **akey_buf,
+                           unsigned *nremoved)
+{
+    dv_hash_table_iter_t iter;
+    uint64_t           **removed = NULL;
+    uint64_t            *coords;
+    uint8_t             *buf = NULL;
+    uint8_t             *p;
+    size_t               nalloc;
+    size_t               i;
+    int                  j;
+    herr_t               ret_value = SUCCEED;
 
-            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-            if (NULL ==
-                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset datatype",
-                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    assert(dset);
+    assert(dset->chunk_index);
+    assert(size);
+    assert(akey_buf);
+    assert(nremoved);
 
-            /* Allocate future ID and set up async task if necessary */
-            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
-#if H5VL_VERSION >= 2
-                /* Allocate udata struct */
-                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                 "can't allocate space for dataset get udata struct");
+    *akey_buf = NULL;
+    *nremoved = 0;
 
-                /* Register future ID for datatype */
-                if ((*ret_id = H5Iregister_future(H5I_DATATYPE, get_udata, H5_daos_dataset_get_realize,
-                                                  H5_daos_dataset_get_discard)) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTREGISTER, FAIL, "can't register future ID");
-            } /* end if */
-            else
-#else
-                /* No future ID support, wait for the dataset to open */
-                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (dset->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "attribute open failed");
+    if (0 == (nalloc = (size_t)dv_hash_table_num_entries(dset->chunk_index->table)))
+        D_GOTO_DONE(SUCCEED);
+
+    /* Find the chunks to remove.  The table can't be modified while it is
+     * being iterated over. */
+    if (NULL == (removed = (uint64_t **)DV_malloc(nalloc * sizeof(uint64_t *))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate list of removed chunks");
+    dv_hash_table_iterate(dset->chunk_index->table, &iter);
+    while (dv_hash_table_iter_has_more(&iter)) {
+        coords = (uint64_t *)dv_hash_table_iter_next(&iter);
+        for (j = 0; j < ndims; j++)
+            if (coords[j] >= (uint64_t)size[j]) {
+                removed[(*nremoved)++] = coords;
+                break;
             } /* end if */
-#endif
-            {
-                /* Retrieve the dataset's datatype */
-                if ((*ret_id = H5Tcopy(dset->type_id)) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get datatype ID of dataset");
-            } /* end else/block */
+    }         /* end while */
 
-            break;
-        } /* end block */
-        case H5VL_DATASET_GET_STORAGE_SIZE: {
-            hsize_t *storage_size = get_args->args.get_storage_size.storage_size;
-            hssize_t nelements    = 0;
-            size_t   dtype_size   = 0;
+    if (*nremoved == 0)
+        D_GOTO_DONE(SUCCEED);
 
-            if (!storage_size)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+    /* Encode the akeys of the removed chunks and remove them from the table
+     * (which frees the coordinates) */
+    if (NULL == (buf = (uint8_t *)DV_malloc((size_t)*nremoved * (size_t)ndims * sizeof(uint64_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for chunk index akeys");
+    p = buf;
+    for (i = 0; i < (size_t)*nremoved; i++) {
+        for (j = 0; j < ndims; j++)
+            UINT64ENCODE(p, removed[i][j]);
+        if (!dv_hash_table_remove(dset->chunk_index->table, removed[i]))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTREMOVE, FAIL, "can't remove chunk from chunk index");
+    } /* end for */
+    dset->chunk_index->sorted = DV_free(dset->chunk_index->sorted);
 
-            /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-            if (NULL ==
-                (int_req = H5_daos_req_create(dset->obj.item.file, "get dataset storage size",
-                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    *akey_buf = buf;
+    buf       = NULL;
 
-            /* Set up async task if necessary */
-            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
-                /* Allocate udata struct */
-                if (NULL == (get_udata = (H5_daos_dset_get_ud_t *)DV_calloc(sizeof(H5_daos_dset_get_ud_t))))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                 "can't allocate space for dataset get udata struct");
+done:
+    /* If the table could not be updated, it can't be trusted to be complete
+     * any more */
+    if (ret_value < 0) {
+        dset->chunk_index->complete = FALSE;
+        *nremoved                   = 0;
+    } /* end if */
 
-                /* Set output value pointer in udata */
-                get_udata->hsize_out = storage_size;
-            } /* end if */
-            else {
-                *storage_size = 0;
-
-                if (H5I_INVALID_HID == dset->space_id || H5I_INVALID_HID == dset->type_id)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset's dataspace or datatype");
-
-                /* Return the in-memory size of the data */
-                if ((nelements = H5Sget_simple_extent_npoints(dset->space_id)) < 0)
-                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
-                                 "can't get number of elements in dataset's dataspace");
-                if (0 == (dtype_size = H5Tget_size(dset->type_id)))
-                    D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get dataset's type size");
-                *storage_size = (hsize_t)nelements * dtype_size;
-            } /* end else */
+    DV_free(removed);
+    DV_free(buf);
 
-            break;
-        }
-        default:
-            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "can't get this type of information from dataset");
-    } /* end switch */
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_shrink() */
 
-    /* Start async operation if we allocated task_udata */
-    if (get_udata) {
-        tse_task_t *get_task;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_cmp
+ *
+ * Purpose:     qsort() comparison function for chunk index entries,
+ *              ordering them by their coordinates in row-major order.
+ *
+ * Return:      Negative, zero or positive, like memcmp()
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_index_cmp(const void *_coords1, const void *_coords2)
+{
+    const uint64_t *coords1 = (const uint64_t *)_coords1;
+    const uint64_t *coords2 = (const uint64_t *)_coords2;
+    int             i;
 
-        assert(int_req);
+    for (i = 0; i < H5S_MAX_RANK; i++)
+        if (coords1[i] != coords2[i])
+            return coords1[i] < coords2[i] ? -1 : 1;
 
-        /* Finish filling in task_udata */
-        get_udata->req      = int_req;
-        get_udata->dset     = dset;
-        get_udata->get_type = get_args->op_type;
+    return 0;
+} /* end H5_daos_chunk_index_cmp() */
 
-        /* Create task to get dataset info.  USe empty task for everything but
-         * storage size, for the other get types the realize callback will
-         * do the actual retrieval. */
-        if (H5_daos_create_task(get_args->op_type == H5VL_DATASET_GET_STORAGE_SIZE
-                                    ? H5_daos_dataset_get_task
-                                    : H5_daos_metatask_autocomplete,
-                                0, NULL, NULL, NULL, get_udata, &get_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform get operation");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_sort
+ *
+ * Purpose:     Builds the sorted list of a chunk index's entries, if it
+ *              is not already built.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_sort(H5_daos_chunk_index_t *idx)
+{
+    dv_hash_table_iter_t iter;
+    size_t               nentries;
+    size_t               i         = 0;
+    herr_t               ret_value = SUCCEED;
 
-        /* Save task to be scheduled later and give it a reference to req and
-         * dset */
-        assert(!first_task);
-        first_task = get_task;
-        dep_task   = get_task;
-        dset->obj.item.rc++;
-        int_req->rc++;
-        get_udata = NULL;
-    } /* end if */
+    assert(idx);
+
+    if (idx->sorted)
+        D_GOTO_DONE(SUCCEED);
+    if (0 == (nentries = (size_t)dv_hash_table_num_entries(idx->table)))
+        D_GOTO_DONE(SUCCEED);
+
+    if (NULL == (idx->sorted = (uint64_t *)DV_malloc(nentries * H5S_MAX_RANK * sizeof(uint64_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate sorted chunk list");
+    dv_hash_table_iterate(idx->table, &iter);
+    while (dv_hash_table_iter_has_more(&iter)) {
+        assert(i < nentries);
+        memcpy(&idx->sorted[i * H5S_MAX_RANK], dv_hash_table_iter_next(&iter),
+               H5S_MAX_RANK * sizeof(uint64_t));
+        i++;
+    } /* end while */
+    qsort(idx->sorted, nentries, H5S_MAX_RANK * sizeof(uint64_t), H5_daos_chunk_index_cmp);
 
 done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_sort() */
 
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_write
+ *
+ * Purpose:     Creates a task to add nkeys chunks, whose akeys are encoded
+ *              in akey_buf, to a dataset's chunk index in the file, or to
+ *              punch them from it if punch is TRUE.  If valid is TRUE
+ *              also writes the marker that shows the index holds every
+ *              allocated chunk.  ndims is only used if nkeys is not 0.
+ *              Takes ownership of akey_buf, even on failure.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_write(H5_daos_dset_t *dset, uint8_t *akey_buf, unsigned nkeys, int ndims, hbool_t valid,
+                          hbool_t punch, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_chunk_index_ud_t *udata = NULL;
+    tse_task_t               *index_task;
+    size_t                    akey_len = (size_t)ndims * sizeof(uint64_t);
+    unsigned                  i;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
 
-        /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_READ,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+    assert(dset);
+    assert(nkeys > 0 || valid);
+    assert(!(punch && valid));
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
+    /* Allocate task udata */
+    if (NULL == (udata = (H5_daos_chunk_index_ud_t *)DV_calloc(sizeof(H5_daos_chunk_index_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index update user data");
+    udata->req      = req;
+    udata->dset     = dset;
+    udata->punch    = punch;
+    udata->valid    = valid;
+    udata->nr       = nkeys + (valid ? 1 : 0);
+    udata->akey_buf = akey_buf;
+    akey_buf        = NULL;
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&udata->dkey, H5_daos_chunk_index_key_g,
+                       H5_daos_chunk_index_key_size_g);
+
+    if (punch) {
+        /* Set up akeys */
+        if (NULL == (udata->akeys = (daos_key_t *)DV_malloc(udata->nr * sizeof(daos_key_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index akeys");
+        for (i = 0; i < nkeys; i++)
+            daos_iov_set(&udata->akeys[i], udata->akey_buf + (i * akey_len), (daos_size_t)akey_len);
+    } /* end if */
+    else {
+        /* Set up iods and sgls.  Every entry has the same single byte value. */
+        if (NULL == (udata->iods = (daos_iod_t *)DV_calloc(udata->nr * sizeof(daos_iod_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index iods");
+        if (NULL == (udata->sgls = (daos_sg_list_t *)DV_calloc(udata->nr * sizeof(daos_sg_list_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index sgls");
+        udata->val = 1;
+        daos_iov_set(&udata->sg_iov, &udata->val, (daos_size_t)sizeof(udata->val));
+        for (i = 0; i < udata->nr; i++) {
+            if (i < nkeys)
+                daos_iov_set(&udata->iods[i].iod_name, udata->akey_buf + (i * akey_len),
+                             (daos_size_t)akey_len);
+            else
+                daos_const_iov_set((d_const_iov_t *)&udata->iods[i].iod_name,
+                                   H5_daos_chunk_index_valid_key_g, H5_daos_chunk_index_valid_key_size_g);
+            udata->iods[i].iod_nr   = 1u;
+            udata->iods[i].iod_size = (daos_size_t)sizeof(udata->val);
+            udata->iods[i].iod_type = DAOS_IOD_SINGLE;
+            udata->sgls[i].sg_nr    = 1;
+            udata->sgls[i].sg_iovs  = &udata->sg_iov;
+        } /* end for */
+    }     /* end else */
+
+    /* Create task to update the chunk index */
+    if (H5_daos_create_daos_task(punch ? DAOS_OPC_OBJ_PUNCH_AKEYS : DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0,
+                                 *dep_task ? dep_task : NULL, H5_daos_chunk_index_write_prep_cb,
+                                 H5_daos_chunk_index_write_comp_cb, udata, &index_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to update chunk index");
+
+    /* Schedule chunk index task (or save it to be scheduled later) and give
+     * it a reference to req and the dataset */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(index_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to update chunk index: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = index_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    *dep_task = index_task;
+    udata     = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (udata) {
+        assert(ret_value < 0);
+        DV_free(udata->akey_buf);
+        DV_free(udata->akeys);
+        DV_free(udata->iods);
+        DV_free(udata->sgls);
+        DV_free(udata);
+    } /* end if */
+    DV_free(akey_buf);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_write() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_write_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_update or
+ *              daos_obj_punch_akeys to update a dataset's chunk index.
+ *              Currently checks for errors from previous tasks then sets
+ *              arguments for the DAOS operation.  If this writes the
+ *              marker for a new dataset, its object ID is now known, so
+ *              its index is shared with other handles opened later.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_index_write_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_index_ud_t *udata;
+    int                       ret_value = 0;
 
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL,
-                             "dataset get operation failed in task \"%s\": %s", int_req->failed_task,
-                             H5_daos_err_to_string(int_req->status));
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk index update task");
 
-            /* Release our reference to the internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
-    }     /* end if */
+    assert(udata->req);
+    assert(udata->dset);
 
-    /* Cleanup on error */
-    assert(!get_udata || ret_value < 0);
-    get_udata = DV_free(get_udata);
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_DATASET);
 
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_get() */
+    /* Share a new dataset's chunk index */
+    if (udata->valid && udata->dset->obj.item.file->num_procs == 1)
+        if (H5_daos_chunk_index_share(udata->dset) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't share chunk index");
+
+    if (udata->punch) {
+        daos_obj_punch_t *punch_args;
+
+        /* Set punch task arguments */
+        if (NULL == (punch_args = daos_task_get_args(task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                         "can't get arguments for chunk index punch task");
+        memset(punch_args, 0, sizeof(*punch_args));
+        punch_args->oh      = udata->dset->obj.obj_oh;
+        punch_args->th      = udata->req->th;
+        punch_args->dkey    = &udata->dkey;
+        punch_args->akeys   = udata->akeys;
+        punch_args->akey_nr = udata->nr;
+    } /* end if */
+    else {
+        daos_obj_rw_t *update_args;
+
+        /* Set update task arguments */
+        if (NULL == (update_args = daos_task_get_args(task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                         "can't get arguments for chunk index update task");
+        memset(update_args, 0, sizeof(*update_args));
+        update_args->oh   = udata->dset->obj.obj_oh;
+        update_args->th   = udata->req->th;
+        update_args->dkey = &udata->dkey;
+        update_args->nr   = udata->nr;
+        update_args->iods = udata->iods;
+        update_args->sgls = udata->sgls;
+    } /* end else */
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_write_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_specific
+ * Function:    H5_daos_chunk_index_write_comp_cb
  *
- * Purpose:     Performs a dataset "specific" operation
+ * Purpose:     Complete callback for asynchronous daos_obj_update or
+ *              daos_obj_punch_akeys to update a dataset's chunk index.
+ *              Currently checks for a failed task then frees private
+ *              data.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Jordan Henderson
- *              January, 2019
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_specific(void *_item, H5VL_dataset_specific_args_t *specific_args, hid_t dxpl_id,
-                         void H5VL_DAOS_UNUSED **req)
+static int
+H5_daos_chunk_index_write_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_dset_t *dset       = (H5_daos_dset_t *)_item;
-    H5_daos_req_t  *int_req    = NULL;
-    tse_task_t     *first_task = NULL;
-    tse_task_t     *dep_task   = NULL;
-    hbool_t         collective_md_read;
-    hbool_t         collective_md_write;
-    hbool_t         must_coll_req = FALSE;
-    hid_t           dapl_id       = H5P_DATASET_ACCESS_DEFAULT;
-    int             ret;
-    herr_t          ret_value = SUCCEED;
-
-    H5_daos_inc_api_cnt();
+    H5_daos_chunk_index_ud_t *udata;
+    int                       ret_value = 0;
 
-    if (!_item)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
-    if (!specific_args)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
-    if (H5I_DATASET != dset->obj.item.type)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
-
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+    assert(H5_daos_task_list_g);
 
-    /* Determine metadata I/O mode setting (collective vs. independent)
-     * for metadata reads and writes according to file-wide setting on FAPL.
-     */
-    H5_DAOS_GET_METADATA_IO_MODES(dset->obj.item.file, dapl_id, H5P_DATASET_ACCESS_DEFAULT,
-                                  collective_md_read, collective_md_write, H5E_DATASET, FAIL);
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk index update task");
 
-    switch (specific_args->op_type) {
-        case H5VL_DATASET_SET_EXTENT: {
-            const hsize_t *size = specific_args->args.set_extent.size;
+    /* Handle errors in update task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "chunk index update";
+    } /* end if */
 
-            if (!size)
-                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "size parameter is NULL");
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                     "can't return task to task list");
 
-            /* Wait for the dataset to open if necessary */
-            if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
-                if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-                if (dset->obj.item.open_req->status != 0)
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "dataset open failed");
-            } /* end if */
+    if (udata) {
+        /* Close dataset */
+        if (H5_daos_dataset_close_real(udata->dset) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
 
-            if (H5D_CHUNKED != dset->dcpl_cache.layout)
-                D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, FAIL, "dataset storage layout is not chunked");
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except
+         * for H5_daos_req_free_int, which updates req->status if it sees an
+         * error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "chunk index update completion callback";
+        } /* end if */
 
-            /* Start H5 operation */
-            if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "set dataset extent",
-                                                      dset->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-#ifdef H5_DAOS_USE_TRANSACTIONS
-            /* Start transaction */
-            if (0 != (ret = daos_tx_open(dset->obj.item.file->coh, &int_req->th, 0, NULL /*event*/)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start transaction");
-            int_req->th_open = TRUE;
-#endif /* H5_DAOS_USE_TRANSACTIONS */
+        /* Free private data */
+        DV_free(udata->akey_buf);
+        DV_free(udata->akeys);
+        DV_free(udata->iods);
+        DV_free(udata->sgls);
+        DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
 
-            /* Call main routine */
-            must_coll_req = collective_md_write;
-            if (H5_daos_dataset_set_extent(dset, size, collective_md_write, int_req, &first_task, &dep_task) <
-                0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "failed to set dataset extent");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_write_comp_cb() */
 
-            break;
-        } /* end block */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_load
+ *
+ * Purpose:     Creates a task to load the chunk index of a dataset being
+ *              opened, once its metadata has been read.  Only used if the
+ *              file is only open on this process.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_index_load(H5_daos_dset_t *dset, H5_daos_req_t *req, tse_task_t **first_task,
+                         tse_task_t **dep_task)
+{
+    H5_daos_chunk_index_load_ud_t *udata = NULL;
+    int                            ret;
+    herr_t                         ret_value = SUCCEED;
 
-        case H5VL_DATASET_FLUSH: {
-            /* Start H5 operation */
-            if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset flush",
-                                                      dset->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    assert(dset);
+    assert(dset->obj.item.file->num_procs == 1);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-            if (H5_daos_dataset_flush(dset, int_req, &first_task, &dep_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush dataset");
+    /* Allocate task udata */
+    if (NULL == (udata = (H5_daos_chunk_index_load_ud_t *)DV_calloc(sizeof(H5_daos_chunk_index_load_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk index load user data");
+    udata->req  = req;
+    udata->dset = dset;
+
+    /* Create task to load the chunk index.  It is completed by
+     * H5_daos_chunk_index_load_finish(). */
+    if (H5_daos_create_task(H5_daos_chunk_index_load_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, udata, &udata->load_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to load chunk index");
+
+    /* Schedule load task (or save it to be scheduled later) and give it a
+     * reference to req and the dataset */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(udata->load_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to load chunk index: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = udata->load_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    *dep_task = udata->load_task;
+    udata     = NULL;
 
-            break;
-        } /* end block */
+done:
+    DV_free(udata);
 
-        case H5VL_DATASET_REFRESH: {
-            /* Start H5 operation */
-            if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "dataset refresh",
-                                                      dset->obj.item.open_req, NULL, NULL, H5I_INVALID_HID)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_load() */
 
-#ifdef H5_DAOS_USE_TRANSACTIONS
-            /* Start transaction */
-            if (0 !=
-                (ret = daos_tx_open(dset->obj.item.file->coh, &int_req->th, DAOS_TF_RDONLY, NULL /*event*/)))
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't start transaction");
-            int_req->th_open = TRUE;
-#endif /* H5_DAOS_USE_TRANSACTIONS */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_load_task
+ *
+ * Purpose:     Asynchronous task to load the chunk index of a dataset
+ *              being opened.  Attaches to the index shared by other open
+ *              handles of the dataset, if any.  Unless that index is
+ *              already complete, starts listing the index entries in the
+ *              file.  The task completes once the listing is done.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_index_load_task(tse_task_t *task)
+{
+    H5_daos_chunk_index_load_ud_t *udata     = NULL;
+    tse_task_t                    *list_task = NULL;
+    void                          *key_buf;
+    int                            ret;
+    int                            ret_value = 0;
 
-            /* Call main routine */
-            if (H5_daos_dataset_refresh(dset, dxpl_id, int_req, &first_task, &dep_task) < 0)
-                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "failed to refresh dataset");
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk index load task");
 
-            break;
-        } /* end block */
+    assert(task == udata->load_task);
 
-        default:
-            D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported dataset specific operation");
-    } /* end switch */
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    /* Only chunked datasets have a chunk index */
+    if (udata->dset->dcpl_cache.layout != H5D_CHUNKED)
+        D_GOTO_DONE(0);
+
+    /* Attach to the shared chunk index */
+    if (H5_daos_chunk_index_share(udata->dset) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't share chunk index");
+    if (udata->dset->chunk_index->complete)
+        D_GOTO_DONE(0);
+
+    if ((udata->ndims = H5Sget_simple_extent_ndims(udata->dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get number of dimensions");
+
+    /* Set up dkey and key buffer */
+    daos_const_iov_set((d_const_iov_t *)&udata->dkey, H5_daos_chunk_index_key_g,
+                       H5_daos_chunk_index_key_size_g);
+    if (NULL == (key_buf = DV_malloc(H5_DAOS_ITER_SIZE_INIT)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for akeys");
+    daos_iov_set(&udata->sg_iov, key_buf, (daos_size_t)H5_DAOS_ITER_SIZE_INIT);
+    udata->sgl.sg_nr   = 1;
+    udata->sgl.sg_iovs = &udata->sg_iov;
+
+    /* Create and schedule task to list the chunk index entries */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_LIST_AKEY, 0, NULL, H5_daos_chunk_index_list_prep_cb,
+                                 H5_daos_chunk_index_list_comp_cb, udata, &list_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to list chunk index entries");
+    if (0 != (ret = tse_task_schedule(list_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task to list chunk index entries: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* The list task now owns udata and will complete this task */
+    udata = NULL;
 
 done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
+    /* Finish here if the listing was not started */
+    if (udata) {
+        /* Complete the list task if it was created but could not be
+         * scheduled */
+        if (list_task) {
+            (void)tse_task_set_priv(list_task, NULL);
+            tse_task_complete(list_task, ret_value);
+        } /* end if */
 
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
+        ret_value = H5_daos_chunk_index_load_finish(udata, ret_value);
+    } /* end if */
+    else if (ret_value == -H5_DAOS_DAOS_GET_ERROR) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end if */
 
-        /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item,
-                                specific_args->op_type == H5VL_DATASET_SET_EXTENT ||
-                                        specific_args->op_type == H5VL_DATASET_FLUSH
-                                    ? H5_DAOS_OP_TYPE_WRITE_ORDERED
-                                    : H5_DAOS_OP_TYPE_READ,
-                                H5_DAOS_OP_SCOPE_OBJ, must_coll_req, !req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_load_task() */
 
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_index_list_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_list_akey to
+ *              list the entries of a dataset's chunk index.  Currently
+ *              checks for errors from previous tasks then sets arguments
+ *              for daos_obj_list_akey.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_index_list_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_index_load_ud_t *udata;
+    daos_obj_list_akey_t          *list_args;
+    int                            ret_value = 0;
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk index list task");
 
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL,
-                             "dataset specific operation failed in task \"%s\": %s", int_req->failed_task,
-                             H5_daos_err_to_string(int_req->status));
+    assert(udata->req);
+    assert(udata->dset);
 
-            /* Close internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* else */
-    }     /* end if */
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
 
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_specific() */
+    /* Reset nr */
+    udata->nr = H5_DAOS_ITER_LEN;
+
+    /* Set list task arguments */
+    if (NULL == (list_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for chunk index list task");
+    memset(list_args, 0, sizeof(*list_args));
+    list_args->oh          = udata->dset->obj.obj_oh;
+    list_args->th          = DAOS_TX_NONE;
+    list_args->dkey        = &udata->dkey;
+    list_args->nr          = &udata->nr;
+    list_args->kds         = udata->kds;
+    list_args->sgl         = &udata->sgl;
+    list_args->type        = DAOS_IOD_NONE;
+    list_args->akey_anchor = &udata->anchor;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_list_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_close_real
+ * Function:    H5_daos_chunk_index_list_comp_cb
  *
- * Purpose:     Internal version of H5_daos_dataset_close().
+ * Purpose:     Complete callback for asynchronous daos_obj_list_akey to
+ *              list the entries of a dataset's chunk index.  Adds the
+ *              listed chunks to the index and repeats the listing until
+ *              all entries have been read.  The index is marked complete
+ *              if the listing found the marker written when the dataset
+ *              was created.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              October, 2020
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_close_real(H5_daos_dset_t *dset)
+static int
+H5_daos_chunk_index_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    size_t i;
-    int    ret;
-    herr_t ret_value = SUCCEED;
+    H5_daos_chunk_index_load_ud_t *udata;
+    hbool_t                        reinit = FALSE;
+    int                            ret;
+    int                            ret_value = 0;
 
-    if (!dset)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
-    if (H5I_DATASET != dset->obj.item.type)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+    assert(H5_daos_task_list_g);
 
-    if (--dset->obj.item.rc == 0) {
-        /* Free dataset data structures */
-        if (dset->obj.item.cur_op_pool)
-            H5_daos_op_pool_free(dset->obj.item.cur_op_pool);
-        if (dset->obj.item.open_req)
-            if (H5_daos_req_free_int(dset->obj.item.open_req) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
-        if (!daos_handle_is_inval(dset->obj.obj_oh))
-            if (0 != (ret = daos_obj_close(dset->obj.obj_oh, NULL /*event*/)))
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, FAIL, "can't close dataset DAOS object: %s",
-                             H5_daos_err_to_string(ret));
-        if (dset->type_id != H5I_INVALID_HID && H5Idec_ref(dset->type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dataset's datatype");
-        if (dset->file_type_id != H5I_INVALID_HID && H5Idec_ref(dset->file_type_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dataset's file datatype");
-        if (dset->space_id != H5I_INVALID_HID && H5Idec_ref(dset->space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dataset's dataspace");
-        if (dset->dcpl_id != H5I_INVALID_HID && dset->dcpl_id != H5P_DATASET_CREATE_DEFAULT)
-            if (H5Idec_ref(dset->dcpl_id) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dcpl");
-        if (dset->dapl_id != H5I_INVALID_HID && dset->dapl_id != H5P_DATASET_ACCESS_DEFAULT)
-            if (H5Idec_ref(dset->dapl_id) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTDEC, FAIL, "failed to close dapl");
-        if (dset->fill_val)
-            dset->fill_val = DV_free(dset->fill_val);
-        /* Clear dataset I/O cache */
-        if ((dset->io_cache.file_sel_iter_id > 0) && (H5Ssel_iter_close(dset->io_cache.file_sel_iter_id) < 0))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to close selection iterator");
-        if ((dset->io_cache.mem_sel_iter_id > 0) && (H5Ssel_iter_close(dset->io_cache.mem_sel_iter_id) < 0))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTRELEASE, FAIL, "unable to close selection iterator");
-        if (dset->io_cache.chunk_info && (dset->io_cache.chunk_info != &dset->io_cache.single_chunk_info)) {
-            H5_daos_select_chunk_info_t *chunk_info;
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk index list task");
 
-            for (i = 0; i < dset->io_cache.chunk_info_nalloc; i++) {
-                chunk_info = &dset->io_cache.chunk_info[i];
-                if ((chunk_info->fspace_id >= 0) && (H5Sclose(chunk_info->fspace_id) < 0))
-                    D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk file dataspace");
-                if ((chunk_info->mspace_id >= 0) && (H5Sclose(chunk_info->mspace_id) < 0))
-                    D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL, "can't close chunk memory dataspace");
-            }
+    assert(udata->dset->chunk_index);
 
-            DV_free(dset->io_cache.chunk_info);
-        }
-        dset = H5FL_FREE(H5_daos_dset_t, dset);
+    /* Check for buffer not large enough */
+    if (task->dt_result == -DER_KEY2BIG) {
+        size_t key_buf_len;
+        void  *tmp_realloc;
+
+        /* Allocate larger buffer */
+        key_buf_len = udata->sg_iov.iov_buf_len * 2;
+        if (NULL == (tmp_realloc = DV_realloc(udata->sg_iov.iov_buf, key_buf_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate key buffer");
+
+        /* Update SGL */
+        daos_iov_set(&udata->sg_iov, tmp_realloc, (daos_size_t)key_buf_len);
+        udata->sgl.sg_nr_out = 0;
+
+        reinit = TRUE;
+    } /* end if */
+    else if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        /* Handle errors in list task.  Only record error in udata->req_status
+         * if it does not already contain an error (it could contain an error
+         * if another task this task is not dependent on also failed). */
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "chunk index list";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        size_t         akey_len = (size_t)udata->ndims * sizeof(uint64_t);
+        uint64_t       chunk_coords[H5S_MAX_RANK];
+        const uint8_t *p;
+        const uint8_t *q;
+        uint32_t       i;
+        int            j;
+
+        /* Loop over returned akeys */
+        p = (const uint8_t *)udata->sg_iov.iov_buf;
+        for (i = 0; i < udata->nr; i++) {
+            if (udata->kds[i].kd_key_len == akey_len) {
+                q = p;
+                for (j = 0; j < udata->ndims; j++)
+                    UINT64DECODE(q, chunk_coords[j]);
+                if (H5_daos_chunk_index_insert(udata->dset->chunk_index, chunk_coords, udata->ndims) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, -H5_DAOS_SETUP_ERROR,
+                                 "can't add chunk to chunk index");
+            } /* end if */
+            else if (udata->kds[i].kd_key_len == (daos_size_t)H5_daos_chunk_index_valid_key_size_g &&
+                     !memcmp(p, H5_daos_chunk_index_valid_key_g, H5_daos_chunk_index_valid_key_size_g))
+                udata->valid = TRUE;
+
+            /* Advance to next akey */
+            p += udata->kds[i].kd_key_len;
+        } /* end for */
+
+        /* If there are more akeys, repeat the akey list operation, otherwise
+         * the index is complete if the marker was found */
+        if (!daos_anchor_is_eof(&udata->anchor))
+            reinit = TRUE;
+        else if (udata->valid)
+            udata->dset->chunk_index->complete = TRUE;
+    } /* end if */
+
+    /* Re-initialize the list task if necessary */
+    if (reinit) {
+        /* Re-register callback functions for re-initialized akey list task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_chunk_index_list_prep_cb, NULL, 0,
+                                              H5_daos_chunk_index_list_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to list chunk index entries: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to list chunk index entries: %s",
+                         H5_daos_err_to_string(ret));
     } /* end if */
 
 done:
+    /* Finish loading if the list task was not re-initialized */
+    if (!reinit || ret_value < 0) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        if (udata)
+            ret_value = H5_daos_chunk_index_load_finish(udata, ret_value);
+    } /* end if */
+
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_close_real() */
+} /* end H5_daos_chunk_index_list_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_close
+ * Function:    H5_daos_chunk_index_load_finish
  *
- * Purpose:     Closes a DAOS HDF5 dataset.
+ * Purpose:     Completes the task to load a dataset's chunk index and
+ *              frees its user data.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              November, 2016
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_close(void *_dset, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
+static int
+H5_daos_chunk_index_load_finish(H5_daos_chunk_index_load_ud_t *load_ud, int ret)
 {
-    H5_daos_dset_t              *dset       = (H5_daos_dset_t *)_dset;
-    H5_daos_obj_close_task_ud_t *task_ud    = NULL;
-    tse_task_t                  *first_task = NULL;
-    tse_task_t                  *dep_task   = NULL;
-    H5_daos_req_t               *int_req    = NULL;
-    int                          ret;
-    herr_t                       ret_value = SUCCEED;
+    int ret_value = ret;
 
-    H5_daos_inc_api_cnt();
+    assert(load_ud);
+    assert(load_ud->load_task);
 
-    if (!_dset)
-        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "dataset object is NULL");
+    /* Handle errors in loading.  Only record error in req->status if it does
+     * not already contain an error. */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && load_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        load_ud->req->status      = ret_value;
+        load_ud->req->failed_task = "chunk index load";
+    } /* end if */
 
-    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+    /* Return load task to task list and complete it */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, load_ud->load_task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    tse_task_complete(load_ud->load_task, ret_value);
 
-    /* Check if the dataset's request queue is NULL, if so we can close it
-     * immediately.  Also close if the pool is empty and has no start task (and
-     * hence does not depend on anything).  Also close if it is marked to close
-     * nonblocking. */
-    if (((dset->obj.item.open_req->status == 0 || dset->obj.item.open_req->status < -H5_DAOS_CANCELED) &&
-         (!dset->obj.item.cur_op_pool || (dset->obj.item.cur_op_pool->type == H5_DAOS_OP_TYPE_EMPTY &&
-                                          !dset->obj.item.cur_op_pool->start_task))) ||
-        dset->obj.item.nonblocking_close) {
-        if (H5_daos_dataset_close_real(dset) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataset");
-    } /* end if */
-    else {
-        tse_task_t *close_task = NULL;
+    /* Close dataset */
+    if (H5_daos_dataset_close_real(load_ud->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
 
-        /* Start H5 operation. Currently, the DXPL is only copied when datatype conversion is needed. */
-        if (NULL ==
-            (int_req = H5_daos_req_create(dset->obj.item.file, "dataset close", dset->obj.item.open_req, NULL,
-                                          NULL, H5P_DATASET_XFER_DEFAULT)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(load_ud->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-        /* Allocate argument struct */
-        if (NULL == (task_ud = (H5_daos_obj_close_task_ud_t *)DV_calloc(sizeof(H5_daos_obj_close_task_ud_t))))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                         "can't allocate space for close task udata struct");
-        task_ud->req  = int_req;
-        task_ud->item = &dset->obj.item;
+    /* Free private data */
+    DV_free(load_ud->sg_iov.iov_buf);
+    DV_free(load_ud);
 
-        /* Create task to close dataset */
-        if (H5_daos_create_task(H5_daos_object_close_task, 0, NULL, NULL, NULL, task_ud, &close_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to close dataset");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_index_load_finish() */
 
-        /* Save task to be scheduled later and give it a reference to req and
-         * dset */
-        assert(!first_task);
-        first_task = close_task;
-        dep_task   = close_task;
-        /* No need to take a reference to dset here since the purpose is to
-         * release the API's reference */
-        int_req->rc++;
-        task_ud = NULL;
-    } /* end else */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_action
+ *
+ * Purpose:     Determines what must be done to the chunk with the
+ *              specified coordinates when a dataset shrinks: nothing if
+ *              it lies within the new extent, punching it if it lies
+ *              entirely outside the new extent, or trimming the elements
+ *              outside the new extent if it straddles it in a dimension
+ *              that shrank.
+ *
+ * Return:      The action to take
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_chunk_prune_act_t
+H5_daos_chunk_prune_action(const H5_daos_chunk_prune_ud_t *prune_ud, const uint64_t *coords)
+{
+    const hsize_t            *chunk_dims;
+    H5_daos_chunk_prune_act_t ret_value = H5_DAOS_CHUNK_PRUNE_NONE;
+    int                       i;
 
-done:
-    if (int_req) {
-        /* Create task to finalize H5 operation */
-        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, int_req, &int_req->finalize_task) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
-        /* Schedule finalize task */
-        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
-                         H5_daos_err_to_string(ret));
-        else
-            /* finalize_task now owns a reference to req */
-            int_req->rc++;
+    assert(prune_ud);
+    assert(coords);
 
-        /* If there was an error during setup, pass it to the request */
-        if (ret_value < 0)
-            int_req->status = -H5_DAOS_SETUP_ERROR;
+    chunk_dims = prune_ud->dset->dcpl_cache.chunk_dims;
 
-        /* Add the request to the object's request queue.  This will add the
-         * dependency on the dataset open if necessary. */
-        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item, H5_DAOS_OP_TYPE_CLOSE,
-                                H5_DAOS_OP_SCOPE_OBJ, FALSE, !req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
-        dset = NULL;
+    for (i = 0; i < prune_ud->ndims; i++) {
+        if (coords[i] >= (uint64_t)prune_ud->size[i])
+            return H5_DAOS_CHUNK_PRUNE_PUNCH;
+        if (prune_ud->size[i] < prune_ud->old_size[i] &&
+            coords[i] + (uint64_t)chunk_dims[i] > (uint64_t)prune_ud->size[i])
+            ret_value = H5_DAOS_CHUNK_PRUNE_TRIM;
+    } /* end for */
 
-        /* Check for external async */
-        if (req) {
-            /* Return int_req as req */
-            *req = int_req;
+    return ret_value;
+} /* end H5_daos_chunk_prune_action() */
 
-            /* Kick task engine */
-            if (H5_daos_progress(NULL, H5_DAOS_PROGRESS_KICK) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
-        } /* end if */
-        else {
-            /* Block until operation completes */
-            if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_add
+ *
+ * Purpose:     Adds the chunk with the specified coordinates to the list
+ *              of chunks to punch or trim, if anything must be done to
+ *              it.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_prune_add(H5_daos_chunk_prune_ud_t *prune_ud, const uint64_t *coords)
+{
+    herr_t ret_value = SUCCEED;
 
-            /* Check for failure */
-            if (int_req->status < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "dataset close failed in task \"%s\": %s",
-                             int_req->failed_task, H5_daos_err_to_string(int_req->status));
+    assert(prune_ud);
+    assert(coords);
 
-            /* Release our reference to the internal request */
-            if (H5_daos_req_free_int(int_req) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
-        } /* end else */
-    }     /* end if */
+    if (H5_daos_chunk_prune_action(prune_ud, coords) == H5_DAOS_CHUNK_PRUNE_NONE)
+        D_GOTO_DONE(SUCCEED);
 
-    /* Cleanup on error */
-    if (task_ud) {
-        assert(ret_value < 0);
-        task_ud = DV_free(task_ud);
+    /* Make room for the chunk */
+    if (prune_ud->ncoords == prune_ud->coords_nalloc) {
+        size_t new_nalloc = prune_ud->coords_nalloc ? 2 * prune_ud->coords_nalloc : H5_DAOS_ITER_LEN;
+        void  *tmp_realloc;
+
+        if (NULL ==
+            (tmp_realloc = DV_realloc(prune_ud->coords, new_nalloc * H5S_MAX_RANK * sizeof(uint64_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate list of chunks to prune");
+        prune_ud->coords        = (uint64_t *)tmp_realloc;
+        prune_ud->coords_nalloc = new_nalloc;
     } /* end if */
 
-    D_FUNC_LEAVE_API;
-} /* end H5_daos_dataset_close() */
+    memcpy(&prune_ud->coords[prune_ud->ncoords * H5S_MAX_RANK], coords, H5S_MAX_RANK * sizeof(uint64_t));
+    prune_ud->ncoords++;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_add() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_flush
- *
- * Purpose:     Flushes a DAOS dataset.  Creates a barrier task so all async
- *              ops created before the flush execute before all async ops
- *              created after the flush.
+ * Function:    H5_daos_chunk_prune
+ *
+ * Purpose:     Creates a task to remove the data beyond a dataset's new
+ *              extent, if it shrinks in any dimension.  Chunks that lie
+ *              entirely outside the new extent are punched.  In boundary
+ *              chunks, the elements outside the new extent are punched,
+ *              or for filtered chunks overwritten with the fill value, so
+ *              they do not reappear if the dataset grows again.  The
+ *              chunks are taken from the chunk index if it is complete,
+ *              otherwise they are found by listing the dataset's dkeys.
+ *              At most H5_DAOS_CHUNK_PRUNE_WINDOW chunks are processed at
+ *              once.  Must be called before the chunks outside the new
+ *              extent are removed from the chunk index.
  *
- * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Jordan Henderson
- *              July, 2019
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_flush(H5_daos_dset_t H5VL_DAOS_UNUSED *dset, H5_daos_req_t H5VL_DAOS_UNUSED *req,
-                      tse_task_t **first_task, tse_task_t **dep_task)
+static herr_t
+H5_daos_chunk_prune(H5_daos_dset_t *dset, const hsize_t *size, const hsize_t *old_size, int ndims,
+                    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
-    tse_task_t *barrier_task = NULL;
-    herr_t      ret_value    = SUCCEED;
+    H5_daos_chunk_prune_ud_t *udata = NULL;
+    dv_hash_table_iter_t      iter;
+    hbool_t                   shrink      = FALSE;
+    hsize_t                   chunk_nelem = 1;
+    size_t                    chunk_size;
+    int                       i;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
 
     assert(dset);
+    assert(dset->dcpl_cache.layout == H5D_CHUNKED);
+    assert(size);
+    assert(old_size);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
 
-    /* Create task that does nothing but complete itself.  Only necessary
-     * because we can't enqueue a request that has no tasks */
-    if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &barrier_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create barrier task for dataset flush");
+    /* Nothing to do unless the dataset shrinks */
+    for (i = 0; i < ndims; i++)
+        if (size[i] < old_size[i])
+            shrink = TRUE;
+    if (!shrink)
+        D_GOTO_DONE(SUCCEED);
 
-    /* Schedule barrier task (or save it to be scheduled later)  */
-    assert(!*first_task);
-    *first_task = barrier_task;
-    *dep_task   = barrier_task;
+    /* Allocate task udata */
+    if (NULL == (udata = (H5_daos_chunk_prune_ud_t *)DV_calloc(sizeof(H5_daos_chunk_prune_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk prune user data");
+    udata->req   = req;
+    udata->dset  = dset;
+    udata->ndims = ndims;
+    memcpy(udata->size, size, (size_t)ndims * sizeof(hsize_t));
+    memcpy(udata->old_size, old_size, (size_t)ndims * sizeof(hsize_t));
+
+    /* Filtered chunks are trimmed by merging in the fill value */
+    if (dset->dcpl_cache.nfilters > 0) {
+        for (i = 0; i < ndims; i++)
+            chunk_nelem *= dset->dcpl_cache.chunk_dims[i];
+        chunk_size = (size_t)chunk_nelem * dset->file_type_size;
+        if (NULL == (udata->fill_buf = DV_malloc(chunk_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate fill value buffer");
+        if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+            assert(dset->fill_val);
+            H5_daos_fill_pattern(udata->fill_buf, chunk_size, dset->fill_val, dset->file_type_size);
+        } /* end if */
+        else
+            (void)memset(udata->fill_buf, 0, chunk_size);
+    } /* end if */
+
+    /* Take the chunks from the chunk index if it holds all of them */
+    if (dset->chunk_index && dset->chunk_index->complete) {
+        udata->from_index = TRUE;
+        dv_hash_table_iterate(dset->chunk_index->table, &iter);
+        while (dv_hash_table_iter_has_more(&iter))
+            if (H5_daos_chunk_prune_add(udata, (uint64_t *)dv_hash_table_iter_next(&iter)) < 0)
+                D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add chunk to list of chunks to prune");
+
+        if (udata->ncoords == 0)
+            D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Create task to prune the chunks.  It is completed by
+     * H5_daos_chunk_prune_finish(). */
+    if (H5_daos_create_task(H5_daos_chunk_prune_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
+                            NULL, udata, &udata->prune_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to prune chunks");
+
+    /* Schedule prune task (or save it to be scheduled later) and give it a
+     * reference to req and the dataset */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(udata->prune_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to prune chunks: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = udata->prune_task;
+    req->rc++;
+    dset->obj.item.rc++;
+    *dep_task = udata->prune_task;
+    udata     = NULL;
 
 done:
+    if (udata) {
+        DV_free(udata->coords);
+        DV_free(udata->fill_buf);
+        DV_free(udata);
+    } /* end if */
+
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_flush() */
+} /* end H5_daos_chunk_prune() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_refresh_comp_cb
+ * Function:    H5_daos_chunk_prune_task
  *
- * Purpose:     Complete callback for asynchronous metadata fetch for
- *              dataset refresh operations.
+ * Purpose:     Asynchronous task to remove the data beyond a dataset's
+ *              new extent.  Starts processing the chunks taken from the
+ *              chunk index, or starts listing the dataset's dkeys to find
+ *              them.  The task completes once all chunks are processed.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -5005,1106 +14444,1453 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_dataset_refresh_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_chunk_prune_task(tse_task_t *task)
 {
-    H5_daos_omd_fetch_ud_t *udata;
-    uint8_t                *p;
-    int                     ret;
-    int                     ret_value = 0;
-
-    assert(H5_daos_task_list_g);
+    H5_daos_chunk_prune_ud_t *udata     = NULL;
+    tse_task_t               *list_task = NULL;
+    void                     *key_buf;
+    int                       ret;
+    int                       ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for dataset dataspace read task");
-
-    assert(udata->md_rw_cb_ud.req);
-    assert(udata->fetch_metatask);
-
-    /* Check for buffer not large enough */
-    if (task->dt_result == -DER_REC2BIG) {
-        tse_task_t *fetch_task;
-        size_t      daos_info_len = udata->md_rw_cb_ud.iod[0].iod_size;
-
-        assert(udata->md_rw_cb_ud.req->file);
-        assert(udata->md_rw_cb_ud.obj);
-        assert(udata->md_rw_cb_ud.obj->item.type == H5I_DATASET);
-
-        /* Verify iod size makes sense */
-        if (udata->md_rw_cb_ud.sg_iov[0].iov_buf_len != H5_DAOS_SPACE_BUF_SIZE)
-            D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
-                         "buffer length does not match expected value");
-
-        if (udata->bcast_udata) {
-            /* Reallocate dataspace buffer if necessary */
-            if (daos_info_len > H5_DAOS_SPACE_BUF_SIZE) {
-                udata->bcast_udata->bcast_udata.buffer = DV_free(udata->bcast_udata->bcast_udata.buffer);
-                if (NULL == (udata->bcast_udata->bcast_udata.buffer =
-                                 DV_malloc(daos_info_len + H5_DAOS_ENCODED_UINT64_T_SIZE)))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                                 "can't allocate buffer for serialized dataspace info");
-                udata->bcast_udata->bcast_udata.buffer_len =
-                    (int)daos_info_len + H5_DAOS_ENCODED_UINT64_T_SIZE;
-            } /* end if */
-
-            /* Set starting point for fetch sg_iovs */
-            p = (uint8_t *)udata->bcast_udata->bcast_udata.buffer + H5_DAOS_ENCODED_UINT64_T_SIZE;
-        } /* end if */
-        else {
-            /* Reallocate dataset info buffer if necessary */
-            if (daos_info_len > H5_DAOS_SPACE_BUF_SIZE) {
-                udata->md_rw_cb_ud.sg_iov[0].iov_buf = DV_free(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
-                if (NULL == (udata->md_rw_cb_ud.sg_iov[0].iov_buf = DV_malloc(daos_info_len)))
-                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                                 "can't allocate buffer for serialized dataspace info");
-            } /* end if */
-
-            /* Set starting point for fetch sg_iovs */
-            p = (uint8_t *)udata->md_rw_cb_ud.sg_iov[0].iov_buf;
-        } /* end else */
-
-        /* Set up sgl */
-        daos_iov_set(&udata->md_rw_cb_ud.sg_iov[0], p, udata->md_rw_cb_ud.iod[0].iod_size);
-        udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+                     "can't get private data for chunk prune task");
 
-        /* Create task for reissued dataset dataspace read */
-        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
-                                     H5_daos_dataset_refresh_comp_cb, udata, &fetch_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                         "can't create task to read dataset dataspace");
+    assert(task == udata->prune_task);
 
-        /* Schedule reissued dataset dataspace read task */
-        if (0 != (ret = tse_task_schedule(fetch_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task to read dataset dataspace: %s",
-                         H5_daos_err_to_string(ret));
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
 
-        /* Relinquish control of the object fetch udata to the task's completion callback */
-        udata = NULL;
+    /* Start processing the chunks if they are already known */
+    if (udata->from_index) {
+        ret_value = H5_daos_chunk_prune_issue(udata);
+        udata     = NULL;
+        D_GOTO_DONE(ret_value);
     } /* end if */
-    else {
-        /* Handle errors in fetch task.  Only record error in udata->req_status
-         * if it does not already contain an error (it could contain an error if
-         * another task this task is not dependent on also failed). */
-        if (task->dt_result < -H5_DAOS_PRE_ERROR &&
-            udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->md_rw_cb_ud.req->status      = task->dt_result;
-            udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
-        } /* end if */
-        else if (task->dt_result == 0) {
-            H5_daos_dset_t *dset = (H5_daos_dset_t *)udata->md_rw_cb_ud.obj;
-            hid_t           decoded_space;
-
-            assert(udata->md_rw_cb_ud.req->file);
-            assert(udata->md_rw_cb_ud.obj);
-            assert(udata->md_rw_cb_ud.obj->item.type == H5I_DATASET);
-
-            if (udata->bcast_udata) {
-                /* Encode serialized dataspace length */
-                p = udata->bcast_udata->bcast_udata.buffer;
-                UINT64ENCODE(p, udata->md_rw_cb_ud.iod[0].iod_size)
-                assert(p == udata->md_rw_cb_ud.sg_iov[0].iov_buf);
-            } /* end if */
 
-            /* Decode dataspace */
-            if ((decoded_space = H5Sdecode(udata->md_rw_cb_ud.sg_iov[0].iov_buf)) < 0)
-                D_GOTO_ERROR(H5E_ARGS, H5E_CANTDECODE, -H5_DAOS_H5_DECODE_ERROR,
-                             "can't deserialize dataspace");
+    /* Set up key buffer */
+    if (NULL == (key_buf = DV_malloc(H5_DAOS_ITER_SIZE_INIT)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't allocate buffer for dkeys");
+    daos_iov_set(&udata->sg_iov, key_buf, (daos_size_t)H5_DAOS_ITER_SIZE_INIT);
+    udata->sgl.sg_nr   = 1;
+    udata->sgl.sg_iovs = &udata->sg_iov;
 
-            /* Close dataset's current dataspace ID */
-            if (dset->space_id >= 0 && H5Sclose(dset->space_id) < 0) {
-                H5Sclose(decoded_space);
-                D_GOTO_ERROR(H5E_DATASPACE, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
-                             "can't close dataset's old dataspace");
-            }
+    /* Create and schedule task to list the dataset's dkeys */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_LIST_DKEY, 0, NULL, H5_daos_chunk_prune_list_prep_cb,
+                                 H5_daos_chunk_prune_list_comp_cb, udata, &list_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't create task to list chunks");
+    if (0 != (ret = tse_task_schedule(list_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task to list chunks: %s",
+                     H5_daos_err_to_string(ret));
 
-            dset->space_id = decoded_space;
-        } /* end else */
-    }     /* end else */
+    /* The list task now owns udata */
+    udata = NULL;
 
 done:
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Clean up if this is the last fetch task */
+    /* Finish here if the listing was not started */
     if (udata) {
-        /* Close dataset */
-        if (udata->md_rw_cb_ud.obj &&
-            H5_daos_dataset_close_real((H5_daos_dset_t *)udata->md_rw_cb_ud.obj) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
-
-        if (udata->bcast_udata) {
-            /* Clear broadcast buffer if there was an error */
-            if (udata->md_rw_cb_ud.req->status < -H5_DAOS_INCOMPLETE)
-                (void)memset(udata->bcast_udata->bcast_udata.buffer, 0,
-                             (size_t)udata->bcast_udata->bcast_udata.count);
-        } /* end if */
-        else
-            /* No broadcast, free buffer */
-            DV_free(udata->md_rw_cb_ud.sg_iov[0].iov_buf);
-
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except
-         * for H5_daos_req_free_int, which updates req->status if it sees an
-         * error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            udata->md_rw_cb_ud.req->status      = ret_value;
-            udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+        /* Complete the list task if it was created but could not be
+         * scheduled */
+        if (list_task) {
+            (void)tse_task_set_priv(list_task, NULL);
+            tse_task_complete(list_task, ret_value);
         } /* end if */
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
+        ret_value = H5_daos_chunk_prune_finish(udata, ret_value);
+    } /* end if */
+    else if (ret_value == -H5_DAOS_DAOS_GET_ERROR) {
         /* Return task to task list */
-        if (H5_daos_task_list_put(H5_daos_task_list_g, udata->fetch_metatask) < 0)
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
             D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
                          "can't return task to task list");
-
-        /* Complete fetch metatask */
-        tse_task_complete(udata->fetch_metatask, ret_value);
-
-        assert(!udata->md_rw_cb_ud.free_dkey);
-        assert(!udata->md_rw_cb_ud.free_akeys);
-
-        /* Free udata */
-        DV_free(udata);
+        tse_task_complete(task, ret_value);
     } /* end if */
 
-    return ret_value;
-} /* end H5_daos_dataset_refresh_comp_cb() */
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_task() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_refresh
+ * Function:    H5_daos_chunk_prune_list_prep_cb
  *
- * Purpose:     Refreshes a DAOS dataset (reads the dataspace)
+ * Purpose:     Prepare callback for asynchronous daos_obj_list_dkey to
+ *              find the chunks of a dataset that is shrinking.  Currently
+ *              checks for errors from previous tasks then sets arguments
+ *              for daos_obj_list_dkey.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              July, 2019
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-herr_t
-H5_daos_dataset_refresh(H5_daos_dset_t *dset, hid_t H5VL_DAOS_UNUSED dxpl_id, H5_daos_req_t *req,
-                        tse_task_t **first_task, tse_task_t **dep_task)
+static int
+H5_daos_chunk_prune_list_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_omd_fetch_ud_t *fetch_udata    = NULL;
-    tse_task_t             *fetch_task     = NULL;
-    uint8_t                *space_buf      = NULL;
-    size_t                  space_buf_size = 0;
-    int                     ret;
-    herr_t                  ret_value = SUCCEED;
-
-    assert(dset);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
-
-    /* Set initial size for dataspace buffer */
-    space_buf_size = H5_DAOS_SPACE_BUF_SIZE;
-
-    /* Allocate argument struct for fetch task */
-    if (NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(sizeof(H5_daos_omd_fetch_ud_t))))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for fetch callback arguments");
-
-    /* Set up operation to read dataspace size from dataset */
-
-    /* Setup UD struct */
-    fetch_udata->md_rw_cb_ud.obj = &dset->obj;
-    fetch_udata->md_rw_cb_ud.req = req;
-    fetch_udata->bcast_udata     = NULL;
-
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
-                       H5_daos_int_md_key_size_g);
-    fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
-
-    /* Set up iod */
-    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_space_key_g,
-                       H5_daos_space_key_size_g);
-    fetch_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
-    fetch_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
-    fetch_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
-
-    fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
-
-    /* Allocate initial dataspace buffer */
-    if (NULL == (space_buf = DV_malloc(space_buf_size)))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
-                     "can't allocate buffer for serialized dataspace info");
-
-    /* Set up sgl */
-    daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], space_buf, H5_DAOS_SPACE_BUF_SIZE);
-    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
-    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-    fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
-    fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = TRUE;
-
-    fetch_udata->md_rw_cb_ud.nr = 1u;
+    H5_daos_chunk_prune_ud_t *udata;
+    daos_obj_list_dkey_t     *list_args;
+    int                       ret_value = 0;
 
-    fetch_udata->md_rw_cb_ud.task_name = "dataset refresh (read dataspace)";
-
-    /* Create meta task for dataspace read. This empty task will be
-     * completed when the read is finished by H5_daos_dataset_refresh_comp_cb.
-     * We can't use fetch_task since it may not be completed by the first
-     * fetch. */
-    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &fetch_udata->fetch_metatask) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create meta task for dataset dataspace read");
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk list task");
 
-    /* Create task for dataset dataspace read */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_md_rw_prep_cb, H5_daos_dataset_refresh_comp_cb, fetch_udata,
-                                 &fetch_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read dataset dataspace");
+    assert(udata->req);
+    assert(udata->dset);
 
-    /* Schedule meta task */
-    if (0 != (ret = tse_task_schedule(fetch_udata->fetch_metatask, false)))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                     "can't schedule meta task for dataset dataspace read: %s", H5_daos_err_to_string(ret));
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
 
-    /* Schedule object fetch task (or save it to be scheduled later) and give it
-     * a reference to req */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(fetch_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
-                         "can't schedule task to fetch dataset dataspace: %s", H5_daos_err_to_string(ret));
-    }
-    else
-        *first_task = fetch_task;
-    req->rc++;
-    dset->obj.item.rc++;
-    *dep_task = fetch_udata->fetch_metatask;
+    /* Reset nr */
+    udata->nr = H5_DAOS_ITER_LEN;
 
-    /* Relinquish control of the object fetch udata and dataspace buffer to the
-     * task's completion callback */
-    fetch_udata = NULL;
-    space_buf   = NULL;
+    /* Set list task arguments */
+    if (NULL == (list_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for chunk list task");
+    memset(list_args, 0, sizeof(*list_args));
+    list_args->oh          = udata->dset->obj.obj_oh;
+    list_args->th          = DAOS_TX_NONE;
+    list_args->nr          = &udata->nr;
+    list_args->kds         = udata->kds;
+    list_args->sgl         = &udata->sgl;
+    list_args->dkey_anchor = &udata->anchor;
 
 done:
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        space_buf   = DV_free(space_buf);
-        fetch_udata = DV_free(fetch_udata);
-    }
-
-    assert(!space_buf);
-    assert(!fetch_udata);
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_refresh() */
+} /* end H5_daos_chunk_prune_list_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dset_set_extent_comp_cb
+ * Function:    H5_daos_chunk_prune_list_comp_cb
  *
- * Purpose:     Completion callback for H5Dset_extent.  Like
- *              H5_daos_md_update_comp_cb but also updates the dataset
- *              dataspace.
+ * Purpose:     Complete callback for asynchronous daos_obj_list_dkey to
+ *              find the chunks of a dataset that is shrinking.  Adds the
+ *              listed chunks that must be punched or trimmed to the list
+ *              and repeats the listing until all dkeys have been read,
+ *              then starts processing the chunks.
  *
  * Return:      Success:        0
- *              Failure:        -1
- *
- * Programmer:  Neil Fortner
- *              November, 2020
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-static herr_t
-H5_daos_dset_set_extent_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+static int
+H5_daos_chunk_prune_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_dset_set_extent_ud_t *udata;
-    unsigned                      i;
-    int                           ret_value = 0;
+    H5_daos_chunk_prune_ud_t *udata;
+    hbool_t                   reinit = FALSE;
+    int                       ret;
+    int                       ret_value = 0;
 
     assert(H5_daos_task_list_g);
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for metadata I/O task");
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk list task");
 
-    /* Clear cached new space ID on dataset */
-    if (((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->cur_set_extent_space_id == udata->new_space_id)
-        ((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->cur_set_extent_space_id = H5I_INVALID_HID;
+    /* Check for buffer not large enough */
+    if (task->dt_result == -DER_KEY2BIG) {
+        size_t key_buf_len;
+        void  *tmp_realloc;
 
-    /* Handle errors in update task.  Only record error in udata->req_status if
-     * it does not already contain an error (it could contain an error if
-     * another task this task is not dependent on also failed). */
-    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status      = task->dt_result;
-        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
-    } /* end if */
-    else if (task->dt_result == 0) {
-        /* Close old space ID */
-        if (H5Sclose(((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataspace");
+        /* Allocate larger buffer */
+        key_buf_len = udata->sg_iov.iov_buf_len * 2;
+        if (NULL == (tmp_realloc = DV_realloc(udata->sg_iov.iov_buf, key_buf_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate key buffer");
 
-        /* Set new dataspace in dataset struct */
-        ((H5_daos_dset_t *)udata->md_rw_cb_ud.obj)->space_id = udata->new_space_id;
-        udata->new_space_id                                  = H5I_INVALID_HID;
+        /* Update SGL */
+        daos_iov_set(&udata->sg_iov, tmp_realloc, (daos_size_t)key_buf_len);
+        udata->sgl.sg_nr_out = 0;
+
+        reinit = TRUE;
     } /* end if */
+    else if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        /* Handle errors in list task.  Only record error in udata->req_status
+         * if it does not already contain an error (it could contain an error
+         * if another task this task is not dependent on also failed). */
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "chunk list";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        size_t         dkey_len = 1 + ((size_t)udata->ndims * sizeof(uint64_t));
+        uint64_t       chunk_coords[H5S_MAX_RANK];
+        const uint8_t *p;
+        const uint8_t *q;
+        uint32_t       i;
+        int            j;
+
+        /* Loop over returned dkeys, picking out the chunks (dkeys holding
+         * the chunk coordinates after a leading '\0') */
+        memset(chunk_coords, 0, sizeof(chunk_coords));
+        p = (const uint8_t *)udata->sg_iov.iov_buf;
+        for (i = 0; i < udata->nr; i++) {
+            if (udata->kds[i].kd_key_len == dkey_len && *p == (uint8_t)'\0') {
+                q = p + 1;
+                for (j = 0; j < udata->ndims; j++)
+                    UINT64DECODE(q, chunk_coords[j]);
+                if (H5_daos_chunk_prune_add(udata, chunk_coords) < 0)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                                 "can't add chunk to list of chunks to prune");
+            } /* end if */
 
-    /* Close object */
-    if (udata->md_rw_cb_ud.obj && H5_daos_object_close(&udata->md_rw_cb_ud.obj->item) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
+            /* Advance to next dkey */
+            p += udata->kds[i].kd_key_len;
+        } /* end for */
 
-    /* Close new dataspace on error */
-    if (udata->new_space_id >= 0) {
-        assert(ret_value < 0 || task->dt_result < -H5_DAOS_PRE_ERROR);
-        if (H5Sclose(udata->new_space_id) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataspace");
+        /* If there are more dkeys, repeat the dkey list operation */
+        if (!daos_anchor_is_eof(&udata->anchor))
+            reinit = TRUE;
     } /* end if */
 
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    /* Re-initialize the list task if necessary */
+    if (reinit) {
+        /* Re-register callback functions for re-initialized dkey list task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_chunk_prune_list_prep_cb, NULL, 0,
+                                              H5_daos_chunk_prune_list_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to list chunks: %s", H5_daos_err_to_string(ret));
 
-    /* Handle errors in this function */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        udata->md_rw_cb_ud.req->status      = ret_value;
-        udata->md_rw_cb_ud.req->failed_task = udata->md_rw_cb_ud.task_name;
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to list chunks: %s", H5_daos_err_to_string(ret));
     } /* end if */
 
-    /* Release our reference to req */
-    if (H5_daos_req_free_int(udata->md_rw_cb_ud.req) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+done:
+    /* Start processing the chunks if the list task was not re-initialized */
+    if (!reinit || ret_value < 0) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
 
-    /* Free private data */
-    if (udata->md_rw_cb_ud.free_dkey)
-        DV_free(udata->md_rw_cb_ud.dkey.iov_buf);
-    if (udata->md_rw_cb_ud.free_akeys)
-        for (i = 0; i < udata->md_rw_cb_ud.nr; i++)
-            DV_free(udata->md_rw_cb_ud.iod[i].iod_name.iov_buf);
-    for (i = 0; i < udata->md_rw_cb_ud.nr; i++)
-        if (udata->md_rw_cb_ud.free_sg_iov[i])
-            DV_free(udata->md_rw_cb_ud.sg_iov[i].iov_buf);
-    DV_free(udata);
+        if (udata) {
+            /* Record errors so no chunks are processed */
+            if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+                udata->req->status      = ret_value;
+                udata->req->failed_task = "chunk list completion callback";
+            } /* end if */
+
+            ret_value = H5_daos_chunk_prune_issue(udata);
+        } /* end if */
+    }     /* end if */
 
-done:
     D_FUNC_LEAVE;
-} /* end H5_daos_dset_set_extent_comp_cb() */
+} /* end H5_daos_chunk_prune_list_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_dataset_set_extent
+ * Function:    H5_daos_chunk_prune_trim_recxs
  *
- * Purpose:     Changes the extent of a dataset
- *
- * Return:      Success:        0
- *              Failure:        -1
+ * Purpose:     Builds the list of runs of elements in a boundary chunk
+ *              that lie outside a dataset's new extent, in row-major
+ *              order within the chunk.  The list must be freed by the
+ *              caller.
  *
- * Programmer:  Neil Fortner
- *              July, 2019
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_dataset_set_extent(H5_daos_dset_t *dset, const hsize_t *size, hbool_t collective, H5_daos_req_t *req,
-                           tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_chunk_prune_trim_recxs(const H5_daos_chunk_prune_ud_t *prune_ud, const uint64_t *coords,
+                               daos_recx_t **recxs, unsigned *nrecxs, uint64_t *nelem)
 {
-    H5_daos_dset_set_extent_ud_t *update_cb_ud = NULL;
-    tse_task_t                   *update_task  = NULL;
-    hsize_t                       maxdims[H5S_MAX_RANK];
-    int                           ndims;
-    void                         *space_buf = NULL;
-    int                           i;
-    int                           ret;
-    herr_t                        ret_value = SUCCEED;
+    const hsize_t *chunk_dims;
+    daos_recx_t   *buf = NULL;
+    uint64_t       lim[H5S_MAX_RANK];
+    uint64_t       idx[H5S_MAX_RANK];
+    uint64_t       nrows = 1;
+    uint64_t       row_len;
+    uint64_t       row;
+    uint64_t       start;
+    size_t         nalloc = 0;
+    unsigned       n      = 0;
+    int            last;
+    int            i;
+    herr_t         ret_value = SUCCEED;
+
+    assert(prune_ud);
+    assert(coords);
+    assert(recxs);
+    assert(nrecxs);
+    assert(nelem);
+
+    chunk_dims = prune_ud->dset->dcpl_cache.chunk_dims;
+    last       = prune_ud->ndims - 1;
+    *nelem     = 0;
+
+    /* Find the number of elements of the chunk inside the new extent in each
+     * dimension */
+    for (i = 0; i <= last; i++) {
+        assert(coords[i] < (uint64_t)prune_ud->size[i]);
+        lim[i] = MIN((uint64_t)chunk_dims[i], (uint64_t)prune_ud->size[i] - coords[i]);
+        if (i < last)
+            nrows *= (uint64_t)chunk_dims[i];
+    } /* end for */
+    row_len = (uint64_t)chunk_dims[last];
+
+    /* Walk the rows of the chunk.  A row is outside the extent entirely if
+     * it is outside in any dimension but the last, otherwise only its tail
+     * past the extent in the last dimension is. */
+    memset(idx, 0, sizeof(idx));
+    for (row = 0; row < nrows; row++) {
+        start = lim[last];
+        for (i = 0; i < last; i++)
+            if (idx[i] >= lim[i]) {
+                start = 0;
+                break;
+            } /* end if */
 
-    assert(dset);
-    assert(size);
-    assert(req);
-    assert(first_task);
-    assert(dep_task);
+        if (start < row_len) {
+            /* Extend the previous run or add a new one */
+            if (n > 0 && buf[n - 1].rx_idx + buf[n - 1].rx_nr == (row * row_len) + start)
+                buf[n - 1].rx_nr += row_len - start;
+            else {
+                if ((size_t)n == nalloc) {
+                    void *tmp_realloc;
 
-    /* Check for write access */
-    if (!(dset->obj.item.file->flags & H5F_ACC_RDWR))
-        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+                    nalloc = nalloc ? 2 * nalloc : H5_DAOS_SEQ_LIST_LEN;
+                    if (NULL == (tmp_realloc = DV_realloc(buf, nalloc * sizeof(daos_recx_t))))
+                        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate recx list");
+                    buf = (daos_recx_t *)tmp_realloc;
+                } /* end if */
+                buf[n].rx_idx = (row * row_len) + start;
+                buf[n].rx_nr  = row_len - start;
+                n++;
+            } /* end else */
+            *nelem += row_len - start;
+        } /* end if */
 
-    /* Get dataspace rank */
-    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get current dataspace rank");
+        /* Advance to the next row */
+        for (i = last - 1; i >= 0; i--) {
+            if (++idx[i] < (uint64_t)chunk_dims[i])
+                break;
+            idx[i] = 0;
+        } /* end for */
+    }     /* end for */
 
-    /* Get dataspace max dims */
-    if (H5Sget_simple_extent_dims(dset->space_id, NULL, maxdims) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get current dataspace maximum dimensions");
+    assert(n > 0);
+    *recxs  = buf;
+    *nrecxs = n;
+    buf     = NULL;
 
-    /* Make sure max dims aren't exceeded */
-    for (i = 0; i < ndims; i++)
-        if ((maxdims[i] != H5S_UNLIMITED) && (size[i] > maxdims[i]))
-            D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL,
-                         "requested dataset dimensions exceed maximum dimensions");
+done:
+    DV_free(buf);
 
-    /* Allocate task udata */
-    if (NULL ==
-        (update_cb_ud = (H5_daos_dset_set_extent_ud_t *)DV_calloc(sizeof(H5_daos_dset_set_extent_ud_t))))
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                     "can't allocate space for dataset set extent udata struct");
-    update_cb_ud->md_rw_cb_ud.req       = req;
-    update_cb_ud->md_rw_cb_ud.obj       = &dset->obj;
-    update_cb_ud->md_rw_cb_ud.task_name = "dataset set extent";
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_trim_recxs() */
 
-    /* Copy dataset dataspace */
-    if ((update_cb_ud->new_space_id = H5Scopy(dset->space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataspace");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_start
+ *
+ * Purpose:     Starts punching or trimming the chunk with the specified
+ *              coordinates.  Unfiltered chunks are punched with a single
+ *              DAOS operation.  The elements outside the extent in a
+ *              filtered chunk are overwritten with the fill value through
+ *              the usual fetch and update of a filtered chunk, followed
+ *              by a task to report that it is done.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_chunk_prune_start(H5_daos_chunk_prune_ud_t *prune_ud, const uint64_t *coords)
+{
+    H5_daos_dset_t           *dset        = prune_ud->dset;
+    H5_daos_chunk_prune_op_t *op          = NULL;
+    H5_daos_chunk_io_ud_t    *chunk_io_ud = NULL;
+    H5_daos_chunk_prune_act_t act;
+    tse_task_t               *fetch_task  = NULL;
+    tse_task_t               *update_task = NULL;
+    tse_task_t               *done_task   = NULL;
+    daos_recx_t              *recxs       = NULL;
+    unsigned                  nrecxs      = 0;
+    uint64_t                  nelem       = 0;
+    hsize_t                   chunk_nelem = 1;
+    uint8_t                  *p;
+    int                       i;
+    int                       ret;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(prune_ud);
+    assert(coords);
+
+    act = H5_daos_chunk_prune_action(prune_ud, coords);
+    assert(act != H5_DAOS_CHUNK_PRUNE_NONE);
+
+    /* Find the elements to trim */
+    if (act == H5_DAOS_CHUNK_PRUNE_TRIM &&
+        H5_daos_chunk_prune_trim_recxs(prune_ud, coords, &recxs, &nrecxs, &nelem) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't find elements to trim");
+
+    if (act == H5_DAOS_CHUNK_PRUNE_PUNCH || dset->dcpl_cache.nfilters == 0) {
+        /* Allocate operation */
+        if (NULL == (op = (H5_daos_chunk_prune_op_t *)DV_calloc(sizeof(H5_daos_chunk_prune_op_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk prune operation");
+        op->prune_ud = prune_ud;
+        op->punch    = act == H5_DAOS_CHUNK_PRUNE_PUNCH;
+
+        /* Encode dkey (chunk coordinates) */
+        p    = op->dkey_buf;
+        *p++ = (uint8_t)'\0';
+        for (i = 0; i < prune_ud->ndims; i++)
+            UINT64ENCODE(p, coords[i]);
+        daos_iov_set(&op->dkey, op->dkey_buf,
+                     (daos_size_t)(1 + ((size_t)prune_ud->ndims * sizeof(uint64_t))));
+
+        /* Set up iod to punch the elements outside the extent.  An update
+         * with a record size of 0 punches the records. */
+        if (!op->punch) {
+            op->akey_buf = H5_DAOS_CHUNK_KEY;
+            daos_iov_set(&op->iod.iod_name, (void *)&op->akey_buf, (daos_size_t)(sizeof(op->akey_buf)));
+            op->iod.iod_nr    = nrecxs;
+            op->iod.iod_recxs = recxs;
+            op->iod.iod_size  = 0;
+            op->iod.iod_type  = DAOS_IOD_ARRAY;
+            recxs             = NULL;
+        } /* end if */
 
-    /* Set extent on new dataspace */
-    if (H5Sset_extent_simple(update_cb_ud->new_space_id, ndims, size, maxdims) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTSET, FAIL, "can't set dataspace dimensions");
+        /* Create and schedule task to punch the chunk */
+        if (H5_daos_create_daos_task(op->punch ? DAOS_OPC_OBJ_PUNCH_DKEYS : DAOS_OPC_OBJ_UPDATE, 0, NULL,
+                                     H5_daos_chunk_prune_op_prep_cb, H5_daos_chunk_prune_op_comp_cb, op,
+                                     &update_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to punch chunk");
+        op = NULL;
+        prune_ud->ninflight++;
+        if (0 != (ret = tse_task_schedule(update_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to punch chunk: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else {
+        /* Allocate argument struct for the filtered chunk I/O */
+        if (NULL == (chunk_io_ud = (H5_daos_chunk_io_ud_t *)DV_calloc(sizeof(H5_daos_chunk_io_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                         "can't allocate buffer for I/O callback arguments");
+        chunk_io_ud->tconv.mem_type_id  = H5I_INVALID_HID;
+        chunk_io_ud->tconv.mem_space_id = H5I_INVALID_HID;
+        chunk_io_ud->dset               = dset;
+        chunk_io_ud->req                = prune_ud->req;
+        chunk_io_ud->filter.io_type     = IO_WRITE;
+
+        /* Encode dkey (chunk coordinates) */
+        p    = chunk_io_ud->dkey_buf;
+        *p++ = (uint8_t)'\0';
+        for (i = 0; i < prune_ud->ndims; i++)
+            UINT64ENCODE(p, coords[i]);
+        daos_iov_set(&chunk_io_ud->dkey, chunk_io_ud->dkey_buf,
+                     (daos_size_t)(1 + ((size_t)prune_ud->ndims * sizeof(uint64_t))));
+
+        /* Merge the fill value into the elements outside the extent */
+        chunk_io_ud->recxs       = recxs;
+        chunk_io_ud->iod.iod_nr  = nrecxs;
+        recxs                    = NULL;
+        chunk_io_ud->sg_iovs     = &chunk_io_ud->sg_iov;
+        daos_iov_set(&chunk_io_ud->sg_iov, prune_ud->fill_buf,
+                     (daos_size_t)nelem * (daos_size_t)dset->file_type_size);
+        chunk_io_ud->sgl.sg_nr   = 1;
+        chunk_io_ud->sgl.sg_iovs = chunk_io_ud->sg_iovs;
+
+        /* Allocate chunk buffer, large enough to hold the largest possible
+         * filtered chunk */
+        for (i = 0; i < prune_ud->ndims; i++)
+            chunk_nelem *= dset->dcpl_cache.chunk_dims[i];
+        chunk_io_ud->filter.chunk_size = (size_t)chunk_nelem * dset->file_type_size;
+        chunk_io_ud->filter.buf_size   = H5_daos_filter_max_size(
+              dset->dcpl_cache.nfilters, dset->dcpl_cache.filters, chunk_io_ud->filter.chunk_size);
+        if (NULL == (chunk_io_ud->filter.buf = DV_malloc(chunk_io_ud->filter.buf_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate chunk buffer");
+
+        /* Set up iod and sgl for the filtered chunk */
+        chunk_io_ud->akey_buf = H5_DAOS_CHUNK_KEY;
+        daos_iov_set(&chunk_io_ud->filter.iod.iod_name, (void *)&chunk_io_ud->akey_buf,
+                     (daos_size_t)(sizeof(chunk_io_ud->akey_buf)));
+        chunk_io_ud->filter.iod.iod_nr   = 1u;
+        chunk_io_ud->filter.iod.iod_size = DAOS_REC_ANY;
+        chunk_io_ud->filter.iod.iod_type = DAOS_IOD_SINGLE;
+        daos_iov_set(&chunk_io_ud->filter.sg_iovs[0], chunk_io_ud->filter.header_buf,
+                     (daos_size_t)H5_DAOS_FILTER_HEADER_SIZE);
+        daos_iov_set(&chunk_io_ud->filter.sg_iovs[1], chunk_io_ud->filter.buf,
+                     (daos_size_t)chunk_io_ud->filter.buf_size);
+        chunk_io_ud->filter.sgl.sg_nr   = 2;
+        chunk_io_ud->filter.sgl.sg_iovs = chunk_io_ud->filter.sg_iovs;
+
+        /* Create tasks to fetch and rewrite the chunk, and to report when it
+         * is done */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_chunk_filter_fetch_prep_cb,
+                                     H5_daos_chunk_filter_fetch_comp_cb, chunk_io_ud, &fetch_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read chunk");
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, &fetch_task, H5_daos_chunk_filter_update_prep_cb,
+                                     H5_daos_chunk_filter_io_comp_cb, chunk_io_ud, &update_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to write chunk");
+        if (H5_daos_create_task(H5_daos_chunk_prune_done_task, 1, &update_task, NULL, NULL, prune_ud,
+                                &done_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finish trimming chunk");
+
+        /* The tasks will be scheduled, give them a reference to req and the
+         * dataset */
+        chunk_io_ud->req->rc++;
+        chunk_io_ud->dset->obj.item.rc++;
+        chunk_io_ud = NULL;
+        prune_ud->ninflight++;
 
-    /* Cache new space id on dataset struct - to be used by H5Dget_space to
-     * avoid needing to wait until this set_extent completes */
-    dset->cur_set_extent_space_id = update_cb_ud->new_space_id;
+        /* Schedule tasks */
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to read chunk: %s",
+                         H5_daos_err_to_string(ret));
+        if (0 != (ret = tse_task_schedule(update_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to write chunk: %s",
+                         H5_daos_err_to_string(ret));
+        if (0 != (ret = tse_task_schedule(done_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finish trimming chunk: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end else */
 
-    /* Write new dataspace to dataset in file if this process should */
-    if (!collective || (dset->obj.item.file->my_rank == 0)) {
-        size_t space_size = 0;
+done:
+    /* Cleanup on failure */
+    if (op) {
+        assert(ret_value < 0);
+        DV_free(op->iod.iod_recxs);
+        DV_free(op);
+    } /* end if */
+    if (chunk_io_ud) {
+        assert(ret_value < 0);
+        DV_free(chunk_io_ud->recxs);
+        DV_free(chunk_io_ud->filter.buf);
+        DV_free(chunk_io_ud);
+    } /* end if */
+    DV_free(recxs);
 
-        /* Encode dataspace */
-        if (H5Sencode2(update_cb_ud->new_space_id, NULL, &space_size, dset->obj.item.file->fapl_id) < 0)
-            D_GOTO_ERROR(H5E_ARGS, H5E_BADTYPE, FAIL, "can't determine serialized length of dataspace");
-        if (NULL == (space_buf = DV_malloc(space_size)))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for serialized dataspace");
-        if (H5Sencode2(update_cb_ud->new_space_id, space_buf, &space_size, dset->obj.item.file->fapl_id) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTENCODE, FAIL, "can't serialize dataspace");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_start() */
 
-        /* Set up operation to write dataspace to dataset */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_issue
+ *
+ * Purpose:     Starts processing chunks from the list of chunks to punch
+ *              or trim until H5_DAOS_CHUNK_PRUNE_WINDOW chunks are in
+ *              flight.  Stops starting new chunks after an error.  Once
+ *              all chunks are done, completes the prune task and frees
+ *              prune_ud.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_prune_issue(H5_daos_chunk_prune_ud_t *prune_ud)
+{
+    int ret_value = 0;
 
-        /* Set up dkey */
-        daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
-                           H5_daos_int_md_key_size_g);
-        update_cb_ud->md_rw_cb_ud.free_dkey = FALSE;
+    assert(prune_ud);
 
-        /* Set up iod */
-        daos_const_iov_set((d_const_iov_t *)&update_cb_ud->md_rw_cb_ud.iod[0].iod_name, H5_daos_space_key_g,
-                           H5_daos_space_key_size_g);
-        update_cb_ud->md_rw_cb_ud.iod[0].iod_nr   = 1u;
-        update_cb_ud->md_rw_cb_ud.iod[0].iod_size = (uint64_t)space_size;
-        update_cb_ud->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+    while (prune_ud->ninflight < H5_DAOS_CHUNK_PRUNE_WINDOW && prune_ud->next < prune_ud->ncoords &&
+           prune_ud->req->status >= -H5_DAOS_INCOMPLETE) {
+        if (H5_daos_chunk_prune_start(prune_ud, &prune_ud->coords[prune_ud->next * H5S_MAX_RANK]) < 0) {
+            /* Record the error so no more chunks are started */
+            if (prune_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+                prune_ud->req->status      = -H5_DAOS_SETUP_ERROR;
+                prune_ud->req->failed_task = "chunk prune";
+            } /* end if */
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't start pruning chunk");
+        } /* end if */
+        prune_ud->next++;
+    } /* end while */
 
-        update_cb_ud->md_rw_cb_ud.free_akeys = FALSE;
+    /* Finish once no chunks are in flight and no more will be started */
+    if (prune_ud->ninflight == 0)
+        ret_value = H5_daos_chunk_prune_finish(prune_ud, ret_value);
 
-        /* Set up sgl */
-        daos_iov_set(&update_cb_ud->md_rw_cb_ud.sg_iov[0], space_buf, (daos_size_t)space_size);
-        update_cb_ud->md_rw_cb_ud.sgl[0].sg_nr     = 1;
-        update_cb_ud->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-        update_cb_ud->md_rw_cb_ud.sgl[0].sg_iovs   = &update_cb_ud->md_rw_cb_ud.sg_iov[0];
-        update_cb_ud->md_rw_cb_ud.free_sg_iov[0]   = TRUE;
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_issue() */
 
-        update_cb_ud->md_rw_cb_ud.nr = 1u;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_op_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_punch_dkeys or
+ *              daos_obj_update to punch a chunk beyond a dataset's new
+ *              extent or the elements of a chunk outside it.  Currently
+ *              checks for errors from previous tasks then sets arguments
+ *              for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_prune_op_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_prune_op_t *op;
+    H5_daos_chunk_prune_ud_t *prune_ud;
+    int                       ret_value = 0;
 
-        /* Create task to write updated dataspace to dataset */
-        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                     H5_daos_md_rw_prep_cb, H5_daos_dset_set_extent_comp_cb, update_cb_ud,
-                                     &update_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to update object");
+    /* Get private data */
+    if (NULL == (op = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk punch task");
+
+    prune_ud = op->prune_ud;
+    assert(prune_ud);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(prune_ud->req);
+
+    /* Set task arguments */
+    if (op->punch) {
+        daos_obj_punch_t *punch_args;
+
+        if (NULL == (punch_args = daos_task_get_args(task)))
+            D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                         "can't get arguments for chunk punch task");
+        memset(punch_args, 0, sizeof(*punch_args));
+        punch_args->oh      = prune_ud->dset->obj.obj_oh;
+        punch_args->th      = prune_ud->req->th;
+        punch_args->dkey    = &op->dkey;
+        punch_args->akeys   = NULL;
+        punch_args->akey_nr = 0;
     } /* end if */
     else {
-        /* Don't need to write dataspace to file, but still need to create a
-         * task to update dset->space_id at the right time */
-        /* Create empty task (comp_cb will update dset->space_id) */
-        if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, H5_daos_dset_set_extent_comp_cb,
-                                update_cb_ud, &update_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to perform get operation");
+        daos_obj_rw_t *update_args;
+
+        if (NULL == (update_args = daos_task_get_args(task)))
+            D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                         "can't get arguments for chunk punch task");
+        memset(update_args, 0, sizeof(*update_args));
+        update_args->oh   = prune_ud->dset->obj.obj_oh;
+        update_args->th   = prune_ud->req->th;
+        update_args->dkey = &op->dkey;
+        update_args->nr   = 1;
+        update_args->iods = &op->iod;
+        update_args->sgls = NULL;
     } /* end else */
 
-    assert(update_task);
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
-    /* Schedule object update task (or save it to be scheduled later) and give it
-     * a reference to req */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(update_task, false)))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to update object: %s",
-                         H5_daos_err_to_string(ret));
-    }
-    else
-        *first_task = update_task;
-    req->rc++;
-    dset->obj.item.rc++;
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_op_prep_cb() */
 
-    /* Relinquish control of the object update udata and dataspace buffer to the
-     * task's completion callback */
-    update_cb_ud = NULL;
-    space_buf    = NULL;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_op_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_punch_dkeys or
+ *              daos_obj_update to punch a chunk beyond a dataset's new
+ *              extent or the elements of a chunk outside it.  Frees the
+ *              operation and starts the next chunk.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_prune_op_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_prune_op_t *op;
+    H5_daos_chunk_prune_ud_t *prune_ud  = NULL;
+    int                       ret_value = 0;
 
-    *dep_task = update_task;
+    assert(H5_daos_task_list_g);
 
-done:
-    if (collective && (dset->obj.item.file->num_procs > 1))
-        if (H5_daos_collective_error_check(&dset->obj, req, first_task, dep_task) < 0)
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't perform collective error check");
+    /* Get private data */
+    if (NULL == (op = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk punch task");
 
-    /* Cleanup on failure */
-    if (ret_value < 0) {
-        space_buf = DV_free(space_buf);
+    prune_ud = op->prune_ud;
+    assert(prune_ud);
 
-        if (update_cb_ud) {
-            if (H5Sclose(update_cb_ud->new_space_id) < 0)
-                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't close dataspace");
-            update_cb_ud = DV_free(update_cb_ud);
-        } /* end if */
-    }     /* end if */
+    /* Handle errors in punch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && prune_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        prune_ud->req->status      = task->dt_result;
+        prune_ud->req->failed_task = "chunk prune";
+    } /* end if */
 
-    assert(!space_buf);
-    assert(!update_cb_ud);
+    /* Free operation */
+    DV_free(op->iod.iod_recxs);
+    DV_free(op);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Start the next chunk */
+    if (prune_ud) {
+        assert(prune_ud->ninflight > 0);
+        prune_ud->ninflight--;
+        ret_value = H5_daos_chunk_prune_issue(prune_ud);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_dataset_set_extent() */
+} /* end H5_daos_chunk_prune_op_comp_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_point_and_block
+ * Function:    H5_daos_chunk_prune_done_task
  *
- * Purpose:     Intersects the point selection in point_space with the
- *              block specified with start and block, and returns a
- *              dataspace with the intersecting points selected.
+ * Purpose:     Asynchronous task run once a filtered chunk has been
+ *              trimmed.  Starts the next chunk.  Errors in trimming the
+ *              chunk were already recorded in the request.
  *
- * Return:      Success: Dataspace with the intersecting points selected
- *              Failure: H5I_INVALID_HID
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
-static hid_t
-H5_daos_point_and_block(hid_t point_space, hsize_t rank, hsize_t *dims, hsize_t *start, hsize_t *block)
+static int
+H5_daos_chunk_prune_done_task(tse_task_t *task)
 {
-    hsize_t       points_in[H5_DAOS_POINT_BUF_LEN];
-    hsize_t       points_out[H5_DAOS_POINT_BUF_LEN];
-    const hsize_t npoints_buf = H5_DAOS_POINT_BUF_LEN / rank;
-    hssize_t      npoints_in_left;
-    hsize_t       npoints_in_done = 0;
-    hsize_t       npoints_in_this_iter;
-    hsize_t       npoints_out = 0;
-    hsize_t       npoints_out_this_iter;
-    hid_t         space_out = H5I_INVALID_HID;
-    hsize_t       i, j;
-    hid_t         ret_value = H5I_INVALID_HID;
+    H5_daos_chunk_prune_ud_t *prune_ud;
+    int                       ret_value = 0;
 
-    /* Get number of points */
-    if ((npoints_in_left = H5Sget_select_elem_npoints(point_space)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, H5I_INVALID_HID, "can't get number of points in selection");
+    /* Get private data */
+    if (NULL == (prune_ud = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for chunk prune task");
 
-    /* Create output space */
-    if ((space_out = H5Screate_simple((int)rank, dims, NULL)) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, H5I_INVALID_HID, "can't create output space");
+    /* Start the next chunk */
+    assert(prune_ud->ninflight > 0);
+    prune_ud->ninflight--;
+    ret_value = H5_daos_chunk_prune_issue(prune_ud);
 
-    /* Loop until we've processed all points */
-    while (npoints_in_left > 0) {
-        /* Calculate number of points to fetch */
-        npoints_in_this_iter =
-            npoints_in_left > (hssize_t)npoints_buf ? npoints_buf : (hsize_t)npoints_in_left;
+done:
+    /* Return task to task list and complete it */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    tse_task_complete(task, ret_value);
 
-        /* Fetch points */
-        if (H5Sget_select_elem_pointlist(point_space, npoints_in_done, npoints_in_this_iter, points_in) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, H5I_INVALID_HID, "can't get points from selection");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_prune_done_task() */
 
-        /* Add intersecting points to points_out */
-        npoints_out_this_iter = 0;
-        for (i = 0; i < npoints_in_this_iter; i++) {
-            for (j = 0; (j < rank) && (points_in[(i * rank) + j] >= start[j]) &&
-                        (points_in[(i * rank) + j] < start[j] + block[j]);
-                 j++)
-                ;
-            if (j == rank) {
-                memcpy(&points_out[npoints_out_this_iter * rank], &points_in[i * rank],
-                       rank * sizeof(points_in[0]));
-                npoints_out_this_iter++;
-            } /* end if */
-        }     /* end for */
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_prune_finish
+ *
+ * Purpose:     Completes the task to remove the data beyond a dataset's
+ *              new extent and frees its user data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_prune_finish(H5_daos_chunk_prune_ud_t *prune_ud, int ret)
+{
+    int ret_value = ret;
 
-        /* Select elements in points_out */
-        if (npoints_out_this_iter &&
-            H5Sselect_elements(space_out, npoints_out ? H5S_SELECT_APPEND : H5S_SELECT_SET,
-                               (size_t)npoints_out_this_iter, points_out) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, H5I_INVALID_HID, "can't select points");
+    assert(prune_ud);
+    assert(prune_ud->prune_task);
+    assert(prune_ud->ninflight == 0);
 
-        /* Advance points */
-        assert(npoints_in_left >= (hssize_t)npoints_in_this_iter);
-        npoints_in_left -= (hssize_t)npoints_in_this_iter;
-        npoints_in_done += npoints_in_this_iter;
-        npoints_out += npoints_out_this_iter;
-    } /* end while */
+    /* Handle errors in pruning.  Only record error in req->status if it does
+     * not already contain an error. */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && prune_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        prune_ud->req->status      = ret_value;
+        prune_ud->req->failed_task = "chunk prune";
+    } /* end if */
 
-    /* Set return value */
-    ret_value = space_out;
+    /* Return prune task to task list and complete it */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, prune_ud->prune_task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+    tse_task_complete(prune_ud->prune_task, ret_value);
 
-done:
-    /* Cleanup on failure */
-    if (ret_value < 0)
-        if (space_out >= 0 && H5Sclose(space_out) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCLOSEOBJ, H5I_INVALID_HID, "can't close dataspace");
+    /* Close dataset */
+    if (H5_daos_dataset_close_real(prune_ud->dset) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close dataset");
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(prune_ud->req) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free private data */
+    DV_free(prune_ud->sg_iov.iov_buf);
+    DV_free(prune_ud->coords);
+    DV_free(prune_ud->fill_buf);
+    DV_free(prune_ud);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_point_and_block() */
+} /* end H5_daos_chunk_prune_finish() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_get_selected_chunk_info
- *
- * Purpose:     Calculates the starting coordinates for the chunks selected
- *              in the file space given by file_space_id and sets up
- *              individual memory and file spaces for each chunk. Selected
- *              chunk's coordinates and dataspaces are returned through the
- *              `chunk_info` struct pointer.
- *
- *              In order to support caching of all of the file and memory
- *              dataspaces that get created for selected chunks, valid
- *              `chunk_info`/`chunk_info_len` pointers that have been
- *              allocated/set by this routine may be passed in. In this
- *              case, the existing dataspaces will be re-used for dataspace
- *              operations rather than creating new ones. Note that this
- *              assumes that the `chunk_info`/`chunk_info_len` pointers
- *              passed in always come from the same dataset object with the
- *              same chunk dimensionality.
- *
- *              NOTE: In several places in this routine, an adjustment is
- *                    calculated in order to move the selection within a
- *                    chunk around by using H5Sselect_adjust. Since this
- *                    API routine accepts an array of signed values, this
- *                    adjustment is calculated by converting unsigned
- *                    coordinates to signed coordinates without a check
- *                    for overflow. In the future, it would be nice if
- *                    HDF5 could support subtracting and adding of
- *                    offsets to selections with routines that accept
- *                    arrays of unsigned offsets so this can be done
- *                    safely.
- *
- *              XXX: Note that performance could be increased by
- *                   calculating all of the chunks in the entire dataset
- *                   and then caching them in the dataset object for
- *                   re-use in subsequent reads/writes
+ * Function:    H5_daos_dataset_get_storage_size
  *
- * Return:      Success: 0
- *              Failure: -1
+ * Purpose:     Retrieves the amount of storage allocated for a dataset.
+ *              For a chunked dataset with a complete chunk index this is
+ *              the size of the allocated chunks, otherwise it is the
+ *              in-memory size of the whole dataset.  For filtered
+ *              chunks this is their unfiltered size, which
+ *              H5_daos_dataset_get_task replaces with their stored size.
  *
- * Programmer:  Neil Fortner
- *              May, 2018
- *              Based on H5VL_daosm_get_selected_chunk_info by Jordan
- *              Henderson, May, 2017
+ * Return:      Non-negative on success/Negative on failure
  *
  *-------------------------------------------------------------------------
  */
 static herr_t
-H5_daos_get_selected_chunk_info(H5_daos_dcpl_cache_t *dcpl_cache, hid_t file_space_id, hid_t mem_space_id,
-                                H5_daos_select_chunk_info_t **chunk_info, size_t *chunk_info_len,
-                                size_t *nchunks_selected)
+H5_daos_dataset_get_storage_size(H5_daos_dset_t *dset, hsize_t *storage_size)
 {
-    H5_daos_select_chunk_info_t *_chunk_info = NULL;
-    H5S_sel_type                 file_space_type;
-    hssize_t                     num_sel_points;
-    hssize_t                     chunk_file_space_adjust[H5O_LAYOUT_NDIMS];
-    hsize_t                      file_space_dims[H5S_MAX_RANK], mem_space_dims[H5S_MAX_RANK];
-    hsize_t                     *chunk_dims;
-    hsize_t                      curr_chunk_dims[H5S_MAX_RANK] = {0};
-    hsize_t                      file_sel_start[H5S_MAX_RANK], file_sel_end[H5S_MAX_RANK];
-    hsize_t                      mem_sel_start[H5S_MAX_RANK], mem_sel_end[H5S_MAX_RANK];
-    hsize_t                      start_coords[H5O_LAYOUT_NDIMS], end_coords[H5O_LAYOUT_NDIMS];
-    hsize_t                      selection_start_coords[H5O_LAYOUT_NDIMS] = {0};
-    hbool_t                      is_partial_edge_chunk                    = FALSE;
-    hbool_t                      file_mem_space_same                      = (file_space_id == mem_space_id);
-    htri_t                       space_same_shape                         = FALSE;
-    size_t                       chunk_info_nalloc                        = 0;
-    ssize_t                      i                                        = -1, j;
-    hid_t                        entire_chunk_sel_space_id                = H5I_INVALID_HID;
-    int                          fspace_ndims, mspace_ndims;
-    int                          increment_dim;
-    herr_t                       ret_value = SUCCEED;
+    hssize_t nelements  = 0;
+    size_t   dtype_size = 0;
+    int      ndims;
+    int      i;
+    herr_t   ret_value = SUCCEED;
 
-    assert(dcpl_cache);
-    assert(chunk_info);
-    assert(nchunks_selected);
+    assert(dset);
+    assert(storage_size);
 
-    if ((num_sel_points = H5Sget_select_npoints(file_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
-                     "can't get number of points selected in file dataspace");
-    if (num_sel_points == 0)
-        D_GOTO_DONE(SUCCEED);
+    *storage_size = 0;
 
-    /* Allocate selected chunk info buffer or use already-allocated buffer */
-    if (!*chunk_info) {
-        if (NULL == (_chunk_info = (H5_daos_select_chunk_info_t *)DV_calloc(H5_DAOS_DEFAULT_NUM_SEL_CHUNKS *
-                                                                            sizeof(*_chunk_info))))
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                         "can't allocate space for selected chunk info buffer");
-        chunk_info_nalloc = H5_DAOS_DEFAULT_NUM_SEL_CHUNKS;
+    if (H5I_INVALID_HID == dset->space_id || H5I_INVALID_HID == dset->type_id)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, FAIL, "can't get dataset's dataspace or datatype");
+    if (0 == (dtype_size = H5Tget_size(dset->type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get dataset's type size");
 
-        /* Ensure that every chunk info structure's dataspaces are initialized */
-        for (i = 0; i < (ssize_t)chunk_info_nalloc; i++)
-            _chunk_info[i].fspace_id = _chunk_info[i].mspace_id = H5I_INVALID_HID;
+    if (dset->dcpl_cache.layout == H5D_CHUNKED && dset->chunk_index && dset->chunk_index->complete) {
+        /* Return the in-memory size of the allocated chunks */
+        if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dimensions");
+        *storage_size = (hsize_t)dv_hash_table_num_entries(dset->chunk_index->table) * dtype_size;
+        for (i = 0; i < ndims; i++)
+            *storage_size *= dset->dcpl_cache.chunk_dims[i];
     } /* end if */
     else {
-        assert(chunk_info_len && (*chunk_info_len > 0));
-        _chunk_info       = *chunk_info;
-        chunk_info_nalloc = *chunk_info_len;
+        /* Return the in-memory size of the data */
+        if ((nelements = H5Sget_simple_extent_npoints(dset->space_id)) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
+                         "can't get number of elements in dataset's dataspace");
+        *storage_size = (hsize_t)nelements * dtype_size;
     } /* end else */
 
-    /* Get dataspace ranks */
-    if ((fspace_ndims = H5Sget_simple_extent_ndims(file_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file space dimensionality");
-    if (file_mem_space_same)
-        mspace_ndims = fspace_ndims;
-    else if ((mspace_ndims = H5Sget_simple_extent_ndims(mem_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory space dimensionality");
-
-    /* Get dataspace dimensionality */
-    if (H5Sget_simple_extent_dims(file_space_id, file_space_dims, NULL) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file dataspace dimensions");
-    if (file_mem_space_same)
-        memcpy(mem_space_dims, file_space_dims, (size_t)fspace_ndims * sizeof(hsize_t));
-    else if (H5Sget_simple_extent_dims(mem_space_id, mem_space_dims, NULL) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get memory dataspace dimensions");
-
-    /* Get the bounding box for the current selection in the file and memory spaces */
-    if (H5Sget_select_bounds(file_space_id, file_sel_start, file_sel_end) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get bounding box for file selection");
-    if (file_mem_space_same) {
-        memcpy(mem_sel_start, file_sel_start, (size_t)fspace_ndims * sizeof(hsize_t));
-        memcpy(mem_sel_end, file_sel_end, (size_t)fspace_ndims * sizeof(hsize_t));
-    } /* end if */
-    else if (H5Sget_select_bounds(mem_space_id, mem_sel_start, mem_sel_end) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get bounding box for memory selection");
-
-    /* Set convenience pointer to chunk dimensions */
-    chunk_dims = dcpl_cache->chunk_dims;
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_get_storage_size() */
 
-    /* Initialize the curr_chunk_dims array */
-    memcpy(curr_chunk_dims, chunk_dims, (size_t)fspace_ndims * sizeof(hsize_t));
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_direct_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch or
+ *              daos_obj_update for direct I/O on a chunk.  Currently
+ *              checks for errors from previous tasks then sets arguments
+ *              for the DAOS operation.  If the sgl is empty, only the
+ *              size of the chunk record is fetched.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_direct_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_direct_ud_t *udata;
+    daos_obj_rw_t             *rw_args;
+    int                        ret_value = 0;
 
-    /* Calculate the coordinates for the initial chunk */
-    for (i = 0; i < (ssize_t)fspace_ndims; i++) {
-        start_coords[i] = selection_start_coords[i] = (file_sel_start[i] / chunk_dims[i]) * chunk_dims[i];
-        end_coords[i]                               = (start_coords[i] + chunk_dims[i]) - 1;
-    } /* end for */
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for direct chunk I/O task");
 
-    /* Check if the spaces are the same "shape".  For now, reject spaces that
-     * have different ranks, until there's a public interface to
-     * H5S_select_construct_projection().  See the note in H5D__read().  With
-     * the use of H5Sselect_project_intersection() the performance penalty
-     * should be much less than with the native library anyways. */
-    if (fspace_ndims == mspace_ndims) {
-        if (file_mem_space_same)
-            space_same_shape = TRUE;
-        else if (FAIL == (space_same_shape = H5Sselect_shape_same(file_space_id, mem_space_id)))
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
-                         "can't determine if file and memory dataspaces are the same shape");
-    } /* end if */
+    assert(udata->req);
 
-    if (space_same_shape) {
-        /* Calculate the adjustment for the memory selection from the file selection */
-        for (i = 0; i < (ssize_t)fspace_ndims; i++) {
-            /* H5_CHECK_OVERFLOW(file_sel_start[i], hsize_t, hssize_t); */
-            /* H5_CHECK_OVERFLOW(mem_sel_start[i], hsize_t, hssize_t); */
-            chunk_file_space_adjust[i] = (hssize_t)file_sel_start[i] - (hssize_t)mem_sel_start[i];
-        } /* end for */
-    }     /* end if */
-    else {
-        /* Create temporary dataspace to hold selection of entire chunk */
-        if ((entire_chunk_sel_space_id = H5Screate_simple(fspace_ndims, file_space_dims, NULL)) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't create entire chunk selection dataspace");
-    } /* end else */
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_IO);
 
-    /* Get file selection type */
-    if ((file_space_type = H5Sget_select_type(file_space_id)) < 0)
-        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get file selection type");
+    assert(udata->dset);
 
-    /* Iterate through each "chunk" in the dataset */
-    for (i = -1;;) {
-        htri_t intersect = FALSE;
+    /* Set I/O task arguments */
+    if (NULL == (rw_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for direct chunk I/O task");
+    memset(rw_args, 0, sizeof(*rw_args));
+    rw_args->oh   = udata->dset->obj.obj_oh;
+    rw_args->th   = udata->req->th;
+    rw_args->dkey = &udata->dkey;
+    rw_args->nr   = 1;
+    rw_args->iods = &udata->iod;
+    rw_args->sgls = udata->sgl.sg_nr > 0 ? &udata->sgl : NULL;
 
-        /* Check for intersection of file selection and "chunk". If there is
-         * an intersection, set up a valid memory and file space for the chunk. */
-        if (file_space_type == H5S_SEL_ALL)
-            intersect = TRUE;
-        else if ((intersect = H5Sselect_intersect_block(file_space_id, start_coords, end_coords)) < 0)
-            D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
-                         "cannot determine chunk's intersection with the file dataspace");
-        if (TRUE == intersect) {
-            hssize_t chunk_space_adjust[H5O_LAYOUT_NDIMS];
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
-            /* Advance index and re-allocate selected chunk info buffer if necessary */
-            if (++i == (ssize_t)chunk_info_nalloc) {
-                void *tmp_realloc;
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_direct_prep_cb() */
 
-                if (NULL ==
-                    (tmp_realloc = DV_realloc(_chunk_info, 2 * chunk_info_nalloc * sizeof(*_chunk_info))))
-                    D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL,
-                                 "can't reallocate space for selected chunk info buffer");
-                _chunk_info = (H5_daos_select_chunk_info_t *)tmp_realloc;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_chunk_direct_comp_cb
+ *
+ * Purpose:     Complete callback for the asynchronous DAOS operations
+ *              for direct I/O on a chunk.  After the size of the chunk
+ *              record is fetched, either returns the chunk's storage size
+ *              or sets up the sgl to fetch the record into the
+ *              application's buffer.  After a filtered chunk is fetched,
+ *              returns its filter mask.  Frees private data once the last
+ *              task is done.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_chunk_direct_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_chunk_direct_ud_t *udata;
+    H5_daos_dset_t            *dset;
+    uint64_t                   filter_mask;
+    hbool_t                    filtered;
+    uint8_t                   *p;
+    int                        ret_value = 0;
 
-                /* Ensure newly-allocated chunk info structures are initialized */
-                memset(&_chunk_info[chunk_info_nalloc], 0, chunk_info_nalloc * sizeof(*_chunk_info));
-                for (j = (ssize_t)chunk_info_nalloc; j < (ssize_t)chunk_info_nalloc * 2; j++)
-                    _chunk_info[j].fspace_id = _chunk_info[j].mspace_id = H5I_INVALID_HID;
+    assert(H5_daos_task_list_g);
 
-                chunk_info_nalloc *= 2;
-            } /* end while */
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for direct chunk I/O task");
 
-            assert(i < (ssize_t)chunk_info_nalloc);
+    assert(udata->req);
+    assert(udata->dset);
+    assert(udata->ntasks > 0);
 
-            /*
-             * Set up the file Dataspace for this chunk.
-             */
+    dset     = udata->dset;
+    filtered = dset->dcpl_cache.nfilters > 0;
 
-            /* If this is a partial edge chunk, setup the partial edge chunk dimensions.
-             * These will be used to adjust the selection within the edge chunk so that
-             * it falls within the dataset's dataspace boundaries. Also setup a selection
-             * adjustment that can be used to move the selection within the chunk back to
-             * the correct offset within the chunk, if necessary (for point and hyperslab
-             * selections).
-             */
-            for (j = 0; j < (ssize_t)fspace_ndims; j++) {
-                if (start_coords[j] + chunk_dims[j] > file_space_dims[j]) {
-                    curr_chunk_dims[j]    = file_space_dims[j] - start_coords[j];
-                    is_partial_edge_chunk = TRUE;
+    /* Handle errors in I/O task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = task->dt_result;
+        udata->req->failed_task = "direct chunk I/O";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        if (udata->sgl.sg_nr == 0) {
+            /* The size of the chunk record is now known */
+            if (udata->iod.iod_size == 0) {
+                if (!udata->storage_size)
+                    D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_BAD_VALUE, "chunk is not allocated");
+                *udata->storage_size = 0;
+            } /* end if */
+            else if (filtered && udata->iod.iod_size < H5_DAOS_FILTER_HEADER_SIZE)
+                D_GOTO_ERROR(H5E_DATASET, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "filtered chunk is too small");
+            else if (udata->storage_size)
+                *udata->storage_size = filtered
+                                           ? (hsize_t)udata->iod.iod_size - H5_DAOS_FILTER_HEADER_SIZE
+                                           : (hsize_t)udata->chunk_size;
+            else if (filtered) {
+                /* Fetch the header, then the filtered data directly into the
+                 * application's buffer */
+                daos_iov_set(&udata->sg_iovs[0], udata->header_buf, (daos_size_t)H5_DAOS_FILTER_HEADER_SIZE);
+                daos_iov_set(&udata->sg_iovs[1], udata->buf,
+                             udata->iod.iod_size - (daos_size_t)H5_DAOS_FILTER_HEADER_SIZE);
+                udata->sgl.sg_nr = 2;
+            } /* end if */
+            else {
+                /* Elements of the chunk that were never written are not
+                 * touched by the fetch, so initialize them with the fill
+                 * value */
+                if (dset->dcpl_cache.fill_method == H5_DAOS_ZERO_FILL)
+                    (void)memset(udata->buf, 0, udata->chunk_size);
+                else if (dset->dcpl_cache.fill_method == H5_DAOS_COPY_FILL) {
+                    assert(dset->fill_val);
+                    H5_daos_fill_pattern(udata->buf, udata->chunk_size, dset->fill_val, dset->file_type_size);
                 } /* end if */
-                chunk_space_adjust[j] = (hssize_t)start_coords[j];
-            } /* end for */
 
-            switch (file_space_type) {
-                case H5S_SEL_POINTS:
-                    /* Close file space if cached */
-                    if (_chunk_info[i].fspace_id >= 0) {
-                        if (H5Sclose(_chunk_info[i].fspace_id) < 0)
-                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
-                                         "can't close chunk file dataspace");
-                        _chunk_info[i].fspace_id = H5I_INVALID_HID;
-                    } /* end if */
+                udata->iod.iod_size = (daos_size_t)dset->file_type_size;
+                daos_iov_set(&udata->sg_iovs[0], udata->buf, (daos_size_t)udata->chunk_size);
+                udata->sgl.sg_nr = 1;
+            } /* end else */
+        }     /* end if */
+        else if (udata->filters && filtered) {
+            /* Decode the mask of filters that were skipped */
+            p = udata->header_buf;
+            UINT64DECODE(p, filter_mask);
+            *udata->filters = (uint32_t)filter_mask;
+        } /* end if */
+    }     /* end if */
 
-                    /* Intersect points with block using connector routine */
-                    if ((_chunk_info[i].fspace_id =
-                             H5_daos_point_and_block(file_space_id, (hsize_t)fspace_ndims, chunk_dims,
-                                                     start_coords, curr_chunk_dims)) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't intersect point selection");
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-                    /* Move selection back to have correct offset in chunk */
-                    if (H5Sselect_adjust(_chunk_info[i].fspace_id, chunk_space_adjust) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection");
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "direct chunk I/O completion callback";
+        } /* end if */
 
-                    break;
+        /* Clean up once the last task is done */
+        if (--udata->ntasks == 0) {
+            /* Close dataset */
+            if (H5_daos_dataset_close_real(udata->dset) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
-                case H5S_SEL_HYPERSLABS: {
-                    /* Create chunk file dataspace if one isn't cached */
-                    if (_chunk_info[i].fspace_id < 0)
-                        if ((_chunk_info[i].fspace_id = H5Screate_simple(fspace_ndims, chunk_dims, NULL)) < 0)
-                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                         "can't create temporary chunk selection");
+            /* Release our reference to req */
+            if (H5_daos_req_free_int(udata->req) < 0)
+                D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-                    /* Select all elements within this chunk's file dataspace as
-                     * a hyperslab (accounting for partial edge chunks) */
-                    if (H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET, start_coords, NULL,
-                                            curr_chunk_dims, NULL) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                     "can't set selection in chunk file dataspace");
+            /* Free private data */
+            DV_free(udata);
+        } /* end if */
+    }     /* end if */
 
-                    /* Refine chunk file dataspace selection with only elements
-                     * that are also selected in whole file dataspace */
-                    if (H5Smodify_select(_chunk_info[i].fspace_id, H5S_SELECT_AND, file_space_id) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                     "can't refine chunk file dataspace selection");
+    D_FUNC_LEAVE;
+} /* end H5_daos_chunk_direct_comp_cb() */
 
-                    /* Move selection back to have correct offset in chunk */
-                    if (H5Sselect_adjust(_chunk_info[i].fspace_id, chunk_space_adjust) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't adjust chunk selection");
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_chunk_direct
+ *
+ * Purpose:     Performs direct I/O on a single chunk for H5Dread_chunk
+ *              and H5Dwrite_chunk, or gets the size of a chunk for
+ *              H5Dget_chunk_storage_size.  The chunk offset is mapped
+ *              straight to the chunk's dkey and its record is read or
+ *              written as is, without selections, type conversion or the
+ *              filter pipeline.  For a filtered dataset the record holds
+ *              the filter mask and the filtered data, otherwise it holds
+ *              the elements of the full chunk, so chunks written to an
+ *              unfiltered dataset must be the size of a full chunk and
+ *              have no filters skipped.  Reads fetch the size of the
+ *              record first, so the data can be fetched directly into the
+ *              application's buffer.  The operation is always blocking.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_chunk_direct(H5_daos_dset_t *dset, int op_type, H5VL_native_dataset_optional_args_t *args)
+{
+    H5_daos_chunk_direct_ud_t  *udata     = NULL;
+    H5_daos_chunk_direct_ud_t  *direct_ud = NULL;
+    H5_daos_select_chunk_info_t chunk_info;
+    H5_daos_req_t              *int_req    = NULL;
+    tse_task_t                 *first_task = NULL;
+    tse_task_t                 *dep_task   = NULL;
+    tse_task_t                 *io_task    = NULL;
+    tse_task_t                 *index_task = NULL;
+    tse_task_t                 *end_task   = NULL;
+    const hsize_t              *offset;
+    hsize_t                     dims[H5S_MAX_RANK];
+    hsize_t                     chunk_nelem    = 1;
+    uint8_t                    *index_akey_buf = NULL;
+    unsigned                    nnew_chunks    = 0;
+    hbool_t                     filtered;
+    uint8_t                    *p;
+    int                         ndims;
+    int                         i;
+    int                         ret;
+    herr_t                      ret_value = SUCCEED;
 
-                    break;
-                } /* case H5S_SEL_HYPERSLABS */
+    assert(dset);
+    assert(dset->dcpl_cache.layout == H5D_CHUNKED);
+    assert(args);
 
-                case H5S_SEL_ALL: {
-                    hsize_t zero_offset_start[H5S_MAX_RANK] = {0};
+    filtered = dset->dcpl_cache.nfilters > 0;
 
-                    if (_chunk_info[i].fspace_id < 0) {
-                        /* Create chunk dataspace with full chunk dimensions */
-                        if ((_chunk_info[i].fspace_id = H5Screate_simple(fspace_ndims, chunk_dims, NULL)) < 0)
-                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                         "can't create temporary chunk selection");
+    /* Allocate argument struct */
+    if (NULL == (udata = (H5_daos_chunk_direct_ud_t *)DV_calloc(sizeof(H5_daos_chunk_direct_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate direct chunk I/O user data");
+    udata->dset = dset;
+
+    /* Get the operation's arguments */
+    if (op_type == H5VL_NATIVE_DATASET_CHUNK_READ) {
+        offset = args->chunk_read.offset;
+        if (!args->chunk_read.buf)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk buffer not supplied");
+        udata->buf     = args->chunk_read.buf;
+        udata->filters = &args->chunk_read.filters;
+
+        /* Chunks of unfiltered datasets have no filters skipped */
+        args->chunk_read.filters = 0;
+    } /* end if */
+    else if (op_type == H5VL_NATIVE_DATASET_CHUNK_WRITE) {
+        union {
+            const void *const_buf;
+            void       *buf;
+        } safe_buf = {.const_buf = args->chunk_write.buf};
+
+        offset = args->chunk_write.offset;
+        if (!safe_buf.buf)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk buffer not supplied");
+        udata->buf = safe_buf.buf;
+    } /* end if */
+    else {
+        assert(op_type == H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE);
+        offset = args->get_chunk_storage_size.offset;
+        if (!args->get_chunk_storage_size.size)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+        udata->storage_size = args->get_chunk_storage_size.size;
+    } /* end else */
+    if (!offset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk offset not supplied");
+
+    /* Check that the offset is the start of a chunk within the dataset's
+     * extent */
+    if ((ndims = H5Sget_simple_extent_dims(dset->space_id, dims, NULL)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get dataspace dimensions");
+    memset(&chunk_info, 0, sizeof(chunk_info));
+    for (i = 0; i < ndims; i++) {
+        if (offset[i] >= dims[i])
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "chunk offset exceeds dimensions of dataset");
+        if (offset[i] % dset->dcpl_cache.chunk_dims[i])
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk offset is not aligned with chunk boundaries");
+        chunk_info.chunk_coords[i] = (uint64_t)offset[i];
+        chunk_nelem *= dset->dcpl_cache.chunk_dims[i];
+    } /* end for */
+    udata->chunk_size = (size_t)chunk_nelem * dset->file_type_size;
 
-                        /* Trim selection down to partial edge chunk size if necessary */
-                        if (is_partial_edge_chunk &&
-                            H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET, zero_offset_start,
-                                                NULL, curr_chunk_dims, NULL) < 0)
-                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                         "can't select partial edge chunk from temporary selection");
-                    } /* end if */
-                    else {
-                        /* Reset selection for cached chunk file dataspace to current chunk dimensions */
-                        if (H5Sselect_hyperslab(_chunk_info[i].fspace_id, H5S_SELECT_SET, zero_offset_start,
-                                                NULL, curr_chunk_dims, NULL) < 0)
-                            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                         "can't set chunk file dataspace selection");
-                    } /* end else */
+    /* Encode dkey (chunk coordinates), as for regular chunk I/O */
+    p    = udata->dkey_buf;
+    *p++ = (uint8_t)'\0';
+    for (i = 0; i < ndims; i++)
+        UINT64ENCODE(p, chunk_info.chunk_coords[i]);
+    daos_iov_set(&udata->dkey, udata->dkey_buf,
+                 (daos_size_t)(1 + ((size_t)ndims * sizeof(chunk_info.chunk_coords[0]))));
+
+    /* Answer from the chunk index if possible */
+    if (op_type != H5VL_NATIVE_DATASET_CHUNK_WRITE && dset->chunk_index && dset->chunk_index->complete) {
+        if (H5_daos_chunk_index_absent(dset, &udata->dkey)) {
+            if (!udata->storage_size)
+                D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "chunk is not allocated");
+            *udata->storage_size = 0;
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+        if (udata->storage_size && !filtered) {
+            *udata->storage_size = (hsize_t)udata->chunk_size;
+            D_GOTO_DONE(SUCCEED);
+        } /* end if */
+    }     /* end if */
 
-                    break;
-                } /* case H5S_SEL_ALL */
+    /* Set up iod.  The record size is fetched first unless writing. */
+    udata->akey_buf = H5_DAOS_CHUNK_KEY;
+    daos_iov_set(&udata->iod.iod_name, (void *)&udata->akey_buf, (daos_size_t)(sizeof(udata->akey_buf)));
+    udata->iod.iod_nr = 1u;
+    if (filtered)
+        udata->iod.iod_type = DAOS_IOD_SINGLE;
+    else {
+        udata->recx.rx_idx   = (uint64_t)0;
+        udata->recx.rx_nr    = (uint64_t)chunk_nelem;
+        udata->iod.iod_recxs = &udata->recx;
+        udata->iod.iod_type  = DAOS_IOD_ARRAY;
+    } /* end else */
+    udata->sgl.sg_iovs = udata->sg_iovs;
+    if (op_type == H5VL_NATIVE_DATASET_CHUNK_WRITE) {
+        if (filtered) {
+            if (args->chunk_write.size == 0)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk size is 0");
+
+            /* Store the mask of filters that were skipped in the header */
+            p = udata->header_buf;
+            UINT64ENCODE(p, (uint64_t)args->chunk_write.filters);
+            udata->iod.iod_size =
+                (daos_size_t)H5_DAOS_FILTER_HEADER_SIZE + (daos_size_t)args->chunk_write.size;
+            daos_iov_set(&udata->sg_iovs[0], udata->header_buf, (daos_size_t)H5_DAOS_FILTER_HEADER_SIZE);
+            daos_iov_set(&udata->sg_iovs[1], udata->buf, (daos_size_t)args->chunk_write.size);
+            udata->sgl.sg_nr = 2;
+        } /* end if */
+        else {
+            /* Without a filter pipeline the record can only hold a full,
+             * unfiltered chunk */
+            if ((size_t)args->chunk_write.size != udata->chunk_size)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                             "chunk size does not match the size of a chunk of an unfiltered dataset");
+            if (args->chunk_write.filters != 0)
+                D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL,
+                             "can't skip filters for a chunk of an unfiltered dataset");
+            udata->iod.iod_size = (daos_size_t)dset->file_type_size;
+            daos_iov_set(&udata->sg_iovs[0], udata->buf, (daos_size_t)udata->chunk_size);
+            udata->sgl.sg_nr = 1;
+        } /* end else */
+    }     /* end if */
+    else
+        udata->iod.iod_size = DAOS_REC_ANY;
 
-                case H5S_SEL_NONE:
-                case H5S_SEL_ERROR:
-                case H5S_SEL_N:
-                default:
-                    D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL, "invalid dataspace selection type");
-            } /* end switch */
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(dset->obj.item.file, "direct chunk I/O",
+                                              dset->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+    udata->req = int_req;
+
+    /* Direct chunk I/O bypasses the chunk cache, so write back and drop the
+     * cached chunks first */
+    if (dset->chunk_cache.table && H5_daos_chunk_cache_flush(dset, TRUE, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't flush chunk cache");
+
+    /* Add the chunk to the chunk index */
+    if (op_type == H5VL_NATIVE_DATASET_CHUNK_WRITE &&
+        H5_daos_chunk_index_add(dset, &chunk_info, 1, ndims, &index_akey_buf, &nnew_chunks) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINSERT, FAIL, "can't add chunk to chunk index");
+
+    /* Record a newly allocated chunk in the file's chunk index alongside the
+     * chunk I/O */
+    if (nnew_chunks > 0) {
+        if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &end_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create end task for direct chunk I/O");
+
+        /* H5_daos_chunk_index_write() takes ownership of the akey buffer */
+        index_task     = dep_task;
+        ret_value      = H5_daos_chunk_index_write(dset, index_akey_buf, nnew_chunks, ndims, FALSE, FALSE,
+                                                   int_req, &first_task, &index_task);
+        index_akey_buf = NULL;
+        if (ret_value < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write chunk index");
+        if (0 != (ret = tse_task_register_deps(end_task, 1, &index_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk index task: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
 
-            /* Copy the chunk's coordinates to the selected chunk info buffer */
-            memcpy(_chunk_info[i].chunk_coords, start_coords, (size_t)fspace_ndims * sizeof(hsize_t));
+    /* Create task to write the chunk, or to fetch the size of the chunk
+     * record */
+    if (H5_daos_create_daos_task(op_type == H5VL_NATIVE_DATASET_CHUNK_WRITE ? DAOS_OPC_OBJ_UPDATE
+                                                                            : DAOS_OPC_OBJ_FETCH,
+                                 dep_task ? 1 : 0, dep_task ? &dep_task : NULL, H5_daos_chunk_direct_prep_cb,
+                                 H5_daos_chunk_direct_comp_cb, udata, &io_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task for direct chunk I/O");
+
+    /* The task's completion callback now owns the user data.  Give it a
+     * reference to req and the dataset, shared with the fetch task below. */
+    direct_ud         = udata;
+    udata             = NULL;
+    direct_ud->ntasks = 1;
+    int_req->rc++;
+    dset->obj.item.rc++;
 
-            /*
-             * Now set up the memory Dataspace for this chunk.
-             */
-            if (space_same_shape) {
-                if (_chunk_info[i].mspace_id < 0) {
-                    /* Create new memory dataspace */
-                    if ((_chunk_info[i].mspace_id = H5Screate_simple(mspace_ndims, mem_space_dims, NULL)) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL,
-                                     "can't create chunk memory dataspace");
-                } /* end if */
-                else {
-                    htri_t extents_equal;
+    /* Schedule I/O task (or save it to be scheduled later) */
+    if (first_task) {
+        if (0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task for direct chunk I/O: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        first_task = io_task;
+    dep_task = io_task;
+
+    /* Create task to fetch the chunk once its size is known */
+    if (op_type == H5VL_NATIVE_DATASET_CHUNK_READ) {
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, &dep_task, H5_daos_chunk_direct_prep_cb,
+                                     H5_daos_chunk_direct_comp_cb, direct_ud, &io_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to read chunk");
+        direct_ud->ntasks++;
+        if (0 != (ret = tse_task_schedule(io_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to read chunk: %s",
+                         H5_daos_err_to_string(ret));
+        dep_task = io_task;
+    } /* end if */
 
-                    /* Check if the cached chunk's memory dataspace extent is the same
-                     * as the current memory dataspace's extent; resize the cached
-                     * memory dataspace if not.
-                     */
-                    if ((extents_equal = H5Sextent_equal(_chunk_info[i].mspace_id, mem_space_id)) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
-                                     "can't check if memory dataspaces have the same extent");
+    /* Set up dependency on the chunk I/O for the end task */
+    if (end_task) {
+        if (0 != (ret = tse_task_register_deps(end_task, 1, &dep_task)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create dependency on chunk I/O task: %s",
+                         H5_daos_err_to_string(ret));
+        if (0 != (ret = tse_task_schedule(end_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule end task for direct chunk I/O: %s",
+                         H5_daos_err_to_string(ret));
+        dep_task = end_task;
+        end_task = NULL;
+    } /* end if */
 
-                    if (!extents_equal && H5Sset_extent_simple(_chunk_info[i].mspace_id, mspace_ndims,
-                                                               mem_space_dims, NULL) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                     "can't adjust chunk memory dataspace dimensions");
-                } /* end else */
+done:
+    if (int_req) {
+        /* Schedule the end task if it was not scheduled, so it completes with
+         * the error */
+        if (end_task) {
+            if (0 != (ret = tse_task_schedule(end_task, false)))
+                D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL,
+                             "can't schedule end task for direct chunk I/O: %s", H5_daos_err_to_string(ret));
+            else
+                dep_task = end_task;
+        } /* end if */
 
-                if (H5S_SEL_ALL == file_space_type) {
-                    /* Set selection to same shape as chunk's file dataspace selection */
-                    if (H5Sselect_hyperslab(_chunk_info[i].mspace_id, H5S_SELECT_SET, start_coords, NULL,
-                                            curr_chunk_dims, NULL) < 0)
-                        D_GOTO_ERROR(H5E_DATASET, H5E_CANTSELECT, FAIL,
-                                     "can't create chunk memory selection");
-                } /* end if */
-                else {
-                    /* Copy the chunk's file space selection to its memory space selection */
-                    if (H5Sselect_copy(_chunk_info[i].mspace_id, _chunk_info[i].fspace_id) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, FAIL,
-                                     "unable to copy selection from temporary chunk's file dataspace to its "
-                                     "memory dataspace");
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
 
-                    /* Compute the adjustment for the chunk */
-                    for (j = 0; j < (ssize_t)fspace_ndims; j++) {
-                        /* H5_CHECK_OVERFLOW(_chunk_info[i].chunk_coords[j], hsize_t, hssize_t); */
-                        chunk_space_adjust[j] =
-                            chunk_file_space_adjust[j] - (hssize_t)_chunk_info[i].chunk_coords[j];
-                    } /* end for */
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
 
-                    /* Adjust the selection */
-                    if (H5Sselect_adjust(_chunk_info[i].mspace_id, chunk_space_adjust) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL,
-                                     "can't adjust temporary chunk's memory space selection");
-                } /* end else */
-            }     /* end if */
-            else {
-                /* Select this chunk in the temporary chunk selection dataspace.
-                 * Shouldn't matter if it goes beyond the extent since we're not
-                 * doing I/O with this space */
-                if (H5Sselect_hyperslab(entire_chunk_sel_space_id, H5S_SELECT_SET, start_coords, NULL,
-                                        chunk_dims, NULL) < 0)
-                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select entire chunk");
+        /* Add the request to the object's request queue */
+        if (H5_daos_req_enqueue(int_req, first_task, &dset->obj.item,
+                                op_type == H5VL_NATIVE_DATASET_CHUNK_WRITE ? H5_DAOS_OP_TYPE_WRITE
+                                                                           : H5_DAOS_OP_TYPE_READ,
+                                H5_DAOS_OP_SCOPE_OBJ, FALSE, TRUE) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't add request to request queue");
 
-                /* Close memory space if cached */
-                if (_chunk_info[i].mspace_id >= 0) {
-                    if (H5Sclose(_chunk_info[i].mspace_id) < 0)
-                        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
-                                     "can't close chunk memory dataspace");
-                    _chunk_info[i].mspace_id = H5I_INVALID_HID;
-                } /* end if */
+        /* Block until operation completes */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
 
-                /* Calculate memory selection for this chunk by projecting
-                 * intersection of full file selection and file chunk to full
-                 * memory selection */
-                if ((_chunk_info[i].mspace_id = H5Sselect_project_intersection(
-                         file_space_id, mem_space_id, entire_chunk_sel_space_id)) < 0)
-                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTINIT, FAIL, "can't project intersection");
-            } /* end else */
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "direct chunk I/O failed in task \"%s\": %s",
+                         int_req->failed_task, H5_daos_err_to_string(int_req->status));
 
-            /* Determine if there are more chunks to process */
-            if ((_chunk_info[i].num_elem_sel_file = H5Sget_select_npoints(_chunk_info[i].fspace_id)) < 0)
-                D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL,
-                             "can't get number of points selected in chunk file space");
+        /* Release our reference to the internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
 
-            /* Make sure we didn't process too many points */
-            if (_chunk_info[i].num_elem_sel_file > num_sel_points)
-                D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
-                             "processed more elements than present in selection");
+    /* Cleanup on failure, or if there was no I/O to do */
+    DV_free(udata);
+    DV_free(index_akey_buf);
 
-            /* Keep track of the number of elements processed */
-            num_sel_points -= _chunk_info[i].num_elem_sel_file;
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_chunk_direct() */
 
-            /* Break out if we're done */
-            if (num_sel_points == 0)
-                break;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_optional
+ *
+ * Purpose:     Performs an optional operation on a dataset.  Supports
+ *              the native chunk queries (H5Dget_num_chunks,
+ *              H5Dget_chunk_info and H5Dget_chunk_info_by_coord) for
+ *              chunked datasets with a complete chunk index.  Chunks have
+ *              no file address, and their size is the in-memory size of
+ *              a full chunk.  Also supports direct chunk I/O
+ *              (H5Dread_chunk and H5Dwrite_chunk) and
+ *              H5Dget_chunk_storage_size on any chunked dataset.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_dataset_optional(void *_dset, H5VL_optional_args_t *opt_args, hid_t H5VL_DAOS_UNUSED dxpl_id,
+                         void H5VL_DAOS_UNUSED **req)
+{
+    H5_daos_dset_t                      *dset = (H5_daos_dset_t *)_dset;
+    H5VL_native_dataset_optional_args_t *args;
+    H5_daos_chunk_index_t               *idx;
+    const uint64_t                      *coords = NULL;
+    uint64_t                             key[H5S_MAX_RANK];
+    hsize_t                              chunk_size;
+    hsize_t                             *size_out;
+    unsigned                            *filter_mask_out;
+    haddr_t                             *addr_out;
+    size_t                               dtype_size;
+    int                                  ndims;
+    int                                  i;
+    herr_t                               ret_value = SUCCEED;
 
-            /* Clean up after partial edge chunk */
-            if (is_partial_edge_chunk) {
-                memcpy(curr_chunk_dims, chunk_dims, (size_t)fspace_ndims * sizeof(hsize_t));
-                is_partial_edge_chunk = FALSE;
-            } /* end if */
-        }     /* end if */
+    H5_daos_inc_api_cnt();
 
-        /* Set current increment dimension */
-        increment_dim = fspace_ndims - 1;
+    if (!_dset)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "VOL object is NULL");
+    if (!opt_args || !opt_args->args)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "Invalid operation arguments");
+    if (H5I_DATASET != dset->obj.item.type)
+        D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "object is not a dataset");
+    if (opt_args->op_type != H5VL_NATIVE_DATASET_GET_NUM_CHUNKS &&
+        opt_args->op_type != H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_IDX &&
+        opt_args->op_type != H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_COORD &&
+        opt_args->op_type != H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE &&
+        opt_args->op_type != H5VL_NATIVE_DATASET_CHUNK_READ &&
+        opt_args->op_type != H5VL_NATIVE_DATASET_CHUNK_WRITE)
+        D_GOTO_ERROR(H5E_VOL, H5E_UNSUPPORTED, FAIL, "invalid or unsupported optional operation");
+    args = (H5VL_native_dataset_optional_args_t *)opt_args->args;
 
-        /* Increment chunk location in fastest changing dimension */
-        start_coords[increment_dim] += chunk_dims[increment_dim];
-        end_coords[increment_dim] += chunk_dims[increment_dim];
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
 
-        /* Bring chunk location back into bounds, if necessary */
-        if (start_coords[increment_dim] > file_sel_end[increment_dim]) {
-            do {
-                /* Reset current dimension's location to 0 */
-                start_coords[increment_dim] = selection_start_coords[increment_dim];
-                end_coords[increment_dim]   = (start_coords[increment_dim] + chunk_dims[increment_dim]) - 1;
+    /* Wait for the dataset to open if necessary */
+    if (!dset->obj.item.created && dset->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(dset->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (dset->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPENOBJ, FAIL, "dataset open failed");
+    } /* end if */
 
-                /* Decrement current dimension */
-                if (increment_dim == 0)
-                    D_GOTO_ERROR(H5E_DATASPACE, H5E_BADVALUE, FAIL,
-                                 "did not find enough elements to process or error traversing chunks");
-                increment_dim--;
+    if (dset->dcpl_cache.layout != H5D_CHUNKED)
+        D_GOTO_ERROR(H5E_DATASET, H5E_BADTYPE, FAIL, "dataset is not chunked");
 
-                /* Increment chunk location in current dimension */
-                start_coords[increment_dim] += chunk_dims[increment_dim];
-                end_coords[increment_dim] = (start_coords[increment_dim] + chunk_dims[increment_dim]) - 1;
-            } while (start_coords[increment_dim] > file_sel_end[increment_dim]);
-        } /* end if */
-    }     /* end for */
+    /* Direct chunk I/O goes straight to the chunk's record */
+    if (opt_args->op_type == H5VL_NATIVE_DATASET_GET_CHUNK_STORAGE_SIZE ||
+        opt_args->op_type == H5VL_NATIVE_DATASET_CHUNK_READ ||
+        opt_args->op_type == H5VL_NATIVE_DATASET_CHUNK_WRITE) {
+        if (H5_daos_dataset_chunk_direct(dset, opt_args->op_type, args) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTOPERATE, FAIL, "direct chunk operation failed");
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
 
-done:
-    if (ret_value < 0 && _chunk_info) {
-        for (j = 0; j <= i; j++) {
-            if ((_chunk_info[j].fspace_id >= 0) && (H5Sclose(_chunk_info[j].fspace_id) < 0))
-                D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
-                             "failed to close chunk file dataspace ID");
-            if ((_chunk_info[j].mspace_id >= 0) && (H5Sclose(_chunk_info[j].mspace_id) < 0))
-                D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
-                             "failed to close chunk memory dataspace ID");
-        }
+    /* Chunk queries are only answered from a complete chunk index */
+    if (NULL == (idx = dset->chunk_index) || !idx->complete)
+        D_GOTO_ERROR(H5E_DATASET, H5E_UNSUPPORTED, FAIL, "dataset's allocated chunks are not known");
 
-        DV_free(_chunk_info);
-        if (*chunk_info)
-            *chunk_info = NULL;
-        if (chunk_info_len)
-            *chunk_info_len = 0;
-    }
+    if (opt_args->op_type == H5VL_NATIVE_DATASET_GET_NUM_CHUNKS) {
+        /* The selection is ignored, as in the native connector */
+        if (!args->get_num_chunks.nchunks)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "output argument not supplied");
+        *args->get_num_chunks.nchunks = (hsize_t)dv_hash_table_num_entries(idx->table);
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Get the size of a full chunk */
+    if ((ndims = H5Sget_simple_extent_ndims(dset->space_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, FAIL, "can't get number of dimensions");
+    if (0 == (dtype_size = H5Tget_size(dset->type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get dataset's type size");
+    chunk_size = (hsize_t)dtype_size;
+    for (i = 0; i < ndims; i++)
+        chunk_size *= dset->dcpl_cache.chunk_dims[i];
+
+    if (opt_args->op_type == H5VL_NATIVE_DATASET_GET_CHUNK_INFO_BY_IDX) {
+        hsize_t chk_index = args->get_chunk_info_by_idx.chk_index;
+
+        /* Look up the chunk in the sorted list */
+        if (chk_index >= (hsize_t)dv_hash_table_num_entries(idx->table))
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADRANGE, FAIL, "chunk index is out of range");
+        if (H5_daos_chunk_index_sort(idx) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTSORT, FAIL, "can't sort chunk index");
+        coords = &idx->sorted[chk_index * H5S_MAX_RANK];
+
+        if (args->get_chunk_info_by_idx.offset)
+            for (i = 0; i < ndims; i++)
+                args->get_chunk_info_by_idx.offset[i] = (hsize_t)coords[i];
+        filter_mask_out = args->get_chunk_info_by_idx.filter_mask;
+        addr_out        = args->get_chunk_info_by_idx.addr;
+        size_out        = args->get_chunk_info_by_idx.size;
+    } /* end if */
     else {
-        *chunk_info = _chunk_info;
-        if (chunk_info_len)
-            *chunk_info_len = chunk_info_nalloc;
+        const hsize_t *offset = args->get_chunk_info_by_coord.offset;
 
-        assert(i + 1 >= 0);
-        *nchunks_selected = (size_t)(i + 1);
-    }
+        if (!offset)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "chunk offset not supplied");
 
-    if ((entire_chunk_sel_space_id >= 0) && (H5Sclose(entire_chunk_sel_space_id) < 0))
-        D_DONE_ERROR(H5E_DATASPACE, H5E_CANTCLOSEOBJ, FAIL,
-                     "failed to close temporary entire chunk dataspace");
+        /* Look up the chunk in the table */
+        memset(key, 0, sizeof(key));
+        for (i = 0; i < ndims; i++)
+            key[i] = (uint64_t)offset[i];
+        if (DV_HASH_TABLE_NULL == dv_hash_table_lookup(idx->table, key))
+            chunk_size = 0;
+        filter_mask_out = args->get_chunk_info_by_coord.filter_mask;
+        addr_out        = args->get_chunk_info_by_coord.addr;
+        size_out        = args->get_chunk_info_by_coord.size;
+    } /* end else */
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_get_selected_chunk_info() */
+    if (filter_mask_out)
+        *filter_mask_out = 0;
+    if (addr_out)
+        *addr_out = HADDR_UNDEF;
+    if (size_out)
+        *size_out = chunk_size;
+
+done:
+    D_FUNC_LEAVE_API;
+} /* end H5_daos_dataset_optional() */
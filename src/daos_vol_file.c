@@ -55,6 +55,13 @@ typedef struct get_obj_ids_udata_t {
     size_t obj_count;
 } get_obj_ids_udata_t;
 
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Files open in this process, linked through their open_next fields */
+static H5_daos_file_t *H5_daos_open_files_g = NULL;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -843,6 +850,10 @@ H5_daos_file_create(const char *name, unsigned flags, hid_t fcpl_id, hid_t fapl_
     file->fcpl_id       = H5P_FILE_CREATE_DEFAULT;
     file->fapl_id       = H5P_FILE_ACCESS_DEFAULT;
     file->item.rc       = 1;
+
+    /* Add the file to the list of open files */
+    file->open_next      = H5_daos_open_files_g;
+    H5_daos_open_files_g = file;
     file->comm          = MPI_COMM_NULL;
     file->info          = MPI_INFO_NULL;
 
@@ -1578,6 +1589,10 @@ H5_daos_file_open(const char *name, unsigned flags, hid_t fapl_id, hid_t H5VL_DA
     file->root_grp      = NULL;
     file->fapl_id       = H5P_FILE_ACCESS_DEFAULT;
     file->item.rc       = 1;
+
+    /* Add the file to the list of open files */
+    file->open_next      = H5_daos_open_files_g;
+    H5_daos_open_files_g = file;
     file->comm          = MPI_COMM_NULL;
     file->info          = MPI_INFO_NULL;
 
@@ -3416,6 +3431,21 @@ H5_daos_file_close_helper(H5_daos_file_t *file)
 
     /* Decrement rc */
     if (--file->item.rc == 0) {
+        H5_daos_file_t **prev;
+        H5_daos_file_t  *other;
+
+        /* Remove the file from the list of open files */
+        for (prev = &H5_daos_open_files_g; *prev != file; prev = &(*prev)->open_next)
+            assert(*prev);
+        *prev = file->open_next;
+
+        /* Names created through this handle are missing from the name
+         * filters of other handles to the same container, so drop them */
+        if (file->flags & H5F_ACC_RDWR)
+            for (other = H5_daos_open_files_g; other; other = other->open_next)
+                if (!file->cont[0] || !other->cont[0] || !strcmp(file->cont, other->cont))
+                    H5_daos_name_filters_free(other);
+
         /* Free file data structures */
         if (file->item.cur_op_pool)
             H5_daos_op_pool_free(file->item.cur_op_pool);
@@ -3424,6 +3454,22 @@ H5_daos_file_close_helper(H5_daos_file_t *file)
             file->file_name = DV_free(file->file_name);
         if (file->def_plist_cache.plist_buffer)
             file->def_plist_cache.plist_buffer = DV_free(file->def_plist_cache.plist_buffer);
+        if (file->obj_table) {
+            /* Likewise, all groups and datasets have been removed from
+             * the open object table */
+            assert(dv_hash_table_num_entries(file->obj_table) == 0);
+            dv_hash_table_free(file->obj_table);
+        } /* end if */
+        /* Segment writes hold a reference to the file, so none are in
+         * flight */
+        assert(!file->vl_heap.write_task);
+        if (file->vl_heap.buf)
+            file->vl_heap.buf = DV_free(file->vl_heap.buf);
+        if (file->path_cache.ents) {
+            H5_daos_path_cache_invalidate(file);
+            file->path_cache.ents = DV_free(file->path_cache.ents);
+        } /* end if */
+        H5_daos_name_filters_free(file);
         if (H5_daos_comm_info_free(&file->comm, &file->info) < 0)
             D_DONE_ERROR(H5E_INTERNAL, H5E_CANTFREE, FAIL,
                          "failed to free copy of MPI communicator and info");
@@ -3476,6 +3522,59 @@ H5_daos_file_close_helper(H5_daos_file_t *file)
     D_FUNC_LEAVE;
 } /* end H5_daos_file_close_helper() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_file_open_elsewhere
+ *
+ * Purpose:     Checks whether the container of a file is also open
+ *              through another file handle in this process.  A file
+ *              whose container is not known yet matches every other
+ *              file.
+ *
+ * Return:      TRUE if another file handle may use the container,
+ *              FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+hbool_t
+H5_daos_file_open_elsewhere(const H5_daos_file_t *file)
+{
+    const H5_daos_file_t *other;
+
+    assert(file);
+
+    for (other = H5_daos_open_files_g; other; other = other->open_next)
+        if (other != file && (!file->cont[0] || !other->cont[0] || !strcmp(file->cont, other->cont)))
+            return TRUE;
+
+    return FALSE;
+} /* end H5_daos_file_open_elsewhere() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_file_invalidate_path_caches
+ *
+ * Purpose:     Removes all entries from the path caches of a file and of
+ *              the other file handles in this process that may use the
+ *              same container, since a link deleted or moved through one
+ *              handle may be in the cached paths of any of them.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_file_invalidate_path_caches(H5_daos_file_t *file)
+{
+    H5_daos_file_t *other;
+
+    assert(file);
+
+    H5_daos_path_cache_invalidate(file);
+
+    for (other = H5_daos_open_files_g; other; other = other->open_next)
+        if (other != file && (!file->cont[0] || !other->cont[0] || !strcmp(file->cont, other->cont)))
+            H5_daos_path_cache_invalidate(other);
+} /* end H5_daos_file_invalidate_path_caches() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_file_close_barrier_comp_cb
  *
@@ -3581,15 +3680,22 @@ H5_daos_file_close(void *_file, hid_t H5VL_DAOS_UNUSED dxpl_id, void **req)
                                               H5P_DATASET_XFER_DEFAULT)))
         D_GOTO_ERROR(H5E_FILE, H5E_CANTALLOC, FAIL, "can't create DAOS request");
 
+    /* Write out the VL heap before any process closes the file */
+    if (H5_daos_blob_heap_flush(file, int_req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't flush VL heap");
+
     /* Create task for barrier (or just close if there is only one process) */
     if (H5_daos_create_task(file->num_procs > 1 ? H5_daos_mpi_ibarrier_task : H5_daos_metatask_autocomplete,
-                            0, NULL, NULL, H5_daos_file_close_barrier_comp_cb, int_req, &barrier_task) < 0)
+                            1, &dep_task, NULL, H5_daos_file_close_barrier_comp_cb, int_req,
+                            &barrier_task) < 0)
         D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't create MPI barrier task");
 
-    /* Save task to be scheduled later and give it a reference to req */
-    assert(!first_task);
-    first_task = barrier_task;
-    dep_task   = barrier_task;
+    /* Schedule barrier task and give it a reference to req */
+    assert(first_task);
+    if (0 != (ret = tse_task_schedule(barrier_task, false)))
+        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't schedule MPI barrier task: %s",
+                     H5_daos_err_to_string(ret));
+    dep_task = barrier_task;
     /* No need to take a reference to file here since the purpose is to release
      * the API's reference */
     int_req->rc++;
@@ -3650,8 +3756,8 @@ done:
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_file_flush
  *
- * Purpose:     Flushes a DAOS file.  Currently a no-op, may create a
- *              snapshot in the future.
+ * Purpose:     Flushes a DAOS file.  Writes out the sequences buffered
+ *              in the file's VL heap, may create a snapshot in the future.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -3662,23 +3768,16 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_file_flush(H5_daos_file_t H5VL_DAOS_UNUSED *file, H5_daos_req_t H5VL_DAOS_UNUSED *req,
-                   tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_file_flush(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
-    tse_task_t *barrier_task = NULL;
-    herr_t      ret_value    = SUCCEED; /* Return value */
+    herr_t ret_value = SUCCEED; /* Return value */
 
     assert(file);
 
-    /* Create task that does nothing but complete itself.  Only necessary
-     * because we can't enqueue a request that has no tasks */
-    if (H5_daos_create_task(H5_daos_metatask_autocomplete, 0, NULL, NULL, NULL, NULL, &barrier_task) < 0)
-        D_GOTO_ERROR(H5E_FILE, H5E_CANTINIT, FAIL, "can't create barrier task for file flush");
-
-    /* Schedule barrier task (or save it to be scheduled later)  */
-    assert(!*first_task);
-    *first_task = barrier_task;
-    *dep_task   = barrier_task;
+    /* Write out the VL heap.  This always creates tasks, so it also makes
+     * sure we don't enqueue a request that has no tasks. */
+    if (H5_daos_blob_heap_flush(file, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_FILE, H5E_WRITEERROR, FAIL, "can't flush VL heap");
 
 #if 0
     /* Collectively determine if anyone requested a snapshot of the epoch */
@@ -3766,6 +3865,19 @@ H5_daos_fill_fapl_cache(H5_daos_file_t *file, hid_t fapl_id)
                 D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "unknown object class");
     } /* end if */
 
+    /* Grow the type conversion worker pool if more threads were requested on
+     * fapl_id */
+    if ((prop_exists = H5Pexist(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME)) < 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't check for type conversion threads property");
+    if (prop_exists) {
+        unsigned tconv_nthreads;
+
+        if (H5Pget(fapl_id, H5_DAOS_TCONV_NTHREADS_PROP_NAME, &tconv_nthreads) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTGET, FAIL, "can't get type conversion threads property");
+        if (H5_daos_tconv_pool_init((size_t)tconv_nthreads) < 0)
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't start type conversion worker pool");
+    } /* end if */
+
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_fill_fapl_cache() */
@@ -0,0 +1,557 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: The DAOS VOL connector where access is forwarded to the DAOS
+ * library. Chunk filter pipeline routines.
+ */
+
+#include "daos_vol_private.h" /* DAOS connector                          */
+
+#include "util/daos_vol_err.h" /* DAOS connector error handling           */
+#include "util/daos_vol_mem.h" /* DAOS connector memory management        */
+
+#ifdef DV_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+/* Size of the checksum appended by the fletcher32 filter */
+#define H5_DAOS_FLETCHER32_SIZE 4
+
+/* Default compression level for the deflate filter */
+#define H5_DAOS_DEFLATE_LEVEL_DEF 6
+
+static hbool_t  H5_daos_filter_avail(H5Z_filter_t id);
+static uint32_t H5_daos_checksum_fletcher32(const uint8_t *data, size_t len);
+static herr_t   H5_daos_filter_shuffle(hbool_t reverse, size_t type_size, void **buf, size_t *buf_size,
+                                       size_t *nbytes);
+static herr_t   H5_daos_filter_fletcher32(hbool_t reverse, void **buf, size_t *buf_size, size_t *nbytes);
+#ifdef DV_HAVE_ZLIB
+static herr_t H5_daos_filter_deflate(hbool_t reverse, const H5_daos_filter_info_t *filter, void **buf,
+                                     size_t *buf_size, size_t *nbytes);
+#endif
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_avail
+ *
+ * Purpose:     Checks whether the specified filter is implemented by the
+ *              connector's filter pipeline.  Filters other than these
+ *              (including dynamically loaded filter plugins) cannot be
+ *              invoked through HDF5's public API, so they cannot be
+ *              applied to chunks stored by this connector.
+ *
+ * Return:      TRUE if the filter is available, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_filter_avail(H5Z_filter_t id)
+{
+    switch (id) {
+        case H5Z_FILTER_SHUFFLE:
+        case H5Z_FILTER_FLETCHER32:
+            return TRUE;
+
+#ifdef DV_HAVE_ZLIB
+        case H5Z_FILTER_DEFLATE:
+            return TRUE;
+#endif
+
+        default:
+            return FALSE;
+    } /* end switch */
+} /* end H5_daos_filter_avail() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_get_pipeline
+ *
+ * Purpose:     Retrieves the filter pipeline from the provided DCPL.  If
+ *              the pipeline is not empty, *filters is set to a newly
+ *              allocated array of *nfilters filter info structs, which
+ *              must be freed by the caller with DV_free().
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_filter_get_pipeline(hid_t dcpl_id, unsigned *nfilters, H5_daos_filter_info_t **filters)
+{
+    H5_daos_filter_info_t *tmp_filters = NULL;
+    int                    tmp_nfilters;
+    unsigned               i;
+    herr_t                 ret_value = SUCCEED;
+
+    assert(nfilters);
+    assert(filters);
+
+    *nfilters = 0;
+    *filters  = NULL;
+
+    /* The default DCPL has no filters */
+    if (dcpl_id == H5P_DATASET_CREATE_DEFAULT)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Get number of filters */
+    if ((tmp_nfilters = H5Pget_nfilters(dcpl_id)) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get number of filters");
+    if (tmp_nfilters == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate filter info array */
+    if (NULL ==
+        (tmp_filters = (H5_daos_filter_info_t *)DV_calloc((size_t)tmp_nfilters * sizeof(H5_daos_filter_info_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate filter pipeline info");
+
+    /* Retrieve info for each filter */
+    for (i = 0; i < (unsigned)tmp_nfilters; i++) {
+        tmp_filters[i].cd_nelmts = H5_DAOS_FILTER_MAX_CD_VALUES;
+        if ((tmp_filters[i].id = H5Pget_filter2(dcpl_id, i, &tmp_filters[i].flags, &tmp_filters[i].cd_nelmts,
+                                                tmp_filters[i].cd_values, 0, NULL, NULL)) < 0)
+            D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get filter info");
+        tmp_filters[i].cd_nelmts = MIN(tmp_filters[i].cd_nelmts, H5_DAOS_FILTER_MAX_CD_VALUES);
+    } /* end for */
+
+    *nfilters   = (unsigned)tmp_nfilters;
+    *filters    = tmp_filters;
+    tmp_filters = NULL;
+
+done:
+    tmp_filters = DV_free(tmp_filters);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_get_pipeline() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_pipeline_avail
+ *
+ * Purpose:     Checks whether all mandatory filters in the provided
+ *              filter pipeline are available.  Optional filters that are
+ *              not available are skipped when the pipeline is applied.
+ *
+ * Return:      Success:        TRUE if all mandatory filters are
+ *                              available, FALSE otherwise
+ *              Failure:        Can't fail
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5_daos_filter_pipeline_avail(unsigned nfilters, const H5_daos_filter_info_t *filters)
+{
+    unsigned i;
+
+    assert(nfilters == 0 || filters);
+
+    for (i = 0; i < nfilters; i++)
+        if (!(filters[i].flags & H5Z_FLAG_OPTIONAL) && !H5_daos_filter_avail(filters[i].id))
+            return FALSE;
+
+    return TRUE;
+} /* end H5_daos_filter_pipeline_avail() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_max_size
+ *
+ * Purpose:     Calculates an upper bound on the size of a buffer of
+ *              nbytes bytes after it has been passed through the
+ *              provided filter pipeline.
+ *
+ * Return:      Upper bound on the filtered size (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+size_t
+H5_daos_filter_max_size(unsigned nfilters, const H5_daos_filter_info_t *filters, size_t nbytes)
+{
+    unsigned i;
+
+    assert(nfilters == 0 || filters);
+
+    for (i = 0; i < nfilters; i++)
+        switch (filters[i].id) {
+            case H5Z_FILTER_FLETCHER32:
+                nbytes += H5_DAOS_FLETCHER32_SIZE;
+                break;
+
+#ifdef DV_HAVE_ZLIB
+            case H5Z_FILTER_DEFLATE:
+                nbytes = (size_t)compressBound((uLong)nbytes);
+                break;
+#endif
+
+            default:
+                /* Other filters do not change the size, or are skipped */
+                break;
+        } /* end switch */
+
+    return nbytes;
+} /* end H5_daos_filter_max_size() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_apply
+ *
+ * Purpose:     Passes the first *nbytes bytes of *buf through the
+ *              provided filter pipeline, in forward order if reverse is
+ *              FALSE (before writing a chunk) or in reverse order if
+ *              reverse is TRUE (after reading a chunk).  *buf must have
+ *              been allocated with DV_malloc() and have a size of
+ *              *buf_size.  Filters may replace *buf with a new buffer,
+ *              in which case *buf_size is updated.  On return, *nbytes
+ *              is set to the number of valid bytes in *buf.
+ *
+ *              When applying the pipeline in forward order, the bit for
+ *              each filter skipped (because it is optional and not
+ *              available) is set in *filter_mask.  When applying it in
+ *              reverse order, filters whose bits are set in *filter_mask
+ *              are skipped.  type_size is the size of an element of the
+ *              dataset's file datatype, used by the shuffle filter.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_filter_apply(unsigned nfilters, const H5_daos_filter_info_t *filters, size_t type_size,
+                     hbool_t reverse, uint64_t *filter_mask, void **buf, size_t *buf_size, size_t *nbytes)
+{
+    unsigned i;
+    unsigned idx;
+    herr_t   ret_value = SUCCEED;
+
+    assert(nfilters == 0 || filters);
+    assert(filter_mask);
+    assert(buf);
+    assert(*buf);
+    assert(buf_size);
+    assert(nbytes);
+    assert(*nbytes <= *buf_size);
+
+    for (i = 0; i < nfilters; i++) {
+        idx = reverse ? nfilters - i - 1 : i;
+
+        if (reverse) {
+            /* Skip filters that were skipped when the chunk was written */
+            if (*filter_mask & ((uint64_t)1 << idx))
+                continue;
+        } /* end if */
+        else if (!H5_daos_filter_avail(filters[idx].id)) {
+            /* Skip optional filters that are not available */
+            if (!(filters[idx].flags & H5Z_FLAG_OPTIONAL))
+                D_GOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FAIL, "filter %d is not supported",
+                             (int)filters[idx].id);
+            *filter_mask |= (uint64_t)1 << idx;
+            continue;
+        } /* end if */
+
+        switch (filters[idx].id) {
+            case H5Z_FILTER_SHUFFLE:
+                if (H5_daos_filter_shuffle(reverse, type_size, buf, buf_size, nbytes) < 0)
+                    D_GOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "shuffle filter failed");
+                break;
+
+            case H5Z_FILTER_FLETCHER32:
+                if (H5_daos_filter_fletcher32(reverse, buf, buf_size, nbytes) < 0)
+                    D_GOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "fletcher32 filter failed");
+                break;
+
+#ifdef DV_HAVE_ZLIB
+            case H5Z_FILTER_DEFLATE:
+                if (H5_daos_filter_deflate(reverse, &filters[idx], buf, buf_size, nbytes) < 0)
+                    D_GOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "deflate filter failed");
+                break;
+#endif
+
+            default:
+                D_GOTO_ERROR(H5E_PLINE, H5E_UNSUPPORTED, FAIL, "filter %d is not supported",
+                             (int)filters[idx].id);
+        } /* end switch */
+    }     /* end for */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_apply() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_checksum_fletcher32
+ *
+ * Purpose:     Computes the Fletcher32 checksum of a buffer, using the
+ *              same algorithm as HDF5's fletcher32 filter.
+ *
+ * Return:      The checksum (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint32_t
+H5_daos_checksum_fletcher32(const uint8_t *data, size_t len)
+{
+    uint32_t sum1 = 0, sum2 = 0;
+    size_t   tlen;
+
+    assert(data || len == 0);
+
+    /* Process the data two bytes at a time, reducing the sums before they
+     * can overflow */
+    while (len > 1) {
+        tlen = len > 720 ? 360 : len / 2;
+        len -= tlen * 2;
+        do {
+            sum1 += (uint32_t)(((uint16_t)data[0]) << 8) | ((uint16_t)data[1]);
+            data += 2;
+            sum2 += sum1;
+        } while (--tlen);
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end while */
+
+    /* Check for odd # of bytes */
+    if (len) {
+        sum1 += (uint32_t)(((uint16_t)*data) << 8);
+        sum2 += sum1;
+        sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+        sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+    } /* end if */
+
+    /* Second reduction step to reduce sums to 16 bits */
+    sum1 = (sum1 & 0xffff) + (sum1 >> 16);
+    sum2 = (sum2 & 0xffff) + (sum2 >> 16);
+
+    return (sum2 << 16) | sum1;
+} /* end H5_daos_checksum_fletcher32() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_shuffle
+ *
+ * Purpose:     Implements the shuffle filter.  In the forward direction,
+ *              reorders the bytes of each element so that the first
+ *              bytes of all elements are stored together, followed by
+ *              the second bytes, etc.  Reverses this in the reverse
+ *              direction.  Any trailing partial element is left in
+ *              place.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_filter_shuffle(hbool_t reverse, size_t type_size, void **buf, size_t *buf_size, size_t *nbytes)
+{
+    uint8_t *src;
+    uint8_t *dst = NULL;
+    size_t   nelem;
+    size_t   i, j;
+    herr_t   ret_value = SUCCEED;
+
+    assert(buf);
+    assert(buf_size);
+    assert(nbytes);
+
+    /* Nothing to do if there is only one byte per element or less than two
+     * elements */
+    nelem = type_size > 0 ? *nbytes / type_size : 0;
+    if (type_size <= 1 || nelem <= 1)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate destination buffer */
+    if (NULL == (dst = (uint8_t *)DV_malloc(*nbytes)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for shuffle filter");
+
+    src = (uint8_t *)*buf;
+
+    /* (Un)shuffle the bytes */
+    if (reverse) {
+        for (j = 0; j < type_size; j++)
+            for (i = 0; i < nelem; i++)
+                dst[(i * type_size) + j] = src[(j * nelem) + i];
+    } /* end if */
+    else
+        for (j = 0; j < type_size; j++)
+            for (i = 0; i < nelem; i++)
+                dst[(j * nelem) + i] = src[(i * type_size) + j];
+
+    /* Copy any leftover bytes */
+    if (*nbytes > nelem * type_size)
+        (void)memcpy(dst + (nelem * type_size), src + (nelem * type_size), *nbytes - (nelem * type_size));
+
+    /* Swap buffers */
+    DV_free(*buf);
+    *buf      = dst;
+    *buf_size = *nbytes;
+    dst       = NULL;
+
+done:
+    dst = DV_free(dst);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_shuffle() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_fletcher32
+ *
+ * Purpose:     Implements the fletcher32 filter.  In the forward
+ *              direction, appends a checksum of the data to the buffer.
+ *              In the reverse direction, verifies and strips the
+ *              checksum.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_filter_fletcher32(hbool_t reverse, void **buf, size_t *buf_size, size_t *nbytes)
+{
+    uint8_t *p;
+    uint32_t fletcher;
+    uint32_t stored_fletcher;
+    herr_t   ret_value = SUCCEED;
+
+    assert(buf);
+    assert(buf_size);
+    assert(nbytes);
+
+    if (reverse) {
+        if (*nbytes < H5_DAOS_FLETCHER32_SIZE)
+            D_GOTO_ERROR(H5E_PLINE, H5E_BADVALUE, FAIL, "filtered chunk too small to contain checksum");
+
+        /* Compute checksum of data and compare it with stored checksum */
+        *nbytes -= H5_DAOS_FLETCHER32_SIZE;
+        fletcher        = H5_daos_checksum_fletcher32((const uint8_t *)*buf, *nbytes);
+        p               = (uint8_t *)*buf + *nbytes;
+        stored_fletcher = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+                          ((uint32_t)p[3] << 24);
+        if (fletcher != stored_fletcher)
+            D_GOTO_ERROR(H5E_PLINE, H5E_READERROR, FAIL, "data error detected by fletcher32 checksum");
+    } /* end if */
+    else {
+        /* Make sure there is space for the checksum */
+        if (*buf_size < *nbytes + H5_DAOS_FLETCHER32_SIZE) {
+            void *tmp_realloc;
+
+            if (NULL == (tmp_realloc = DV_realloc(*buf, *nbytes + H5_DAOS_FLETCHER32_SIZE)))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate buffer for checksum");
+            *buf      = tmp_realloc;
+            *buf_size = *nbytes + H5_DAOS_FLETCHER32_SIZE;
+        } /* end if */
+
+        /* Compute and append checksum */
+        fletcher = H5_daos_checksum_fletcher32((const uint8_t *)*buf, *nbytes);
+        p        = (uint8_t *)*buf + *nbytes;
+        p[0]     = (uint8_t)(fletcher & 0xff);
+        p[1]     = (uint8_t)((fletcher >> 8) & 0xff);
+        p[2]     = (uint8_t)((fletcher >> 16) & 0xff);
+        p[3]     = (uint8_t)((fletcher >> 24) & 0xff);
+        *nbytes += H5_DAOS_FLETCHER32_SIZE;
+    } /* end else */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_fletcher32() */
+
+#ifdef DV_HAVE_ZLIB
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_filter_deflate
+ *
+ * Purpose:     Implements the deflate (gzip) filter using zlib.  The
+ *              compression level is taken from the filter's first client
+ *              data value.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_filter_deflate(hbool_t reverse, const H5_daos_filter_info_t *filter, void **buf, size_t *buf_size,
+                       size_t *nbytes)
+{
+    void    *dst = NULL;
+    size_t   dst_size;
+    z_stream z_strm;
+    hbool_t  z_strm_init = FALSE;
+    int      status;
+    herr_t   ret_value = SUCCEED;
+
+    assert(filter);
+    assert(buf);
+    assert(buf_size);
+    assert(nbytes);
+
+    if (reverse) {
+        /* Start with a buffer twice the size of the compressed data and grow
+         * it as needed */
+        dst_size = MAX(2 * *nbytes, (size_t)1024);
+        if (NULL == (dst = DV_malloc(dst_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for inflate");
+
+        memset(&z_strm, 0, sizeof(z_strm));
+        z_strm.next_in   = (Bytef *)*buf;
+        z_strm.avail_in  = (uInt)*nbytes;
+        z_strm.next_out  = (Bytef *)dst;
+        z_strm.avail_out = (uInt)dst_size;
+        if (Z_OK != inflateInit(&z_strm))
+            D_GOTO_ERROR(H5E_PLINE, H5E_CANTINIT, FAIL, "inflateInit() failed");
+        z_strm_init = TRUE;
+
+        do {
+            /* Uncompress some data */
+            status = inflate(&z_strm, Z_SYNC_FLUSH);
+
+            if (Z_STREAM_END == status)
+                break;
+            if (Z_OK != status)
+                D_GOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "inflate() failed: %s",
+                             z_strm.msg ? z_strm.msg : "unknown error");
+
+            /* Grow the output buffer if it is full */
+            if (0 == z_strm.avail_out) {
+                void *tmp_realloc;
+
+                if (NULL == (tmp_realloc = DV_realloc(dst, 2 * dst_size)))
+                    D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't reallocate buffer for inflate");
+                dst              = tmp_realloc;
+                z_strm.next_out  = (Bytef *)dst + z_strm.total_out;
+                z_strm.avail_out = (uInt)dst_size;
+                dst_size *= 2;
+            } /* end if */
+        } while (1);
+
+        *nbytes = (size_t)z_strm.total_out;
+    } /* end if */
+    else {
+        uLongf z_dst_nbytes;
+        int    level = filter->cd_nelmts > 0 ? (int)filter->cd_values[0] : H5_DAOS_DEFLATE_LEVEL_DEF;
+
+        /* Allocate buffer large enough for the worst case */
+        dst_size = (size_t)compressBound((uLong)*nbytes);
+        if (NULL == (dst = DV_malloc(dst_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for deflate");
+
+        /* Compress the data */
+        z_dst_nbytes = (uLongf)dst_size;
+        if (Z_OK != (status = compress2((Bytef *)dst, &z_dst_nbytes, (const Bytef *)*buf, (uLong)*nbytes,
+                                        level)))
+            D_GOTO_ERROR(H5E_PLINE, H5E_CANTFILTER, FAIL, "compress2() failed: %d", status);
+
+        *nbytes = (size_t)z_dst_nbytes;
+    } /* end else */
+
+    /* Swap buffers */
+    DV_free(*buf);
+    *buf      = dst;
+    *buf_size = dst_size;
+    dst       = NULL;
+
+done:
+    if (z_strm_init)
+        (void)inflateEnd(&z_strm);
+    dst = DV_free(dst);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_filter_deflate() */
+#endif /* DV_HAVE_ZLIB */
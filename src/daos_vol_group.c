@@ -39,14 +39,49 @@ typedef struct H5_daos_group_gmco_ud_t {
     H5_daos_md_rw_cb_ud_t md_rw_cb_ud;
     uint8_t               max_corder_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint64_t             *max_corder;
+    uint8_t               corder_version_buf;
+    uint8_t              *corder_version;
 } H5_daos_group_gmco_ud_t;
 
+/* Task user data for adding a group resolved during path traversal to the
+ * file's path cache */
+typedef struct H5_daos_path_cache_add_ud_t {
+    H5_daos_req_t   *req;
+    H5_daos_group_t *grp;
+    daos_obj_id_t    start_oid;
+    char            *path;
+    size_t           path_len;
+    uint64_t         gen;
+} H5_daos_path_cache_add_ud_t;
+
+/* Task user data for opening a group through the file's open object table */
+typedef struct H5_daos_group_open_share_ud_t {
+    H5_daos_req_t   *req;
+    H5_daos_group_t *grp;
+} H5_daos_group_open_share_ud_t;
+
 /********************/
 /* Local Prototypes */
 /********************/
 
 static herr_t H5_daos_group_fill_gcpl_cache(H5_daos_group_t *grp);
+static htri_t H5_daos_path_cache_lookup(H5_daos_file_t *file, const daos_obj_id_t *start_oid,
+                                        const char *path, size_t path_len, daos_obj_id_t *oid);
+static herr_t H5_daos_path_cache_insert(H5_daos_file_t *file, const daos_obj_id_t *start_oid, char *path,
+                                        size_t path_len, const daos_obj_id_t *oid);
+static int    H5_daos_path_cache_add_task(tse_task_t *task);
+static herr_t H5_daos_path_cache_add(H5_daos_group_t *grp, const daos_obj_id_t *start_oid, const char *path,
+                                     size_t path_len, H5_daos_req_t *req, tse_task_t **first_task,
+                                     tse_task_t **dep_task);
+static herr_t H5_daos_group_open_handle(H5_daos_file_t *file, H5_daos_group_t *grp, H5_daos_req_t *req,
+                                        tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_group_open_end(H5_daos_group_t *grp, uint8_t *p, uint64_t gcpl_buf_len);
+static herr_t H5_daos_group_open_fetch(H5_daos_group_t *grp, H5_daos_mpi_ibcast_ud_flex_t *bcast_udata,
+                                       H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t H5_daos_group_open_copy(H5_daos_group_t *grp, const H5_daos_group_t *src);
+static int    H5_daos_group_open_share_task(tse_task_t *task);
+static herr_t H5_daos_group_open_share(H5_daos_group_t *grp, H5_daos_req_t *req, tse_task_t **first_task,
+                                       tse_task_t **dep_task);
 static int    H5_daos_group_open_bcast_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_group_open_recv_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_group_get_info_task(tse_task_t *task);
@@ -65,6 +100,13 @@ static int    H5_daos_group_gmco_comp_cb(tse_task_t *task, void *args);
  *              buffer given by path, so it does not need to be freed.
  *              The group must be closed with H5_daos_group_close_real().
  *
+ *              If the OID of the base object is known and the file is
+ *              open on a single process, traversal starts from the
+ *              deepest group in the path found in the file's path cache,
+ *              and the groups it resolves are added to the cache.
+ *              Groups before the final group are only opened far enough
+ *              to read their links, unless they may need to be created.
+ *
  * Return:      Success:        group object.
  *              Failure:        NULL
  *
@@ -128,8 +170,12 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path, hid_t lcpl_id, H5
 
     /* Traverse path if this process should */
     if ((!collective || (item->file->my_rank == 0)) && (*obj_name_len > 0)) {
-        const char *next_obj;
-        unsigned    crt_intermed_grp = 0;
+        const char   *next_obj;
+        const char   *cached_end = NULL;
+        daos_obj_id_t start_oid;
+        daos_obj_id_t cached_oid;
+        hbool_t       use_cache        = FALSE;
+        unsigned      crt_intermed_grp = 0;
 
         /* Make sure obj is a group */
         if (obj->item.type != H5I_GROUP)
@@ -150,12 +196,29 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path, hid_t lcpl_id, H5
         tmp_path_buf[*obj_name_len] = '\0';
         *obj_name                   = tmp_path_buf;
 
+        /* The path cache is keyed on the OID of the starting group, so it
+         * can only be used once the starting group is open.  It is only used
+         * when the file is open on a single process, since links moved or
+         * deleted by other processes would leave stale paths in it.  Find
+         * the deepest group in the path that is in the cache. */
+        if (obj->item.open_req->status == 0 && item->file->num_procs == 1) {
+            use_cache = TRUE;
+            start_oid = obj->oid;
+            for (next_obj = *obj_name + *obj_name_len - 1; next_obj > *obj_name; next_obj--)
+                if (*next_obj == '/' &&
+                    H5_daos_path_cache_lookup(item->file, &start_oid, *obj_name,
+                                              (size_t)(next_obj - *obj_name), &cached_oid)) {
+                    cached_end = next_obj;
+                    break;
+                } /* end if */
+        }         /* end if */
+
         /* Search for '/' */
         next_obj = strchr(*obj_name, '/');
 
         /* Traverse path */
         while (next_obj) {
-            daos_obj_id_t **oid_ptr;
+            daos_obj_id_t **oid_ptr = NULL;
             ptrdiff_t       component_len;
 
             /* Calculate length of path component */
@@ -164,15 +227,19 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path, hid_t lcpl_id, H5
             /* Advance obj_name_len to match next_obj */
             *obj_name_len -= (size_t)(component_len + 1);
 
-            /* Skip past "." path element */
-            if (!(component_len == 1 && (*obj_name)[0] == '.')) {
-                /* Follow link to next group in path */
-                assert(next_obj > *obj_name);
-                assert(obj->item.type == H5I_GROUP);
-                if (H5_daos_link_follow((H5_daos_group_t *)obj, *obj_name, (size_t)component_len,
-                                        (hbool_t)crt_intermed_grp, req, &oid_ptr, NULL, first_task,
-                                        dep_task) < 0)
-                    D_GOTO_ERROR(H5E_SYM, H5E_TRAVERSE, NULL, "can't follow link to group");
+            /* Skip past "." path element and path elements before the
+             * deepest cached group */
+            if (!(component_len == 1 && (*obj_name)[0] == '.') && (!cached_end || next_obj >= cached_end)) {
+                /* Follow link to next group in path, unless it was found in
+                 * the path cache */
+                if (next_obj != cached_end) {
+                    assert(next_obj > *obj_name);
+                    assert(obj->item.type == H5I_GROUP);
+                    if (H5_daos_link_follow((H5_daos_group_t *)obj, *obj_name, (size_t)component_len,
+                                            (hbool_t)crt_intermed_grp, req, &oid_ptr, NULL, first_task,
+                                            dep_task) < 0)
+                        D_GOTO_ERROR(H5E_SYM, H5E_TRAVERSE, NULL, "can't follow link to group");
+                } /* end if */
 
                 /* Close previous group */
                 if (H5_daos_group_close_real((H5_daos_group_t *)obj) < 0)
@@ -189,10 +256,21 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path, hid_t lcpl_id, H5
                 /* Allocate the group object that is returned to the user */
                 if (NULL == (obj = H5FL_CALLOC(H5_daos_group_t)))
                     D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, NULL, "can't allocate DAOS group struct");
-
-                /* Open next group in path */
-                if (H5_daos_group_open_helper(item->file, (H5_daos_group_t *)obj, H5P_GROUP_ACCESS_DEFAULT,
-                                              FALSE, int_int_req, first_task, dep_task) < 0)
+                if (!oid_ptr)
+                    obj->oid = cached_oid;
+
+                /* Open next group in path.  The final group is returned, and
+                 * missing groups may be created in any group, so these need
+                 * the group's metadata.  Other groups are only used to read
+                 * links. */
+                if (crt_intermed_grp || !strchr(next_obj + 1, '/')) {
+                    if (H5_daos_group_open_helper(item->file, (H5_daos_group_t *)obj,
+                                                  H5P_GROUP_ACCESS_DEFAULT, FALSE, int_int_req, first_task,
+                                                  dep_task) < 0)
+                        D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
+                } /* end if */
+                else if (H5_daos_group_open_handle(item->file, (H5_daos_group_t *)obj, int_int_req,
+                                                   first_task, dep_task) < 0)
                     D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, NULL, "can't open group");
 
                 /* Create task to finalize internal operation */
@@ -214,9 +292,17 @@ H5_daos_group_traverse(H5_daos_item_t *item, const char *path, hid_t lcpl_id, H5
                 *dep_task   = int_int_req->finalize_task;
                 int_int_req = NULL;
 
-                /* Retarget oid_ptr to grp->obj.oid so H5_daos_link_follow fills in
-                 * the group's oid */
-                *oid_ptr = &obj->oid;
+                if (oid_ptr) {
+                    /* Retarget oid_ptr to grp->obj.oid so H5_daos_link_follow
+                     * fills in the group's oid */
+                    *oid_ptr = &obj->oid;
+
+                    /* Add the group to the path cache once its oid is known */
+                    if (use_cache && H5_daos_path_cache_add((H5_daos_group_t *)obj, &start_oid, tmp_path_buf,
+                                                            (size_t)(next_obj - tmp_path_buf), req,
+                                                            first_task, dep_task) < 0)
+                        D_GOTO_ERROR(H5E_SYM, H5E_CANTINSERT, NULL, "can't add group to path cache");
+                } /* end if */
             } /* end if */
 
             /* Advance to next path element */
@@ -258,6 +344,323 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_group_traverse() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_hash
+ *
+ * Purpose:     Computes the hash of a path cache key.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_path_cache_hash(const daos_obj_id_t *start_oid, const char *path, size_t path_len)
+{
+    uint64_t hash = UINT64_C(14695981039346656037);
+    size_t   i;
+
+    hash = (hash ^ start_oid->lo) * UINT64_C(1099511628211);
+    hash = (hash ^ start_oid->hi) * UINT64_C(1099511628211);
+    for (i = 0; i < path_len; i++)
+        hash = (hash ^ (uint64_t)(unsigned char)path[i]) * UINT64_C(1099511628211);
+
+    return hash;
+} /* end H5_daos_path_cache_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_lookup
+ *
+ * Purpose:     Looks up the group reached by following path from the
+ *              group with OID start_oid in the file's path cache.
+ *
+ * Return:      Success:        TRUE if found (oid is set), FALSE if not
+ *              Failure:        Negative (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+static htri_t
+H5_daos_path_cache_lookup(H5_daos_file_t *file, const daos_obj_id_t *start_oid, const char *path,
+                          size_t path_len, daos_obj_id_t *oid)
+{
+    H5_daos_path_cache_ent_t *ent;
+    uint64_t                  hash;
+
+    assert(file);
+    assert(start_oid);
+    assert(path);
+    assert(oid);
+
+    if (!file->path_cache.ents)
+        return FALSE;
+
+    hash = H5_daos_path_cache_hash(start_oid, path, path_len);
+    ent  = &file->path_cache.ents[hash % H5_DAOS_PATH_CACHE_NENTRIES];
+    if (!ent->path || ent->hash != hash || ent->path_len != path_len || ent->start_oid.lo != start_oid->lo ||
+        ent->start_oid.hi != start_oid->hi || memcmp(ent->path, path, path_len))
+        return FALSE;
+
+    *oid = ent->oid;
+
+    return TRUE;
+} /* end H5_daos_path_cache_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_insert
+ *
+ * Purpose:     Adds a group to the file's path cache, replacing whatever
+ *              entry was in its slot.  Takes ownership of path.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_path_cache_insert(H5_daos_file_t *file, const daos_obj_id_t *start_oid, char *path, size_t path_len,
+                          const daos_obj_id_t *oid)
+{
+    H5_daos_path_cache_ent_t *ent;
+    uint64_t                  hash;
+    herr_t                    ret_value = SUCCEED;
+
+    assert(file);
+    assert(start_oid);
+    assert(path);
+    assert(oid);
+
+    /* Allocate the cache on first use */
+    if (!file->path_cache.ents &&
+        NULL == (file->path_cache.ents = (H5_daos_path_cache_ent_t *)DV_calloc(
+                     H5_DAOS_PATH_CACHE_NENTRIES * sizeof(H5_daos_path_cache_ent_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate path cache");
+
+    hash = H5_daos_path_cache_hash(start_oid, path, path_len);
+    ent  = &file->path_cache.ents[hash % H5_DAOS_PATH_CACHE_NENTRIES];
+    DV_free(ent->path);
+    ent->hash      = hash;
+    ent->start_oid = *start_oid;
+    ent->path      = path;
+    ent->path_len  = path_len;
+    ent->oid       = *oid;
+
+done:
+    if (ret_value < 0)
+        DV_free(path);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_path_cache_insert() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_invalidate
+ *
+ * Purpose:     Removes all entries from the file's path cache.  Also
+ *              prevents groups whose paths are still being resolved from
+ *              being added to the cache.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_path_cache_invalidate(H5_daos_file_t *file)
+{
+    size_t i;
+
+    assert(file);
+
+    if (file->path_cache.ents)
+        for (i = 0; i < H5_DAOS_PATH_CACHE_NENTRIES; i++)
+            if (file->path_cache.ents[i].path) {
+                DV_free(file->path_cache.ents[i].path);
+                memset(&file->path_cache.ents[i], 0, sizeof(file->path_cache.ents[i]));
+            } /* end if */
+
+    file->path_cache.gen++;
+} /* end H5_daos_path_cache_invalidate() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_add_task
+ *
+ * Purpose:     Asynchronous task to add a group to the path cache after
+ *              its OID has been resolved.  The group is not added if the
+ *              cache was invalidated since the traversal started.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_path_cache_add_task(tse_task_t *task)
+{
+    H5_daos_path_cache_add_ud_t *udata     = NULL;
+    int                          ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for path cache add task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_SYM);
+
+    /* Add the group to the cache if the cache has not been invalidated */
+    if (udata->gen == udata->grp->obj.item.file->path_cache.gen) {
+        char *path = udata->path;
+
+        udata->path = NULL;
+        if (H5_daos_path_cache_insert(udata->grp->obj.item.file, &udata->start_oid, path, udata->path_len,
+                                      &udata->grp->obj.oid) < 0)
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINSERT, -H5_DAOS_SETUP_ERROR, "can't add group to path cache");
+    } /* end if */
+
+done:
+    /* Clean up */
+    if (udata) {
+        /* Close group */
+        if (H5_daos_group_close_real(udata->grp) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+        udata->grp = NULL;
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "path cache add task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free udata */
+        udata->path = DV_free(udata->path);
+        udata       = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_path_cache_add_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_path_cache_add
+ *
+ * Purpose:     Creates a task to add grp to the path cache once its OID
+ *              is known, under the key start_oid and path.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_path_cache_add(H5_daos_group_t *grp, const daos_obj_id_t *start_oid, const char *path,
+                       size_t path_len, H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_path_cache_add_ud_t *udata = NULL;
+    tse_task_t                  *add_task;
+    int                          ret;
+    herr_t                       ret_value = SUCCEED;
+
+    assert(grp);
+    assert(start_oid);
+    assert(path);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Set up user data */
+    if (NULL == (udata = (H5_daos_path_cache_add_ud_t *)DV_calloc(sizeof(H5_daos_path_cache_add_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for path cache add");
+    if (NULL == (udata->path = (char *)DV_malloc(path_len)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate path cache key");
+    memcpy(udata->path, path, path_len);
+    udata->req       = req;
+    udata->grp       = grp;
+    udata->start_oid = *start_oid;
+    udata->path_len  = path_len;
+    udata->gen       = grp->obj.item.file->path_cache.gen;
+
+    /* Create task to add the group to the cache */
+    if (H5_daos_create_task(H5_daos_path_cache_add_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
+                            NULL, udata, &add_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create task to add group to path cache");
+
+    /* Schedule task (or save it to be scheduled later) and give it a
+     * reference to req and the group */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(add_task, false)))
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't schedule task to add group to path cache: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = add_task;
+    *dep_task = add_task;
+    req->rc++;
+    grp->obj.item.rc++;
+    udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (udata) {
+        assert(ret_value < 0);
+        DV_free(udata->path);
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_path_cache_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_open_handle
+ *
+ * Purpose:     Opens a group during traversal without reading its
+ *              metadata.  The group can only be used to read links.  It
+ *              is the responsibility of the calling function to make
+ *              sure that the group's oid field is filled in before
+ *              scheduled tasks are allowed to run.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_group_open_handle(H5_daos_file_t *file, H5_daos_group_t *grp, H5_daos_req_t *req,
+                          tse_task_t **first_task, tse_task_t **dep_task)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(file);
+    assert(grp);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    grp->obj.item.type     = H5I_GROUP;
+    grp->obj.item.open_req = req;
+    req->rc++;
+    grp->obj.item.file = file;
+    grp->obj.item.rc   = 1;
+    grp->obj.obj_oh    = DAOS_HDL_INVAL;
+    grp->gcpl_id       = H5P_GROUP_CREATE_DEFAULT;
+    grp->gapl_id       = H5P_GROUP_ACCESS_DEFAULT;
+
+    /* Open group object */
+    if (H5_daos_obj_open(file, req, &grp->obj.oid, file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO,
+                         &grp->obj.obj_oh, "group object open", first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "can't open group object");
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_open_handle() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_group_fill_gcpl_cache
  *
@@ -1151,6 +1554,9 @@ H5_daos_ginfo_read_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                                                    udata->md_rw_cb_ud.sg_iov[0].iov_buf,
                                                    (uint64_t)udata->md_rw_cb_ud.iod[0].iod_size)))
                 D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, ret, "can't finish opening group");
+
+            /* Let later opens of the group copy its metadata */
+            H5_daos_obj_set_shared_md(udata->md_rw_cb_ud.obj, FALSE);
         } /* end else */
     }     /* end else */
 
@@ -1227,8 +1633,7 @@ H5_daos_group_open_helper(H5_daos_file_t *file, H5_daos_group_t *grp, hid_t gapl
                           H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_mpi_ibcast_ud_flex_t *bcast_udata = NULL;
-    H5_daos_omd_fetch_ud_t       *fetch_udata = NULL;
-    int                           ret, ret_value = 0;
+    int                           ret_value   = 0;
 
     assert(file);
     assert(grp);
@@ -1262,90 +1667,14 @@ H5_daos_group_open_helper(H5_daos_file_t *file, H5_daos_group_t *grp, hid_t gapl
 
     /* Open group and read metadata if this process should */
     if (!collective || (file->my_rank == 0)) {
-        tse_task_t *fetch_task = NULL;
-
-        /* Open group object */
-        if (H5_daos_obj_open(file, req, &grp->obj.oid, file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO,
-                             &grp->obj.obj_oh, "group object open", first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, -H5_DAOS_H5_OPEN_ERROR, "can't open group object");
-
-        /* Allocate argument struct for fetch task */
-        if (NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(
-                         sizeof(H5_daos_omd_fetch_ud_t) + (bcast_udata ? 0 : H5_DAOS_GINFO_BUF_SIZE))))
-            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_H5_OPEN_ERROR,
-                         "can't allocate buffer for fetch callback arguments");
-
-        /* Set up operation to read GCPL size from group */
-        /* Set up ud struct */
-        fetch_udata->md_rw_cb_ud.req = req;
-        fetch_udata->md_rw_cb_ud.obj = &grp->obj;
-        fetch_udata->bcast_udata     = bcast_udata;
-
-        /* Set up dkey.  Point to global name buffer, do not free. */
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
-                           H5_daos_int_md_key_size_g);
-        fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
-
-        /* Single iod and sgl */
-        fetch_udata->md_rw_cb_ud.nr = 1u;
-
-        /* Set up iod.  Point akey to global name buffer, do not free. */
-        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_cpl_key_g,
-                           H5_daos_cpl_key_size_g);
-        fetch_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
-        fetch_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
-        fetch_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
-        fetch_udata->md_rw_cb_ud.free_akeys      = FALSE;
-
-        /* Set up sgl */
-        if (bcast_udata)
-            daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0],
-                         bcast_udata->flex_buf + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE,
-                         (daos_size_t)(H5_DAOS_GINFO_BUF_SIZE - 3 * H5_DAOS_ENCODED_UINT64_T_SIZE));
-        else
-            daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], fetch_udata->flex_buf,
-                         (daos_size_t)(H5_DAOS_GINFO_BUF_SIZE));
-        fetch_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
-        fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
-        fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
-        fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = FALSE;
-
-        /* Set conditional akey fetch for group metadata read operation */
-        fetch_udata->md_rw_cb_ud.flags = DAOS_COND_AKEY_FETCH;
-
-        /* Set task name */
-        fetch_udata->md_rw_cb_ud.task_name = "group metadata read";
-
-        /* Create meta task for group metadata read.  This empty task will be
-         * completed when the read is finished by H5_daos_ginfo_read_comp_cb.
-         * We can't use fetch_task since it may not be completed by the first
-         * fetch. */
-        if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &fetch_udata->fetch_metatask) < 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_H5_OPEN_ERROR,
-                         "can't create meta task for group metadata read");
-
-        /* Create task for group metadata read */
-        assert(*dep_task);
-        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_md_rw_prep_cb,
-                                     H5_daos_ginfo_read_comp_cb, fetch_udata, &fetch_task) < 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_H5_OPEN_ERROR,
-                         "can't create task to read group metadata");
-
-        /* Schedule meta task */
-        if (0 != (ret = tse_task_schedule(fetch_udata->fetch_metatask, false)))
-            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_H5_OPEN_ERROR,
-                         "can't schedule meta task for group metadata read: %s", H5_daos_err_to_string(ret));
-
-        /* Schedule group metadata read task (or save it to be scheduled later)
-         * and give it a reference to req and the group */
-        assert(*first_task);
-        if (0 != (ret = tse_task_schedule(fetch_task, false)))
-            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_H5_OPEN_ERROR,
-                         "can't schedule task to read group metadata: %s", H5_daos_err_to_string(ret));
-        *dep_task = fetch_udata->fetch_metatask;
-        req->rc++;
-        grp->obj.item.rc++;
-        fetch_udata = NULL;
+        /* Share the group's metadata and DAOS object handle with its other
+         * open handles, unless the metadata must be broadcast */
+        if (!bcast_udata) {
+            if (H5_daos_group_open_share(grp, req, first_task, dep_task) < 0)
+                D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, -H5_DAOS_H5_OPEN_ERROR, "can't open group");
+        } /* end if */
+        else if (H5_daos_group_open_fetch(grp, bcast_udata, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, -H5_DAOS_H5_OPEN_ERROR, "can't open group");
     } /* end if */
     else
         assert(bcast_udata);
@@ -1370,18 +1699,332 @@ done:
         /* Close group */
         if (grp && H5_daos_group_close_real(grp) < 0)
             D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_OPEN_ERROR, "can't close group");
-
-        /* Free memory */
-        fetch_udata = DV_free(fetch_udata);
     } /* end if */
 
     /* Make sure we cleaned up */
-    assert(!fetch_udata);
     assert(!bcast_udata);
 
     D_FUNC_LEAVE;
 } /* end H5_daos_group_open_helper() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_open_fetch
+ *
+ * Purpose:     Opens a group's DAOS object and reads its metadata.  The
+ *              metadata is placed in bcast_udata's buffer if it is
+ *              given, so it can be broadcast to the other processes.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_group_open_fetch(H5_daos_group_t *grp, H5_daos_mpi_ibcast_ud_flex_t *bcast_udata, H5_daos_req_t *req,
+                         tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_file_t         *file        = grp->obj.item.file;
+    H5_daos_omd_fetch_ud_t *fetch_udata = NULL;
+    tse_task_t             *fetch_task  = NULL;
+    int                     ret;
+    herr_t                  ret_value = SUCCEED;
+
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Open group object */
+    if (H5_daos_obj_open(file, req, &grp->obj.oid, file->flags & H5F_ACC_RDWR ? DAOS_OO_RW : DAOS_OO_RO,
+                         &grp->obj.obj_oh, "group object open", first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, FAIL, "can't open group object");
+
+    /* Allocate argument struct for fetch task */
+    if (NULL == (fetch_udata = (H5_daos_omd_fetch_ud_t *)DV_calloc(
+                     sizeof(H5_daos_omd_fetch_ud_t) + (bcast_udata ? 0 : H5_DAOS_GINFO_BUF_SIZE))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for fetch callback arguments");
+
+    /* Set up operation to read GCPL size from group */
+    /* Set up ud struct */
+    fetch_udata->md_rw_cb_ud.req = req;
+    fetch_udata->md_rw_cb_ud.obj = &grp->obj;
+    fetch_udata->bcast_udata     = bcast_udata;
+
+    /* Set up dkey.  Point to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_int_md_key_g,
+                       H5_daos_int_md_key_size_g);
+    fetch_udata->md_rw_cb_ud.free_dkey = FALSE;
+
+    /* Single iod and sgl */
+    fetch_udata->md_rw_cb_ud.nr = 1u;
+
+    /* Set up iod.  Point akey to global name buffer, do not free. */
+    daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name, H5_daos_cpl_key_g,
+                       H5_daos_cpl_key_size_g);
+    fetch_udata->md_rw_cb_ud.iod[0].iod_nr   = 1u;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_size = DAOS_REC_ANY;
+    fetch_udata->md_rw_cb_ud.iod[0].iod_type = DAOS_IOD_SINGLE;
+    fetch_udata->md_rw_cb_ud.free_akeys      = FALSE;
+
+    /* Set up sgl */
+    if (bcast_udata)
+        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0],
+                     bcast_udata->flex_buf + 3 * H5_DAOS_ENCODED_UINT64_T_SIZE,
+                     (daos_size_t)(H5_DAOS_GINFO_BUF_SIZE - 3 * H5_DAOS_ENCODED_UINT64_T_SIZE));
+    else
+        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[0], fetch_udata->flex_buf,
+                     (daos_size_t)(H5_DAOS_GINFO_BUF_SIZE));
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr     = 1;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_nr_out = 0;
+    fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
+    fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = FALSE;
+
+    /* Set conditional akey fetch for group metadata read operation */
+    fetch_udata->md_rw_cb_ud.flags = DAOS_COND_AKEY_FETCH;
+
+    /* Set task name */
+    fetch_udata->md_rw_cb_ud.task_name = "group metadata read";
+
+    /* Create meta task for group metadata read.  This empty task will be
+     * completed when the read is finished by H5_daos_ginfo_read_comp_cb.
+     * We can't use fetch_task since it may not be completed by the first
+     * fetch. */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &fetch_udata->fetch_metatask) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create meta task for group metadata read");
+
+    /* Create task for group metadata read */
+    assert(*dep_task);
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 1, dep_task, H5_daos_md_rw_prep_cb,
+                                 H5_daos_ginfo_read_comp_cb, fetch_udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create task to read group metadata");
+
+    /* Schedule meta task */
+    if (0 != (ret = tse_task_schedule(fetch_udata->fetch_metatask, false)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't schedule meta task for group metadata read: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Schedule group metadata read task (or save it to be scheduled later)
+     * and give it a reference to req and the group */
+    assert(*first_task);
+    if (0 != (ret = tse_task_schedule(fetch_task, false)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't schedule task to read group metadata: %s",
+                     H5_daos_err_to_string(ret));
+    *dep_task = fetch_udata->fetch_metatask;
+    req->rc++;
+    grp->obj.item.rc++;
+    fetch_udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (fetch_udata) {
+        assert(ret_value < 0);
+        fetch_udata = DV_free(fetch_udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_open_fetch() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_open_copy
+ *
+ * Purpose:     Sets up a group being opened from another open handle of
+ *              the same group, instead of opening its DAOS object and
+ *              reading its metadata.  The GCPL is shared, since it can't
+ *              change.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_group_open_copy(H5_daos_group_t *grp, const H5_daos_group_t *src)
+{
+    herr_t ret_value = SUCCEED;
+
+    assert(grp);
+    assert(grp->obj.shared);
+    assert(!daos_handle_is_inval(grp->obj.shared->obj_oh));
+    assert(src);
+
+    if (src->gcpl_id != H5P_GROUP_CREATE_DEFAULT && src->gcpl_id != H5P_FILE_CREATE_DEFAULT &&
+        H5Iinc_ref(src->gcpl_id) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINC, FAIL, "can't increment GCPL reference count");
+    grp->gcpl_id = src->gcpl_id;
+
+    /* Copy caches */
+    grp->gcpl_cache     = src->gcpl_cache;
+    grp->obj.ocpl_cache = src->obj.ocpl_cache;
+
+    /* Use the shared DAOS object handle */
+    grp->obj.obj_oh = grp->obj.shared->obj_oh;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_open_copy() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_open_share_task
+ *
+ * Purpose:     Asynchronous task to add a group being opened to the
+ *              file's open object table once its OID is known.  If
+ *              another handle of the group has its metadata, the group
+ *              is set up from that handle, otherwise the group's object
+ *              is opened and its metadata read.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_group_open_share_task(tse_task_t *task)
+{
+    H5_daos_group_open_share_ud_t *udata      = NULL;
+    H5_daos_obj_t                 *src        = NULL;
+    tse_task_t                    *first_task = NULL;
+    tse_task_t                    *dep_task   = NULL;
+    tse_task_t                    *metatask   = NULL;
+    int                            ret;
+    int                            ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for group open share task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_SYM);
+
+    /* Add the group to the open object table */
+    if (H5_daos_obj_share(&udata->grp->obj) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't add group to open object table");
+
+    /* Copy the metadata of another handle if possible */
+    if (NULL != (src = udata->grp->obj.shared->md_obj)) {
+        if (H5_daos_group_open_copy(udata->grp, (H5_daos_group_t *)src) < 0)
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR, "can't copy metadata from open group");
+    } /* end if */
+    else if (H5_daos_group_open_fetch(udata->grp, NULL, udata->req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTOPENOBJ, -H5_DAOS_SETUP_ERROR, "can't open group object");
+
+done:
+    /* Clean up */
+    if (udata) {
+        /* Create metatask to complete this task after dep_task if necessary */
+        if (dep_task) {
+            /* Create metatask */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_SYM, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for group open share");
+            else {
+                /* Schedule metatask */
+                assert(first_task);
+                if (0 != (ret = tse_task_schedule(metatask, false)))
+                    D_DONE_ERROR(H5E_SYM, H5E_CANTINIT, ret,
+                                 "can't schedule metatask for group open share: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end else */
+        }     /* end if */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_SYM, H5E_CANTINIT, ret, "can't schedule initial task for group open share: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Close group */
+        if (H5_daos_group_close_real(udata->grp) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+        udata->grp = NULL;
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "group open share task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(udata->req) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+        /* Free udata */
+        udata = DV_free(udata);
+    } /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_open_share_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_group_open_share
+ *
+ * Purpose:     Creates a task to open a group through the file's open
+ *              object table once its OID is known.  See
+ *              H5_daos_group_open_share_task().
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_group_open_share(H5_daos_group_t *grp, H5_daos_req_t *req, tse_task_t **first_task,
+                         tse_task_t **dep_task)
+{
+    H5_daos_group_open_share_ud_t *udata = NULL;
+    tse_task_t                    *share_task;
+    int                            ret;
+    herr_t                         ret_value = SUCCEED;
+
+    assert(grp);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Set up user data */
+    if (NULL == (udata = (H5_daos_group_open_share_ud_t *)DV_malloc(sizeof(H5_daos_group_open_share_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate user data struct for group open");
+    udata->req = req;
+    udata->grp = grp;
+
+    /* Create task */
+    if (H5_daos_create_task(H5_daos_group_open_share_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, udata, &share_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create task to open group");
+
+    /* Schedule task (or save it to be scheduled later) and give it a
+     * reference to req and the group */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(share_task, false)))
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't schedule task to open group: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = share_task;
+    *dep_task = share_task;
+    req->rc++;
+    grp->obj.item.rc++;
+    udata = NULL;
+
+done:
+    /* Cleanup on failure */
+    if (udata) {
+        assert(ret_value < 0);
+        udata = DV_free(udata);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_group_open_share() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_group_open_int
  *
@@ -1918,6 +2561,8 @@ H5_daos_group_close_real(H5_daos_group_t *grp)
         /* Free group data structures */
         if (grp->obj.item.cur_op_pool)
             H5_daos_op_pool_free(grp->obj.item.cur_op_pool);
+        if (H5_daos_obj_unshare(&grp->obj) < 0)
+            D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't release shared group state");
         if (grp->obj.item.open_req)
             if (H5_daos_req_free_int(grp->obj.item.open_req) < 0)
                 D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't free request");
@@ -2177,8 +2822,8 @@ H5_daos_group_get_info_task(tse_task_t *task)
     if (((H5_daos_group_t *)udata->target_obj)->gcpl_cache.track_corder) {
         /* DSINC - no check for overflow for max_corder! */
         if (H5_daos_group_get_max_crt_order((H5_daos_group_t *)udata->target_obj,
-                                            (uint64_t *)&udata->group_info->max_corder, udata->req,
-                                            &first_task, &dep_task) < 0)
+                                            (uint64_t *)&udata->group_info->max_corder, NULL,
+                                            udata->req, &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_SYM, H5E_CANTGET, -H5_DAOS_DAOS_GET_ERROR,
                          "can't get group's max creation order value");
     } /* end if */
@@ -2788,6 +3433,12 @@ H5_daos_group_gmco_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 
         /* Set output value */
         *udata->max_corder = max_corder_val;
+
+        /* Set index version if requested.  Groups whose index was written
+         * before the version was recorded have no version key. */
+        if (udata->corder_version)
+            *udata->corder_version =
+                udata->md_rw_cb_ud.iod[1].iod_size == 0 ? (uint8_t)0 : udata->corder_version_buf;
     } /* end else */
 
 done:
@@ -2829,7 +3480,9 @@ done:
  * Purpose:     Retrieves a group's current maximum creation order value.
  *              Note that this value may not match the current number of
  *              links within the group, as some of the links may have been
- *              deleted.
+ *              deleted.  If corder_version is not NULL, also retrieves
+ *              the layout version of the group's link creation order
+ *              index in the same fetch, or 0 if none was recorded.
  *
  * Return:      Success:        0
  *              Failure:        -1
@@ -2837,8 +3490,8 @@ done:
  *-------------------------------------------------------------------------
  */
 herr_t
-H5_daos_group_get_max_crt_order(H5_daos_group_t *target_grp, uint64_t *max_corder, H5_daos_req_t *req,
-                                tse_task_t **first_task, tse_task_t **dep_task)
+H5_daos_group_get_max_crt_order(H5_daos_group_t *target_grp, uint64_t *max_corder, uint8_t *corder_version,
+                                H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_group_gmco_ud_t *fetch_udata = NULL;
     tse_task_t              *fetch_task  = NULL;
@@ -2856,13 +3509,14 @@ H5_daos_group_get_max_crt_order(H5_daos_group_t *target_grp, uint64_t *max_corde
     fetch_udata->md_rw_cb_ud.req = req;
     fetch_udata->md_rw_cb_ud.obj = &target_grp->obj;
     fetch_udata->max_corder      = max_corder;
+    fetch_udata->corder_version  = corder_version;
 
     /* Set up dkey */
     daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.dkey, H5_daos_link_corder_key_g,
                        H5_daos_link_corder_key_size_g);
 
     /* Set nr */
-    fetch_udata->md_rw_cb_ud.nr = 1;
+    fetch_udata->md_rw_cb_ud.nr = corder_version ? 2 : 1;
 
     /* Set up iod */
     daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[0].iod_name,
@@ -2879,6 +3533,21 @@ H5_daos_group_get_max_crt_order(H5_daos_group_t *target_grp, uint64_t *max_corde
     fetch_udata->md_rw_cb_ud.sgl[0].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[0];
     fetch_udata->md_rw_cb_ud.free_sg_iov[0]   = FALSE;
 
+    /* Set up iod and sgl for the index version if requested */
+    if (corder_version) {
+        daos_const_iov_set((d_const_iov_t *)&fetch_udata->md_rw_cb_ud.iod[1].iod_name,
+                           H5_daos_link_corder_version_key_g, H5_daos_link_corder_version_key_size_g);
+        fetch_udata->md_rw_cb_ud.iod[1].iod_nr   = 1u;
+        fetch_udata->md_rw_cb_ud.iod[1].iod_size = (daos_size_t)1;
+        fetch_udata->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&fetch_udata->md_rw_cb_ud.sg_iov[1], &fetch_udata->corder_version_buf, (daos_size_t)1);
+        fetch_udata->md_rw_cb_ud.sgl[1].sg_nr     = 1;
+        fetch_udata->md_rw_cb_ud.sgl[1].sg_nr_out = 0;
+        fetch_udata->md_rw_cb_ud.sgl[1].sg_iovs   = &fetch_udata->md_rw_cb_ud.sg_iov[1];
+        fetch_udata->md_rw_cb_ud.free_sg_iov[1]   = FALSE;
+    } /* end if */
+
     /* Do not free buffers */
     fetch_udata->md_rw_cb_ud.free_akeys = FALSE;
     fetch_udata->md_rw_cb_ud.free_dkey  = FALSE;
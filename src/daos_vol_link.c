@@ -23,6 +23,55 @@
 #define H5_DAOS_HARD_LINK_VAL_SIZE         (H5_DAOS_ENCODED_OID_SIZE + 1)
 #define H5_DAOS_RECURSE_LINK_PATH_BUF_INIT 1024
 
+/*
+ * Parameters for the tree of deletion counts kept alongside a group's link
+ * creation order index.  Each node is an array akey in the creation order
+ * dkey holding one encoded count per child.  A level 1 node counts deleted
+ * creation order values directly and each level above it covers
+ * H5_DAOS_CORDER_TREE_FANOUT times as many values, so H5_DAOS_CORDER_TREE_NLEVELS
+ * levels cover every 64-bit creation order value.
+ */
+#define H5_DAOS_CORDER_TREE_FANOUT_BITS 8
+#define H5_DAOS_CORDER_TREE_FANOUT      (1 << H5_DAOS_CORDER_TREE_FANOUT_BITS)
+#define H5_DAOS_CORDER_TREE_NLEVELS     (64 / H5_DAOS_CORDER_TREE_FANOUT_BITS)
+#define H5_DAOS_CORDER_TREE_KEY_SIZE    (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)
+#define H5_DAOS_CORDER_TREE_NODE_SIZE   (H5_DAOS_CORDER_TREE_FANOUT * H5_DAOS_ENCODED_UINT64_T_SIZE)
+
+/* Index of the node at the given tree level that covers a creation order value */
+#define H5_DAOS_CORDER_TREE_NODE(corder, level)                                                              \
+    ((level) < H5_DAOS_CORDER_TREE_NLEVELS ? (corder) >> ((level)*H5_DAOS_CORDER_TREE_FANOUT_BITS) : 0)
+
+/* Slot within that node that covers a creation order value */
+#define H5_DAOS_CORDER_TREE_SLOT(corder, level)                                                              \
+    ((uint64_t)(((corder) >> (((level)-1) * H5_DAOS_CORDER_TREE_FANOUT_BITS)) &                             \
+                (H5_DAOS_CORDER_TREE_FANOUT - 1)))
+
+/*
+ * Encodes the akey of a tree node: the node index followed by its level.
+ * Levels start at 1, so these keys never collide with the creation order ->
+ * link target keys, which end in a 0 byte.
+ */
+#define H5_DAOS_CORDER_TREE_ENCODE_KEY(key_buf, node, level)                                                 \
+    do {                                                                                                     \
+        uint8_t *p = key_buf;                                                                                \
+                                                                                                             \
+        UINT64ENCODE(p, node)                                                                                \
+        *p = (uint8_t)(level);                                                                               \
+    } while (0)
+
+/*
+ * Layout version of a group's link creation order index.  Version 0 (groups
+ * without a version key) keys the index by position and shifts entries down
+ * on deletion.  Version 1 keys it by creation order value and counts the
+ * gaps in the tree above.  The version key is written the first time an
+ * index skips a value; until then both layouts are identical.
+ */
+#define H5_DAOS_LINK_CORDER_INDEX_VERSION 1
+
+/* Whether a group's creation order index must be accessed by position */
+#define H5_DAOS_LINK_CORDER_INDEX_BY_POSITION(version, nlinks, max_corder)                                   \
+    ((version) == 0 && (uint64_t)(nlinks) < (uint64_t)(max_corder))
+
 /*
  * Given an H5_daos_link_val_t and the link's type, encodes
  * the link's value into the given buffer.
@@ -112,6 +161,7 @@ typedef struct H5_daos_link_write_ud_t {
     size_t                link_val_buf_size;
     uint8_t               prev_max_corder_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint64_t              max_corder;
+    uint8_t               corder_version;
     tse_task_t           *link_write_task;
     tse_task_t           *update_task;
 } H5_daos_link_write_ud_t;
@@ -120,9 +170,9 @@ typedef struct H5_daos_link_write_ud_t {
 typedef struct H5_daos_link_write_corder_ud_t {
     H5_daos_md_rw_cb_ud_t    md_rw_cb_ud; /* Must be first */
     H5_daos_link_write_ud_t *link_write_ud;
-    uint8_t                  nlinks_old_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
     uint8_t                  nlinks_new_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
     uint8_t                  max_corder_new_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t                  corder_name_key[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint8_t                  corder_target_buf[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE];
     hsize_t                  nlinks;
     tse_task_t              *write_corder_task;
@@ -139,6 +189,59 @@ typedef struct H5_daos_link_create_hard_ud_t {
     uint64_t           obj_rc;
 } H5_daos_link_create_hard_ud_t;
 
+/* Task user data for one link in a bulk hard link creation */
+typedef struct H5_daos_link_create_multi_ent_t {
+    struct H5_daos_link_create_multi_ud_t *multi_ud;
+    daos_key_t                             dkey;
+    daos_iod_t                             iod[2];
+    daos_sg_list_t                         sgl[2];
+    daos_iov_t                             sg_iov[2];
+    uint8_t                                link_val_buf[H5_DAOS_HARD_LINK_VAL_SIZE];
+    uint8_t                                corder_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t                                corder_name_key[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t                                corder_target_key[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE];
+    size_t                                 trgt_idx; /* Index of the link's target in trgts */
+    hbool_t                                written;
+} H5_daos_link_create_multi_ent_t;
+
+/* Target object of a bulk hard link creation, with the number of new links
+ * to it.  nlinks is decremented for each link to it that is not written. */
+typedef struct H5_daos_link_create_multi_trgt_t {
+    struct H5_daos_link_create_multi_ud_t *multi_ud;
+    H5_daos_obj_t                         *obj;
+    uint64_t                               rc;
+    int64_t                                nlinks;
+} H5_daos_link_create_multi_trgt_t;
+
+/* Task user data for bulk hard link creation */
+typedef struct H5_daos_link_create_multi_ud_t {
+    H5_daos_req_t                    *req;
+    H5_daos_group_t                  *link_grp;
+    size_t                            count;
+    unsigned                          nr;
+    char                             *names_buf;
+    H5_daos_link_create_multi_ent_t  *ents;
+    tse_task_t                      **update_tasks;
+    tse_task_t                       *links_done_task; /* Completed when all link updates are done */
+    size_t                            nlinks_left;
+    int                               link_status;
+    H5_daos_link_create_multi_trgt_t *trgts;
+    size_t                            ntrgts;
+    uint64_t                          max_corder;
+    uint8_t                           corder_version;
+    hsize_t                           nlinks;
+    size_t                            nwritten;
+    uint64_t                         *skipped_corders; /* Creation order values left unused by failed links */
+    daos_key_t                        corder_dkey;
+    daos_iod_t                       *corder_iods;
+    daos_sg_list_t                   *corder_sgls;
+    daos_iov_t                       *corder_sg_iovs;
+    uint8_t                           max_corder_new_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+    uint8_t                           nlinks_new_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
+    uint8_t                           corder_version_new;
+    daos_iov_t                        corder_version_sg_iov;
+} H5_daos_link_create_multi_ud_t;
+
 /* Task user data for link copy */
 typedef struct H5_daos_link_copy_move_ud_t {
     H5_daos_req_t     *req;
@@ -231,6 +334,24 @@ typedef struct H5_daos_link_ibco_ud_t {
     hbool_t              base_iter;
     char                *null_replace_loc;
     tse_task_t          *ibco_metatask;
+    /* Fields for listing the creation order
+     * index when it has gaps.
+     */
+    hbool_t              max_corder_read;
+    hbool_t              corders_checked;
+    uint64_t             grp_max_corder;
+    uint8_t              grp_corder_version;
+    uint64_t            *corders; /* Creation order values of the links, in increasing order */
+    size_t               ncorders;
+    size_t               corders_nalloc;
+    struct {
+        daos_key_t      dkey;
+        daos_anchor_t   anchor;
+        uint32_t        nr;
+        daos_key_desc_t kds[H5_DAOS_ITER_LEN];
+        daos_iov_t      sg_iov;
+        daos_sg_list_t  sgl;
+    } list_data;
 } H5_daos_link_ibco_ud_t;
 
 /* Task user data for deleting a link */
@@ -255,8 +376,10 @@ typedef struct H5_daos_link_delete_corder_ud_t {
     const char                    *target_link_name;
     daos_key_t                     dkey;
     daos_key_t                     akeys[2];
-    uint64_t                       delete_idx;
+    uint64_t                       delete_idx; /* Link's key in the creation order index */
     hsize_t                        grp_nlinks;
+    uint64_t                       grp_max_corder;
+    uint8_t                        grp_corder_version;
     uint8_t                        idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     uint8_t                        crt_order_target_buf[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE];
     H5_daos_link_crt_idx_iter_ud_t name_order_iter_cb_ud;
@@ -266,6 +389,8 @@ typedef struct H5_daos_link_delete_corder_ud_t {
     struct {
         H5_daos_md_rw_cb_ud_t unl_ud;
         uint8_t               nlinks_new_buf[H5_DAOS_ENCODED_NUM_LINKS_SIZE];
+        hbool_t               write_version;
+        uint8_t               corder_version_new;
     } unl_data;
     /* Fields for performing bookkeeping on
      * group's link creation order index.
@@ -282,6 +407,26 @@ typedef struct H5_daos_link_delete_corder_ud_t {
     } index_data;
 } H5_daos_link_delete_corder_ud_t;
 
+/* Task user data for counting creation order values as deleted in a
+ * group's deletion count tree.  There is one IOD for each tree node
+ * touched, with one record for each slot touched in it. */
+typedef struct H5_daos_link_corder_tree_ud_t {
+    H5_daos_req_t   *req;
+    H5_daos_group_t *target_grp;
+    const uint64_t  *corders; /* Values to count, in increasing order */
+    size_t           ncorders;
+    daos_key_t       dkey;
+    unsigned         nr;
+    size_t           nslots;
+    daos_iod_t      *iods;
+    daos_sg_list_t  *sgls;
+    daos_recx_t     *recxs;
+    daos_iov_t      *sg_iovs;
+    uint64_t        *incrs; /* Number of values in each slot */
+    uint8_t         *keys;
+    uint8_t         *counts;
+} H5_daos_link_corder_tree_ud_t;
+
 /* User data struct for decrementing a deleted link's target object's reference
  * count */
 typedef struct H5_daos_link_delete_rc_ud_t {
@@ -314,6 +459,7 @@ typedef struct H5_daos_link_gnbi_alloc_ud_t {
     H5_index_t       index_type;
     H5_iter_order_t  iter_order;
     uint64_t         idx;
+    hbool_t          idx_is_corder;
     const char     **link_name;
     size_t          *link_name_size;
     char           **link_name_buf;
@@ -327,11 +473,28 @@ typedef struct H5_daos_link_gnbc_ud_t {
     uint8_t               idx_buf[H5_DAOS_ENCODED_CRT_ORDER_SIZE];
     tse_task_t           *gnbc_task;
     hsize_t               grp_nlinks;
+    uint64_t              grp_max_corder;
+    uint8_t               grp_corder_version;
     H5_iter_order_t       iter_order;
     uint64_t              index;
+    hbool_t               index_is_corder;
     size_t               *link_name_size;
     char                 *link_name_out;
     size_t                link_name_out_size;
+    /* Fields for walking down the deletion
+     * count tree to the target link.
+     */
+    struct {
+        uint64_t       rank;
+        uint64_t       node;
+        unsigned       level;
+        daos_iod_t     iod;
+        daos_recx_t    recx;
+        daos_sg_list_t sgl;
+        daos_iov_t     sg_iov;
+        uint8_t        key[H5_DAOS_CORDER_TREE_KEY_SIZE];
+        uint8_t        counts[H5_DAOS_CORDER_TREE_NODE_SIZE];
+    } tree_data;
 } H5_daos_link_gnbc_ud_t;
 
 /* User data struct for link get name by name order */
@@ -356,6 +519,13 @@ typedef struct H5_daos_link_gcbn_ud_t {
     uint64_t             *crt_order;
 } H5_daos_link_gcbn_ud_t;
 
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Last link creation order deletion count update started in this process */
+static tse_task_t *H5_daos_link_corder_task_g = NULL;
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -380,6 +550,15 @@ static herr_t H5_daos_link_write_corder_info(H5_daos_group_t *target_grp, uint64
                                              tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_link_write_corder_comp_cb(tse_task_t *task, void *args);
 
+static int H5_daos_link_multi_trgt_cmp(const void *_trgt1, const void *_trgt2);
+static int H5_daos_link_create_multi_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_link_create_multi_corder_prep_cb(tse_task_t *task, void *args);
+static int H5_daos_link_create_multi_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_link_create_multi_corder_comp_cb(tse_task_t *task, void *args);
+static int H5_daos_link_create_multi_rc_task(tse_task_t *task);
+static int H5_daos_link_create_multi_tree_task(tse_task_t *task);
+static int H5_daos_link_create_multi_end_task(tse_task_t *task);
+
 static int H5_daos_link_copy_move_task(tse_task_t *task);
 static int H5_daos_link_copy_move_end_task(tse_task_t *task);
 
@@ -408,6 +587,11 @@ static int    H5_daos_link_ibco_end_task(tse_task_t *task);
 static int    H5_daos_link_ibco_op_task(tse_task_t *task);
 static int    H5_daos_link_ibco_task2(tse_task_t *task);
 static int    H5_daos_link_ibco_task(tse_task_t *task);
+static herr_t H5_daos_link_ibco_list_corders(H5_daos_link_ibco_ud_t *udata, tse_task_t **first_task,
+                                             tse_task_t **dep_task);
+static int    H5_daos_link_ibco_list_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_ibco_list_comp_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_corder_cmp(const void *_corder1, const void *_corder2);
 static int    H5_daos_link_ibco_helper(H5_daos_group_t *target_grp, H5_daos_iter_data_t *iter_data,
                                        hbool_t base_iter, tse_task_t **first_task, tse_task_t **dep_task);
 static herr_t H5_daos_link_iterate_by_crt_order(H5_daos_group_t *target_grp, H5_daos_iter_data_t *iter_data,
@@ -422,6 +606,7 @@ static int    H5_daos_link_delete_corder_pretask(tse_task_t *task);
 static herr_t H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t *loc_params,
                                          const char *target_link_name, H5_daos_req_t *req,
                                          tse_task_t **first_task, tse_task_t **dep_task);
+static int    H5_daos_link_delete_corder_layout_task(tse_task_t *task);
 static herr_t H5_daos_link_delete_corder_name_cb(hid_t group, const char *name, const H5L_info2_t *info,
                                                  void *op_data);
 static int    H5_daos_link_delete_corder_unl_prep_cb(tse_task_t *task, void *args);
@@ -432,14 +617,35 @@ static int    H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void *args)
 static int    H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void *args);
 static int    H5_daos_link_delete_corder_finish(tse_task_t *task);
+static herr_t H5_daos_link_corder_tree_add(H5_daos_group_t *target_grp, const uint64_t *corders,
+                                           size_t ncorders, H5_daos_req_t *req, tse_task_t **first_task,
+                                           tse_task_t **dep_task);
+static int    H5_daos_link_corder_tree_fetch_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_corder_tree_update_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_corder_tree_finish(tse_task_t *task);
 static int    H5_daos_link_delete_rc_task(tse_task_t *task);
 static int    H5_daos_link_delete_rc_end_task(tse_task_t *task);
 
+static herr_t H5_daos_link_get_name_by_idx_alloc_int(H5_daos_group_t *target_grp, H5_index_t index_type,
+                                                    H5_iter_order_t iter_order, uint64_t idx,
+                                                    hbool_t idx_is_corder, const char **link_name,
+                                                    size_t *link_name_size, char **link_name_buf,
+                                                    size_t *link_name_buf_size, H5_daos_req_t *req,
+                                                    tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_link_gnbi_alloc_task(tse_task_t *task);
+static herr_t H5_daos_link_get_name_by_idx_int(H5_daos_group_t *target_grp, H5_index_t index_type,
+                                               H5_iter_order_t iter_order, uint64_t idx,
+                                               hbool_t idx_is_corder, size_t *link_name_size,
+                                               char *link_name_out, size_t link_name_out_size,
+                                               H5_daos_req_t *req,
+                                               tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_link_gnbc_task(tse_task_t *task);
+static int    H5_daos_link_gnbc_tree_prep_cb(tse_task_t *task, void *args);
+static int    H5_daos_link_gnbc_tree_comp_cb(tse_task_t *task, void *args);
 static int    H5_daos_link_gnbc_comp_cb(tse_task_t *task, void *args);
 static herr_t H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t iter_order,
-                                                 uint64_t index, size_t *link_name_size, char *link_name_out,
+                                                 uint64_t index, hbool_t index_is_corder,
+                                                 size_t *link_name_size, char *link_name_out,
                                                  size_t link_name_out_size, H5_daos_req_t *req,
                                                  tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_link_gnbn_task(tse_task_t *task);
@@ -984,7 +1190,8 @@ H5_daos_link_write_task(tse_task_t *task)
 
         /* Read group's current maximum creation order value */
         if (H5_daos_group_get_max_crt_order((H5_daos_group_t *)udata->md_rw_cb_ud.obj, &udata->max_corder,
-                                            udata->md_rw_cb_ud.req, &first_task, &dep_task) < 0)
+                                            &udata->corder_version, udata->md_rw_cb_ud.req, &first_task,
+                                            &dep_task) < 0)
             D_GOTO_ERROR(H5E_SYM, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
                          "can't get group's maximum creation order value");
 
@@ -1346,6 +1553,9 @@ H5_daos_link_write(H5_daos_group_t *target_grp, const char *name, size_t name_le
     req->rc++;
     link_write_ud = NULL;
 
+    /* Keep the name filter from being trusted until the link is written */
+    H5_daos_name_filter_create(req);
+
 done:
     /* Cleanup on failure */
     if (link_write_ud) {
@@ -1394,6 +1604,10 @@ H5_daos_link_write_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     assert(udata->md_rw_cb_ud.req->file);
     assert(udata->link_val_buf);
 
+    /* Add the link's name to the group's name filter, if it has one */
+    H5_daos_name_filter_add(udata->md_rw_cb_ud.obj->item.file, &udata->md_rw_cb_ud.obj->oid,
+                            H5_DAOS_NAME_FILTER_LINK, 0, udata->link_name_buf, udata->link_name_buf_size);
+
     /* If this is a hard link, encoding of the OID into
      * the link's value buffer was delayed until this point.
      * Go ahead and do the encoding now.
@@ -1559,18 +1773,23 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
     /* Handle errors in previous tasks */
     H5_DAOS_PREP_REQ(udata->md_rw_cb_ud.req, H5E_LINK);
 
-    /* Encode old nlinks */
-    uint_nlinks = (uint64_t)udata->nlinks;
-    p           = udata->nlinks_old_buf;
-    UINT64ENCODE(p, uint_nlinks);
-
     /* Add new link to count */
-    uint_nlinks++;
+    uint_nlinks = (uint64_t)udata->nlinks + 1;
 
-    /* Encode remaining buffers */
+    /* Encode remaining buffers.  The creation order index is keyed by the
+     * link's creation order value, which the link write task has encoded,
+     * unless it is an old index that is still keyed by position. */
     p = udata->nlinks_new_buf;
     UINT64ENCODE(p, uint_nlinks);
-    memcpy(udata->corder_target_buf, udata->nlinks_old_buf, 8);
+    if (H5_DAOS_LINK_CORDER_INDEX_BY_POSITION(udata->link_write_ud->corder_version, udata->nlinks,
+                                              udata->link_write_ud->max_corder - 1)) {
+        p = udata->corder_name_key;
+        UINT64ENCODE(p, (uint64_t)udata->nlinks);
+    } /* end if */
+    else
+        memcpy(udata->corder_name_key, udata->link_write_ud->prev_max_corder_buf,
+               H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+    memcpy(udata->corder_target_buf, udata->corder_name_key, H5_DAOS_ENCODED_CRT_ORDER_SIZE);
     udata->corder_target_buf[8] = 0;
 
     /* Set up IOD */
@@ -1590,8 +1809,8 @@ H5_daos_link_wr_corder_info_task(tse_task_t *task)
     udata->md_rw_cb_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
 
     /* Key for mapping from link creation order value -> link name */
-    daos_iov_set(&udata->md_rw_cb_ud.iod[2].iod_name, (void *)udata->nlinks_old_buf,
-                 H5_DAOS_ENCODED_NUM_LINKS_SIZE);
+    daos_iov_set(&udata->md_rw_cb_ud.iod[2].iod_name, (void *)udata->corder_name_key,
+                 H5_DAOS_ENCODED_CRT_ORDER_SIZE);
     udata->md_rw_cb_ud.iod[2].iod_nr   = 1u;
     udata->md_rw_cb_ud.iod[2].iod_size = (uint64_t)udata->link_write_ud->link_name_buf_size;
     udata->md_rw_cb_ud.iod[2].iod_type = DAOS_IOD_SINGLE;
@@ -2438,206 +2657,1202 @@ done:
 } /* end H5_daos_link_create() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_copy_move_task
+ * Function:    H5_daos_link_multi_trgt_cmp
  *
- * Purpose:     Asynchronous task for link copy or move operation.  Most
- *              of the work is done in H5_daos_link_copy_move_int(), this
- *              just  writes the target link once the source link has been
- *              read and the target group opened.  Also adjusts the target
- *              object's ref count if appropriate and schedules a task to
- *              finish link copy/move after the link write is complete.
+ * Purpose:     qsort() callback to sort bulk link creation targets by
+ *              OID.
  *
- * Return:      0 on success/Negative error code on failure
+ * Return:      Negative, zero or positive as the first target's OID is
+ *              less than, equal to or greater than the second's
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_link_copy_move_task(tse_task_t *task)
+H5_daos_link_multi_trgt_cmp(const void *_trgt1, const void *_trgt2)
 {
-    H5_daos_link_copy_move_ud_t *udata        = NULL;
-    H5_daos_req_t               *req          = NULL;
-    H5_daos_req_t               *int_int_req  = NULL;
-    tse_task_t                  *first_task   = NULL;
-    tse_task_t                  *dep_tasks[2] = {NULL, NULL};
-    int                          ndeps        = 0;
-    int                          ret;
-    int                          ret_value = 0;
-
-    /* Get private data */
-    if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for link copy task");
+    const H5_daos_link_create_multi_trgt_t *trgt1 = (const H5_daos_link_create_multi_trgt_t *)_trgt1;
+    const H5_daos_link_create_multi_trgt_t *trgt2 = (const H5_daos_link_create_multi_trgt_t *)_trgt2;
 
-    /* Assign req convenience pointer.  We do this so we can still handle errors
-     * after transferring ownership of udata.  This should be safe since we
-     * increase the ref count on req when we transfer ownership. */
-    req = udata->req;
+    if (trgt1->obj->oid.hi != trgt2->obj->oid.hi)
+        return trgt1->obj->oid.hi < trgt2->obj->oid.hi ? -1 : 1;
+    if (trgt1->obj->oid.lo != trgt2->obj->oid.lo)
+        return trgt1->obj->oid.lo < trgt2->obj->oid.lo ? -1 : 1;
 
-    /* Handle errors in previous tasks */
-    H5_DAOS_PREP_REQ(req, H5E_LINK);
-
-    /* Write link to destination object */
-    udata->link_val.target_oid_async = NULL;
-    if (0 != (ret = H5_daos_link_write((H5_daos_group_t *)udata->target_obj, udata->new_link_name,
-                                       udata->new_link_name_len, &udata->link_val, req, &first_task,
-                                       &dep_tasks[ndeps])))
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTCOPY, ret, "failed to write destination link: %s",
-                     H5_daos_err_to_string(ret));
-    if (dep_tasks[0])
-        ndeps++;
+    return 0;
+} /* end H5_daos_link_multi_trgt_cmp() */
 
-    if (udata->link_val.type == H5L_TYPE_HARD) {
-        if (udata->move) {
-            /* Verify that source and destination files are the same */
-            if (memcmp(&udata->req->file->coh, &udata->target_obj->item.file->coh, sizeof(daos_handle_t)))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTMOVE, -H5_DAOS_BAD_VALUE,
-                             "can't move hard links across files");
-        }
-        else {
-            H5VL_loc_params_t link_target_loc_params;
-            H5O_token_t       token;
-            int               rc_task = ndeps;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_multi_prep_cb
+ *
+ * Purpose:     Prepare callback for the update of one link in a bulk hard
+ *              link creation.  Encodes the link's creation order value,
+ *              if tracked, then sets arguments for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_create_multi_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_create_multi_ent_t *ent;
+    H5_daos_link_create_multi_ud_t  *udata;
+    daos_obj_rw_t                   *update_args;
+    uint8_t                         *p;
+    int                              ret_value = 0;
 
-            /* If we're copying a hard link we must increment the ref count */
+    /* Get private data */
+    if (NULL == (ent = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link write task");
+    udata = ent->multi_ud;
 
-            /* Verify src and dst files are the same? */
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_LINK);
 
-            /* Encode loc_params for opening link target object */
-            if (H5I_BADID ==
-                (link_target_loc_params.obj_type = H5_daos_oid_to_type(udata->link_val.target.hard)))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_BAD_VALUE,
-                             "failed to get link target object's type");
-            link_target_loc_params.type = H5VL_OBJECT_BY_TOKEN;
-            if (H5_daos_oid_to_token(udata->link_val.target.hard, &token) < 0)
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_H5_ENCODE_ERROR, "failed to encode token");
-            link_target_loc_params.loc_data.loc_by_token.token = &token;
+    /* Encode the link's creation order value.  Links are given consecutive
+     * values starting at the group's max. creation order value. */
+    if (udata->link_grp->gcpl_cache.track_corder) {
+        p = ent->corder_buf;
+        UINT64ENCODE(p, udata->max_corder + (uint64_t)(ent - udata->ents));
+    } /* end if */
 
-            /* Start internal H5 operation for target object open.  This will
-             * not be visible to the API, will not be added to an operation
-             * pool, and will be integrated into this function's task chain. */
-            if (NULL == (int_int_req = H5_daos_req_create(udata->target_obj->item.file,
-                                                          "target object open within link copy/move", NULL,
-                                                          NULL, req, H5I_INVALID_HID)))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't create DAOS request");
+    /* Add the link's name to the group's name filter, if it has one */
+    H5_daos_name_filter_add(udata->link_grp->obj.item.file, &udata->link_grp->obj.oid,
+                            H5_DAOS_NAME_FILTER_LINK, 0, (const char *)ent->dkey.iov_buf,
+                            (size_t)ent->dkey.iov_len);
 
-            /* Attempt to open the hard link's target object */
-            if (H5_daos_object_open_helper(&udata->target_obj->item, &link_target_loc_params, NULL, FALSE,
-                                           NULL, &udata->link_target_obj, int_int_req, &first_task,
-                                           &dep_tasks[rc_task]) < 0)
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, -H5_DAOS_H5_OPEN_ERROR,
-                             "couldn't open hard link's target object");
+    /* Set update task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for bulk link write task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh    = udata->link_grp->obj.obj_oh;
+    update_args->th    = udata->req->th;
+    update_args->flags = DAOS_COND_DKEY_INSERT;
+    update_args->dkey  = &ent->dkey;
+    update_args->nr    = udata->nr;
+    update_args->iods  = ent->iod;
+    update_args->sgls  = ent->sgl;
 
-            /* Create task to finalize internal operation */
-            if (H5_daos_create_task(H5_daos_h5op_finalize, dep_tasks[rc_task] ? 1 : 0,
-                                    dep_tasks[rc_task] ? &dep_tasks[rc_task] : NULL, NULL, NULL, int_int_req,
-                                    &int_int_req->finalize_task) < 0)
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                             "can't create task to finalize H5 operation");
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
 
-            /* Schedule finalize task (or save it to be scheduled later),
-             * give it ownership of int_int_req, and update task pointers */
-            if (first_task) {
-                if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
-                    D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
-                                 "can't schedule task to finalize H5 operation: %s",
-                                 H5_daos_err_to_string(ret));
-            } /* end if */
-            else
-                first_task = int_int_req->finalize_task;
-            dep_tasks[rc_task] = int_int_req->finalize_task;
-            int_int_req        = NULL;
-            ndeps++;
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_multi_prep_cb() */
 
-            /* Read target object ref count */
-            if (0 != (ret = H5_daos_obj_read_rc(&udata->link_target_obj, NULL, &udata->link_target_obj_rc,
-                                                NULL, req, &first_task, &dep_tasks[rc_task])))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't get target object ref count: %s",
-                             H5_daos_err_to_string(ret));
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_multi_corder_prep_cb
+ *
+ * Purpose:     Prepare callback for the creation order info update of a
+ *              bulk hard link creation.  Encodes the group's new max.
+ *              creation order value and number of links, and the keys
+ *              mapping the creation order index of each link that was
+ *              written to its name and target, then sets arguments for
+ *              the DAOS operation.  The creation order values of links
+ *              that were not written are left unused, which records the
+ *              layout version of the index if it was not recorded yet.
+ *              The private data is the first link's entry.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_create_multi_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_create_multi_ent_t *ents;
+    H5_daos_link_create_multi_ud_t  *udata;
+    daos_obj_rw_t                   *update_args;
+    hbool_t                          by_position;
+    uint8_t                         *p;
+    unsigned                         nr;
+    size_t                           nwritten;
+    size_t                           i;
+    int                              ret_value = 0;
 
-            /* Increment and write ref count */
-            if (0 != (ret = H5_daos_obj_write_rc(&udata->link_target_obj, NULL, &udata->link_target_obj_rc, 1,
-                                                 req, &first_task, &dep_tasks[rc_task])))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINC, ret, "can't write updated target object ref count: %s",
-                             H5_daos_err_to_string(ret));
-        }
-    }
+    /* Get private data */
+    if (NULL == (ents = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link creation order info write task");
+    udata = ents->multi_ud;
 
-done:
-    if (udata) {
-        tse_task_t *end_task = NULL;
+    /* Handle errors */
+    H5_DAOS_PREP_REQ(udata->req, H5E_LINK);
 
-        /* Create task to finalize copy task */
-        if (H5_daos_create_task(H5_daos_link_copy_move_end_task, (ndeps > 0) ? (unsigned)ndeps : 0,
-                                (ndeps > 0) ? dep_tasks : NULL, NULL, NULL, udata, &end_task) < 0) {
-            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                         "can't create task for link copy/move end");
-            tse_task_complete(task, ret_value);
-        }
-        else {
-            /* Schedule copy end task (or save it to be scheduled later) and
-             * give it ownership of udata, while keeping a reference to req for
-             * ourselves */
-            req->rc++;
-            if (first_task) {
-                if (0 != (ret = tse_task_schedule(end_task, false)))
-                    D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
-                                 "can't schedule task for link copy/move order end: %s",
-                                 H5_daos_err_to_string(ret));
-            } /* end if */
-            else
-                first_task = end_task;
-            udata        = NULL;
-            dep_tasks[0] = end_task;
-            ndeps        = 1;
-        } /* end else */
+    by_position =
+        H5_DAOS_LINK_CORDER_INDEX_BY_POSITION(udata->corder_version, udata->nlinks, udata->max_corder);
+
+    /* Encode creation order index keys for the links that were written,
+     * which are the links' creation order values (or positions, for an old
+     * index), and move their IODs and SGLs down over those of the links
+     * that were not written */
+    for (i = 0, nwritten = 0; i < udata->count; i++) {
+        if (!ents[i].written)
+            continue;
+
+        p = ents[i].corder_name_key;
+        UINT64ENCODE(p, by_position ? (uint64_t)udata->nlinks + (uint64_t)nwritten
+                                    : udata->max_corder + (uint64_t)i);
+        memcpy(ents[i].corder_target_key, ents[i].corder_name_key, H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+        ents[i].corder_target_key[H5_DAOS_ENCODED_CRT_ORDER_SIZE] = 0;
+
+        if (nwritten != i) {
+            udata->corder_iods[2 + 2 * nwritten] = udata->corder_iods[2 + 2 * i];
+            udata->corder_iods[3 + 2 * nwritten] = udata->corder_iods[3 + 2 * i];
+            udata->corder_sgls[2 + 2 * nwritten] = udata->corder_sgls[2 + 2 * i];
+            udata->corder_sgls[3 + 2 * nwritten] = udata->corder_sgls[3 + 2 * i];
+        } /* end if */
+        nwritten++;
+    } /* end for */
+    udata->nwritten = nwritten;
+    nr              = (unsigned)(2 + 2 * nwritten);
+
+    /* If values are skipped in an index that is not keyed by position,
+     * record its layout version if that has not been done yet.  The IOD and
+     * SGL after the last written link are free since at least one link was
+     * not written, but its SG IOV may still be in use by a moved SGL. */
+    if (nwritten < udata->count && !by_position && udata->corder_version == 0) {
+        udata->corder_version_new = H5_DAOS_LINK_CORDER_INDEX_VERSION;
+        daos_const_iov_set((d_const_iov_t *)&udata->corder_iods[nr].iod_name,
+                           H5_daos_link_corder_version_key_g, H5_daos_link_corder_version_key_size_g);
+        udata->corder_iods[nr].iod_nr   = 1u;
+        udata->corder_iods[nr].iod_size = (daos_size_t)1;
+        udata->corder_iods[nr].iod_type = DAOS_IOD_SINGLE;
+        daos_iov_set(&udata->corder_version_sg_iov, &udata->corder_version_new, (daos_size_t)1);
+        udata->corder_sgls[nr].sg_nr     = 1;
+        udata->corder_sgls[nr].sg_nr_out = 0;
+        udata->corder_sgls[nr].sg_iovs   = &udata->corder_version_sg_iov;
+        nr++;
+    } /* end if */
 
-        /* Schedule first task */
-        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
-            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule initial task for link copy/move: %s",
-                         H5_daos_err_to_string(ret));
+    /* Encode new max. creation order value and number of links.  The max.
+     * creation order value skips the values of all links in the batch. */
+    p = udata->max_corder_new_buf;
+    UINT64ENCODE(p, udata->max_corder + (uint64_t)udata->count);
+    p = udata->nlinks_new_buf;
+    UINT64ENCODE(p, (uint64_t)udata->nlinks + (uint64_t)nwritten);
 
-        /* Handle errors in this function */
-        /* Do not place any code that can issue errors after this block, except for
-         * H5_daos_req_free_int, which updates req->status if it sees an error */
-        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-            req->status      = ret_value;
-            req->failed_task = "link copy/move task";
-        } /* end if */
+    /* Set update task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for bulk link creation order info write task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->link_grp->obj.obj_oh;
+    update_args->th   = udata->req->th;
+    update_args->dkey = &udata->corder_dkey;
+    update_args->nr   = nr;
+    update_args->iods = udata->corder_iods;
+    update_args->sgls = udata->corder_sgls;
 
-        /* Release our reference to req */
-        if (H5_daos_req_free_int(req) < 0)
-            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-    } /* end if */
-    else {
-        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
-        /* Return task to task list */
-        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
-                         "can't return task to task list");
+done:
+    if (ret_value < 0)
         tse_task_complete(task, ret_value);
-    } /* end else */
-
-    /* Close internal request for target object open */
-    if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
-        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_copy_move_task() */
+} /* end H5_daos_link_create_multi_corder_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_copy_move_end_task
+ * Function:    H5_daos_link_create_multi_comp_cb
+ *
+ * Purpose:     Completion callback for the update of one link in a bulk
+ *              hard link creation.  Records whether the link was written.
+ *              A link that was not written, for example because its name
+ *              already exists, is left out of the group's creation order
+ *              info and its target's ref count, and its error is passed
+ *              to the request by the end task once the links that were
+ *              written have been accounted for.  The last link to
+ *              complete completes the links done task.  The private data
+ *              is freed by the end task.
  *
- * Purpose:     Finishes a link copy or move operation, freeing data and
- *              marking the main task complete.
- *
- * Return:      0 on success/Negative error code on failure
+ * Return:      Success:        0
+ *              Failure:        Error code
  *
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_link_copy_move_end_task(tse_task_t *task)
+H5_daos_link_create_multi_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_link_copy_move_ud_t *udata     = NULL;
+    H5_daos_link_create_multi_ent_t *ent;
+    H5_daos_link_create_multi_ud_t  *udata     = NULL;
+    int                              ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (ent = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link write task");
+    udata = ent->multi_ud;
+
+    /* Record the result of the update.  Errors from earlier tasks are
+     * already in the request. */
+    if (task->dt_result == 0)
+        ent->written = TRUE;
+    else {
+        udata->trgts[ent->trgt_idx].nlinks--;
+        if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->link_status == 0)
+            udata->link_status = task->dt_result;
+    } /* end else */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    if (udata) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "bulk link write completion callback";
+        } /* end if */
+
+        /* Let the tasks that account for the links run once all link updates
+         * are done.  links_done_task always succeeds, so the failure of one
+         * link does not stop them. */
+        assert(udata->nlinks_left > 0);
+        if (--udata->nlinks_left == 0 && udata->links_done_task)
+            tse_task_complete(udata->links_done_task, 0);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_multi_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_multi_corder_comp_cb
+ *
+ * Purpose:     Completion callback for the creation order info update of
+ *              a bulk hard link creation.  Records any error in the
+ *              request.  The private data is freed by the end task.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_create_multi_corder_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_create_multi_ent_t *ents;
+    int                              ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (ents = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link creation order info write task");
+
+    /* Handle errors in update task.  Only record error in req status if it
+     * does not already contain an error (it could contain an error if another
+     * task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && ents->multi_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        ents->multi_ud->req->status      = task->dt_result;
+        ents->multi_ud->req->failed_task = "bulk link creation order info write";
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Handle errors in this function */
+    if (ents && ret_value < -H5_DAOS_SHORT_CIRCUIT &&
+        ents->multi_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        ents->multi_ud->req->status      = ret_value;
+        ents->multi_ud->req->failed_task = "bulk link creation order info write completion callback";
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_multi_corder_comp_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_multi_rc_task
+ *
+ * Purpose:     Adds the number of links written to a target object of a
+ *              bulk hard link creation to the target's ref count, after
+ *              the ref count has been read and before it is written.  The
+ *              private data is the target.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_create_multi_rc_task(tse_task_t *task)
+{
+    H5_daos_link_create_multi_trgt_t *trgt;
+    int                               ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (trgt = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link target ref count task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(trgt->multi_ud->req, H5E_LINK);
+
+    assert(trgt->nlinks >= 0);
+    trgt->rc += (uint64_t)trgt->nlinks;
+
+done:
+    /* Handle errors in this function */
+    if (trgt && ret_value < -H5_DAOS_SHORT_CIRCUIT && trgt->multi_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        trgt->multi_ud->req->status      = ret_value;
+        trgt->multi_ud->req->failed_task = "bulk link target ref count task";
+    } /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_multi_rc_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_multi_tree_task
+ *
+ * Purpose:     Records the creation order values of the links of a bulk
+ *              hard link creation that were not written in the group's
+ *              deletion count tree, so lookups by index skip them like
+ *              the values of deleted links.  Does nothing if every link
+ *              was written or the index is keyed by position.  The
+ *              private data is the bulk link creation's private data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_create_multi_tree_task(tse_task_t *task)
+{
+    H5_daos_link_create_multi_ud_t *udata      = NULL;
+    tse_task_t                     *metatask   = NULL;
+    tse_task_t                     *first_task = NULL;
+    tse_task_t                     *dep_task   = NULL;
+    size_t                          nskipped;
+    size_t                          i;
+    int                             ret;
+    int                             ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link creation order deletion count task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_LINK);
+
+    /* Check if any values were skipped in an index keyed by creation order */
+    if (udata->nwritten == udata->count ||
+        H5_DAOS_LINK_CORDER_INDEX_BY_POSITION(udata->corder_version, udata->nlinks, udata->max_corder))
+        D_GOTO_DONE(0);
+
+    /* Gather the skipped values, in increasing order */
+    nskipped = udata->count - udata->nwritten;
+    if (NULL == (udata->skipped_corders = DV_malloc(nskipped * sizeof(uint64_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate buffer for skipped creation order values");
+    for (i = 0, nskipped = 0; i < udata->count; i++)
+        if (!udata->ents[i].written)
+            udata->skipped_corders[nskipped++] = udata->max_corder + (uint64_t)i;
+
+    /* Count the skipped values as deleted */
+    if (H5_daos_link_corder_tree_add(udata->link_grp, udata->skipped_corders, nskipped, udata->req,
+                                     &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't record skipped creation order values");
+
+done:
+    if (udata) {
+        /* Create metatask to complete this task after dep_task if necessary */
+        if (dep_task) {
+            /* Create metatask */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for bulk link creation order deletion count task");
+            else {
+                /* Schedule metatask */
+                assert(first_task);
+                if (0 != (ret = tse_task_schedule(metatask, false)))
+                    D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule metatask for bulk link creation order deletion count "
+                                 "task: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end else */
+        }     /* end if */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                         "can't schedule initial task for bulk link creation order deletion count task: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "bulk link creation order deletion count task";
+        } /* end if */
+    }     /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_multi_tree_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_multi_end_task
+ *
+ * Purpose:     Finalizes a bulk hard link creation, releasing the link
+ *              group and request and freeing data.
+ *
+ * Return:      Success:        0
+ *              Failure:        Negative
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_create_multi_end_task(tse_task_t *task)
+{
+    H5_daos_link_create_multi_ud_t *udata     = NULL;
+    int                             ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for bulk link create end task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ_DONE(udata->req);
+
+    /* Fail the operation if a link could not be written, now that the links
+     * that were written have been accounted for */
+    if (udata->link_status < -H5_DAOS_PRE_ERROR && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = udata->link_status;
+        udata->req->failed_task = "bulk link write";
+    } /* end if */
+
+    /* Close link group */
+    if (H5_daos_group_close_real(udata->link_grp) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "bulk link create end task";
+    } /* end if */
+
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Free udata */
+    DV_free(udata->names_buf);
+    DV_free(udata->ents);
+    DV_free(udata->update_tasks);
+    DV_free(udata->trgts);
+    DV_free(udata->corder_iods);
+    DV_free(udata->corder_sgls);
+    DV_free(udata->corder_sg_iovs);
+    DV_free(udata->skipped_corders);
+    udata = DV_free(udata);
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_multi_end_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_create_hard_multi
+ *
+ * Purpose:     Creates count hard links in grp, named names[i] and
+ *              pointing to objs[i], as one operation.  All link updates
+ *              are issued concurrently.  If the group tracks creation
+ *              order, its max. creation order value and number of links
+ *              are read once, and the new values and the creation order
+ *              index entries for all links are written in a single
+ *              update.  Target object ref counts are adjusted once per
+ *              distinct target.  Names must be single path components.
+ *              The links are not created atomically: if one of them
+ *              cannot be written, for example because it already exists,
+ *              the operation fails, but the other links are still written
+ *              and are counted in the group's number of links, creation
+ *              order index and their targets' ref counts.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_link_create_hard_multi(H5_daos_group_t *grp, size_t count, const char *const names[],
+                               H5_daos_obj_t *const objs[])
+{
+    H5_daos_link_create_multi_ud_t *udata      = NULL;
+    H5_daos_req_t                  *int_req    = NULL;
+    tse_task_t                     *first_task = NULL;
+    tse_task_t                     *dep_task   = NULL;
+    tse_task_t                     *start_task = NULL;
+    tse_task_t                     *links_task = NULL;
+    tse_task_t                     *tree_task  = NULL;
+    tse_task_t                    **end_deps   = NULL;
+    size_t                          end_ndeps  = 0;
+    size_t                          names_size = 0;
+    hbool_t                         collective = FALSE;
+    char                           *name_p;
+    size_t                          name_len;
+    size_t                          i, j;
+    int                             ret;
+    herr_t                          ret_value = SUCCEED;
+
+    assert(grp);
+    assert(names || count == 0);
+    assert(objs || count == 0);
+
+    /* Check for write access */
+    if (!(grp->obj.item.file->flags & H5F_ACC_RDWR))
+        D_GOTO_ERROR(H5E_FILE, H5E_BADVALUE, FAIL, "no write intent on file");
+
+    /* Wait for the group to open if necessary */
+    if (!grp->obj.item.created && grp->obj.item.open_req->status != 0) {
+        if (H5_daos_progress(grp->obj.item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't progress scheduler");
+        if (grp->obj.item.open_req->status != 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, FAIL, "group open failed");
+    } /* end if */
+
+    /* Check link names and targets, and wait for the targets to open if
+     * necessary so their OIDs are known */
+    for (i = 0; i < count; i++) {
+        if (!names[i] || !*names[i])
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link name is NULL or empty");
+        if (strchr(names[i], '/'))
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link name \"%s\" is not a single path component",
+                         names[i]);
+        if (!objs[i])
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link target object is NULL");
+        if (objs[i]->item.file != grp->obj.item.file)
+            D_GOTO_ERROR(H5E_ARGS, H5E_BADVALUE, FAIL, "link target object is not in the group's file");
+        if (!objs[i]->item.created && objs[i]->item.open_req->status != 0) {
+            if (H5_daos_progress(objs[i]->item.open_req, H5_DAOS_PROGRESS_WAIT) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't progress scheduler");
+            if (objs[i]->item.open_req->status != 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, FAIL, "link target object open failed");
+        } /* end if */
+
+        names_size += strlen(names[i]);
+    } /* end for */
+
+    /* Nothing to do if there are no links */
+    if (count == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    H5_DAOS_MAKE_ASYNC_PROGRESS(FAIL);
+
+    /*
+     * Determine if independent metadata writes have been requested. Otherwise,
+     * like HDF5, metadata writes are collective by default.
+     */
+    H5_DAOS_GET_METADATA_WRITE_MODE(grp->obj.item.file, H5P_LINK_ACCESS_DEFAULT, H5P_LINK_ACCESS_DEFAULT,
+                                    collective, H5E_LINK, FAIL);
+
+    /* Start H5 operation */
+    if (NULL == (int_req = H5_daos_req_create(grp->obj.item.file, "bulk hard link create",
+                                              grp->obj.item.open_req, NULL, NULL, H5P_DATASET_XFER_DEFAULT)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, FAIL, "can't create DAOS request");
+
+#ifdef H5_DAOS_USE_TRANSACTIONS
+    /* Start transaction */
+    if (0 != (ret = daos_tx_open(grp->obj.item.file->coh, &int_req->th, 0, NULL /*event*/)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't start transaction");
+    int_req->th_open = TRUE;
+#endif /* H5_DAOS_USE_TRANSACTIONS */
+
+    /* Create links if this process should */
+    if (!collective || (grp->obj.item.file->my_rank == 0)) {
+        /* Allocate task udata struct and give it a reference to grp and req */
+        if (NULL == (udata = (H5_daos_link_create_multi_ud_t *)DV_calloc(
+                         sizeof(H5_daos_link_create_multi_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate bulk link create user data");
+        udata->req = int_req;
+        int_req->rc++;
+        udata->link_grp = grp;
+        grp->obj.item.rc++;
+        H5_daos_name_filter_create(int_req);
+        udata->count = count;
+        udata->nr    = grp->gcpl_cache.track_corder ? 2 : 1;
+
+        /* Allocate buffers.  end_deps must hold the start task and all link
+         * update tasks, or the links task and the last task for each
+         * target. */
+        if (NULL == (udata->names_buf = (char *)DV_malloc(names_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate link name buffer");
+        if (NULL == (udata->ents = (H5_daos_link_create_multi_ent_t *)DV_calloc(
+                         count * sizeof(H5_daos_link_create_multi_ent_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate link entries");
+        if (NULL == (udata->update_tasks = (tse_task_t **)DV_malloc(count * sizeof(tse_task_t *))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate link update task array");
+        if (NULL == (udata->trgts = (H5_daos_link_create_multi_trgt_t *)DV_calloc(
+                         count * sizeof(H5_daos_link_create_multi_trgt_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate link target array");
+        if (NULL == (end_deps = (tse_task_t **)DV_malloc((count + 2) * sizeof(tse_task_t *))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate task dependency array");
+        if (grp->gcpl_cache.track_corder) {
+            if (NULL == (udata->corder_iods = (daos_iod_t *)DV_calloc((2 + 2 * count) * sizeof(daos_iod_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate creation order IODs");
+            if (NULL ==
+                (udata->corder_sgls = (daos_sg_list_t *)DV_calloc((2 + 2 * count) * sizeof(daos_sg_list_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate creation order SGLs");
+            if (NULL ==
+                (udata->corder_sg_iovs = (daos_iov_t *)DV_calloc((2 + 2 * count) * sizeof(daos_iov_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate creation order SG IOVs");
+        } /* end if */
+
+        /* Set up link entries */
+        name_p = udata->names_buf;
+        for (i = 0; i < count; i++) {
+            H5_daos_link_create_multi_ent_t *ent = &udata->ents[i];
+            H5_daos_link_val_t               link_val;
+
+            ent->multi_ud = udata;
+
+            /* Copy name and encode link value */
+            name_len = strlen(names[i]);
+            (void)memcpy(name_p, names[i], name_len);
+            link_val.type        = H5L_TYPE_HARD;
+            link_val.target.hard = objs[i]->oid;
+            H5_DAOS_ENCODE_LINK_VALUE(ent->link_val_buf, H5_DAOS_HARD_LINK_VAL_SIZE, link_val, H5L_TYPE_HARD);
+
+            /* Set up dkey */
+            daos_iov_set(&ent->dkey, (void *)name_p, (daos_size_t)name_len);
+            name_p += name_len;
+
+            /* Set up link value IOD and SGL */
+            daos_const_iov_set((d_const_iov_t *)&ent->iod[0].iod_name, H5_daos_link_key_g,
+                               H5_daos_link_key_size_g);
+            ent->iod[0].iod_nr   = 1u;
+            ent->iod[0].iod_size = (uint64_t)H5_DAOS_HARD_LINK_VAL_SIZE;
+            ent->iod[0].iod_type = DAOS_IOD_SINGLE;
+            daos_iov_set(&ent->sg_iov[0], ent->link_val_buf, (daos_size_t)H5_DAOS_HARD_LINK_VAL_SIZE);
+            ent->sgl[0].sg_nr     = 1;
+            ent->sgl[0].sg_nr_out = 0;
+            ent->sgl[0].sg_iovs   = &ent->sg_iov[0];
+
+            if (grp->gcpl_cache.track_corder) {
+                daos_iod_t     *corder_iods    = &udata->corder_iods[2 + 2 * i];
+                daos_sg_list_t *corder_sgls    = &udata->corder_sgls[2 + 2 * i];
+                daos_iov_t     *corder_sg_iovs = &udata->corder_sg_iovs[2 + 2 * i];
+
+                /* Set up creation order IOD and SGL in the link's dkey.  The
+                 * value is encoded by the prep callback. */
+                daos_const_iov_set((d_const_iov_t *)&ent->iod[1].iod_name, H5_daos_link_corder_key_g,
+                                   H5_daos_link_corder_key_size_g);
+                ent->iod[1].iod_nr   = 1u;
+                ent->iod[1].iod_size = (uint64_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+                ent->iod[1].iod_type = DAOS_IOD_SINGLE;
+                daos_iov_set(&ent->sg_iov[1], ent->corder_buf, (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+                ent->sgl[1].sg_nr     = 1;
+                ent->sgl[1].sg_nr_out = 0;
+                ent->sgl[1].sg_iovs   = &ent->sg_iov[1];
+
+                /* Set up IODs and SGLs mapping the link's creation order value
+                 * to its name and target.  The keys are encoded by the
+                 * creation order info prep callback. */
+                daos_iov_set(&corder_iods[0].iod_name, (void *)ent->corder_name_key,
+                             H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+                corder_iods[0].iod_nr   = 1u;
+                corder_iods[0].iod_size = (uint64_t)name_len;
+                corder_iods[0].iod_type = DAOS_IOD_SINGLE;
+                daos_iov_set(&corder_sg_iovs[0], ent->dkey.iov_buf, (daos_size_t)name_len);
+                corder_sgls[0].sg_nr     = 1;
+                corder_sgls[0].sg_nr_out = 0;
+                corder_sgls[0].sg_iovs   = &corder_sg_iovs[0];
+
+                daos_iov_set(&corder_iods[1].iod_name, (void *)ent->corder_target_key,
+                             H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE);
+                corder_iods[1].iod_nr   = 1u;
+                corder_iods[1].iod_size = (uint64_t)H5_DAOS_HARD_LINK_VAL_SIZE;
+                corder_iods[1].iod_type = DAOS_IOD_SINGLE;
+                daos_iov_set(&corder_sg_iovs[1], ent->link_val_buf, (daos_size_t)H5_DAOS_HARD_LINK_VAL_SIZE);
+                corder_sgls[1].sg_nr     = 1;
+                corder_sgls[1].sg_nr_out = 0;
+                corder_sgls[1].sg_iovs   = &corder_sg_iovs[1];
+            } /* end if */
+
+            udata->trgts[i].multi_ud = udata;
+            udata->trgts[i].obj      = objs[i];
+            udata->trgts[i].nlinks   = 1;
+        } /* end for */
+
+        /* Merge targets that appear more than once so each target's ref count
+         * is updated once */
+        qsort(udata->trgts, count, sizeof(H5_daos_link_create_multi_trgt_t), H5_daos_link_multi_trgt_cmp);
+        for (i = 1, j = 0; i < count; i++)
+            if (H5_daos_link_multi_trgt_cmp(&udata->trgts[i], &udata->trgts[j]) != 0)
+                udata->trgts[++j] = udata->trgts[i];
+            else
+                udata->trgts[j].nlinks++;
+        udata->ntrgts = j + 1;
+
+        /* Find each link's target, so links that are not written can be
+         * taken off their target's ref count adjustment */
+        for (i = 0; i < count; i++) {
+            H5_daos_link_create_multi_trgt_t  key;
+            H5_daos_link_create_multi_trgt_t *trgt;
+
+            key.obj = objs[i];
+            trgt    = (H5_daos_link_create_multi_trgt_t *)bsearch(
+                &key, udata->trgts, udata->ntrgts, sizeof(H5_daos_link_create_multi_trgt_t),
+                H5_daos_link_multi_trgt_cmp);
+            assert(trgt);
+            udata->ents[i].trgt_idx = (size_t)(trgt - udata->trgts);
+        } /* end for */
+
+        if (grp->gcpl_cache.track_corder) {
+            /* Set up creation order info dkey */
+            daos_const_iov_set((d_const_iov_t *)&udata->corder_dkey, H5_daos_link_corder_key_g,
+                               H5_daos_link_corder_key_size_g);
+
+            /* Set up IODs and SGLs for the max. creation order value and number
+             * of links */
+            daos_const_iov_set((d_const_iov_t *)&udata->corder_iods[0].iod_name,
+                               H5_daos_max_link_corder_key_g, H5_daos_max_link_corder_key_size_g);
+            udata->corder_iods[0].iod_nr   = 1u;
+            udata->corder_iods[0].iod_size = (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE;
+            udata->corder_iods[0].iod_type = DAOS_IOD_SINGLE;
+            daos_iov_set(&udata->corder_sg_iovs[0], udata->max_corder_new_buf,
+                         (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+            udata->corder_sgls[0].sg_nr     = 1;
+            udata->corder_sgls[0].sg_nr_out = 0;
+            udata->corder_sgls[0].sg_iovs   = &udata->corder_sg_iovs[0];
+
+            daos_const_iov_set((d_const_iov_t *)&udata->corder_iods[1].iod_name, H5_daos_nlinks_key_g,
+                               H5_daos_nlinks_key_size_g);
+            udata->corder_iods[1].iod_nr   = 1u;
+            udata->corder_iods[1].iod_size = (daos_size_t)H5_DAOS_ENCODED_NUM_LINKS_SIZE;
+            udata->corder_iods[1].iod_type = DAOS_IOD_SINGLE;
+            daos_iov_set(&udata->corder_sg_iovs[1], udata->nlinks_new_buf,
+                         (daos_size_t)H5_DAOS_ENCODED_NUM_LINKS_SIZE);
+            udata->corder_sgls[1].sg_nr     = 1;
+            udata->corder_sgls[1].sg_nr_out = 0;
+            udata->corder_sgls[1].sg_iovs   = &udata->corder_sg_iovs[1];
+
+            /* Read group's current maximum creation order value, index layout
+             * version and number of links, once for all links */
+            if (H5_daos_group_get_max_crt_order(grp, &udata->max_corder, &udata->corder_version, int_req,
+                                                &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get group's maximum creation order value");
+            if (H5_daos_group_get_num_links(grp, &udata->nlinks, int_req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_SYM, H5E_CANTGET, FAIL, "can't get number of links in group");
+        } /* end if */
+
+        /* Create metatask for the link updates to depend on */
+        if (H5_daos_create_task(H5_daos_metatask_autocomplete, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                                NULL, NULL, NULL, &start_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create metatask for bulk link create");
+
+        /* Schedule metatask (or save it to be scheduled later) */
+        if (first_task) {
+            if (0 != (ret = tse_task_schedule(start_task, false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule metatask for bulk link create: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = start_task;
+        end_deps[end_ndeps++] = start_task;
+
+        /* Create and schedule link update tasks.  These all run concurrently.
+         * The update tasks' completion callbacks count down nlinks_left. */
+        for (i = 0; i < count; i++) {
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, &start_task,
+                                         H5_daos_link_create_multi_prep_cb, H5_daos_link_create_multi_comp_cb,
+                                         &udata->ents[i], &udata->update_tasks[i]) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to write link");
+            if (0 != (ret = tse_task_schedule(udata->update_tasks[i], false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule task to write link: %s",
+                             H5_daos_err_to_string(ret));
+            udata->nlinks_left++;
+            end_deps[end_ndeps++] = udata->update_tasks[i];
+        } /* end for */
+
+        /* Create task to be completed by the last link update.  The tasks
+         * that account for the links depend on it instead of on the update
+         * tasks, so they run even if some of the links could not be
+         * written. */
+        if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &udata->links_done_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to wait for link updates");
+        if (0 != (ret = tse_task_schedule(udata->links_done_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule task to wait for link updates: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Create task to write creation order info for the links that were
+         * written */
+        if (grp->gcpl_cache.track_corder) {
+            if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, &udata->links_done_task,
+                                         H5_daos_link_create_multi_corder_prep_cb,
+                                         H5_daos_link_create_multi_corder_comp_cb, udata->ents,
+                                         &links_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                             "can't create task to write link creation order info");
+            if (0 != (ret = tse_task_schedule(links_task, false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                             "can't schedule task to write link creation order info: %s",
+                             H5_daos_err_to_string(ret));
+
+            /* Create task to count the creation order values of links that
+             * were not written as deleted */
+            if (H5_daos_create_task(H5_daos_link_create_multi_tree_task, 1, &links_task, NULL, NULL, udata,
+                                    &tree_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                             "can't create task to update link creation order deletion counts");
+            if (0 != (ret = tse_task_schedule(tree_task, false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                             "can't schedule task to update link creation order deletion counts: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            links_task = udata->links_done_task;
+        end_ndeps             = 0;
+        end_deps[end_ndeps++] = links_task;
+        if (tree_task)
+            end_deps[end_ndeps++] = tree_task;
+
+        /* Add the links that were written to the target objects' ref counts
+         * once all link updates are done */
+        for (i = 0; i < udata->ntrgts; i++) {
+            tse_task_t *rc_task = NULL;
+
+            dep_task = links_task;
+
+            /* Read target object ref count */
+            if (0 != (ret = H5_daos_obj_read_rc(NULL, udata->trgts[i].obj, &udata->trgts[i].rc, NULL, int_req,
+                                                &first_task, &dep_task)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't get target object ref count: %s",
+                             H5_daos_err_to_string(ret));
+
+            /* Add the number of links written to the ref count */
+            if (H5_daos_create_task(H5_daos_link_create_multi_rc_task, 1, &dep_task, NULL, NULL,
+                                    &udata->trgts[i], &rc_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to adjust target ref count");
+            if (0 != (ret = tse_task_schedule(rc_task, false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                             "can't schedule task to adjust target ref count: %s",
+                             H5_daos_err_to_string(ret));
+            dep_task = rc_task;
+
+            /* Write ref count */
+            if (0 != (ret = H5_daos_obj_write_rc(NULL, udata->trgts[i].obj, &udata->trgts[i].rc, 0, int_req,
+                                                 &first_task, &dep_task)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINC, FAIL, "can't write updated target object ref count: %s",
+                             H5_daos_err_to_string(ret));
+            end_deps[end_ndeps++] = dep_task;
+        } /* end for */
+    }     /* end if */
+
+done:
+    dep_task = NULL;
+
+    /* Create task to free udata once all tasks using it are complete */
+    if (udata) {
+        tse_task_t *end_task = NULL;
+
+        assert(int_req);
+
+        if (H5_daos_create_task(H5_daos_link_create_multi_end_task, (unsigned)end_ndeps,
+                                end_ndeps > 0 ? end_deps : NULL, NULL, NULL, udata, &end_task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create end task for bulk link create");
+        else {
+            /* Schedule end task (or save it to be scheduled later) and give it
+             * a reference to req and udata */
+            if (first_task) {
+                if (0 != (ret = tse_task_schedule(end_task, false)))
+                    D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                                 "can't schedule end task for bulk link create: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                first_task = end_task;
+            dep_task = end_task;
+            udata    = NULL;
+        } /* end else */
+    }     /* end if */
+    end_deps = DV_free(end_deps);
+
+    if (int_req) {
+        /* Perform collective error check */
+        if (collective && grp->obj.item.file->num_procs > 1)
+            if (H5_daos_collective_error_check(&grp->obj, int_req, &first_task, &dep_task) < 0)
+                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't perform collective error check");
+
+        /* Create task to finalize H5 operation */
+        if (H5_daos_create_task(H5_daos_h5op_finalize, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, int_req, &int_req->finalize_task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to finalize H5 operation");
+        /* Schedule finalize task */
+        else if (0 != (ret = tse_task_schedule(int_req->finalize_task, false)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't schedule task to finalize H5 operation: %s",
+                         H5_daos_err_to_string(ret));
+        else
+            /* finalize_task now owns a reference to req */
+            int_req->rc++;
+
+        /* If there was an error during setup, pass it to the request */
+        if (ret_value < 0)
+            int_req->status = -H5_DAOS_SETUP_ERROR;
+
+        /* Add the request to the group's request queue.  This will add the
+         * dependency on the group open if necessary.  The operation is
+         * ordered if the group tracks creation order, since it reads and
+         * writes the group's creation order info. */
+        if (H5_daos_req_enqueue(int_req, first_task, &grp->obj.item,
+                                grp->gcpl_cache.track_corder ? H5_DAOS_OP_TYPE_WRITE_ORDERED
+                                                             : H5_DAOS_OP_TYPE_WRITE,
+                                H5_DAOS_OP_SCOPE_OBJ, collective, TRUE) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't add request to request queue");
+
+        /* Block until operation completes */
+        if (H5_daos_progress(int_req, H5_DAOS_PROGRESS_WAIT) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't progress scheduler");
+
+        /* Check for failure */
+        if (int_req->status < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CANTOPERATE, FAIL, "bulk link creation failed in task \"%s\": %s",
+                         int_req->failed_task, H5_daos_err_to_string(int_req->status));
+
+        /* Close internal request */
+        if (H5_daos_req_free_int(int_req) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, FAIL, "can't free request");
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_create_hard_multi() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_copy_move_task
+ *
+ * Purpose:     Asynchronous task for link copy or move operation.  Most
+ *              of the work is done in H5_daos_link_copy_move_int(), this
+ *              just  writes the target link once the source link has been
+ *              read and the target group opened.  Also adjusts the target
+ *              object's ref count if appropriate and schedules a task to
+ *              finish link copy/move after the link write is complete.
+ *
+ * Return:      0 on success/Negative error code on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_copy_move_task(tse_task_t *task)
+{
+    H5_daos_link_copy_move_ud_t *udata        = NULL;
+    H5_daos_req_t               *req          = NULL;
+    H5_daos_req_t               *int_int_req  = NULL;
+    tse_task_t                  *first_task   = NULL;
+    tse_task_t                  *dep_tasks[2] = {NULL, NULL};
+    int                          ndeps        = 0;
+    int                          ret;
+    int                          ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link copy task");
+
+    /* Assign req convenience pointer.  We do this so we can still handle errors
+     * after transferring ownership of udata.  This should be safe since we
+     * increase the ref count on req when we transfer ownership. */
+    req = udata->req;
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(req, H5E_LINK);
+
+    /* Write link to destination object */
+    udata->link_val.target_oid_async = NULL;
+    if (0 != (ret = H5_daos_link_write((H5_daos_group_t *)udata->target_obj, udata->new_link_name,
+                                       udata->new_link_name_len, &udata->link_val, req, &first_task,
+                                       &dep_tasks[ndeps])))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTCOPY, ret, "failed to write destination link: %s",
+                     H5_daos_err_to_string(ret));
+    if (dep_tasks[0])
+        ndeps++;
+
+    if (udata->link_val.type == H5L_TYPE_HARD) {
+        if (udata->move) {
+            /* Verify that source and destination files are the same */
+            if (memcmp(&udata->req->file->coh, &udata->target_obj->item.file->coh, sizeof(daos_handle_t)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTMOVE, -H5_DAOS_BAD_VALUE,
+                             "can't move hard links across files");
+        }
+        else {
+            H5VL_loc_params_t link_target_loc_params;
+            H5O_token_t       token;
+            int               rc_task = ndeps;
+
+            /* If we're copying a hard link we must increment the ref count */
+
+            /* Verify src and dst files are the same? */
+
+            /* Encode loc_params for opening link target object */
+            if (H5I_BADID ==
+                (link_target_loc_params.obj_type = H5_daos_oid_to_type(udata->link_val.target.hard)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_BAD_VALUE,
+                             "failed to get link target object's type");
+            link_target_loc_params.type = H5VL_OBJECT_BY_TOKEN;
+            if (H5_daos_oid_to_token(udata->link_val.target.hard, &token) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_H5_ENCODE_ERROR, "failed to encode token");
+            link_target_loc_params.loc_data.loc_by_token.token = &token;
+
+            /* Start internal H5 operation for target object open.  This will
+             * not be visible to the API, will not be added to an operation
+             * pool, and will be integrated into this function's task chain. */
+            if (NULL == (int_int_req = H5_daos_req_create(udata->target_obj->item.file,
+                                                          "target object open within link copy/move", NULL,
+                                                          NULL, req, H5I_INVALID_HID)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't create DAOS request");
+
+            /* Attempt to open the hard link's target object */
+            if (H5_daos_object_open_helper(&udata->target_obj->item, &link_target_loc_params, NULL, FALSE,
+                                           NULL, &udata->link_target_obj, int_int_req, &first_task,
+                                           &dep_tasks[rc_task]) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTOPENOBJ, -H5_DAOS_H5_OPEN_ERROR,
+                             "couldn't open hard link's target object");
+
+            /* Create task to finalize internal operation */
+            if (H5_daos_create_task(H5_daos_h5op_finalize, dep_tasks[rc_task] ? 1 : 0,
+                                    dep_tasks[rc_task] ? &dep_tasks[rc_task] : NULL, NULL, NULL, int_int_req,
+                                    &int_int_req->finalize_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task to finalize H5 operation");
+
+            /* Schedule finalize task (or save it to be scheduled later),
+             * give it ownership of int_int_req, and update task pointers */
+            if (first_task) {
+                if (0 != (ret = tse_task_schedule(int_int_req->finalize_task, false)))
+                    D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule task to finalize H5 operation: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                first_task = int_int_req->finalize_task;
+            dep_tasks[rc_task] = int_int_req->finalize_task;
+            int_int_req        = NULL;
+            ndeps++;
+
+            /* Read target object ref count */
+            if (0 != (ret = H5_daos_obj_read_rc(&udata->link_target_obj, NULL, &udata->link_target_obj_rc,
+                                                NULL, req, &first_task, &dep_tasks[rc_task])))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't get target object ref count: %s",
+                             H5_daos_err_to_string(ret));
+
+            /* Increment and write ref count */
+            if (0 != (ret = H5_daos_obj_write_rc(&udata->link_target_obj, NULL, &udata->link_target_obj_rc, 1,
+                                                 req, &first_task, &dep_tasks[rc_task])))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINC, ret, "can't write updated target object ref count: %s",
+                             H5_daos_err_to_string(ret));
+        }
+    }
+
+done:
+    if (udata) {
+        tse_task_t *end_task = NULL;
+
+        /* Create task to finalize copy task */
+        if (H5_daos_create_task(H5_daos_link_copy_move_end_task, (ndeps > 0) ? (unsigned)ndeps : 0,
+                                (ndeps > 0) ? dep_tasks : NULL, NULL, NULL, udata, &end_task) < 0) {
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task for link copy/move end");
+            tse_task_complete(task, ret_value);
+        }
+        else {
+            /* Schedule copy end task (or save it to be scheduled later) and
+             * give it ownership of udata, while keeping a reference to req for
+             * ourselves */
+            req->rc++;
+            if (first_task) {
+                if (0 != (ret = tse_task_schedule(end_task, false)))
+                    D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule task for link copy/move order end: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                first_task = end_task;
+            udata        = NULL;
+            dep_tasks[0] = end_task;
+            ndeps        = 1;
+        } /* end else */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule initial task for link copy/move: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            req->status      = ret_value;
+            req->failed_task = "link copy/move task";
+        } /* end if */
+
+        /* Release our reference to req */
+        if (H5_daos_req_free_int(req) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+    } /* end if */
+    else {
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end else */
+
+    /* Close internal request for target object open */
+    if (int_int_req && H5_daos_req_free_int(int_int_req) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_copy_move_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_copy_move_end_task
+ *
+ * Purpose:     Finishes a link copy or move operation, freeing data and
+ *              marking the main task complete.
+ *
+ * Return:      0 on success/Negative error code on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_copy_move_end_task(tse_task_t *task)
+{
+    H5_daos_link_copy_move_ud_t *udata     = NULL;
     int                          ret_value = 0;
 
     /* Get private data */
@@ -2726,6 +3941,13 @@ H5_daos_link_copy_move_int(H5_daos_item_t *src_item, const H5VL_loc_params_t *lo
     assert(loc_params2);
     assert(loc_params2->type == H5VL_OBJECT_BY_NAME);
 
+    /* Cached paths through the moved link may no longer resolve to the same
+     * groups, in this or any other file handle for the container.  The
+     * source link is only deleted on rank 0 for collective moves, so
+     * invalidate here so every rank drops them. */
+    if (move)
+        H5_daos_file_invalidate_path_caches(req->file);
+
     if (!collective || (req->file->my_rank == 0)) {
         /* Allocate task udata struct */
         if (NULL ==
@@ -4635,6 +5857,15 @@ H5_daos_link_exists_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
     assert(udata->target_obj);
     assert(udata->req->file);
 
+    /* Skip the fetch if the group's name filter shows the link does not
+     * exist.  iod_size is left at 0, so the completion callback reports the
+     * link as missing. */
+    if (H5_daos_name_filter_absent(udata->target_obj, H5_DAOS_NAME_FILTER_LINK,
+                                   (const char *)udata->dkey.iov_buf, (size_t)udata->dkey.iov_len)) {
+        tse_task_complete(task, 0);
+        D_GOTO_DONE(0);
+    } /* end if */
+
     /* Set update task arguments */
     if (NULL == (rw_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -4947,12 +6178,24 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
             uint32_t i;
             char    *p = udata->sg_iov.iov_buf;
 
+            /* Start filling the group's name filter with the first batch of
+             * link names */
+            if (!udata->name_filter_gen &&
+                H5_daos_name_filter_begin(udata->target_obj->item.file, &udata->target_obj->oid,
+                                          H5_DAOS_NAME_FILTER_LINK, &udata->name_filter_gen) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_ALLOC_ERROR, "can't start name filter");
+
             /* Loop over returned dkeys */
             for (i = 0; i < udata->nr; i++) {
                 /* Check if this key represents a link */
                 if (p[0] != '/') {
                     char tmp_char;
 
+                    /* Add the link's name to the name filter */
+                    H5_daos_name_filter_add(udata->target_obj->item.file, &udata->target_obj->oid,
+                                            H5_DAOS_NAME_FILTER_LINK, udata->name_filter_gen, p,
+                                            udata->kds[i].kd_key_len);
+
                     /* Allocate iter op udata */
                     if (NULL == (iter_op_udata = (H5_daos_link_iter_op_ud_t *)DV_calloc(
                                      sizeof(H5_daos_link_iter_op_ud_t))))
@@ -5005,6 +6248,11 @@ H5_daos_link_iterate_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
                 p += udata->kds[i].kd_key_len;
             } /* end for */
 
+            /* All of the group's link names are now in the name filter */
+            if (daos_anchor_is_eof(&udata->anchor))
+                H5_daos_name_filter_end(udata->target_obj->item.file, &udata->target_obj->oid,
+                                        H5_DAOS_NAME_FILTER_LINK, udata->name_filter_gen);
+
             /* Continue iteration if we're not done */
             if (!daos_anchor_is_eof(&udata->anchor) && (req->status == -H5_DAOS_INCOMPLETE)) {
                 if (0 !=
@@ -5631,8 +6879,10 @@ H5_daos_link_ibco_end_task(tse_task_t *task)
     if (H5_daos_group_close_real(udata->target_grp) < 0)
         D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close object");
 
-    /* Free name buffer */
+    /* Free name buffer and creation order index listing */
     udata->name_buf = DV_free(udata->name_buf);
+    udata->corders  = DV_free(udata->corders);
+    DV_free(udata->list_data.sg_iov.iov_buf);
 
     /* Free udata */
     udata = DV_free(udata);
@@ -6180,92 +7430,418 @@ H5_daos_link_ibco_task(tse_task_t *task)
                          "creation order is not tracked for group");
     } /* end if */
 
-    /* Make sure this index is within the bounds */
-    if (udata->crt_idx < udata->grp_nlinks) {
-        tse_task_t *task2_task = NULL;
+    /* Before the first link, check if links have been deleted from the
+     * group, leaving gaps in its creation order index.  If so, list the
+     * index once to find the creation order values of the links, instead of
+     * looking up each link through the deletion count tree.  Each step
+     * comes back to this task once its tasks complete. */
+    if (udata->crt_idx < udata->grp_nlinks && !udata->corders_checked) {
+        if (!udata->max_corder_read) {
+            /* Retrieve the group's max. creation order value and index
+             * layout version */
+            if (H5_daos_group_get_max_crt_order(udata->target_grp, &udata->grp_max_corder,
+                                                &udata->grp_corder_version, req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
+                             "can't get group's max creation order value");
+            udata->max_corder_read = TRUE;
+        } /* end if */
+        else {
+            /* Version 0 indices are keyed by position and have no gaps */
+            udata->corders_checked = TRUE;
+            if (udata->grp_corder_version != 0 && (uint64_t)udata->grp_nlinks != udata->grp_max_corder)
+                if (H5_daos_link_ibco_list_corders(udata, &first_task, &dep_task) < 0)
+                    D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                                 "can't list link creation order index");
+        } /* end else */
+
+        /* Come back to this task once the tasks started above complete */
+        if (dep_task) {
+            tse_task_t *next_task = NULL;
+
+            if (H5_daos_create_task(H5_daos_link_ibco_task, 1, &dep_task, NULL, NULL, udata, &next_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create task for link iterate by creation order");
+
+            /* Schedule ibco task (or save it to be scheduled later) and
+             * transfer ownership of udata */
+            if (first_task) {
+                if (0 != (ret = tse_task_schedule(next_task, false)))
+                    D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule task for link iterate by creation order: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end if */
+            else
+                first_task = next_task;
+            dep_task = next_task;
+            udata    = NULL;
+
+            D_GOTO_DONE(0);
+        } /* end if */
+    }     /* end if */
+
+    /* Make sure this index is within the bounds */
+    if (udata->crt_idx < udata->grp_nlinks) {
+        tse_task_t *task2_task = NULL;
+
+        /* Get link name, directly by creation order value if the index was
+         * listed */
+        if (udata->corders) {
+            size_t pos = H5_ITER_DEC == udata->iter_data->iter_order
+                             ? udata->ncorders - (size_t)udata->crt_idx - 1
+                             : (size_t)udata->crt_idx;
+
+            if (H5_daos_link_get_name_by_idx_alloc_int(
+                    udata->target_grp, H5_INDEX_CRT_ORDER, udata->iter_data->iter_order, udata->corders[pos],
+                    TRUE, &udata->link_name, &udata->link_name_len, &udata->name_buf, &udata->name_buf_size,
+                    udata->iter_data->req, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
+        } /* end if */
+        else if (H5_daos_link_get_name_by_idx_alloc(
+                     udata->target_grp, H5_INDEX_CRT_ORDER, udata->iter_data->iter_order,
+                     (uint64_t)udata->crt_idx, &udata->link_name, &udata->link_name_len, &udata->name_buf,
+                     &udata->name_buf_size, udata->iter_data->req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
+
+        /* Create task to continue this operation */
+        if (H5_daos_create_task(H5_daos_link_ibco_task2, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
+                                NULL, udata, &task2_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task 2 for link iterate by creation order");
+
+        /* Schedule ibco task 2 (or save it to be scheduled later) and give it a
+         * reference to req and udata */
+        if (first_task) {
+            if (0 != (ret = tse_task_schedule(task2_task, false)))
+                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                             "can't schedule task 2 for link get name by name order: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = task2_task;
+        dep_task = task2_task;
+        udata    = NULL;
+    } /* end if */
+    else
+        assert(udata->grp_nlinks == 0);
+
+done:
+    if (udata) {
+        /* If we still own udata then the iteration is complete, schedule
+         * metatask */
+        /* Register task dependency */
+        if (dep_task && 0 != (ret = tse_task_register_deps(udata->ibco_metatask, 1, &dep_task)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                         "can't create dependencies for link iterate by creation order metatask: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Schedule metatsk (or save it to be scheduled later) and transfer
+         * ownershiop of udata */
+        if (first_task) {
+            if (0 != (ret = tse_task_schedule(udata->ibco_metatask, false)))
+                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                             "can't schedule metatask for link iterate by creation order: %s",
+                             H5_daos_err_to_string(ret));
+        } /* end if */
+        else
+            first_task = udata->ibco_metatask;
+        dep_task = udata->ibco_metatask;
+        udata    = NULL;
+    } /* end if */
+
+    /* Schedule first task */
+    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+        D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule initial task for link iteration op: %s",
+                     H5_daos_err_to_string(ret));
+
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except for
+     * H5_daos_req_free_int, which updates req->status if it sees an error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        req->status      = ret_value;
+        req->failed_task = "link iteration by creation order task";
+    } /* end if */
+
+    /* Release req */
+    if (req && H5_daos_req_free_int(req) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    /* Make sure we cleaned up */
+    assert(!udata);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_ibco_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_ibco_list_corders
+ *
+ * Purpose:     Creates a task to list the akeys of a group's creation
+ *              order index, for iteration by creation order when the
+ *              index has gaps.  The creation order values of the links
+ *              are collected in udata->corders and sorted once the
+ *              listing is complete.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_link_ibco_list_corders(H5_daos_link_ibco_ud_t *udata, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    tse_task_t *list_task = NULL;
+    void       *key_buf;
+    int         ret;
+    herr_t      ret_value = SUCCEED;
+
+    assert(udata);
+    assert(!udata->corders);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate array for the creation order values, sized for the links in
+     * the group when iteration started */
+    udata->corders_nalloc = (size_t)udata->grp_nlinks;
+    if (NULL == (udata->corders = (uint64_t *)DV_malloc(udata->corders_nalloc * sizeof(uint64_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate creation order value array");
+    udata->ncorders = 0;
+
+    /* Set up dkey and key buffer */
+    daos_const_iov_set((d_const_iov_t *)&udata->list_data.dkey, H5_daos_link_corder_key_g,
+                       H5_daos_link_corder_key_size_g);
+    if (NULL == (key_buf = DV_malloc(H5_DAOS_ITER_SIZE_INIT)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate buffer for akeys");
+    daos_iov_set(&udata->list_data.sg_iov, key_buf, (daos_size_t)H5_DAOS_ITER_SIZE_INIT);
+    udata->list_data.sgl.sg_nr   = 1;
+    udata->list_data.sgl.sg_iovs = &udata->list_data.sg_iov;
+
+    /* Create task to list the index.  It is re-initialized until all akeys
+     * have been listed. */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_LIST_AKEY, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                                 H5_daos_link_ibco_list_prep_cb, H5_daos_link_ibco_list_comp_cb, udata,
+                                 &list_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to list link creation order index");
+
+    /* Schedule list task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(list_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                         "can't schedule task to list link creation order index: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = list_task;
+    *dep_task = list_task;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_ibco_list_corders() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_ibco_list_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_list_akey to
+ *              list a group's creation order index.  Currently checks for
+ *              errors from previous tasks then sets arguments for
+ *              daos_obj_list_akey.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_ibco_list_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_ibco_ud_t *udata;
+    daos_obj_list_akey_t   *list_args;
+    int                     ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index list task");
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->iter_data->req);
+
+    /* Reset nr */
+    udata->list_data.nr = H5_DAOS_ITER_LEN;
+
+    /* Set list task arguments */
+    if (NULL == (list_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order index list task");
+    memset(list_args, 0, sizeof(*list_args));
+    list_args->oh          = udata->target_grp->obj.obj_oh;
+    list_args->th          = udata->iter_data->req->th;
+    list_args->dkey        = &udata->list_data.dkey;
+    list_args->nr          = &udata->list_data.nr;
+    list_args->kds         = udata->list_data.kds;
+    list_args->sgl         = &udata->list_data.sgl;
+    list_args->type        = DAOS_IOD_NONE;
+    list_args->akey_anchor = &udata->list_data.anchor;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_ibco_list_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_ibco_list_comp_cb
+ *
+ * Purpose:     Complete callback for asynchronous daos_obj_list_akey to
+ *              list a group's creation order index.  Collects the
+ *              creation order values of the links, which are the only
+ *              akeys in the index's dkey of their size, and repeats the
+ *              listing until all akeys have been read.  Then sorts the
+ *              values and sets the number of links to iterate over.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_ibco_list_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_ibco_ud_t *udata;
+    hbool_t                 reinit = FALSE;
+    int                     ret;
+    int                     ret_value = 0;
+
+    assert(H5_daos_task_list_g);
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index list task");
+
+    /* Check for buffer not large enough */
+    if (task->dt_result == -DER_KEY2BIG) {
+        size_t key_buf_len;
+        void  *tmp_realloc;
+
+        /* Allocate larger buffer */
+        key_buf_len = udata->list_data.sg_iov.iov_buf_len * 2;
+        if (NULL == (tmp_realloc = DV_realloc(udata->list_data.sg_iov.iov_buf, key_buf_len)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR, "can't reallocate key buffer");
+
+        /* Update SGL */
+        daos_iov_set(&udata->list_data.sg_iov, tmp_realloc, (daos_size_t)key_buf_len);
+        udata->list_data.sgl.sg_nr_out = 0;
+
+        reinit = TRUE;
+    } /* end if */
+    else if (task->dt_result < -H5_DAOS_PRE_ERROR &&
+             udata->iter_data->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        /* Handle errors in list task.  Only record error in req->status if
+         * it does not already contain an error (it could contain an error if
+         * another task this task is not dependent on also failed). */
+        udata->iter_data->req->status      = task->dt_result;
+        udata->iter_data->req->failed_task = "link creation order index list";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        const uint8_t *p;
+        const uint8_t *q;
+        uint32_t       i;
+
+        /* Loop over returned akeys */
+        p = (const uint8_t *)udata->list_data.sg_iov.iov_buf;
+        for (i = 0; i < udata->list_data.nr; i++) {
+            if (udata->list_data.kds[i].kd_key_len == (daos_size_t)H5_DAOS_ENCODED_CRT_ORDER_SIZE) {
+                /* Grow the array if links were created since iteration
+                 * started */
+                if (udata->ncorders == udata->corders_nalloc) {
+                    size_t    new_nalloc = MAX(2 * udata->corders_nalloc, H5_DAOS_ITER_LEN);
+                    uint64_t *tmp_realloc;
+
+                    if (NULL == (tmp_realloc = (uint64_t *)DV_realloc(udata->corders,
+                                                                      new_nalloc * sizeof(uint64_t))))
+                        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                                     "can't reallocate creation order value array");
+                    udata->corders        = tmp_realloc;
+                    udata->corders_nalloc = new_nalloc;
+                } /* end if */
+
+                q = p;
+                UINT64DECODE(q, udata->corders[udata->ncorders]);
+                udata->ncorders++;
+            } /* end if */
 
-        /* Get link name */
-        if (H5_daos_link_get_name_by_idx_alloc(
-                udata->target_grp, H5_INDEX_CRT_ORDER, udata->iter_data->iter_order, (uint64_t)udata->crt_idx,
-                &udata->link_name, &udata->link_name_len, &udata->name_buf, &udata->name_buf_size,
-                udata->iter_data->req, &first_task, &dep_task) < 0)
-            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name");
+            /* Advance to next akey */
+            p += udata->list_data.kds[i].kd_key_len;
+        } /* end for */
 
-        /* Create task to continue this operation */
-        if (H5_daos_create_task(H5_daos_link_ibco_task2, dep_task ? 1 : 0, dep_task ? &dep_task : NULL, NULL,
-                                NULL, udata, &task2_task) < 0)
+        /* If there are more akeys, repeat the akey list operation, otherwise
+         * sort the creation order values and iterate over them */
+        if (!daos_anchor_is_eof(&udata->list_data.anchor))
+            reinit = TRUE;
+        else {
+            qsort(udata->corders, udata->ncorders, sizeof(uint64_t), H5_daos_link_corder_cmp);
+            udata->grp_nlinks = (hsize_t)udata->ncorders;
+        } /* end else */
+    } /* end if */
+
+    /* Re-initialize the list task if necessary */
+    if (reinit) {
+        /* Re-register callback functions for re-initialized akey list task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_link_ibco_list_prep_cb, NULL, 0,
+                                              H5_daos_link_ibco_list_comp_cb, NULL, 0)))
             D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
-                         "can't create task 2 for link iterate by creation order");
+                         "can't register callbacks for task to list link creation order index: %s",
+                         H5_daos_err_to_string(ret));
 
-        /* Schedule ibco task 2 (or save it to be scheduled later) and give it a
-         * reference to req and udata */
-        if (first_task) {
-            if (0 != (ret = tse_task_schedule(task2_task, false)))
-                D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret,
-                             "can't schedule task 2 for link get name by name order: %s",
-                             H5_daos_err_to_string(ret));
-        } /* end if */
-        else
-            first_task = task2_task;
-        dep_task = task2_task;
-        udata    = NULL;
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to list link creation order index: %s",
+                         H5_daos_err_to_string(ret));
     } /* end if */
-    else
-        assert(udata->grp_nlinks == 0);
 
 done:
     if (udata) {
-        /* If we still own udata then the iteration is complete, schedule
-         * metatask */
-        /* Register task dependency */
-        if (dep_task && 0 != (ret = tse_task_register_deps(udata->ibco_metatask, 1, &dep_task)))
-            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
-                         "can't create dependencies for link iterate by creation order metatask: %s",
-                         H5_daos_err_to_string(ret));
+        /* Return task to task list if it was not re-initialized */
+        if ((!reinit || ret_value < 0) && H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
 
-        /* Schedule metatsk (or save it to be scheduled later) and transfer
-         * ownershiop of udata */
-        if (first_task) {
-            if (0 != (ret = tse_task_schedule(udata->ibco_metatask, false)))
-                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
-                             "can't schedule metatask for link iterate by creation order: %s",
-                             H5_daos_err_to_string(ret));
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->iter_data->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->iter_data->req->status      = ret_value;
+            udata->iter_data->req->failed_task = "link creation order index list completion callback";
         } /* end if */
-        else
-            first_task = udata->ibco_metatask;
-        dep_task = udata->ibco_metatask;
-        udata    = NULL;
-    } /* end if */
-
-    /* Schedule first task */
-    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
-        D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule initial task for link iteration op: %s",
-                     H5_daos_err_to_string(ret));
-
-    /* Handle errors in this function */
-    /* Do not place any code that can issue errors after this block, except for
-     * H5_daos_req_free_int, which updates req->status if it sees an error */
-    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && req && req->status >= -H5_DAOS_SHORT_CIRCUIT) {
-        req->status      = ret_value;
-        req->failed_task = "link iteration by creation order task";
     } /* end if */
 
-    /* Release req */
-    if (req && H5_daos_req_free_int(req) < 0)
-        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
-
-    /* Return task to task list */
-    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
-        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
-
-    /* Complete this task */
-    tse_task_complete(task, ret_value);
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_ibco_list_comp_cb() */
 
-    /* Make sure we cleaned up */
-    assert(!udata);
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_corder_cmp
+ *
+ * Purpose:     qsort() callback to sort link creation order values.
+ *
+ * Return:      Negative, zero or positive as the first value is less
+ *              than, equal to or greater than the second
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_corder_cmp(const void *_corder1, const void *_corder2)
+{
+    uint64_t corder1 = *(const uint64_t *)_corder1;
+    uint64_t corder2 = *(const uint64_t *)_corder2;
 
-    D_FUNC_LEAVE;
-} /* end H5_daos_link_ibco_task() */
+    return corder1 < corder2 ? -1 : (corder1 > corder2 ? 1 : 0);
+} /* end H5_daos_link_corder_cmp() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_ibco_helper
@@ -6493,6 +8069,12 @@ H5_daos_link_delete(H5_daos_item_t *item, const H5VL_loc_params_t *loc_params, h
     assert(dep_task);
     assert(H5VL_OBJECT_BY_NAME == loc_params->type || H5VL_OBJECT_BY_IDX == loc_params->type);
 
+    /* Cached paths through the deleted link may no longer resolve to the
+     * same groups, in this or any other file handle for the container.  Do
+     * this on all ranks, since the link is only deleted on rank 0 for
+     * collective deletes. */
+    H5_daos_file_invalidate_path_caches(item->file);
+
     if (!collective || (item->file->my_rank == 0)) {
         /* Allocate argument struct for deletion task */
         if (NULL == (delete_udata = (H5_daos_link_delete_ud_t *)DV_calloc(sizeof(H5_daos_link_delete_ud_t))))
@@ -6898,8 +8480,10 @@ done:
  * Function:    H5_daos_link_delete_corder
  *
  * Purpose:     Removes the target link from the target group's link
- *              creation order index by locating the relevant akeys and
- *              then removing them.
+ *              creation order index.  Reads the group's number of links,
+ *              max. creation order value and index layout version, then
+ *              removes the link's entry in the way the index's layout
+ *              requires (see H5_daos_link_delete_corder_layout_task()).
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -6911,20 +8495,18 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
                            tse_task_t **dep_task)
 {
     H5_daos_link_delete_corder_ud_t *corder_delete_ud = NULL;
-    tse_task_t                      *update_task      = NULL;
-    tse_task_t                      *delete_task      = NULL;
-    tse_task_t                      *bookkeep_task    = NULL;
+    tse_task_t                      *layout_task      = NULL;
     tse_task_t                      *finish_task      = NULL;
-    hid_t                            target_grp_id    = H5I_INVALID_HID;
     int                              ret;
     herr_t                           ret_value = SUCCEED;
 
     assert(target_grp);
     assert(loc_params);
     assert(H5VL_OBJECT_BY_NAME == loc_params->type || H5VL_OBJECT_BY_IDX == loc_params->type);
+    assert(target_link_name);
     H5daos_compile_assert(H5_DAOS_ENCODED_CRT_ORDER_SIZE == 8);
 
-    /* Allocate argument struct for creation order info bookkeeping task */
+    /* Allocate argument struct for creation order info deletion tasks */
     if (NULL == (corder_delete_ud =
                      (H5_daos_link_delete_corder_ud_t *)DV_calloc(sizeof(H5_daos_link_delete_corder_ud_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
@@ -6943,105 +8525,29 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
     if (H5_daos_group_get_num_links(target_grp, &corder_delete_ud->grp_nlinks, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get number of links in group");
 
-    /* Create task to update the "number of links" key for the group, accounting for the removed link */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_link_delete_corder_unl_prep_cb, NULL, corder_delete_ud,
-                                 &update_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to update number of links in group");
-
-    /* Schedule task to update number of links in group */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(update_task, false)))
-            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
-                         "can't schedule task to update number of links in group: %s",
-                         H5_daos_err_to_string(ret));
-    } /* end if */
-    else
-        *first_task = update_task;
-
-    *dep_task = update_task;
-
-    /* If originally iterating by name order, create a task to iterate over links
-     * by creation order and match the target link name to a creation order index
-     * value.
-     */
-    if (H5VL_OBJECT_BY_NAME == loc_params->type) {
-        H5_daos_iter_data_t iter_data;
-
-        /* Register ID for group for link iteration */
-        if ((target_grp_id = H5VLwrap_register(target_grp, H5I_GROUP)) < 0)
-            D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, FAIL, "unable to atomize object handle");
-        target_grp->obj.item.rc++;
-
-        /* Initialize iteration data */
-        corder_delete_ud->name_order_iter_cb_ud.target_link_name = corder_delete_ud->target_link_name;
-        corder_delete_ud->name_order_iter_cb_ud.link_idx_out     = &corder_delete_ud->delete_idx;
-        H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_LINK, H5_INDEX_CRT_ORDER, H5_ITER_INC, FALSE,
-                               NULL, target_grp_id, &corder_delete_ud->name_order_iter_cb_ud, NULL, req);
-        iter_data.u.link_iter_data.u.link_iter_op = H5_daos_link_delete_corder_name_cb;
-
-        /*
-         * TODO: Currently, deleting a link by name means that we need to iterate through
-         *       the link creation order index until we find the value corresponding to
-         *       the link being deleted. This is especially important because the deletion
-         *       of links might cause the target link's index value to shift downwards.
-         *
-         *       Once iteration restart is supported for link iteration, performance can
-         *       be improved here by first looking up the original, permanent creation order
-         *       value of the link using the 'link name -> creation order' mapping and then
-         *       using that value as the starting point for iteration. In this case, the
-         *       iteration order MUST be switched to H5_ITER_DEC or the key will not be
-         *       found by the iteration.
-         */
-        if (H5_daos_link_iterate(target_grp, &iter_data, first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "link iteration failed");
-    } /* end if */
-
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&corder_delete_ud->dkey, H5_daos_link_corder_key_g,
-                       H5_daos_link_corder_key_size_g);
-
-    /* Create task to remove link creation order akeys from group */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH_AKEYS, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
-                                 H5_daos_link_delete_corder_prep_cb, NULL, corder_delete_ud,
-                                 &delete_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL, "can't create task to delete link creation order keys");
-
-    /* Schedule task to delete link creation order akeys (or save
-     * it to be scheduled later) and give it a reference to req.
-     */
-    if (*first_task) {
-        if (0 != (ret = tse_task_schedule(delete_task, false)))
-            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
-                         "can't schedule task to delete link creation order keys: %s",
-                         H5_daos_err_to_string(ret));
-    } /* end if */
-    else
-        *first_task = delete_task;
-    req->rc++;
-    target_grp->obj.item.rc++;
-    *dep_task = delete_task;
+    /* Retrieve the group's max. creation order value and index layout
+     * version, which tell how the index is keyed */
+    if (H5_daos_group_get_max_crt_order(target_grp, &corder_delete_ud->grp_max_corder,
+                                        &corder_delete_ud->grp_corder_version, req, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get group's max creation order value");
 
-    /* Create task to perform bookkeeping on group's link creation
-     * order index if necessary.
-     */
-    if (H5_daos_create_task(H5_daos_link_delete_corder_bookkeep_task, *dep_task ? 1 : 0,
-                            *dep_task ? dep_task : NULL, NULL, NULL, corder_delete_ud, &bookkeep_task) < 0)
+    /* Create task to remove the link from the index */
+    if (H5_daos_create_task(H5_daos_link_delete_corder_layout_task, *dep_task ? 1 : 0,
+                            *dep_task ? dep_task : NULL, NULL, NULL, corder_delete_ud, &layout_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
                      "can't create task to update group's link creation order index");
 
     /* Schedule group link creation order index update task */
     if (*first_task) {
-        if (0 != (ret = tse_task_schedule(bookkeep_task, false)))
+        if (0 != (ret = tse_task_schedule(layout_task, false)))
             D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
                          "can't schedule task to update group's link creation order index: %s",
                          H5_daos_err_to_string(ret));
     } /* end if */
     else
-        *first_task = bookkeep_task;
-    req->rc++;
-    target_grp->obj.item.rc++;
-    *dep_task = bookkeep_task;
+        *first_task = layout_task;
+
+    *dep_task = layout_task;
 
     /* Create final task to free udata */
     if (H5_daos_create_task(H5_daos_link_delete_corder_finish, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
@@ -7049,7 +8555,8 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
                      "can't create task to update group's link creation order index");
 
-    /* Schedule link creation order info deletion finish task */
+    /* Schedule link creation order info deletion finish task and give it a
+     * reference to req and target_grp */
     if (*first_task) {
         if (0 != (ret = tse_task_schedule(finish_task, false)))
             D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
@@ -7058,27 +8565,19 @@ H5_daos_link_delete_corder(H5_daos_group_t *target_grp, const H5VL_loc_params_t
     } /* end if */
     else
         *first_task = finish_task;
-
+    req->rc++;
+    target_grp->obj.item.rc++;
     *dep_task = finish_task;
 
     /* Relinquish control of udata to task's function body */
     corder_delete_ud = NULL;
 
 done:
-    /* Close group since iteration task will now own it.  No need to mark as
-     * nonblocking close since the ID rc shouldn't drop to 0. */
-    if ((target_grp_id >= 0) && (H5Idec_ref(target_grp_id) < 0))
-        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, FAIL, "can't close group ID");
-
     if (corder_delete_ud) {
         assert(ret_value < 0);
 
-        if (update_task)
-            tse_task_complete(update_task, -H5_DAOS_SETUP_ERROR);
-        if (delete_task)
-            tse_task_complete(delete_task, -H5_DAOS_SETUP_ERROR);
-        if (bookkeep_task)
-            tse_task_complete(bookkeep_task, -H5_DAOS_SETUP_ERROR);
+        if (layout_task)
+            tse_task_complete(layout_task, -H5_DAOS_SETUP_ERROR);
         if (finish_task)
             tse_task_complete(finish_task, -H5_DAOS_SETUP_ERROR);
 
@@ -7086,7 +8585,213 @@ done:
     }
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_delete_corder() */
+} /* end H5_daos_link_delete_corder() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_delete_corder_layout_task
+ *
+ * Purpose:     Asynchronous task to remove a link from a group's link
+ *              creation order index once the group's number of links,
+ *              max. creation order value and index layout version have
+ *              been read.
+ *
+ *              An index keyed by creation order value just loses the
+ *              link's akeys, leaving a gap, and the deletion is counted
+ *              in the index's deletion count tree so that lookups by
+ *              index can skip the gap.  This costs one read and one
+ *              write of a single slot per tree level.
+ *
+ *              An index written before the layout version was recorded
+ *              that has had links deleted is keyed by position.  For
+ *              these the link's position is found, its akeys are removed
+ *              and every later entry is shifted down by one.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_delete_corder_layout_task(tse_task_t *task)
+{
+    H5_daos_link_delete_corder_ud_t *udata         = NULL;
+    tse_task_t                      *metatask      = NULL;
+    tse_task_t                      *first_task    = NULL;
+    tse_task_t                      *dep_task      = NULL;
+    tse_task_t                      *update_task   = NULL;
+    tse_task_t                      *delete_task   = NULL;
+    tse_task_t                      *bookkeep_task = NULL;
+    hid_t                            target_grp_id = H5I_INVALID_HID;
+    hbool_t                          by_position;
+    int                              ret;
+    int                              ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index update task");
+
+    /* Handle errors in previous tasks */
+    H5_DAOS_PREP_REQ(udata->req, H5E_LINK);
+
+    by_position = H5_DAOS_LINK_CORDER_INDEX_BY_POSITION(udata->grp_corder_version, udata->grp_nlinks,
+                                                        udata->grp_max_corder);
+
+    if (by_position) {
+        /* If deleting by creation order index, the link's position is the
+         * index.  Otherwise iterate over the links by creation order and
+         * match the target link name to find it. */
+        if (H5VL_OBJECT_BY_IDX == udata->loc_params->type &&
+            H5_INDEX_CRT_ORDER == udata->loc_params->loc_data.loc_by_idx.idx_type) {
+            /* DSINC - no check for safe cast here */
+            udata->delete_idx =
+                (H5_ITER_DEC == udata->loc_params->loc_data.loc_by_idx.order)
+                    ? (uint64_t)udata->grp_nlinks - (uint64_t)udata->loc_params->loc_data.loc_by_idx.n - 1
+                    : (uint64_t)udata->loc_params->loc_data.loc_by_idx.n;
+        } /* end if */
+        else {
+            H5_daos_iter_data_t iter_data;
+
+            /* Register ID for group for link iteration */
+            if ((target_grp_id = H5VLwrap_register(udata->target_grp, H5I_GROUP)) < 0)
+                D_GOTO_ERROR(H5E_ID, H5E_CANTREGISTER, -H5_DAOS_SETUP_ERROR,
+                             "unable to atomize object handle");
+            udata->target_grp->obj.item.rc++;
+
+            /* Initialize iteration data */
+            udata->name_order_iter_cb_ud.target_link_name = udata->target_link_name;
+            udata->name_order_iter_cb_ud.link_idx_out     = &udata->delete_idx;
+            H5_DAOS_ITER_DATA_INIT(iter_data, H5_DAOS_ITER_TYPE_LINK, H5_INDEX_CRT_ORDER, H5_ITER_INC, FALSE,
+                                   NULL, target_grp_id, &udata->name_order_iter_cb_ud, NULL, udata->req);
+            iter_data.u.link_iter_data.u.link_iter_op = H5_daos_link_delete_corder_name_cb;
+
+            if (H5_daos_link_iterate(udata->target_grp, &iter_data, &first_task, &dep_task) < 0)
+                D_GOTO_ERROR(H5E_SYM, H5E_BADITER, -H5_DAOS_SETUP_ERROR, "link iteration failed");
+        } /* end else */
+    }     /* end if */
+    else {
+        /* Retrieve the link's creation order value, which is its key in the
+         * index */
+        if (H5_daos_link_get_crt_order_by_name(udata->target_grp, udata->target_link_name, &udata->delete_idx,
+                                               udata->req, &first_task, &dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_SETUP_ERROR, "can't get link creation order value");
+
+        /* The deletion leaves a gap, so record the index's layout version if
+         * that has not been done yet */
+        udata->unl_data.write_version = (udata->grp_corder_version == 0);
+    } /* end else */
+
+    /* Create task to update the "number of links" key for the group, accounting for the removed link */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                                 H5_daos_link_delete_corder_unl_prep_cb, NULL, udata, &update_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to update number of links in group");
+
+    /* Schedule task to update number of links in group */
+    if (first_task) {
+        if (0 != (ret = tse_task_schedule(update_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't schedule task to update number of links in group: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        first_task = update_task;
+
+    dep_task = update_task;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&udata->dkey, H5_daos_link_corder_key_g,
+                       H5_daos_link_corder_key_size_g);
+
+    /* Create task to remove link creation order akeys from group */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_PUNCH_AKEYS, 1, &dep_task, H5_daos_link_delete_corder_prep_cb,
+                                 NULL, udata, &delete_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to delete link creation order keys");
+
+    /* Schedule task to delete link creation order akeys */
+    if (0 != (ret = tse_task_schedule(delete_task, false)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't schedule task to delete link creation order keys: %s",
+                     H5_daos_err_to_string(ret));
+
+    dep_task = delete_task;
+
+    if (by_position) {
+        /* Create task to shift the later entries of the index down */
+        if (H5_daos_create_task(H5_daos_link_delete_corder_bookkeep_task, 1, &dep_task, NULL, NULL, udata,
+                                &bookkeep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task to update group's link creation order index");
+
+        /* Schedule group link creation order index update task and give it a
+         * reference to req and target_grp */
+        if (0 != (ret = tse_task_schedule(bookkeep_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't schedule task to update group's link creation order index: %s",
+                         H5_daos_err_to_string(ret));
+        udata->req->rc++;
+        udata->target_grp->obj.item.rc++;
+        dep_task = bookkeep_task;
+    } /* end if */
+    else {
+        /* Count the link's creation order value as deleted */
+        if (H5_daos_link_corder_tree_add(udata->target_grp, &udata->delete_idx, 1, udata->req, &first_task,
+                                         &dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't update link creation order deletion counts");
+    } /* end else */
+
+done:
+    /* Close group since iteration task will now own it.  No need to mark as
+     * nonblocking close since the ID rc shouldn't drop to 0. */
+    if ((target_grp_id >= 0) && (H5Idec_ref(target_grp_id) < 0))
+        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group ID");
+
+    if (udata) {
+        /* Create metatask to complete this task after dep_task if necessary */
+        if (dep_task) {
+            /* Create metatask */
+            if (H5_daos_create_task(H5_daos_metatask_autocomp_other, 1, &dep_task, NULL, NULL, task,
+                                    &metatask) < 0)
+                D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                             "can't create metatask for link creation order index update task");
+            else {
+                /* Schedule metatask */
+                assert(first_task);
+                if (0 != (ret = tse_task_schedule(metatask, false)))
+                    D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                                 "can't schedule metatask for link creation order index update task: %s",
+                                 H5_daos_err_to_string(ret));
+            } /* end else */
+        }     /* end if */
+
+        /* Schedule first task */
+        if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+            D_DONE_ERROR(H5E_LINK, H5E_CANTINIT, ret,
+                         "can't schedule initial task for link creation order index update task: %s",
+                         H5_daos_err_to_string(ret));
+
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->req->status      = ret_value;
+            udata->req->failed_task = "link creation order index update task";
+        } /* end if */
+    }     /* end if */
+    else
+        assert(ret_value == -H5_DAOS_DAOS_GET_ERROR);
+
+    /* Complete task if necessary */
+    if (!metatask) {
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(task, ret_value);
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_delete_corder_layout_task() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_delete_corder_name_cb
@@ -7184,6 +8889,28 @@ H5_daos_link_delete_corder_unl_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *
 
     udata->unl_data.unl_ud.flags = DAOS_COND_AKEY_UPDATE;
 
+    /* Record the creation order index's layout version if requested.  The
+     * version key does not exist yet, so the update cannot be conditional on
+     * the akeys existing. */
+    if (udata->unl_data.write_version) {
+        udata->unl_data.corder_version_new = H5_DAOS_LINK_CORDER_INDEX_VERSION;
+
+        daos_const_iov_set((d_const_iov_t *)&udata->unl_data.unl_ud.iod[1].iod_name,
+                           H5_daos_link_corder_version_key_g, H5_daos_link_corder_version_key_size_g);
+        udata->unl_data.unl_ud.iod[1].iod_nr   = 1u;
+        udata->unl_data.unl_ud.iod[1].iod_size = (daos_size_t)1;
+        udata->unl_data.unl_ud.iod[1].iod_type = DAOS_IOD_SINGLE;
+
+        daos_iov_set(&udata->unl_data.unl_ud.sg_iov[1], &udata->unl_data.corder_version_new, (daos_size_t)1);
+        udata->unl_data.unl_ud.sgl[1].sg_nr     = 1;
+        udata->unl_data.unl_ud.sgl[1].sg_nr_out = 0;
+        udata->unl_data.unl_ud.sgl[1].sg_iovs   = &udata->unl_data.unl_ud.sg_iov[1];
+        udata->unl_data.unl_ud.free_sg_iov[1]   = FALSE;
+
+        udata->unl_data.unl_ud.nr    = 2u;
+        udata->unl_data.unl_ud.flags = 0;
+    } /* end if */
+
     /* Set update task arguments */
     if (NULL == (update_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
@@ -7210,8 +8937,8 @@ done:
  * Purpose:     Prepare callback for asynchronous daos_obj_punch_akeys to
  *              remove link creation order-related akeys from a group after
  *              deleting a link from it. Currently checks for errors from
- *              previous tasks and then sets arguments for the DAOS
- *              operation.
+ *              previous tasks, sets up the akeys for the link's key in the
+ *              index and then sets arguments for the DAOS operation.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7238,20 +8965,8 @@ H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
 
     assert(udata->target_grp);
 
-    /* If iteration was done by creation order, determine the
-     * index of the link to delete creation order info for now.
-     * If iteration was done by name order, the index will have
-     * been setup by a previous task. */
-    if (H5VL_OBJECT_BY_IDX == udata->loc_params->type) {
-        /* DSINC - no check for safe cast here */
-        udata->delete_idx =
-            (H5_ITER_DEC == udata->loc_params->loc_data.loc_by_idx.order)
-                ? (uint64_t)udata->grp_nlinks - (uint64_t)udata->loc_params->loc_data.loc_by_idx.n
-                : (uint64_t)udata->loc_params->loc_data.loc_by_idx.n;
-    } /* end if */
-
-    /* Set up akey buffers now that the index for the
-     * link to delete will have been resolved.
+    /* Set up akey buffers now that the key of the link to delete has been
+     * resolved.
      */
 
     /* Remove the akey which maps creation order -> link name */
@@ -7260,10 +8975,10 @@ H5_daos_link_delete_corder_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args
     daos_iov_set(&udata->akeys[0], (void *)udata->idx_buf, H5_DAOS_ENCODED_CRT_ORDER_SIZE);
 
     /* Remove the akey which maps creation order -> link target */
-    p = udata->crt_order_target_buf;
+    p = udata->delete_idx_target_buf;
     UINT64ENCODE(p, udata->delete_idx);
-    udata->crt_order_target_buf[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE - 1] = 0;
-    daos_iov_set(&udata->akeys[1], (void *)udata->crt_order_target_buf,
+    udata->delete_idx_target_buf[H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE - 1] = 0;
+    daos_iov_set(&udata->akeys[1], (void *)udata->delete_idx_target_buf,
                  H5_DAOS_CRT_ORDER_TO_LINK_TRGT_BUF_SIZE);
 
     /* Set deletion task arguments */
@@ -7535,32 +9250,284 @@ H5_daos_link_bookkeep_phase1_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
         udata->index_data.iods[(2 * i) + 1].iod_type = DAOS_IOD_SINGLE;
     } /* end for */
 
-    /* Set task arguments */
-    if (NULL == (fetch_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for link creation order index akey size fetch task");
-    memset(fetch_args, 0, sizeof(*fetch_args));
-    fetch_args->oh    = udata->target_grp->obj.obj_oh;
-    fetch_args->th    = DAOS_TX_NONE;
-    fetch_args->flags = DAOS_COND_AKEY_FETCH;
-    fetch_args->dkey  = &udata->index_data.dkey;
-    fetch_args->nr    = (uint32_t)(2 * udata->index_data.nlinks_shift);
-    fetch_args->iods  = udata->index_data.iods;
+    /* Set task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order index akey size fetch task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh    = udata->target_grp->obj.obj_oh;
+    fetch_args->th    = DAOS_TX_NONE;
+    fetch_args->flags = DAOS_COND_AKEY_FETCH;
+    fetch_args->dkey  = &udata->index_data.dkey;
+    fetch_args->nr    = (uint32_t)(2 * udata->index_data.nlinks_shift);
+    fetch_args->iods  = udata->index_data.iods;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_bookkeep_phase1_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_bookkeep_phase2_prep_cb
+ *
+ * Purpose:     Prepare callback for phase 2 of link creation order index
+ *              bookkeeping. Currently checks for errors from previous
+ *              tasks, allocates buffers for each link's creation order
+ *              akeys and then sets arguments for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_delete_corder_ud_t *udata;
+    daos_obj_rw_t                   *fetch_args;
+    size_t                           i;
+    size_t                           link_corder_name_buf_size;
+    size_t                           link_corder_target_buf_size;
+    char                            *link_corder_name_buf   = NULL;
+    char                            *link_corder_target_buf = NULL;
+    char                            *name_buf_cur_pos       = NULL;
+    char                            *target_buf_cur_pos     = NULL;
+    int                              ret_value              = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index bookkeeping task");
+
+    assert(udata->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    assert(udata->target_grp);
+
+    /* Determine size of buffers needed for link creation order akeys */
+    link_corder_name_buf_size   = 0;
+    link_corder_target_buf_size = 0;
+    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+        /* Determine size for 'creation order -> link name' akey buffer */
+        if (udata->index_data.iods[2 * i].iod_size == 0)
+            D_GOTO_ERROR(H5E_SYM, H5E_BADSIZE, -H5_DAOS_BAD_VALUE, "invalid iod size - missing metadata");
+        link_corder_name_buf_size += udata->index_data.iods[2 * i].iod_size;
+
+        /* Determine size for 'creation order -> link target' akey buffer */
+        if (udata->index_data.iods[(2 * i) + 1].iod_size == 0)
+            D_GOTO_ERROR(H5E_SYM, H5E_BADSIZE, -H5_DAOS_BAD_VALUE, "invalid iod size - missing metadata");
+        link_corder_target_buf_size += udata->index_data.iods[(2 * i) + 1].iod_size;
+    } /* end for */
+
+    if (NULL == (link_corder_name_buf = DV_malloc(link_corder_name_buf_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate buffer for akey data");
+    if (NULL == (link_corder_target_buf = DV_malloc(link_corder_target_buf_size)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                     "can't allocate buffer for akey data");
+
+    /* Setup SGLs for each akey */
+    name_buf_cur_pos   = link_corder_name_buf;
+    target_buf_cur_pos = link_corder_target_buf;
+    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+        /* Set up sgls for the current 'creation order -> link name' akey */
+        daos_iov_set(&udata->index_data.sg_iovs[2 * i], name_buf_cur_pos,
+                     udata->index_data.iods[2 * i].iod_size);
+        udata->index_data.sgls[2 * i].sg_nr     = 1;
+        udata->index_data.sgls[2 * i].sg_nr_out = 0;
+        udata->index_data.sgls[2 * i].sg_iovs   = &udata->index_data.sg_iovs[2 * i];
+
+        name_buf_cur_pos += udata->index_data.iods[2 * i].iod_size;
+
+        /* Set up sgls for the current 'creation order -> link target' akey */
+        daos_iov_set(&udata->index_data.sg_iovs[(2 * i) + 1], target_buf_cur_pos,
+                     udata->index_data.iods[(2 * i) + 1].iod_size);
+        udata->index_data.sgls[(2 * i) + 1].sg_nr     = 1;
+        udata->index_data.sgls[(2 * i) + 1].sg_nr_out = 0;
+        udata->index_data.sgls[(2 * i) + 1].sg_iovs   = &udata->index_data.sg_iovs[(2 * i) + 1];
+
+        target_buf_cur_pos += udata->index_data.iods[(2 * i) + 1].iod_size;
+    } /* end for */
+
+    /* Set task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order index akey fetch task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh    = udata->target_grp->obj.obj_oh;
+    fetch_args->th    = DAOS_TX_NONE;
+    fetch_args->flags = DAOS_COND_AKEY_FETCH;
+    fetch_args->dkey  = &udata->index_data.dkey;
+    fetch_args->nr    = (uint32_t)(2 * udata->index_data.nlinks_shift);
+    fetch_args->iods  = udata->index_data.iods;
+    fetch_args->sgls  = udata->index_data.sgls;
+
+done:
+    if (ret_value < 0) {
+        if (link_corder_target_buf)
+            link_corder_target_buf = DV_free(link_corder_target_buf);
+        if (link_corder_name_buf)
+            link_corder_name_buf = DV_free(link_corder_name_buf);
+
+        tse_task_complete(task, ret_value);
+    }
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_bookkeep_phase2_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_bookkeep_phase3_prep_cb
+ *
+ * Purpose:     Prepare callback for phase 3 of link creation order index
+ *              bookkeeping. Currently checks for errors from previous
+ *              tasks, adjusts each link's creation order akeys by setting
+ *              their integer 'name' values to one less than their original
+ *              values and then sets arguments for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_delete_corder_ud_t *udata;
+    daos_obj_rw_t                   *update_args;
+    uint64_t                         tmp_uint;
+    uint8_t                         *p;
+    size_t                           i;
+    int                              ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index bookkeeping task");
+
+    assert(udata->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    assert(udata->target_grp);
+
+    /*
+     * Adjust the akeys down by setting their integer 'name' values to
+     * one less than their original values.
+     */
+    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
+        /* Setup the integer 'name' value for the current 'creation order -> link name' akey */
+        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+        UINT64DECODE(p, tmp_uint);
+
+        tmp_uint--;
+        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
+        UINT64ENCODE(p, tmp_uint);
+
+        /* Setup the integer 'name' value for the current 'creation order -> link target' akey */
+        p = &udata->index_data.crt_order_link_trgt_buf[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
+        UINT64ENCODE(p, tmp_uint);
+        *p++ = 0;
+    } /* end for */
+
+    /* Set task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order index akey update task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->target_grp->obj.obj_oh;
+    update_args->th   = DAOS_TX_NONE;
+    update_args->dkey = &udata->index_data.dkey;
+    update_args->nr   = (uint32_t)(2 * udata->index_data.nlinks_shift);
+    update_args->iods = udata->index_data.iods;
+    update_args->sgls = udata->index_data.sgls;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_bookkeep_phase3_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_bookkeep_phase4_prep_cb
+ *
+ * Purpose:     Prepare callback for phase 4 of link creation order index
+ *              bookkeeping. Currently checks for errors from previous
+ *              tasks, then sets arguments for the DAOS operation to remove
+ *              the two link creation order akeys at the "end" of the index
+ *              (which are now invalid after shifting akeys downward in
+ *              the index).
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_delete_corder_ud_t *udata;
+    daos_obj_punch_t                *punch_args;
+    uint64_t                         tmp_uint;
+    uint8_t                         *p;
+    int                              ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order index bookkeeping task");
+
+    assert(udata->req);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->req);
+
+    assert(udata->target_grp);
+
+    /* Encode last (now invalid) index value into akeys */
+    tmp_uint = (uint64_t)udata->grp_nlinks;
+    p        = &udata->index_data.crt_order_link_name_buf[0];
+    UINT64ENCODE(p, tmp_uint);
+    daos_iov_set(&udata->index_data.tail_akeys[0], (void *)udata->index_data.crt_order_link_name_buf,
+                 H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+
+    p = &udata->index_data.crt_order_link_trgt_buf[0];
+    UINT64ENCODE(p, tmp_uint);
+    *p++ = 0;
+    daos_iov_set(&udata->index_data.tail_akeys[1], (void *)udata->index_data.crt_order_link_trgt_buf,
+                 H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+
+    /* Set deletion task arguments */
+    if (NULL == (punch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order akey deletion task");
+    memset(punch_args, 0, sizeof(*punch_args));
+    punch_args->oh      = udata->target_grp->obj.obj_oh;
+    punch_args->th      = DAOS_TX_NONE;
+    punch_args->dkey    = &udata->index_data.dkey;
+    punch_args->akeys   = udata->index_data.tail_akeys;
+    punch_args->flags   = DAOS_COND_PUNCH;
+    punch_args->akey_nr = 2;
 
 done:
     if (ret_value < 0)
         tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_bookkeep_phase1_prep_cb() */
+} /* end H5_daos_link_bookkeep_phase4_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_bookkeep_phase2_prep_cb
+ * Function:    H5_daos_link_delete_corder_finish
  *
- * Purpose:     Prepare callback for phase 2 of link creation order index
- *              bookkeeping. Currently checks for errors from previous
- *              tasks, allocates buffers for each link's creation order
- *              akeys and then sets arguments for the DAOS operation.
+ * Purpose:     Asynchronous task to finish deletion of link creation
+ *              order-related info from a group after a link has been
+ *              deleted. Currently checks for a failed task then frees
+ *              private data.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7568,110 +9535,243 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_link_bookkeep_phase2_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_link_delete_corder_finish(tse_task_t *task)
 {
     H5_daos_link_delete_corder_ud_t *udata;
-    daos_obj_rw_t                   *fetch_args;
-    size_t                           i;
-    size_t                           link_corder_name_buf_size;
-    size_t                           link_corder_target_buf_size;
-    char                            *link_corder_name_buf   = NULL;
-    char                            *link_corder_target_buf = NULL;
-    char                            *name_buf_cur_pos       = NULL;
-    char                            *target_buf_cur_pos     = NULL;
-    int                              ret_value              = 0;
+    int                              ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for link creation order index bookkeeping task");
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order info deletion task");
 
     assert(udata->req);
 
-    /* Handle errors */
-    H5_DAOS_PREP_REQ_PROG(udata->req);
+    if (H5_daos_group_close_real(udata->target_grp) < 0)
+        D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
 
-    assert(udata->target_grp);
+    /* Handle errors in this function */
+    /* Do not place any code that can issue errors after this block, except
+     * for H5_daos_req_free_int, which updates req->status if it sees an
+     * error */
+    if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->req->status      = ret_value;
+        udata->req->failed_task = "link creation order info deletion finish task";
+    } /* end if */
 
-    /* Determine size of buffers needed for link creation order akeys */
-    link_corder_name_buf_size   = 0;
-    link_corder_target_buf_size = 0;
-    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
-        /* Determine size for 'creation order -> link name' akey buffer */
-        if (udata->index_data.iods[2 * i].iod_size == 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_BADSIZE, -H5_DAOS_BAD_VALUE, "invalid iod size - missing metadata");
-        link_corder_name_buf_size += udata->index_data.iods[2 * i].iod_size;
+    /* Release our reference to req */
+    if (H5_daos_req_free_int(udata->req) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-        /* Determine size for 'creation order -> link target' akey buffer */
-        if (udata->index_data.iods[(2 * i) + 1].iod_size == 0)
-            D_GOTO_ERROR(H5E_SYM, H5E_BADSIZE, -H5_DAOS_BAD_VALUE, "invalid iod size - missing metadata");
-        link_corder_target_buf_size += udata->index_data.iods[(2 * i) + 1].iod_size;
-    } /* end for */
+    /* Free private data */
+    if (udata->index_data.crt_order_link_trgt_buf) {
+        DV_free(udata->index_data.crt_order_link_trgt_buf);
+        udata->index_data.crt_order_link_trgt_buf = NULL;
+    }
+    if (udata->index_data.crt_order_link_name_buf) {
+        DV_free(udata->index_data.crt_order_link_name_buf);
+        udata->index_data.crt_order_link_name_buf = NULL;
+    }
+    if (udata->index_data.sg_iovs) {
+        if (udata->index_data.sg_iovs[0].iov_buf) {
+            DV_free(udata->index_data.sg_iovs[0].iov_buf);
+            udata->index_data.sg_iovs[0].iov_buf = NULL;
+        }
+        if (udata->index_data.sg_iovs[1].iov_buf) {
+            DV_free(udata->index_data.sg_iovs[1].iov_buf);
+            udata->index_data.sg_iovs[1].iov_buf = NULL;
+        }
 
-    if (NULL == (link_corder_name_buf = DV_malloc(link_corder_name_buf_size)))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                     "can't allocate buffer for akey data");
-    if (NULL == (link_corder_target_buf = DV_malloc(link_corder_target_buf_size)))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                     "can't allocate buffer for akey data");
+        DV_free(udata->index_data.sg_iovs);
+        udata->index_data.sg_iovs = NULL;
+    }
+    if (udata->index_data.sgls) {
+        DV_free(udata->index_data.sgls);
+        udata->index_data.sgls = NULL;
+    }
+    if (udata->index_data.iods) {
+        DV_free(udata->index_data.iods);
+        udata->index_data.iods = NULL;
+    }
 
-    /* Setup SGLs for each akey */
-    name_buf_cur_pos   = link_corder_name_buf;
-    target_buf_cur_pos = link_corder_target_buf;
-    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
-        /* Set up sgls for the current 'creation order -> link name' akey */
-        daos_iov_set(&udata->index_data.sg_iovs[2 * i], name_buf_cur_pos,
-                     udata->index_data.iods[2 * i].iod_size);
-        udata->index_data.sgls[2 * i].sg_nr     = 1;
-        udata->index_data.sgls[2 * i].sg_nr_out = 0;
-        udata->index_data.sgls[2 * i].sg_iovs   = &udata->index_data.sg_iovs[2 * i];
+    DV_free(udata);
 
-        name_buf_cur_pos += udata->index_data.iods[2 * i].iod_size;
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
 
-        /* Set up sgls for the current 'creation order -> link target' akey */
-        daos_iov_set(&udata->index_data.sg_iovs[(2 * i) + 1], target_buf_cur_pos,
-                     udata->index_data.iods[(2 * i) + 1].iod_size);
-        udata->index_data.sgls[(2 * i) + 1].sg_nr     = 1;
-        udata->index_data.sgls[(2 * i) + 1].sg_nr_out = 0;
-        udata->index_data.sgls[(2 * i) + 1].sg_iovs   = &udata->index_data.sg_iovs[(2 * i) + 1];
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
 
-        target_buf_cur_pos += udata->index_data.iods[(2 * i) + 1].iod_size;
-    } /* end for */
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_delete_corder_finish() */
 
-    /* Set task arguments */
-    if (NULL == (fetch_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for link creation order index akey fetch task");
-    memset(fetch_args, 0, sizeof(*fetch_args));
-    fetch_args->oh    = udata->target_grp->obj.obj_oh;
-    fetch_args->th    = DAOS_TX_NONE;
-    fetch_args->flags = DAOS_COND_AKEY_FETCH;
-    fetch_args->dkey  = &udata->index_data.dkey;
-    fetch_args->nr    = (uint32_t)(2 * udata->index_data.nlinks_shift);
-    fetch_args->iods  = udata->index_data.iods;
-    fetch_args->sgls  = udata->index_data.sgls;
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_corder_tree_add
+ *
+ * Purpose:     Counts the given creation order values as deleted in the
+ *              target group's deletion count tree.  corders must be in
+ *              increasing order and must remain valid until the counts
+ *              have been read.  The counts are read, incremented and
+ *              written back, so these updates are serialized across the
+ *              process: each one waits for the previous one to finish.
+ *              Serializing per group or per file handle would not be
+ *              enough, since each open of a group has its own group
+ *              struct and a container may be open through several file
+ *              handles.  As with the group's link count, updates from
+ *              other processes are not serialized with these, so links
+ *              in one group should only be deleted on one process at a
+ *              time (collective deletes only run on rank 0).
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_link_corder_tree_add(H5_daos_group_t *target_grp, const uint64_t *corders, size_t ncorders,
+                             H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    H5_daos_link_corder_tree_ud_t *tree_udata  = NULL;
+    tse_task_t                    *fetch_task  = NULL;
+    tse_task_t                    *update_task = NULL;
+    tse_task_t                    *finish_task = NULL;
+    tse_task_t                    *fetch_deps[2];
+    unsigned                       fetch_ndeps = 0;
+    size_t                         nmax;
+    int                            ret;
+    herr_t                         ret_value = SUCCEED;
+
+    assert(target_grp);
+    assert(corders);
+    assert(ncorders > 0);
+    assert(req);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Allocate argument struct and buffers for the deletion count update
+     * tasks.  Each value touches one slot on each level. */
+    nmax = ncorders * H5_DAOS_CORDER_TREE_NLEVELS;
+    if (NULL ==
+        (tree_udata = (H5_daos_link_corder_tree_ud_t *)DV_calloc(sizeof(H5_daos_link_corder_tree_ud_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                     "can't allocate buffer for deletion count update callback arguments");
+    if (NULL == (tree_udata->iods = (daos_iod_t *)DV_calloc(nmax * sizeof(daos_iod_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate IOD buffer");
+    if (NULL == (tree_udata->sgls = (daos_sg_list_t *)DV_calloc(nmax * sizeof(daos_sg_list_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate SGL buffer");
+    if (NULL == (tree_udata->recxs = (daos_recx_t *)DV_calloc(nmax * sizeof(daos_recx_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate record extent buffer");
+    if (NULL == (tree_udata->sg_iovs = (daos_iov_t *)DV_calloc(nmax * sizeof(daos_iov_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate IOV buffer");
+    if (NULL == (tree_udata->incrs = (uint64_t *)DV_malloc(nmax * sizeof(uint64_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate count increment buffer");
+    if (NULL == (tree_udata->keys = (uint8_t *)DV_malloc(nmax * H5_DAOS_CORDER_TREE_KEY_SIZE)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate akey buffer");
+    if (NULL == (tree_udata->counts = (uint8_t *)DV_malloc(nmax * H5_DAOS_ENCODED_UINT64_T_SIZE)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate count buffer");
+    tree_udata->req        = req;
+    tree_udata->target_grp = target_grp;
+    tree_udata->corders    = corders;
+    tree_udata->ncorders   = ncorders;
+
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&tree_udata->dkey, H5_daos_link_corder_key_g,
+                       H5_daos_link_corder_key_size_g);
+
+    /* Wait for the previous deletion count update in this process, if it is
+     * still in progress */
+    if (H5_daos_link_corder_task_g)
+        fetch_deps[fetch_ndeps++] = H5_daos_link_corder_task_g;
+    if (*dep_task)
+        fetch_deps[fetch_ndeps++] = *dep_task;
+
+    /* Create task to read the counts */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, fetch_ndeps, fetch_ndeps > 0 ? fetch_deps : NULL,
+                                 H5_daos_link_corder_tree_fetch_prep_cb, NULL, tree_udata, &fetch_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't create task to read link creation order deletion counts");
+
+    /* Schedule deletion count read task */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                         "can't schedule task to read link creation order deletion counts: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = fetch_task;
+
+    *dep_task = fetch_task;
+
+    /* Create task to write the incremented counts */
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_UPDATE, 1, dep_task, H5_daos_link_corder_tree_update_prep_cb,
+                                 NULL, tree_udata, &update_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't create task to update link creation order deletion counts");
+
+    /* Schedule deletion count update task */
+    if (0 != (ret = tse_task_schedule(update_task, false)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't schedule task to update link creation order deletion counts: %s",
+                     H5_daos_err_to_string(ret));
+
+    *dep_task = update_task;
+
+    /* Create final task to free udata */
+    if (H5_daos_create_task(H5_daos_link_corder_tree_finish, 1, dep_task, NULL, NULL, tree_udata,
+                            &finish_task) < 0)
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't create task to finish link creation order deletion count update");
+
+    /* Schedule finish task and give it a reference to req and target_grp */
+    if (0 != (ret = tse_task_schedule(finish_task, false)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, FAIL,
+                     "can't schedule task to finish link creation order deletion count update: %s",
+                     H5_daos_err_to_string(ret));
+    req->rc++;
+    target_grp->obj.item.rc++;
+    *dep_task = finish_task;
+
+    /* The next deletion count update in this process waits for this one */
+    H5_daos_link_corder_task_g = finish_task;
+
+    /* Relinquish control of udata to task's function body */
+    tree_udata = NULL;
 
 done:
-    if (ret_value < 0) {
-        if (link_corder_target_buf)
-            link_corder_target_buf = DV_free(link_corder_target_buf);
-        if (link_corder_name_buf)
-            link_corder_name_buf = DV_free(link_corder_name_buf);
+    if (tree_udata) {
+        assert(ret_value < 0);
 
-        tse_task_complete(task, ret_value);
-    }
+        if (fetch_task)
+            tse_task_complete(fetch_task, -H5_DAOS_SETUP_ERROR);
+        if (update_task)
+            tse_task_complete(update_task, -H5_DAOS_SETUP_ERROR);
+        if (finish_task)
+            tse_task_complete(finish_task, -H5_DAOS_SETUP_ERROR);
+
+        DV_free(tree_udata->iods);
+        DV_free(tree_udata->sgls);
+        DV_free(tree_udata->recxs);
+        DV_free(tree_udata->sg_iovs);
+        DV_free(tree_udata->incrs);
+        DV_free(tree_udata->keys);
+        DV_free(tree_udata->counts);
+        tree_udata = DV_free(tree_udata);
+    } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_bookkeep_phase2_prep_cb() */
+} /* end H5_daos_link_corder_tree_add() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_bookkeep_phase3_prep_cb
+ * Function:    H5_daos_link_corder_tree_fetch_prep_cb
  *
- * Purpose:     Prepare callback for phase 3 of link creation order index
- *              bookkeeping. Currently checks for errors from previous
- *              tasks, adjusts each link's creation order akeys by setting
- *              their integer 'name' values to one less than their original
- *              values and then sets arguments for the DAOS operation.
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read
+ *              the deletion counts covering a set of creation order
+ *              values, one slot per level for each value.  Sets up one
+ *              IOD per tree node, with one record per slot, merging the
+ *              values that fall in the same slot, then sets arguments
+ *              for the DAOS operation.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7679,19 +9779,20 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_link_corder_tree_fetch_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_link_delete_corder_ud_t *udata;
-    daos_obj_rw_t                   *update_args;
-    uint64_t                         tmp_uint;
-    uint8_t                         *p;
-    size_t                           i;
-    int                              ret_value = 0;
+    H5_daos_link_corder_tree_ud_t *udata;
+    daos_obj_rw_t                 *fetch_args;
+    uint64_t                       node;
+    uint64_t                       slot;
+    unsigned                       level;
+    size_t                         i;
+    int                            ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for link creation order index bookkeeping task");
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order deletion count read task");
 
     assert(udata->req);
 
@@ -7700,53 +9801,80 @@ H5_daos_link_bookkeep_phase3_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 
     assert(udata->target_grp);
 
-    /*
-     * Adjust the akeys down by setting their integer 'name' values to
-     * one less than their original values.
-     */
-    for (i = 0; i < udata->index_data.nlinks_shift; i++) {
-        /* Setup the integer 'name' value for the current 'creation order -> link name' akey */
-        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
-        UINT64DECODE(p, tmp_uint);
-
-        tmp_uint--;
-        p = &udata->index_data.crt_order_link_name_buf[i * H5_DAOS_ENCODED_CRT_ORDER_SIZE];
-        UINT64ENCODE(p, tmp_uint);
-
-        /* Setup the integer 'name' value for the current 'creation order -> link target' akey */
-        p = &udata->index_data.crt_order_link_trgt_buf[i * (H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1)];
-        UINT64ENCODE(p, tmp_uint);
-        *p++ = 0;
-    } /* end for */
+    /* Counts that have never been written read as zero */
+    memset(udata->counts, 0, udata->ncorders * H5_DAOS_CORDER_TREE_NLEVELS * H5_DAOS_ENCODED_UINT64_T_SIZE);
+
+    /* Set up iods and sgls.  Since the values are in increasing order, the
+     * values in one node, and in one slot, are adjacent on every level. */
+    udata->nr     = 0;
+    udata->nslots = 0;
+    for (level = 1; level <= H5_DAOS_CORDER_TREE_NLEVELS; level++)
+        for (i = 0; i < udata->ncorders; i++) {
+            node = H5_DAOS_CORDER_TREE_NODE(udata->corders[i], level);
+            slot = H5_DAOS_CORDER_TREE_SLOT(udata->corders[i], level);
+
+            if (i == 0 || node != H5_DAOS_CORDER_TREE_NODE(udata->corders[i - 1], level)) {
+                /* Start a new node */
+                H5_DAOS_CORDER_TREE_ENCODE_KEY(&udata->keys[udata->nr * H5_DAOS_CORDER_TREE_KEY_SIZE], node,
+                                               level);
+                daos_iov_set(&udata->iods[udata->nr].iod_name,
+                             (void *)&udata->keys[udata->nr * H5_DAOS_CORDER_TREE_KEY_SIZE],
+                             H5_DAOS_CORDER_TREE_KEY_SIZE);
+                udata->iods[udata->nr].iod_nr    = 0;
+                udata->iods[udata->nr].iod_recxs = &udata->recxs[udata->nslots];
+                udata->iods[udata->nr].iod_size  = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+                udata->iods[udata->nr].iod_type  = DAOS_IOD_ARRAY;
+
+                udata->sgls[udata->nr].sg_nr     = 0;
+                udata->sgls[udata->nr].sg_nr_out = 0;
+                udata->sgls[udata->nr].sg_iovs   = &udata->sg_iovs[udata->nslots];
+
+                udata->nr++;
+            } /* end if */
+            else if (slot == udata->recxs[udata->nslots - 1].rx_idx) {
+                /* Same slot as the previous value */
+                udata->incrs[udata->nslots - 1]++;
+                continue;
+            } /* end if */
+
+            /* Add the slot to the current node */
+            udata->recxs[udata->nslots].rx_idx = slot;
+            udata->recxs[udata->nslots].rx_nr  = 1;
+            daos_iov_set(&udata->sg_iovs[udata->nslots],
+                         &udata->counts[udata->nslots * H5_DAOS_ENCODED_UINT64_T_SIZE],
+                         (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE);
+            udata->incrs[udata->nslots] = 1;
+            udata->iods[udata->nr - 1].iod_nr++;
+            udata->sgls[udata->nr - 1].sg_nr++;
+            udata->nslots++;
+        } /* end for */
 
     /* Set task arguments */
-    if (NULL == (update_args = daos_task_get_args(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for link creation order index akey update task");
-    memset(update_args, 0, sizeof(*update_args));
-    update_args->oh   = udata->target_grp->obj.obj_oh;
-    update_args->th   = DAOS_TX_NONE;
-    update_args->dkey = &udata->index_data.dkey;
-    update_args->nr   = (uint32_t)(2 * udata->index_data.nlinks_shift);
-    update_args->iods = udata->index_data.iods;
-    update_args->sgls = udata->index_data.sgls;
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order deletion count read task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh   = udata->target_grp->obj.obj_oh;
+    fetch_args->th   = udata->req->th;
+    fetch_args->dkey = &udata->dkey;
+    fetch_args->nr   = udata->nr;
+    fetch_args->iods = udata->iods;
+    fetch_args->sgls = udata->sgls;
 
 done:
     if (ret_value < 0)
         tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_bookkeep_phase3_prep_cb() */
+} /* end H5_daos_link_corder_tree_fetch_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_bookkeep_phase4_prep_cb
+ * Function:    H5_daos_link_corder_tree_update_prep_cb
  *
- * Purpose:     Prepare callback for phase 4 of link creation order index
- *              bookkeeping. Currently checks for errors from previous
- *              tasks, then sets arguments for the DAOS operation to remove
- *              the two link creation order akeys at the "end" of the index
- *              (which are now invalid after shifting akeys downward in
- *              the index).
+ * Purpose:     Prepare callback for asynchronous daos_obj_update to write
+ *              back the deletion counts read by
+ *              H5_daos_link_corder_tree_fetch_prep_cb(), each increased
+ *              by the number of values that fall in its slot.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7754,18 +9882,19 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+H5_daos_link_corder_tree_update_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
 {
-    H5_daos_link_delete_corder_ud_t *udata;
-    daos_obj_punch_t                *punch_args;
-    uint64_t                         tmp_uint;
-    uint8_t                         *p;
-    int                              ret_value = 0;
+    H5_daos_link_corder_tree_ud_t *udata;
+    daos_obj_rw_t                 *update_args;
+    uint64_t                       count;
+    uint8_t                       *p;
+    size_t                         i;
+    int                            ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
-        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for link creation order index bookkeeping task");
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order deletion count update task");
 
     assert(udata->req);
 
@@ -7774,45 +9903,48 @@ H5_daos_link_bookkeep_phase4_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *ar
 
     assert(udata->target_grp);
 
-    /* Encode last (now invalid) index value into akeys */
-    tmp_uint = (uint64_t)udata->grp_nlinks;
-    p        = &udata->index_data.crt_order_link_name_buf[0];
-    UINT64ENCODE(p, tmp_uint);
-    daos_iov_set(&udata->index_data.tail_akeys[0], (void *)udata->index_data.crt_order_link_name_buf,
-                 H5_DAOS_ENCODED_CRT_ORDER_SIZE);
+    /* Increment counts */
+    for (i = 0; i < udata->nslots; i++) {
+        p = &udata->counts[i * H5_DAOS_ENCODED_UINT64_T_SIZE];
+        UINT64DECODE(p, count);
+        count += udata->incrs[i];
+        p = &udata->counts[i * H5_DAOS_ENCODED_UINT64_T_SIZE];
+        UINT64ENCODE(p, count);
+    } /* end for */
 
-    p = &udata->index_data.crt_order_link_trgt_buf[0];
-    UINT64ENCODE(p, tmp_uint);
-    *p++ = 0;
-    daos_iov_set(&udata->index_data.tail_akeys[1], (void *)udata->index_data.crt_order_link_trgt_buf,
-                 H5_DAOS_ENCODED_CRT_ORDER_SIZE + 1);
+    /* The fetch may have reset the record sizes for nodes that did not
+     * exist yet, so set them again */
+    for (i = 0; i < udata->nr; i++) {
+        udata->iods[i].iod_size  = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+        udata->sgls[i].sg_nr_out = 0;
+    } /* end for */
 
-    /* Set deletion task arguments */
-    if (NULL == (punch_args = daos_task_get_args(task)))
+    /* Set task arguments */
+    if (NULL == (update_args = daos_task_get_args(task)))
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get arguments for link creation order akey deletion task");
-    memset(punch_args, 0, sizeof(*punch_args));
-    punch_args->oh      = udata->target_grp->obj.obj_oh;
-    punch_args->th      = DAOS_TX_NONE;
-    punch_args->dkey    = &udata->index_data.dkey;
-    punch_args->akeys   = udata->index_data.tail_akeys;
-    punch_args->flags   = DAOS_COND_PUNCH;
-    punch_args->akey_nr = 2;
+                     "can't get arguments for link creation order deletion count update task");
+    memset(update_args, 0, sizeof(*update_args));
+    update_args->oh   = udata->target_grp->obj.obj_oh;
+    update_args->th   = udata->req->th;
+    update_args->dkey = &udata->dkey;
+    update_args->nr   = udata->nr;
+    update_args->iods = udata->iods;
+    update_args->sgls = udata->sgls;
 
 done:
     if (ret_value < 0)
         tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_bookkeep_phase4_prep_cb() */
+} /* end H5_daos_link_corder_tree_update_prep_cb() */
 
 /*-------------------------------------------------------------------------
- * Function:    H5_daos_link_delete_corder_finish
+ * Function:    H5_daos_link_corder_tree_finish
  *
- * Purpose:     Asynchronous task to finish deletion of link creation
- *              order-related info from a group after a link has been
- *              deleted. Currently checks for a failed task then frees
- *              private data.
+ * Purpose:     Asynchronous task to finish a deletion count update.
+ *              Lets the next deletion count update in the file proceed,
+ *              then releases the group and request and frees private
+ *              data.
  *
  * Return:      Success:        0
  *              Failure:        Error code
@@ -7820,17 +9952,22 @@ done:
  *-------------------------------------------------------------------------
  */
 static int
-H5_daos_link_delete_corder_finish(tse_task_t *task)
+H5_daos_link_corder_tree_finish(tse_task_t *task)
 {
-    H5_daos_link_delete_corder_ud_t *udata;
-    int                              ret_value = 0;
+    H5_daos_link_corder_tree_ud_t *udata;
+    int                            ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't get private data for link creation order info deletion task");
+                     "can't get private data for link creation order deletion count update finish task");
 
     assert(udata->req);
+    assert(udata->target_grp);
+
+    /* This update is no longer in progress */
+    if (H5_daos_link_corder_task_g == task)
+        H5_daos_link_corder_task_g = NULL;
 
     if (H5_daos_group_close_real(udata->target_grp) < 0)
         D_DONE_ERROR(H5E_SYM, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
@@ -7841,7 +9978,7 @@ H5_daos_link_delete_corder_finish(tse_task_t *task)
      * error */
     if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
         udata->req->status      = ret_value;
-        udata->req->failed_task = "link creation order info deletion finish task";
+        udata->req->failed_task = "link creation order deletion count update finish task";
     } /* end if */
 
     /* Release our reference to req */
@@ -7849,36 +9986,13 @@ H5_daos_link_delete_corder_finish(tse_task_t *task)
         D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
     /* Free private data */
-    if (udata->index_data.crt_order_link_trgt_buf) {
-        DV_free(udata->index_data.crt_order_link_trgt_buf);
-        udata->index_data.crt_order_link_trgt_buf = NULL;
-    }
-    if (udata->index_data.crt_order_link_name_buf) {
-        DV_free(udata->index_data.crt_order_link_name_buf);
-        udata->index_data.crt_order_link_name_buf = NULL;
-    }
-    if (udata->index_data.sg_iovs) {
-        if (udata->index_data.sg_iovs[0].iov_buf) {
-            DV_free(udata->index_data.sg_iovs[0].iov_buf);
-            udata->index_data.sg_iovs[0].iov_buf = NULL;
-        }
-        if (udata->index_data.sg_iovs[1].iov_buf) {
-            DV_free(udata->index_data.sg_iovs[1].iov_buf);
-            udata->index_data.sg_iovs[1].iov_buf = NULL;
-        }
-
-        DV_free(udata->index_data.sg_iovs);
-        udata->index_data.sg_iovs = NULL;
-    }
-    if (udata->index_data.sgls) {
-        DV_free(udata->index_data.sgls);
-        udata->index_data.sgls = NULL;
-    }
-    if (udata->index_data.iods) {
-        DV_free(udata->index_data.iods);
-        udata->index_data.iods = NULL;
-    }
-
+    DV_free(udata->iods);
+    DV_free(udata->sgls);
+    DV_free(udata->recxs);
+    DV_free(udata->sg_iovs);
+    DV_free(udata->incrs);
+    DV_free(udata->keys);
+    DV_free(udata->counts);
     DV_free(udata);
 
 done:
@@ -7890,7 +10004,7 @@ done:
     tse_task_complete(task, ret_value);
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_delete_corder_finish() */
+} /* end H5_daos_link_corder_tree_finish() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_delete_rc_task
@@ -8161,9 +10275,10 @@ H5_daos_link_gnbi_alloc_task(tse_task_t *task)
         udata->cur_link_name_size = *udata->link_name_size + 1;
 
         /* Reissue call with larger buffer and transfer ownership of udata */
-        if (H5_daos_link_get_name_by_idx(udata->target_grp, udata->index_type, udata->iter_order, udata->idx,
-                                         udata->link_name_size, *udata->link_name_buf,
-                                         udata->cur_link_name_size, udata->req, &first_task, &dep_task) < 0)
+        if (H5_daos_link_get_name_by_idx_int(udata->target_grp, udata->index_type, udata->iter_order,
+                                             udata->idx, udata->idx_is_corder, udata->link_name_size,
+                                             *udata->link_name_buf, udata->cur_link_name_size, udata->req,
+                                             &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR, "can't get link name by index");
         udata = NULL;
     } /* end if */
@@ -8235,6 +10350,31 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp, H5_index_t index
                                    H5_iter_order_t iter_order, uint64_t idx, const char **link_name,
                                    size_t *link_name_size, char **link_name_buf, size_t *link_name_buf_size,
                                    H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    return H5_daos_link_get_name_by_idx_alloc_int(target_grp, index_type, iter_order, idx, FALSE, link_name,
+                                                  link_name_size, link_name_buf, link_name_buf_size, req,
+                                                  first_task, dep_task);
+} /* end H5_daos_link_get_name_by_idx_alloc() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_get_name_by_idx_alloc_int
+ *
+ * Purpose:     Internal version of H5_daos_link_get_name_by_idx_alloc().
+ *              If idx_is_corder is TRUE, idx is the creation order value
+ *              of the link instead of its position in the creation order
+ *              index, and iter_order is ignored.
+ *
+ * Return:      Success:        SUCCEED (0)
+ *              Failure:        FAIL (Negative)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_link_get_name_by_idx_alloc_int(H5_daos_group_t *target_grp, H5_index_t index_type,
+                                       H5_iter_order_t iter_order, uint64_t idx, hbool_t idx_is_corder,
+                                       const char **link_name, size_t *link_name_size, char **link_name_buf,
+                                       size_t *link_name_buf_size, H5_daos_req_t *req,
+                                       tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_link_gnbi_alloc_ud_t *gnbi_udata = NULL;
     int                           ret;
@@ -8249,6 +10389,7 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp, H5_index_t index
     gnbi_udata->index_type         = index_type;
     gnbi_udata->iter_order         = iter_order;
     gnbi_udata->idx                = idx;
+    gnbi_udata->idx_is_corder      = idx_is_corder;
     gnbi_udata->link_name          = link_name;
     gnbi_udata->link_name_size     = link_name_size;
     gnbi_udata->link_name_buf      = link_name_buf;
@@ -8268,9 +10409,9 @@ H5_daos_link_get_name_by_idx_alloc(H5_daos_group_t *target_grp, H5_index_t index
     } /* end else */
 
     /* Call underlying function */
-    if (H5_daos_link_get_name_by_idx(target_grp, index_type, iter_order, idx, gnbi_udata->link_name_size,
-                                     *gnbi_udata->link_name_buf, gnbi_udata->cur_link_name_size, req,
-                                     first_task, dep_task) < 0)
+    if (H5_daos_link_get_name_by_idx_int(target_grp, index_type, iter_order, idx, idx_is_corder,
+                                         gnbi_udata->link_name_size, *gnbi_udata->link_name_buf,
+                                         gnbi_udata->cur_link_name_size, req, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get link name by index");
 
     /* Create task to finish this operation */
@@ -8300,7 +10441,7 @@ done:
     } /* end if */
 
     D_FUNC_LEAVE;
-} /* end H5_daos_link_get_name_by_idx_alloc() */
+} /* end H5_daos_link_get_name_by_idx_alloc_int() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_get_name_by_idx
@@ -8325,14 +10466,40 @@ H5_daos_link_get_name_by_idx(H5_daos_group_t *target_grp, H5_index_t index_type,
                              uint64_t idx, size_t *link_name_size, char *link_name_out,
                              size_t link_name_out_size, H5_daos_req_t *req, tse_task_t **first_task,
                              tse_task_t **dep_task)
+{
+    return H5_daos_link_get_name_by_idx_int(target_grp, index_type, iter_order, idx, FALSE, link_name_size,
+                                            link_name_out, link_name_out_size, req, first_task, dep_task);
+} /* end H5_daos_link_get_name_by_idx() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_get_name_by_idx_int
+ *
+ * Purpose:     Internal version of H5_daos_link_get_name_by_idx().  If
+ *              idx_is_corder is TRUE, idx is the creation order value of
+ *              the link instead of its position in the creation order
+ *              index, and iter_order is ignored.
+ *
+ * Return:      Success:        SUCCEED (0)
+ *              Failure:        FAIL (Negative)
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_link_get_name_by_idx_int(H5_daos_group_t *target_grp, H5_index_t index_type,
+                                 H5_iter_order_t iter_order, uint64_t idx, hbool_t idx_is_corder,
+                                 size_t *link_name_size,
+                                 char *link_name_out, size_t link_name_out_size, H5_daos_req_t *req,
+                                 tse_task_t **first_task, tse_task_t **dep_task)
 {
     herr_t ret_value = SUCCEED;
 
     assert(target_grp);
+    assert(!idx_is_corder || H5_INDEX_CRT_ORDER == index_type);
 
     if (H5_INDEX_CRT_ORDER == index_type) {
-        if (H5_daos_link_get_name_by_crt_order(target_grp, iter_order, idx, link_name_size, link_name_out,
-                                               link_name_out_size, req, first_task, dep_task) < 0)
+        if (H5_daos_link_get_name_by_crt_order(target_grp, iter_order, idx, idx_is_corder, link_name_size,
+                                               link_name_out, link_name_out_size, req, first_task,
+                                               dep_task) < 0)
             D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't retrieve link name from creation order index");
     } /* end if */
     else if (H5_INDEX_NAME == index_type) {
@@ -8345,14 +10512,18 @@ H5_daos_link_get_name_by_idx(H5_daos_group_t *target_grp, H5_index_t index_type,
 
 done:
     D_FUNC_LEAVE;
-} /* end H5_daos_link_get_name_by_idx() */
+} /* end H5_daos_link_get_name_by_idx_int() */
 
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_gnbc_task
  *
  * Purpose:     Asynchronous task for
  *              H5_daos_link_get_name_by_crt_order().  Executes once
- *              target_grp is valid.
+ *              target_grp is valid.  If links have been deleted from the
+ *              group, the creation order index has gaps, so this first
+ *              walks down the group's deletion count tree to find the
+ *              creation order value of the requested link, unless the
+ *              caller already supplied it.
  *
  * Return:      Success:        0
  *              Failure:        Negative
@@ -8364,6 +10535,7 @@ H5_daos_link_gnbc_task(tse_task_t *task)
 {
     H5_daos_link_gnbc_ud_t *udata      = NULL;
     uint64_t                fetch_idx  = 0;
+    tse_task_t             *tree_task  = NULL;
     tse_task_t             *fetch_task = NULL;
     tse_task_t             *first_task = NULL;
     uint8_t                *p;
@@ -8384,22 +10556,53 @@ H5_daos_link_gnbc_task(tse_task_t *task)
     if (!((H5_daos_group_t *)(udata->md_rw_cb_ud.obj))->gcpl_cache.track_corder)
         D_GOTO_ERROR(H5E_SYM, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "creation order is not tracked for group");
 
-    /* Ensure the index is within range */
-    if (udata->index >= (uint64_t)udata->grp_nlinks)
-        D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
+    /* Set up dkey */
+    daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_link_corder_key_g,
+                       H5_daos_link_corder_key_size_g);
 
-    /* Calculate the correct index of the link, based upon the iteration order */
-    if (H5_ITER_DEC == udata->iter_order)
-        fetch_idx = (uint64_t)udata->grp_nlinks - udata->index - 1;
-    else
+    /* Calculate the creation order value or position of the link */
+    if (udata->index_is_corder)
+        /* The caller supplied the link's creation order value */
         fetch_idx = udata->index;
+    else {
+        /* Ensure the index is within range */
+        if (udata->index >= (uint64_t)udata->grp_nlinks)
+            D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "index value out of range");
 
-    p = udata->idx_buf;
-    UINT64ENCODE(p, fetch_idx);
+        /* Calculate the correct index of the link, based upon the iteration order */
+        if (H5_ITER_DEC == udata->iter_order)
+            fetch_idx = (uint64_t)udata->grp_nlinks - udata->index - 1;
+        else
+            fetch_idx = udata->index;
+    } /* end else */
 
-    /* Set up dkey */
-    daos_const_iov_set((d_const_iov_t *)&udata->md_rw_cb_ud.dkey, H5_daos_link_corder_key_g,
-                       H5_daos_link_corder_key_size_g);
+    /* If the caller supplied the link's creation order value, the index is
+     * keyed by position, or no links have been deleted so the index has no
+     * gaps, fetch_idx is the link's key in the index */
+    if (udata->index_is_corder || udata->grp_corder_version == 0 ||
+        (uint64_t)udata->grp_nlinks == udata->grp_max_corder) {
+        p = udata->idx_buf;
+        UINT64ENCODE(p, fetch_idx);
+    } /* end if */
+    else {
+        /* Start at the lowest tree level whose root node covers every
+         * creation order value in use */
+        udata->tree_data.rank  = fetch_idx;
+        udata->tree_data.node  = 0;
+        udata->tree_data.level = 1;
+        while (udata->tree_data.level < H5_DAOS_CORDER_TREE_NLEVELS &&
+               udata->grp_max_corder >
+                   ((uint64_t)1 << (udata->tree_data.level * H5_DAOS_CORDER_TREE_FANOUT_BITS)))
+            udata->tree_data.level++;
+
+        /* Create task to walk down the tree.  It is re-initialized for each
+         * level and encodes the creation order value into idx_buf once it
+         * reaches the bottom. */
+        if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_link_gnbc_tree_prep_cb,
+                                     H5_daos_link_gnbc_tree_comp_cb, udata, &tree_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't create task to read link creation order deletion counts");
+    } /* end else */
 
     /* Set nr */
     udata->md_rw_cb_ud.nr = 1;
@@ -8430,15 +10633,22 @@ H5_daos_link_gnbc_task(tse_task_t *task)
     udata->md_rw_cb_ud.task_name = "link get name by crt order fetch";
 
     /* Create task for name fetch */
-    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, 0, NULL, H5_daos_md_rw_prep_cb,
-                                 H5_daos_link_gnbc_comp_cb, udata, &fetch_task) < 0)
+    if (H5_daos_create_daos_task(DAOS_OPC_OBJ_FETCH, tree_task ? 1 : 0, tree_task ? &tree_task : NULL,
+                                 H5_daos_md_rw_prep_cb, H5_daos_link_gnbc_comp_cb, udata, &fetch_task) < 0)
         D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
                      "can't create task to read link name by creation order");
 
-    /* Save fetch task to be scheduled later and transfer ownership of udata */
+    /* Save tasks to be scheduled later and transfer ownership of udata */
     assert(!first_task);
-    first_task = fetch_task;
-    udata      = NULL;
+    if (tree_task) {
+        if (0 != (ret = tse_task_schedule(fetch_task, false)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, ret, "can't schedule task to read link name: %s",
+                         H5_daos_err_to_string(ret));
+        first_task = tree_task;
+    } /* end if */
+    else
+        first_task = fetch_task;
+    udata = NULL;
 
 done:
     /* Schedule first task */
@@ -8450,6 +10660,11 @@ done:
     if (udata) {
         assert(ret_value < 0);
 
+        /* Complete the tree task if it was created, since it was not
+         * scheduled */
+        if (tree_task)
+            tse_task_complete(tree_task, -H5_DAOS_SETUP_ERROR);
+
         /* Close target_grp */
         if (H5_daos_group_close_real((H5_daos_group_t *)udata->md_rw_cb_ud.obj) < 0)
             D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close group");
@@ -8482,6 +10697,185 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_link_gnbc_task() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_gnbc_tree_prep_cb
+ *
+ * Purpose:     Prepare callback for asynchronous daos_obj_fetch to read
+ *              the current node of a group's deletion count tree while
+ *              looking up a link by creation order.  Currently checks for
+ *              errors from previous tasks, sets up the IOD and SGL for
+ *              the node and then sets arguments for the DAOS operation.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_gnbc_tree_prep_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_gnbc_ud_t *udata;
+    daos_obj_rw_t          *fetch_args;
+    int                     ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order deletion count read task");
+
+    assert(udata->md_rw_cb_ud.req);
+    assert(udata->tree_data.level > 0);
+
+    /* Handle errors */
+    H5_DAOS_PREP_REQ_PROG(udata->md_rw_cb_ud.req);
+
+    /* Counts that have never been written read as zero */
+    memset(udata->tree_data.counts, 0, sizeof(udata->tree_data.counts));
+
+    /* Set up iod to read the whole node */
+    H5_DAOS_CORDER_TREE_ENCODE_KEY(udata->tree_data.key, udata->tree_data.node, udata->tree_data.level);
+    daos_iov_set(&udata->tree_data.iod.iod_name, (void *)udata->tree_data.key, H5_DAOS_CORDER_TREE_KEY_SIZE);
+    udata->tree_data.recx.rx_idx   = 0;
+    udata->tree_data.recx.rx_nr    = H5_DAOS_CORDER_TREE_FANOUT;
+    udata->tree_data.iod.iod_nr    = 1u;
+    udata->tree_data.iod.iod_recxs = &udata->tree_data.recx;
+    udata->tree_data.iod.iod_size  = (daos_size_t)H5_DAOS_ENCODED_UINT64_T_SIZE;
+    udata->tree_data.iod.iod_type  = DAOS_IOD_ARRAY;
+
+    /* Set up sgl */
+    daos_iov_set(&udata->tree_data.sg_iov, udata->tree_data.counts,
+                 (daos_size_t)H5_DAOS_CORDER_TREE_NODE_SIZE);
+    udata->tree_data.sgl.sg_nr     = 1;
+    udata->tree_data.sgl.sg_nr_out = 0;
+    udata->tree_data.sgl.sg_iovs   = &udata->tree_data.sg_iov;
+
+    /* Set task arguments */
+    if (NULL == (fetch_args = daos_task_get_args(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get arguments for link creation order deletion count read task");
+    memset(fetch_args, 0, sizeof(*fetch_args));
+    fetch_args->oh   = udata->md_rw_cb_ud.obj->obj_oh;
+    fetch_args->th   = udata->md_rw_cb_ud.req->th;
+    fetch_args->dkey = &udata->md_rw_cb_ud.dkey;
+    fetch_args->nr   = 1;
+    fetch_args->iods = &udata->tree_data.iod;
+    fetch_args->sgls = &udata->tree_data.sgl;
+
+done:
+    if (ret_value < 0)
+        tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_gnbc_tree_prep_cb() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_link_gnbc_tree_comp_cb
+ *
+ * Purpose:     Completion callback for a deletion count tree node read
+ *              from H5_daos_link_gnbc_task().  The number of live links
+ *              under each child of the node is the number of creation
+ *              order values assigned in the child's range, which follows
+ *              from the group's max. creation order value, minus the
+ *              child's deletion count.  Descends into the child that
+ *              holds the link, re-initializing the task to read that
+ *              child, until it reaches the link's creation order value.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_link_gnbc_tree_comp_cb(tse_task_t *task, void H5VL_DAOS_UNUSED *args)
+{
+    H5_daos_link_gnbc_ud_t *udata;
+    hbool_t                 reinit = FALSE;
+    int                     ret;
+    int                     ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for link creation order deletion count read task");
+
+    /* Handle errors in fetch task.  Only record error in udata->req_status if
+     * it does not already contain an error (it could contain an error if
+     * another task this task is not dependent on also failed). */
+    if (task->dt_result < -H5_DAOS_PRE_ERROR && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+        udata->md_rw_cb_ud.req->status      = task->dt_result;
+        udata->md_rw_cb_ud.req->failed_task = "link creation order deletion count read";
+    } /* end if */
+    else if (task->dt_result == 0) {
+        unsigned level = udata->tree_data.level;
+        uint64_t span  = (uint64_t)1 << ((level - 1) * H5_DAOS_CORDER_TREE_FANOUT_BITS);
+        uint64_t start;
+        uint64_t nassigned;
+        uint64_t ndeleted;
+        uint8_t *p = udata->tree_data.counts;
+        unsigned i;
+
+        /* Find the child holding the link */
+        start = level < H5_DAOS_CORDER_TREE_NLEVELS
+                    ? udata->tree_data.node << (level * H5_DAOS_CORDER_TREE_FANOUT_BITS)
+                    : 0;
+        for (i = 0; i < H5_DAOS_CORDER_TREE_FANOUT && start < udata->grp_max_corder; i++, start += span) {
+            nassigned = MIN(span, udata->grp_max_corder - start);
+            UINT64DECODE(p, ndeleted);
+            if (ndeleted > nassigned)
+                D_GOTO_ERROR(H5E_LINK, H5E_BADVALUE, -H5_DAOS_BAD_VALUE,
+                             "invalid link creation order deletion count");
+            if (udata->tree_data.rank < nassigned - ndeleted)
+                break;
+            udata->tree_data.rank -= nassigned - ndeleted;
+        } /* end for */
+        if (i == H5_DAOS_CORDER_TREE_FANOUT || start >= udata->grp_max_corder)
+            D_GOTO_ERROR(H5E_LINK, H5E_NOTFOUND, -H5_DAOS_DAOS_GET_ERROR,
+                         "link not found in creation order deletion counts");
+
+        /* Descend into the child.  At the bottom level the child is the
+         * link's creation order value. */
+        udata->tree_data.node = (udata->tree_data.node << H5_DAOS_CORDER_TREE_FANOUT_BITS) | (uint64_t)i;
+        if (--udata->tree_data.level > 0)
+            reinit = TRUE;
+        else {
+            p = udata->idx_buf;
+            UINT64ENCODE(p, udata->tree_data.node);
+        } /* end else */
+    } /* end if */
+
+    /* Re-initialize the task to read the next level if necessary */
+    if (reinit) {
+        /* Re-register callback functions for re-initialized fetch task */
+        if (0 != (ret = tse_task_register_cbs(task, H5_daos_link_gnbc_tree_prep_cb, NULL, 0,
+                                              H5_daos_link_gnbc_tree_comp_cb, NULL, 0)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't register callbacks for task to read deletion counts: %s",
+                         H5_daos_err_to_string(ret));
+
+        if (0 != (ret = tse_task_reinit(task)))
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                         "can't re-initialize task to read deletion counts: %s", H5_daos_err_to_string(ret));
+    } /* end if */
+
+done:
+    if (udata) {
+        /* Return task to task list if it was not re-initialized */
+        if ((!reinit || ret_value < 0) && H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+            D_DONE_ERROR(H5E_LINK, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+
+        /* Handle errors in this function */
+        /* Do not place any code that can issue errors after this block, except for
+         * H5_daos_req_free_int, which updates req->status if it sees an error */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && udata->md_rw_cb_ud.req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            udata->md_rw_cb_ud.req->status      = ret_value;
+            udata->md_rw_cb_ud.req->failed_task = "link deletion count read completion callback";
+        } /* end if */
+    } /* end if */
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_link_gnbc_tree_comp_cb() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_link_gnbc_comp_cb
  *
@@ -8577,6 +10971,9 @@ done:
  *              length of the link's name is simply returned. If non-NULL,
  *              the link's name is stored in link_name_out.
  *
+ *              If index_is_corder is TRUE, index is the link's creation
+ *              order value instead, and the link is read directly.
+ *
  * Return:      Success:        Non-negative
  *              Failure:        Negative
  *
@@ -8584,8 +10981,9 @@ done:
  */
 static herr_t
 H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t iter_order, uint64_t index,
-                                   size_t *link_name_size, char *link_name_out, size_t link_name_out_size,
-                                   H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task)
+                                   hbool_t index_is_corder, size_t *link_name_size, char *link_name_out,
+                                   size_t link_name_out_size, H5_daos_req_t *req, tse_task_t **first_task,
+                                   tse_task_t **dep_task)
 {
     H5_daos_link_gnbc_ud_t *gnbc_udata = NULL;
     int                     ret;
@@ -8602,13 +11000,24 @@ H5_daos_link_get_name_by_crt_order(H5_daos_group_t *target_grp, H5_iter_order_t
     gnbc_udata->md_rw_cb_ud.obj    = &target_grp->obj;
     gnbc_udata->iter_order         = iter_order;
     gnbc_udata->index              = index;
+    gnbc_udata->index_is_corder    = index_is_corder;
     gnbc_udata->link_name_size     = link_name_size;
     gnbc_udata->link_name_out      = link_name_out;
     gnbc_udata->link_name_out_size = link_name_out_size;
 
-    /* Retrieve the current number of links in the group */
-    if (H5_daos_group_get_num_links(target_grp, &gnbc_udata->grp_nlinks, req, first_task, dep_task) < 0)
-        D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get number of links in group");
+    /* The number of links and the max. creation order value are only needed
+     * to find the link's creation order value */
+    if (!index_is_corder) {
+        /* Retrieve the current number of links in the group */
+        if (H5_daos_group_get_num_links(target_grp, &gnbc_udata->grp_nlinks, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get number of links in group");
+
+        /* Retrieve the group's max. creation order value and index layout
+         * version, which tell whether the creation order index has gaps */
+        if (H5_daos_group_get_max_crt_order(target_grp, &gnbc_udata->grp_max_corder,
+                                            &gnbc_udata->grp_corder_version, req, first_task, dep_task) < 0)
+            D_GOTO_ERROR(H5E_LINK, H5E_CANTGET, FAIL, "can't get group's max creation order value");
+    } /* end if */
 
     /* Create task to finish this operation */
     if (H5_daos_create_task(H5_daos_link_gnbc_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL, NULL,
@@ -58,30 +58,70 @@ typedef struct H5_daos_object_get_info_ud_t {
 
 /* Task user data for copying an object */
 typedef struct H5_daos_object_copy_ud_t {
-    H5_daos_req_t               *req;
-    tse_task_t                  *obj_copy_metatask;
-    H5_daos_obj_t               *src_obj;
-    H5_daos_group_t             *dst_grp;
-    H5_daos_obj_t               *copied_obj;
-    const char                  *new_obj_name;
-    size_t                       new_obj_name_len;
-    char                        *new_obj_name_path_buf;
-    H5_DAOS_ATTR_EXISTS_OUT_TYPE dst_link_exists;
-    unsigned                     obj_copy_options;
-    hid_t                        lcpl_id;
+    H5_daos_req_t                      *req;
+    tse_task_t                         *obj_copy_metatask;
+    H5_daos_obj_t                      *src_obj;
+    H5_daos_group_t                    *dst_grp;
+    H5_daos_obj_t                      *copied_obj;
+    const char                         *new_obj_name;
+    size_t                              new_obj_name_len;
+    char                               *new_obj_name_path_buf;
+    H5_DAOS_ATTR_EXISTS_OUT_TYPE        dst_link_exists;
+    unsigned                            obj_copy_options;
+    hid_t                               lcpl_id;
+    struct H5_daos_object_copy_sched_t *sched;
+    hbool_t                             holds_slot;
 } H5_daos_object_copy_ud_t;
 
+/* Scheduler shared by all of the object copies made by one H5Ocopy call.
+ * At most max_active child objects are copied at once; the copies of any
+ * other child objects wait on gate tasks in a FIFO until a running copy
+ * finishes its own work (not including its members' copies) and hands
+ * over its slot.
+ */
+typedef struct H5_daos_object_copy_sched_t {
+    unsigned     rc;
+    uint64_t     nactive;
+    uint64_t     max_active;
+    tse_task_t **waiting;
+    size_t       waiting_head;
+    size_t       nwaiting;
+    size_t       waiting_nalloc;
+} H5_daos_object_copy_sched_t;
+
 /* Task user data for copying data between
- * datasets during object copying.
+ * datasets during object copying.  The data is copied in slabs of whole
+ * chunks (or of whole rows for other layouts) of about
+ * H5_daos_copy_slab_size_g bytes, with up to nslots slabs in flight, each
+ * using its own part of data_buf.
  */
 typedef struct H5_daos_dataset_copy_data_ud_t {
-    H5_daos_req_t  *req;
-    H5_daos_dset_t *src_dset;
-    H5_daos_dset_t *dst_dset;
-    void           *data_buf;
-    tse_task_t     *data_copy_task;
+    H5_daos_req_t                         *req;
+    H5_daos_dset_t                        *src_dset;
+    H5_daos_dset_t                        *dst_dset;
+    void                                  *data_buf;
+    tse_task_t                            *data_copy_task;
+    tse_task_t                            *done_task;
+    htri_t                                 is_vl_ref;
+    int                                    ndims;
+    hsize_t                                dims[H5S_MAX_RANK];
+    hsize_t                                slab_dims[H5S_MAX_RANK];
+    hsize_t                                nslabs;
+    hsize_t                                next_slab;
+    size_t                                 slab_buf_size;
+    unsigned                               nslots;
+    unsigned                               nactive;
+    struct H5_daos_dataset_copy_slab_ud_t *slots;
 } H5_daos_dataset_copy_data_ud_t;
 
+/* Task user data for one slab in flight during a dataset data copy */
+typedef struct H5_daos_dataset_copy_slab_ud_t {
+    H5_daos_dataset_copy_data_ud_t *copy_ud;
+    void                           *buf;
+    hid_t                           file_space_id;
+    hid_t                           mem_space_id;
+} H5_daos_dataset_copy_slab_ud_t;
+
 /* Task user data for copying attribute from a
  * source object to a target object.
  */
@@ -206,9 +246,17 @@ static herr_t           H5_daos_object_copy_helper(void *src_loc_obj, const H5VL
                                                    const char *src_name, void *dst_loc_obj,
                                                    const H5VL_loc_params_t *dst_loc_params, const char *dst_name,
                                                    unsigned obj_copy_options, hid_t lcpl_id,
+                                                   H5_daos_object_copy_sched_t *sched, hbool_t take_slot,
                                                    H5_DAOS_ATTR_EXISTS_OUT_TYPE **link_exists_p, H5_daos_req_t *req,
                                                    tse_task_t **first_task, tse_task_t **dep_task);
+static herr_t           H5_daos_object_copy_child(H5_daos_object_copy_ud_t *obj_copy_udata, const char *name);
 static int              H5_daos_object_copy_task(tse_task_t *task);
+static herr_t           H5_daos_object_copy_sched_release(H5_daos_object_copy_sched_t *sched);
+static herr_t           H5_daos_object_copy_release(H5_daos_object_copy_ud_t *obj_copy_udata,
+                                                    tse_task_t **first_task, tse_task_t **dep_task);
+static int              H5_daos_object_copy_release_task(tse_task_t *task);
+static herr_t           H5_daos_object_copy_join(tse_task_t *other_dep_task, tse_task_t **first_task,
+                                                 tse_task_t **dep_task);
 static herr_t           H5_daos_object_copy_free_copy_udata(H5_daos_object_copy_ud_t *copy_udata,
                                                             tse_task_t **first_task, tse_task_t **dep_task);
 static int              H5_daos_object_copy_free_copy_udata_task(tse_task_t *task);
@@ -239,6 +287,8 @@ static herr_t H5_daos_dataset_copy(H5_daos_object_copy_ud_t *obj_copy_udata, H5_
 static herr_t H5_daos_dataset_copy_data(H5_daos_dset_t *src_dset, H5_daos_dset_t *dst_dset,
                                         H5_daos_req_t *req, tse_task_t **first_task, tse_task_t **dep_task);
 static int    H5_daos_dataset_copy_data_task(tse_task_t *task);
+static herr_t H5_daos_dataset_copy_slab_start(H5_daos_dataset_copy_slab_ud_t *slot);
+static int    H5_daos_dataset_copy_slab_end_task(tse_task_t *task);
 static int    H5_daos_dset_copy_data_end_task(tse_task_t *task);
 
 static int    H5_daos_object_lookup_task(tse_task_t *task);
@@ -1466,8 +1516,8 @@ H5_daos_object_copy(void *src_loc_obj, const H5VL_loc_params_t *src_loc_params,
 
         /* Perform the object copy */
         if (H5_daos_object_copy_helper(src_loc_obj, src_loc_params, src_name, dst_loc_obj, dst_loc_params,
-                                       dst_name, obj_copy_options, lcpl_id, link_exists_p, int_req,
-                                       &first_task, &dep_task) < 0)
+                                       dst_name, obj_copy_options, lcpl_id, NULL, FALSE, link_exists_p,
+                                       int_req, &first_task, &dep_task) < 0)
             D_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, FAIL, "failed to copy object");
     } /* end if */
 
@@ -1561,11 +1611,13 @@ static herr_t
 H5_daos_object_copy_helper(void *src_loc_obj, const H5VL_loc_params_t *src_loc_params, const char *src_name,
                            void *dst_loc_obj, const H5VL_loc_params_t H5VL_DAOS_UNUSED *dst_loc_params,
                            const char *dst_name, unsigned obj_copy_options, hid_t lcpl_id,
+                           H5_daos_object_copy_sched_t *sched, hbool_t take_slot,
                            H5_DAOS_ATTR_EXISTS_OUT_TYPE **link_exists_p, H5_daos_req_t *req,
                            tse_task_t **first_task, tse_task_t **dep_task)
 {
     H5_daos_object_copy_ud_t *obj_copy_udata = NULL;
     H5VL_loc_params_t         sub_loc_params;
+    tse_task_t               *gate_task           = NULL;
     tse_task_t               *copy_task           = NULL;
     hbool_t                   copy_task_scheduled = FALSE;
     H5_daos_req_t            *int_int_req         = NULL;
@@ -1605,6 +1657,58 @@ H5_daos_object_copy_helper(void *src_loc_obj, const H5VL_loc_params_t *src_loc_p
     } /* end if */
     else
         obj_copy_udata->dst_link_exists = FALSE;
+    obj_copy_udata->sched      = NULL;
+    obj_copy_udata->holds_slot = FALSE;
+
+    /* Set up the copy scheduler.  The top-level object creates it, while
+     * members of a group being copied share it.  Members copied in their own
+     * task chain (take_slot) take one of its slots, waiting for a slot to be
+     * handed over if none are free. */
+    if (sched && take_slot) {
+        if (sched->nactive < sched->max_active)
+            sched->nactive++;
+        else {
+            /* Make room in the waiting FIFO */
+            if (sched->waiting_head + sched->nwaiting == sched->waiting_nalloc) {
+                if (sched->waiting_head > 0) {
+                    memmove(sched->waiting, &sched->waiting[sched->waiting_head],
+                            sched->nwaiting * sizeof(tse_task_t *));
+                    sched->waiting_head = 0;
+                } /* end if */
+                else {
+                    size_t       new_nalloc = MAX(2 * sched->waiting_nalloc, 64);
+                    tse_task_t **tmp_realloc;
+
+                    if (NULL == (tmp_realloc = (tse_task_t **)DV_realloc(sched->waiting,
+                                                                         new_nalloc * sizeof(tse_task_t *))))
+                        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
+                                     "can't reallocate object copy waiting list");
+                    sched->waiting        = tmp_realloc;
+                    sched->waiting_nalloc = new_nalloc;
+                } /* end else */
+            }     /* end if */
+
+            /* Create gate task, completed when a slot is handed over */
+            if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &gate_task) < 0)
+                D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create gate task for object copy");
+            if (0 != (ret = tse_task_schedule(gate_task, false)))
+                D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule gate task for object copy: %s",
+                             H5_daos_err_to_string(ret));
+            sched->waiting[sched->waiting_head + sched->nwaiting] = gate_task;
+            sched->nwaiting++;
+
+            assert(!*dep_task);
+            *dep_task = gate_task;
+        } /* end else */
+        obj_copy_udata->holds_slot = TRUE;
+    } /* end if */
+    else if (!sched) {
+        if (NULL == (sched = (H5_daos_object_copy_sched_t *)DV_calloc(sizeof(H5_daos_object_copy_sched_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate object copy scheduler");
+        sched->max_active = H5_daos_copy_nobjs_g;
+    } /* end else */
+    obj_copy_udata->sched = sched;
+    sched->rc++;
 
     /* Start internal H5 operation for source object open.  This will
      * not be visible to the API, will not be added to an operation
@@ -1710,6 +1814,25 @@ done:
                 if (obj_copy_udata->lcpl_id >= 0 && H5Pclose(obj_copy_udata->lcpl_id) < 0)
                     D_DONE_ERROR(H5E_PLIST, H5E_CLOSEERROR, FAIL, "can't close LCPL");
 
+            /* Give back our slot.  If we were waiting for one, our gate task
+             * is still the last one in the FIFO since no tasks have run, so
+             * just remove and complete it. */
+            if (gate_task && sched->nwaiting > 0 &&
+                sched->waiting[sched->waiting_head + sched->nwaiting - 1] == gate_task) {
+                sched->nwaiting--;
+                if (H5_daos_task_list_put(H5_daos_task_list_g, gate_task) < 0)
+                    D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+                tse_task_complete(gate_task, 0);
+            } /* end if */
+            else if (obj_copy_udata->holds_slot && H5_daos_object_copy_sched_release(sched) < 0)
+                D_DONE_ERROR(H5E_OBJECT, H5E_CANTRELEASE, FAIL, "can't release object copy slot");
+
+            /* Release our reference to the scheduler */
+            if (obj_copy_udata->sched && --obj_copy_udata->sched->rc == 0) {
+                DV_free(obj_copy_udata->sched->waiting);
+                DV_free(obj_copy_udata->sched);
+            } /* end if */
+
             obj_copy_udata = DV_free(obj_copy_udata);
         } /* end if */
 
@@ -1802,6 +1925,13 @@ H5_daos_object_copy_task(tse_task_t *task)
             D_GOTO_ERROR(H5E_OBJECT, H5E_BADVALUE, -H5_DAOS_BAD_VALUE, "invalid object type");
     } /* end switch */
 
+    /* Hand over this object's copy scheduler slot once its own copy is
+     * done.  Copies of a group's members are tracked by the metatask
+     * separately, so they do not hold on to the group's slot. */
+    if (udata->holds_slot && H5_daos_object_copy_release(udata, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to release object copy slot");
+
     /* Register dependency on new object copying task for metatask */
     if (dep_task && 0 != (ret = tse_task_register_deps(udata->obj_copy_metatask, 1, &dep_task)))
         D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, ret, "can't create dependencies for object copy metatask: %s",
@@ -1834,6 +1964,235 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_object_copy_task() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_object_copy_child
+ *
+ * Purpose:     Creates asynchronous tasks to copy a member of a group
+ *              being copied into the copied group.  Unlike other work
+ *              done during a group copy, the member's copy is not chained
+ *              after the previous member's copy; it only waits for a slot
+ *              in the copy scheduler, so up to H5_daos_copy_nobjs_g
+ *              members (and their own members) are copied at once.  The
+ *              group's copy metatask is made to depend on the member's
+ *              copy so the group's copy still completes after all of its
+ *              members.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_object_copy_child(H5_daos_object_copy_ud_t *obj_copy_udata, const char *name)
+{
+    H5VL_loc_params_t sub_loc_params;
+    tse_task_t       *first_task = NULL;
+    tse_task_t       *dep_task   = NULL;
+    int               ret;
+    herr_t            ret_value = SUCCEED;
+
+    assert(obj_copy_udata);
+    assert(obj_copy_udata->sched);
+    assert(obj_copy_udata->copied_obj);
+    assert(name);
+
+    /* Let the next OIDX allocation cover this object too */
+    obj_copy_udata->copied_obj->item.file->oidx_nalloc_hint++;
+
+    /* Copy the object in its own task chain */
+    sub_loc_params.type                         = H5VL_OBJECT_BY_NAME;
+    sub_loc_params.loc_data.loc_by_name.name    = name;
+    sub_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
+    if (H5_daos_object_copy_helper(obj_copy_udata->src_obj, &sub_loc_params, name, obj_copy_udata->copied_obj,
+                                   &sub_loc_params, name, obj_copy_udata->obj_copy_options,
+                                   obj_copy_udata->lcpl_id, obj_copy_udata->sched, TRUE, NULL,
+                                   obj_copy_udata->req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, FAIL, "failed to copy object");
+
+    /* Make the group's copy metatask wait for the member's copy */
+    if (dep_task && 0 != (ret = tse_task_register_deps(obj_copy_udata->obj_copy_metatask, 1, &dep_task)))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create dependencies for object copy metatask: %s",
+                     H5_daos_err_to_string(ret));
+
+done:
+    /* Schedule first task */
+    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+        D_DONE_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule task to copy object: %s",
+                     H5_daos_err_to_string(ret));
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_object_copy_child() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_object_copy_sched_release
+ *
+ * Purpose:     Releases a slot in an object copy scheduler, handing it
+ *              over to the object copy that has been waiting longest (by
+ *              completing its gate task) if there is one.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_object_copy_sched_release(H5_daos_object_copy_sched_t *sched)
+{
+    tse_task_t *gate_task;
+    herr_t      ret_value = SUCCEED;
+
+    assert(sched);
+    assert(sched->nactive > 0);
+
+    if (sched->nwaiting > 0) {
+        gate_task = sched->waiting[sched->waiting_head];
+        sched->waiting_head++;
+        sched->nwaiting--;
+        if (sched->nwaiting == 0)
+            sched->waiting_head = 0;
+
+        /* Complete gate task - the slot stays active */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, gate_task) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+        tse_task_complete(gate_task, 0);
+    } /* end if */
+    else
+        sched->nactive--;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_object_copy_sched_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_object_copy_release
+ *
+ * Purpose:     Creates an asynchronous task to release an object copy's
+ *              scheduler slot after *dep_task.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_object_copy_release(H5_daos_object_copy_ud_t *obj_copy_udata, tse_task_t **first_task,
+                            tse_task_t **dep_task)
+{
+    tse_task_t *release_task;
+    int         ret;
+    herr_t      ret_value = SUCCEED;
+
+    assert(obj_copy_udata);
+    assert(first_task);
+    assert(dep_task);
+
+    /* Create task to release slot */
+    if (H5_daos_create_task(H5_daos_object_copy_release_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
+                            NULL, NULL, obj_copy_udata, &release_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create task to release object copy slot");
+
+    /* Schedule release task (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(release_task, false)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule task to release copy slot: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = release_task;
+    *dep_task = release_task;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_object_copy_release() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_object_copy_release_task
+ *
+ * Purpose:     Asynchronous task to release an object copy's scheduler
+ *              slot once the object itself has been copied.
+ *
+ * Return:      Success:        0
+ *              Failure:        Error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_object_copy_release_task(tse_task_t *task)
+{
+    H5_daos_object_copy_ud_t *udata;
+    int                       ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (udata = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR,
+                     "can't get private data for object copy slot release task");
+
+    /* Release the slot even if the copy failed so waiting copies can run */
+    if (udata->holds_slot) {
+        udata->holds_slot = FALSE;
+        if (H5_daos_object_copy_sched_release(udata->sched) < 0)
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTRELEASE, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't release object copy slot");
+    } /* end if */
+
+done:
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_object_copy_release_task() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_object_copy_join
+ *
+ * Purpose:     Creates a metatask that completes when both *dep_task and
+ *              other_dep_task have completed, and makes it the new
+ *              *dep_task.  Used to run parts of an object copy side by
+ *              side.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_object_copy_join(tse_task_t *other_dep_task, tse_task_t **first_task, tse_task_t **dep_task)
+{
+    tse_task_t *dep_tasks[2];
+    tse_task_t *join_task;
+    int         ret;
+    herr_t      ret_value = SUCCEED;
+
+    assert(first_task);
+    assert(dep_task);
+
+    /* Nothing to do if there is only one chain */
+    if (!other_dep_task || other_dep_task == *dep_task)
+        D_GOTO_DONE(SUCCEED);
+    if (!*dep_task) {
+        *dep_task = other_dep_task;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Create metatask depending on both chains */
+    dep_tasks[0] = *dep_task;
+    dep_tasks[1] = other_dep_task;
+    if (H5_daos_create_task(H5_daos_metatask_autocomplete, 2, dep_tasks, NULL, NULL, NULL, &join_task) < 0)
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't create metatask for object copy");
+
+    /* Schedule metatask (or save it to be scheduled later) */
+    if (*first_task) {
+        if (0 != (ret = tse_task_schedule(join_task, false)))
+            D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINIT, FAIL, "can't schedule metatask for object copy: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        *first_task = join_task;
+    *dep_task = join_task;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_object_copy_join() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_object_copy_free_copy_udata
  *
@@ -1917,6 +2276,16 @@ H5_daos_object_copy_free_copy_udata_task(tse_task_t *task)
     if (udata->copied_obj && H5_daos_object_close(&udata->copied_obj->item) < 0)
         D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR, "can't close newly-copied object");
 
+    /* Hand over our copy scheduler slot if the copy failed before the release
+     * task did, then release our reference to the scheduler */
+    if (udata->holds_slot && H5_daos_object_copy_sched_release(udata->sched) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CANTRELEASE, -H5_DAOS_TASK_LIST_ERROR, "can't release object copy slot");
+    if (udata->sched && --udata->sched->rc == 0) {
+        assert(udata->sched->nwaiting == 0);
+        DV_free(udata->sched->waiting);
+        DV_free(udata->sched);
+    } /* end if */
+
     /* Handle errors in this function */
     /* Do not place any code that can issue errors after this block, except for
      * H5_daos_req_free_int, which updates req->status if it sees an error */
@@ -2376,6 +2745,7 @@ H5_daos_group_copy(H5_daos_object_copy_ud_t *obj_copy_udata, H5_daos_req_t *req,
     H5_daos_iter_data_t iter_data;
     H5_daos_group_t    *src_grp;
     H5_index_t          iter_index_type;
+    tse_task_t         *attr_dep_task = NULL;
     hid_t               target_obj_id = H5I_INVALID_HID;
     herr_t              ret_value     = SUCCEED;
 
@@ -2390,12 +2760,31 @@ H5_daos_group_copy(H5_daos_object_copy_ud_t *obj_copy_udata, H5_daos_req_t *req,
 
     src_grp = (H5_daos_group_t *)obj_copy_udata->src_obj;
 
-    /* Copy the group */
+    /* Copy the group, without its attributes */
     if (NULL == (obj_copy_udata->copied_obj = (H5_daos_obj_t *)H5_daos_group_copy_helper(
                      src_grp, obj_copy_udata->dst_grp, obj_copy_udata->new_obj_name,
-                     obj_copy_udata->obj_copy_options, req, first_task, dep_task)))
+                     obj_copy_udata->obj_copy_options | H5O_COPY_WITHOUT_ATTR_FLAG, req, first_task,
+                     dep_task)))
         D_GOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy group");
 
+    /* If the "without attribute copying" flag hasn't been specified, copy
+     * the group's attributes alongside its members */
+    if ((obj_copy_udata->obj_copy_options & H5O_COPY_WITHOUT_ATTR_FLAG) == 0) {
+        attr_dep_task = *dep_task;
+        if (H5_daos_object_copy_attributes((H5_daos_obj_t *)src_grp, obj_copy_udata->copied_obj, req,
+                                           first_task, &attr_dep_task) < 0)
+            D_GOTO_ERROR(H5E_SYM, H5E_CANTCOPY, FAIL, "can't copy group's attributes");
+    } /* end if */
+
+    /* The members of a group that tracks link creation order are copied one
+     * after another in the link iteration's task chain, so release this
+     * group's copy scheduler slot before iterating.  Otherwise groups waiting
+     * on their members could hold every slot while the members wait for
+     * one. */
+    if (src_grp->gcpl_cache.track_corder && obj_copy_udata->holds_slot &&
+        H5_daos_object_copy_release(obj_copy_udata, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create task to release object copy slot");
+
     /* Now copy the immediate members of the group to the new group. If the
      * H5O_COPY_SHALLOW_HIERARCHY_FLAG flag wasn't specified, this will also
      * recursively copy the members of any subgroups found. */
@@ -2420,6 +2809,10 @@ H5_daos_group_copy(H5_daos_object_copy_ud_t *obj_copy_udata, H5_daos_req_t *req,
     if (H5_daos_link_iterate(src_grp, &iter_data, first_task, dep_task) < 0)
         D_GOTO_ERROR(H5E_SYM, H5E_BADITER, FAIL, "can't iterate over group's links");
 
+    /* Wait for both the attribute copy and the link iteration */
+    if (H5_daos_object_copy_join(attr_dep_task, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_SYM, H5E_CANTINIT, FAIL, "can't create task to finish group copy");
+
 done:
     /* Release reference to group since link iteration task should own it now.
      * No need to mark as nonblocking close since the ID rc shouldn't drop to 0.
@@ -2546,6 +2939,10 @@ done:
  *              destination group, similar to soft link copying when the
  *              H5O_COPY_EXPAND_SOFT_LINK_FLAG flag is not specified.
  *
+ *              Objects are copied with H5_daos_object_copy_child(), in
+ *              parallel with the other members, unless the copied group
+ *              tracks link creation order.
+ *
  *              *dep_task exists within the source scheduler on entry and
  *              must also on exit.
  *
@@ -2560,7 +2957,8 @@ H5_daos_group_copy_cb(hid_t group, const char *name, const H5L_info2_t *info, vo
     H5_daos_object_copy_ud_t *obj_copy_udata = (H5_daos_object_copy_ud_t *)op_data;
     H5VL_loc_params_t         sub_loc_params;
     H5_daos_group_t          *copied_group = NULL;
-    herr_t                    ret_value    = H5_ITER_CONT;
+    hbool_t                   track_corder;
+    herr_t                    ret_value = H5_ITER_CONT;
 
     assert(first_task);
     assert(dep_task);
@@ -2568,6 +2966,11 @@ H5_daos_group_copy_cb(hid_t group, const char *name, const H5L_info2_t *info, vo
     /* Silence compiler for unused parameter */
     (void)group;
 
+    /* Members of a group that tracks link creation order are copied one
+     * after another so their links are created in order.  Otherwise each
+     * member is copied in its own task chain, alongside the other members. */
+    track_corder = ((H5_daos_group_t *)obj_copy_udata->copied_obj)->gcpl_cache.track_corder;
+
     sub_loc_params.type                         = H5VL_OBJECT_BY_NAME;
     sub_loc_params.loc_data.loc_by_name.name    = name;
     sub_loc_params.loc_data.loc_by_name.lapl_id = H5P_LINK_ACCESS_DEFAULT;
@@ -2602,11 +3005,16 @@ H5_daos_group_copy_cb(hid_t group, const char *name, const H5L_info2_t *info, vo
                 if (H5_daos_group_close_real(copied_group) < 0)
                     D_GOTO_ERROR(H5E_SYM, H5E_CLOSEERROR, H5_ITER_ERROR, "can't close group");
             }
+            else if (!track_corder) {
+                if (H5_daos_object_copy_child(obj_copy_udata, name) < 0)
+                    D_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, H5_ITER_ERROR, "failed to copy object");
+            } /* end if */
             else {
                 if (H5_daos_object_copy_helper(obj_copy_udata->src_obj, &sub_loc_params, name,
                                                obj_copy_udata->copied_obj, &sub_loc_params, name,
                                                obj_copy_udata->obj_copy_options, obj_copy_udata->lcpl_id,
-                                               NULL, obj_copy_udata->req, first_task, dep_task) < 0)
+                                               obj_copy_udata->sched, FALSE, NULL, obj_copy_udata->req,
+                                               first_task, dep_task) < 0)
                     D_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, H5_ITER_ERROR, "failed to copy object");
             } /* end else */
 
@@ -2621,10 +3029,15 @@ H5_daos_group_copy_cb(hid_t group, const char *name, const H5L_info2_t *info, vo
              */
             if (obj_copy_udata->obj_copy_options & H5O_COPY_EXPAND_SOFT_LINK_FLAG) {
                 /* Copy the object */
-                if (H5_daos_object_copy_helper(obj_copy_udata->src_obj, &sub_loc_params, name,
-                                               obj_copy_udata->copied_obj, &sub_loc_params, name,
-                                               obj_copy_udata->obj_copy_options, obj_copy_udata->lcpl_id,
-                                               NULL, obj_copy_udata->req, first_task, dep_task) < 0)
+                if (!track_corder) {
+                    if (H5_daos_object_copy_child(obj_copy_udata, name) < 0)
+                        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, H5_ITER_ERROR, "can't copy object");
+                } /* end if */
+                else if (H5_daos_object_copy_helper(obj_copy_udata->src_obj, &sub_loc_params, name,
+                                                    obj_copy_udata->copied_obj, &sub_loc_params, name,
+                                                    obj_copy_udata->obj_copy_options, obj_copy_udata->lcpl_id,
+                                                    obj_copy_udata->sched, FALSE, NULL, obj_copy_udata->req,
+                                                    first_task, dep_task) < 0)
                     D_GOTO_ERROR(H5E_OBJECT, H5E_CANTCOPY, H5_ITER_ERROR, "can't copy object");
             } /* end if */
             else {
@@ -2786,7 +3199,8 @@ H5_daos_dataset_copy(H5_daos_object_copy_ud_t *obj_copy_udata, H5_daos_req_t *re
                      tse_task_t **dep_task)
 {
     H5_daos_dset_t *src_dset;
-    H5_daos_req_t  *int_int_req = NULL;
+    H5_daos_req_t  *int_int_req   = NULL;
+    tse_task_t     *attr_dep_task = NULL;
     int             ret;
     herr_t          ret_value = SUCCEED;
 
@@ -2834,18 +3248,25 @@ H5_daos_dataset_copy(H5_daos_object_copy_ud_t *obj_copy_udata, H5_daos_req_t *re
     *dep_task   = int_int_req->finalize_task;
     int_int_req = NULL;
 
+    /* If the "without attribute copying" flag hasn't been specified,
+     * create a task to copy the dataset's attributes as well.  The
+     * attributes are copied alongside the data.
+     */
+    if ((obj_copy_udata->obj_copy_options & H5O_COPY_WITHOUT_ATTR_FLAG) == 0) {
+        attr_dep_task = *dep_task;
+        if (H5_daos_object_copy_attributes((H5_daos_obj_t *)src_dset, obj_copy_udata->copied_obj, req,
+                                           first_task, &attr_dep_task) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataset's attributes");
+    } /* end if */
+
     /* Copy all data from the source dataset to the new dataset */
     if (H5_daos_dataset_copy_data(src_dset, (H5_daos_dset_t *)obj_copy_udata->copied_obj, req, first_task,
                                   dep_task) < 0)
         D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataset data");
 
-    /* If the "without attribute copying" flag hasn't been specified,
-     * create a task to copy the dataset's attributes as well.
-     */
-    if ((obj_copy_udata->obj_copy_options & H5O_COPY_WITHOUT_ATTR_FLAG) == 0)
-        if (H5_daos_object_copy_attributes((H5_daos_obj_t *)src_dset, obj_copy_udata->copied_obj, req,
-                                           first_task, dep_task) < 0)
-            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, FAIL, "can't copy dataset's attributes");
+    /* Wait for both the attribute copy and the data copy */
+    if (H5_daos_object_copy_join(attr_dep_task, first_task, dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finish dataset copy");
 
 done:
     /* Close internal request for target object create */
@@ -2863,8 +3284,7 @@ done:
  * Function:    H5_daos_dataset_copy_data
  *
  * Purpose:     Creates an asynchronous task for copying data from a source
- *              dataset to a target dataset. Currently just attempts to
- *              read and write the data all at once.
+ *              dataset to a target dataset.
  *
  * Return:      Non-negative on success/Negative on failure
  *
@@ -2885,13 +3305,12 @@ H5_daos_dataset_copy_data(H5_daos_dset_t *src_dset, H5_daos_dset_t *dst_dset, H5
     assert(dep_task);
 
     if (NULL ==
-        (copy_ud = (H5_daos_dataset_copy_data_ud_t *)DV_malloc(sizeof(H5_daos_dataset_copy_data_ud_t))))
+        (copy_ud = (H5_daos_dataset_copy_data_ud_t *)DV_calloc(sizeof(H5_daos_dataset_copy_data_ud_t))))
         D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL,
                      "can't allocate user data struct for dataset data copy task");
     copy_ud->req      = req;
     copy_ud->src_dset = src_dset;
     copy_ud->dst_dset = dst_dset;
-    copy_ud->data_buf = NULL;
 
     /* Create task for dataset data copy */
     if (H5_daos_create_task(H5_daos_dataset_copy_data_task, *dep_task ? 1 : 0, *dep_task ? dep_task : NULL,
@@ -2924,8 +3343,14 @@ done:
  * Function:    H5_daos_dataset_copy_data_task
  *
  * Purpose:     Asynchronous task for copying data from a source dataset to
- *              a target dataset. Currently just attempts to read and write
- *              the data all at once.
+ *              a target dataset.  Divides the dataset into slabs of whole
+ *              chunks (or whole rows for other layouts) and starts
+ *              copying the first H5_daos_copy_nslabs_g of them; each
+ *              slab's buffer is reused for a later slab once its write
+ *              completes, so memory use is bounded by the slab size and
+ *              the number of slabs in flight rather than the dataset
+ *              size.  The data is copied as stored, without datatype
+ *              conversion.
  *
  *              This task exists in the source file's scheduler.
  *
@@ -2938,11 +3363,16 @@ static int
 H5_daos_dataset_copy_data_task(tse_task_t *task)
 {
     H5_daos_dataset_copy_data_ud_t *udata;
-    hssize_t                        fspace_nelements = 0;
-    size_t                          buf_size         = 0;
-    H5_daos_req_t                  *req              = NULL;
-    tse_task_t                     *first_task       = NULL;
-    tse_task_t                     *dep_task         = NULL;
+    hsize_t                         unit_dims[H5S_MAX_RANK];
+    hsize_t                         nunits;
+    hsize_t                         slab_nunits = 1;
+    hsize_t                         max_nunits;
+    size_t                          type_size = 0;
+    size_t                          unit_size;
+    H5_daos_req_t                  *req      = NULL;
+    tse_task_t                     *dep_task = NULL;
+    unsigned                        u;
+    int                             i;
     int                             ret;
     int                             ret_value = 0;
 
@@ -2971,36 +3401,110 @@ H5_daos_dataset_copy_data_task(tse_task_t *task)
     /* Check for previous errors */
     H5_DAOS_PREP_REQ_PROG(udata->req);
 
-    /* Calculate size needed to store entirety of dataset's data */
-    if ((fspace_nelements = H5Sget_simple_extent_npoints(udata->src_dset->space_id)) < 0)
+    /* Check for vlen or reference type */
+    if ((udata->is_vl_ref = H5_daos_detect_vl_vlstr_ref(udata->src_dset->type_id)) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGET, -H5_DAOS_H5_TCONV_ERROR,
+                     "can't check for vl or reference type");
+
+    /* Get the dataset's extent and element size */
+    if ((udata->ndims = H5Sget_simple_extent_dims(udata->src_dset->space_id, udata->dims, NULL)) < 0)
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
-                     "can't get number of elements in source dataset's dataspace");
-    if (0 == (buf_size = H5Tget_size(udata->src_dset->type_id)))
+                     "can't get source dataset's dimensions");
+    if (0 == (type_size = H5Tget_size(udata->src_dset->type_id)))
         D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTGET, -H5_DAOS_H5_GET_ERROR,
                      "can't get source dataset's datatype size");
-    buf_size *= (size_t)fspace_nelements;
 
-    /* Allocate buffer */
-    if (NULL == (udata->data_buf = DV_malloc(buf_size)))
-        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
-                     "can't allocate data buffer for dataset data copy");
+    /* Slabs are made of whole units - chunks for chunked datasets, elements
+     * otherwise.  Choose the slab shape in units, filling the fastest
+     * changing dimensions first, so the slab is at most
+     * H5_daos_copy_slab_size_g bytes (but at least one unit). */
+    unit_size = type_size;
+    for (i = 0; i < udata->ndims; i++) {
+        unit_dims[i] =
+            udata->src_dset->dcpl_cache.layout == H5D_CHUNKED ? udata->src_dset->dcpl_cache.chunk_dims[i] : 1;
+        unit_size *= (size_t)unit_dims[i];
+    } /* end for */
+    max_nunits = MAX(H5_daos_copy_slab_size_g / unit_size, 1);
+    udata->nslabs = 1;
+    for (i = udata->ndims - 1; i >= 0; i--) {
+        nunits = (udata->dims[i] + unit_dims[i] - 1) / unit_dims[i];
+        if (slab_nunits * nunits <= max_nunits) {
+            udata->slab_dims[i] = nunits * unit_dims[i];
+            slab_nunits *= nunits;
+        } /* end if */
+        else {
+            hsize_t dim_nunits = MAX(max_nunits / slab_nunits, 1);
 
-    /* Read data from source */
-    if (H5_daos_dataset_read_int(udata->src_dset, udata->src_dset->type_id, H5S_ALL, H5S_ALL, FALSE,
-                                 udata->data_buf, NULL, udata->req, &first_task, &dep_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, -H5_DAOS_DAOS_GET_ERROR,
-                     "can't read data from source dataset");
-    assert(dep_task);
+            udata->slab_dims[i] = dim_nunits * unit_dims[i];
+            slab_nunits *= dim_nunits;
+            udata->nslabs *= (nunits + dim_nunits - 1) / dim_nunits;
+        } /* end else */
 
-    /* Write data to destination */
-    if (H5_daos_dataset_write_int(udata->dst_dset, udata->src_dset->type_id, H5S_ALL, H5S_ALL, FALSE,
-                                  udata->data_buf, NULL, udata->req, &first_task, &dep_task) < 0)
-        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, -H5_DAOS_H5_COPY_ERROR,
-                     "can't write data to copied dataset");
+        /* Empty dataset */
+        if (udata->dims[i] == 0)
+            udata->nslabs = 0;
+    } /* end for */
+    udata->slab_buf_size = (size_t)slab_nunits * unit_size;
+
+    /* Null dataspace */
+    if (H5Sget_simple_extent_type(udata->src_dset->space_id) == H5S_NULL)
+        udata->nslabs = 0;
+
+    /* Allocate buffers and dataspaces for the slabs in flight */
+    udata->nslots = (unsigned)MIN(H5_daos_copy_nslabs_g, udata->nslabs);
+    if (udata->nslots > 0) {
+        if (NULL == (udata->data_buf = DV_malloc(udata->nslots * udata->slab_buf_size)))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate data buffer for dataset data copy");
+        if (NULL == (udata->slots = (H5_daos_dataset_copy_slab_ud_t *)DV_malloc(
+                         udata->nslots * sizeof(H5_daos_dataset_copy_slab_ud_t))))
+            D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, -H5_DAOS_ALLOC_ERROR,
+                         "can't allocate slab info for dataset data copy");
+        for (u = 0; u < udata->nslots; u++) {
+            udata->slots[u].copy_ud       = udata;
+            udata->slots[u].buf           = (char *)udata->data_buf + (u * udata->slab_buf_size);
+            udata->slots[u].file_space_id = H5I_INVALID_HID;
+            udata->slots[u].mem_space_id  = H5I_INVALID_HID;
+        } /* end for */
+
+        /* Scalar datasets are copied in one slab with H5S_ALL */
+        if (udata->ndims > 0)
+            for (u = 0; u < udata->nslots; u++) {
+                if ((udata->slots[u].file_space_id = H5Scopy(udata->src_dset->space_id)) < 0)
+                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCOPY, -H5_DAOS_H5_COPY_ERROR,
+                                 "can't copy source dataset's dataspace");
+                if ((udata->slots[u].mem_space_id =
+                         H5Screate_simple(udata->ndims, udata->slab_dims, NULL)) < 0)
+                    D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTCREATE, -H5_DAOS_H5_COPY_ERROR,
+                                 "can't create slab memory dataspace");
+            } /* end for */
+    } /* end if */
+
+    /* Create task that is completed when the last slab has been copied */
+    if (H5_daos_create_task(NULL, 0, NULL, NULL, NULL, NULL, &udata->done_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, -H5_DAOS_SETUP_ERROR,
+                     "can't create task to track dataset data copy");
+    if (0 != (ret = tse_task_schedule(udata->done_task, false)))
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task to track dataset data copy: %s",
+                     H5_daos_err_to_string(ret));
+    dep_task = udata->done_task;
+
+    /* Start copying the first slabs */
+    for (u = 0; u < udata->nslots; u++)
+        if (H5_daos_dataset_copy_slab_start(&udata->slots[u]) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, -H5_DAOS_H5_COPY_ERROR, "can't copy dataset data");
 
 done:
-    /* Check for tasks scheduled, in this case we need to schedule a task to
-     * mark this task complete and free udata */
+    /* Complete the tracking task now if no slabs were started */
+    if (udata && udata->done_task && udata->nactive == 0) {
+        if (H5_daos_task_list_put(H5_daos_task_list_g, udata->done_task) < 0)
+            D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                         "can't return task to task list");
+        tse_task_complete(udata->done_task, 0);
+    } /* end if */
+
+    /* Check for the tracking task created, in this case we need to schedule a
+     * task to mark this task complete and free udata once it completes */
     if (dep_task) {
         tse_task_t *end_task;
 
@@ -3013,23 +3517,13 @@ done:
                          "can't create task to finish data copy");
         else {
             /* Schedule end task and give it ownership of udata */
-            assert(first_task);
             req->rc++;
             if (0 != (ret = tse_task_schedule(end_task, false)))
                 D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule task to data copy: %s",
                              H5_daos_err_to_string(ret));
-            udata    = NULL;
-            dep_task = end_task;
+            udata = NULL;
         } /* end else */
-
-        /* Schedule first task */
-        assert(first_task);
-        if (0 != (ret = tse_task_schedule(first_task, false)))
-            D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, ret, "can't schedule initial task for data copy: %s",
-                         H5_daos_err_to_string(ret));
     } /* end if */
-    else
-        assert(!first_task);
 
     if (req) {
         /* Handle errors in this function */
@@ -3050,6 +3544,22 @@ done:
     /* Complete task if we still own udata */
     if (udata) {
         assert(ret_value < 0);
+
+        /* Free slab resources */
+        if (udata->slots)
+            for (u = 0; u < udata->nslots; u++) {
+                if (udata->slots[u].file_space_id >= 0 && H5Sclose(udata->slots[u].file_space_id) < 0)
+                    D_DONE_ERROR(H5E_DATASPACE, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                                 "can't close dataspace");
+                if (udata->slots[u].mem_space_id >= 0 && H5Sclose(udata->slots[u].mem_space_id) < 0)
+                    D_DONE_ERROR(H5E_DATASPACE, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                                 "can't close dataspace");
+            } /* end for */
+        DV_free(udata->slots);
+        DV_free(udata->data_buf);
+        udata->slots    = NULL;
+        udata->data_buf = NULL;
+
         /* Return task to task list */
         if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
             D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
@@ -3060,6 +3570,159 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_dataset_copy_data_task() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_copy_slab_start
+ *
+ * Purpose:     Starts copying the next slab of a dataset data copy using
+ *              the specified slab buffer: reads the slab from the source
+ *              dataset, writes it to the destination dataset, then runs
+ *              H5_daos_dataset_copy_slab_end_task() to start the next
+ *              slab.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_dataset_copy_slab_start(H5_daos_dataset_copy_slab_ud_t *slot)
+{
+    H5_daos_dataset_copy_data_ud_t *copy_ud = slot->copy_ud;
+    hsize_t                         start[H5S_MAX_RANK];
+    hsize_t                         count[H5S_MAX_RANK];
+    hsize_t                         slab_idx;
+    hsize_t                         nslabs_dim;
+    hid_t                           file_space_id = H5S_ALL;
+    hid_t                           mem_space_id  = H5S_ALL;
+    tse_task_t                     *first_task    = NULL;
+    tse_task_t                     *dep_task      = NULL;
+    tse_task_t                     *slab_end_task;
+    int                             i;
+    int                             ret;
+    herr_t                          ret_value = SUCCEED;
+
+    assert(copy_ud);
+    assert(copy_ud->next_slab < copy_ud->nslabs);
+
+    /* Select the slab, clipped to the extent, in the file and memory
+     * dataspaces.  Slabs are numbered in row-major order. */
+    slab_idx = copy_ud->next_slab++;
+    if (copy_ud->ndims > 0) {
+        for (i = copy_ud->ndims - 1; i >= 0; i--) {
+            nslabs_dim = (copy_ud->dims[i] + copy_ud->slab_dims[i] - 1) / copy_ud->slab_dims[i];
+            start[i]   = (slab_idx % nslabs_dim) * copy_ud->slab_dims[i];
+            count[i]   = MIN(copy_ud->slab_dims[i], copy_ud->dims[i] - start[i]);
+            slab_idx /= nslabs_dim;
+        } /* end for */
+        if (H5Sselect_hyperslab(slot->file_space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSELECT, FAIL, "can't select slab in file dataspace");
+        if (H5Sset_extent_simple(slot->mem_space_id, copy_ud->ndims, count, NULL) < 0)
+            D_GOTO_ERROR(H5E_DATASPACE, H5E_CANTSET, FAIL, "can't set slab memory dataspace extent");
+        file_space_id = slot->file_space_id;
+        mem_space_id  = slot->mem_space_id;
+    } /* end if */
+
+    /* Read slab from source */
+    if (H5_daos_dataset_read_int(copy_ud->src_dset, copy_ud->src_dset->type_id, mem_space_id, file_space_id,
+                                 FALSE, slot->buf, NULL, copy_ud->req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_READERROR, FAIL, "can't read data from source dataset");
+
+    /* Write slab to destination */
+    if (H5_daos_dataset_write_int(copy_ud->dst_dset, copy_ud->src_dset->type_id, mem_space_id, file_space_id,
+                                  FALSE, slot->buf, NULL, copy_ud->req, &first_task, &dep_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_WRITEERROR, FAIL, "can't write data to copied dataset");
+
+    /* Create task to reuse the slab buffer once the write completes */
+    if (H5_daos_create_task(H5_daos_dataset_copy_slab_end_task, dep_task ? 1 : 0, dep_task ? &dep_task : NULL,
+                            NULL, NULL, slot, &slab_end_task) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't create task to finish slab copy");
+
+    /* Schedule slab end task (or save it to be scheduled later) */
+    if (first_task) {
+        if (0 != (ret = tse_task_schedule(slab_end_task, false)))
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule task to finish slab copy: %s",
+                         H5_daos_err_to_string(ret));
+    } /* end if */
+    else
+        first_task = slab_end_task;
+    copy_ud->nactive++;
+
+done:
+    /* Schedule first task */
+    if (first_task && 0 != (ret = tse_task_schedule(first_task, false)))
+        D_DONE_ERROR(H5E_DATASET, H5E_CANTINIT, FAIL, "can't schedule initial task for slab copy: %s",
+                     H5_daos_err_to_string(ret));
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_copy_slab_start() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_dataset_copy_slab_end_task
+ *
+ * Purpose:     Asynchronous task run after a slab of a dataset data copy
+ *              has been written.  Reclaims any variable-length data in
+ *              the slab buffer and starts copying the next slab with it,
+ *              or completes the data copy tracking task if this was the
+ *              last slab in flight.
+ *
+ * Return:      Success:        0
+ *              Failure:        Negative error code
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_dataset_copy_slab_end_task(tse_task_t *task)
+{
+    H5_daos_dataset_copy_slab_ud_t *slot;
+    H5_daos_dataset_copy_data_ud_t *copy_ud   = NULL;
+    int                             ret_value = 0;
+
+    /* Get private data */
+    if (NULL == (slot = tse_task_get_priv(task)))
+        D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for task");
+    copy_ud = slot->copy_ud;
+
+    assert(copy_ud->nactive > 0);
+    copy_ud->nactive--;
+
+    /* If there's a vlen or reference type, reclaim any memory in the buffer */
+    if (copy_ud->is_vl_ref &&
+        H5Treclaim(copy_ud->src_dset->type_id,
+                   copy_ud->ndims > 0 ? slot->mem_space_id : copy_ud->src_dset->space_id,
+                   copy_ud->req->dxpl_id, slot->buf) < 0)
+        D_GOTO_ERROR(H5E_DATASET, H5E_CANTGC, -H5_DAOS_FREE_ERROR, "can't reclaim memory from slab buffer");
+
+    /* Start the next slab unless all have been started or the copy failed */
+    if (copy_ud->next_slab < copy_ud->nslabs && copy_ud->req->status >= -H5_DAOS_INCOMPLETE)
+        if (H5_daos_dataset_copy_slab_start(slot) < 0)
+            D_GOTO_ERROR(H5E_DATASET, H5E_CANTCOPY, -H5_DAOS_H5_COPY_ERROR, "can't copy dataset data");
+
+done:
+    if (copy_ud) {
+        /* Handle errors in this function */
+        if (ret_value < -H5_DAOS_SHORT_CIRCUIT && copy_ud->req->status >= -H5_DAOS_SHORT_CIRCUIT) {
+            copy_ud->req->status      = ret_value;
+            copy_ud->req->failed_task = "dataset slab copy end task";
+        } /* end if */
+
+        /* Complete the tracking task if this was the last slab in flight */
+        if (copy_ud->nactive == 0) {
+            if (H5_daos_task_list_put(H5_daos_task_list_g, copy_ud->done_task) < 0)
+                D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR,
+                             "can't return task to task list");
+            tse_task_complete(copy_ud->done_task, 0);
+        } /* end if */
+    } /* end if */
+
+    /* Return task to task list */
+    if (H5_daos_task_list_put(H5_daos_task_list_g, task) < 0)
+        D_DONE_ERROR(H5E_OBJECT, H5E_CLOSEERROR, -H5_DAOS_TASK_LIST_ERROR, "can't return task to task list");
+
+    /* Complete this task */
+    tse_task_complete(task, ret_value);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_dataset_copy_slab_end_task() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_dset_copy_data_end_task
  *
@@ -3075,23 +3738,25 @@ static int
 H5_daos_dset_copy_data_end_task(tse_task_t *task)
 {
     H5_daos_dataset_copy_data_ud_t *udata;
-    htri_t                          is_vl_ref;
+    unsigned                        u;
     int                             ret_value = 0;
 
     /* Get private data */
     if (NULL == (udata = tse_task_get_priv(task)))
         D_GOTO_ERROR(H5E_IO, H5E_CANTINIT, -H5_DAOS_DAOS_GET_ERROR, "can't get private data for task");
 
-    /* Check for vlen or reference type */
-    if ((is_vl_ref = H5_daos_detect_vl_vlstr_ref(udata->src_dset->type_id)) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CANTGET, -H5_DAOS_H5_TCONV_ERROR,
-                     "can't check for vl or reference type");
+    assert(udata->nactive == 0);
 
-    /* If there's a vlen or reference type, reclaim any memory in the buffer */
-    if (is_vl_ref && H5Treclaim(udata->src_dset->type_id, udata->src_dset->space_id, udata->req->dxpl_id,
-                                udata->data_buf) < 0)
-        D_DONE_ERROR(H5E_DATASET, H5E_CANTGC, -H5_DAOS_FREE_ERROR,
-                     "can't reclaim memory from fill value conversion buffer");
+    /* Close slab dataspaces */
+    if (udata->slots)
+        for (u = 0; u < udata->nslots; u++) {
+            if (udata->slots[u].file_space_id >= 0 && H5Sclose(udata->slots[u].file_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASPACE, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't close dataspace");
+            if (udata->slots[u].mem_space_id >= 0 && H5Sclose(udata->slots[u].mem_space_id) < 0)
+                D_DONE_ERROR(H5E_DATASPACE, H5E_CLOSEERROR, -H5_DAOS_H5_CLOSE_ERROR,
+                             "can't close dataspace");
+        } /* end for */
 
     /* Close datasets */
     if (H5_daos_dataset_close_real(udata->src_dset) < 0)
@@ -3113,7 +3778,8 @@ H5_daos_dset_copy_data_end_task(tse_task_t *task)
     if (H5_daos_req_free_int(udata->req) < 0)
         D_DONE_ERROR(H5E_DATASET, H5E_CLOSEERROR, -H5_DAOS_FREE_ERROR, "can't free request");
 
-    /* Free data buffer */
+    /* Free slab buffers */
+    DV_free(udata->slots);
     if (udata->data_buf)
         DV_free(udata->data_buf);
 
@@ -4039,6 +4705,515 @@ done:
     D_FUNC_LEAVE;
 } /* end H5_daos_fill_ocpl_cache() */
 
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_obj_table_hash
+ *
+ * Purpose:     Hash function for a file's open object table.  The key is
+ *              an object ID.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_obj_table_hash(dv_hash_table_key_t key)
+{
+    const daos_obj_id_t *oid = (const daos_obj_id_t *)key;
+
+    return (oid->lo * UINT64_C(1099511628211)) ^ oid->hi;
+} /* end H5_daos_obj_table_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_obj_table_equal
+ *
+ * Purpose:     Key comparison function for a file's open object table.
+ *
+ * Return:      Non-zero if the keys are equal, zero otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static int
+H5_daos_obj_table_equal(dv_hash_table_key_t key1, dv_hash_table_key_t key2)
+{
+    const daos_obj_id_t *oid1 = (const daos_obj_id_t *)key1;
+    const daos_obj_id_t *oid2 = (const daos_obj_id_t *)key2;
+
+    return oid1->lo == oid2->lo && oid1->hi == oid2->hi;
+} /* end H5_daos_obj_table_equal() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_obj_share
+ *
+ * Purpose:     Adds an object handle to the file's open object table,
+ *              attaching it to the state shared by the other open handles
+ *              of the same object.  If obj->shared->md_obj is set
+ *              afterwards, the caller may copy the object's metadata from
+ *              it and use obj->shared->obj_oh instead of opening and
+ *              reading the object.  The object's OID must be known.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_obj_share(H5_daos_obj_t *obj)
+{
+    H5_daos_file_t       *file;
+    H5_daos_obj_shared_t *shared    = NULL;
+    herr_t                ret_value = SUCCEED;
+
+    assert(obj);
+    assert(obj->item.type == H5I_GROUP || obj->item.type == H5I_DATASET);
+    assert(!obj->shared);
+    file = obj->item.file;
+
+    /* Create the file's open object table if necessary */
+    if (!file->obj_table &&
+        NULL == (file->obj_table = dv_hash_table_new(H5_daos_obj_table_hash, H5_daos_obj_table_equal)))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate file's open object table");
+
+    /* Attach to the shared state of the other handles, if any */
+    if (DV_HASH_TABLE_NULL != (shared = dv_hash_table_lookup(file->obj_table, &obj->oid))) {
+        shared->rc++;
+        obj->shared = shared;
+        shared      = NULL;
+        D_GOTO_DONE(SUCCEED);
+    } /* end if */
+
+    /* Add new shared state for the object */
+    if (NULL == (shared = (H5_daos_obj_shared_t *)DV_calloc(sizeof(H5_daos_obj_shared_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate shared object state");
+    shared->oid    = obj->oid;
+    shared->obj_oh = DAOS_HDL_INVAL;
+    shared->rc     = 1;
+    if (!dv_hash_table_insert(file->obj_table, &shared->oid, shared))
+        D_GOTO_ERROR(H5E_OBJECT, H5E_CANTINSERT, FAIL, "can't add object to file's open object table");
+    obj->shared = shared;
+    shared      = NULL;
+
+done:
+    if (shared)
+        DV_free(shared);
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_obj_share() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_obj_set_shared_md
+ *
+ * Purpose:     Makes an object handle whose metadata has been read the
+ *              one later opens of the object copy their metadata from, if
+ *              there is none yet or if updated is TRUE (the handle's
+ *              metadata was just changed).  The first such handle's DAOS
+ *              object handle becomes the shared one.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_obj_set_shared_md(H5_daos_obj_t *obj, hbool_t updated)
+{
+    assert(obj);
+
+    if (!obj->shared)
+        return;
+
+    if (!obj->shared->md_obj || updated)
+        obj->shared->md_obj = obj;
+    if (daos_handle_is_inval(obj->shared->obj_oh))
+        obj->shared->obj_oh = obj->obj_oh;
+} /* end H5_daos_obj_set_shared_md() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_obj_unshare
+ *
+ * Purpose:     Removes a closing object handle from the state shared with
+ *              the other open handles of the object.  If the handle uses
+ *              the shared DAOS object handle, obj->obj_oh is invalidated
+ *              so the caller does not close it.  The shared state and
+ *              DAOS object handle are freed with the last handle.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_obj_unshare(H5_daos_obj_t *obj)
+{
+    H5_daos_obj_shared_t *shared;
+    int                   ret;
+    herr_t                ret_value = SUCCEED;
+
+    assert(obj);
+
+    if (NULL == (shared = obj->shared))
+        D_GOTO_DONE(SUCCEED);
+    obj->shared = NULL;
+
+    if (!daos_handle_is_inval(shared->obj_oh) && obj->obj_oh.cookie == shared->obj_oh.cookie)
+        obj->obj_oh = DAOS_HDL_INVAL;
+    if (shared->md_obj == obj)
+        shared->md_obj = NULL;
+
+    if (--shared->rc == 0) {
+        (void)dv_hash_table_remove(obj->item.file->obj_table, &shared->oid);
+        if (!daos_handle_is_inval(shared->obj_oh))
+            if (0 != (ret = daos_obj_close(shared->obj_oh, NULL /*event*/)))
+                D_DONE_ERROR(H5E_OBJECT, H5E_CANTCLOSEOBJ, FAIL, "can't close shared DAOS object: %s",
+                             H5_daos_err_to_string(ret));
+        DV_free(shared);
+    } /* end if */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_obj_unshare() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_hash
+ *
+ * Purpose:     Computes the hash of a link or attribute name, from which
+ *              the bit positions of the name in a name filter are
+ *              derived.
+ *
+ * Return:      Hash value
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_name_filter_hash(const char *name, size_t name_len)
+{
+    uint64_t hash = UINT64_C(14695981039346656037);
+    size_t   i;
+
+    for (i = 0; i < name_len; i++)
+        hash = (hash ^ (uint64_t)(unsigned char)name[i]) * UINT64_C(1099511628211);
+
+    return hash;
+} /* end H5_daos_name_filter_hash() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_lookup
+ *
+ * Purpose:     Finds the entry in the file's name filter table for the
+ *              names of the specified type on the object with the
+ *              specified OID.
+ *
+ * Return:      Success:        The entry
+ *              Failure:        NULL if the object has no entry
+ *
+ *-------------------------------------------------------------------------
+ */
+static H5_daos_name_filter_ent_t *
+H5_daos_name_filter_lookup(H5_daos_file_t *file, const daos_obj_id_t *oid, H5_daos_name_filter_type_t type)
+{
+    H5_daos_name_filter_ent_t *ent;
+
+    if (!file->name_filters.ents)
+        return NULL;
+
+    ent = &file->name_filters.ents[(oid->lo ^ oid->hi ^ (uint64_t)type) % H5_DAOS_NAME_FILTER_NENTRIES];
+    if (ent->gen == 0 || ent->oid.lo != oid->lo || ent->oid.hi != oid->hi || ent->type != type)
+        return NULL;
+
+    return ent;
+} /* end H5_daos_name_filter_lookup() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_enabled
+ *
+ * Purpose:     Checks if the file's name filter table can see all names
+ *              created in the file by this application.  This is true
+ *              when the file is open on a single process, and on rank 0
+ *              when metadata writes are collective, since only rank 0
+ *              then creates links and attributes.  Independent metadata
+ *              writes create names on other processes that are never
+ *              seen.
+ *
+ * Return:      TRUE if the name filter table is used, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_name_filter_enabled(const H5_daos_file_t *file)
+{
+    return file->num_procs == 1 || (file->fapl_cache.is_collective_md_write && file->my_rank == 0);
+} /* end H5_daos_name_filter_enabled() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_full
+ *
+ * Purpose:     Checks if more names have been added to a name filter
+ *              entry than it was sized for, and the entry could be made
+ *              larger.
+ *
+ * Return:      TRUE if the entry should be resized, FALSE otherwise
+ *
+ *-------------------------------------------------------------------------
+ */
+static hbool_t
+H5_daos_name_filter_full(const H5_daos_name_filter_ent_t *ent)
+{
+    return ent->nwords < H5_DAOS_NAME_FILTER_MAX_NWORDS &&
+           ent->nnames * H5_DAOS_NAME_FILTER_BITS_PER_NAME > ent->nwords * 64;
+} /* end H5_daos_name_filter_full() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_begin
+ *
+ * Purpose:     Starts filling the name filter for the names of the
+ *              specified type on the object with the specified OID, when
+ *              iteration starts listing them.  If the object has no
+ *              entry one is created, replacing whatever entry was in its
+ *              slot, and if the object's entry holds more names than it
+ *              was sized for it is restarted, sized for the number of
+ *              names it held.  *gen is set to the entry's generation, to
+ *              be passed
+ *              to H5_daos_name_filter_add() and H5_daos_name_filter_end(),
+ *              or to 0 if the name filter table is not used.
+ *
+ * Return:      Non-negative on success/Negative on failure
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_name_filter_begin(H5_daos_file_t *file, const daos_obj_id_t *oid, H5_daos_name_filter_type_t type,
+                          uint64_t *gen)
+{
+    H5_daos_name_filter_ent_t *ent;
+    size_t                     nwords;
+    herr_t                     ret_value = SUCCEED;
+
+    assert(file);
+    assert(oid);
+    assert(gen);
+
+    *gen = 0;
+
+    /* Names created by other processes would not be added to the filter */
+    if (!H5_daos_name_filter_enabled(file))
+        D_GOTO_DONE(SUCCEED);
+
+    /* Allocate the table on first use */
+    if (!file->name_filters.ents &&
+        NULL == (file->name_filters.ents = (H5_daos_name_filter_ent_t *)DV_calloc(
+                     H5_DAOS_NAME_FILTER_NENTRIES * sizeof(H5_daos_name_filter_ent_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate name filter table");
+
+    /* Take over the object's slot if the object does not already own it,
+     * or restart the object's entry if it is too small */
+    if (NULL == (ent = H5_daos_name_filter_lookup(file, oid, type)) || H5_daos_name_filter_full(ent)) {
+        /* Size the filter for the names counted by the object's entry, at
+         * the number of bits per name, within the minimum and maximum
+         * sizes */
+        nwords = ent ? (ent->nnames * H5_DAOS_NAME_FILTER_BITS_PER_NAME + 63) / 64 : 0;
+        if (nwords < H5_DAOS_NAME_FILTER_MIN_NWORDS)
+            nwords = H5_DAOS_NAME_FILTER_MIN_NWORDS;
+        else if (nwords > H5_DAOS_NAME_FILTER_MAX_NWORDS)
+            nwords = H5_DAOS_NAME_FILTER_MAX_NWORDS;
+
+        ent = &file->name_filters.ents[(oid->lo ^ oid->hi ^ (uint64_t)type) % H5_DAOS_NAME_FILTER_NENTRIES];
+        if (ent->bits && ent->nwords == nwords)
+            memset(ent->bits, 0, nwords * sizeof(uint64_t));
+        else {
+            /* Leave the slot unused until the new filter is allocated */
+            ent->gen    = 0;
+            ent->nwords = 0;
+            ent->bits   = DV_free(ent->bits);
+            if (NULL == (ent->bits = (uint64_t *)DV_calloc(nwords * sizeof(uint64_t))))
+                D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate name filter");
+            ent->nwords = nwords;
+        } /* end else */
+        ent->oid      = *oid;
+        ent->type     = type;
+        ent->gen      = ++file->name_filters.gen;
+        ent->complete = FALSE;
+        ent->nnames   = 0;
+    } /* end if */
+
+    *gen = ent->gen;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_name_filter_begin() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_add
+ *
+ * Purpose:     Adds a name to the name filter for the names of the
+ *              specified type on the object with the specified OID, if
+ *              the object has an entry.  If gen is not 0 the name is only
+ *              added if the entry has not been replaced since gen was
+ *              returned by H5_daos_name_filter_begin().  Newly created
+ *              names are added with a gen of 0.  Names listed while the
+ *              entry is being filled and newly created names are counted,
+ *              to size the entry when it is next restarted.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_name_filter_add(H5_daos_file_t *file, const daos_obj_id_t *oid, H5_daos_name_filter_type_t type,
+                        uint64_t gen, const char *name, size_t name_len)
+{
+    H5_daos_name_filter_ent_t *ent;
+    uint64_t                   hash;
+    uint64_t                   bit;
+    unsigned                   i;
+
+    assert(file);
+    assert(oid);
+    assert(name);
+
+    if (NULL == (ent = H5_daos_name_filter_lookup(file, oid, type)) || (gen && ent->gen != gen))
+        return;
+
+    /* Names listed again by iteration of a complete entry are already
+     * counted */
+    if (!gen || !ent->complete)
+        ent->nnames++;
+
+    /* Set the name's bits, derived from the two halves of its hash */
+    hash = H5_daos_name_filter_hash(name, name_len);
+    for (i = 0; i < H5_DAOS_NAME_FILTER_NHASHES; i++) {
+        bit = ((hash & UINT32_MAX) + i * ((hash >> 32) | 1)) % ((uint64_t)ent->nwords * 64);
+        ent->bits[bit / 64] |= UINT64_C(1) << (bit % 64);
+    } /* end for */
+} /* end H5_daos_name_filter_add() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_end
+ *
+ * Purpose:     Marks the name filter started by
+ *              H5_daos_name_filter_begin() complete, once iteration has
+ *              listed all of the object's names.  Does nothing if the
+ *              entry has been replaced in the meantime, or if it holds
+ *              more names than it was sized for, in which case the next
+ *              iteration restarts it at a larger size.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_name_filter_end(H5_daos_file_t *file, const daos_obj_id_t *oid, H5_daos_name_filter_type_t type,
+                        uint64_t gen)
+{
+    H5_daos_name_filter_ent_t *ent;
+
+    assert(file);
+    assert(oid);
+
+    if (gen && NULL != (ent = H5_daos_name_filter_lookup(file, oid, type)) && ent->gen == gen &&
+        !H5_daos_name_filter_full(ent))
+        ent->complete = TRUE;
+} /* end H5_daos_name_filter_end() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_create
+ *
+ * Purpose:     Notes that a request creates links or attributes, so
+ *              their names may be missing from the name filters until
+ *              the request is freed.  Called when the request's create
+ *              tasks are set up, before the names are added.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_name_filter_create(H5_daos_req_t *req)
+{
+    assert(req);
+    assert(req->file);
+
+    if (!req->name_filter_create) {
+        req->name_filter_create = TRUE;
+        req->file->name_filters.ncreates++;
+    } /* end if */
+} /* end H5_daos_name_filter_create() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filter_absent
+ *
+ * Purpose:     Checks the name filter for the names of the specified type
+ *              on an object for a name.  The filter is only trusted when
+ *              nothing it does not see could have created the name: the
+ *              name filter table must be enabled for the file, the file
+ *              must be open for writing and through no other file handle
+ *              in this process, the object must not be open through
+ *              another handle in the file's open object table, and no
+ *              link or attribute creates may be in flight, since a create
+ *              adds its name only when its write task runs.
+ *
+ * Return:      Success:        TRUE if the name definitely does not
+ *                              exist, FALSE if it may exist
+ *              Failure:        Negative (never fails)
+ *
+ *-------------------------------------------------------------------------
+ */
+htri_t
+H5_daos_name_filter_absent(H5_daos_obj_t *obj, H5_daos_name_filter_type_t type, const char *name,
+                           size_t name_len)
+{
+    H5_daos_file_t            *file;
+    H5_daos_name_filter_ent_t *ent;
+    uint64_t                   hash;
+    uint64_t                   bit;
+    unsigned                   i;
+
+    assert(obj);
+    assert(name);
+    file = obj->item.file;
+
+    /* Check that no names could have been created without the filter
+     * seeing them */
+    if (!H5_daos_name_filter_enabled(file) || !(file->flags & H5F_ACC_RDWR) ||
+        file->name_filters.ncreates > 0 || (obj->shared && obj->shared->rc > 1) ||
+        H5_daos_file_open_elsewhere(file))
+        return FALSE;
+
+    if (NULL == (ent = H5_daos_name_filter_lookup(file, &obj->oid, type)) || !ent->complete)
+        return FALSE;
+
+    /* The name is absent if any of its bits is not set */
+    hash = H5_daos_name_filter_hash(name, name_len);
+    for (i = 0; i < H5_DAOS_NAME_FILTER_NHASHES; i++) {
+        bit = ((hash & UINT32_MAX) + i * ((hash >> 32) | 1)) % ((uint64_t)ent->nwords * 64);
+        if (!(ent->bits[bit / 64] & (UINT64_C(1) << (bit % 64))))
+            return TRUE;
+    } /* end for */
+
+    return FALSE;
+} /* end H5_daos_name_filter_absent() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_name_filters_free
+ *
+ * Purpose:     Frees a file's name filter table and the filters of its
+ *              entries.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_name_filters_free(H5_daos_file_t *file)
+{
+    size_t i;
+
+    assert(file);
+
+    if (!file->name_filters.ents)
+        return;
+
+    for (i = 0; i < H5_DAOS_NAME_FILTER_NENTRIES; i++)
+        if (file->name_filters.ents[i].bits)
+            DV_free(file->name_filters.ents[i].bits);
+    file->name_filters.ents = DV_free(file->name_filters.ents);
+} /* end H5_daos_name_filters_free() */
+
 /*-------------------------------------------------------------------------
  * Function:    H5_daos_object_exists
  *
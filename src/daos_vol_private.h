@@ -136,6 +136,29 @@ typedef d_sg_list_t daos_sg_list_t;
 /* Default target chunk size for automatic chunking */
 #define H5_DAOS_CHUNK_TARGET_SIZE_DEF ((uint64_t)(1024 * 1024))
 
+/* Default number of chunks whose I/O tasks are set up and tracked together */
+#define H5_DAOS_CHUNK_TASK_BATCH_SIZE_DEF ((uint64_t)64)
+
+/* Default target slab size and number of slabs in flight when copying
+ * dataset data */
+#define H5_DAOS_COPY_SLAB_SIZE_DEF ((uint64_t)(4 * 1024 * 1024))
+#define H5_DAOS_COPY_NSLABS_DEF    ((uint64_t)8)
+
+/* Default number of objects copied at once when copying a group hierarchy */
+#define H5_DAOS_COPY_NOBJS_DEF ((uint64_t)64)
+
+/* Default size of the buffer that collects variable-length sequences before
+ * they are written to the file's VL heap */
+#define H5_DAOS_VL_HEAP_BUF_SIZE_DEF ((uint64_t)(1024 * 1024))
+
+/* Maximum number of client data values cached for each filter in a dataset's
+ * filter pipeline */
+#define H5_DAOS_FILTER_MAX_CD_VALUES 8
+
+/* Size of the header (the encoded filter mask) stored before each filtered
+ * chunk */
+#define H5_DAOS_FILTER_HEADER_SIZE H5_DAOS_ENCODED_UINT64_T_SIZE
+
 /* Initial allocation sizes */
 #define H5_DAOS_GH_BUF_SIZE        1024
 #define H5_DAOS_LINK_NAME_BUF_SIZE 2048
@@ -148,7 +171,9 @@ typedef d_sg_list_t daos_sg_list_t;
 #define H5_DAOS_TCPL_BUF_SIZE      1024
 #define H5_DAOS_MCPL_BUF_SIZE      1024
 #define H5_DAOS_FILL_VAL_BUF_SIZE  1024
+#define H5_DAOS_COMPACT_BUF_SIZE   1024
 #define H5_DAOS_SEQ_LIST_LEN       128
+#define H5_DAOS_SEL_CACHE_NENTRIES 8
 #define H5_DAOS_ITER_LEN           128
 #define H5_DAOS_ITER_SIZE_INIT     (4 * 1024)
 #define H5_DAOS_ATTR_NUM_AKEYS     5
@@ -158,6 +183,24 @@ typedef d_sg_list_t daos_sg_list_t;
 /* Size of blob IDs */
 #define H5_DAOS_BLOB_ID_SIZE sizeof(uuid_t)
 
+/* Size of each segment of the VL heap and number of segment indices to
+ * allocate at a time */
+#define H5_DAOS_VL_HEAP_SEG_SIZE ((uint64_t)(64 * 1024 * 1024))
+#define H5_DAOS_VL_HEAP_NSEGS    16
+
+/* Number of entries in each file's path resolution cache */
+#define H5_DAOS_PATH_CACHE_NENTRIES 256
+
+/* Number of entries in each file's name filter table, the number of bits per
+ * name and the minimum and maximum number of 64 bit words in each entry's
+ * Bloom filter, and the number of hash functions, which is best at about 0.7
+ * times the number of bits per name */
+#define H5_DAOS_NAME_FILTER_NENTRIES      128
+#define H5_DAOS_NAME_FILTER_BITS_PER_NAME 10
+#define H5_DAOS_NAME_FILTER_MIN_NWORDS    16
+#define H5_DAOS_NAME_FILTER_MAX_NWORDS    8192
+#define H5_DAOS_NAME_FILTER_NHASHES       7
+
 /* Sizes of objects on storage */
 #define H5_DAOS_ENCODED_OID_SIZE       16
 #define H5_DAOS_ENCODED_CRT_ORDER_SIZE 8
@@ -193,6 +236,10 @@ typedef d_sg_list_t daos_sg_list_t;
 /* Number of object indices to allocate at a time */
 #define H5_DAOS_OIDX_NALLOC 1024
 
+/* Maximum number of object indices to allocate at a time when callers
+ * announce many upcoming object creations (see oidx_nalloc_hint) */
+#define H5_DAOS_OIDX_NALLOC_MAX (64 * H5_DAOS_OIDX_NALLOC)
+
 /* Polling interval (in milliseconds) when waiting for asynchronous tasks to
  * finish */
 #define H5_DAOS_ASYNC_POLL_INTERVAL 1
@@ -293,6 +340,18 @@ typedef d_sg_list_t daos_sg_list_t;
 /* Property to specify independent metadata I/O */
 #define H5_DAOS_IND_MD_IO_PROP_NAME "h5daos_independent_md_writes"
 
+/* Property to specify the number of type conversion worker threads */
+#define H5_DAOS_TCONV_NTHREADS_PROP_NAME "h5daos_tconv_nthreads"
+
+/* Property to specify the size of a dataset's chunk cache */
+#define H5_DAOS_CHUNK_CACHE_NBYTES_PROP_NAME "h5daos_chunk_cache_nbytes"
+
+/* Property to specify the number of chunks to read ahead of sequential reads */
+#define H5_DAOS_CHUNK_READAHEAD_PROP_NAME "h5daos_chunk_readahead"
+
+/* Property to specify the amount of buffered write data that triggers writing */
+#define H5_DAOS_WRITE_COMBINE_NBYTES_PROP_NAME "h5daos_write_combine_nbytes"
+
 /* DSINC - There are serious problems in HDF5 when trying to call
  * H5Pregister2/H5Punregister on the H5P_FILE_ACCESS class.
  */
@@ -496,12 +555,24 @@ typedef struct H5_daos_ocpl_cache_t {
     hbool_t track_acorder;
 } H5_daos_ocpl_cache_t;
 
+/* State shared by all open handles of a group or dataset in a file, kept in
+ * the file's open object table.  Later opens of the object use obj_oh and
+ * copy the decoded metadata of md_obj instead of reading it from the
+ * object. */
+typedef struct H5_daos_obj_shared_t {
+    daos_obj_id_t         oid;
+    daos_handle_t         obj_oh; /* Invalid until the first handle's metadata is read */
+    struct H5_daos_obj_t *md_obj; /* Handle to copy metadata from, NULL if none */
+    unsigned              rc;     /* Number of handles sharing this */
+} H5_daos_obj_shared_t;
+
 /* Common object information */
 typedef struct H5_daos_obj_t {
-    H5_daos_item_t       item; /* Must be first */
-    daos_obj_id_t        oid;
-    daos_handle_t        obj_oh;
-    H5_daos_ocpl_cache_t ocpl_cache;
+    H5_daos_item_t        item; /* Must be first */
+    daos_obj_id_t         oid;
+    daos_handle_t         obj_oh;
+    H5_daos_ocpl_cache_t  ocpl_cache;
+    H5_daos_obj_shared_t *shared; /* NULL if not in the file's open object table */
 } H5_daos_obj_t;
 
 /* The FAPL cache struct */
@@ -567,6 +638,92 @@ typedef struct H5_daos_enc_plist_cache_t {
     void  *acpl_buf;
 } H5_daos_enc_plist_cache_t;
 
+/* Variable-length heap.  Sequences stored through the blob callbacks are
+ * packed into segments, each of which is an array akey under its own dkey in
+ * the global metadata object.  Sequences are collected in buf and written to
+ * the current segment asynchronously once buf fills up. */
+typedef struct H5_daos_vl_heap_t {
+    uint64_t    seg;        /* Current segment index, 0 if none */
+    uint64_t    next_seg;   /* Next segment index in the allocated range */
+    uint64_t    max_seg;    /* Last segment index in the allocated range */
+    uint64_t    seg_off;    /* Offset in the segment of the start of buf */
+    uint8_t    *buf;        /* Sequences not yet written to the segment */
+    size_t      buf_nbytes; /* Number of bytes used in buf */
+    tse_task_t *write_task; /* Most recent segment write in flight */
+    int         status;     /* Result of the first failed segment write */
+} H5_daos_vl_heap_t;
+
+/* A sequence fetched ahead of a type conversion */
+typedef struct H5_daos_blob_prefetch_ent_t {
+    uint8_t blob_id[H5_DAOS_BLOB_ID_SIZE];
+    size_t  size;
+    size_t  off;
+} H5_daos_blob_prefetch_ent_t;
+
+/* Sequences fetched in a batch ahead of a type conversion that reads them
+ * through the blob callbacks.  Another conversion can run while a prefetch
+ * waits for its fetches, so each prefetch saves the one it replaces. */
+typedef struct H5_daos_blob_prefetch_t {
+    H5_daos_blob_prefetch_ent_t    *ents;
+    size_t                          nents;
+    uint8_t                        *buf;
+    struct H5_daos_blob_prefetch_t *prev;
+} H5_daos_blob_prefetch_t;
+
+/* An entry in a file's path resolution cache, mapping a path relative to a
+ * starting group to the OID of the group the path resolves to */
+typedef struct H5_daos_path_cache_ent_t {
+    uint64_t      hash;
+    daos_obj_id_t start_oid;
+    char         *path;
+    size_t        path_len;
+    daos_obj_id_t oid;
+} H5_daos_path_cache_ent_t;
+
+/* Path resolution cache.  Entries are direct mapped by the hash of the
+ * starting OID and path, and are all dropped when a link is deleted or
+ * moved.  gen is incremented each time the cache is invalidated, so entries
+ * resolved before then are not added. */
+typedef struct H5_daos_path_cache_t {
+    H5_daos_path_cache_ent_t *ents; /* Allocated on first insert */
+    uint64_t                  gen;
+} H5_daos_path_cache_t;
+
+/* Kinds of names tracked by the name filter table */
+typedef enum H5_daos_name_filter_type_t {
+    H5_DAOS_NAME_FILTER_LINK,
+    H5_DAOS_NAME_FILTER_ATTR
+} H5_daos_name_filter_type_t;
+
+/* An entry in a file's name filter table: a Bloom filter of the link or
+ * attribute names of one object.  Names are added as they are listed by
+ * iteration or created, and never removed, so once complete is set a name
+ * missing from the filter does not exist.  gen identifies the entry's
+ * current owner, and is 0 if the entry is unused.  The filter is sized from
+ * the number of names counted the last time it was filled, so a filter that
+ * turns out to be too small is refilled at a larger size by the next
+ * iteration. */
+typedef struct H5_daos_name_filter_ent_t {
+    daos_obj_id_t              oid;
+    H5_daos_name_filter_type_t type;
+    uint64_t                   gen;
+    hbool_t                    complete;
+    size_t                     nnames; /* Names added since the filter was started */
+    size_t                     nwords;
+    uint64_t                  *bits;
+} H5_daos_name_filter_ent_t;
+
+/* Name filter table.  Entries are direct mapped by the hash of the OID and
+ * name type.  When the file is open on multiple processes they are only used
+ * on rank 0 with collective metadata writes, since rank 0 then performs all
+ * creates, and names created independently by other processes are not
+ * seen. */
+typedef struct H5_daos_name_filters_t {
+    H5_daos_name_filter_ent_t *ents;     /* Allocated on first use */
+    uint64_t                   gen;
+    uint64_t                   ncreates; /* Link and attribute creates not yet finished */
+} H5_daos_name_filters_t;
+
 /* The file struct */
 typedef struct H5_daos_file_t {
     H5_daos_item_t            item; /* Must be first */
@@ -593,6 +750,14 @@ typedef struct H5_daos_file_t {
     uint64_t                  max_oidx;
     uint64_t                  next_oidx_collective;
     uint64_t                  max_oidx_collective;
+    tse_task_t               *oidx_alloc_task;
+    uint64_t                  oidx_nalloc_hint;
+    dv_hash_table_t          *obj_table;
+    H5_daos_vl_heap_t         vl_heap;
+    H5_daos_blob_prefetch_t  *blob_prefetch;
+    H5_daos_path_cache_t      path_cache;
+    H5_daos_name_filters_t    name_filters;
+    struct H5_daos_file_t    *open_next; /* Next file open in this process */
 } H5_daos_file_t;
 
 /* The GCPL cache struct */
@@ -619,12 +784,22 @@ typedef enum {
     H5_DAOS_COPY_FILL
 } H5_daos_fill_method_t;
 
+/* Information about a single filter in a dataset's filter pipeline */
+typedef struct H5_daos_filter_info_t {
+    H5Z_filter_t id;
+    unsigned     flags;
+    size_t       cd_nelmts;
+    unsigned     cd_values[H5_DAOS_FILTER_MAX_CD_VALUES];
+} H5_daos_filter_info_t;
+
 /* The DCPL cache struct */
 typedef struct H5_daos_dcpl_cache_t {
-    H5D_layout_t          layout;
-    hsize_t               chunk_dims[H5S_MAX_RANK];
-    H5D_fill_value_t      fill_status;
-    H5_daos_fill_method_t fill_method;
+    H5D_layout_t           layout;
+    hsize_t                chunk_dims[H5S_MAX_RANK];
+    H5D_fill_value_t       fill_status;
+    H5_daos_fill_method_t  fill_method;
+    unsigned               nfilters;
+    H5_daos_filter_info_t *filters;
 } H5_daos_dcpl_cache_t;
 
 /* Information about a singular selected chunk during a dataset read/write */
@@ -635,8 +810,38 @@ typedef struct H5_daos_select_chunk_info_t {
                                             selection in the chunk in memory */
     hid_t fspace_id;                     /* The file space corresponding to the
                                             selection in the chunk in the file */
+    hbool_t sel_regular;                 /* Whether the chunk's selection is described by
+                                            the dataset's cached regular selection instead
+                                            of mspace_id and fspace_id */
 } H5_daos_select_chunk_info_t;
 
+/* A regular hyperslab (or "all") file selection and a memory selection of the
+ * same shape, normalized so that contiguous blocks are expressed as a single
+ * block.  Used to compute the selection within each chunk arithmetically
+ * instead of through per-chunk dataspaces */
+typedef struct H5_daos_regular_sel_t {
+    int     ndims;
+    hsize_t start[H5S_MAX_RANK];
+    hsize_t stride[H5S_MAX_RANK];
+    hsize_t count[H5S_MAX_RANK];
+    hsize_t block[H5S_MAX_RANK];
+    hsize_t mem_start[H5S_MAX_RANK];
+    hsize_t mem_dims[H5S_MAX_RANK];
+} H5_daos_regular_sel_t;
+
+/* An entry in a dataset's selection translation cache.  Holds the sequence
+ * list (in elements) generated for a selection, keyed on a fingerprint of the
+ * selection, so it can be turned back into recxs and/or sg_iovs for any
+ * buffer without walking the selection again */
+typedef struct H5_daos_sel_cache_ent_t {
+    uint64_t     hash;
+    hsize_t     *key;
+    size_t       key_len;
+    daos_recx_t *seqs;
+    size_t       nseq;
+    uint64_t     last_use;
+} H5_daos_sel_cache_ent_t;
+
 /* The dataset struct */
 typedef struct H5_daos_dset_t {
     H5_daos_obj_t        obj; /* Must be first */
@@ -656,7 +861,36 @@ typedef struct H5_daos_dset_t {
         size_t                       chunk_info_nalloc;
         hid_t                        mem_sel_iter_id;
         hid_t                        file_sel_iter_id;
+        H5_daos_regular_sel_t        regular_sel;
+        H5_daos_sel_cache_ent_t      sel_cache[H5_DAOS_SEL_CACHE_NENTRIES];
+        uint64_t                     sel_cache_clock;
     } io_cache;
+    struct {
+        size_t                            nbytes_max;
+        size_t                            nbytes;
+        size_t                            chunk_size;
+        uint64_t                          chunk_nelem;
+        int                               ndims;
+        dv_hash_table_t                  *table;
+        struct H5_daos_chunk_cache_ent_t *lru_head;
+        struct H5_daos_chunk_cache_ent_t *lru_tail;
+        struct H5_daos_chunk_cache_wb_t  *wb_head;
+        unsigned                          ra_nchunks;
+        hbool_t                           ra_valid;
+        uint64_t                          ra_last;
+        uint64_t                          ra_issued;
+        size_t                            wc_nbytes;
+        size_t                            ndirty_bytes;
+    } chunk_cache;
+    struct H5_daos_chunk_index_t *chunk_index;
+    struct H5_daos_dset_t        *peer_next;   /* Next dataset in this process's list of handles to keep
+                                                  coherent with other handles of the same dataset */
+    hbool_t                       peer_listed; /* Whether the dataset is in that list */
+    struct {
+        hbool_t stored;
+        size_t  size;
+        void   *buf;
+    } compact;
 } H5_daos_dset_t;
 
 /* The datatype struct */
@@ -715,6 +949,36 @@ typedef enum {
 /* Enum type for distinguishing between I/O reads and writes. */
 typedef enum H5_daos_io_type_t { IO_READ, IO_WRITE } H5_daos_io_type_t;
 
+/* Connector-native type conversion routine.  Converts nelem elements from
+ * src to dst, which may be the same buffer (in which case the buffer must be
+ * large enough for the larger of the two types) but must not otherwise
+ * overlap.  Must not call into HDF5, so it can run on a worker thread. */
+struct H5_daos_tconv_native_t;
+typedef void (*H5_daos_tconv_func_t)(const struct H5_daos_tconv_native_t *conv, const void *src, void *dst,
+                                     size_t nelem);
+
+/* Description of a conversion performed by a connector-native routine */
+typedef struct H5_daos_tconv_native_t {
+    H5_daos_tconv_func_t func;       /* Conversion routine, NULL if none */
+    size_t               src_size;   /* Size of source type */
+    size_t               dst_size;   /* Size of destination type */
+    hbool_t              src_swap;   /* Whether source type is not in native byte order */
+    hbool_t              dst_swap;   /* Whether destination type is not in native byte order */
+    hbool_t              src_signed; /* Whether source type is signed */
+    hbool_t              dst_signed; /* Whether destination type is signed */
+} H5_daos_tconv_native_t;
+
+/* A type conversion job handed to the type conversion worker pool.  task is
+ * completed from the progress functions once the job is done. */
+typedef struct H5_daos_tconv_job_t {
+    const H5_daos_tconv_native_t *conv;
+    const void                   *src;
+    void                         *dst;
+    size_t                        nelem;
+    tse_task_t                   *task;
+    struct H5_daos_tconv_job_t   *next;
+} H5_daos_tconv_job_t;
+
 /* Forward declaration for generic request struct */
 typedef struct H5_daos_req_t H5_daos_req_t;
 
@@ -753,6 +1017,7 @@ struct H5_daos_req_t {
     const char           *failed_task;
     const char           *op_name;
     hbool_t               in_progress;
+    hbool_t               name_filter_create; /* Counted in file->name_filters.ncreates */
     struct {
         H5_daos_mpi_ibcast_ud_t err_check_ud;
         int                     coll_status;
@@ -832,6 +1097,8 @@ typedef struct H5_daos_omd_fetch_ud_t {
     H5_daos_md_rw_cb_ud_t         md_rw_cb_ud; /* Must be first */
     H5_daos_mpi_ibcast_ud_flex_t *bcast_udata;
     tse_task_t                   *fetch_metatask;
+    uint8_t                       marker_buf;   /* Value of a marker akey fetched with the metadata */
+    hbool_t                       marker_found; /* Whether the marker akey exists */
     uint8_t                       flex_buf[];
 } H5_daos_omd_fetch_ud_t;
 
@@ -843,6 +1110,7 @@ typedef struct H5_daos_oidx_generate_ud_t {
     uint64_t               *oidx_out;
     uint64_t               *next_oidx;
     uint64_t               *max_oidx;
+    uint64_t                nalloc;
 } H5_daos_oidx_generate_ud_t;
 
 /* Task user data for broadcasting the next OIDX
@@ -971,6 +1239,7 @@ typedef struct H5_daos_iter_ud_t {
     daos_anchor_t        anchor;
     hbool_t              base_iter;
     tse_task_t          *iter_metatask;
+    uint64_t             name_filter_gen; /* 0 until link names are added to the name filter */
 } H5_daos_iter_ud_t;
 
 /* A union to contain either an hvl_t or a char *, for vlen conversions that
@@ -1025,6 +1294,22 @@ extern H5VL_DAOS_PRIVATE hbool_t H5_daos_bypass_duns_g;
 /* Target chunk size for automatic chunking */
 extern H5VL_DAOS_PRIVATE uint64_t H5_daos_chunk_target_size_g;
 
+/* Number of chunks per task batch for raw data I/O */
+extern H5VL_DAOS_PRIVATE uint64_t H5_daos_chunk_task_batch_size_g;
+
+/* Target slab size and number of slabs in flight when copying dataset data */
+extern H5VL_DAOS_PRIVATE uint64_t H5_daos_copy_slab_size_g;
+extern H5VL_DAOS_PRIVATE uint64_t H5_daos_copy_nslabs_g;
+
+/* Number of objects copied at once when copying a group hierarchy */
+extern H5VL_DAOS_PRIVATE uint64_t H5_daos_copy_nobjs_g;
+
+/* Size of the buffer collecting sequences for the VL heap */
+extern H5VL_DAOS_PRIVATE uint64_t H5_daos_vl_heap_buf_size_g;
+
+/* Number of threads in the type conversion worker pool */
+extern H5VL_DAOS_PRIVATE size_t H5_daos_tconv_nthreads_g;
+
 /* Global scheduler - used for tasks that are not tied to any open file */
 extern tse_sched_t H5_daos_glob_sched_g;
 
@@ -1069,6 +1354,7 @@ extern H5VL_DAOS_PRIVATE const char H5_daos_link_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_link_corder_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_nlinks_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_max_link_corder_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_link_corder_version_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_type_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_space_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_attr_key_g[];
@@ -1079,6 +1365,10 @@ extern H5VL_DAOS_PRIVATE const char H5_daos_vtype_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_map_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_blob_key_g[];
 extern H5VL_DAOS_PRIVATE const char H5_daos_fillval_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_compact_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_filtered_chunks_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_chunk_index_key_g[];
+extern H5VL_DAOS_PRIVATE const char H5_daos_chunk_index_valid_key_g[];
 
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_int_md_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_root_grp_oid_key_size_g;
@@ -1088,6 +1378,7 @@ extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_corder_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_nlinks_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_max_link_corder_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_link_corder_version_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_type_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_space_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_attr_key_size_g;
@@ -1098,6 +1389,10 @@ extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_vtype_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_map_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_blob_key_size_g;
 extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_fillval_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_compact_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_filtered_chunks_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_chunk_index_key_size_g;
+extern H5VL_DAOS_PRIVATE const daos_size_t H5_daos_chunk_index_valid_key_size_g;
 
 /**********************/
 /* Private Prototypes */
@@ -1151,9 +1446,11 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_file_specific(void *item, H5VL_file_specific_ar
 H5VL_DAOS_PRIVATE herr_t H5_daos_file_close(void *_file, hid_t dxpl_id, void **req);
 
 /* Other file routines */
-H5VL_DAOS_PRIVATE herr_t H5_daos_file_flush(H5_daos_file_t *file, H5_daos_req_t *req, tse_task_t **first_task,
-                                            tse_task_t **dep_task);
-H5VL_DAOS_PRIVATE herr_t H5_daos_file_close_helper(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE herr_t  H5_daos_file_flush(H5_daos_file_t *file, H5_daos_req_t *req,
+                                             tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t  H5_daos_file_close_helper(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE hbool_t H5_daos_file_open_elsewhere(const H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE void    H5_daos_file_invalidate_path_caches(H5_daos_file_t *file);
 
 /* Link callbacks */
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_create(H5VL_link_create_args_t *create_args, void *_item,
@@ -1175,6 +1472,9 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_link_specific(void *_item, const H5VL_loc_param
 H5VL_DAOS_PRIVATE int    H5_daos_link_write(H5_daos_group_t *grp, const char *name, size_t name_len,
                                             H5_daos_link_val_t *val, H5_daos_req_t *req, tse_task_t **first_task,
                                             tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_link_create_hard_multi(H5_daos_group_t *grp, size_t count,
+                                                        const char *const names[],
+                                                        H5_daos_obj_t *const objs[]);
 H5VL_DAOS_PRIVATE herr_t H5_daos_link_copy_move_int(H5_daos_item_t          *src_item,
                                                     const H5VL_loc_params_t *loc_params1,
                                                     H5_daos_item_t          *dst_item,
@@ -1251,12 +1551,13 @@ H5VL_DAOS_PRIVATE herr_t           H5_daos_group_get_num_links(H5_daos_group_t *
                                                                H5_daos_req_t *req, tse_task_t **first_task,
                                                                tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_group_get_max_crt_order(H5_daos_group_t *target_grp, uint64_t *max_corder,
-                                                         H5_daos_req_t *req, tse_task_t **first_task,
-                                                         tse_task_t **dep_task);
+                                                         uint8_t *corder_version, H5_daos_req_t *req,
+                                                         tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_group_refresh(H5_daos_group_t *grp, hid_t dxpl_id, void **req);
 H5VL_DAOS_PRIVATE herr_t H5_daos_group_flush(H5_daos_group_t *grp, H5_daos_req_t *req,
                                              tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_group_close_real(H5_daos_group_t *grp);
+H5VL_DAOS_PRIVATE void   H5_daos_path_cache_invalidate(H5_daos_file_t *file);
 
 /* Dataset callbacks */
 H5VL_DAOS_PRIVATE void *H5_daos_dataset_create(void *_item, const H5VL_loc_params_t *loc_params,
@@ -1281,6 +1582,8 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_get(void *_dset, H5VL_dataset_get_args_
                                              void **req);
 H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_specific(void *_item, H5VL_dataset_specific_args_t *specific_args,
                                                   hid_t dxpl_id, void **req);
+H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_optional(void *_dset, H5VL_optional_args_t *opt_args, hid_t dxpl_id,
+                                                  void **req);
 H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_close(void *_dset, hid_t dxpl_id, void **req);
 
 /* Other dataset routines */
@@ -1306,6 +1609,24 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_flush(H5_daos_dset_t *dset, H5_daos_req
                                                tse_task_t **first_task, tse_task_t **dep_task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_dataset_close_real(H5_daos_dset_t *dset);
 
+/* Filter pipeline routines */
+H5VL_DAOS_PRIVATE herr_t H5_daos_filter_get_pipeline(hid_t dcpl_id, unsigned *nfilters,
+                                                     H5_daos_filter_info_t **filters);
+H5VL_DAOS_PRIVATE htri_t H5_daos_filter_pipeline_avail(unsigned nfilters, const H5_daos_filter_info_t *filters);
+H5VL_DAOS_PRIVATE size_t H5_daos_filter_max_size(unsigned nfilters, const H5_daos_filter_info_t *filters,
+                                                 size_t nbytes);
+H5VL_DAOS_PRIVATE herr_t H5_daos_filter_apply(unsigned nfilters, const H5_daos_filter_info_t *filters,
+                                              size_t type_size, hbool_t reverse, uint64_t *filter_mask,
+                                              void **buf, size_t *buf_size, size_t *nbytes);
+
+/* Type conversion worker pool routines */
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_pool_init(size_t nthreads);
+H5VL_DAOS_PRIVATE void   H5_daos_tconv_pool_term(void);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_pool_submit(H5_daos_tconv_job_t *job);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_pool_progress(void);
+H5VL_DAOS_PRIVATE herr_t H5_daos_tconv_get_native(hid_t src_type_id, hid_t dst_type_id, hid_t dxpl_id,
+                                                  H5_daos_tconv_native_t *conv);
+
 /* Datatype callbacks */
 H5VL_DAOS_PRIVATE void  *H5_daos_datatype_commit(void *obj, const H5VL_loc_params_t *loc_params,
                                                  const char *name, hid_t type_id, hid_t lcpl_id, hid_t tcpl_id,
@@ -1364,6 +1685,20 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_object_visit(H5_daos_obj_t ***target_obj_prev_o
 H5VL_DAOS_PRIVATE int    H5_daos_object_close_task(tse_task_t *task);
 H5VL_DAOS_PRIVATE herr_t H5_daos_object_close(H5_daos_item_t *item);
 H5VL_DAOS_PRIVATE herr_t H5_daos_fill_ocpl_cache(H5_daos_obj_t *obj, hid_t ocpl_id);
+H5VL_DAOS_PRIVATE herr_t H5_daos_obj_share(H5_daos_obj_t *obj);
+H5VL_DAOS_PRIVATE void   H5_daos_obj_set_shared_md(H5_daos_obj_t *obj, hbool_t updated);
+H5VL_DAOS_PRIVATE herr_t H5_daos_obj_unshare(H5_daos_obj_t *obj);
+H5VL_DAOS_PRIVATE herr_t H5_daos_name_filter_begin(H5_daos_file_t *file, const daos_obj_id_t *oid,
+                                                   H5_daos_name_filter_type_t type, uint64_t *gen);
+H5VL_DAOS_PRIVATE void   H5_daos_name_filter_add(H5_daos_file_t *file, const daos_obj_id_t *oid,
+                                                 H5_daos_name_filter_type_t type, uint64_t gen,
+                                                 const char *name, size_t name_len);
+H5VL_DAOS_PRIVATE void   H5_daos_name_filter_end(H5_daos_file_t *file, const daos_obj_id_t *oid,
+                                                 H5_daos_name_filter_type_t type, uint64_t gen);
+H5VL_DAOS_PRIVATE void   H5_daos_name_filter_create(H5_daos_req_t *req);
+H5VL_DAOS_PRIVATE void   H5_daos_name_filters_free(H5_daos_file_t *file);
+H5VL_DAOS_PRIVATE htri_t H5_daos_name_filter_absent(H5_daos_obj_t *obj, H5_daos_name_filter_type_t type,
+                                                    const char *name, size_t name_len);
 H5VL_DAOS_PRIVATE herr_t H5_daos_object_get_num_attrs(H5_daos_obj_t *target_obj, hsize_t *num_attrs,
                                                       hbool_t post_decrement, H5_daos_req_t *req,
                                                       tse_task_t **first_task, tse_task_t **dep_task);
@@ -1456,6 +1791,14 @@ H5VL_DAOS_PRIVATE herr_t H5_daos_blob_get(void *_file, const void *blob_id, void
 H5VL_DAOS_PRIVATE herr_t H5_daos_blob_specific(void *_file, void *blob_id,
                                                H5VL_blob_specific_args_t *specific_args);
 
+/* Other blob routines */
+H5VL_DAOS_PRIVATE herr_t H5_daos_blob_heap_flush(H5_daos_file_t *file, H5_daos_req_t *req,
+                                                 tse_task_t **first_task, tse_task_t **dep_task);
+H5VL_DAOS_PRIVATE herr_t H5_daos_blob_prefetch(H5_daos_file_t *file, hid_t type_id, const void *buf,
+                                               size_t num_elem, H5_daos_blob_prefetch_t *prefetch);
+H5VL_DAOS_PRIVATE herr_t H5_daos_blob_prefetch_release(H5_daos_file_t          *file,
+                                                       H5_daos_blob_prefetch_t *prefetch);
+
 /* Request callbacks */
 H5VL_DAOS_PRIVATE herr_t H5_daos_req_wait(void *req, uint64_t timeout, H5_DAOS_REQ_STATUS_OUT_TYPE *status);
 H5VL_DAOS_PRIVATE herr_t H5_daos_req_notify(void *req, H5VL_request_notify_t cb, void *ctx);
@@ -257,6 +257,8 @@ H5_daos_req_create(H5_daos_file_t *file, const char *op_name, H5_daos_req_t *pre
     ret_value->op_name     = op_name;
     ret_value->in_progress = FALSE;
 
+    ret_value->name_filter_create = FALSE;
+
 done:
     D_FUNC_LEAVE;
 } /* end H5_daos_req_create() */
@@ -288,6 +290,12 @@ H5_daos_req_free_int(H5_daos_req_t *req)
                  * anyways */
                 D_DONE_ERROR(H5E_DAOS_ASYNC, H5E_CLOSEERROR, FAIL, "can't close data transfer property list");
 
+        /* The request's link or attribute creates are finished */
+        if (req->name_filter_create) {
+            assert(req->file->name_filters.ncreates > 0);
+            req->file->name_filters.ncreates--;
+        } /* end if */
+
         /* Close file */
         if (req->file && H5_daos_file_close_helper(req->file) < 0)
             D_DONE_ERROR(H5E_DAOS_ASYNC, H5E_CLOSEERROR, FAIL, "can't close file");
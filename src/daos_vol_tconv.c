@@ -0,0 +1,676 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: The DAOS VOL connector where access is forwarded to the DAOS
+ * library. Type conversion worker pool and connector-native type conversion
+ * routines.
+ */
+
+#include "daos_vol_private.h" /* DAOS connector                          */
+
+#include "util/daos_vol_err.h" /* DAOS connector error handling           */
+#include "util/daos_vol_mem.h" /* DAOS connector memory management        */
+
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+/* State of the type conversion worker pool.  The HDF5 library is not safe to
+ * call from the worker threads, so workers only ever run connector-native
+ * conversion routines.  Jobs are queued from and harvested on the thread
+ * driving the DAOS scheduler. */
+typedef struct H5_daos_tconv_pool_t {
+    pthread_mutex_t      mutex;
+    pthread_cond_t       cond;
+    pthread_t           *threads;
+    size_t               nthreads;
+    hbool_t              shutdown;
+    H5_daos_tconv_job_t *queue_head;
+    H5_daos_tconv_job_t *queue_tail;
+    H5_daos_tconv_job_t *done_head;
+} H5_daos_tconv_pool_t;
+
+/* Number of threads in the type conversion worker pool */
+size_t H5_daos_tconv_nthreads_g = 0;
+
+/* The type conversion worker pool */
+static H5_daos_tconv_pool_t H5_daos_tconv_pool_g = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, 0, FALSE, NULL, NULL, NULL};
+
+/* Byte swapping macros.  Written as plain shifts so compilers can
+ * recognize them and vectorize the conversion loops. */
+#define H5_DAOS_BSWAP16(X) ((uint16_t)(((uint16_t)(X) >> 8) | ((uint16_t)(X) << 8)))
+#define H5_DAOS_BSWAP32(X)                                                                                   \
+    ((((uint32_t)(X) & 0x000000ffu) << 24) | (((uint32_t)(X) & 0x0000ff00u) << 8) |                          \
+     (((uint32_t)(X) & 0x00ff0000u) >> 8) | (((uint32_t)(X) & 0xff000000u) >> 24))
+#define H5_DAOS_BSWAP64(X)                                                                                   \
+    (((uint64_t)H5_DAOS_BSWAP32((uint32_t)(X)) << 32) | (uint64_t)H5_DAOS_BSWAP32((uint32_t)((uint64_t)(X) >> 32)))
+
+static void  *H5_daos_tconv_pool_worker(void *arg);
+static herr_t H5_daos_tconv_native_type_info(hid_t type_id, H5T_order_t native_order, H5T_class_t *type_class,
+                                             size_t *type_size, hbool_t *swap, hbool_t *is_signed,
+                                             hbool_t *supported);
+static uint64_t H5_daos_tconv_load(const uint8_t *p, size_t size, hbool_t swap);
+static void     H5_daos_tconv_store(uint8_t *p, uint64_t val, size_t size, hbool_t swap);
+static void     H5_daos_tconv_bswap(const H5_daos_tconv_native_t *conv, const void *src, void *dst, size_t nelem);
+static void     H5_daos_tconv_int(const H5_daos_tconv_native_t *conv, const void *src, void *dst, size_t nelem);
+static void     H5_daos_tconv_float(const H5_daos_tconv_native_t *conv, const void *src, void *dst,
+                                    size_t nelem);
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_pool_worker
+ *
+ * Purpose:     Main routine for a type conversion worker thread.  Takes
+ *              jobs from the queue, runs them, and moves them to the done
+ *              list until the pool is shut down and the queue is empty.
+ *
+ * Return:      NULL
+ *
+ *-------------------------------------------------------------------------
+ */
+static void *
+H5_daos_tconv_pool_worker(void H5VL_DAOS_UNUSED *arg)
+{
+    H5_daos_tconv_pool_t *pool = &H5_daos_tconv_pool_g;
+    H5_daos_tconv_job_t  *job;
+
+    pthread_mutex_lock(&pool->mutex);
+    while (1) {
+        /* Wait for a job */
+        while (!pool->queue_head && !pool->shutdown)
+            pthread_cond_wait(&pool->cond, &pool->mutex);
+        if (!pool->queue_head)
+            break;
+
+        /* Take the job off the queue */
+        job              = pool->queue_head;
+        pool->queue_head = job->next;
+        if (!pool->queue_head)
+            pool->queue_tail = NULL;
+        pthread_mutex_unlock(&pool->mutex);
+
+        /* Run the conversion */
+        job->conv->func(job->conv, job->src, job->dst, job->nelem);
+
+        /* Add the job to the done list */
+        pthread_mutex_lock(&pool->mutex);
+        job->next       = pool->done_head;
+        pool->done_head = job;
+    } /* end while */
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+} /* end H5_daos_tconv_pool_worker() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_pool_init
+ *
+ * Purpose:     Starts the type conversion worker pool, or grows it so it
+ *              has at least nthreads threads.  The pool never shrinks
+ *              until it is terminated.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_pool_init(size_t nthreads)
+{
+    H5_daos_tconv_pool_t *pool = &H5_daos_tconv_pool_g;
+    pthread_t            *tmp_threads;
+    int                   ret;
+    herr_t                ret_value = SUCCEED;
+
+    if (nthreads <= pool->nthreads)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Extend the thread array */
+    if (NULL == (tmp_threads = (pthread_t *)DV_realloc(pool->threads, nthreads * sizeof(pthread_t))))
+        D_GOTO_ERROR(H5E_RESOURCE, H5E_CANTALLOC, FAIL, "can't allocate type conversion thread array");
+    pool->threads = tmp_threads;
+
+    /* Start the new threads */
+    pool->shutdown = FALSE;
+    while (pool->nthreads < nthreads) {
+        if (0 != (ret = pthread_create(&pool->threads[pool->nthreads], NULL, H5_daos_tconv_pool_worker, NULL)))
+            D_GOTO_ERROR(H5E_VOL, H5E_CANTINIT, FAIL, "can't create type conversion thread: %s",
+                         strerror(ret));
+        pool->nthreads++;
+    } /* end while */
+
+done:
+    H5_daos_tconv_nthreads_g = pool->nthreads;
+
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_pool_init() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_pool_term
+ *
+ * Purpose:     Shuts down the type conversion worker pool.  Queued jobs
+ *              are run before the workers exit, but their tasks are not
+ *              completed, so the DAOS scheduler should be drained before
+ *              calling this function.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+void
+H5_daos_tconv_pool_term(void)
+{
+    H5_daos_tconv_pool_t *pool = &H5_daos_tconv_pool_g;
+    size_t                i;
+
+    if (pool->nthreads == 0)
+        return;
+
+    /* Wake all workers and tell them to exit */
+    pthread_mutex_lock(&pool->mutex);
+    pool->shutdown = TRUE;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (i = 0; i < pool->nthreads; i++)
+        (void)pthread_join(pool->threads[i], NULL);
+
+    pool->threads            = DV_free(pool->threads);
+    pool->nthreads           = 0;
+    pool->done_head          = NULL;
+    H5_daos_tconv_nthreads_g = 0;
+} /* end H5_daos_tconv_pool_term() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_pool_submit
+ *
+ * Purpose:     Queues a type conversion job on the worker pool.
+ *              job->task will be completed by H5_daos_tconv_pool_progress
+ *              once the conversion has been performed.  The job must
+ *              remain valid until then.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_pool_submit(H5_daos_tconv_job_t *job)
+{
+    H5_daos_tconv_pool_t *pool      = &H5_daos_tconv_pool_g;
+    herr_t                ret_value = SUCCEED;
+
+    assert(job);
+    assert(job->conv && job->conv->func);
+    assert(job->task);
+
+    if (pool->nthreads == 0)
+        D_GOTO_ERROR(H5E_VOL, H5E_BADVALUE, FAIL, "type conversion worker pool not started");
+
+    job->next = NULL;
+
+    pthread_mutex_lock(&pool->mutex);
+    if (pool->queue_tail)
+        pool->queue_tail->next = job;
+    else
+        pool->queue_head = job;
+    pool->queue_tail = job;
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->mutex);
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_pool_submit() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_pool_progress
+ *
+ * Purpose:     Completes the tasks for all type conversion jobs that the
+ *              worker pool has finished.  Called from the progress
+ *              functions alongside the check for in-flight MPI tasks.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_pool_progress(void)
+{
+    H5_daos_tconv_pool_t *pool = &H5_daos_tconv_pool_g;
+    H5_daos_tconv_job_t  *job;
+    H5_daos_tconv_job_t  *next_job;
+    tse_task_t           *tmp_task;
+    herr_t                ret_value = SUCCEED;
+
+    if (pool->nthreads == 0)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Take the whole done list */
+    pthread_mutex_lock(&pool->mutex);
+    job             = pool->done_head;
+    pool->done_head = NULL;
+    pthread_mutex_unlock(&pool->mutex);
+
+    /* Complete the task for each job.  Save the next pointer first since the
+     * job may be freed by the task's completion callback. */
+    while (job) {
+        next_job = job->next;
+        tmp_task = job->task;
+
+        /* Return task to task list */
+        if (H5_daos_task_list_put(H5_daos_task_list_g, tmp_task) < 0)
+            D_DONE_ERROR(H5E_VOL, H5E_CLOSEERROR, FAIL, "can't return task to task list");
+        tse_task_complete(tmp_task, 0);
+
+        job = next_job;
+    } /* end while */
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_pool_progress() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_load
+ *
+ * Purpose:     Loads an unsigned integer of size bytes (1, 2, 4 or 8)
+ *              from p, byte swapping it if swap is TRUE.
+ *
+ * Return:      The loaded value (can't fail)
+ *
+ *-------------------------------------------------------------------------
+ */
+static uint64_t
+H5_daos_tconv_load(const uint8_t *p, size_t size, hbool_t swap)
+{
+    uint8_t  u8;
+    uint16_t u16;
+    uint32_t u32;
+    uint64_t u64;
+
+    switch (size) {
+        case 1:
+            u8 = *p;
+            return (uint64_t)u8;
+        case 2:
+            (void)memcpy(&u16, p, sizeof(u16));
+            return (uint64_t)(swap ? H5_DAOS_BSWAP16(u16) : u16);
+        case 4:
+            (void)memcpy(&u32, p, sizeof(u32));
+            return (uint64_t)(swap ? H5_DAOS_BSWAP32(u32) : u32);
+        default:
+            assert(size == 8);
+            (void)memcpy(&u64, p, sizeof(u64));
+            return swap ? H5_DAOS_BSWAP64(u64) : u64;
+    } /* end switch */
+} /* end H5_daos_tconv_load() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_store
+ *
+ * Purpose:     Stores the low size bytes (1, 2, 4 or 8) of val to p,
+ *              byte swapping them if swap is TRUE.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tconv_store(uint8_t *p, uint64_t val, size_t size, hbool_t swap)
+{
+    uint16_t u16;
+    uint32_t u32;
+
+    switch (size) {
+        case 1:
+            *p = (uint8_t)val;
+            break;
+        case 2:
+            u16 = (uint16_t)val;
+            if (swap)
+                u16 = H5_DAOS_BSWAP16(u16);
+            (void)memcpy(p, &u16, sizeof(u16));
+            break;
+        case 4:
+            u32 = (uint32_t)val;
+            if (swap)
+                u32 = H5_DAOS_BSWAP32(u32);
+            (void)memcpy(p, &u32, sizeof(u32));
+            break;
+        default:
+            assert(size == 8);
+            if (swap)
+                val = H5_DAOS_BSWAP64(val);
+            (void)memcpy(p, &val, sizeof(val));
+            break;
+    } /* end switch */
+} /* end H5_daos_tconv_store() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_bswap
+ *
+ * Purpose:     Converts between two integer or floating-point types that
+ *              differ only in byte order.  The loops for each element
+ *              size are kept separate and branch free so they vectorize.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tconv_bswap(const H5_daos_tconv_native_t *conv, const void *src, void *dst, size_t nelem)
+{
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t       *d = (uint8_t *)dst;
+    size_t         i;
+
+    assert(conv->src_size == conv->dst_size);
+
+    switch (conv->src_size) {
+        case 2: {
+            uint16_t u16;
+
+            for (i = 0; i < nelem; i++) {
+                (void)memcpy(&u16, s + (2 * i), sizeof(u16));
+                u16 = H5_DAOS_BSWAP16(u16);
+                (void)memcpy(d + (2 * i), &u16, sizeof(u16));
+            } /* end for */
+            break;
+        }
+
+        case 4: {
+            uint32_t u32;
+
+            for (i = 0; i < nelem; i++) {
+                (void)memcpy(&u32, s + (4 * i), sizeof(u32));
+                u32 = H5_DAOS_BSWAP32(u32);
+                (void)memcpy(d + (4 * i), &u32, sizeof(u32));
+            } /* end for */
+            break;
+        }
+
+        case 8: {
+            uint64_t u64;
+
+            for (i = 0; i < nelem; i++) {
+                (void)memcpy(&u64, s + (8 * i), sizeof(u64));
+                u64 = H5_DAOS_BSWAP64(u64);
+                (void)memcpy(d + (8 * i), &u64, sizeof(u64));
+            } /* end for */
+            break;
+        }
+
+        default:
+            /* Single bytes have no byte order */
+            if (s != d)
+                (void)memcpy(d, s, nelem * conv->src_size);
+            break;
+    } /* end switch */
+} /* end H5_daos_tconv_bswap() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_int
+ *
+ * Purpose:     Converts between two integer types of any size, sign and
+ *              byte order.  Values out of range for the destination type
+ *              are clamped to its minimum or maximum, matching HDF5's
+ *              hard conversions when no exception callback is set.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tconv_int(const H5_daos_tconv_native_t *conv, const void *src, void *dst, size_t nelem)
+{
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t       *d = (uint8_t *)dst;
+    uint64_t       src_sign_bit;
+    uint64_t       dst_umax;
+    int64_t        dst_smax;
+    int64_t        dst_smin;
+    uint64_t       val;
+    int64_t        sval;
+    size_t         i;
+    size_t         idx;
+
+    src_sign_bit = (uint64_t)1 << ((8 * conv->src_size) - 1);
+    dst_umax     = conv->dst_size == 8 ? UINT64_MAX : (((uint64_t)1 << (8 * conv->dst_size)) - 1);
+    dst_smax     = (int64_t)(dst_umax >> 1);
+    dst_smin     = -dst_smax - 1;
+
+    /* When widening, walk backward so an in-place conversion never
+     * overwrites unread data, otherwise walk forward */
+    for (i = 0; i < nelem; i++) {
+        idx = conv->dst_size > conv->src_size ? nelem - i - 1 : i;
+        val = H5_daos_tconv_load(s + (idx * conv->src_size), conv->src_size, conv->src_swap);
+
+        if (conv->src_signed) {
+            /* Sign extend */
+            if (conv->src_size < 8 && (val & src_sign_bit))
+                val |= ~((src_sign_bit << 1) - 1);
+            sval = (int64_t)val;
+
+            if (conv->dst_signed)
+                val = (uint64_t)(sval > dst_smax ? dst_smax : (sval < dst_smin ? dst_smin : sval));
+            else
+                val = sval < 0 ? 0 : ((uint64_t)sval > dst_umax ? dst_umax : (uint64_t)sval);
+        } /* end if */
+        else if (conv->dst_signed) {
+            if (val > (uint64_t)dst_smax)
+                val = (uint64_t)dst_smax;
+        } /* end if */
+        else if (val > dst_umax)
+            val = dst_umax;
+
+        H5_daos_tconv_store(d + (idx * conv->dst_size), val, conv->dst_size, conv->dst_swap);
+    } /* end for */
+} /* end H5_daos_tconv_int() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_float
+ *
+ * Purpose:     Converts between IEEE single and double precision floats
+ *              of any byte order.  Values out of range for float become
+ *              infinities, matching HDF5's hard conversion when no
+ *              exception callback is set.
+ *
+ * Return:      void
+ *
+ *-------------------------------------------------------------------------
+ */
+static void
+H5_daos_tconv_float(const H5_daos_tconv_native_t *conv, const void *src, void *dst, size_t nelem)
+{
+    const uint8_t *s = (const uint8_t *)src;
+    uint8_t       *d = (uint8_t *)dst;
+    uint64_t       u64;
+    uint32_t       u32;
+    double         dval;
+    float          fval;
+    size_t         i;
+
+    if (conv->src_size == 8) {
+        assert(conv->dst_size == 4);
+
+        /* Walk forward so an in-place conversion never overwrites unread
+         * data */
+        for (i = 0; i < nelem; i++) {
+            u64 = H5_daos_tconv_load(s + (8 * i), 8, conv->src_swap);
+            (void)memcpy(&dval, &u64, sizeof(dval));
+            if (dval > (double)FLT_MAX)
+                fval = HUGE_VALF;
+            else if (dval < -(double)FLT_MAX)
+                fval = -HUGE_VALF;
+            else
+                fval = (float)dval;
+            (void)memcpy(&u32, &fval, sizeof(u32));
+            H5_daos_tconv_store(d + (4 * i), (uint64_t)u32, 4, conv->dst_swap);
+        } /* end for */
+    }     /* end if */
+    else {
+        assert(conv->src_size == 4);
+        assert(conv->dst_size == 8);
+
+        /* Walk backward so an in-place conversion never overwrites unread
+         * data */
+        for (i = nelem; i > 0; i--) {
+            u32 = (uint32_t)H5_daos_tconv_load(s + (4 * (i - 1)), 4, conv->src_swap);
+            (void)memcpy(&fval, &u32, sizeof(fval));
+            dval = (double)fval;
+            (void)memcpy(&u64, &dval, sizeof(u64));
+            H5_daos_tconv_store(d + (8 * (i - 1)), u64, 8, conv->dst_swap);
+        } /* end for */
+    }     /* end else */
+} /* end H5_daos_tconv_float() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_native_type_info
+ *
+ * Purpose:     Retrieves the information needed to convert type_id with
+ *              a connector-native routine.  Sets *supported to FALSE if
+ *              type_id is not an integer with no padding bits or an IEEE
+ *              single or double precision float.
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+static herr_t
+H5_daos_tconv_native_type_info(hid_t type_id, H5T_order_t native_order, H5T_class_t *type_class,
+                               size_t *type_size, hbool_t *swap, hbool_t *is_signed, hbool_t *supported)
+{
+    H5T_order_t order;
+    H5T_sign_t  sign;
+    htri_t      is_ieee = FALSE;
+    herr_t      ret_value = SUCCEED;
+
+    *supported = FALSE;
+
+    if (H5T_NO_CLASS == (*type_class = H5Tget_class(type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype class");
+    if (0 == (*type_size = H5Tget_size(type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype size");
+
+    if (*type_class == H5T_INTEGER) {
+        size_t precision;
+        int    offset;
+
+        if (*type_size != 1 && *type_size != 2 && *type_size != 4 && *type_size != 8)
+            D_GOTO_DONE(SUCCEED);
+        if (0 == (precision = H5Tget_precision(type_id)))
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype precision");
+        if ((offset = H5Tget_offset(type_id)) < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype offset");
+        if (precision != 8 * *type_size || offset != 0)
+            D_GOTO_DONE(SUCCEED);
+        if (H5T_SGN_ERROR == (sign = H5Tget_sign(type_id)))
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype sign");
+        *is_signed = (sign == H5T_SGN_2);
+    } /* end if */
+    else if (*type_class == H5T_FLOAT) {
+        if (*type_size == 4) {
+            if ((is_ieee = H5Tequal(type_id, H5T_IEEE_F32LE)) == 0)
+                is_ieee = H5Tequal(type_id, H5T_IEEE_F32BE);
+        } /* end if */
+        else if (*type_size == 8)
+            if ((is_ieee = H5Tequal(type_id, H5T_IEEE_F64LE)) == 0)
+                is_ieee = H5Tequal(type_id, H5T_IEEE_F64BE);
+        if (is_ieee < 0)
+            D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTCOMPARE, FAIL, "can't compare datatypes");
+        if (!is_ieee)
+            D_GOTO_DONE(SUCCEED);
+        *is_signed = TRUE;
+    } /* end if */
+    else
+        D_GOTO_DONE(SUCCEED);
+
+    /* Determine whether the type's byte order differs from the native one */
+    if (H5T_ORDER_ERROR == (order = H5Tget_order(type_id)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get datatype byte order");
+    if (order != H5T_ORDER_LE && order != H5T_ORDER_BE && *type_size > 1)
+        D_GOTO_DONE(SUCCEED);
+    *swap = (*type_size > 1) && (order != native_order);
+
+    *supported = TRUE;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_native_type_info() */
+
+/*-------------------------------------------------------------------------
+ * Function:    H5_daos_tconv_get_native
+ *
+ * Purpose:     Looks up a connector-native routine to convert from
+ *              src_type_id to dst_type_id, and fills in *conv to describe
+ *              the conversion.  Native routines cover byte swapping of
+ *              integers and IEEE floats, conversion between integer types
+ *              of any size, sign and byte order, and conversion between
+ *              IEEE single and double precision floats of any byte order.
+ *              Sets conv->func to NULL if there is no such routine, or if
+ *              the DXPL sets a type conversion exception callback (which
+ *              only HDF5 can invoke).
+ *
+ * Return:      Success:        0
+ *              Failure:        -1
+ *
+ *-------------------------------------------------------------------------
+ */
+herr_t
+H5_daos_tconv_get_native(hid_t src_type_id, hid_t dst_type_id, hid_t dxpl_id, H5_daos_tconv_native_t *conv)
+{
+    H5T_conv_except_func_t conv_cb    = NULL;
+    void                  *conv_cb_ud = NULL;
+    H5T_order_t            native_order;
+    H5T_class_t            src_class;
+    H5T_class_t            dst_class;
+    hbool_t                src_supported;
+    hbool_t                dst_supported;
+    herr_t                 ret_value = SUCCEED;
+
+    assert(conv);
+
+    memset(conv, 0, sizeof(*conv));
+
+    /* Check for a type conversion exception callback */
+    if (H5Pget_type_conv_cb(dxpl_id, &conv_cb, &conv_cb_ud) < 0)
+        D_GOTO_ERROR(H5E_PLIST, H5E_CANTGET, FAIL, "can't get type conversion exception callback");
+    if (conv_cb)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Get the native byte order */
+    if (H5T_ORDER_ERROR == (native_order = H5Tget_order(H5T_NATIVE_INT)))
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get native byte order");
+
+    /* Get information about both types */
+    if (H5_daos_tconv_native_type_info(src_type_id, native_order, &src_class, &conv->src_size, &conv->src_swap,
+                                       &conv->src_signed, &src_supported) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get source datatype information");
+    if (!src_supported)
+        D_GOTO_DONE(SUCCEED);
+    if (H5_daos_tconv_native_type_info(dst_type_id, native_order, &dst_class, &conv->dst_size, &conv->dst_swap,
+                                       &conv->dst_signed, &dst_supported) < 0)
+        D_GOTO_ERROR(H5E_DATATYPE, H5E_CANTGET, FAIL, "can't get destination datatype information");
+    if (!dst_supported || src_class != dst_class)
+        D_GOTO_DONE(SUCCEED);
+
+    /* Pick the conversion routine */
+    if (conv->src_size == conv->dst_size && conv->src_signed == conv->dst_signed) {
+        /* Only the byte order can differ */
+        if (conv->src_swap != conv->dst_swap)
+            conv->func = H5_daos_tconv_bswap;
+    } /* end if */
+    else if (src_class == H5T_INTEGER)
+        conv->func = H5_daos_tconv_int;
+    else if (conv->src_size != conv->dst_size)
+        conv->func = H5_daos_tconv_float;
+
+done:
+    D_FUNC_LEAVE;
+} /* end H5_daos_tconv_get_native() */
@@ -65,6 +65,8 @@ H5_daos_err_to_string(int ret)
             return "error occurred during iteration (H5_DAOS_H5_ITER_ERROR)";
         case -H5_DAOS_H5_SCATGATH_ERROR:
             return "error occurred during HDF5 scatter/gather operation (H5_DAOS_H5_SCATGATH_ERROR)";
+        case -H5_DAOS_H5_FILTER_ERROR:
+            return "filter pipeline failed (H5_DAOS_H5_FILTER_ERROR)";
         case -H5_DAOS_H5PSET_ERROR:
             return "failed to set info on HDF5 property list (H5_DAOS_H5PSET_ERROR)";
         case -H5_DAOS_H5PGET_ERROR:
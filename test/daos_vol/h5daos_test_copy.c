@@ -0,0 +1,430 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Tests object copying in the DAOS VOL connector
+ */
+
+#include "h5daos_test.h"
+
+#include "daos_vol.h"
+
+/*
+ * Definitions
+ */
+#define TRUE  1
+#define FALSE 0
+
+#define FILENAME "h5daos_test_copy.h5"
+
+/* Copy datasets in slabs of a single chunk, two slabs at a time */
+#define COPY_SLAB_SIZE "1"
+#define COPY_NSLABS    "2"
+
+/* Copy at most two objects of a group hierarchy at once */
+#define COPY_NOBJS "2"
+
+#define DSET_DIM0       100
+#define DSET_DIM1       30
+#define DSET_CHUNK_DIM0 16
+#define DSET_CHUNK_DIM1 8
+
+#define DSET_SRC_NAME      "dset_src"
+#define DSET_DST_NAME      "dset_dst"
+#define DSET_FILT_SRC_NAME "dset_filt_src"
+#define DSET_FILT_DST_NAME "dset_filt_dst"
+#define DSET_ATTR_NAME     "attr"
+
+#define GROUP_SRC_NAME  "group_src"
+#define GROUP_DST_NAME  "group_dst"
+#define GROUP_NCHILDREN 6
+#define GROUP_SUB_NAME  "sub"
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int create_dset(hid_t loc_id, const char *name, int base, hbool_t filtered);
+int check_dset(hid_t loc_id, const char *name, int base, hbool_t filtered);
+int test_copy_dset(hid_t file_id, hbool_t filtered);
+int test_copy_group(hid_t file_id);
+
+/*
+ * Function to create a chunked dataset with partial edge chunks and an
+ * attribute, filled with values starting at base
+ */
+int
+create_dset(hid_t loc_id, const char *name, int base, hbool_t filtered)
+{
+    hid_t   dset_id  = -1;
+    hid_t   attr_id  = -1;
+    hid_t   space_id = -1;
+    hid_t   dcpl_id  = -1;
+    hsize_t dims[2]  = {DSET_DIM0, DSET_DIM1};
+    hsize_t cdims[2] = {DSET_CHUNK_DIM0, DSET_CHUNK_DIM1};
+    int    *wbuf     = NULL;
+    int     i;
+
+    if (NULL == (wbuf = (int *)malloc(DSET_DIM0 * DSET_DIM1 * sizeof(int))))
+        TEST_ERROR;
+    for (i = 0; i < DSET_DIM0 * DSET_DIM1; i++)
+        wbuf[i] = base + i;
+
+    if ((space_id = H5Screate_simple(2, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 2, cdims) < 0)
+        TEST_ERROR;
+    if (filtered && H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(loc_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+    if ((attr_id =
+             H5Acreate2(dset_id, DSET_ATTR_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Awrite(attr_id, H5T_NATIVE_INT, &base) < 0)
+        TEST_ERROR;
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    free(wbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+    free(wbuf);
+
+    return 1;
+} /* end create_dset() */
+
+/*
+ * Function to check the data, filters and attribute of a dataset created
+ * by create_dset()
+ */
+int
+check_dset(hid_t loc_id, const char *name, int base, hbool_t filtered)
+{
+    hid_t dset_id  = -1;
+    hid_t attr_id  = -1;
+    hid_t dcpl_id  = -1;
+    int  *rbuf     = NULL;
+    int   attr_val = 0;
+    int   nfilters;
+    int   i;
+
+    if (NULL == (rbuf = (int *)malloc(DSET_DIM0 * DSET_DIM1 * sizeof(int))))
+        TEST_ERROR;
+
+    if ((dset_id = H5Dopen2(loc_id, name, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET_DIM0 * DSET_DIM1; i++)
+        if (rbuf[i] != base + i) {
+            H5_FAILED();
+            AT();
+            printf("dataset \"%s\": element %d is %d, expected %d\n", name, i, rbuf[i], base + i);
+            goto error;
+        } /* end if */
+
+    if ((dcpl_id = H5Dget_create_plist(dset_id)) < 0)
+        TEST_ERROR;
+    if ((nfilters = H5Pget_nfilters(dcpl_id)) < 0)
+        TEST_ERROR;
+    if (nfilters != (filtered ? 1 : 0)) {
+        H5_FAILED();
+        AT();
+        printf("dataset \"%s\" has %d filters\n", name, nfilters);
+        goto error;
+    } /* end if */
+
+    if ((attr_id = H5Aopen(dset_id, DSET_ATTR_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Aread(attr_id, H5T_NATIVE_INT, &attr_val) < 0)
+        TEST_ERROR;
+    if (attr_val != base) {
+        H5_FAILED();
+        AT();
+        printf("attribute of dataset \"%s\" is %d, expected %d\n", name, attr_val, base);
+        goto error;
+    } /* end if */
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    free(rbuf);
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Pclose(dcpl_id);
+        H5Dclose(dset_id);
+    }
+    H5E_END_TRY;
+    free(rbuf);
+
+    return 1;
+} /* end check_dset() */
+
+/*
+ * Test copying a dataset that spans many copy slabs
+ */
+int
+test_copy_dset(hid_t file_id, hbool_t filtered)
+{
+    const char *src_name = filtered ? DSET_FILT_SRC_NAME : DSET_SRC_NAME;
+    const char *dst_name = filtered ? DSET_FILT_DST_NAME : DSET_DST_NAME;
+
+    if (filtered)
+        TESTING("copying a filtered dataset");
+    else
+        TESTING("copying a dataset");
+
+    if (create_dset(file_id, src_name, 1, filtered) != 0)
+        goto error;
+
+    if (H5Ocopy(file_id, src_name, file_id, dst_name, H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+
+    /* Check the copy, and that the source is unchanged */
+    if (check_dset(file_id, dst_name, 1, filtered) != 0)
+        goto error;
+    if (check_dset(file_id, src_name, 1, filtered) != 0)
+        goto error;
+
+    PASSED();
+
+    return 0;
+
+error:
+    return 1;
+} /* end test_copy_dset() */
+
+/*
+ * Test copying a group hierarchy with more members than are copied at once,
+ * in a group that tracks link creation order
+ */
+int
+test_copy_group(hid_t file_id)
+{
+    hid_t      group_id  = -1;
+    hid_t      child_id  = -1;
+    hid_t      sub_id    = -1;
+    hid_t      gcpl_id   = -1;
+    H5G_info_t group_info;
+    char       name[32];
+    char       exp_name[32];
+    int        i;
+
+    TESTING("copying a group hierarchy");
+
+    /* Create a group tracking creation order whose members are created in
+     * the opposite of name order.  Even members are datasets, odd members
+     * are groups holding a dataset and an empty group. */
+    if ((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gcreate2(file_id, GROUP_SRC_NAME, H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < GROUP_NCHILDREN; i++) {
+        snprintf(name, sizeof(name), "child%d", GROUP_NCHILDREN - i);
+        if (i % 2 == 0) {
+            if (create_dset(group_id, name, i * 1000, FALSE) != 0)
+                goto error;
+        } /* end if */
+        else {
+            if ((child_id = H5Gcreate2(group_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (create_dset(child_id, DSET_SRC_NAME, i * 1000, FALSE) != 0)
+                goto error;
+            if ((sub_id = H5Gcreate2(child_id, GROUP_SUB_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Gclose(sub_id) < 0)
+                TEST_ERROR;
+            sub_id = -1;
+            if (H5Gclose(child_id) < 0)
+                TEST_ERROR;
+            child_id = -1;
+        } /* end else */
+    }     /* end for */
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    group_id = -1;
+
+    if (H5Ocopy(file_id, GROUP_SRC_NAME, file_id, GROUP_DST_NAME, H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+
+    /* Check the copy's members, in creation order */
+    if ((group_id = H5Gopen2(file_id, GROUP_DST_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Gget_info(group_id, &group_info) < 0)
+        TEST_ERROR;
+    if (group_info.nlinks != GROUP_NCHILDREN) {
+        H5_FAILED();
+        AT();
+        printf("copied group has %llu links\n", (unsigned long long)group_info.nlinks);
+        goto error;
+    } /* end if */
+    for (i = 0; i < GROUP_NCHILDREN; i++) {
+        snprintf(exp_name, sizeof(exp_name), "child%d", GROUP_NCHILDREN - i);
+        if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)i, name, sizeof(name),
+                               H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (strcmp(name, exp_name)) {
+            H5_FAILED();
+            AT();
+            printf("link %d of copied group is \"%s\", expected \"%s\"\n", i, name, exp_name);
+            goto error;
+        } /* end if */
+
+        if (i % 2 == 0) {
+            if (check_dset(group_id, name, i * 1000, FALSE) != 0)
+                goto error;
+        } /* end if */
+        else {
+            if ((child_id = H5Gopen2(group_id, name, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (check_dset(child_id, DSET_SRC_NAME, i * 1000, FALSE) != 0)
+                goto error;
+            if ((sub_id = H5Gopen2(child_id, GROUP_SUB_NAME, H5P_DEFAULT)) < 0)
+                TEST_ERROR;
+            if (H5Gclose(sub_id) < 0)
+                TEST_ERROR;
+            sub_id = -1;
+            if (H5Gclose(child_id) < 0)
+                TEST_ERROR;
+            child_id = -1;
+        } /* end else */
+    }     /* end for */
+
+    /* Close */
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(gcpl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(sub_id);
+        H5Gclose(child_id);
+        H5Gclose(group_id);
+        H5Pclose(gcpl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_copy_group() */
+
+/*
+ * main function
+ */
+int
+main(int argc, char **argv)
+{
+    hid_t fcpl_id = -1;
+    hid_t file_id = -1;
+    int   nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    /* Set the copy parameters before the connector is initialized */
+    setenv("HDF5_DAOS_COPY_SLAB_SIZE", COPY_SLAB_SIZE, 1);
+    setenv("HDF5_DAOS_COPY_NSLABS", COPY_NSLABS, 1);
+    setenv("HDF5_DAOS_COPY_NOBJS", COPY_NOBJS, 1);
+
+    if ((fcpl_id = H5Pcreate(H5P_FILE_CREATE)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    /** set RF0 property on container */
+    if (H5daos_set_prop(fcpl_id, "rf:0") < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl_id, H5P_DEFAULT)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    nerrors += test_copy_dset(file_id, FALSE);
+    nerrors += test_copy_dset(file_id, TRUE);
+    nerrors += test_copy_group(file_id);
+
+    if (H5Fclose(file_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Pclose(fcpl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors)
+        goto error;
+
+    if (MAINPROCESS)
+        puts("All DAOS object copy tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fcpl_id);
+    }
+    H5E_END_TRY;
+
+    if (MAINPROCESS)
+        printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
@@ -0,0 +1,2097 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Tests dataset I/O paths specific to the DAOS VOL connector
+ */
+
+#include "h5daos_test.h"
+
+#include "daos_vol.h"
+
+/*
+ * Definitions
+ */
+#define TRUE  1
+#define FALSE 0
+
+#define FILENAME "h5daos_test_dset.h5"
+
+#define DSET_DIM       64
+#define DSET_CHUNK_DIM 16
+
+#define FILTER_DSET_NAME         "filter_dset"
+#define FILTER_UNSUPP_DSET_NAME  "filter_unsupp_dset"
+#define FILTER_OPT_DSET_NAME     "filter_opt_dset"
+#define FILTER_PARTIAL_START     20
+#define FILTER_PARTIAL_COUNT     8
+#define FILTER_UNREG_FILTER_ID   32015
+
+#define DIRECT_DSET_NAME      "direct_dset"
+#define DIRECT_FILT_DSET_NAME "direct_filt_dset"
+
+#define CACHE_DSET_NAME   "cache_dset"
+#define CACHE_NCHUNKS     2
+#define CACHE_WRITE_COUNT 4
+
+#define READAHEAD_DSET_NAME "readahead_dset"
+#define READAHEAD_NCHUNKS   2
+
+#define COMBINE_DSET_NAME    "combine_dset"
+#define COMBINE_NBYTES       (DSET_CHUNK_DIM * sizeof(int))
+#define COMBINE_APPEND_COUNT 2
+#define COMBINE_APPEND_END   (3 * DSET_CHUNK_DIM)
+
+#define SHRINK_DSET_NAME      "shrink_dset"
+#define SHRINK_FILT_DSET_NAME "shrink_filt_dset"
+#define SHRINK_DIM            24
+
+#define INDEX_DSET_NAME      "index_dset"
+#define INDEX_FILT_DSET_NAME "index_filt_dset"
+
+#define COMPACT_DSET_NAME "compact_dset"
+
+#define MULTI_DSET_NAME_PREFIX "multi_dset"
+#define MULTI_NDSETS           3
+
+/* Use a small VL heap buffer, so it fills up and long sequences are stored
+ * individually */
+#define VL_HEAP_BUF_SIZE "256"
+
+#define VL_DSET_NAME     "vl_dset"
+#define VLS_DSET_NAME    "vls_dset"
+#define VL_LONG_ELEM     37
+#define VL_LONG_LEN      200
+#define VL_SEL_START     10
+#define VL_SEL_COUNT     30
+
+#define TCONV_NELEM 16
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int check_buf(const int *buf, const int *exp_buf, size_t nelem, const char *what);
+int test_filters(hid_t file_id);
+int test_direct_chunk(hid_t file_id);
+int read_dset(hid_t file_id, const char *name, hid_t dapl_id, int *buf);
+int test_chunk_cache(hid_t file_id);
+int test_readahead(hid_t file_id);
+int test_write_combine(hid_t file_id);
+int test_shrink(hid_t file_id, hbool_t filtered);
+int check_chunks(hid_t dset_id, hid_t space_id, const hsize_t *offsets, size_t nchunks, hsize_t stored_size,
+                 const char *what);
+int test_chunk_index(hid_t file_id, hbool_t filtered);
+int test_compact(hid_t file_id);
+int test_multi(hid_t file_id);
+int check_vl(const hvl_t *buf, size_t start, size_t nelem);
+int check_vls(char *const *buf, size_t start, size_t nelem);
+int test_vl(hid_t file_id);
+int check_tconv_buf(const void *buf, const void *exp_buf, hid_t type_id, size_t nelem, const char *what);
+int check_tconv(hid_t file_id, const char *name, hid_t src_type_id, const void *src_buf, hid_t mem_w_type_id,
+                hid_t file_type_id, hid_t mem_r_type_id);
+int test_tconv(hid_t file_id);
+
+/*
+ * Function to compare a read buffer against the expected values
+ */
+int
+check_buf(const int *buf, const int *exp_buf, size_t nelem, const char *what)
+{
+    size_t i;
+
+    for (i = 0; i < nelem; i++)
+        if (buf[i] != exp_buf[i]) {
+            H5_FAILED();
+            AT();
+            printf("%s: element %zu is %d, expected %d\n", what, i, buf[i], exp_buf[i]);
+            goto error;
+        } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_buf() */
+
+/*
+ * Function to open a dataset, read all of it and close it
+ */
+int
+read_dset(hid_t file_id, const char *name, hid_t dapl_id, int *buf)
+{
+    hid_t dset_id = -1;
+
+    if ((dset_id = H5Dopen2(file_id, name, dapl_id)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, buf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end read_dset() */
+
+/*
+ * Test writing and reading chunked datasets with a filter pipeline,
+ * including partial chunk writes, and that datasets requiring a filter the
+ * connector can't apply can't be created
+ */
+int
+test_filters(hid_t file_id)
+{
+    hid_t    dset_id   = -1;
+    hid_t    space_id  = -1;
+    hid_t    mspace_id = -1;
+    hid_t    dcpl_id   = -1;
+    hsize_t  dims[1]   = {DSET_DIM};
+    hsize_t  cdims[1]  = {DSET_CHUNK_DIM};
+    hsize_t  start[1]  = {FILTER_PARTIAL_START};
+    hsize_t  count[1]  = {FILTER_PARTIAL_COUNT};
+    unsigned level     = 6;
+    int      wbuf[DSET_DIM];
+    int      rbuf[DSET_DIM];
+    int      pbuf[FILTER_PARTIAL_COUNT];
+    int      i;
+
+    TESTING("filter pipeline");
+
+    for (i = 0; i < DSET_DIM; i++)
+        wbuf[i] = i * 3;
+    for (i = 0; i < FILTER_PARTIAL_COUNT; i++)
+        pbuf[i] = -i - 1;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+
+    /* Shuffle, fletcher32 and deflate (optional, in case the connector was
+     * built without zlib) */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+    if (H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Pset_filter(dcpl_id, H5Z_FILTER_DEFLATE, H5Z_FLAG_OPTIONAL, 1, &level) < 0)
+        TEST_ERROR;
+    if (H5Pset_fletcher32(dcpl_id) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(file_id, FILTER_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Write the whole dataset, then overwrite part of the second chunk */
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+        TEST_ERROR;
+    for (i = 0; i < FILTER_PARTIAL_COUNT; i++)
+        wbuf[FILTER_PARTIAL_START + i] = pbuf[i];
+
+    /* Read the whole dataset back, then again after reopening it */
+    for (i = 0; i < 2; i++) {
+        memset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (check_buf(rbuf, wbuf, DSET_DIM, "filtered dataset") != 0)
+            goto error;
+
+        if (H5Dclose(dset_id) < 0)
+            TEST_ERROR;
+        dset_id = -1;
+        if (i == 0 && (dset_id = H5Dopen2(file_id, FILTER_DSET_NAME, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    /* Read the partially overwritten chunk only */
+    if ((dset_id = H5Dopen2(file_id, FILTER_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, pbuf, FILTER_PARTIAL_COUNT, "filtered dataset selection") != 0)
+        goto error;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    dcpl_id = -1;
+
+    /* A mandatory filter the connector can't apply must fail creation */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+    if (H5Pset_nbit(dcpl_id) < 0)
+        TEST_ERROR;
+    H5E_BEGIN_TRY
+    {
+        dset_id = H5Dcreate2(file_id, FILTER_UNSUPP_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                             H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (dset_id >= 0) {
+        H5_FAILED();
+        AT();
+        printf("created dataset with an unsupported mandatory filter\n");
+        goto error;
+    } /* end if */
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    dcpl_id = -1;
+
+    /* An optional filter the connector can't apply is skipped */
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+    if (H5Pset_filter(dcpl_id, FILTER_UNREG_FILTER_ID, H5Z_FLAG_OPTIONAL, 0, NULL) < 0)
+        TEST_ERROR;
+    if (H5Pset_fletcher32(dcpl_id) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, FILTER_OPT_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, wbuf, DSET_DIM, "dataset with skipped optional filter") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_filters() */
+
+/*
+ * Test direct chunk I/O on datasets with and without a filter pipeline
+ */
+int
+test_direct_chunk(hid_t file_id)
+{
+    hid_t    dset_id  = -1;
+    hid_t    space_id = -1;
+    hid_t    dcpl_id  = -1;
+    hsize_t  dims[1]  = {DSET_DIM};
+    hsize_t  cdims[1] = {DSET_CHUNK_DIM};
+    hsize_t  offset[1];
+    hsize_t  chunk_bytes;
+    uint32_t filters;
+    herr_t   partial_ret;
+    herr_t   skip_ret;
+    herr_t   unalign_ret;
+    int      wbuf[DSET_DIM];
+    int      rbuf[DSET_DIM];
+    int      chunk_buf[DSET_CHUNK_DIM];
+    int      i;
+
+    TESTING("direct chunk I/O");
+
+    for (i = 0; i < DSET_DIM; i++)
+        wbuf[i] = 0;
+    for (i = 0; i < DSET_CHUNK_DIM; i++)
+        chunk_buf[i] = i + 100;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+
+    /* Unfiltered dataset: write the second chunk directly */
+    if ((dset_id = H5Dcreate2(file_id, DIRECT_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    offset[0] = DSET_CHUNK_DIM;
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 0, offset, sizeof(chunk_buf), chunk_buf) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET_CHUNK_DIM; i++)
+        wbuf[DSET_CHUNK_DIM + i] = chunk_buf[i];
+
+    /* Regular reads see the chunk */
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, wbuf, DSET_DIM, "unfiltered dataset after direct write") != 0)
+        goto error;
+
+    /* Read the chunk back directly and check its size */
+    filters = 1;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread_chunk(dset_id, H5P_DEFAULT, offset, &filters, rbuf) < 0)
+        TEST_ERROR;
+    if (filters != 0) {
+        H5_FAILED();
+        AT();
+        printf("filter mask of unfiltered chunk is %u\n", (unsigned)filters);
+        goto error;
+    } /* end if */
+    if (check_buf(rbuf, chunk_buf, DSET_CHUNK_DIM, "unfiltered direct chunk read") != 0)
+        goto error;
+    if (H5Dget_chunk_storage_size(dset_id, offset, &chunk_bytes) < 0)
+        TEST_ERROR;
+    if (chunk_bytes != (hsize_t)sizeof(chunk_buf)) {
+        H5_FAILED();
+        AT();
+        printf("chunk storage size is %llu, expected %zu\n", (unsigned long long)chunk_bytes,
+               sizeof(chunk_buf));
+        goto error;
+    } /* end if */
+
+    /* Partial chunks, skipped filters and unaligned offsets are rejected */
+    H5E_BEGIN_TRY
+    {
+        partial_ret = H5Dwrite_chunk(dset_id, H5P_DEFAULT, 0, offset, sizeof(chunk_buf) / 2, chunk_buf);
+        skip_ret    = H5Dwrite_chunk(dset_id, H5P_DEFAULT, 1, offset, sizeof(chunk_buf), chunk_buf);
+        offset[0]   = 1;
+        unalign_ret = H5Dwrite_chunk(dset_id, H5P_DEFAULT, 0, offset, sizeof(chunk_buf), chunk_buf);
+    }
+    H5E_END_TRY;
+    if (partial_ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("wrote a partial chunk to an unfiltered dataset\n");
+        goto error;
+    } /* end if */
+    if (skip_ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("skipped a filter of an unfiltered dataset\n");
+        goto error;
+    } /* end if */
+    if (unalign_ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("wrote a chunk at an unaligned offset\n");
+        goto error;
+    } /* end if */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+
+    /* Filtered dataset: write the third chunk directly with the shuffle
+     * filter skipped, so regular reads must not unshuffle it */
+    if (H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, DIRECT_FILT_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET_DIM; i++)
+        wbuf[i] = 0;
+    offset[0] = 2 * DSET_CHUNK_DIM;
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 1, offset, sizeof(chunk_buf), chunk_buf) < 0)
+        TEST_ERROR;
+    for (i = 0; i < DSET_CHUNK_DIM; i++)
+        wbuf[2 * DSET_CHUNK_DIM + i] = chunk_buf[i];
+
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, wbuf, DSET_DIM, "filtered dataset after direct write") != 0)
+        goto error;
+
+    /* The record holds the chunk as written, with its filter mask */
+    filters = 0;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread_chunk(dset_id, H5P_DEFAULT, offset, &filters, rbuf) < 0)
+        TEST_ERROR;
+    if (filters != 1) {
+        H5_FAILED();
+        AT();
+        printf("filter mask of chunk is %u, expected 1\n", (unsigned)filters);
+        goto error;
+    } /* end if */
+    if (check_buf(rbuf, chunk_buf, DSET_CHUNK_DIM, "filtered direct chunk read") != 0)
+        goto error;
+    if (H5Dget_chunk_storage_size(dset_id, offset, &chunk_bytes) < 0)
+        TEST_ERROR;
+    if (chunk_bytes != (hsize_t)sizeof(chunk_buf)) {
+        H5_FAILED();
+        AT();
+        printf("chunk storage size is %llu, expected %zu\n", (unsigned long long)chunk_bytes,
+               sizeof(chunk_buf));
+        goto error;
+    } /* end if */
+
+    /* A chunk written through the pipeline reads back shuffled, and can be
+     * copied to another chunk directly */
+    for (i = 0; i < DSET_CHUNK_DIM; i++)
+        wbuf[i] = i - 50;
+    offset[0] = 0;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    filters = 1;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread_chunk(dset_id, H5P_DEFAULT, offset, &filters, rbuf) < 0)
+        TEST_ERROR;
+    if (filters != 0) {
+        H5_FAILED();
+        AT();
+        printf("filter mask of chunk written through the pipeline is %u\n", (unsigned)filters);
+        goto error;
+    } /* end if */
+    if (H5Dget_chunk_storage_size(dset_id, offset, &chunk_bytes) < 0)
+        TEST_ERROR;
+    if (chunk_bytes != (hsize_t)sizeof(chunk_buf)) {
+        H5_FAILED();
+        AT();
+        printf("chunk storage size is %llu, expected %zu\n", (unsigned long long)chunk_bytes,
+               sizeof(chunk_buf));
+        goto error;
+    } /* end if */
+    offset[0] = 3 * DSET_CHUNK_DIM;
+    if (H5Dwrite_chunk(dset_id, H5P_DEFAULT, 0, offset, (size_t)chunk_bytes, rbuf) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(&rbuf[3 * DSET_CHUNK_DIM], wbuf, DSET_CHUNK_DIM, "chunk copied directly") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_direct_chunk() */
+
+/*
+ * Test that reads through the chunk cache see earlier writes, including
+ * writes through another handle, that the cache is written back on
+ * H5Dflush and on close, and that only the elements written through the
+ * cache are written back
+ */
+int
+test_chunk_cache(hid_t file_id)
+{
+    hid_t   file2_id  = -1;
+    hid_t   dset_id   = -1;
+    hid_t   dset2_id  = -1;
+    hid_t   space_id  = -1;
+    hid_t   mspace_id = -1;
+    hid_t   dcpl_id   = -1;
+    hid_t   dapl_id   = -1;
+    hsize_t dims[1]   = {DSET_DIM};
+    hsize_t cdims[1]  = {DSET_CHUNK_DIM};
+    hsize_t start[1];
+    hsize_t count[1] = {CACHE_WRITE_COUNT};
+    size_t  cache_size;
+    int     exp_buf[DSET_DIM];
+    int     rbuf[DSET_DIM];
+    int     pbuf[CACHE_WRITE_COUNT];
+    int     i, j;
+
+    TESTING("chunk cache");
+
+    for (i = 0; i < DSET_DIM; i++)
+        exp_buf[i] = 0;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+
+    /* Request a cache that holds fewer chunks than the dataset has, so
+     * chunks are also evicted */
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5daos_set_chunk_cache(dapl_id, CACHE_NCHUNKS * DSET_CHUNK_DIM * sizeof(int)) < 0)
+        TEST_ERROR;
+    if (H5daos_get_chunk_cache(dapl_id, &cache_size) < 0)
+        TEST_ERROR;
+    if (cache_size != CACHE_NCHUNKS * DSET_CHUNK_DIM * sizeof(int)) {
+        H5_FAILED();
+        AT();
+        printf("chunk cache size is %zu\n", cache_size);
+        goto error;
+    } /* end if */
+
+    if ((dset_id = H5Dcreate2(file_id, CACHE_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              dapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Write a few elements at a time, reading everything back after each
+     * write */
+    for (i = 0; i < DSET_DIM / CACHE_WRITE_COUNT; i += 3) {
+        start[0] = (hsize_t)(i * CACHE_WRITE_COUNT);
+        for (j = 0; j < CACHE_WRITE_COUNT; j++) {
+            pbuf[j]                            = i * 10 + j + 1;
+            exp_buf[i * CACHE_WRITE_COUNT + j] = pbuf[j];
+        } /* end for */
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+            TEST_ERROR;
+
+        memset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (check_buf(rbuf, exp_buf, DSET_DIM, "read after write through chunk cache") != 0)
+            goto error;
+    } /* end for */
+
+    /* After H5Dflush the data is visible through another file handle */
+    if (H5Dflush(dset_id) < 0)
+        TEST_ERROR;
+    if ((file2_id = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (read_dset(file2_id, CACHE_DSET_NAME, H5P_DEFAULT, rbuf) != 0)
+        goto error;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after H5Dflush") != 0)
+        goto error;
+
+    /* Write the second element of the first chunk through the cache and the
+     * third through the other handle.  Both writes are seen by reads through
+     * the cached handle while the other handle is open, and writing back the
+     * cached chunk must not overwrite the third element. */
+    start[0] = 1;
+    count[0] = 1;
+    pbuf[0]  = -1;
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Sset_extent_simple(mspace_id, 1, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+        TEST_ERROR;
+    exp_buf[1] = pbuf[0];
+
+    if ((dset2_id = H5Dopen2(file2_id, CACHE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    start[0] = 2;
+    pbuf[0]  = -2;
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset2_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+        TEST_ERROR;
+    exp_buf[2] = pbuf[0];
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after write through other handle") != 0)
+        goto error;
+    if (H5Dclose(dset2_id) < 0)
+        TEST_ERROR;
+    dset2_id = -1;
+
+    /* Closing the dataset writes back the cache */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (read_dset(file2_id, CACHE_DSET_NAME, H5P_DEFAULT, rbuf) != 0)
+        goto error;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after close") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Fclose(file2_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset2_id);
+        H5Dclose(dset_id);
+        H5Fclose(file2_id);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_chunk_cache() */
+
+/*
+ * Test sequential reads with chunk readahead, including writes to chunks
+ * that have been read ahead
+ */
+int
+test_readahead(hid_t file_id)
+{
+    hid_t    dset_id   = -1;
+    hid_t    space_id  = -1;
+    hid_t    mspace_id = -1;
+    hid_t    dcpl_id   = -1;
+    hid_t    dapl_id   = -1;
+    hsize_t  dims[1]   = {DSET_DIM};
+    hsize_t  cdims[1]  = {DSET_CHUNK_DIM};
+    hsize_t  start[1];
+    hsize_t  count[1] = {DSET_CHUNK_DIM};
+    unsigned nchunks;
+    int      wbuf[DSET_DIM];
+    int      rbuf[DSET_DIM];
+    int      i, j;
+
+    TESTING("chunk readahead");
+
+    for (i = 0; i < DSET_DIM; i++)
+        wbuf[i] = DSET_DIM - i;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+
+    /* Write the dataset without a cache */
+    if ((dset_id = H5Dcreate2(file_id, READAHEAD_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+
+    /* Reopen it with readahead and no chunk cache requested */
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5daos_set_chunk_readahead(dapl_id, READAHEAD_NCHUNKS) < 0)
+        TEST_ERROR;
+    if (H5daos_get_chunk_readahead(dapl_id, &nchunks) < 0)
+        TEST_ERROR;
+    if (nchunks != READAHEAD_NCHUNKS) {
+        H5_FAILED();
+        AT();
+        printf("chunk readahead is %u chunks\n", nchunks);
+        goto error;
+    } /* end if */
+    if ((dset_id = H5Dopen2(file_id, READAHEAD_DSET_NAME, dapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Read the dataset one chunk at a time.  After reading the first chunk,
+     * overwrite the second, which has been read ahead. */
+    for (i = 0; i < DSET_DIM / DSET_CHUNK_DIM; i++) {
+        start[0] = (hsize_t)(i * DSET_CHUNK_DIM);
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        memset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (check_buf(rbuf, &wbuf[i * DSET_CHUNK_DIM], DSET_CHUNK_DIM, "sequential read") != 0)
+            goto error;
+
+        if (i == 0) {
+            for (j = 0; j < DSET_CHUNK_DIM; j++) {
+                rbuf[j]                  = -j;
+                wbuf[DSET_CHUNK_DIM + j] = rbuf[j];
+            } /* end for */
+            start[0] = DSET_CHUNK_DIM;
+            if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+                TEST_ERROR;
+            if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, rbuf) < 0)
+                TEST_ERROR;
+        } /* end if */
+    }     /* end for */
+
+    /* Read backwards, which doesn't trigger readahead */
+    for (i = DSET_DIM / DSET_CHUNK_DIM - 1; i >= 0; i--) {
+        start[0] = (hsize_t)(i * DSET_CHUNK_DIM);
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        memset(rbuf, 0, sizeof(rbuf));
+        if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, rbuf) < 0)
+            TEST_ERROR;
+        if (check_buf(rbuf, &wbuf[i * DSET_CHUNK_DIM], DSET_CHUNK_DIM, "backward read") != 0)
+            goto error;
+    } /* end for */
+
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+
+    /* The write survives closing the dataset */
+    memset(rbuf, 0, sizeof(rbuf));
+    if (read_dset(file_id, READAHEAD_DSET_NAME, H5P_DEFAULT, rbuf) != 0)
+        goto error;
+    if (check_buf(rbuf, wbuf, DSET_DIM, "read after close") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_readahead() */
+
+/*
+ * Test appending a few elements per write with write combining, and that
+ * disjoint combined writes don't write back the elements between them
+ */
+int
+test_write_combine(hid_t file_id)
+{
+    hid_t   file2_id  = -1;
+    hid_t   dset_id   = -1;
+    hid_t   dset2_id  = -1;
+    hid_t   space_id  = -1;
+    hid_t   mspace_id = -1;
+    hid_t   dcpl_id   = -1;
+    hid_t   dapl_id   = -1;
+    hsize_t dims[1]   = {DSET_DIM};
+    hsize_t cdims[1]  = {DSET_CHUNK_DIM};
+    hsize_t start[1];
+    hsize_t count[1] = {COMBINE_APPEND_COUNT};
+    size_t  nbytes;
+    int     exp_buf[DSET_DIM];
+    int     rbuf[DSET_DIM];
+    int     pbuf[COMBINE_APPEND_COUNT];
+    int     i, j;
+
+    TESTING("write combining");
+
+    for (i = 0; i < DSET_DIM; i++)
+        exp_buf[i] = 0;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+
+    /* Request write combining without a chunk cache */
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR;
+    if (H5daos_set_write_combine(dapl_id, COMBINE_NBYTES) < 0)
+        TEST_ERROR;
+    if (H5daos_get_write_combine(dapl_id, &nbytes) < 0)
+        TEST_ERROR;
+    if (nbytes != COMBINE_NBYTES) {
+        H5_FAILED();
+        AT();
+        printf("write combining size is %zu\n", nbytes);
+        goto error;
+    } /* end if */
+
+    if ((dset_id = H5Dcreate2(file_id, COMBINE_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              dapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Append a few elements per write, across several chunks and past the
+     * write combining size */
+    for (i = 0; i < COMBINE_APPEND_END; i += COMBINE_APPEND_COUNT) {
+        start[0] = (hsize_t)i;
+        for (j = 0; j < COMBINE_APPEND_COUNT; j++) {
+            pbuf[j]        = i + j + 1;
+            exp_buf[i + j] = pbuf[j];
+        } /* end for */
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after appends") != 0)
+        goto error;
+
+    /* Make two disjoint writes to the last chunk, then write between them
+     * through another file handle */
+    for (i = 0; i < 2; i++) {
+        start[0] = (hsize_t)(COMBINE_APPEND_END + i * 4 * COMBINE_APPEND_COUNT);
+        for (j = 0; j < COMBINE_APPEND_COUNT; j++) {
+            pbuf[j]                    = -(i * COMBINE_APPEND_COUNT + j + 1);
+            exp_buf[(int)start[0] + j] = pbuf[j];
+        } /* end for */
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+            TEST_ERROR;
+    } /* end for */
+
+    if ((file2_id = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset2_id = H5Dopen2(file2_id, COMBINE_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    start[0] = COMBINE_APPEND_END + 2 * COMBINE_APPEND_COUNT;
+    for (j = 0; j < COMBINE_APPEND_COUNT; j++) {
+        pbuf[j]                    = 1000 + j;
+        exp_buf[(int)start[0] + j] = pbuf[j];
+    } /* end for */
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset2_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, pbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2_id) < 0)
+        TEST_ERROR;
+    dset2_id = -1;
+
+    /* Closing the dataset writes back the buffered writes only */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (read_dset(file2_id, COMBINE_DSET_NAME, H5P_DEFAULT, rbuf) != 0)
+        goto error;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after close") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Fclose(file2_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset2_id);
+        H5Dclose(dset_id);
+        H5Fclose(file2_id);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_write_combine() */
+
+/*
+ * Test that data outside the extent of a shrunk dataset doesn't reappear
+ * when the dataset is extended again, including data buffered in the chunk
+ * cache
+ */
+int
+test_shrink(hid_t file_id, hbool_t filtered)
+{
+    const char *dset_name  = filtered ? SHRINK_FILT_DSET_NAME : SHRINK_DSET_NAME;
+    hid_t       dset_id    = -1;
+    hid_t       space_id   = -1;
+    hid_t       dcpl_id    = -1;
+    hid_t       dapl_id    = -1;
+    hsize_t     dims[1]    = {DSET_DIM};
+    hsize_t     maxdims[1] = {H5S_UNLIMITED};
+    hsize_t     cdims[1]   = {DSET_CHUNK_DIM};
+    hsize_t     new_dims[1];
+    int         wbuf[DSET_DIM];
+    int         rbuf[DSET_DIM];
+    int         i;
+
+    if (filtered)
+        TESTING("shrinking a filtered dataset");
+    else
+        TESTING("shrinking a dataset with a chunk cache");
+
+    for (i = 0; i < DSET_DIM; i++)
+        wbuf[i] = i + 1;
+
+    if ((space_id = H5Screate_simple(1, dims, maxdims)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+    if (filtered && H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR;
+    if ((dapl_id = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+        TEST_ERROR;
+    if (!filtered && H5daos_set_chunk_cache(dapl_id, DSET_DIM * sizeof(int)) < 0)
+        TEST_ERROR;
+
+    if ((dset_id =
+             H5Dcreate2(file_id, dset_name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id, dapl_id)) < 0)
+        TEST_ERROR;
+
+    /* Without a filter, the data is still in the chunk cache when the
+     * dataset is shrunk */
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+
+    /* Shrink the dataset into the middle of a chunk, then extend it again */
+    new_dims[0] = SHRINK_DIM;
+    if (H5Dset_extent(dset_id, new_dims) < 0)
+        TEST_ERROR;
+    if (H5Dset_extent(dset_id, dims) < 0)
+        TEST_ERROR;
+    for (i = SHRINK_DIM; i < DSET_DIM; i++)
+        wbuf[i] = 0;
+
+    /* The elements that were outside the extent read as the fill value,
+     * before and after closing the dataset */
+    memset(rbuf, 0xff, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, wbuf, DSET_DIM, "read after shrinking and extending") != 0)
+        goto error;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    memset(rbuf, 0xff, sizeof(rbuf));
+    if (read_dset(file_id, dset_name, H5P_DEFAULT, rbuf) != 0)
+        goto error;
+    if (check_buf(rbuf, wbuf, DSET_DIM, "read after close") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Pclose(dapl_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dapl_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_shrink() */
+
+/*
+ * Function to check the allocated chunks of a one-dimensional dataset
+ * reported by H5Dget_num_chunks(), H5Dget_chunk_info(),
+ * H5Dget_chunk_info_by_coord() and H5Dget_storage_size()
+ */
+int
+check_chunks(hid_t dset_id, hid_t space_id, const hsize_t *offsets, size_t nchunks, hsize_t stored_size,
+             const char *what)
+{
+    hsize_t  nchunks_out;
+    hsize_t  offset[1];
+    hsize_t  size;
+    unsigned filter_mask;
+    haddr_t  addr;
+    size_t   i;
+
+    if (H5Dget_num_chunks(dset_id, space_id, &nchunks_out) < 0)
+        TEST_ERROR;
+    if (nchunks_out != (hsize_t)nchunks) {
+        H5_FAILED();
+        AT();
+        printf("%s: dataset has %llu chunks, expected %zu\n", what, (unsigned long long)nchunks_out, nchunks);
+        goto error;
+    } /* end if */
+
+    /* Chunks are reported in order of their offsets */
+    for (i = 0; i < nchunks; i++) {
+        if (H5Dget_chunk_info(dset_id, space_id, (hsize_t)i, offset, &filter_mask, &addr, &size) < 0)
+            TEST_ERROR;
+        if (offset[0] != offsets[i] || filter_mask != 0 || size != DSET_CHUNK_DIM * sizeof(int)) {
+            H5_FAILED();
+            AT();
+            printf("%s: chunk %zu has offset %llu, filter mask %u and size %llu\n", what, i,
+                   (unsigned long long)offset[0], filter_mask, (unsigned long long)size);
+            goto error;
+        } /* end if */
+
+        offset[0] = offsets[i];
+        if (H5Dget_chunk_info_by_coord(dset_id, offset, &filter_mask, &addr, &size) < 0)
+            TEST_ERROR;
+        if (size != DSET_CHUNK_DIM * sizeof(int)) {
+            H5_FAILED();
+            AT();
+            printf("%s: chunk at offset %llu has size %llu\n", what, (unsigned long long)offset[0],
+                   (unsigned long long)size);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    if ((size = H5Dget_storage_size(dset_id)) != (hsize_t)nchunks * stored_size) {
+        H5_FAILED();
+        AT();
+        printf("%s: storage size is %llu, expected %llu\n", what, (unsigned long long)size,
+               (unsigned long long)((hsize_t)nchunks * stored_size));
+        goto error;
+    } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_chunks() */
+
+/*
+ * Test the chunk queries answered from the chunk index, after writes through
+ * the dataset handle and through a handle opened with another file handle
+ */
+int
+test_chunk_index(hid_t file_id, hbool_t filtered)
+{
+    const char *dset_name  = filtered ? INDEX_FILT_DSET_NAME : INDEX_DSET_NAME;
+    hid_t       file2_id   = -1;
+    hid_t       dset_id    = -1;
+    hid_t       dset2_id   = -1;
+    hid_t       space_id   = -1;
+    hid_t       mspace_id  = -1;
+    hid_t       dcpl_id    = -1;
+    hsize_t     dims[1]    = {DSET_DIM};
+    hsize_t     cdims[1]   = {DSET_CHUNK_DIM};
+    hsize_t     offsets[3] = {0, 2 * DSET_CHUNK_DIM, 3 * DSET_CHUNK_DIM};
+    hsize_t     count[1]   = {DSET_CHUNK_DIM};
+    hsize_t     stored_size;
+    int         exp_buf[DSET_DIM];
+    int         rbuf[DSET_DIM];
+    int         i;
+
+    if (filtered)
+        TESTING("chunk queries on a filtered dataset");
+    else
+        TESTING("chunk queries");
+
+    for (i = 0; i < DSET_DIM; i++)
+        exp_buf[i] = 0;
+
+    /* Shuffle and fletcher32 keep the size of the stored chunks predictable:
+     * fletcher32 adds a 4 byte checksum */
+    stored_size = DSET_CHUNK_DIM * sizeof(int);
+    if (filtered)
+        stored_size += 4;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+    if (filtered && H5Pset_shuffle(dcpl_id) < 0)
+        TEST_ERROR;
+    if (filtered && H5Pset_fletcher32(dcpl_id) < 0)
+        TEST_ERROR;
+
+    if ((dset_id = H5Dcreate2(file_id, dset_name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (check_chunks(dset_id, space_id, offsets, 0, stored_size, "new dataset") != 0)
+        goto error;
+
+    /* Write the first and third chunks */
+    for (i = 0; i < 2; i++) {
+        int j;
+
+        for (j = 0; j < DSET_CHUNK_DIM; j++)
+            exp_buf[offsets[i] + (hsize_t)j] = (int)offsets[i] + j + 1;
+        if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, &offsets[i], NULL, count, NULL) < 0)
+            TEST_ERROR;
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, &exp_buf[offsets[i]]) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if (H5Sselect_all(space_id) < 0)
+        TEST_ERROR;
+    if (check_chunks(dset_id, space_id, offsets, 2, stored_size, "after writes") != 0)
+        goto error;
+
+    /* Write the last chunk through another file handle.  It is seen through
+     * the first handle, both by the queries and by reads. */
+    if ((file2_id = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset2_id = H5Dopen2(file2_id, dset_name, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (check_chunks(dset2_id, space_id, offsets, 2, stored_size, "other file handle") != 0)
+        goto error;
+    for (i = 0; i < DSET_CHUNK_DIM; i++)
+        exp_buf[offsets[2] + (hsize_t)i] = -i - 1;
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, &offsets[2], NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset2_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, &exp_buf[offsets[2]]) < 0)
+        TEST_ERROR;
+    if (H5Sselect_all(space_id) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset2_id) < 0)
+        TEST_ERROR;
+    dset2_id = -1;
+    if (H5Fclose(file2_id) < 0)
+        TEST_ERROR;
+    file2_id = -1;
+
+    if (check_chunks(dset_id, space_id, offsets, 3, stored_size, "after write through other handle") != 0)
+        goto error;
+    memset(rbuf, 0xff, sizeof(rbuf));
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after write through other file handle") != 0)
+        goto error;
+
+    /* The index is loaded when the dataset is reopened */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    if ((dset_id = H5Dopen2(file_id, dset_name, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (check_chunks(dset_id, space_id, offsets, 3, stored_size, "after reopening") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset2_id);
+        H5Dclose(dset_id);
+        H5Fclose(file2_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_chunk_index() */
+
+/*
+ * Test that writes to a compact dataset through one handle are seen by
+ * reads through other handles, opened through the same and through another
+ * file handle
+ */
+int
+test_compact(hid_t file_id)
+{
+    hid_t   file2_id  = -1;
+    hid_t   dset_id   = -1;
+    hid_t   dset2_id  = -1;
+    hid_t   dset3_id  = -1;
+    hid_t   space_id  = -1;
+    hid_t   mspace_id = -1;
+    hid_t   dcpl_id   = -1;
+    hsize_t dims[1]   = {DSET_DIM};
+    hsize_t start[1]  = {DSET_CHUNK_DIM};
+    hsize_t count[1]  = {DSET_CHUNK_DIM};
+    int     exp_buf[DSET_DIM];
+    int     rbuf[DSET_DIM];
+    int     i;
+
+    TESTING("compact dataset I/O through multiple handles");
+
+    for (i = 0; i < DSET_DIM; i++)
+        exp_buf[i] = i + 1;
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_layout(dcpl_id, H5D_COMPACT) < 0)
+        TEST_ERROR;
+
+    /* Open the dataset through the creating handle, another handle and a
+     * handle in another file handle, each of which reads it once */
+    if ((dset_id = H5Dcreate2(file_id, COMPACT_DSET_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, exp_buf) < 0)
+        TEST_ERROR;
+    if ((dset2_id = H5Dopen2(file_id, COMPACT_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((file2_id = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((dset3_id = H5Dopen2(file2_id, COMPACT_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset2_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read through second handle") != 0)
+        goto error;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset3_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read through other file handle") != 0)
+        goto error;
+
+    /* Write part of the dataset through the second handle, then through
+     * the handle in the other file handle, reading it back through all
+     * handles after each write */
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    for (i = 0; i < 2; i++) {
+        hid_t wdset_id = i == 0 ? dset2_id : dset3_id;
+        hid_t read_ids[3];
+        int   j;
+
+        for (j = 0; j < DSET_CHUNK_DIM; j++)
+            exp_buf[DSET_CHUNK_DIM + j] = -(i * DSET_CHUNK_DIM + j) - 1;
+        if (H5Dwrite(wdset_id, H5T_NATIVE_INT, mspace_id, space_id, H5P_DEFAULT, exp_buf + start[0]) < 0)
+            TEST_ERROR;
+
+        read_ids[0] = dset_id;
+        read_ids[1] = dset2_id;
+        read_ids[2] = dset3_id;
+        for (j = 0; j < 3; j++) {
+            memset(rbuf, 0, sizeof(rbuf));
+            if (H5Dread(read_ids[j], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+                TEST_ERROR;
+            if (check_buf(rbuf, exp_buf, DSET_DIM, "read after write through other handle") != 0)
+                goto error;
+        } /* end for */
+    }     /* end for */
+
+    /* Close the handles, then check the data was stored */
+    if (H5Dclose(dset3_id) < 0)
+        TEST_ERROR;
+    dset3_id = -1;
+    if (H5Fclose(file2_id) < 0)
+        TEST_ERROR;
+    file2_id = -1;
+    if (H5Dclose(dset2_id) < 0)
+        TEST_ERROR;
+    dset2_id = -1;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    memset(rbuf, 0, sizeof(rbuf));
+    if (read_dset(file_id, COMPACT_DSET_NAME, H5P_DEFAULT, rbuf) != 0)
+        goto error;
+    if (check_buf(rbuf, exp_buf, DSET_DIM, "read after reopening") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset3_id);
+        H5Dclose(dset2_id);
+        H5Dclose(dset_id);
+        H5Fclose(file2_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_compact() */
+
+/*
+ * Test multi-dataset reads and writes, with a different layout, memory
+ * type and selection for each dataset
+ */
+int
+test_multi(hid_t file_id)
+{
+    hid_t       dset_ids[MULTI_NDSETS]   = {-1, -1, -1};
+    hid_t       mtype_ids[MULTI_NDSETS]  = {H5T_NATIVE_INT, H5T_NATIVE_INT, H5T_NATIVE_LLONG};
+    hid_t       mspace_ids[MULTI_NDSETS] = {H5S_ALL, H5S_ALL, H5S_ALL};
+    hid_t       fspace_ids[MULTI_NDSETS] = {H5S_ALL, -1, H5S_ALL};
+    hid_t       space_id                 = -1;
+    hid_t       dcpl_id                  = -1;
+    hsize_t     dims[1]                  = {DSET_DIM};
+    hsize_t     cdims[1]                 = {DSET_CHUNK_DIM};
+    hsize_t     start[1]                 = {DSET_CHUNK_DIM / 2};
+    hsize_t     stride[1]                = {3};
+    hsize_t     count[1]                 = {DSET_CHUNK_DIM};
+    const void *wbufs[MULTI_NDSETS];
+    void       *rbufs[MULTI_NDSETS];
+    char        dset_name[32];
+    int         wbuf[2][DSET_DIM];
+    int         rbuf[2][DSET_DIM];
+    long long   wbuf_ll[DSET_DIM];
+    long long   rbuf_ll[DSET_DIM];
+    int         exp_buf[DSET_DIM];
+    int         i;
+
+    TESTING("multi-dataset I/O");
+
+    for (i = 0; i < DSET_DIM; i++) {
+        wbuf[0][i] = i;
+        wbuf[1][i] = -i;
+        wbuf_ll[i] = (long long)i * 7;
+    } /* end for */
+
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+
+    /* Create a chunked dataset, a chunked dataset written through a strided
+     * selection and a contiguous dataset read and written with type
+     * conversion */
+    for (i = 0; i < MULTI_NDSETS; i++) {
+        snprintf(dset_name, sizeof(dset_name), "%s%d", MULTI_DSET_NAME_PREFIX, i);
+        if ((dset_ids[i] = H5Dcreate2(file_id, dset_name, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                                      i < 2 ? dcpl_id : H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+    } /* end for */
+    if ((fspace_ids[1] = H5Scopy(space_id)) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(fspace_ids[1], H5S_SELECT_SET, start, stride, count, NULL) < 0)
+        TEST_ERROR;
+    if ((mspace_ids[1] = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+
+    wbufs[0] = wbuf[0];
+    wbufs[1] = wbuf[1];
+    wbufs[2] = wbuf_ll;
+    if (H5Dwrite_multi(MULTI_NDSETS, dset_ids, mtype_ids, mspace_ids, fspace_ids, H5P_DEFAULT, wbufs) < 0)
+        TEST_ERROR;
+
+    /* Read back with a multi-dataset read */
+    memset(rbuf, 0, sizeof(rbuf));
+    memset(rbuf_ll, 0, sizeof(rbuf_ll));
+    rbufs[0] = rbuf[0];
+    rbufs[1] = rbuf[1];
+    rbufs[2] = rbuf_ll;
+    if (H5Dread_multi(MULTI_NDSETS, dset_ids, mtype_ids, mspace_ids, fspace_ids, H5P_DEFAULT, rbufs) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf[0], wbuf[0], DSET_DIM, "first dataset") != 0)
+        goto error;
+    if (check_buf(rbuf[1], wbuf[1], DSET_CHUNK_DIM, "second dataset") != 0)
+        goto error;
+    for (i = 0; i < DSET_DIM; i++)
+        if (rbuf_ll[i] != wbuf_ll[i]) {
+            H5_FAILED();
+            AT();
+            printf("third dataset: element %d is %lld, expected %lld\n", i, rbuf_ll[i], wbuf_ll[i]);
+            goto error;
+        } /* end if */
+
+    /* Check the strided dataset with a single-dataset read of all of it */
+    for (i = 0; i < DSET_DIM; i++)
+        exp_buf[i] = 0;
+    for (i = 0; i < DSET_CHUNK_DIM; i++)
+        exp_buf[DSET_CHUNK_DIM / 2 + 3 * i] = wbuf[1][i];
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_ids[1], H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf[0]) < 0)
+        TEST_ERROR;
+    if (check_buf(rbuf[0], exp_buf, DSET_DIM, "second dataset, whole") != 0)
+        goto error;
+
+    /* Close */
+    for (i = 0; i < MULTI_NDSETS; i++) {
+        if (H5Dclose(dset_ids[i]) < 0)
+            TEST_ERROR;
+        dset_ids[i] = -1;
+    } /* end for */
+    if (H5Sclose(mspace_ids[1]) < 0)
+        TEST_ERROR;
+    if (H5Sclose(fspace_ids[1]) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < MULTI_NDSETS; i++)
+            H5Dclose(dset_ids[i]);
+        H5Sclose(mspace_ids[1]);
+        H5Sclose(fspace_ids[1]);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_multi() */
+
+/*
+ * Function to check VL sequences read from the dataset created by
+ * test_vl()
+ */
+int
+check_vl(const hvl_t *buf, size_t start, size_t nelem)
+{
+    size_t exp_len;
+    size_t i, j;
+
+    for (i = 0; i < nelem; i++) {
+        exp_len = (start + i) == VL_LONG_ELEM ? VL_LONG_LEN : ((start + i) % 9) * 3;
+        if (buf[i].len != exp_len) {
+            H5_FAILED();
+            AT();
+            printf("sequence %zu has length %zu, expected %zu\n", start + i, buf[i].len, exp_len);
+            goto error;
+        } /* end if */
+        for (j = 0; j < exp_len; j++)
+            if (((const int *)buf[i].p)[j] != (int)((start + i) * 1000 + j)) {
+                H5_FAILED();
+                AT();
+                printf("sequence %zu: element %zu is incorrect\n", start + i, j);
+                goto error;
+            } /* end if */
+    }     /* end for */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_vl() */
+
+/*
+ * Function to check VL strings read from the dataset created by test_vl()
+ */
+int
+check_vls(char *const *buf, size_t start, size_t nelem)
+{
+    char   exp_str[32];
+    size_t i;
+
+    for (i = 0; i < nelem; i++) {
+        snprintf(exp_str, sizeof(exp_str), "string %zu", start + i);
+        if (!buf[i] || strcmp(buf[i], exp_str)) {
+            H5_FAILED();
+            AT();
+            printf("string %zu is \"%s\", expected \"%s\"\n", start + i, buf[i] ? buf[i] : "(null)",
+                   exp_str);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_vls() */
+
+/*
+ * Test reading chunked datasets of VL sequences and strings, whose
+ * sequences are prefetched for each chunk
+ */
+int
+test_vl(hid_t file_id)
+{
+    hid_t   dset_id    = -1;
+    hid_t   vl_type_id = -1;
+    hid_t   str_id     = -1;
+    hid_t   space_id   = -1;
+    hid_t   mspace_id  = -1;
+    hid_t   dcpl_id    = -1;
+    hsize_t dims[1]    = {DSET_DIM};
+    hsize_t cdims[1]   = {DSET_CHUNK_DIM};
+    hsize_t start[1]   = {VL_SEL_START};
+    hsize_t count[1]   = {VL_SEL_COUNT};
+    hvl_t   vl_wbuf[DSET_DIM];
+    hvl_t   vl_rbuf[DSET_DIM];
+    char   *str_wbuf[DSET_DIM];
+    char   *str_rbuf[DSET_DIM];
+    int    *vl_data  = NULL;
+    char   *str_data = NULL;
+    size_t  len;
+    size_t  off = 0;
+    size_t  i, j;
+
+    TESTING("VL data");
+
+    memset(vl_rbuf, 0, sizeof(vl_rbuf));
+    memset(str_rbuf, 0, sizeof(str_rbuf));
+
+    /* Set up VL sequences of varying length, including empty ones and one
+     * longer than the VL heap buffer, and strings */
+    if (NULL == (vl_data = (int *)malloc(DSET_DIM * (VL_LONG_LEN + 24) * sizeof(int))))
+        TEST_ERROR;
+    if (NULL == (str_data = (char *)malloc(DSET_DIM * 32)))
+        TEST_ERROR;
+    for (i = 0; i < DSET_DIM; i++) {
+        len            = i == VL_LONG_ELEM ? VL_LONG_LEN : (i % 9) * 3;
+        vl_wbuf[i].len = len;
+        vl_wbuf[i].p   = &vl_data[off];
+        for (j = 0; j < len; j++)
+            vl_data[off + j] = (int)(i * 1000 + j);
+        off += len;
+
+        str_wbuf[i] = &str_data[i * 32];
+        snprintf(str_wbuf[i], 32, "string %zu", i);
+    } /* end for */
+
+    if ((vl_type_id = H5Tvlen_create(H5T_NATIVE_INT)) < 0)
+        TEST_ERROR;
+    if ((str_id = H5Tcopy(H5T_C_S1)) < 0)
+        TEST_ERROR;
+    if (H5Tset_size(str_id, H5T_VARIABLE) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0)
+        TEST_ERROR;
+    if (H5Sselect_hyperslab(space_id, H5S_SELECT_SET, start, NULL, count, NULL) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+
+    /* Write the datasets */
+    if ((dset_id = H5Dcreate2(file_id, VL_DSET_NAME, vl_type_id, space_id, H5P_DEFAULT, dcpl_id,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, vl_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, vl_wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    if ((dset_id =
+             H5Dcreate2(file_id, VLS_DSET_NAME, str_id, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, str_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, str_wbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+
+    /* Read all sequences, then a selection spanning several chunks */
+    if ((dset_id = H5Dopen2(file_id, VL_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, vl_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, vl_rbuf) < 0)
+        TEST_ERROR;
+    if (check_vl(vl_rbuf, 0, DSET_DIM) != 0)
+        goto error;
+    if (H5Treclaim(vl_type_id, space_id, H5P_DEFAULT, vl_rbuf) < 0)
+        TEST_ERROR;
+    memset(vl_rbuf, 0, sizeof(vl_rbuf));
+    if (H5Dread(dset_id, vl_type_id, mspace_id, space_id, H5P_DEFAULT, vl_rbuf) < 0)
+        TEST_ERROR;
+    if (check_vl(vl_rbuf, VL_SEL_START, VL_SEL_COUNT) != 0)
+        goto error;
+    if (H5Treclaim(vl_type_id, mspace_id, H5P_DEFAULT, vl_rbuf) < 0)
+        TEST_ERROR;
+    memset(vl_rbuf, 0, sizeof(vl_rbuf));
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+
+    /* Same for the strings */
+    if ((dset_id = H5Dopen2(file_id, VLS_DSET_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, str_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, str_rbuf) < 0)
+        TEST_ERROR;
+    if (check_vls(str_rbuf, 0, DSET_DIM) != 0)
+        goto error;
+    if (H5Treclaim(str_id, space_id, H5P_DEFAULT, str_rbuf) < 0)
+        TEST_ERROR;
+    memset(str_rbuf, 0, sizeof(str_rbuf));
+    if (H5Dread(dset_id, str_id, mspace_id, space_id, H5P_DEFAULT, str_rbuf) < 0)
+        TEST_ERROR;
+    if (check_vls(str_rbuf, VL_SEL_START, VL_SEL_COUNT) != 0)
+        goto error;
+    if (H5Treclaim(str_id, mspace_id, H5P_DEFAULT, str_rbuf) < 0)
+        TEST_ERROR;
+    memset(str_rbuf, 0, sizeof(str_rbuf));
+
+    /* Close */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(mspace_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(str_id) < 0)
+        TEST_ERROR;
+    if (H5Tclose(vl_type_id) < 0)
+        TEST_ERROR;
+    free(str_data);
+    free(vl_data);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(space_id);
+        H5Tclose(str_id);
+        H5Tclose(vl_type_id);
+    }
+    H5E_END_TRY;
+    free(str_data);
+    free(vl_data);
+
+    return 1;
+} /* end test_vl() */
+
+/*
+ * Function to compare a buffer of elements of type type_id against the
+ * expected values.  Float elements are compared by value, so any NaN
+ * matches any other NaN.
+ */
+int
+check_tconv_buf(const void *buf, const void *exp_buf, hid_t type_id, size_t nelem, const char *what)
+{
+    double      dbuf[TCONV_NELEM];
+    double      exp_dbuf[TCONV_NELEM];
+    H5T_class_t type_class;
+    size_t      type_size;
+    size_t      i;
+
+    assert(nelem <= TCONV_NELEM);
+
+    if (H5T_NO_CLASS == (type_class = H5Tget_class(type_id)))
+        TEST_ERROR;
+    if (0 == (type_size = H5Tget_size(type_id)))
+        TEST_ERROR;
+
+    if (type_class == H5T_FLOAT) {
+        memcpy(dbuf, buf, nelem * type_size);
+        memcpy(exp_dbuf, exp_buf, nelem * type_size);
+        if (H5Tconvert(type_id, H5T_NATIVE_DOUBLE, nelem, dbuf, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (H5Tconvert(type_id, H5T_NATIVE_DOUBLE, nelem, exp_dbuf, NULL, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        for (i = 0; i < nelem; i++)
+            if (dbuf[i] != exp_dbuf[i] && !(isnan(dbuf[i]) && isnan(exp_dbuf[i]))) {
+                H5_FAILED();
+                AT();
+                printf("%s: element %zu is %g, expected %g\n", what, i, dbuf[i], exp_dbuf[i]);
+                goto error;
+            } /* end if */
+    }         /* end if */
+    else
+        for (i = 0; i < nelem; i++)
+            if (memcmp((const char *)buf + (i * type_size), (const char *)exp_buf + (i * type_size),
+                       type_size)) {
+                H5_FAILED();
+                AT();
+                printf("%s: element %zu does not match HDF5's conversion\n", what, i);
+                goto error;
+            } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_tconv_buf() */
+
+/*
+ * Function to write a dataset of file type file_type_id from a buffer of
+ * mem_w_type_id and read it back as mem_r_type_id, comparing the data
+ * stored and the data read against HDF5's own conversions.  The input
+ * values are given in src_type_id.  Type conversion in the connector is
+ * done in place in the type conversion buffer, or in the read buffer when
+ * the element sizes match.
+ */
+int
+check_tconv(hid_t file_id, const char *name, hid_t src_type_id, const void *src_buf, hid_t mem_w_type_id,
+            hid_t file_type_id, hid_t mem_r_type_id)
+{
+    hid_t    dset_id  = -1;
+    hid_t    space_id = -1;
+    hid_t    dcpl_id  = -1;
+    hsize_t  dims[1]  = {TCONV_NELEM};
+    hsize_t  cdims[1] = {TCONV_NELEM / 2};
+    uint64_t wbuf[TCONV_NELEM];
+    uint64_t wbuf_copy[TCONV_NELEM];
+    uint64_t file_buf[TCONV_NELEM];
+    uint64_t exp_buf[TCONV_NELEM];
+    uint64_t rbuf[TCONV_NELEM];
+
+    /* Generate the write buffer and the expected stored and read data */
+    memcpy(wbuf, src_buf, sizeof(wbuf));
+    if (H5Tconvert(src_type_id, mem_w_type_id, TCONV_NELEM, wbuf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    memcpy(wbuf_copy, wbuf, sizeof(wbuf));
+    memcpy(file_buf, wbuf, sizeof(wbuf));
+    if (H5Tconvert(mem_w_type_id, file_type_id, TCONV_NELEM, file_buf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    memcpy(exp_buf, file_buf, sizeof(file_buf));
+    if (H5Tconvert(file_type_id, mem_r_type_id, TCONV_NELEM, exp_buf, NULL, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+
+    /* Create and write the dataset */
+    if ((space_id = H5Screate_simple(1, dims, NULL)) < 0)
+        TEST_ERROR;
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0)
+        TEST_ERROR;
+    if ((dset_id = H5Dcreate2(file_id, name, file_type_id, space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dwrite(dset_id, mem_w_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, wbuf) < 0)
+        TEST_ERROR;
+    if (memcmp(wbuf, wbuf_copy, sizeof(wbuf))) {
+        H5_FAILED();
+        AT();
+        printf("%s: write buffer was modified\n", name);
+        goto error;
+    } /* end if */
+
+    /* Check the stored data */
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, file_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_tconv_buf(rbuf, file_buf, file_type_id, TCONV_NELEM, "stored data") != 0)
+        goto error;
+
+    /* Check the data read with conversion */
+    memset(rbuf, 0, sizeof(rbuf));
+    if (H5Dread(dset_id, mem_r_type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, rbuf) < 0)
+        TEST_ERROR;
+    if (check_tconv_buf(rbuf, exp_buf, mem_r_type_id, TCONV_NELEM, "converted data") != 0)
+        goto error;
+
+    /* Close */
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(dcpl_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end check_tconv() */
+
+/*
+ * Test the connector's native numeric conversions against HDF5's own:
+ * integer widening and narrowing across signs, swapped byte order on
+ * either side, and double to float overflow and NaNs
+ */
+int
+test_tconv(hid_t file_id)
+{
+    hbool_t            native_le        = H5Tget_order(H5T_NATIVE_INT) == H5T_ORDER_LE;
+    hid_t              i16_sw           = native_le ? H5T_STD_I16BE : H5T_STD_I16LE;
+    hid_t              u16_sw           = native_le ? H5T_STD_U16BE : H5T_STD_U16LE;
+    hid_t              i32_sw           = native_le ? H5T_STD_I32BE : H5T_STD_I32LE;
+    hid_t              u32_sw           = native_le ? H5T_STD_U32BE : H5T_STD_U32LE;
+    hid_t              i64_sw           = native_le ? H5T_STD_I64BE : H5T_STD_I64LE;
+    hid_t              u64_sw           = native_le ? H5T_STD_U64BE : H5T_STD_U64LE;
+    hid_t              f32_sw           = native_le ? H5T_IEEE_F32BE : H5T_IEEE_F32LE;
+    hid_t              f64_sw           = native_le ? H5T_IEEE_F64BE : H5T_IEEE_F64LE;
+    hid_t              dset_id          = -1;
+    long long          sll[TCONV_NELEM] = {LLONG_MIN, -70000, -32769, -300, -129, -128, -1, 0, 1, 127, 128,
+                                           255, 256, 32768, 65536, LLONG_MAX};
+    unsigned long long ull[TCONV_NELEM] = {0, 1, 127, 128, 255, 256, 32767, 32768, 65535, 65536, 70000,
+                                           2147483648ULL, 4294967295ULL, 4294967296ULL,
+                                           (unsigned long long)LLONG_MAX + 1, ULLONG_MAX};
+    double             dbl[TCONV_NELEM] = {0.0, 1.5, -2.25, 1e300, -1e300, NAN, INFINITY, -INFINITY, -0.0,
+                                           3e38, -3e38, 1e39, -1e39, 6e4, 1e-3, 123456789.0};
+    float              fbuf[TCONV_NELEM];
+    hbool_t            ok;
+    size_t             i;
+
+    TESTING("native type conversions");
+
+    /* Signed narrowing, then signed to unsigned widening */
+    if (check_tconv(file_id, "tconv_int0", H5T_NATIVE_LLONG, sll, H5T_NATIVE_LLONG, H5T_STD_I8LE,
+                    H5T_NATIVE_UINT) != 0)
+        goto error;
+
+    /* Signed to unsigned narrowing, then unsigned to signed narrowing */
+    if (check_tconv(file_id, "tconv_int1", H5T_NATIVE_LLONG, sll, H5T_NATIVE_INT, H5T_STD_U16LE,
+                    H5T_NATIVE_SCHAR) != 0)
+        goto error;
+
+    /* Unsigned to signed of the same size, then signed to unsigned
+     * narrowing */
+    if (check_tconv(file_id, "tconv_int2", H5T_NATIVE_ULLONG, ull, H5T_NATIVE_ULLONG, H5T_STD_I64LE,
+                    H5T_NATIVE_USHORT) != 0)
+        goto error;
+
+    /* Unsigned to signed widening, then signed widening */
+    if (check_tconv(file_id, "tconv_int3", H5T_NATIVE_ULLONG, ull, H5T_NATIVE_UCHAR, H5T_STD_I32LE,
+                    H5T_NATIVE_LLONG) != 0)
+        goto error;
+
+    /* Swapped byte order on both the source and destination */
+    if (check_tconv(file_id, "tconv_int4", H5T_NATIVE_LLONG, sll, i16_sw, u32_sw, i64_sw) != 0)
+        goto error;
+    if (check_tconv(file_id, "tconv_int5", H5T_NATIVE_ULLONG, ull, u64_sw, H5T_STD_I8LE, u16_sw) != 0)
+        goto error;
+
+    /* Swapped byte order with the same element size, read in place in the
+     * read buffer, with and without a sign change */
+    if (check_tconv(file_id, "tconv_int6", H5T_NATIVE_LLONG, sll, H5T_NATIVE_INT, i32_sw,
+                    H5T_NATIVE_INT) != 0)
+        goto error;
+    if (check_tconv(file_id, "tconv_int7", H5T_NATIVE_LLONG, sll, H5T_NATIVE_LLONG, i32_sw,
+                    H5T_NATIVE_UINT) != 0)
+        goto error;
+
+    /* Double to swapped float, then back to double */
+    if (check_tconv(file_id, "tconv_float0", H5T_NATIVE_DOUBLE, dbl, H5T_NATIVE_DOUBLE, f32_sw,
+                    H5T_NATIVE_DOUBLE) != 0)
+        goto error;
+
+    /* Swapped double to float, then back to swapped double */
+    if (check_tconv(file_id, "tconv_float1", H5T_NATIVE_DOUBLE, dbl, f64_sw, H5T_NATIVE_FLOAT, f64_sw) != 0)
+        goto error;
+
+    /* Check overflow to infinity and NaN passthrough explicitly */
+    if ((dset_id = H5Dopen2(file_id, "tconv_float0", H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Dread(dset_id, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, fbuf) < 0)
+        TEST_ERROR;
+    if (H5Dclose(dset_id) < 0)
+        TEST_ERROR;
+    dset_id = -1;
+    for (i = 0; i < TCONV_NELEM; i++) {
+        if (isnan(dbl[i]))
+            ok = isnan(fbuf[i]);
+        else if (dbl[i] > 3.5e38)
+            ok = isinf(fbuf[i]) && fbuf[i] > 0;
+        else if (dbl[i] < -3.5e38)
+            ok = isinf(fbuf[i]) && fbuf[i] < 0;
+        else
+            ok = fbuf[i] == (float)dbl[i];
+        if (!ok) {
+            H5_FAILED();
+            AT();
+            printf("element %zu, %g, was converted to %g\n", i, dbl[i], (double)fbuf[i]);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Dclose(dset_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_tconv() */
+
+/*
+ * main function
+ */
+int
+main(int argc, char **argv)
+{
+    hid_t fcpl_id = -1;
+    hid_t file_id = -1;
+    int   nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    /* Set the VL heap buffer size before the connector is initialized */
+    setenv("HDF5_DAOS_VL_HEAP_BUF_SIZE", VL_HEAP_BUF_SIZE, 1);
+
+    if ((fcpl_id = H5Pcreate(H5P_FILE_CREATE)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    /** set RF0 property on container */
+    if (H5daos_set_prop(fcpl_id, "rf:0") < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl_id, H5P_DEFAULT)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    nerrors += test_filters(file_id);
+    nerrors += test_direct_chunk(file_id);
+    nerrors += test_chunk_cache(file_id);
+    nerrors += test_readahead(file_id);
+    nerrors += test_write_combine(file_id);
+    nerrors += test_shrink(file_id, FALSE);
+    nerrors += test_shrink(file_id, TRUE);
+    nerrors += test_chunk_index(file_id, FALSE);
+    nerrors += test_chunk_index(file_id, TRUE);
+    nerrors += test_compact(file_id);
+    nerrors += test_multi(file_id);
+    nerrors += test_vl(file_id);
+    nerrors += test_tconv(file_id);
+
+    if (H5Fclose(file_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Pclose(fcpl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors)
+        goto error;
+
+    if (MAINPROCESS)
+        puts("All DAOS dataset tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fcpl_id);
+    }
+    H5E_END_TRY;
+
+    if (MAINPROCESS)
+        printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */
@@ -0,0 +1,546 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Tests collective dataset I/O in parallel.
+ */
+
+#include "h5daos_test.h"
+
+#include "daos_vol.h"
+
+#define PARALLEL_FILENAME "h5daos_test_dset_parallel.h5"
+
+/* Number of elements per rank (not a multiple of the chunk size, so the last
+ * chunk is partial) */
+#define DSET_ELEMS_PER_RANK 50
+#define DSET_CHUNK_DIM      32
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+int    mpi_size;
+
+/*
+ * Local prototypes
+ */
+static int check_dset_data(hid_t dset_id, hid_t dxpl_id, const int *exp_buf, size_t nelem);
+
+/*
+ * Function to read a whole dataset on all ranks and compare it against the
+ * expected values
+ */
+static int
+check_dset_data(hid_t dset_id, hid_t dxpl_id, const int *exp_buf, size_t nelem)
+{
+    int   *rbuf = NULL;
+    size_t i;
+
+    if (NULL == (rbuf = (int *)calloc(nelem, sizeof(int)))) {
+        H5_FAILED();
+        HDputs("    failed to allocate read buffer");
+        goto error;
+    }
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, dxpl_id, rbuf) < 0) {
+        H5_FAILED();
+        HDputs("    failed to read dataset");
+        goto error;
+    }
+
+    for (i = 0; i < nelem; i++)
+        if (rbuf[i] != exp_buf[i]) {
+            H5_FAILED();
+            printf("    rank %d: element %zu is %d, expected %d\n", mpi_rank, i, rbuf[i], exp_buf[i]);
+            goto error;
+        }
+
+    free(rbuf);
+
+    return 0;
+
+error:
+    free(rbuf);
+
+    return 1;
+}
+
+/*
+ * A test to write a chunked dataset collectively, with each rank selecting
+ * every mpi_size-th element so all ranks write to every chunk, and then
+ * read it back collectively and independently.  The first rank selects
+ * nothing in a second collective read.
+ */
+#define DSET_TEST_INTERLEAVED_NAME "interleaved_dset"
+static int
+test_coll_interleaved()
+{
+    hid_t   file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t   dset_id = H5I_INVALID_HID, dcpl_id = H5I_INVALID_HID, dxpl_id = H5I_INVALID_HID;
+    hid_t   fspace_id = H5I_INVALID_HID, mspace_id = H5I_INVALID_HID;
+    hsize_t dims[1], cdims[1] = {DSET_CHUNK_DIM};
+    hsize_t start[1], stride[1], count[1];
+    size_t  nelem = (size_t)mpi_size * DSET_ELEMS_PER_RANK;
+    size_t  i;
+    int    *wbuf = NULL, *exp_buf = NULL, *rbuf = NULL;
+
+    TESTING_2("collective write of interleaved elements");
+
+    if (NULL == (wbuf = (int *)calloc(DSET_ELEMS_PER_RANK, sizeof(int))) ||
+        NULL == (rbuf = (int *)calloc(DSET_ELEMS_PER_RANK, sizeof(int))) ||
+        NULL == (exp_buf = (int *)calloc(nelem, sizeof(int)))) {
+        H5_FAILED();
+        HDputs("    failed to allocate buffers");
+        goto error;
+    }
+    for (i = 0; i < DSET_ELEMS_PER_RANK; i++)
+        wbuf[i] = (int)(i * (size_t)mpi_size + (size_t)mpi_rank) + 1;
+    for (i = 0; i < nelem; i++)
+        exp_buf[i] = (int)i + 1;
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create FAPL");
+        goto error;
+    }
+
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set MPI on FAPL");
+        goto error;
+    }
+
+    if (H5Pset_all_coll_metadata_ops(fapl_id, 1) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective metadata reads");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    dims[0] = (hsize_t)nelem;
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create file dataspace");
+        goto error;
+    }
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create DCPL");
+        goto error;
+    }
+
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set chunk size");
+        goto error;
+    }
+
+    if ((dset_id = H5Dcreate2(file_id, DSET_TEST_INTERLEAVED_NAME, H5T_NATIVE_INT, fspace_id, H5P_DEFAULT,
+                              dcpl_id, H5P_DEFAULT)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create dataset");
+        goto error;
+    }
+
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create DXPL");
+        goto error;
+    }
+
+    if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective transfer mode");
+        goto error;
+    }
+
+    /* Select every mpi_size-th element, starting at this rank */
+    start[0]  = (hsize_t)mpi_rank;
+    stride[0] = (hsize_t)mpi_size;
+    count[0]  = DSET_ELEMS_PER_RANK;
+    if (H5Sselect_hyperslab(fspace_id, H5S_SELECT_SET, start, stride, count, NULL) < 0) {
+        H5_FAILED();
+        HDputs("    failed to select hyperslab");
+        goto error;
+    }
+
+    if ((mspace_id = H5Screate_simple(1, count, NULL)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create memory dataspace");
+        goto error;
+    }
+
+    if (H5Dwrite(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, wbuf) < 0) {
+        H5_FAILED();
+        HDputs("    failed to write dataset");
+        goto error;
+    }
+
+    /* Read the whole dataset collectively, then independently */
+    if (check_dset_data(dset_id, dxpl_id, exp_buf, nelem) != 0)
+        goto error;
+
+    if (check_dset_data(dset_id, H5P_DEFAULT, exp_buf, nelem) != 0)
+        goto error;
+
+    /* Read each rank's elements back collectively, with the first rank
+     * selecting nothing */
+    if (MAINPROCESS) {
+        if (H5Sselect_none(fspace_id) < 0 || H5Sselect_none(mspace_id) < 0) {
+            H5_FAILED();
+            HDputs("    failed to select none");
+            goto error;
+        }
+    }
+
+    if (H5Dread(dset_id, H5T_NATIVE_INT, mspace_id, fspace_id, dxpl_id, rbuf) < 0) {
+        H5_FAILED();
+        HDputs("    failed to read dataset selection");
+        goto error;
+    }
+
+    if (!MAINPROCESS)
+        for (i = 0; i < DSET_ELEMS_PER_RANK; i++)
+            if (rbuf[i] != wbuf[i]) {
+                H5_FAILED();
+                printf("    rank %d: element %zu of selection is %d, expected %d\n", mpi_rank, i, rbuf[i],
+                       wbuf[i]);
+                goto error;
+            }
+
+    if (H5Pclose(dxpl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close DXPL");
+        goto error;
+    }
+
+    if (H5Sclose(mspace_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close memory dataspace");
+        goto error;
+    }
+
+    if (H5Sclose(fspace_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file dataspace");
+        goto error;
+    }
+
+    if (H5Dclose(dset_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close dataset");
+        goto error;
+    }
+
+    if (H5Pclose(dcpl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close DCPL");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close FAPL");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    free(exp_buf);
+    free(rbuf);
+    free(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+        H5Sclose(mspace_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    free(exp_buf);
+    free(rbuf);
+    free(wbuf);
+
+    return 1;
+}
+
+/*
+ * A test to collectively write the same elements from all ranks, which
+ * must leave the data from the highest ranked process.  The write is
+ * repeated with collective buffering disabled by
+ * H5Pset_dxpl_mpio_collective_opt(), which must still write the data.
+ */
+#define DSET_TEST_OVERLAP_NAME    "overlap_dset"
+#define DSET_TEST_INDIVIDUAL_NAME "individual_dset"
+static int
+test_coll_overlap()
+{
+    hid_t   file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    hid_t   dset_id = H5I_INVALID_HID, dcpl_id = H5I_INVALID_HID, dxpl_id = H5I_INVALID_HID;
+    hid_t   fspace_id = H5I_INVALID_HID;
+    hsize_t dims[1], cdims[1] = {DSET_CHUNK_DIM};
+    size_t  nelem = (size_t)mpi_size * DSET_ELEMS_PER_RANK;
+    size_t  i;
+    int    *wbuf = NULL, *exp_buf = NULL;
+    int     j;
+
+    TESTING_2("collective write of overlapping elements");
+
+    if (NULL == (wbuf = (int *)calloc(nelem, sizeof(int))) ||
+        NULL == (exp_buf = (int *)calloc(nelem, sizeof(int)))) {
+        H5_FAILED();
+        HDputs("    failed to allocate buffers");
+        goto error;
+    }
+    for (i = 0; i < nelem; i++) {
+        wbuf[i]    = (int)i * 100 + mpi_rank;
+        exp_buf[i] = (int)i * 100 + mpi_size - 1;
+    }
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create FAPL");
+        goto error;
+    }
+
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set MPI on FAPL");
+        goto error;
+    }
+
+    if (H5Pset_all_coll_metadata_ops(fapl_id, 1) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective metadata reads");
+        goto error;
+    }
+
+    if ((file_id = H5Fopen(PARALLEL_FILENAME, H5F_ACC_RDWR, fapl_id)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to open file");
+        goto error;
+    }
+
+    dims[0] = (hsize_t)nelem;
+    if ((fspace_id = H5Screate_simple(1, dims, NULL)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create file dataspace");
+        goto error;
+    }
+
+    if ((dcpl_id = H5Pcreate(H5P_DATASET_CREATE)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create DCPL");
+        goto error;
+    }
+
+    if (H5Pset_chunk(dcpl_id, 1, cdims) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set chunk size");
+        goto error;
+    }
+
+    if ((dxpl_id = H5Pcreate(H5P_DATASET_XFER)) < 0) {
+        H5_FAILED();
+        HDputs("    failed to create DXPL");
+        goto error;
+    }
+
+    if (H5Pset_dxpl_mpio(dxpl_id, H5FD_MPIO_COLLECTIVE) < 0) {
+        H5_FAILED();
+        HDputs("    failed to set collective transfer mode");
+        goto error;
+    }
+
+    for (j = 0; j < 2; j++) {
+        /* The second time, access the dataset independently within the
+         * collective operation */
+        if (j == 1 && H5Pset_dxpl_mpio_collective_opt(dxpl_id, H5FD_MPIO_INDIVIDUAL_IO) < 0) {
+            H5_FAILED();
+            HDputs("    failed to set collective I/O option");
+            goto error;
+        }
+
+        if ((dset_id = H5Dcreate2(file_id, j == 0 ? DSET_TEST_OVERLAP_NAME : DSET_TEST_INDIVIDUAL_NAME,
+                                  H5T_NATIVE_INT, fspace_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT)) < 0) {
+            H5_FAILED();
+            HDputs("    failed to create dataset");
+            goto error;
+        }
+
+        /* Only the highest ranked process writes when collective buffering
+         * is disabled, since the order of independent writes isn't defined */
+        if (j == 1 && mpi_rank != mpi_size - 1 && H5Sselect_none(fspace_id) < 0) {
+            H5_FAILED();
+            HDputs("    failed to select none");
+            goto error;
+        }
+
+        if (H5Dwrite(dset_id, H5T_NATIVE_INT, fspace_id, fspace_id, dxpl_id, wbuf) < 0) {
+            H5_FAILED();
+            HDputs("    failed to write dataset");
+            goto error;
+        }
+
+        if (check_dset_data(dset_id, dxpl_id, exp_buf, nelem) != 0)
+            goto error;
+
+        if (H5Dclose(dset_id) < 0) {
+            H5_FAILED();
+            HDputs("    failed to close dataset");
+            goto error;
+        }
+        dset_id = H5I_INVALID_HID;
+    }
+
+    if (H5Pclose(dxpl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close DXPL");
+        goto error;
+    }
+
+    if (H5Sclose(fspace_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file dataspace");
+        goto error;
+    }
+
+    if (H5Pclose(dcpl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close DCPL");
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close FAPL");
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        H5_FAILED();
+        HDputs("    failed to close file");
+        goto error;
+    }
+
+    free(exp_buf);
+    free(wbuf);
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Pclose(dxpl_id);
+        H5Sclose(fspace_id);
+        H5Dclose(dset_id);
+        H5Pclose(dcpl_id);
+        H5Pclose(fapl_id);
+        H5Fclose(file_id);
+    }
+    H5E_END_TRY;
+
+    free(exp_buf);
+    free(wbuf);
+
+    return 1;
+}
+
+int
+main(int argc, char **argv)
+{
+    hid_t file_id = H5I_INVALID_HID, fapl_id = H5I_INVALID_HID;
+    int   nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+
+    /*
+     * Make sure that HDF5 is initialized on all MPI ranks before proceeding.
+     */
+    H5open();
+
+    if ((fapl_id = H5Pcreate(H5P_FILE_ACCESS)) < 0) {
+        HDputs("    failed to create FAPL");
+        AT();
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Pset_fapl_mpio(fapl_id, MPI_COMM_WORLD, MPI_INFO_NULL) < 0) {
+        HDputs("    failed to set MPI on FAPL");
+        AT();
+        nerrors++;
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(PARALLEL_FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id)) < 0) {
+        HDputs("    failed to create file");
+        AT();
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Fclose(file_id) < 0) {
+        HDputs("    failed to close file");
+        AT();
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Pclose(fapl_id) < 0) {
+        HDputs("    failed to close FAPL");
+        AT();
+        nerrors++;
+        goto error;
+    }
+
+    nerrors += test_coll_interleaved();
+    nerrors += test_coll_overlap();
+
+    if (nerrors)
+        goto error;
+
+    if (MAINPROCESS)
+        puts("All DAOS Parallel Dataset tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    if (MAINPROCESS)
+        printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+}
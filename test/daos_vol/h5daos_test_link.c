@@ -0,0 +1,918 @@
+/**
+ * Copyright (c) 2018-2022 The HDF Group.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * Purpose: Tests link and path name handling specific to the DAOS VOL
+ *          connector
+ */
+
+#include "h5daos_test.h"
+
+#include "daos_vol.h"
+
+/*
+ * Definitions
+ */
+#define TRUE  1
+#define FALSE 0
+
+#define FILENAME "h5daos_test_link.h5"
+
+#define PATH_TOP_NAME   "path_top"
+#define PATH_ATTR_NAME  "attr"
+#define PATH_OLD_PATH   PATH_TOP_NAME "/a/b/c"
+#define PATH_NEW_PATH   PATH_TOP_NAME "/a/x/c"
+#define PATH_DEEP_GROUP "d"
+
+#define EXISTS_GROUP_NAME "exists_group"
+#define EXISTS_NLINKS     5
+#define EXISTS_NATTRS     3
+
+#define MULTI_GROUP_NAME    "multi_group"
+#define MULTI_TARGET_PREFIX "multi_target"
+#define MULTI_NTARGETS      3
+#define MULTI_NPRE          3
+#define MULTI_NLINKS        8
+#define MULTI_NDUP          3
+
+#define CORDER_GROUP_NAME "corder_group"
+#define CORDER_NLINKS     40
+#define CORDER_NNEW       2
+#define CORDER_ITER_START 5
+
+/*
+ * Global variables
+ */
+uuid_t pool_uuid;
+int    mpi_rank;
+
+int create_group_attr(hid_t loc_id, const char *path, int val);
+int check_obj_attr(hid_t loc_id, const char *path, int exp_val);
+int test_path_cache(hid_t file_id);
+int check_exists(hid_t loc_id, const char *name, hbool_t is_attr, hbool_t exp_exists);
+int test_exists(hid_t file_id);
+int check_corder_names(hid_t group_id, const char *const names[], size_t nnames);
+int check_rc(hid_t obj_id, unsigned exp_rc);
+int test_link_multi(hid_t file_id);
+int check_corder_index(hid_t group_id, const char *const names[], size_t nnames);
+int test_corder_delete(hid_t file_id);
+
+static herr_t corder_iter_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *op_data);
+
+typedef struct corder_iter_ud_t {
+    const char *const *names;
+    size_t             nnames;
+    size_t             next;
+    int                nerrors;
+} corder_iter_ud_t;
+
+static herr_t link_iter_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *op_data);
+static herr_t attr_iter_cb(hid_t loc_id, const char *name, const H5A_info_t *info, void *op_data);
+
+/*
+ * Function to create the group at path, along with an integer attribute
+ * holding val
+ */
+int
+create_group_attr(hid_t loc_id, const char *path, int val)
+{
+    hid_t group_id = -1;
+    hid_t space_id = -1;
+    hid_t attr_id  = -1;
+    hid_t lcpl_id  = -1;
+
+    if ((lcpl_id = H5Pcreate(H5P_LINK_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_create_intermediate_group(lcpl_id, 1) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gcreate2(loc_id, path, lcpl_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+    if ((attr_id = H5Acreate2(group_id, PATH_ATTR_NAME, H5T_NATIVE_INT, space_id, H5P_DEFAULT,
+                              H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Awrite(attr_id, H5T_NATIVE_INT, &val) < 0)
+        TEST_ERROR;
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(lcpl_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Sclose(space_id);
+        H5Gclose(group_id);
+        H5Pclose(lcpl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end create_group_attr() */
+
+/*
+ * Function to check the value of the integer attribute on the object at
+ * path.  An exp_val of -1 means the object must not be found.
+ */
+int
+check_obj_attr(hid_t loc_id, const char *path, int exp_val)
+{
+    hid_t obj_id  = -1;
+    hid_t attr_id = -1;
+    int   val     = -1;
+
+    H5E_BEGIN_TRY
+    {
+        obj_id = H5Oopen(loc_id, path, H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (exp_val < 0) {
+        if (obj_id >= 0) {
+            H5_FAILED();
+            AT();
+            printf("opened \"%s\", which should not exist\n", path);
+            goto error;
+        } /* end if */
+
+        return 0;
+    } /* end if */
+    if (obj_id < 0) {
+        H5_FAILED();
+        AT();
+        printf("couldn't open \"%s\"\n", path);
+        goto error;
+    } /* end if */
+
+    if ((attr_id = H5Aopen(obj_id, PATH_ATTR_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Aread(attr_id, H5T_NATIVE_INT, &val) < 0)
+        TEST_ERROR;
+    if (val != exp_val) {
+        H5_FAILED();
+        AT();
+        printf("\"%s\" has attribute value %d, expected %d\n", path, val, exp_val);
+        goto error;
+    } /* end if */
+
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    if (H5Oclose(obj_id) < 0)
+        TEST_ERROR;
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Oclose(obj_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end check_obj_attr() */
+
+/*
+ * Test that paths resolve to the right objects after the groups they were
+ * resolved through before are moved, deleted and recreated, including
+ * through another file handle
+ */
+int
+test_path_cache(hid_t file_id)
+{
+    hid_t file2_id = -1;
+
+    TESTING("path resolution after moving and deleting groups");
+
+    /* Create a deep group and resolve paths through it, so the groups along
+     * the path are cached */
+    if (create_group_attr(file_id, PATH_OLD_PATH, 1) != 0)
+        goto error;
+    if (create_group_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 2) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_OLD_PATH, 1) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 2) != 0)
+        goto error;
+
+    /* Move a group in the middle of the path */
+    if (H5Lmove(file_id, PATH_TOP_NAME "/a/b", file_id, PATH_TOP_NAME "/a/x", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (check_obj_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, -1) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_OLD_PATH, -1) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_NEW_PATH "/" PATH_DEEP_GROUP, 2) != 0)
+        goto error;
+
+    /* Recreate the old path with different groups */
+    if (create_group_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 3) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 3) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_NEW_PATH "/" PATH_DEEP_GROUP, 2) != 0)
+        goto error;
+
+    /* Delete the moved group */
+    if (H5Ldelete(file_id, PATH_TOP_NAME "/a/x", H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (check_obj_attr(file_id, PATH_NEW_PATH "/" PATH_DEEP_GROUP, -1) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_NEW_PATH, -1) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 3) != 0)
+        goto error;
+
+    /* Delete the top of the path and recreate it */
+    if (H5Ldelete(file_id, PATH_TOP_NAME, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (check_obj_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, -1) != 0)
+        goto error;
+    if (create_group_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 4) != 0)
+        goto error;
+    if (check_obj_attr(file_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 4) != 0)
+        goto error;
+
+    /* Resolve the path through another file handle, then move and delete a
+     * group in the middle of it through the first handle */
+    if ((file2_id = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (check_obj_attr(file2_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, 4) != 0)
+        goto error;
+    if (H5Lmove(file_id, PATH_TOP_NAME "/a/b", file_id, PATH_TOP_NAME "/a/x", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (check_obj_attr(file2_id, PATH_OLD_PATH "/" PATH_DEEP_GROUP, -1) != 0)
+        goto error;
+    if (check_obj_attr(file2_id, PATH_NEW_PATH "/" PATH_DEEP_GROUP, 4) != 0)
+        goto error;
+    if (H5Ldelete(file_id, PATH_TOP_NAME "/a/x", H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (check_obj_attr(file2_id, PATH_NEW_PATH "/" PATH_DEEP_GROUP, -1) != 0)
+        goto error;
+    if (H5Fclose(file2_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file2_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_path_cache() */
+
+/*
+ * Callback to count links during iteration
+ */
+static herr_t
+link_iter_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *op_data)
+{
+    (*(int *)op_data)++;
+
+    return 0;
+} /* end link_iter_cb() */
+
+/*
+ * Callback to count attributes during iteration
+ */
+static herr_t
+attr_iter_cb(hid_t loc_id, const char *name, const H5A_info_t *info, void *op_data)
+{
+    (*(int *)op_data)++;
+
+    return 0;
+} /* end attr_iter_cb() */
+
+/*
+ * Function to check that H5Lexists() or H5Aexists() returns the expected
+ * result
+ */
+int
+check_exists(hid_t loc_id, const char *name, hbool_t is_attr, hbool_t exp_exists)
+{
+    htri_t exists;
+
+    if ((exists = is_attr ? H5Aexists(loc_id, name) : H5Lexists(loc_id, name, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((exists > 0) != (exp_exists != 0)) {
+        H5_FAILED();
+        AT();
+        printf("%s \"%s\" %s\n", is_attr ? "attribute" : "link", name,
+               exp_exists ? "not found" : "found, but it should not exist");
+        goto error;
+    } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_exists() */
+
+/*
+ * Test that names report as existing after they are created, including
+ * through another handle to the same file, after the link and attribute
+ * names of a group were listed by iteration
+ */
+int
+test_exists(hid_t file_id)
+{
+    hid_t   file2_id  = -1;
+    hid_t   group_id  = -1;
+    hid_t   group2_id = -1;
+    hid_t   child_id  = -1;
+    hid_t   space_id  = -1;
+    hid_t   attr_id   = -1;
+    hsize_t idx;
+    char    name[32];
+    int     count;
+    int     i;
+
+    TESTING("existence of names created after iteration");
+
+    /* Create a group with some links and attributes */
+    if ((space_id = H5Screate(H5S_SCALAR)) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gcreate2(file_id, EXISTS_GROUP_NAME, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    for (i = 0; i < EXISTS_NLINKS; i++) {
+        snprintf(name, sizeof(name), "link%d", i);
+        if ((child_id = H5Gcreate2(group_id, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Gclose(child_id) < 0)
+            TEST_ERROR;
+        child_id = -1;
+    } /* end for */
+    for (i = 0; i < EXISTS_NATTRS; i++) {
+        snprintf(name, sizeof(name), "attr%d", i);
+        if ((attr_id = H5Acreate2(group_id, name, H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        if (H5Aclose(attr_id) < 0)
+            TEST_ERROR;
+        attr_id = -1;
+    } /* end for */
+
+    /* List all names in name order */
+    count = 0;
+    if (H5Literate2(group_id, H5_INDEX_NAME, H5_ITER_INC, NULL, link_iter_cb, &count) < 0)
+        TEST_ERROR;
+    if (count != EXISTS_NLINKS) {
+        H5_FAILED();
+        AT();
+        printf("iterated over %d links\n", count);
+        goto error;
+    } /* end if */
+    count = 0;
+    idx   = 0;
+    if (H5Aiterate2(group_id, H5_INDEX_NAME, H5_ITER_INC, &idx, attr_iter_cb, &count) < 0)
+        TEST_ERROR;
+    if (count != EXISTS_NATTRS) {
+        H5_FAILED();
+        AT();
+        printf("iterated over %d attributes\n", count);
+        goto error;
+    } /* end if */
+
+    /* Check existing and missing names */
+    if (check_exists(group_id, "link0", FALSE, TRUE) != 0)
+        goto error;
+    if (check_exists(group_id, "attr0", TRUE, TRUE) != 0)
+        goto error;
+    if (check_exists(group_id, "missing", FALSE, FALSE) != 0)
+        goto error;
+    if (check_exists(group_id, "missing", TRUE, FALSE) != 0)
+        goto error;
+
+    /* Names created and deleted through the same handle */
+    if ((child_id = H5Gcreate2(group_id, "new_link", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Gclose(child_id) < 0)
+        TEST_ERROR;
+    child_id = -1;
+    if ((attr_id = H5Acreate2(group_id, "new_attr", H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    attr_id = -1;
+    if (H5Ldelete(group_id, "link1", H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    if (check_exists(group_id, "new_link", FALSE, TRUE) != 0)
+        goto error;
+    if (check_exists(group_id, "new_attr", TRUE, TRUE) != 0)
+        goto error;
+    if (check_exists(group_id, "link1", FALSE, FALSE) != 0)
+        goto error;
+
+    /* Names created through a second handle to the file, checked both
+     * while it is open and after it is closed */
+    if ((file2_id = H5Fopen(FILENAME, H5F_ACC_RDWR, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((group2_id = H5Gopen2(file2_id, EXISTS_GROUP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if ((child_id = H5Gcreate2(group2_id, "other_link", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Gclose(child_id) < 0)
+        TEST_ERROR;
+    child_id = -1;
+    if ((attr_id =
+             H5Acreate2(group2_id, "other_attr", H5T_NATIVE_INT, space_id, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (H5Aclose(attr_id) < 0)
+        TEST_ERROR;
+    attr_id = -1;
+    for (i = 0; i < 2; i++) {
+        if (check_exists(group_id, "other_link", FALSE, TRUE) != 0)
+            goto error;
+        if (check_exists(group_id, "other_attr", TRUE, TRUE) != 0)
+            goto error;
+
+        if (i == 0) {
+            if (H5Gclose(group2_id) < 0)
+                TEST_ERROR;
+            group2_id = -1;
+            if (H5Fclose(file2_id) < 0)
+                TEST_ERROR;
+            file2_id = -1;
+        } /* end if */
+    }     /* end for */
+
+    /* Close */
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Sclose(space_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Aclose(attr_id);
+        H5Gclose(child_id);
+        H5Gclose(group2_id);
+        H5Gclose(group_id);
+        H5Fclose(file2_id);
+        H5Sclose(space_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_exists() */
+
+/*
+ * Function to check the number of links in a group and their names in
+ * creation order
+ */
+int
+check_corder_names(hid_t group_id, const char *const names[], size_t nnames)
+{
+    H5G_info_t group_info;
+    char       name[32];
+    size_t     i;
+
+    if (H5Gget_info(group_id, &group_info) < 0)
+        TEST_ERROR;
+    if (group_info.nlinks != (hsize_t)nnames) {
+        H5_FAILED();
+        AT();
+        printf("group has %llu links, expected %zu\n", (unsigned long long)group_info.nlinks, nnames);
+        goto error;
+    } /* end if */
+
+    for (i = 0; i < nnames; i++) {
+        if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)i, name, sizeof(name),
+                               H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (strcmp(name, names[i])) {
+            H5_FAILED();
+            AT();
+            printf("link %zu in creation order is \"%s\", expected \"%s\"\n", i, name, names[i]);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_corder_names() */
+
+/*
+ * Function to check the reference count of an object
+ */
+int
+check_rc(hid_t obj_id, unsigned exp_rc)
+{
+    H5O_info2_t oinfo;
+
+    if (H5Oget_info3(obj_id, &oinfo, H5O_INFO_BASIC) < 0)
+        TEST_ERROR;
+    if (oinfo.rc != exp_rc) {
+        H5_FAILED();
+        AT();
+        printf("object reference count is %u, expected %u\n", oinfo.rc, exp_rc);
+        goto error;
+    } /* end if */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_rc() */
+
+/*
+ * Test creating hard links with H5daos_link_create_hard_multi() in a group
+ * that tracks creation order, including a call that fails because some of
+ * the names already exist
+ */
+int
+test_link_multi(hid_t file_id)
+{
+    hid_t       group_id                   = -1;
+    hid_t       gcpl_id                    = -1;
+    hid_t       target_ids[MULTI_NTARGETS] = {-1, -1, -1};
+    hid_t       obj_ids[MULTI_NLINKS];
+    const char *names[MULTI_NPRE + MULTI_NLINKS + MULTI_NDUP + 1];
+    const char *dup_names[MULTI_NDUP];
+    char        name_buf[MULTI_NPRE + MULTI_NLINKS + MULTI_NDUP][16];
+    char        target_name[32];
+    unsigned    exp_rc[MULTI_NTARGETS];
+    herr_t      ret;
+    int         nnames = 0;
+    int         i;
+
+    TESTING("creating multiple hard links at once");
+
+    if ((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gcreate2(file_id, MULTI_GROUP_NAME, H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Create the link targets in the root group, and a few links one at a
+     * time */
+    for (i = 0; i < MULTI_NTARGETS; i++) {
+        snprintf(target_name, sizeof(target_name), "%s%d", MULTI_TARGET_PREFIX, i);
+        if ((target_ids[i] = H5Gcreate2(file_id, target_name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT)) < 0)
+            TEST_ERROR;
+        exp_rc[i] = 1;
+    } /* end for */
+    for (i = 0; i < MULTI_NPRE; i++) {
+        snprintf(name_buf[nnames], sizeof(name_buf[nnames]), "pre%d", i);
+        if (H5Lcreate_hard(file_id, MULTI_TARGET_PREFIX "0", group_id, name_buf[nnames], H5P_DEFAULT,
+                           H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        names[nnames] = name_buf[nnames];
+        nnames++;
+        exp_rc[0]++;
+    } /* end for */
+
+    /* Create links to all targets at once, named in the opposite of
+     * creation order */
+    for (i = 0; i < MULTI_NLINKS; i++) {
+        snprintf(name_buf[nnames], sizeof(name_buf[nnames]), "bulk%d", MULTI_NLINKS - i);
+        names[nnames] = name_buf[nnames];
+        obj_ids[i]    = target_ids[i % MULTI_NTARGETS];
+        nnames++;
+        exp_rc[i % MULTI_NTARGETS]++;
+    } /* end for */
+    if (H5daos_link_create_hard_multi(group_id, MULTI_NLINKS, &names[MULTI_NPRE], obj_ids) < 0)
+        TEST_ERROR;
+
+    if (check_corder_names(group_id, names, (size_t)nnames) != 0)
+        goto error;
+    for (i = 0; i < MULTI_NTARGETS; i++)
+        if (check_rc(target_ids[i], exp_rc[i]) != 0)
+            goto error;
+
+    /* Create links where the middle name already exists.  The call fails,
+     * but the other links are created. */
+    for (i = 0; i < MULTI_NDUP; i++) {
+        if (i == MULTI_NDUP / 2)
+            dup_names[i] = names[MULTI_NPRE];
+        else {
+            snprintf(name_buf[nnames], sizeof(name_buf[nnames]), "dup%d", i);
+            dup_names[i]  = name_buf[nnames];
+            names[nnames] = name_buf[nnames];
+            nnames++;
+            exp_rc[i % MULTI_NTARGETS]++;
+        } /* end else */
+    }     /* end for */
+    H5E_BEGIN_TRY
+    {
+        ret = H5daos_link_create_hard_multi(group_id, MULTI_NDUP, dup_names, obj_ids);
+    }
+    H5E_END_TRY;
+    if (ret >= 0) {
+        H5_FAILED();
+        AT();
+        printf("created a link with an existing name\n");
+        goto error;
+    } /* end if */
+
+    if (check_corder_names(group_id, names, (size_t)nnames) != 0)
+        goto error;
+    for (i = 0; i < MULTI_NTARGETS; i++)
+        if (check_rc(target_ids[i], exp_rc[i]) != 0)
+            goto error;
+
+    /* A link created afterwards goes at the end of the creation order */
+    if (H5Lcreate_hard(file_id, MULTI_TARGET_PREFIX "0", group_id, "post", H5P_DEFAULT, H5P_DEFAULT) < 0)
+        TEST_ERROR;
+    names[nnames++] = "post";
+    if (check_corder_names(group_id, names, (size_t)nnames) != 0)
+        goto error;
+
+    /* Close */
+    for (i = 0; i < MULTI_NTARGETS; i++) {
+        if (H5Gclose(target_ids[i]) < 0)
+            TEST_ERROR;
+        target_ids[i] = -1;
+    } /* end for */
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(gcpl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        for (i = 0; i < MULTI_NTARGETS; i++)
+            H5Gclose(target_ids[i]);
+        H5Gclose(group_id);
+        H5Pclose(gcpl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_link_multi() */
+
+/*
+ * Callback to check link names during iteration in creation order
+ */
+static herr_t
+corder_iter_cb(hid_t group_id, const char *name, const H5L_info2_t *info, void *op_data)
+{
+    corder_iter_ud_t *udata = (corder_iter_ud_t *)op_data;
+
+    if (udata->next >= udata->nnames || strcmp(name, udata->names[udata->next])) {
+        if (udata->nerrors++ == 0) {
+            H5_FAILED();
+            AT();
+            printf("iteration returned \"%s\" at position %zu\n", name, udata->next);
+        } /* end if */
+    }     /* end if */
+    udata->next++;
+
+    return 0;
+} /* end corder_iter_cb() */
+
+/*
+ * Function to check a group's creation order index: lookups by index in
+ * both directions, and iteration from the start and from the middle
+ */
+int
+check_corder_index(hid_t group_id, const char *const names[], size_t nnames)
+{
+    corder_iter_ud_t udata;
+    hsize_t          idx;
+    char             name[32];
+    size_t           i;
+
+    /* Increasing order, and the number of links */
+    if (check_corder_names(group_id, names, nnames) != 0)
+        goto error;
+
+    /* Decreasing order */
+    for (i = 0; i < nnames; i++) {
+        if (H5Lget_name_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, (hsize_t)i, name, sizeof(name),
+                               H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        if (strcmp(name, names[nnames - 1 - i])) {
+            H5_FAILED();
+            AT();
+            printf("link %zu in decreasing creation order is \"%s\", expected \"%s\"\n", i, name,
+                   names[nnames - 1 - i]);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    /* Iteration, from the start and from the middle */
+    for (i = 0; i < 2; i++) {
+        udata.names   = names;
+        udata.nnames  = nnames;
+        udata.next    = (i == 0 || nnames < CORDER_ITER_START) ? 0 : CORDER_ITER_START;
+        udata.nerrors = 0;
+        idx           = (hsize_t)udata.next;
+        if (H5Literate2(group_id, H5_INDEX_CRT_ORDER, H5_ITER_INC, &idx, corder_iter_cb, &udata) < 0)
+            TEST_ERROR;
+        if (udata.nerrors)
+            goto error;
+        if (udata.next != nnames || idx != (hsize_t)nnames) {
+            H5_FAILED();
+            AT();
+            printf("iteration stopped at position %zu, index %llu, expected %zu\n", udata.next,
+                   (unsigned long long)idx, nnames);
+            goto error;
+        } /* end if */
+    }     /* end for */
+
+    return 0;
+
+error:
+    return 1;
+} /* end check_corder_index() */
+
+/*
+ * Test lookups and iteration by creation order in a group after links are
+ * deleted from the start, middle and end of its creation order index
+ */
+int
+test_corder_delete(hid_t file_id)
+{
+    hid_t       group_id = -1;
+    hid_t       gcpl_id  = -1;
+    const char *names[CORDER_NLINKS + CORDER_NNEW];
+    char        name_buf[CORDER_NLINKS + CORDER_NNEW][16];
+    size_t      nnames    = 0;
+    size_t      del_idx[] = {0, 5, 5, 5, 5, 5, 14, 32, 10};
+    size_t      i, j;
+
+    TESTING("creation order index after deleting links");
+
+    if ((gcpl_id = H5Pcreate(H5P_GROUP_CREATE)) < 0)
+        TEST_ERROR;
+    if (H5Pset_link_creation_order(gcpl_id, H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gcreate2(file_id, CORDER_GROUP_NAME, H5P_DEFAULT, gcpl_id, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+
+    /* Create links named in the opposite of creation order */
+    for (i = 0; i < CORDER_NLINKS; i++) {
+        snprintf(name_buf[i], sizeof(name_buf[i]), "link%02d", CORDER_NLINKS - (int)i);
+        if (H5Lcreate_soft("/", group_id, name_buf[i], H5P_DEFAULT, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        names[nnames++] = name_buf[i];
+    } /* end for */
+    if (check_corder_index(group_id, names, nnames) != 0)
+        goto error;
+
+    /* Delete the first link, a run of links in the middle and the last
+     * link by name, then another link by creation order index */
+    for (i = 0; i < sizeof(del_idx) / sizeof(del_idx[0]); i++) {
+        if (i < sizeof(del_idx) / sizeof(del_idx[0]) - 1) {
+            if (H5Ldelete(group_id, names[del_idx[i]], H5P_DEFAULT) < 0)
+                TEST_ERROR;
+        } /* end if */
+        else if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_INC, (hsize_t)del_idx[i],
+                                  H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        for (j = del_idx[i]; j < nnames - 1; j++)
+            names[j] = names[j + 1];
+        nnames--;
+
+        if (check_corder_index(group_id, names, nnames) != 0)
+            goto error;
+    } /* end for */
+
+    /* New links go at the end */
+    for (i = 0; i < CORDER_NNEW; i++) {
+        snprintf(name_buf[CORDER_NLINKS + i], sizeof(name_buf[0]), "new%d", (int)i);
+        if (H5Lcreate_soft("/", group_id, name_buf[CORDER_NLINKS + i], H5P_DEFAULT, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        names[nnames++] = name_buf[CORDER_NLINKS + i];
+    } /* end for */
+    if (check_corder_index(group_id, names, nnames) != 0)
+        goto error;
+
+    /* Check again after reopening the group */
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if ((group_id = H5Gopen2(file_id, CORDER_GROUP_NAME, H5P_DEFAULT)) < 0)
+        TEST_ERROR;
+    if (check_corder_index(group_id, names, nnames) != 0)
+        goto error;
+
+    /* Delete all but the last link, from the end of the index */
+    while (nnames > 1) {
+        if (H5Ldelete_by_idx(group_id, ".", H5_INDEX_CRT_ORDER, H5_ITER_DEC, (hsize_t)1, H5P_DEFAULT) < 0)
+            TEST_ERROR;
+        names[nnames - 2] = names[nnames - 1];
+        nnames--;
+    } /* end while */
+    if (check_corder_index(group_id, names, nnames) != 0)
+        goto error;
+
+    /* Close */
+    if (H5Gclose(group_id) < 0)
+        TEST_ERROR;
+    if (H5Pclose(gcpl_id) < 0)
+        TEST_ERROR;
+
+    PASSED();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Gclose(group_id);
+        H5Pclose(gcpl_id);
+    }
+    H5E_END_TRY;
+
+    return 1;
+} /* end test_corder_delete() */
+
+/*
+ * main function
+ */
+int
+main(int argc, char **argv)
+{
+    hid_t fcpl_id = -1;
+    hid_t file_id = -1;
+    int   nerrors = 0;
+
+    MPI_Init(&argc, &argv);
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    if ((fcpl_id = H5Pcreate(H5P_FILE_CREATE)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    /** set RF0 property on container */
+    if (H5daos_set_prop(fcpl_id, "rf:0") < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if ((file_id = H5Fcreate(FILENAME, H5F_ACC_TRUNC, fcpl_id, H5P_DEFAULT)) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    nerrors += test_path_cache(file_id);
+    nerrors += test_exists(file_id);
+    nerrors += test_link_multi(file_id);
+    nerrors += test_corder_delete(file_id);
+
+    if (H5Fclose(file_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (H5Pclose(fcpl_id) < 0) {
+        nerrors++;
+        goto error;
+    }
+
+    if (nerrors)
+        goto error;
+
+    if (MAINPROCESS)
+        puts("All DAOS link tests passed");
+
+    MPI_Finalize();
+
+    return 0;
+
+error:
+    H5E_BEGIN_TRY
+    {
+        H5Fclose(file_id);
+        H5Pclose(fcpl_id);
+    }
+    H5E_END_TRY;
+
+    if (MAINPROCESS)
+        printf("*** %d TEST%s FAILED ***\n", nerrors, (!nerrors || nerrors > 1) ? "S" : "");
+
+    MPI_Finalize();
+
+    return 1;
+} /* end main() */